@@ -44,13 +44,19 @@
 #include <blaze/math/Aliases.h>
 #include <blaze/math/AlignmentFlag.h>
 #include <blaze/math/Band.h>
+#include <blaze/math/BandMatrix.h>
+#include <blaze/math/BlockCompressedMatrix.h>
 #include <blaze/math/BLAS.h>
+#include <blaze/math/Calibration.h>
 #include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/CompressedSoAMatrix.h>
 #include <blaze/math/CompressedVector.h>
 #include <blaze/math/Constraints.h>
+#include <blaze/math/CustomCompressedMatrix.h>
 #include <blaze/math/CustomMatrix.h>
 #include <blaze/math/CustomVector.h>
 #include <blaze/math/DiagonalMatrix.h>
+#include <blaze/math/Dispatch.h>
 #include <blaze/math/DynamicMatrix.h>
 #include <blaze/math/DynamicVector.h>
 #include <blaze/math/Epsilon.h>
@@ -65,11 +71,13 @@
 #include <blaze/math/HybridVector.h>
 #include <blaze/math/LAPACK.h>
 #include <blaze/math/LowerMatrix.h>
+#include <blaze/math/PackedMatrix.h>
 #include <blaze/math/PaddingFlag.h>
 #include <blaze/math/ReductionFlag.h>
 #include <blaze/math/RelaxationFlag.h>
 #include <blaze/math/Serialization.h>
 #include <blaze/math/Shims.h>
+#include <blaze/math/SlicedEllpackMatrix.h>
 #include <blaze/math/SMP.h>
 #include <blaze/math/StaticMatrix.h>
 #include <blaze/math/StaticVector.h>
@@ -118,6 +118,7 @@
 //                <li> \ref matrix_operations_matrix_exponential </li>
 //                <li> \ref matrix_operations_decomposition </li>
 //                <li> \ref matrix_operations_linear_systems </li>
+//                <li> \ref matrix_operations_batched_operations </li>
 //                <li> \ref matrix_operations_eigenvalues </li>
 //                <li> \ref matrix_operations_singularvalues </li>
 //             </ul>
@@ -251,6 +252,10 @@
 // values \b Blaze requires <a href="https://en.wikipedia.org/wiki/LAPACK">LAPACK</a>. When either
 // of these features is used it is necessary to link the LAPACK library to the final executable.
 // If no LAPACK library is available the use of these features will result in a linker error.
+// However, by disabling the LAPACK mode (see the \c BLAZE_LAPACK_MODE switch in the configuration
+// file <tt>./blaze/config/LAPACK.h</tt>) the LU, Cholesky, and QR decompositions and the matrix
+// inversions and determinants based on them are computed by native \b Blaze kernels, which do not
+// require LAPACK.
 //
 // Furthermore, it is possible to use Boost threads to run numeric operations in parallel. In this
 // case the Boost library is required to be installed on your system. It is recommended to use the
@@ -3323,9 +3328,10 @@
 // \n \section matrices_general General Concepts
 // <hr>
 //
-// The \b Blaze library currently offers five dense matrix types (\ref matrix_types_static_matrix,
+// The \b Blaze library currently offers seven dense matrix types (\ref matrix_types_static_matrix,
 // \ref matrix_types_dynamic_matrix, \ref matrix_types_hybrid_matrix, \ref matrix_types_custom_matrix,
-// and \ref matrix_types_uniform_matrix) and three sparse matrix types (\ref matrix_types_compressed_matrix,
+// \ref matrix_types_uniform_matrix, \ref matrix_types_packed_matrix, and \ref matrix_types_band_matrix)
+// and three sparse matrix types (\ref matrix_types_compressed_matrix,
 // \ref matrix_types_identity_matrix, and \ref matrix_types_zero_matrix). All matrices can either
 // be stored as row-major matrices or column-major matrices:
 
@@ -3969,6 +3975,118 @@
    blaze::UniformMatrix<double,blaze::columnMajor> C;
    \endcode
 
+// \n \subsection matrix_types_packed_matrix PackedMatrix
+//
+// The blaze::PackedMatrix class template is the representation of an arbitrary sized square
+// matrix in packed storage. It stores only the \f$ N(N+1)/2 \f$ elements of the lower triangle
+// in a single, dynamically allocated array and represents a symmetric matrix, i.e. the elements
+// \f$ (i,j) \f$ and \f$ (j,i) \f$ share the same memory location. It can be included via the
+// header file
+
+   \code
+   #include <blaze/math/PackedMatrix.h>
+   \endcode
+
+// The type of the elements and the storage order of the matrix can be specified via the two
+// template parameters:
+
+   \code
+   template< typename Type, bool SO >
+   class PackedMatrix;
+   \endcode
+
+//  - \c Type: specifies the type of the matrix elements. PackedMatrix can be used with any
+//              non-cv-qualified, non-reference element type.
+//  - \c SO  : specifies the storage order (\c blaze::rowMajor, \c blaze::columnMajor) of the
+//              matrix. The default value is \c blaze::rowMajor. A row-major packed matrix
+//              stores the lower triangle row by row, a column-major packed matrix stores it
+//              column by column (which corresponds to the LAPACK packed format for \c uplo='L').
+//
+// The blaze::PackedMatrix is primarily meant as storage backend for the adaptors: In combination
+// with the blaze::SymmetricMatrix, blaze::HermitianMatrix, blaze::LowerMatrix, and
+// blaze::UpperMatrix adaptors it halves the memory requirements of the resulting matrix. For
+// these combinations, the multiplication with a dense vector or a dense matrix is performed by
+// dedicated kernels that traverse the stored triangle only once:
+
+   \code
+   using blaze::PackedMatrix;
+   using blaze::rowMajor;
+
+   // Definition of a 100x100 symmetric matrix in packed storage
+   blaze::SymmetricMatrix< PackedMatrix<double,rowMajor> > A( 100UL );
+
+   // Definition of a 3x3 lower triangular matrix in packed storage
+   blaze::LowerMatrix< PackedMatrix<double,rowMajor> > L{ { 1, 0, 0 },
+                                                           { 2, 3, 0 },
+                                                           { 4, 5, 6 } };
+
+   blaze::DynamicVector<double> x( 3UL ), y;
+   y = L * x;  // Triangle-only matrix/vector multiplication
+   \endcode
+
+// Note that in contrast to all other matrix types, the products of packed adaptors are evaluated
+// immediately and are not subject to the expression template optimizations. Also note that the
+// packed adaptors cannot be passed to the BLAS/LAPACK based functions and do not participate
+// in shared-memory parallel assignments.
+
+// \n \subsection matrix_types_band_matrix BandMatrix
+//
+// The blaze::BandMatrix class template is the representation of an arbitrary sized matrix, whose
+// non-zero elements are confined to a band around the diagonal. The band is given by the number
+// of subdiagonals \c kl and the number of superdiagonals \c ku, which are specified at runtime.
+// Only the \f$ kl+ku+1 \f$ elements of the band of each row (or column) are stored, i.e. a
+// \f$ N \times N \f$ tridiagonal matrix requires \f$ 3N \f$ instead of \f$ N^2 \f$ elements.
+// It can be included via the header file
+
+   \code
+   #include <blaze/math/BandMatrix.h>
+   \endcode
+
+// The type of the elements and the storage order of the matrix can be specified via the two
+// template parameters:
+
+   \code
+   template< typename Type, bool SO >
+   class BandMatrix;
+   \endcode
+
+//  - \c Type: specifies the type of the matrix elements. BandMatrix can be used with any
+//              non-cv-qualified, non-reference, non-pointer element type.
+//  - \c SO  : specifies the storage order (\c blaze::rowMajor, \c blaze::columnMajor) of the
+//              matrix. The default value is \c blaze::rowMajor. A column-major band matrix
+//              corresponds to the LAPACK band storage format.
+//
+// The blaze::BandMatrix is the right choice for banded matrices as they arise for instance from
+// finite difference discretizations. The multiplication with a dense vector, a dense matrix, or
+// another band matrix as well as the addition and subtraction of two band matrices are performed
+// by dedicated, vectorized kernels that only traverse the band. Linear systems of equations with
+// a band system matrix are solved by means of the banded LAPACK solvers (see \ref lapack_functions):
+
+   \code
+   using blaze::BandMatrix;
+   using blaze::rowMajor;
+
+   // Definition of a 100x100 tridiagonal matrix
+   BandMatrix<double,rowMajor> A( 100UL, 100UL, 1UL, 1UL );
+
+   for( size_t i=0UL; i<100UL; ++i ) {
+      A(i,i) = 2.0;
+      if( i > 0UL  ) A(i,i-1UL) = -1.0;
+      if( i < 99UL ) A(i,i+1UL) = -1.0;
+   }
+
+   A(0,2) = 1.0;  // Invalid assignment to an element outside of the band; results in an exception!
+
+   blaze::DynamicVector<double> b( 100UL, 1.0 ), x;
+
+   x = A * b;          // Band-aware matrix/vector multiplication
+   x = solve( A, b );  // Solving the LSE via the banded LU decomposition (gbsv)
+   pbsv( A, b, 'L' );  // Solving the LSE via the banded Cholesky decomposition (pbsv)
+   \endcode
+
+// Note that similar to the packed adaptors, the products of band matrices are evaluated
+// immediately and band matrices do not participate in shared-memory parallel assignments.
+
 // \n \section matrix_types_sparse_matrices Sparse Matrices
 // <hr>
 //
@@ -4008,6 +4126,144 @@
    blaze::CompressedMatrix<double,blaze::columnMajor> C;
    \endcode
 
+// \n \subsection matrix_types_compressed_soa_matrix CompressedSoAMatrix
+//
+// The blaze::CompressedSoAMatrix class template is a variant of the blaze::CompressedMatrix
+// that stores the values and the indices of the non-zero elements in two separate, contiguous
+// arrays instead of a single array of value/index pairs. It can be included via the header file
+
+   \code
+   #include <blaze/math/CompressedSoAMatrix.h>
+   \endcode
+
+// In addition to the type of the elements and the storage order, the type of the stored indices
+// can be specified via a third template parameter:
+
+   \code
+   template< typename Type, bool SO, typename IT >
+   class CompressedSoAMatrix;
+   \endcode
+
+//  - \c Type: specifies the type of the matrix elements. CompressedSoAMatrix can be used with
+//             any non-cv-qualified, non-reference, non-pointer element type.
+//  - \c SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//             The default value is blaze::rowMajor.
+//  - \c IT  : specifies the unsigned integral index type. The default type is \c size_t.
+//
+// The blaze::CompressedSoAMatrix provides the same interface as the blaze::CompressedMatrix.
+// Due to the split storage and the optionally smaller index type, it considerably reduces the
+// memory traffic of memory bound operations as for instance the sparse matrix/dense vector
+// multiplication. For \c float and \c double elements the row-major matrix/vector product is
+// additionally vectorized by means of SIMD gathers in case AVX2 or AVX-512 is available:
+
+   \code
+   // Definition of a single precision row-major matrix with 32-bit indices
+   blaze::CompressedSoAMatrix<float,blaze::rowMajor,uint32_t> A( 1000UL, 1000UL );
+
+   blaze::DynamicVector<float> x( 1000UL ), y;
+   // ... Initialization of A and x
+
+   y = A * x;  // Gather-based sparse matrix/dense vector multiplication
+   \endcode
+
+// Note that the number of columns of a row-major matrix and the number of rows of a column-major
+// matrix are limited by the range of the index type. In case a larger matrix is requested, a
+// \c std::invalid_argument exception is thrown.
+//
+// \n \subsection matrix_types_sliced_ellpack_matrix SlicedEllpackMatrix
+//
+// The blaze::SlicedEllpackMatrix class template is an immutable, row-major sparse matrix in the
+// SELL-C-sigma format. It can be included via the header file
+
+   \code
+   #include <blaze/math/SlicedEllpackMatrix.h>
+   \endcode
+
+// The type of the elements and the type of the stored indices are specified via two template
+// parameters:
+
+   \code
+   template< typename Type, typename IT >
+   class SlicedEllpackMatrix;
+   \endcode
+
+//  - \c Type: specifies the type of the matrix elements. SlicedEllpackMatrix can be used with
+//             any non-cv-qualified, non-reference, non-pointer element type.
+//  - \c IT  : specifies the unsigned integral index type. The default type is \c size_t.
+//
+// The rows of the matrix are grouped into slices of \c C consecutive rows. Within each slice the
+// elements are stored column by column and each row is padded to the length of the longest row
+// of the slice, which enables the matrix/vector product to process \c C rows per SIMD lane group.
+// In order to reduce the amount of padding, the rows are sorted by their number of non-zero
+// elements within windows of \c sigma rows before they are assigned to the slices. Both the slice
+// height and the sorting scope are runtime parameters of the constructor. A SlicedEllpackMatrix is
+// built from any other matrix (typically a blaze::CompressedMatrix) and cannot be modified
+// afterwards:
+
+   \code
+   blaze::CompressedMatrix<double,blaze::rowMajor> A( 1000UL, 1000UL );
+   // ... Initialization of A
+
+   blaze::SlicedEllpackMatrix<double,uint32_t> B( A );            // Default slice height, no sorting
+   blaze::SlicedEllpackMatrix<double,uint32_t> C( A, 8UL, 64UL ); // C = 8, sigma = 64
+
+   blaze::DynamicVector<double> x( 1000UL ), y;
+   // ... Initialization of x
+
+   y = C * x;  // Sliced ELLPACK matrix/dense vector multiplication
+   \endcode
+
+// For \c float and \c double elements the product is vectorized by means of SIMD gathers in case
+// AVX2 or AVX-512 is available. For large matrices the slices are distributed among the available
+// threads (see \ref shared_memory_parallelization).
+//
+// \n \subsection matrix_types_block_compressed_matrix BlockCompressedMatrix
+//
+// The blaze::BlockCompressedMatrix class template is an immutable, row-major sparse matrix in
+// the block compressed sparse row (BSR) format. It can be included via the header file
+
+   \code
+   #include <blaze/math/BlockCompressedMatrix.h>
+   \endcode
+
+// The type of the elements, the size of the blocks, and the type of the stored indices are
+// specified via three template parameters:
+
+   \code
+   template< typename Type, size_t B, typename IT >
+   class BlockCompressedMatrix;
+   \endcode
+
+//  - \c Type: specifies the type of the matrix elements. BlockCompressedMatrix can be used with
+//             any non-cv-qualified, non-reference, non-pointer element type.
+//  - \c B   : specifies the number of rows and columns of the dense blocks.
+//  - \c IT  : specifies the unsigned integral index type. The default type is \c size_t.
+//
+// Instead of individual elements, a BlockCompressedMatrix stores dense \c B x \c B blocks in a
+// compressed row layout with a single column index per block. This reduces the index overhead
+// and enables the use of the vectorized dense kernels for matrices with a natural block
+// structure, as they arise for instance from finite element discretizations with several
+// degrees of freedom per node. The number of rows and columns must be multiples of \c B. Since
+// every element of a stored block is treated as a non-zero element, explicit zeros within the
+// blocks are included in the number of non-zero elements:
+
+   \code
+   blaze::CompressedMatrix<double,blaze::rowMajor> A( 999UL, 999UL );
+   // ... Initialization of A
+
+   blaze::BlockCompressedMatrix<double,3UL> B( A );  // 3x3 blocks
+
+   blaze::DynamicVector<double> x( 999UL ), y;
+   blaze::DynamicMatrix<double> X( 999UL, 16UL ), Y;
+   // ... Initialization of x and X
+
+   y = B * x;  // Block compressed matrix/dense vector multiplication
+   Y = B * X;  // Block compressed matrix/dense matrix multiplication
+   \endcode
+
+// For large matrices the block rows are distributed among the available threads (see
+// \ref shared_memory_parallelization).
+//
 // \n \subsection matrix_types_identity_matrix IdentityMatrix
 //
 // The blaze::IdentityMatrix class template is the representation of an immutable, arbitrary
@@ -7457,6 +7713,43 @@
 // exception is thrown the solution vector or matrix may already have been modified.
 //
 //
+// \n \section matrix_operations_batched_operations Batched Operations
+// <hr>
+//
+// Many applications (as for instance finite element codes or robotics) have to perform the same
+// operation on a large number of tiny matrices. For these cases \b Blaze provides the batched
+// operations \c batchMult(), \c batchInvert(), and \c batchSolve(), which operate on entire
+// batches of matrices. A batch is any contiguous container of dense matrices (or dense vectors
+// in case of the right-hand sides of \c batchSolve()) that provides a \c size() member function
+// and a subscript operator:
+
+   \code
+   using M4x4 = blaze::StaticMatrix<double,4UL,4UL>;
+   using V4   = blaze::StaticVector<double,4UL>;
+
+   std::vector< M4x4, blaze::AlignedAllocator<M4x4> > A( 1000UL ), B( 1000UL ), C( 1000UL );
+   std::vector< V4, blaze::AlignedAllocator<V4> > x( 1000UL ), b( 1000UL );
+   // ... Initialization of A, B, and b
+
+   blaze::batchMult( C, A, B );   // Computes C[i] = A[i] * B[i] for all i
+   blaze::batchSolve( A, x, b );  // Solves A[i] * x[i] = b[i] for all i
+   blaze::batchInvert( A );       // Inverts all matrices of A in-place
+   \endcode
+
+// All matrices of a batch must have the same size. Large batches are distributed among all
+// threads of the active shared memory parallelization (see the \c BLAZE_SMP_DMATBATCH_THRESHOLD
+// configuration). For the inversion and the solution of linear systems with \c float or
+// \c double elements, the batch is additionally processed in groups of as many matrices as fit
+// into a single SIMD vector (for instance 8 \c double matrices in case of AVX-512). Each group
+// is interleaved into a compact layout, where each SIMD vector holds the same element of all
+// matrices of the group. Thus even the inversion of 4x4 matrices fully utilizes the SIMD units.
+//
+// \c batchInvert() and \c batchSolve() don't perform any pivoting in the compact layout. All
+// matrices that encounter a small pivot are inverted or solved again by means of the pivoting
+// \c invert() and \c solve() functions. Therefore both functions require a fitting LAPACK
+// library and throw a \c std::runtime_error exception in case of a singular matrix.
+//
+//
 // \n \section matrix_operations_eigenvalues Eigenvalues/Eigenvectors
 // <hr>
 //
@@ -13276,6 +13569,28 @@
 // possible to multiply two matrices with different element type, as long as the element types
 // themselves can be multiplied.
 //
+// The multiplication of a Kronecker product with a dense vector or a dense matrix never forms
+// the Kronecker product. Instead, it is evaluated by means of the identity
+// \f$ (A \otimes B) vec(X) = vec(A X B^T) \f$, i.e. via two matrix multiplications with the
+// (dense or sparse) factors. This also applies to chains of Kronecker products, which allows
+// to apply very large Kronecker-structured operators:
+
+   \code
+   DynamicMatrix<double> A( 1000UL, 1000UL ), B( 1000UL, 1000UL ), C( 10UL, 10UL );
+   DynamicVector<double> x( 1000000UL ), y;
+
+   // ... Initialization of the matrices and the vector
+
+   y = kron( A, B ) * x;  // Two 1000x1000x1000 matrix multiplications, no 10^6x10^6 matrix
+
+   DynamicMatrix<double> D( 10000000UL, 4UL ), E;
+   E = kron( kron( A, B ), C ) * D;
+   \endcode
+
+// Note that individual elements of the resulting expression and views on it (except for columns)
+// are computed via the according rows of the Kronecker product and thus don't profit from its
+// structure. They should only be used for a small number of elements.
+//
 // \n Previous: \ref matrix_vector_multiplication &nbsp; &nbsp; Next: \ref bitwise_operations
 */
 //*************************************************************************************************
@@ -14155,6 +14470,93 @@
 // the C++11 thread parallelization.
 //
 //
+// \n \section cpp_threads_work_stealing Work-Stealing Scheduler
+// <hr>
+//
+// By default, all tasks of the C++11 thread-based parallelization are distributed via a single
+// task queue, which is protected by a mutex. Especially in case of many threads and very short
+// operations (for instance vector operations in the range of a few microseconds), the access to
+// this queue and the subsequent synchronization may take longer than the actual computation. For
+// that reason \b Blaze provides an alternative work-stealing scheduler, which is enabled by the
+// \c BLAZE_USE_WORK_STEALING_THREADS command line argument (instead of or in addition to the
+// \c BLAZE_USE_CPP_THREADS argument):
+
+   \code
+   ... -std=c++14 -DBLAZE_USE_WORK_STEALING_THREADS ...
+   \endcode
+
+// In this mode, every thread owns a lock-free task deque and idle threads steal tasks from the
+// deques of other threads. Idle threads spin for a short time before they are put to sleep, and
+// the thread that initiated a parallel operation actively participates in its execution. Note
+// that therefore only \f$ n-1 \f$ additional threads are created in case \f$ n \f$ threads are
+// requested via \c BLAZE_NUM_THREADS or the \c setNumThreads() function.
+//
+//
+// \n \section cpp_threads_async_assignment Asynchronous Assignments
+// <hr>
+//
+// Every parallel assignment waits for the completion of all its tasks before it returns. In
+// order to execute several independent dense vector or dense matrix assignments concurrently,
+// the C++11 and Boost thread-based parallelizations additionally provide the asyncAssign(),
+// asyncAddAssign(), and asyncSubAssign() functions. These functions schedule the assignment
+// and immediately return a handle, which can be used to wait for its completion:
+
+   \code
+   blaze::DynamicMatrix<double> A, B;
+   blaze::DynamicVector<double> x1, x2, y1, y2;
+   // ... Resizing and initialization
+
+   auto h1 = blaze::asyncAssign( y1, A * x1 );
+   auto h2 = blaze::asyncAssign( y2, B * x2 );
+
+   h1.wait();  // Waits for the completion of the first assignment
+   h2.wait();  // Waits for the completion of the second assignment
+   \endcode
+
+// The target and all operands must not be modified or destroyed before the according handle
+// has been waited for. In all other parallelization modes the functions perform a blocking
+// assignment and return a handle for the already completed assignment.
+//
+//
+// \n \section cpp_threads_affinity Thread Affinity and NUMA Placement
+// <hr>
+//
+// On multi-socket systems the performance of memory-bound operations depends on the placement
+// of both the threads and the memory. Via the environment variable \c BLAZE_THREAD_AFFINITY or
+// the \c setThreadAffinity() function the threads of the C++11 and Boost thread-based
+// parallelizations can be pinned to specific CPUs:
+
+   \code
+   export BLAZE_THREAD_AFFINITY=compact   // Pin consecutive threads to consecutive CPUs
+   export BLAZE_THREAD_AFFINITY=scatter   // Distribute consecutive threads among the NUMA nodes
+   export BLAZE_THREAD_AFFINITY=0-3,8-11  // Pin the threads round-robin to the given CPUs
+   \endcode
+
+   \code
+   blaze::setThreadAffinity( blaze::ThreadAffinity( blaze::AffinityPolicy::scatter ) );
+   \endcode
+
+// In addition, the memory of DynamicVector and DynamicMatrix can be placed according to the
+// NUMA policy selected via the environment variable \c BLAZE_NUMA_POLICY or the
+// \c setNumaPolicy() function. In case of the \c firsttouch policy (the default on systems with
+// more than one NUMA node) the elements of large vectors and matrices are initialized in
+// parallel, using the same partitioning as all subsequent parallel assignments. Thus every page
+// is placed on the NUMA node of the thread that will later work on it. The \c interleave policy
+// distributes the pages round-robin among all NUMA nodes (Linux only), the \c none policy
+// leaves the placement to the operating system:
+
+   \code
+   export BLAZE_NUMA_POLICY=firsttouch
+   \endcode
+
+   \code
+   blaze::setNumaPolicy( blaze::NumaPolicy::interleave );
+   \endcode
+
+// Note that in case of the OpenMP parallelization thread affinity is preferably controlled via
+// the \c OMP_PLACES and \c OMP_PROC_BIND environment variables.
+//
+//
 // \n \section cpp_threads_known_issues Known Issues
 // <hr>
 //
@@ -14790,6 +15192,45 @@
 // In case an error is encountered during (de-)serialization, a \c std::runtime_exception is
 // thrown.
 //
+// \n \section matrix_serialization_mappable Mappable Matrix Serialization
+// <hr>
+//
+// Matrices with numeric element type can alternatively be serialized in a mappable format, in
+// which all elements are stored in exactly the same layout as in memory. Dense matrices are
+// stored row by row (or column by column) with a spacing of a multiple of 64 bytes, sparse
+// matrices as three arrays of offsets, indices and values. Such a file can either be read via
+// the usual deserialization, or it can be mapped into memory via the \c MatrixMapping class,
+// which provides a \c CustomMatrix or \c CustomCompressedMatrix view on the file without
+// reading or copying any element:
+
+   \code
+   // Serialization in the mappable format
+   {
+      blaze::DynamicMatrix<double> D( 10000UL, 10000UL );
+      blaze::CompressedMatrix<double> S( 10000UL, 10000UL );
+
+      // ... Initialization
+
+      blaze::Archive<std::ofstream> archive( "matrices.blaze" );
+      serialize( archive, D, blaze::mappable );
+      serialize( archive, S, blaze::mappable );
+   }
+
+   // Zero-copy access via a memory mapping of the file
+   {
+      blaze::MatrixMapping m1( "matrices.blaze" );            // Record of the dense matrix
+      blaze::MatrixMapping m2( "matrices.blaze", m1.size() ); // Record of the sparse matrix
+
+      auto D = m1.dense<double,blaze::rowMajor>();   // Aligned, read-only CustomMatrix
+      auto S = m2.sparse<double,blaze::rowMajor>();  // Read-only CustomCompressedMatrix
+
+      blaze::DynamicVector<double> x( 10000UL, 1.0 );
+      blaze::DynamicVector<double> y = D * x + S * x;
+   }
+   \endcode
+
+// Note that the views are only valid as long as the according \c MatrixMapping exists.
+//
 // \n Previous: \ref vector_serialization &nbsp; &nbsp; Next: \ref customization \n
 */
 //*************************************************************************************************
@@ -17253,6 +17694,52 @@
 // must be performed prior to calling this function!
 //
 //
+// \n \subsection lapack_band_linear_system_solver Linear System Solver for Band Matrices
+//
+// The following functions provide an interface for the LAPACK functions \c sgbsv(), \c dgbsv(),
+// \c cgbsv(), and \c zgbsv() (banded LU decomposition with partial pivoting) and \c spbsv(),
+// \c dpbsv(), \c cpbsv(), and \c zpbsv() (banded Cholesky decomposition) for band matrices
+// (see \ref matrix_types_band_matrix):
+
+   \code
+   namespace blaze {
+
+   void gbsv( blas_int_t n, blas_int_t kl, blas_int_t ku, blas_int_t nrhs, double* AB, blas_int_t ldab, blas_int_t* ipiv, double* B, blas_int_t ldb, blas_int_t* info );
+
+   void pbsv( char uplo, blas_int_t n, blas_int_t kd, blas_int_t nrhs, double* AB, blas_int_t ldab, double* B, blas_int_t ldb, blas_int_t* info );
+
+   template< typename Type, bool SO, typename VT, bool TF >
+   void gbsv( const BandMatrix<Type,SO>& A, DenseVector<VT,TF>& b );
+
+   template< typename Type, bool SO, typename MT, bool SO2 >
+   void gbsv( const BandMatrix<Type,SO>& A, DenseMatrix<MT,SO2>& B );
+
+   template< typename Type, bool SO, typename VT, bool TF >
+   void pbsv( const BandMatrix<Type,SO>& A, DenseVector<VT,TF>& b, char uplo );
+
+   template< typename Type, bool SO, typename MT, bool SO2 >
+   void pbsv( const BandMatrix<Type,SO>& A, DenseMatrix<MT,SO2>& B, char uplo );
+
+   } // namespace blaze
+   \endcode
+
+// The low-level functions are also available for \c float, \c complex<float>, and
+// \c complex<double>. In contrast to the other solvers, the band matrix is copied into a
+// temporary LAPACK band storage and therefore remains unchanged. The system \f$ A*x=b \f$ is
+// solved independent of the storage order of \a A. If the function exits successfully, the
+// vector \a b or the matrix \a B contain the solution(s) of the linear system of equations.
+// Note that the \c solve() function uses the gbsv() functions for all band system matrices.
+//
+// The functions fail if ...
+//
+//  - ... the given system matrix is not a square matrix;
+//  - ... the given \a uplo argument is neither 'L' nor 'U';
+//  - ... the sizes of the two given matrices do not match;
+//  - ... the given system matrix is singular (or not positive definite in case of pbsv()).
+//
+// The last four functions throw an exception in case of an error.
+//
+//
 // \n \section lapack_eigenvalues Eigenvalues/Eigenvectors
 //
 // \subsection lapack_eigenvalues_general General Matrices
@@ -17856,6 +18343,23 @@
    y = A * ( B * x );
    \endcode
 
+// The same kind of optimization is applied to chains of matrix/matrix multiplications. Since the
+// sizes of the matrices are in general only known at runtime, the evaluation order of a chain is
+// selected during the assignment: based on the sizes of the matrices and the number of non-zero
+// elements of sparse matrices, the cheapest evaluation order is determined and the chain is
+// restructured accordingly:
+
+   \code
+   blaze::DynamicMatrix<double> A( 1000UL, 1000UL ), B( 1000UL, 1000UL ), C( 1000UL, 4UL ), D;
+
+   // ... Initialization
+
+   D = A * B * C;  // Evaluated as D = A * ( B * C );
+   \endcode
+
+// This reordering can be disabled via the \c BLAZE_USE_MATRIX_CHAIN_REORDERING configuration
+// switch (see the <tt>./blaze/config/Optimizations.h</tt> configuration file).
+//
 // Note however that although this intra-statement optimization may result in a measurable or
 // even significant performance improvement, this behavior may be undesirable for several reasons,
 // for instance because of numerical stability. Therefore, in case the order of evaluation matters,
@@ -17902,6 +18406,32 @@
    y = eval( A * B ) * x;
    \endcode
 
+// Whereas every single statement is optimized, several consecutive statements are evaluated
+// one after another. In case of memory-bound dense vector operations this means that every
+// statement streams its operands through the memory hierarchy again. Via the \c fused() function
+// it is possible to evaluate several dense vector statements in a single pass: the vectors are
+// split into blocks and all statements are evaluated for one block before the next block is
+// processed. The statements are created via the \c deferred() function (for assignments,
+// addition assignments, subtraction assignments, multiplication assignments and division
+// assignments) and the \c reduceTo() function (for total reductions):
+
+   \code
+   blaze::DynamicVector<double> x, r, p, q;
+   double alpha{}, rr{};
+
+   // ... Resizing and initialization
+
+   // Equivalent to x += alpha*p; r -= alpha*q; rr = sum( r*r );
+   blaze::fused( blaze::deferred( x ) += alpha * p,
+                 blaze::deferred( r ) -= alpha * q,
+                 blaze::reduceTo( rr, r * r ) );
+   \endcode
+
+// In case shared memory parallelization is active, all statements are evaluated by a single
+// parallel loop. Note that all operands are required to have the same size and that a statement
+// may only access the elements of the targets of previous statements at the same index (as for
+// instance \c r*r in the example above).
+//
 // \n Previous: \ref block_vectors_and_matrices &nbsp; &nbsp; Next: \ref faq \n
 */
 //*************************************************************************************************
@@ -18137,10 +18667,14 @@
 // \section faq_lapack To which extend does Blaze make use of LAPACK functions under the hood?
 //
 // \b Blaze uses LAPACK functions for matrix decomposition, matrix inversion, computing the
-// determinants and eigenvalues, and the SVD. In contrast to the BLAS functionality (see
-// \ref faq_blas), you cannot disable LAPACK or switch to custom kernels. In case you try to
-// use any of these functionalities, but do not provide (i.e. link) a LAPACK library you will
-// get link time errors.
+// determinants and eigenvalues, and the SVD. By means of the \c BLAZE_LAPACK_MODE switch (see
+// <tt>./blaze/config/LAPACK.h</tt>) it is possible to disable LAPACK for the LU, Cholesky, and
+// QR decompositions and for all matrix inversions and determinant computations, which are then
+// computed by native, blocked and parallelized \b Blaze kernels. Small matrices with a fixed
+// maximum size (e.g. \c StaticMatrix and \c HybridMatrix) are always decomposed by the native
+// kernels. For all other functionalities (e.g. eigenvalues and the SVD) LAPACK is required. In
+// case you try to use any of these functionalities, but do not provide (i.e. link) a LAPACK
+// library you will get link time errors.
 //
 // Please note that the extend to which \b Blaze uses LAPACK kernels can change in future releases
 // of \b Blaze!
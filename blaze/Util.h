@@ -44,6 +44,7 @@
 #include <blaze/util/AlignedArray.h>
 #include <blaze/util/AlignmentCheck.h>
 #include <blaze/util/Algorithms.h>
+#include <blaze/util/Arena.h>
 #include <blaze/util/AsConst.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/CheckedDelete.h>
@@ -60,13 +61,16 @@
 #include <blaze/util/IntegerSequence.h>
 #include <blaze/util/IntegralConstant.h>
 #include <blaze/util/InvalidType.h>
+#include <blaze/util/KernelProfile.h>
 #include <blaze/util/Limits.h>
 #include <blaze/util/Memory.h>
 #include <blaze/util/MemoryPool.h>
+#include <blaze/util/MemoryResource.h>
 #include <blaze/util/MPL.h>
 #include <blaze/util/NonCopyable.h>
 #include <blaze/util/NonCreatable.h>
 #include <blaze/util/NullType.h>
+#include <blaze/util/Numa.h>
 #include <blaze/util/NumericCast.h>
 #include <blaze/util/PointerCast.h>
 #include <blaze/util/Policies.h>
@@ -77,6 +81,7 @@
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Suffix.h>
 #include <blaze/util/Thread.h>
+#include <blaze/util/ThreadAffinity.h>
 #include <blaze/util/ThreadPool.h>
 #include <blaze/util/Time.h>
 #include <blaze/util/Timing.h>
@@ -85,5 +90,6 @@
 #include <blaze/util/TypeTraits.h>
 #include <blaze/util/UnsignedValue.h>
 #include <blaze/util/ValueTraits.h>
+#include <blaze/util/WorkStealingPool.h>
 
 #endif
@@ -38,7 +38,9 @@
 // \ingroup config
 //
 // This setting specifies the available cache size in Byte of the used target architecture.
-// Several algorithms use this setting for an optimized evaluation.
+// Several algorithms use this setting for an optimized evaluation. In case the architecture
+// provides several cache levels, this setting should specify the size of the last level cache
+// (see also BLAZE_L1_CACHE_SIZE and BLAZE_L2_CACHE_SIZE).
 //
 // The size of the cache is specified in Byte. For instance, a cache of 3 MiByte must therefore
 // be specified as 3145728.
@@ -55,3 +57,47 @@
 #define BLAZE_CACHE_SIZE 3145728UL
 #endif
 //*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Size of the level 1 data cache of the target architecture.
+// \ingroup config
+//
+// This setting specifies the size of the level 1 data cache (per core) in Byte. It is used by
+// the packed dense matrix multiplication kernel to determine the depth of the packed panels,
+// which are streamed through the level 1 cache.
+//
+// \note It is possible to specify the cache size via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_L1_CACHE_SIZE 32768UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_L1_CACHE_SIZE
+#define BLAZE_L1_CACHE_SIZE 32768UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Size of the level 2 cache of the target architecture.
+// \ingroup config
+//
+// This setting specifies the size of the level 2 cache (per core) in Byte. It is used by the
+// packed dense matrix multiplication kernel to determine the size of the packed blocks of the
+// left-hand side operand, which are kept in the level 2 cache.
+//
+// \note It is possible to specify the cache size via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_L2_CACHE_SIZE 262144UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_L2_CACHE_SIZE
+#define BLAZE_L2_CACHE_SIZE 262144UL
+#endif
+//*************************************************************************************************
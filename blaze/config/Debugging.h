@@ -85,3 +85,33 @@
 #define BLAZE_USE_FUNCTION_TRACES 0
 #endif
 //*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for kernel profiling.
+// \ingroup config
+//
+// This compilation switch triggers the profiling of the computational kernels. In case the
+// switch is set to 1, the kernel selected for every profiled operation (e.g. the small, large,
+// BLAS, or SMP kernel of a dense matrix multiplication) is recorded via the BLAZE_KERNEL_PROFILE
+// macro, together with the dimensions of the operation, the number of threads, the elapsed time,
+// and estimates of the number of floating point operations and bytes. The records can be
+// exported via the global kernel registry (see kernelRegistry()). In case the switch is set to 0,
+// all profiling code is removed at compile time.
+//
+// Possible settings for the kernel profiling switch:
+//  - Deactivated: \b 0 (default)
+//  - Activated  : \b 1
+//
+// \note It is possible to (de-)activate kernel profiling via command line or by defining this
+// symbol manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_USE_KERNEL_PROFILING 1
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_USE_KERNEL_PROFILING
+#define BLAZE_USE_KERNEL_PROFILING 0
+#endif
+//*************************************************************************************************
@@ -91,6 +91,64 @@
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Configuration switch for the packed dense matrix multiplication kernel.
+// \ingroup config
+//
+// This configuration switch enables/disables the packed, register-blocked kernel for large dense
+// matrix/dense matrix multiplications. The kernel is used in case no BLAS library is used for
+// the multiplication (see BLAZE_BLAS_MODE) and all three involved matrices have the same
+// floating point element type. In case the switch is set to 1 the packed kernel is used, in
+// case the switch is set to 0 the previous, panel based kernel is used instead.
+//
+// Possible settings for the packed matrix multiplication kernel:
+//  - Disabled: \b 0
+//  - Enabled : \b 1
+//
+// \note It is possible to (de-)activate the packed kernel via command line or by defining this
+// symbol manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_USE_PACKED_MATRIX_MULTIPLICATION 1
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_USE_PACKED_MATRIX_MULTIPLICATION
+#define BLAZE_USE_PACKED_MATRIX_MULTIPLICATION 1
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Configuration switch for the reordering of matrix multiplication chains.
+// \ingroup config
+//
+// This configuration switch enables/disables the reordering of chained matrix multiplications
+// (as for instance \f$ A*B*C \f$). In case the switch is set to 1 the evaluation order of a
+// chain is selected at runtime based on the sizes of the matrices and the number of non-zero
+// elements of sparse matrices such that the total number of operations is minimized. In case
+// the switch is set to 0 all matrix multiplications are evaluated from left to right (or as
+// explicitly specified via parentheses). Note that due to rounding a reordered chain may not
+// produce bitwise identical results.
+//
+// Possible settings for the matrix chain reordering:
+//  - Disabled: \b 0
+//  - Enabled : \b 1
+//
+// \note It is possible to (de-)activate the matrix chain reordering via command line or by
+// defining this symbol manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_USE_MATRIX_CHAIN_REORDERING 1
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_USE_MATRIX_CHAIN_REORDERING
+#define BLAZE_USE_MATRIX_CHAIN_REORDERING 1
+#endif
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Configuration switch for the initialization in default constructors.
 // \ingroup config
@@ -33,6 +33,46 @@
 //=================================================================================================
 
 
+//=================================================================================================
+//
+//  RUNTIME THRESHOLDS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the runtime thresholds.
+// \ingroup config
+//
+// This compilation switch enables/disables the runtime thresholds. In case the switch is set
+// to 0 (the default), all thresholds of this file are compile time constants. In case the switch
+// is set to 1, the thresholds of this file only serve as defaults, which can be overwritten
+// at runtime (for instance via the setThreshold() function), loaded from a threshold file (see
+// the loadThresholds() function and the \c BLAZE_THRESHOLDS_FILE environment variable), or
+// determined by means of the calibrateThresholds() function:
+//
+//  - 0: Compile time thresholds (default)
+//  - 1: Runtime thresholds
+//
+// Note that the runtime thresholds require an additional (atomic) load for every threshold
+// query and therefore might result in a slightly decreased performance for very small
+// operations.
+//
+// \note It is possible to (de-)activate the runtime thresholds via command line or by defining
+// this symbol manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_USE_RUNTIME_THRESHOLDS 1
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_USE_RUNTIME_THRESHOLDS
+#define BLAZE_USE_RUNTIME_THRESHOLDS 0
+#endif
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  BLAS THRESHOLDS
@@ -2032,3 +2072,166 @@
 #define BLAZE_SMP_SMATREDUCE_THRESHOLD 180UL
 #endif
 //*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP batched dense matrix operation threshold.
+// \ingroup config
+//
+// This threshold specifies when a batched operation on small dense matrices (as for instance
+// the batchMult(), batchInvert(), and batchSolve() functions) can be executed in parallel. In
+// case the number of matrices in the batch is larger or equal to this threshold, the operation
+// is executed in parallel. If the number of matrices is below this threshold the operation is
+// executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs.
+//
+// The default setting for this threshold is 1024. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_DMATBATCH_THRESHOLD 1024UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_DMATBATCH_THRESHOLD
+#define BLAZE_SMP_DMATBATCH_THRESHOLD 1024UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP sparse matrix assignment threshold.
+// \ingroup config
+//
+// This threshold specifies when an assignment of a sparse matrix or sparse matrix expression to
+// a compressed matrix can be executed in parallel. In case the number of non-zero elements of
+// the right-hand side operand is larger or equal to this threshold, the operation is executed
+// in parallel. If the number of non-zero elements is below this threshold the operation is
+// executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs.
+//
+// The default setting for this threshold is 65536. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_SMATASSIGN_THRESHOLD 65536UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_SMATASSIGN_THRESHOLD
+#define BLAZE_SMP_SMATASSIGN_THRESHOLD 65536UL
+#endif
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*!\brief SMP dense vector reduction threshold.
+// \ingroup config
+//
+// This threshold specifies when a total reduction of a dense vector (as for instance sum(),
+// prod(), min(), max(), reduce(), and all norms) can be executed in parallel. In case the number
+// of elements of the dense vector is larger or equal to this threshold, the vector is split into
+// blocks of fixed size, the blocks are reduced in parallel and the partial results are combined
+// in a fixed order, which gives the same result for any number of threads. If the number of
+// elements is below this threshold the operation is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs.
+//
+// The default setting for this threshold is 65536. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_DVECREDUCE_THRESHOLD 65536UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_DVECREDUCE_THRESHOLD
+#define BLAZE_SMP_DVECREDUCE_THRESHOLD 65536UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP dense vector/dense vector inner product threshold.
+// \ingroup config
+//
+// This threshold specifies when a dense vector/dense vector inner product can be executed in
+// parallel. In case the number of elements of the dense vectors is larger or equal to this
+// threshold, the vectors are split into blocks of fixed size, the blocks are processed in
+// parallel and the partial results are combined in a fixed order, which gives the same result
+// for any number of threads. If the number of elements is below this threshold the operation
+// is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs.
+//
+// The default setting for this threshold is 32768. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_DVECDVECINNER_THRESHOLD 32768UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_DVECDVECINNER_THRESHOLD
+#define BLAZE_SMP_DVECDVECINNER_THRESHOLD 32768UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP dense matrix total reduction threshold.
+// \ingroup config
+//
+// This threshold specifies when a total reduction of a dense matrix (as for instance sum(),
+// prod(), min(), max(), reduce(), and all norms) can be executed in parallel. In case the number
+// of elements of the dense matrix is larger or equal to this threshold, the matrix is split into
+// blocks of rows (or columns for column-major matrices) of fixed size, the blocks are reduced in
+// parallel and the partial results are combined in a fixed order, which gives the same result
+// for any number of threads. If the number of elements is below this threshold the operation is
+// executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs.
+//
+// The default setting for this threshold is 65536. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_DMATTOTALREDUCE_THRESHOLD 65536UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_DMATTOTALREDUCE_THRESHOLD
+#define BLAZE_SMP_DMATTOTALREDUCE_THRESHOLD 65536UL
+#endif
+//*************************************************************************************************
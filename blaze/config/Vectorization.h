@@ -62,3 +62,71 @@
 #define BLAZE_USE_VECTORIZATION 1
 #endif
 //*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for (de-)activation of the native SIMD math kernels.
+// \ingroup config
+//
+// This compilation switch enables/disables the vectorization of the exponential, logarithmic,
+// trigonometric and power functions (exp(), exp2(), exp10(), log(), log2(), log10(), sin(),
+// cos(), tan(), tanh(), and pow()) by means of the native polynomial kernels of the Blaze
+// library. The kernels are only used in case vectorization is enabled, at least SSE2 is
+// available, and the SVML is not available (in which case the SVML is preferred). In case
+// the switch is set to 0 the affected operations are computed by the scalar functions of the
+// standard library unless the SVML is available. The maximum errors of the native kernels
+// are documented at the according SIMD functions (see for instance blaze::exp()).
+//
+// Possible settings for the SIMD math switch:
+//  - Deactivated: \b 0
+//  - Activated  : \b 1 (default)
+//
+// \note It is possible to (de-)activate the native SIMD math kernels via command line or by
+// defining this symbol manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_USE_SIMD_MATH 1
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_USE_SIMD_MATH
+#define BLAZE_USE_SIMD_MATH 1
+#endif
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*!\brief Compilation switch for (de-)activation of the runtime instruction set dispatch.
+// \ingroup config
+//
+// This compilation switch enables/disables the runtime dispatch of the performance critical
+// kernels of the Blaze library. By default, the instruction set used by all kernels is fixed at
+// compile time (for instance by means of the \c -mavx2 or \c -march compiler flags). In case the
+// switch is set to 1, the Blaze library additionally compiles SSE2, AVX2 and AVX-512 variants
+// of the packed dense matrix multiplication kernel, the dense matrix/dense vector multiplication,
+// the dense vector assignment, and the summation and inner product of dense vectors. The
+// instruction set of the executing CPU is detected once via CPUID and all subsequent calls of
+// these kernels are routed to the according variant (see blaze::getInstructionSet()). This
+// allows a single binary compiled for a baseline instruction set (e.g. SSE4) to benefit from
+// AVX2 and AVX-512 on CPUs that support them. Kernels for small fixed-size operands (as for
+// instance StaticVector and StaticMatrix) are not affected by the dispatch.
+//
+// The runtime dispatch is only available for x86-64 targets, in combination with the GNU or
+// Clang compilers, and in case the compile time instruction set does not already include
+// AVX-512 (see BLAZE_RUNTIME_DISPATCH_MODE).
+//
+// Possible settings for the runtime dispatch switch:
+//  - Deactivated: \b 0 (default)
+//  - Activated  : \b 1
+//
+// \note It is possible to (de-)activate the runtime dispatch via command line or by defining
+// this symbol manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_USE_RUNTIME_DISPATCH 1
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_USE_RUNTIME_DISPATCH
+#define BLAZE_USE_RUNTIME_DISPATCH 0
+#endif
+//*************************************************************************************************
@@ -0,0 +1,430 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/Calibration.h
+//  \brief Header file for the runtime calibration of the Blaze thresholds
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_CALIBRATION_H_
+#define _BLAZE_MATH_CALIBRATION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/system/Thresholds.h>
+
+#if BLAZE_USE_RUNTIME_THRESHOLDS
+#  include <cmath>
+#  include <fstream>
+#  include <string>
+#  include <vector>
+#  include <blaze/math/DynamicMatrix.h>
+#  include <blaze/math/DynamicVector.h>
+#  include <blaze/math/StaticMatrix.h>
+#  include <blaze/math/smp/Functions.h>
+#  include <blaze/math/smp/SerialSection.h>
+#  include <blaze/util/Random.h>
+#  include <blaze/util/timing/WcTimer.h>
+#  include <blaze/util/Types.h>
+#endif
+
+
+namespace blaze {
+
+#if BLAZE_USE_RUNTIME_THRESHOLDS
+//=================================================================================================
+//
+//  CALIBRATION UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Measures the runtime of a single execution of the given operation.
+// \ingroup math
+//
+// \param op The operation to be measured.
+// \return The minimum runtime of a single execution of the operation (in seconds).
+//
+// This function first determines the number of repetitions required for a runtime of at least
+// one millisecond and subsequently returns the minimum runtime of three such measurements.
+*/
+template< typename OP >  // Type of the operation
+double measureRuntime( OP& op )
+{
+   timing::WcTimer timer;
+   size_t reps( 1UL );
+
+   while( true ) {
+      timer.start();
+      for( size_t rep=0UL; rep<reps; ++rep ) {
+         op();
+      }
+      timer.end();
+
+      if( timer.last() >= 1E-3 || reps >= 1048576UL )
+         break;
+
+      reps *= 2UL;
+   }
+
+   for( size_t run=0UL; run<2UL; ++run ) {
+      timer.start();
+      for( size_t rep=0UL; rep<reps; ++rep ) {
+         op();
+      }
+      timer.end();
+   }
+
+   return timer.min() / reps;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Determines the crossover point of the given threshold.
+// \ingroup math
+//
+// \param threshold The threshold to be calibrated.
+// \param first The smallest problem size \f$ n \f$ to be measured.
+// \param last The largest problem size \f$ n \f$ to be measured.
+// \param dim The dimension of the problem (\f$ n \f$ or \f$ n^2 \f$ elements are compared).
+// \param setup Factory for the operation of a given problem size \f$ n \f$.
+// \return void
+//
+// This function measures the operation created by \a setup for increasing problem sizes, once
+// with the maximum threshold value (i.e. the small/serial kernel) and once with the threshold
+// value 0 (i.e. the large/parallel kernel). The crossover point is the first problem size for
+// which the latter is faster for two consecutive problem sizes. The threshold is set to the
+// geometric mean of the crossover point and the previous problem size. In case no crossover
+// point is found, the threshold keeps its previous value.
+*/
+template< typename Setup >  // Type of the operation factory
+void calibrateThreshold( const RuntimeThreshold& threshold, size_t first, size_t last,
+                         size_t dim, Setup setup )
+{
+   const size_t previous( theThresholdTable().get( threshold.id() ) );
+
+   size_t lastLoss( 0UL );
+   size_t firstWin( 0UL );
+   size_t wins    ( 0UL );
+
+   for( size_t n=first; n<=last && wins<2UL; n*=2UL )
+   {
+      auto op( setup( n ) );
+      const size_t units( dim == 1UL ? n : n*n );
+
+      setThreshold( threshold, ThresholdTable::unset - 1UL );
+      const double small( measureRuntime( op ) );
+
+      setThreshold( threshold, 0UL );
+      const double large( measureRuntime( op ) );
+
+      if( large < small ) {
+         if( wins++ == 0UL ) firstWin = units;
+      }
+      else {
+         lastLoss = units;
+         wins = 0UL;
+      }
+   }
+
+   if( wins == 2UL ) {
+      setThreshold( threshold, ( lastLoss == 0UL )
+                               ?( firstWin / 2UL )
+                               :( static_cast<size_t>( std::sqrt( double( lastLoss ) * firstWin ) ) ) );
+   }
+   else {
+      theThresholdTable().set( threshold.id(), previous );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CALIBRATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Calibration functions */
+//@{
+template< typename Type = double >
+void calibrateThresholds();
+
+template< typename Type = double >
+void calibrateThresholds( const std::string& file );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calibration of the thresholds for the current machine.
+// \ingroup math
+//
+// \return void
+//
+// This function determines the crossover points of the dense kernel and SMP thresholds for the
+// current machine and the given element type (by default \c double) by measuring the according
+// operations for increasing problem sizes. The determined values are used by all subsequent
+// operations and can be written to a threshold file via the saveThresholds() function. The
+// following thresholds are calibrated:
+//
+//  - the dense matrix/dense vector and dense matrix/dense matrix multiplication kernel thresholds
+//    (as for instance blaze::DMATDVECMULT_THRESHOLD and blaze::DMATDMATMULT_THRESHOLD)
+//  - the SMP thresholds of all dense vector and dense matrix operations (as for instance
+//    blaze::SMP_DVECASSIGN_THRESHOLD and blaze::SMP_DMATDVECMULT_THRESHOLD); this requires an
+//    active shared memory parallelization with at least two threads
+//
+// All other thresholds (e.g. the thresholds of sparse operations) keep their current value.
+// Note that the calibration takes several seconds and should for instance be performed once
+// per machine (see the calibrateThresholds(const std::string&) function).
+//
+// \note This function is only available in case the runtime thresholds are enabled via the
+// BLAZE_USE_RUNTIME_THRESHOLDS compilation switch.
+*/
+template< typename Type >  // Element type of the calibration operands
+void calibrateThresholds()
+{
+   using VT  = DynamicVector<Type,columnVector>;
+   using MT  = DynamicMatrix<Type,rowMajor>;
+   using TMT = DynamicMatrix<Type,columnMajor>;
+
+   //**Kernel thresholds***************************************************************************
+   BLAZE_SERIAL_SECTION
+   {
+      calibrateThreshold( DMATDVECMULT_THRESHOLD, 16UL, 2048UL, 2UL, []( size_t n ) {
+         return [A=rand<MT>(n,n), x=rand<VT>(n), y=VT(n)]() mutable { y = A * x; };
+      } );
+
+      calibrateThreshold( TDMATDVECMULT_THRESHOLD, 16UL, 2048UL, 2UL, []( size_t n ) {
+         return [A=rand<TMT>(n,n), x=rand<VT>(n), y=VT(n)]() mutable { y = A * x; };
+      } );
+
+      calibrateThreshold( TDVECDMATMULT_THRESHOLD, 16UL, 2048UL, 2UL, []( size_t n ) {
+         return [A=rand<MT>(n,n), x=rand<VT>(n), y=VT(n)]() mutable { y = trans( trans( x ) * A ); };
+      } );
+
+      calibrateThreshold( TDVECTDMATMULT_THRESHOLD, 16UL, 2048UL, 2UL, []( size_t n ) {
+         return [A=rand<TMT>(n,n), x=rand<VT>(n), y=VT(n)]() mutable { y = trans( trans( x ) * A ); };
+      } );
+
+      calibrateThreshold( DMATDMATMULT_THRESHOLD, 8UL, 512UL, 2UL, []( size_t n ) {
+         return [A=rand<MT>(n,n), B=rand<MT>(n,n), C=MT(n,n)]() mutable { C = A * B; };
+      } );
+
+      calibrateThreshold( DMATTDMATMULT_THRESHOLD, 8UL, 512UL, 2UL, []( size_t n ) {
+         return [A=rand<MT>(n,n), B=rand<TMT>(n,n), C=MT(n,n)]() mutable { C = A * B; };
+      } );
+
+      calibrateThreshold( TDMATDMATMULT_THRESHOLD, 8UL, 512UL, 2UL, []( size_t n ) {
+         return [A=rand<TMT>(n,n), B=rand<MT>(n,n), C=MT(n,n)]() mutable { C = A * B; };
+      } );
+
+      calibrateThreshold( TDMATTDMATMULT_THRESHOLD, 8UL, 512UL, 2UL, []( size_t n ) {
+         return [A=rand<TMT>(n,n), B=rand<TMT>(n,n), C=TMT(n,n)]() mutable { C = A * B; };
+      } );
+   }
+   //**********************************************************************************************
+
+   //**SMP thresholds******************************************************************************
+   if( getNumThreads() < 2UL )
+      return;
+
+   calibrateThreshold( SMP_DVECASSIGN_THRESHOLD, 256UL, 2097152UL, 1UL, []( size_t n ) {
+      return [a=rand<VT>(n), b=VT(n)]() mutable { b = a; };
+   } );
+
+   calibrateThreshold( SMP_DVECSCALARMULT_THRESHOLD, 256UL, 2097152UL, 1UL, []( size_t n ) {
+      return [a=rand<VT>(n), b=VT(n)]() mutable { b = a * Type(2); };
+   } );
+
+   calibrateThreshold( SMP_DVECDVECADD_THRESHOLD, 256UL, 2097152UL, 1UL, []( size_t n ) {
+      return [a=rand<VT>(n), b=rand<VT>(n), c=VT(n)]() mutable { c = a + b; };
+   } );
+
+   calibrateThreshold( SMP_DVECDVECSUB_THRESHOLD, 256UL, 2097152UL, 1UL, []( size_t n ) {
+      return [a=rand<VT>(n), b=rand<VT>(n), c=VT(n)]() mutable { c = a - b; };
+   } );
+
+   calibrateThreshold( SMP_DVECDVECMULT_THRESHOLD, 256UL, 2097152UL, 1UL, []( size_t n ) {
+      return [a=rand<VT>(n), b=rand<VT>(n), c=VT(n)]() mutable { c = a * b; };
+   } );
+
+   calibrateThreshold( SMP_DVECDVECDIV_THRESHOLD, 256UL, 2097152UL, 1UL, []( size_t n ) {
+      return [a=rand<VT>(n), b=rand<VT>(n,Type(1),Type(2)), c=VT(n)]() mutable { c = a / b; };
+   } );
+
+   calibrateThreshold( SMP_DVECREDUCE_THRESHOLD, 256UL, 2097152UL, 1UL, []( size_t n ) {
+      return [a=rand<VT>(n), s=Type()]() mutable { s = sum( a ); };
+   } );
+
+   calibrateThreshold( SMP_DVECDVECINNER_THRESHOLD, 256UL, 2097152UL, 1UL, []( size_t n ) {
+      return [a=rand<VT>(n), b=rand<VT>(n), s=Type()]() mutable { s = trans( a ) * b; };
+   } );
+
+   calibrateThreshold( SMP_DVECDVECOUTER_THRESHOLD, 16UL, 2048UL, 2UL, []( size_t n ) {
+      return [a=rand<VT>(n), b=rand<VT>(n), C=MT(n,n)]() mutable { C = a * trans( b ); };
+   } );
+
+   calibrateThreshold( SMP_DMATDVECMULT_THRESHOLD, 16UL, 2048UL, 1UL, []( size_t n ) {
+      return [A=rand<MT>(n,n), x=rand<VT>(n), y=VT(n)]() mutable { y = A * x; };
+   } );
+
+   calibrateThreshold( SMP_TDMATDVECMULT_THRESHOLD, 16UL, 2048UL, 1UL, []( size_t n ) {
+      return [A=rand<TMT>(n,n), x=rand<VT>(n), y=VT(n)]() mutable { y = A * x; };
+   } );
+
+   calibrateThreshold( SMP_TDVECDMATMULT_THRESHOLD, 16UL, 2048UL, 1UL, []( size_t n ) {
+      return [A=rand<MT>(n,n), x=rand<VT>(n), y=VT(n)]() mutable { y = trans( trans( x ) * A ); };
+   } );
+
+   calibrateThreshold( SMP_TDVECTDMATMULT_THRESHOLD, 16UL, 2048UL, 1UL, []( size_t n ) {
+      return [A=rand<TMT>(n,n), x=rand<VT>(n), y=VT(n)]() mutable { y = trans( trans( x ) * A ); };
+   } );
+
+   calibrateThreshold( SMP_DMATASSIGN_THRESHOLD, 16UL, 2048UL, 2UL, []( size_t n ) {
+      return [A=rand<MT>(n,n), B=MT(n,n)]() mutable { B = A; };
+   } );
+
+   calibrateThreshold( SMP_DMATSCALARMULT_THRESHOLD, 16UL, 2048UL, 2UL, []( size_t n ) {
+      return [A=rand<MT>(n,n), B=MT(n,n)]() mutable { B = A * Type(2); };
+   } );
+
+   calibrateThreshold( SMP_DMATDMATADD_THRESHOLD, 16UL, 2048UL, 2UL, []( size_t n ) {
+      return [A=rand<MT>(n,n), B=rand<MT>(n,n), C=MT(n,n)]() mutable { C = A + B; };
+   } );
+
+   calibrateThreshold( SMP_DMATTDMATADD_THRESHOLD, 16UL, 2048UL, 2UL, []( size_t n ) {
+      return [A=rand<MT>(n,n), B=rand<TMT>(n,n), C=MT(n,n)]() mutable { C = A + B; };
+   } );
+
+   calibrateThreshold( SMP_DMATDMATSUB_THRESHOLD, 16UL, 2048UL, 2UL, []( size_t n ) {
+      return [A=rand<MT>(n,n), B=rand<MT>(n,n), C=MT(n,n)]() mutable { C = A - B; };
+   } );
+
+   calibrateThreshold( SMP_DMATTDMATSUB_THRESHOLD, 16UL, 2048UL, 2UL, []( size_t n ) {
+      return [A=rand<MT>(n,n), B=rand<TMT>(n,n), C=MT(n,n)]() mutable { C = A - B; };
+   } );
+
+   calibrateThreshold( SMP_DMATDMATSCHUR_THRESHOLD, 16UL, 2048UL, 2UL, []( size_t n ) {
+      return [A=rand<MT>(n,n), B=rand<MT>(n,n), C=MT(n,n)]() mutable { C = A % B; };
+   } );
+
+   calibrateThreshold( SMP_DMATTDMATSCHUR_THRESHOLD, 16UL, 2048UL, 2UL, []( size_t n ) {
+      return [A=rand<MT>(n,n), B=rand<TMT>(n,n), C=MT(n,n)]() mutable { C = A % B; };
+   } );
+
+   calibrateThreshold( SMP_DMATTOTALREDUCE_THRESHOLD, 16UL, 2048UL, 2UL, []( size_t n ) {
+      return [A=rand<MT>(n,n), s=Type()]() mutable { s = sum( A ); };
+   } );
+
+   calibrateThreshold( SMP_DMATDMATMULT_THRESHOLD, 8UL, 512UL, 2UL, []( size_t n ) {
+      return [A=rand<MT>(n,n), B=rand<MT>(n,n), C=MT(n,n)]() mutable { C = A * B; };
+   } );
+
+   calibrateThreshold( SMP_DMATTDMATMULT_THRESHOLD, 8UL, 512UL, 2UL, []( size_t n ) {
+      return [A=rand<MT>(n,n), B=rand<TMT>(n,n), C=MT(n,n)]() mutable { C = A * B; };
+   } );
+
+   calibrateThreshold( SMP_TDMATDMATMULT_THRESHOLD, 8UL, 512UL, 2UL, []( size_t n ) {
+      return [A=rand<TMT>(n,n), B=rand<MT>(n,n), C=MT(n,n)]() mutable { C = A * B; };
+   } );
+
+   calibrateThreshold( SMP_TDMATTDMATMULT_THRESHOLD, 8UL, 512UL, 2UL, []( size_t n ) {
+      return [A=rand<TMT>(n,n), B=rand<TMT>(n,n), C=TMT(n,n)]() mutable { C = A * B; };
+   } );
+
+   calibrateThreshold( SMP_DMATBATCH_THRESHOLD, 64UL, 65536UL, 1UL, []( size_t n ) {
+      using SMT = StaticMatrix<Type,4UL,4UL>;
+      return [A=std::vector<SMT>(n,rand<SMT>()), B=std::vector<SMT>(n,rand<SMT>()),
+              C=std::vector<SMT>(n)]() mutable { batchMult( C, A, B ); };
+   } );
+   //**********************************************************************************************
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calibration of the thresholds with a persistent threshold file.
+// \ingroup math
+//
+// \param file The name of the threshold file.
+// \return void
+// \exception std::runtime_error Threshold file could not be written.
+// \exception std::invalid_argument Invalid threshold file.
+//
+// In case the given threshold file exists, this function loads all thresholds from the file.
+// Otherwise it calibrates the thresholds for the current machine (see calibrateThresholds())
+// and writes the results to the given file. Thus the (time consuming) calibration is only
+// performed on first use:
+
+   \code
+   int main()
+   {
+      // Loads the thresholds from the given file or creates it on first use
+      blaze::calibrateThresholds( "/var/cache/blaze/thresholds.cfg" );
+
+      // ...
+   }
+   \endcode
+
+// Note that it is also possible to select a threshold file for the entire program via the
+// \c BLAZE_THRESHOLDS_FILE environment variable, which is loaded automatically on the first
+// access to any threshold.
+//
+// \note This function is only available in case the runtime thresholds are enabled via the
+// BLAZE_USE_RUNTIME_THRESHOLDS compilation switch.
+*/
+template< typename Type >  // Element type of the calibration operands
+void calibrateThresholds( const std::string& file )
+{
+   if( std::ifstream( file.c_str() ).good() ) {
+      loadThresholds( file );
+   }
+   else {
+      calibrateThresholds<Type>();
+      saveThresholds( file );
+   }
+}
+//*************************************************************************************************
+#endif
+
+} // namespace blaze
+
+#endif
@@ -45,6 +45,7 @@
 #include <blaze/math/adaptors/LowerMatrix.h>
 #include <blaze/math/adaptors/SymmetricMatrix.h>
 #include <blaze/math/adaptors/UpperMatrix.h>
+#include <blaze/math/dense/Batch.h>
 #include <blaze/math/dense/DenseMatrix.h>
 #include <blaze/math/dense/Eigen.h>
 #include <blaze/math/dense/Inversion.h>
@@ -109,6 +110,8 @@
 #include <blaze/math/expressions/DMatTSMatSubExpr.h>
 #include <blaze/math/expressions/DMatVarExpr.h>
 #include <blaze/math/expressions/DVecDVecOuterExpr.h>
+#include <blaze/math/expressions/KronDMatMultExpr.h>
+#include <blaze/math/expressions/KronDVecMultExpr.h>
 #include <blaze/math/expressions/SMatDMatMultExpr.h>
 #include <blaze/math/expressions/SMatDMatSubExpr.h>
 #include <blaze/math/expressions/SMatTDMatMultExpr.h>
@@ -131,6 +134,7 @@
 #include <blaze/math/expressions/TSVecTDMatMultExpr.h>
 #include <blaze/math/Matrix.h>
 #include <blaze/math/smp/DenseMatrix.h>
+#include <blaze/math/smp/FirstTouch.h>
 #include <blaze/math/smp/SparseMatrix.h>
 #include <blaze/math/views/Column.h>
 #include <blaze/math/views/Row.h>
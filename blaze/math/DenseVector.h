@@ -75,6 +75,8 @@
 #include <blaze/math/expressions/SVecDVecSubExpr.h>
 #include <blaze/math/expressions/SVecSVecCrossExpr.h>
 #include <blaze/math/smp/DenseVector.h>
+#include <blaze/math/smp/FirstTouch.h>
+#include <blaze/math/smp/Fused.h>
 #include <blaze/math/smp/SparseVector.h>
 #include <blaze/math/Vector.h>
 #include <blaze/math/views/Subvector.h>
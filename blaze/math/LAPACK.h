@@ -40,6 +40,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/math/lapack/gbsv.h>
 #include <blaze/math/lapack/geev.h>
 #include <blaze/math/lapack/gelqf.h>
 #include <blaze/math/lapack/geqlf.h>
@@ -73,6 +74,7 @@
 #include <blaze/math/lapack/ormql.h>
 #include <blaze/math/lapack/ormqr.h>
 #include <blaze/math/lapack/ormrq.h>
+#include <blaze/math/lapack/pbsv.h>
 #include <blaze/math/lapack/posv.h>
 #include <blaze/math/lapack/potrf.h>
 #include <blaze/math/lapack/potri.h>
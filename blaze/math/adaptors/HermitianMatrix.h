@@ -43,6 +43,7 @@
 #include <blaze/math/Aliases.h>
 #include <blaze/math/adaptors/hermitianmatrix/BaseTemplate.h>
 #include <blaze/math/adaptors/hermitianmatrix/Dense.h>
+#include <blaze/math/adaptors/hermitianmatrix/DensePacked.h>
 #include <blaze/math/adaptors/hermitianmatrix/Sparse.h>
 #include <blaze/math/constraints/BLASCompatible.h>
 #include <blaze/math/constraints/RequiresEvaluation.h>
@@ -1433,6 +1434,16 @@ struct HasConstDataAccess< HermitianMatrix<MT,SO,true> >
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename Type, bool SO >
+struct HasConstDataAccess< HermitianMatrix<PackedMatrix<Type,SO>,SO,true> >
+   : public FalseType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
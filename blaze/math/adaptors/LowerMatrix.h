@@ -43,6 +43,7 @@
 #include <blaze/math/Aliases.h>
 #include <blaze/math/adaptors/lowermatrix/BaseTemplate.h>
 #include <blaze/math/adaptors/lowermatrix/Dense.h>
+#include <blaze/math/adaptors/lowermatrix/DensePacked.h>
 #include <blaze/math/adaptors/lowermatrix/Sparse.h>
 #include <blaze/math/constraints/BLASCompatible.h>
 #include <blaze/math/constraints/Hermitian.h>
@@ -1836,6 +1837,16 @@ struct HasConstDataAccess< LowerMatrix<MT,SO,true> >
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename Type, bool SO >
+struct HasConstDataAccess< LowerMatrix<PackedMatrix<Type,SO>,SO,true> >
+   : public FalseType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -44,6 +44,7 @@
 #include <blaze/math/adaptors/symmetricmatrix/BaseTemplate.h>
 #include <blaze/math/adaptors/symmetricmatrix/DenseNonNumeric.h>
 #include <blaze/math/adaptors/symmetricmatrix/DenseNumeric.h>
+#include <blaze/math/adaptors/symmetricmatrix/DensePacked.h>
 #include <blaze/math/adaptors/symmetricmatrix/SparseNonNumeric.h>
 #include <blaze/math/adaptors/symmetricmatrix/SparseNumeric.h>
 #include <blaze/math/constraints/BLASCompatible.h>
@@ -697,6 +698,16 @@ struct HasConstDataAccess< SymmetricMatrix<MT,SO,true,NF> >
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename Type, bool SO >
+struct HasConstDataAccess< SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true> >
+   : public FalseType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -43,6 +43,7 @@
 #include <blaze/math/Aliases.h>
 #include <blaze/math/adaptors/uppermatrix/BaseTemplate.h>
 #include <blaze/math/adaptors/uppermatrix/Dense.h>
+#include <blaze/math/adaptors/uppermatrix/DensePacked.h>
 #include <blaze/math/adaptors/uppermatrix/Sparse.h>
 #include <blaze/math/constraints/BLASCompatible.h>
 #include <blaze/math/constraints/Hermitian.h>
@@ -1834,6 +1835,16 @@ struct HasConstDataAccess< UpperMatrix<MT,SO,true> >
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename Type, bool SO >
+struct HasConstDataAccess< UpperMatrix<PackedMatrix<Type,SO>,SO,true> >
+   : public FalseType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
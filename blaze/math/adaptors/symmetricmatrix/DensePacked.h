@@ -0,0 +1,1542 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/adaptors/symmetricmatrix/DensePacked.h
+//  \brief Packed specialization of the SymmetricMatrix class template
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//
+//  * The names of its contributors may not be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_ADAPTORS_SYMMETRICMATRIX_DENSEPACKED_H_
+#define _BLAZE_MATH_ADAPTORS_SYMMETRICMATRIX_DENSEPACKED_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <utility>
+#include <blaze/math/adaptors/Forward.h>
+#include <blaze/math/adaptors/symmetricmatrix/BaseTemplate.h>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DenseMatrix.h>
+#include <blaze/math/dense/InitializerMatrix.h>
+#include <blaze/math/dense/PackedIterator.h>
+#include <blaze/math/dense/PackedKernels.h>
+#include <blaze/math/dense/PackedMatrix.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/InitializerList.h>
+#include <blaze/math/RelaxationFlag.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/IsZero.h>
+#include <blaze/math/sparse/SparseMatrix.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/typetraits/IsSymmetric.h>
+#include <blaze/math/typetraits/IsSparseMatrix.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS TEMPLATE SPECIALIZATION FOR PACKED DENSE MATRICES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of SymmetricMatrix for packed dense matrices.
+// \ingroup symmetric_matrix
+//
+// This specialization of SymmetricMatrix uses a PackedMatrix as storage backend, i.e. it stores
+// only the \f$ N(N+1)/2 \f$ elements of the lower triangle and reconstructs the upper elements
+// by symmetry. In contrast to the general
+// dense specialization, the matrix/vector and matrix/matrix multiplications of a packed
+// symmetric matrix are performed by dedicated kernels that traverse the stored triangle only once.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO >      // Storage order of the adapted dense matrix
+class SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>
+   : public DenseMatrix< SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>, SO >
+{
+ private:
+   //**Type definitions****************************************************************************
+   using MT = PackedMatrix<Type,SO>;  //!< Type of the adapted packed matrix.
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   using This           = SymmetricMatrix<MT,SO,true,true>;                       //!< Type of this SymmetricMatrix instance.
+   using BaseType       = DenseMatrix<This,SO>;                                   //!< Base type of this SymmetricMatrix instance.
+   using ResultType     = This;                                                   //!< Result type for expression template evaluations.
+   using OppositeType   = SymmetricMatrix<PackedMatrix<Type,!SO>,!SO,true,true>;  //!< Result type with opposite storage order for expression template evaluations.
+   using TransposeType  = SymmetricMatrix<PackedMatrix<Type,!SO>,!SO,true,true>;  //!< Transpose type for expression template evaluations.
+   using ElementType    = Type;                                                   //!< Type of the matrix elements.
+   using SIMDType       = SIMDType_t<MT>;                                         //!< SIMD type of the matrix elements.
+   using ReturnType     = const Type&;                                            //!< Return type for expression template evaluations.
+   using CompositeType  = const This&;                                            //!< Data type for composite expression templates.
+   using Reference      = Type&;                                                  //!< Reference to a non-constant matrix value.
+   using ConstReference = const Type&;                                            //!< Reference to a constant matrix value.
+   using Pointer        = const Type*;                                            //!< Pointer to a non-constant matrix value.
+   using ConstPointer   = const Type*;                                            //!< Pointer to a constant matrix value.
+   using Iterator       = PackedIterator<This>;                                   //!< Iterator over non-constant elements.
+   using ConstIterator  = PackedIterator<const This>;                             //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a SymmetricMatrix with different data/element type.
+   */
+   template< typename NewType >  // Data type of the other matrix
+   struct Rebind {
+      //! The type of the other SymmetricMatrix.
+      using Other = SymmetricMatrix< PackedMatrix<NewType,SO> >;
+   };
+   //**********************************************************************************************
+
+   //**Resize struct definition********************************************************************
+   /*!\brief Resize mechanism to obtain a SymmetricMatrix with different fixed dimensions.
+   */
+   template< size_t NewM    // Number of rows of the other matrix
+           , size_t NewN >  // Number of columns of the other matrix
+   struct Resize {
+      //! The type of the other SymmetricMatrix.
+      using Other = SymmetricMatrix<MT>;
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the expression template evaluation strategy.
+   static constexpr bool simdEnabled = false;
+
+   //! Compilation switch for the expression template assignment strategy.
+   static constexpr bool smpAssignable = false;
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+            inline SymmetricMatrix();
+   explicit inline SymmetricMatrix( size_t n );
+            inline SymmetricMatrix( initializer_list< initializer_list<ElementType> > list );
+
+   inline SymmetricMatrix( const SymmetricMatrix& m );
+   inline SymmetricMatrix( SymmetricMatrix&& m ) noexcept;
+
+   template< typename MT2, bool SO2 >
+   explicit inline SymmetricMatrix( const Matrix<MT2,SO2>& m );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   ~SymmetricMatrix() = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator()( size_t i, size_t j );
+   inline ConstReference operator()( size_t i, size_t j ) const;
+   inline Reference      at( size_t i, size_t j );
+   inline ConstReference at( size_t i, size_t j ) const;
+   inline ConstPointer   data  () const noexcept;
+   inline ConstPointer   data  ( size_t i ) const noexcept;
+   inline Iterator       begin ( size_t i );
+   inline ConstIterator  begin ( size_t i ) const;
+   inline ConstIterator  cbegin( size_t i ) const;
+   inline Iterator       end   ( size_t i );
+   inline ConstIterator  end   ( size_t i ) const;
+   inline ConstIterator  cend  ( size_t i ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline SymmetricMatrix& operator=( initializer_list< initializer_list<ElementType> > list );
+
+   inline SymmetricMatrix& operator=( const SymmetricMatrix& rhs );
+   inline SymmetricMatrix& operator=( SymmetricMatrix&& rhs ) noexcept;
+
+   template< typename MT2, bool SO2 > inline SymmetricMatrix& operator= ( const Matrix<MT2,SO2>& rhs );
+   template< typename MT2, bool SO2 > inline SymmetricMatrix& operator+=( const Matrix<MT2,SO2>& rhs );
+   template< typename MT2, bool SO2 > inline SymmetricMatrix& operator-=( const Matrix<MT2,SO2>& rhs );
+   template< typename MT2, bool SO2 > inline SymmetricMatrix& operator%=( const Matrix<MT2,SO2>& rhs );
+
+   template< typename ST >
+   inline auto operator*=( ST rhs ) -> EnableIf_t< IsNumeric_v<ST>, SymmetricMatrix& >;
+
+   template< typename ST >
+   inline auto operator/=( ST rhs ) -> EnableIf_t< IsNumeric_v<ST>, SymmetricMatrix& >;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const noexcept;
+   inline size_t columns() const noexcept;
+   inline size_t capacity() const noexcept;
+   inline size_t capacity( size_t i ) const noexcept;
+   inline size_t nonZeros() const;
+   inline size_t nonZeros( size_t i ) const;
+   inline void   reset();
+   inline void   reset( size_t i );
+   inline void   clear();
+          void   resize ( size_t n, bool preserve=true );
+   inline void   extend ( size_t n, bool preserve=true );
+   inline void   reserve( size_t elements );
+   inline void   shrinkToFit();
+   inline void   swap( SymmetricMatrix& m ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Numeric functions***************************************************************************
+   /*!\name Numeric functions */
+   //@{
+   inline SymmetricMatrix& transpose();
+   inline SymmetricMatrix& ctranspose();
+
+   template< typename Other > inline SymmetricMatrix& scale( const Other& scalar );
+   //@}
+   //**********************************************************************************************
+
+   //**Debugging functions*************************************************************************
+   /*!\name Debugging functions */
+   //@{
+   inline bool isIntact() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   inline bool isAligned   () const noexcept;
+   inline bool canSMPAssign() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT2, bool SO2 >
+   inline void assign( const Matrix<MT2,SO2>& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   MT matrix_;  //!< The adapted packed matrix.
+   //@}
+   //**********************************************************************************************
+
+   //**Friend declarations*************************************************************************
+   template< RelaxationFlag RF, typename MT2, bool SO2, bool DF2, bool NF2 >
+   friend bool isDefault( const SymmetricMatrix<MT2,SO2,DF2,NF2>& m );
+
+   template< typename Type2, bool SO2, typename VT >
+   friend const MultTrait_t< SymmetricMatrix<PackedMatrix<Type2,SO2>,SO2,true,true>, VT >
+      operator*( const SymmetricMatrix<PackedMatrix<Type2,SO2>,SO2,true,true>& mat,
+                 const DenseVector<VT,false>& vec );
+
+   template< typename Type2, bool SO2, typename MT2, bool SO3 >
+   friend const MultTrait_t< SymmetricMatrix<PackedMatrix<Type2,SO2>,SO2,true,true>, MT2 >
+      operator*( const SymmetricMatrix<PackedMatrix<Type2,SO2>,SO2,true,true>& lhs,
+                 const DenseMatrix<MT2,SO3>& rhs );
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The default constructor for SymmetricMatrix.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO >      // Storage order of the adapted dense matrix
+inline SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>::SymmetricMatrix()
+   : matrix_()  // The adapted packed matrix
+{
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Broken invariant detected" );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Constructor for a matrix of size \f$ n \times n \f$.
+//
+// \param n The number of rows and columns of the matrix.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO >      // Storage order of the adapted dense matrix
+inline SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>::SymmetricMatrix( size_t n )
+   : matrix_( n )  // The adapted packed matrix
+{
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Broken invariant detected" );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief List initialization of all matrix elements.
+//
+// \param list The initializer list.
+// \exception std::invalid_argument Invalid setup of symmetric matrix.
+//
+// The matrix is sized according to the size of the initializer list and all its elements are
+// initialized by the values of the given initializer list. Missing values are initialized as
+// default. In case the matrix cannot be resized and the dimensions of the initializer list don't
+// match or if the given list does not represent a symmetric matrix, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO >      // Storage order of the adapted dense matrix
+inline SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>::SymmetricMatrix( initializer_list< initializer_list<ElementType> > list )
+   : matrix_()  // The adapted packed matrix
+{
+   const InitializerMatrix<ElementType> tmp( list, list.size() );
+
+   if( !isSymmetric( tmp ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid setup of symmetric matrix" );
+   }
+
+   assign( tmp );
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Broken invariant detected" );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The copy constructor for SymmetricMatrix.
+//
+// \param m The symmetric matrix to be copied.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO >      // Storage order of the adapted dense matrix
+inline SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>::SymmetricMatrix( const SymmetricMatrix& m )
+   : matrix_( m.matrix_ )  // The adapted packed matrix
+{
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Broken invariant detected" );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The move constructor for SymmetricMatrix.
+//
+// \param m The symmetric matrix to be moved into this instance.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO >      // Storage order of the adapted dense matrix
+inline SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>::SymmetricMatrix( SymmetricMatrix&& m ) noexcept
+   : matrix_( std::move( m.matrix_ ) )  // The adapted packed matrix
+{
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Broken invariant detected" );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Conversion constructor from different matrices.
+//
+// \param m Matrix to be copied.
+// \exception std::invalid_argument Invalid setup of symmetric matrix.
+//
+// This constructor initializes the symmetric matrix as a copy of the given matrix. In case the
+// given matrix is not a symmetric matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type    // Data type of the matrix elements
+        , bool SO >        // Storage order of the adapted dense matrix
+template< typename MT2     // Type of the foreign matrix
+        , bool SO2 >       // Storage order of the foreign matrix
+inline SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>::SymmetricMatrix( const Matrix<MT2,SO2>& m )
+   : matrix_()  // The adapted packed matrix
+{
+   const CompositeType_t<MT2> tmp( ~m );
+
+   if( !IsSymmetric_v<MT2> && !isSymmetric( tmp ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid setup of symmetric matrix" );
+   }
+
+   assign( tmp );
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Broken invariant detected" );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// The function call operator provides access to the elements at position (i,j). Note that the
+// elements \f$ (i,j) \f$ and \f$ (j,i) \f$ share the same memory location.
+//
+// Note that this function only performs an index check in case BLAZE_USER_ASSERT() is active. In
+// contrast, the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO >      // Storage order of the adapted dense matrix
+inline typename SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>::Reference
+   SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>::operator()( size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( i<rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j<columns(), "Invalid column access index" );
+
+   return matrix_(i,j);
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return The value of the accessed element.
+//
+// Note that this function only performs an index check in case BLAZE_USER_ASSERT() is active. In
+// contrast, the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO >      // Storage order of the adapted dense matrix
+inline typename SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>::ConstReference
+   SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>::operator()( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i<rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j<columns(), "Invalid column access index" );
+
+   return matrix_(i,j);
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checked access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO >      // Storage order of the adapted dense matrix
+inline typename SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>::Reference
+   SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>::at( size_t i, size_t j )
+{
+   if( i >= rows() ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= columns() ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checked access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return The value of the accessed element.
+// \exception std::out_of_range Invalid matrix access index.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO >      // Storage order of the adapted dense matrix
+inline typename SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>::ConstReference
+   SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>::at( size_t i, size_t j ) const
+{
+   if( i >= rows() ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= columns() ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Low-level data access to the packed matrix elements.
+//
+// \return Pointer to the packed array of the lower triangle.
+//
+// This function returns a pointer to the packed array of the lower triangle of the matrix
+// (see PackedMatrix for the details of the layout).
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO >      // Storage order of the adapted dense matrix
+inline typename SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>::ConstPointer
+   SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>::data() const noexcept
+{
+   return matrix_.data();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Low-level data access to the stored elements of row/column \a i.
+//
+// \param i The row/column index.
+// \return Pointer to the first stored element of row/column \a i.
+//
+// In case of a row-major matrix, this function returns a pointer to the \f$ i+1 \f$ lower and
+// diagonal elements of row \a i. In case of a column-major matrix, this function returns a
+// pointer to the \f$ N-i \f$ diagonal and lower elements of column \a i.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO >      // Storage order of the adapted dense matrix
+inline typename SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>::ConstPointer
+   SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>::data( size_t i ) const noexcept
+{
+   return matrix_.data(i);
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO >      // Storage order of the adapted dense matrix
+inline typename SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>::Iterator
+   SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>::begin( size_t i )
+{
+   return Iterator( *this, i, 0UL );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO >      // Storage order of the adapted dense matrix
+inline typename SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>::ConstIterator
+   SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>::begin( size_t i ) const
+{
+   return ConstIterator( *this, i, 0UL );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO >      // Storage order of the adapted dense matrix
+inline typename SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>::ConstIterator
+   SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>::cbegin( size_t i ) const
+{
+   return ConstIterator( *this, i, 0UL );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO >      // Storage order of the adapted dense matrix
+inline typename SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>::Iterator
+   SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>::end( size_t i )
+{
+   return Iterator( *this, i, columns() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO >      // Storage order of the adapted dense matrix
+inline typename SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>::ConstIterator
+   SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>::end( size_t i ) const
+{
+   return ConstIterator( *this, i, columns() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO >      // Storage order of the adapted dense matrix
+inline typename SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>::ConstIterator
+   SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>::cend( size_t i ) const
+{
+   return ConstIterator( *this, i, columns() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief List assignment to all matrix elements.
+//
+// \param list The initializer list.
+// \exception std::invalid_argument Invalid assignment to symmetric matrix.
+//
+// The matrix is resized according to the given initializer list and all its elements are
+// assigned the values from the given initializer list. Missing values are initialized as
+// default. In case the given list does not represent a symmetric matrix, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO >      // Storage order of the adapted dense matrix
+inline SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>&
+   SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>::operator=( initializer_list< initializer_list<ElementType> > list )
+{
+   const InitializerMatrix<ElementType> tmp( list, list.size() );
+
+   if( !isSymmetric( tmp ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid assignment to symmetric matrix" );
+   }
+
+   assign( tmp );
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Broken invariant detected" );
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Copy assignment operator for SymmetricMatrix.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned matrix.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO >      // Storage order of the adapted dense matrix
+inline SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>&
+   SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>::operator=( const SymmetricMatrix& rhs )
+{
+   matrix_ = rhs.matrix_;
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Broken invariant detected" );
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Move assignment operator for SymmetricMatrix.
+//
+// \param rhs The matrix to be moved into this instance.
+// \return Reference to the assigned matrix.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO >      // Storage order of the adapted dense matrix
+inline SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>&
+   SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>::operator=( SymmetricMatrix&& rhs ) noexcept
+{
+   matrix_ = std::move( rhs.matrix_ );
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Broken invariant detected" );
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Assignment operator for general matrices.
+//
+// \param rhs The general matrix to be copied.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Invalid assignment to symmetric matrix.
+//
+// In case the given matrix is not a symmetric matrix, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type    // Data type of the matrix elements
+        , bool SO >        // Storage order of the adapted dense matrix
+template< typename MT2     // Type of the right-hand side matrix
+        , bool SO2 >       // Storage order of the right-hand side matrix
+inline SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>&
+   SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>::operator=( const Matrix<MT2,SO2>& rhs )
+{
+   const CompositeType_t<MT2> tmp( ~rhs );
+
+   if( !IsSymmetric_v<MT2> && !isSymmetric( tmp ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid assignment to symmetric matrix" );
+   }
+
+   if( tmp.canAlias( this ) ) {
+      const ResultType_t<MT2> tmp2( tmp );
+      assign( tmp2 );
+   }
+   else {
+      assign( tmp );
+   }
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Broken invariant detected" );
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Addition assignment operator for the addition of a general matrix (\f$ A+=B \f$).
+//
+// \param rhs The right-hand side general matrix to be added.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Invalid assignment to symmetric matrix.
+//
+// In case the current sizes of the two matrices don't match or in case the given matrix is not
+// a symmetric matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type    // Data type of the matrix elements
+        , bool SO >        // Storage order of the adapted dense matrix
+template< typename MT2     // Type of the right-hand side matrix
+        , bool SO2 >       // Storage order of the right-hand side matrix
+inline SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>&
+   SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>::operator+=( const Matrix<MT2,SO2>& rhs )
+{
+   if( (~rhs).rows() != rows() || (~rhs).columns() != columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   const CompositeType_t<MT2> tmp( ~rhs );
+
+   if( !IsSymmetric_v<MT2> && !isSymmetric( tmp ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid assignment to symmetric matrix" );
+   }
+
+   if( tmp.canAlias( this ) ) {
+      const ResultType_t<MT2> tmp2( tmp );
+      matrix_.addAssign( tmp2 );
+   }
+   else {
+      matrix_.addAssign( tmp );
+   }
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Broken invariant detected" );
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Subtraction assignment operator for the subtraction of a general matrix (\f$ A-=B \f$).
+//
+// \param rhs The right-hand side general matrix to be subtracted.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Invalid assignment to symmetric matrix.
+//
+// In case the current sizes of the two matrices don't match or in case the given matrix is not
+// a symmetric matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type    // Data type of the matrix elements
+        , bool SO >        // Storage order of the adapted dense matrix
+template< typename MT2     // Type of the right-hand side matrix
+        , bool SO2 >       // Storage order of the right-hand side matrix
+inline SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>&
+   SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>::operator-=( const Matrix<MT2,SO2>& rhs )
+{
+   if( (~rhs).rows() != rows() || (~rhs).columns() != columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   const CompositeType_t<MT2> tmp( ~rhs );
+
+   if( !IsSymmetric_v<MT2> && !isSymmetric( tmp ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid assignment to symmetric matrix" );
+   }
+
+   if( tmp.canAlias( this ) ) {
+      const ResultType_t<MT2> tmp2( tmp );
+      matrix_.subAssign( tmp2 );
+   }
+   else {
+      matrix_.subAssign( tmp );
+   }
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Broken invariant detected" );
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Schur product assignment operator for the multiplication of a matrix (\f$ A\circ=B \f$).
+//
+// \param rhs The right-hand side matrix for the Schur product.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Invalid assignment to symmetric matrix.
+//
+// In case the current sizes of the two matrices don't match or in case the given matrix is not
+// a symmetric matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type    // Data type of the matrix elements
+        , bool SO >        // Storage order of the adapted dense matrix
+template< typename MT2     // Type of the right-hand side matrix
+        , bool SO2 >       // Storage order of the right-hand side matrix
+inline SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>&
+   SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>::operator%=( const Matrix<MT2,SO2>& rhs )
+{
+   if( (~rhs).rows() != rows() || (~rhs).columns() != columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   const CompositeType_t<MT2> tmp( ~rhs );
+
+   if( !IsSymmetric_v<MT2> && !isSymmetric( tmp ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid assignment to symmetric matrix" );
+   }
+
+   if( tmp.canAlias( this ) ) {
+      const ResultType_t<MT2> tmp2( tmp );
+      matrix_.schurAssign( tmp2 );
+   }
+   else {
+      matrix_.schurAssign( tmp );
+   }
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Broken invariant detected" );
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication assignment operator for the multiplication between a matrix and
+//        a scalar value (\f$ A*=s \f$).
+//
+// \param rhs The right-hand side scalar value for the multiplication.
+// \return Reference to the matrix.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO >      // Storage order of the adapted dense matrix
+template< typename ST >  // Data type of the right-hand side scalar
+inline auto SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>::operator*=( ST rhs )
+   -> EnableIf_t< IsNumeric_v<ST>, SymmetricMatrix& >
+{
+   matrix_ *= rhs;
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Division assignment operator for the division of a matrix by a scalar value
+//        (\f$ A/=s \f$).
+//
+// \param rhs The right-hand side scalar value for the division.
+// \return Reference to the matrix.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO >      // Storage order of the adapted dense matrix
+template< typename ST >  // Data type of the right-hand side scalar
+inline auto SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>::operator/=( ST rhs )
+   -> EnableIf_t< IsNumeric_v<ST>, SymmetricMatrix& >
+{
+   BLAZE_USER_ASSERT( !isZero( rhs ), "Division by zero detected" );
+
+   matrix_ /= rhs;
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the current number of rows of the matrix.
+//
+// \return The number of rows of the matrix.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO >      // Storage order of the adapted dense matrix
+inline size_t SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>::rows() const noexcept
+{
+   return matrix_.rows();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the current number of columns of the matrix.
+//
+// \return The number of columns of the matrix.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO >      // Storage order of the adapted dense matrix
+inline size_t SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>::columns() const noexcept
+{
+   return matrix_.columns();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the maximum capacity of the matrix.
+//
+// \return The capacity of the matrix.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO >      // Storage order of the adapted dense matrix
+inline size_t SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>::capacity() const noexcept
+{
+   return matrix_.capacity();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of stored elements in the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The number of stored elements in row/column \a i.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO >      // Storage order of the adapted dense matrix
+inline size_t SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>::capacity( size_t i ) const noexcept
+{
+   return matrix_.capacity(i);
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the total number of non-zero elements in the matrix
+//
+// \return The number of non-zero elements in the symmetric matrix.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO >      // Storage order of the adapted dense matrix
+inline size_t SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>::nonZeros() const
+{
+   size_t nonzeros( 0UL );
+
+   for( size_t i=0UL; i<rows(); ++i )
+   {
+      const ElementType* v( matrix_.data(i) );
+      const size_t diag( SO ? 0UL : i );
+
+      for( size_t k=0UL; k<matrix_.capacity(i); ++k ) {
+         if( !isDefault<strict>( v[k] ) )
+            nonzeros += ( k == diag )?( 1UL ):( 2UL );
+      }
+   }
+
+   return nonzeros;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of non-zero elements in the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The number of non-zero elements of row/column \a i.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO >      // Storage order of the adapted dense matrix
+inline size_t SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>::nonZeros( size_t i ) const
+{
+   size_t nonzeros( 0UL );
+
+   for( size_t j=0UL; j<columns(); ++j ) {
+      if( !isDefault<strict>( matrix_(i,j) ) )
+         ++nonzeros;
+   }
+
+   return nonzeros;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO >      // Storage order of the adapted dense matrix
+inline void SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>::reset()
+{
+   matrix_.reset();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reset the specified row/column to the default initial values.
+//
+// \param i The index of the row/column.
+// \return void
+//
+// This function resets the values in the specified row \b and column to their default value.
+// Note that due to the symmetric storage this function also resets the values in column \a i
+// in case of a row-major matrix and the values in row \a i in case of a column-major matrix.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO >      // Storage order of the adapted dense matrix
+inline void SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>::reset( size_t i )
+{
+   using blaze::clear;
+
+   for( size_t j=0UL; j<columns(); ++j ) {
+      clear( matrix_(i,j) );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Clearing the symmetric matrix.
+//
+// \return void
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO >      // Storage order of the adapted dense matrix
+inline void SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>::clear()
+{
+   matrix_.clear();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Changing the size of the symmetric matrix.
+//
+// \param n The new number of rows and columns of the matrix.
+// \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
+// \return void
+//
+// This function resizes the matrix using the given size to \f$ n \times n \f$. During this
+// operation, new dynamic memory may be allocated in case the capacity of the matrix is too
+// small. In order to maintain the symmetric character of the matrix, the old values of the matrix
+// are always preserved and new elements are default initialized.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO >      // Storage order of the adapted dense matrix
+void SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>::resize( size_t n, bool preserve )
+{
+   MAYBE_UNUSED( preserve );
+
+   matrix_.resize( n, true );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Extending the size of the matrix.
+//
+// \param n Number of additional rows and columns.
+// \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
+// \return void
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO >      // Storage order of the adapted dense matrix
+inline void SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>::extend( size_t n, bool preserve )
+{
+   MAYBE_UNUSED( preserve );
+
+   resize( rows() + n, true );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Setting the minimum capacity of the matrix.
+//
+// \param elements The new minimum capacity of the symmetric matrix.
+// \return void
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO >      // Storage order of the adapted dense matrix
+inline void SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>::reserve( size_t elements )
+{
+   matrix_.reserve( elements );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Requesting the removal of unused capacity.
+//
+// \return void
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO >      // Storage order of the adapted dense matrix
+inline void SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>::shrinkToFit()
+{
+   matrix_.shrinkToFit();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Swapping the contents of two matrices.
+//
+// \param m The matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO >      // Storage order of the adapted dense matrix
+inline void SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>::swap( SymmetricMatrix& m ) noexcept
+{
+   using std::swap;
+
+   swap( matrix_, m.matrix_ );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Assignment of the lower part of a general matrix.
+//
+// \param rhs The right-hand side matrix to be assigned.
+// \return void
+*/
+template< typename Type    // Data type of the matrix elements
+        , bool SO >        // Storage order of the adapted dense matrix
+template< typename MT2     // Type of the right-hand side matrix
+        , bool SO2 >       // Storage order of the right-hand side matrix
+inline void SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>::assign( const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( (~rhs).rows() == (~rhs).columns(), "Non-square matrix detected" );
+
+   matrix_.resize( (~rhs).rows(), false );
+
+   if( IsSparseMatrix_v<MT2> ) {
+      matrix_.reset();
+   }
+
+   matrix_.assign( ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NUMERIC FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place transpose of the symmetric matrix.
+//
+// \return Reference to the transposed matrix.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO >      // Storage order of the adapted dense matrix
+inline SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>&
+   SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>::transpose()
+{
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place conjugate transpose of the symmetric matrix.
+//
+// \return Reference to the transposed matrix.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO >      // Storage order of the adapted dense matrix
+inline SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>&
+   SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>::ctranspose()
+{
+   const size_t n( rows() );
+   ElementType* v( matrix_.data() );
+
+   for( size_t k=0UL; k<(n*(n+1UL))/2UL; ++k ) {
+      conjugate( v[k] );
+   }
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scaling of the matrix by the scalar value \a scalar (\f$ A=B*s \f$).
+//
+// \param scalar The scalar value for the matrix scaling.
+// \return Reference to the matrix.
+*/
+template< typename Type     // Data type of the matrix elements
+        , bool SO >         // Storage order of the adapted dense matrix
+template< typename Other >  // Data type of the scalar value
+inline SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>&
+   SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>::scale( const Other& scalar )
+{
+   matrix_.scale( scalar );
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEBUGGING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the invariants of the symmetric matrix are intact.
+//
+// \return \a true in case the symmetric matrix's invariants are intact, \a false otherwise.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO >      // Storage order of the adapted dense matrix
+inline bool SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>::isIntact() const noexcept
+{
+   return matrix_.isIntact();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+*/
+template< typename Type     // Data type of the matrix elements
+        , bool SO >         // Storage order of the adapted dense matrix
+template< typename Other >  // Data type of the foreign expression
+inline bool SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>::canAlias( const Other* alias ) const noexcept
+{
+   return matrix_.canAlias( alias ) ||
+          static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+*/
+template< typename Type     // Data type of the matrix elements
+        , bool SO >         // Storage order of the adapted dense matrix
+template< typename Other >  // Data type of the foreign expression
+inline bool SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>::isAliased( const Other* alias ) const noexcept
+{
+   return matrix_.isAliased( alias ) ||
+          static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the matrix is properly aligned in memory.
+//
+// \return \a true in case the matrix is aligned, \a false if not.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO >      // Storage order of the adapted dense matrix
+inline bool SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>::isAligned() const noexcept
+{
+   return matrix_.isAligned();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO >      // Storage order of the adapted dense matrix
+inline bool SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>::canSMPAssign() const noexcept
+{
+   return matrix_.canSMPAssign();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a packed symmetric matrix and a dense
+//        vector (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup symmetric_matrix
+//
+// \param mat The left-hand side packed symmetric matrix for the multiplication.
+// \param vec The right-hand side dense vector for the multiplication.
+// \return The resulting vector.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This operator computes the product of a packed symmetric matrix and a dense vector by means of
+// a dedicated kernel that traverses the stored triangle only once. In contrast to the general
+// multiplication operator, the product is evaluated immediately.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO        // Storage order of the adapted dense matrix
+        , typename VT >  // Type of the right-hand side dense vector
+inline const MultTrait_t< SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>, VT >
+   operator*( const SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>& mat, const DenseVector<VT,false>& vec )
+{
+   using RT = MultTrait_t< SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>, VT >;
+
+   BLAZE_FUNCTION_TRACE;
+
+   if( mat.columns() != (~vec).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix and vector sizes do not match" );
+   }
+
+   return pmatdvecmult<true,true,false,RT>( mat.matrix_, ~vec );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a packed symmetric matrix and a dense
+//        matrix (\f$ C=A*B \f$).
+// \ingroup symmetric_matrix
+//
+// \param lhs The left-hand side packed symmetric matrix for the multiplication.
+// \param rhs The right-hand side dense matrix for the multiplication.
+// \return The resulting matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This operator computes the product of a packed symmetric matrix and a dense matrix by means of
+// a dedicated kernel that traverses the stored triangle only once. In contrast to the general
+// multiplication operator, the product is evaluated immediately.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO        // Storage order of the adapted dense matrix
+        , typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline const MultTrait_t< SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>, MT >
+   operator*( const SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>& lhs, const DenseMatrix<MT,SO2>& rhs )
+{
+   using RT = MultTrait_t< SymmetricMatrix<PackedMatrix<Type,SO>,SO,true,true>, MT >;
+
+   BLAZE_FUNCTION_TRACE;
+
+   if( lhs.columns() != (~rhs).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   return pmatdmatmult<true,true,false,RT>( lhs.matrix_, ~rhs );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
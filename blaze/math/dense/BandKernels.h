@@ -0,0 +1,514 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/BandKernels.h
+//  \brief Header file for the band matrix multiplication kernels
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//
+//  * The names of its contributors may not be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_BANDKERNELS_H_
+#define _BLAZE_MATH_DENSE_BANDKERNELS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/Forward.h>
+#include <blaze/math/dense/PackedKernels.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/shims/PrevMultiple.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasMutableDataAccess.h>
+#include <blaze/math/typetraits/IsContiguous.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/system/Inline.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default kernel for the update of a contiguous range of elements (\f$ c+=a*b \f$).
+// \ingroup band_matrix
+//
+// \param c Pointer to the first target element.
+// \param a The scalar factor.
+// \param b Pointer to the first element of the right-hand side range.
+// \param n The number of elements to be updated.
+// \return void
+*/
+template< typename T1    // Type of the target elements
+        , typename T2    // Type of the scalar factor
+        , typename T3 >  // Type of the right-hand side elements
+inline auto bandaxpy( T1* c, const T2& a, const T3* b, size_t n )
+   -> DisableIf_t< PackedKernelHelper<false,T1,T2,T3>::simdMat >
+{
+   for( size_t j=0UL; j<n; ++j ) {
+      c[j] += a * b[j];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized kernel for the update of a contiguous range of elements (\f$ c+=a*b \f$).
+// \ingroup band_matrix
+//
+// \param c Pointer to the first target element.
+// \param a The scalar factor.
+// \param b Pointer to the first element of the right-hand side range.
+// \param n The number of elements to be updated.
+// \return void
+*/
+template< typename T1    // Type of the target elements
+        , typename T2    // Type of the scalar factor
+        , typename T3 >  // Type of the right-hand side elements
+inline auto bandaxpy( T1* c, const T2& a, const T3* b, size_t n )
+   -> EnableIf_t< PackedKernelHelper<false,T1,T2,T3>::simdMat >
+{
+   using SIMDType = SIMDTrait_t<T1>;
+
+   constexpr size_t SIMDSIZE( SIMDType::size );
+
+   const size_t jpos( prevMultiple( n, SIMDSIZE ) );
+
+   const SIMDType a1( set( a ) );
+
+   size_t j( 0UL );
+
+   for( ; (j+SIMDSIZE) < jpos; j+=SIMDSIZE*2UL ) {
+      storeu( c+j         , SIMDType( loadu( c+j          ) + a1 * loadu( b+j          ) ) );
+      storeu( c+j+SIMDSIZE, SIMDType( loadu( c+j+SIMDSIZE ) + a1 * loadu( b+j+SIMDSIZE ) ) );
+   }
+   for( ; j<jpos; j+=SIMDSIZE ) {
+      storeu( c+j, SIMDType( loadu( c+j ) + a1 * loadu( b+j ) ) );
+   }
+   for( ; j<n; ++j ) {
+      c[j] += a * b[j];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default kernel for the dot product of two contiguous ranges of elements.
+// \ingroup band_matrix
+//
+// \param a Pointer to the first element of the left-hand side range.
+// \param b Pointer to the first element of the right-hand side range.
+// \param n The number of elements.
+// \return The dot product of the two ranges.
+*/
+template< typename T1    // Type of the result
+        , typename T2    // Type of the left-hand side elements
+        , typename T3 >  // Type of the right-hand side elements
+inline auto banddot( const T2* a, const T3* b, size_t n )
+   -> DisableIf_t< PackedKernelHelper<false,T1,T2,T3>::simdMat, T1 >
+{
+   T1 tmp{};
+
+   for( size_t j=0UL; j<n; ++j ) {
+      tmp += a[j] * b[j];
+   }
+
+   return tmp;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized kernel for the dot product of two contiguous ranges of elements.
+// \ingroup band_matrix
+//
+// \param a Pointer to the first element of the left-hand side range.
+// \param b Pointer to the first element of the right-hand side range.
+// \param n The number of elements.
+// \return The dot product of the two ranges.
+*/
+template< typename T1    // Type of the result
+        , typename T2    // Type of the left-hand side elements
+        , typename T3 >  // Type of the right-hand side elements
+inline auto banddot( const T2* a, const T3* b, size_t n )
+   -> EnableIf_t< PackedKernelHelper<false,T1,T2,T3>::simdMat, T1 >
+{
+   using SIMDType = SIMDTrait_t<T1>;
+
+   constexpr size_t SIMDSIZE( SIMDType::size );
+
+   const size_t jpos( prevMultiple( n, SIMDSIZE ) );
+
+   SIMDType xmm1, xmm2;
+   size_t j( 0UL );
+
+   for( ; (j+SIMDSIZE) < jpos; j+=SIMDSIZE*2UL ) {
+      xmm1 += loadu( a+j          ) * loadu( b+j          );
+      xmm2 += loadu( a+j+SIMDSIZE ) * loadu( b+j+SIMDSIZE );
+   }
+   for( ; j<jpos; j+=SIMDSIZE ) {
+      xmm1 += loadu( a+j ) * loadu( b+j );
+   }
+
+   T1 tmp( sum( xmm1 + xmm2 ) );
+
+   for( ; j<n; ++j ) {
+      tmp += a[j] * b[j];
+   }
+
+   return tmp;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BAND MATRIX/DENSE VECTOR MULTIPLICATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default kernel for the multiplication of a band matrix and a dense vector
+//        (\f$ \vec{y}+=A*\vec{x} \f$).
+// \ingroup band_matrix
+//
+// \param y The target dense vector.
+// \param A The left-hand side band matrix.
+// \param x The right-hand side dense vector.
+// \return void
+//
+// This function implements the default kernel for the multiplication of a band matrix and a
+// dense vector. Only the elements within the band are traversed.
+*/
+template< typename VT1    // Type of the target dense vector
+        , typename Type   // Element type of the band matrix
+        , bool SO         // Storage order of the band matrix
+        , typename VT2 >  // Type of the right-hand side dense vector
+inline auto bmatdvecmultKernel( VT1& y, const BandMatrix<Type,SO>& A, const VT2& x )
+   -> DisableIf_t< IsContiguous_v<VT1> && HasMutableDataAccess_v<VT1> &&
+                   IsContiguous_v<VT2> && HasConstDataAccess_v<VT2> >
+{
+   const size_t N( SO ? A.columns() : A.rows() );
+
+   for( size_t k=0UL; k<N; ++k )
+   {
+      const Type* p( A.data(k) - A.bandBegin(k) );
+
+      for( size_t l=A.bandBegin(k); l<A.bandEnd(k); ++l ) {
+         if( SO ) y[l] += p[l] * x[k];
+         else     y[k] += p[l] * x[l];
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Optimized kernel for the multiplication of a band matrix and a dense vector
+//        (\f$ \vec{y}+=A*\vec{x} \f$).
+// \ingroup band_matrix
+//
+// \param y The target dense vector.
+// \param A The left-hand side band matrix.
+// \param x The right-hand side dense vector.
+// \return void
+//
+// This function implements the optimized kernel for the multiplication of a band matrix and a
+// dense vector. Since the band of each row/column is stored contiguously, the product is
+// computed by means of one dot product per row (in case of a row-major matrix) or one update
+// of the form \f$ \vec{y}+=A(:,j)*x_j \f$ per column (in case of a column-major matrix), which
+// are both vectorized in case all element types are identical and provide a SIMD interface.
+*/
+template< typename VT1    // Type of the target dense vector
+        , typename Type   // Element type of the band matrix
+        , bool SO         // Storage order of the band matrix
+        , typename VT2 >  // Type of the right-hand side dense vector
+inline auto bmatdvecmultKernel( VT1& y, const BandMatrix<Type,SO>& A, const VT2& x )
+   -> EnableIf_t< IsContiguous_v<VT1> && HasMutableDataAccess_v<VT1> &&
+                  IsContiguous_v<VT2> && HasConstDataAccess_v<VT2> >
+{
+   using ET = ElementType_t<VT1>;
+
+   const size_t N( SO ? A.columns() : A.rows() );
+
+   ET* const yp( y.data() );
+   const ElementType_t<VT2>* const xp( x.data() );
+
+   for( size_t k=0UL; k<N; ++k )
+   {
+      const size_t begin( A.bandBegin(k) );
+      const size_t len  ( A.bandEnd(k) - begin );
+
+      if( SO ) bandaxpy( yp+begin, xp[k], A.data(k), len );
+      else     yp[k] += banddot<ET>( A.data(k), xp+begin, len );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication of a band matrix and a dense vector (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup band_matrix
+//
+// \param A The left-hand side band matrix.
+// \param x The right-hand side dense vector.
+// \return The resulting vector of type \a RT.
+//
+// This function computes the product of a band matrix and a dense vector. The right-hand side
+// vector is evaluated in case it is not contiguous in memory.
+*/
+template< typename RT    // Type of the resulting dense vector
+        , typename Type  // Element type of the band matrix
+        , bool SO        // Storage order of the band matrix
+        , typename VT >  // Type of the right-hand side dense vector
+inline RT bmatdvecmult( const BandMatrix<Type,SO>& A, const DenseVector<VT,false>& x )
+{
+   using XT = If_t< IsContiguous_v<VT> && HasConstDataAccess_v<VT>, const VT&, const ResultType_t<VT> >;
+
+   BLAZE_INTERNAL_ASSERT( A.columns() == (~x).size(), "Invalid vector size" );
+
+   XT x2( ~x );
+
+   RT y;
+   resize( y, A.rows(), false );
+   reset( y );
+
+   bmatdvecmultKernel( y, A, x2 );
+
+   return y;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BAND MATRIX/DENSE MATRIX MULTIPLICATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Kernel for the multiplication of a band matrix and a row-major dense matrix
+//        (\f$ C+=A*B \f$).
+// \ingroup band_matrix
+//
+// \param C The target row-major dense matrix.
+// \param A The left-hand side band matrix.
+// \param B The right-hand side row-major dense matrix.
+// \return void
+//
+// This function implements the kernel for the multiplication of a band matrix and a row-major
+// dense matrix. Each element \f$ a_{ik} \f$ within the band is read exactly once and is used
+// for a row update of the form \f$ C(i,:)+=a_{ik}*B(k,:) \f$ (see pmatdmatmultRow()).
+*/
+template< typename MT1    // Type of the target dense matrix
+        , typename Type   // Element type of the band matrix
+        , bool SO         // Storage order of the band matrix
+        , typename MT2 >  // Type of the right-hand side dense matrix
+inline void bmatdmatmultKernel( MT1& C, const BandMatrix<Type,SO>& A, const MT2& B )
+{
+   const size_t N( SO ? A.columns() : A.rows() );
+
+   for( size_t k=0UL; k<N; ++k )
+   {
+      const Type* p( A.data(k) - A.bandBegin(k) );
+
+      for( size_t l=A.bandBegin(k); l<A.bandEnd(k); ++l ) {
+         if( SO ) pmatdmatmultRow( C, l, p[l], B, k );
+         else     pmatdmatmultRow( C, k, p[l], B, l );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication of a band matrix and a dense matrix (\f$ C=A*B \f$).
+// \ingroup band_matrix
+//
+// \param A The left-hand side band matrix.
+// \param B The right-hand side dense matrix.
+// \return The resulting matrix of type \a RT.
+//
+// This function computes the product of a band matrix and a dense matrix. The kernel operates
+// on rows of \a B and \a C. Therefore \a B is converted to a row-major matrix and the product
+// is computed in a row-major temporary in case the given matrix types do not provide direct
+// access to their rows.
+*/
+template< typename RT    // Type of the resulting dense matrix
+        , typename Type  // Element type of the band matrix
+        , bool SO        // Storage order of the band matrix
+        , typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline RT bmatdmatmult( const BandMatrix<Type,SO>& A, const DenseMatrix<MT,SO2>& B )
+{
+   using BT = If_t< IsRowMajorMatrix_v<MT> && HasConstDataAccess_v<MT>
+                  , const MT&
+                  , const DynamicMatrix< ElementType_t<MT>, rowMajor > >;
+
+   using CT = If_t< IsRowMajorMatrix_v<RT> && HasMutableDataAccess_v<RT>
+                  , RT
+                  , DynamicMatrix< ElementType_t<RT>, rowMajor > >;
+
+   BLAZE_INTERNAL_ASSERT( A.columns() == (~B).rows(), "Invalid matrix sizes" );
+
+   BT B2( ~B );
+
+   CT C;
+   resize( C, A.rows(), B2.columns(), false );
+   reset( C );
+
+   bmatdmatmultKernel( C, A, B2 );
+
+   return RT( std::move( C ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BAND MATRIX/BAND MATRIX MULTIPLICATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Kernel for the multiplication of two band matrices (\f$ C+=A*B \f$).
+// \ingroup band_matrix
+//
+// \param C The target row-major band matrix.
+// \param A The left-hand side band matrix.
+// \param B The right-hand side row-major band matrix.
+// \return void
+//
+// This function implements the kernel for the multiplication of two band matrices. The band of
+// the target matrix is required to contain the band of the product. Each element \f$ a_{ik} \f$
+// within the band of \a A is used for an update of row \a i of \a C with the band of row \a k
+// of \a B, which is stored contiguously in both \a B and \a C.
+*/
+template< typename T1     // Element type of the target band matrix
+        , typename T2     // Element type of the left-hand side band matrix
+        , bool SO         // Storage order of the left-hand side band matrix
+        , typename T3 >   // Element type of the right-hand side band matrix
+inline void bmatbmatmultKernel( BandMatrix<T1,rowMajor>& C, const BandMatrix<T2,SO>& A,
+                                const BandMatrix<T3,rowMajor>& B )
+{
+   BLAZE_INTERNAL_ASSERT( C.lowerBandwidth() >= A.lowerBandwidth() + B.lowerBandwidth(), "Invalid bandwidth" );
+   BLAZE_INTERNAL_ASSERT( C.upperBandwidth() >= A.upperBandwidth() + B.upperBandwidth(), "Invalid bandwidth" );
+
+   const size_t N( SO ? A.columns() : A.rows() );
+
+   for( size_t k=0UL; k<N; ++k )
+   {
+      const T2* p( A.data(k) - A.bandBegin(k) );
+
+      for( size_t l=A.bandBegin(k); l<A.bandEnd(k); ++l )
+      {
+         const size_t i( SO ? l : k );
+         const size_t j( SO ? k : l );
+
+         const size_t begin( B.bandBegin(j) );
+
+         bandaxpy( C.data(i) + ( begin - C.bandBegin(i) ), p[l], B.data(j), B.bandEnd(j) - begin );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication of two band matrices (\f$ C=A*B \f$).
+// \ingroup band_matrix
+//
+// \param A The left-hand side band matrix.
+// \param B The right-hand side band matrix.
+// \return The resulting band matrix of type \a RT.
+//
+// This function computes the product of two band matrices. The lower and upper bandwidth of
+// the resulting band matrix is the sum of the lower and upper bandwidths of the two operands,
+// respectively. The right-hand side matrix is converted to a row-major band matrix and the
+// product is computed in a row-major temporary in case of column-major operands.
+*/
+template< typename RT    // Type of the resulting band matrix
+        , typename T1    // Element type of the left-hand side band matrix
+        , bool SO1       // Storage order of the left-hand side band matrix
+        , typename T2    // Element type of the right-hand side band matrix
+        , bool SO2 >     // Storage order of the right-hand side band matrix
+inline RT bmatbmatmult( const BandMatrix<T1,SO1>& A, const BandMatrix<T2,SO2>& B )
+{
+   using BT = If_t< SO2 == rowMajor, const BandMatrix<T2,SO2>&, const BandMatrix<T2,rowMajor> >;
+   using CT = If_t< IsRowMajorMatrix_v<RT>, RT, BandMatrix< ElementType_t<RT>, rowMajor > >;
+
+   BLAZE_INTERNAL_ASSERT( A.columns() == B.rows(), "Invalid matrix sizes" );
+
+   BT B2( B );
+
+   CT C( A.rows(), B2.columns(),
+         A.lowerBandwidth() + B2.lowerBandwidth(),
+         A.upperBandwidth() + B2.upperBandwidth() );
+
+   bmatbmatmultKernel( C, A, B2 );
+
+   return RT( std::move( C ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,2839 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/BandMatrix.h
+//  \brief Header file for the implementation of a dense matrix with band storage
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//
+//  * The names of its contributors may not be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_BANDMATRIX_H_
+#define _BLAZE_MATH_DENSE_BANDMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/BandKernels.h>
+#include <blaze/math/dense/DenseMatrix.h>
+#include <blaze/math/dense/Forward.h>
+#include <blaze/math/dense/PackedIterator.h>
+#include <blaze/math/dense/PackedProxy.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/InitializerList.h>
+#include <blaze/math/RelaxationFlag.h>
+#include <blaze/math/shims/Clear.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/IsZero.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/sparse/SparseMatrix.h>
+#include <blaze/math/traits/AddTrait.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/traits/SubTrait.h>
+#include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/math/typetraits/IsShrinkable.h>
+#include <blaze/system/Restrict.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/algorithms/Transfer.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup band_matrix BandMatrix
+// \ingroup dense_matrix
+*/
+/*!\brief Efficient implementation of a dense matrix with compact band storage.
+// \ingroup band_matrix
+//
+// The BandMatrix class template is the representation of an arbitrary sized dense matrix, whose
+// non-zero elements are confined to a band around the diagonal. The type of the elements and the
+// storage order of the matrix can be specified via the two template parameters:
+
+   \code
+   template< typename Type, bool SO >
+   class BandMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. BandMatrix can be used with any
+//          non-cv-qualified, non-reference, non-pointer element type.
+//  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//          The default value is blaze::rowMajor.
+//
+// The band of a BandMatrix is given by the number of subdiagonals \a kl (the lower bandwidth)
+// and the number of superdiagonals \a ku (the upper bandwidth), which are specified at runtime.
+// Only the elements \f$ (i,j) \f$ with \f$ j-ku \leq i \leq j+kl \f$ are stored, all other
+// elements are zero. Each row (in case of row-major order) or each column (in case of
+// column-major order) occupies \f$ kl+ku+1 \f$ consecutive elements of the internal array.
+// In case of column-major order the element \f$ (i,j) \f$ is stored at position
+// \f$ (ku+i-j) \f$ of column \a j, which corresponds to the band storage format of LAPACK (as
+// for instance used by \c dgbmv or \c dgbtrf), in case of row-major order the element
+// \f$ (i,j) \f$ is stored at position \f$ (kl+j-i) \f$ of row \a i. Therefore the memory
+// consumption of a \f$ N \times N \f$ tridiagonal matrix is \f$ 3N \f$ instead of \f$ N^2 \f$:
+
+   \code
+   using blaze::BandMatrix;
+   using blaze::DynamicVector;
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   BandMatrix<double,rowMajor> A( 5UL, 5UL, 1UL, 1UL );  // 5x5 tridiagonal matrix
+
+   A(0,0) =  2.0;  // Access to the diagonal element (0,0)
+   A(0,1) = -1.0;  // Access to the superdiagonal element (0,1)
+   A(0,3) =  1.0;  // Invalid assignment to an element outside of the band; results in an exception!
+
+   BandMatrix<double,columnMajor> B{ { 1, 2, 0 }, { 0, 3, 4 }, { 0, 0, 5 } };  // kl=0, ku=1
+
+   DynamicVector<double> x( 5UL, 1.0 );
+   DynamicVector<double> y( A * x );  // Band-aware matrix/vector multiplication
+   \endcode
+
+// The write access to an element via the function call operator is performed by means of a
+// proxy object (see PackedProxy), which throws a \a std::invalid_argument exception in case
+// a non-zero value is assigned to an element outside of the band. Read accesses to elements
+// outside of the band return zero. In order to change the bandwidth of a matrix, the resize()
+// function can be used. Additionally, the assignment of another matrix adopts the bandwidth
+// of the assigned matrix and the addition or subtraction of another matrix extends the band
+// if necessary:
+
+   \code
+   blaze::DynamicMatrix<double> D{ { 1, 0, 0 }, { 2, 1, 0 }, { 3, 2, 1 } };
+
+   BandMatrix<double> C( D );  // Results in a 3x3 band matrix with kl=2 and ku=0
+   C += trans( D );            // Extends the band of C to kl=2 and ku=2
+   \endcode
+
+// The BandMatrix class template provides dedicated, vectorized kernels for the multiplication
+// with dense vectors and dense matrices, which only traverse the band of the matrix (see
+// <tt><blaze/math/dense/BandKernels.h></tt>), and for the addition and subtraction of two band
+// matrices. Since the elements of a row or column are not stored at fixed offsets relative to
+// the beginning of the row or column, BandMatrix is not SIMD-enabled for general expressions
+// and does not provide direct access to its rows or columns (i.e. HasConstDataAccess evaluates
+// to \a false). Linear systems of equations with a band system matrix are solved by means of
+// the banded LAPACK solvers (see the gbsv() and pbsv() functions):
+
+   \code
+   blaze::DynamicVector<double> b( 5UL, 1.0 ), x;
+
+   solve( A, x, b );   // Solving the LSE via the LAPACK gbsv() function
+   x = solve( A, b );  // Same as above
+   \endcode
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+class BandMatrix
+   : public DenseMatrix< BandMatrix<Type,SO>, SO >
+{
+ public:
+   //**Type definitions****************************************************************************
+   using This          = BandMatrix<Type,SO>;       //!< Type of this BandMatrix instance.
+   using BaseType      = DenseMatrix<This,SO>;      //!< Base type of this BandMatrix instance.
+   using ResultType    = This;                      //!< Result type for expression template evaluations.
+   using OppositeType  = BandMatrix<Type,!SO>;      //!< Result type with opposite storage order for expression template evaluations.
+   using TransposeType = BandMatrix<Type,!SO>;      //!< Transpose type for expression template evaluations.
+   using ElementType   = Type;                      //!< Type of the matrix elements.
+   using SIMDType      = SIMDTrait_t<ElementType>;  //!< SIMD type of the matrix elements.
+   using ReturnType    = const Type&;               //!< Return type for expression template evaluations.
+   using CompositeType = const This&;               //!< Data type for composite expression templates.
+
+   using Reference      = PackedProxy<This>;  //!< Reference to a non-constant matrix value.
+   using ConstReference = const Type&;        //!< Reference to a constant matrix value.
+   using Pointer        = Type*;              //!< Pointer to a non-constant matrix value.
+   using ConstPointer   = const Type*;        //!< Pointer to a constant matrix value.
+
+   using Iterator      = PackedIterator<This>;        //!< Iterator over non-constant elements.
+   using ConstIterator = PackedIterator<const This>;  //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a BandMatrix with different data/element type.
+   */
+   template< typename NewType >  // Data type of the other matrix
+   struct Rebind {
+      using Other = BandMatrix<NewType,SO>;  //!< The type of the other BandMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Resize struct definition********************************************************************
+   /*!\brief Resize mechanism to obtain a BandMatrix with different fixed dimensions.
+   */
+   template< size_t NewM    // Number of rows of the other matrix
+           , size_t NewN >  // Number of columns of the other matrix
+   struct Resize {
+      using Other = BandMatrix<Type,SO>;  //!< The type of the other BandMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SIMD optimization.
+   /*! The \a simdEnabled compilation flag indicates whether expressions the matrix is involved
+       in can be optimized via SIMD operations. Since the elements outside of the band are not
+       stored, the \a simdEnabled compilation flag is always set to \a false. */
+   static constexpr bool simdEnabled = false;
+
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). Since the assignment to a band matrix may change its bandwidth, the
+       \a smpAssignable compilation flag is always set to \a false. */
+   static constexpr bool smpAssignable = false;
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+            inline BandMatrix() noexcept;
+   explicit inline BandMatrix( size_t m, size_t n, size_t kl, size_t ku );
+            inline BandMatrix( size_t m, size_t n, size_t kl, size_t ku, const Type& init );
+            inline BandMatrix( initializer_list< initializer_list<Type> > list );
+
+   inline BandMatrix( const BandMatrix& m );
+   inline BandMatrix( BandMatrix&& m ) noexcept;
+
+   template< typename MT, bool SO2 >
+   inline BandMatrix( const Matrix<MT,SO2>& m );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~BandMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator()( size_t i, size_t j ) noexcept;
+   inline ConstReference operator()( size_t i, size_t j ) const noexcept;
+   inline Reference      at( size_t i, size_t j );
+   inline ConstReference at( size_t i, size_t j ) const;
+   inline Pointer        data  () noexcept;
+   inline ConstPointer   data  () const noexcept;
+   inline Pointer        data  ( size_t i ) noexcept;
+   inline ConstPointer   data  ( size_t i ) const noexcept;
+   inline Iterator       begin ( size_t i ) noexcept;
+   inline ConstIterator  begin ( size_t i ) const noexcept;
+   inline ConstIterator  cbegin( size_t i ) const noexcept;
+   inline Iterator       end   ( size_t i ) noexcept;
+   inline ConstIterator  end   ( size_t i ) const noexcept;
+   inline ConstIterator  cend  ( size_t i ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline BandMatrix& operator=( const Type& rhs );
+   inline BandMatrix& operator=( initializer_list< initializer_list<Type> > list );
+
+   inline BandMatrix& operator=( const BandMatrix& rhs );
+   inline BandMatrix& operator=( BandMatrix&& rhs ) noexcept;
+
+   template< typename MT, bool SO2 > inline BandMatrix& operator= ( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline BandMatrix& operator+=( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline BandMatrix& operator-=( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline BandMatrix& operator%=( const Matrix<MT,SO2>& rhs );
+
+   template< typename ST >
+   inline auto operator*=( ST rhs ) -> EnableIf_t< IsNumeric_v<ST>, BandMatrix& >;
+
+   template< typename ST >
+   inline auto operator/=( ST rhs ) -> EnableIf_t< IsNumeric_v<ST>, BandMatrix& >;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const noexcept;
+   inline size_t columns() const noexcept;
+   inline size_t lowerBandwidth() const noexcept;
+   inline size_t upperBandwidth() const noexcept;
+   inline size_t spacing() const noexcept;
+   inline size_t capacity() const noexcept;
+   inline size_t capacity( size_t i ) const noexcept;
+   inline size_t bandBegin( size_t i ) const noexcept;
+   inline size_t bandEnd( size_t i ) const noexcept;
+   inline size_t nonZeros() const;
+   inline size_t nonZeros( size_t i ) const;
+   inline void   reset();
+   inline void   reset( size_t i );
+   inline void   clear();
+   inline void   resize ( size_t m, size_t n, bool preserve=true );
+          void   resize ( size_t m, size_t n, size_t kl, size_t ku, bool preserve=true );
+   inline void   reserve( size_t elements );
+   inline void   shrinkToFit();
+   inline void   swap( BandMatrix& m ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Numeric functions***************************************************************************
+   /*!\name Numeric functions */
+   //@{
+   inline BandMatrix& transpose();
+   inline BandMatrix& ctranspose();
+
+   template< typename Other > inline BandMatrix& scale( const Other& scalar );
+   //@}
+   //**********************************************************************************************
+
+   //**Debugging functions*************************************************************************
+   /*!\name Debugging functions */
+   //@{
+   inline bool isIntact() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   inline bool isAligned   () const noexcept;
+   inline bool canSMPAssign() const noexcept;
+
+   template< typename MT, bool SO2 > inline void assign( const DenseMatrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline void assign( const SparseMatrix<MT,SO2>& rhs );
+   template< typename Other >        inline void assign( const BandMatrix<Other,SO>& rhs );
+
+   template< typename MT, bool SO2 > inline void addAssign( const DenseMatrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline void addAssign( const SparseMatrix<MT,SO2>& rhs );
+   template< typename Other >        inline void addAssign( const BandMatrix<Other,SO>& rhs );
+
+   template< typename MT, bool SO2 > inline void subAssign( const DenseMatrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline void subAssign( const SparseMatrix<MT,SO2>& rhs );
+   template< typename Other >        inline void subAssign( const BandMatrix<Other,SO>& rhs );
+
+   template< typename MT, bool SO2 > inline void schurAssign( const DenseMatrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline void schurAssign( const SparseMatrix<MT,SO2>& rhs );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t lines () const noexcept;
+   inline bool   inBand( size_t i, size_t j ) const noexcept;
+   inline size_t index ( size_t i, size_t j ) const noexcept;
+
+   inline void set( size_t i, size_t j, const Type& value );
+
+   template< typename MT, bool SO2 >
+   static inline void detectBandwidth( const DenseMatrix<MT,SO2>& m, size_t& kl, size_t& ku );
+
+   template< typename MT, bool SO2 >
+   static inline void detectBandwidth( const SparseMatrix<MT,SO2>& m, size_t& kl, size_t& ku );
+
+   template< typename Other, bool SO2 >
+   static inline void detectBandwidth( const BandMatrix<Other,SO2>& m, size_t& kl, size_t& ku ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t m_;                //!< The current number of rows of the matrix.
+   size_t n_;                //!< The current number of columns of the matrix.
+   size_t kl_;               //!< The current number of subdiagonals of the band.
+   size_t ku_;               //!< The current number of superdiagonals of the band.
+   size_t capacity_;         //!< The maximum capacity of the matrix.
+   Type* BLAZE_RESTRICT v_;  //!< The dynamically allocated band matrix elements.
+
+   static const Type zero_;  //!< Neutral element for accesses to elements outside of the band.
+   //@}
+   //**********************************************************************************************
+
+   //**Friend declarations*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   friend class PackedProxy<This>;
+   template< typename Other, bool SO2 > friend class BandMatrix;
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+const Type BandMatrix<Type,SO>::zero_{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for BandMatrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline BandMatrix<Type,SO>::BandMatrix() noexcept
+   : m_       ( 0UL )      // The current number of rows of the matrix
+   , n_       ( 0UL )      // The current number of columns of the matrix
+   , kl_      ( 0UL )      // The current number of subdiagonals of the band
+   , ku_      ( 0UL )      // The current number of superdiagonals of the band
+   , capacity_( 0UL )      // The maximum capacity of the matrix
+   , v_       ( nullptr )  // The band matrix elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a \f$ M \times N \f$ matrix with the given bandwidth.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param kl The number of subdiagonals of the band.
+// \param ku The number of superdiagonals of the band.
+//
+// All matrix elements are initialized to their default value.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline BandMatrix<Type,SO>::BandMatrix( size_t m, size_t n, size_t kl, size_t ku )
+   : BandMatrix( m, n, kl, ku, Type() )
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a homogenous initialization of all elements within the band.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param kl The number of subdiagonals of the band.
+// \param ku The number of superdiagonals of the band.
+// \param init The initial value of the elements within the band.
+//
+// All elements within the band are initialized with the specified value, all elements outside
+// of the band are zero.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline BandMatrix<Type,SO>::BandMatrix( size_t m, size_t n, size_t kl, size_t ku, const Type& init )
+   : m_       ( m )                            // The current number of rows of the matrix
+   , n_       ( n )                            // The current number of columns of the matrix
+   , kl_      ( kl )                           // The current number of subdiagonals of the band
+   , ku_      ( ku )                           // The current number of superdiagonals of the band
+   , capacity_( lines() * spacing() )          // The maximum capacity of the matrix
+   , v_       ( allocate<Type>( capacity_ ) )  // The band matrix elements
+{
+   std::fill( v_, v_+capacity_, Type() );
+
+   for( size_t k=0UL; k<lines(); ++k ) {
+      std::fill( data(k), data(k)+bandEnd(k)-bandBegin(k), init );
+   }
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief List initialization of all matrix elements.
+//
+// \param list The initializer list.
+//
+// This constructor provides the option to explicitly initialize the elements of the matrix by
+// means of an initializer list:
+
+   \code
+   blaze::BandMatrix<int> A{ { 1, 2 },
+                             { 3, 4, 5 },
+                             { 0, 6, 7 } };
+   \endcode
+
+// The matrix is sized according to the size of the initializer list and all its elements are
+// initialized by the values of the given initializer list. Missing values are initialized as
+// default. The bandwidth of the matrix is chosen as the smallest band that contains all
+// non-zero elements of the list (in the example \a kl=1 and \a ku=1).
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline BandMatrix<Type,SO>::BandMatrix( initializer_list< initializer_list<Type> > list )
+   : BandMatrix()
+{
+   const size_t m( list.size() );
+   const size_t n( determineColumns( list ) );
+
+   size_t kl( 0UL ), ku( 0UL ), i( 0UL );
+
+   for( const auto& rowList : list ) {
+      size_t j( 0UL );
+      for( const auto& element : rowList ) {
+         if( !isDefault( element ) ) {
+            if( i > j ) kl = max( kl, i-j );
+            else        ku = max( ku, j-i );
+         }
+         ++j;
+      }
+      ++i;
+   }
+
+   resize( m, n, kl, ku, false );
+   reset();
+
+   i = 0UL;
+   for( const auto& rowList : list ) {
+      size_t j( 0UL );
+      for( const auto& element : rowList ) {
+         if( inBand( i, j ) )
+            v_[index(i,j)] = element;
+         ++j;
+      }
+      ++i;
+   }
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for BandMatrix.
+//
+// \param m Matrix to be copied.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline BandMatrix<Type,SO>::BandMatrix( const BandMatrix& m )
+   : m_       ( m.m_ )                         // The current number of rows of the matrix
+   , n_       ( m.n_ )                         // The current number of columns of the matrix
+   , kl_      ( m.kl_ )                        // The current number of subdiagonals of the band
+   , ku_      ( m.ku_ )                        // The current number of superdiagonals of the band
+   , capacity_( lines() * spacing() )          // The maximum capacity of the matrix
+   , v_       ( allocate<Type>( capacity_ ) )  // The band matrix elements
+{
+   std::copy( m.v_, m.v_+capacity_, v_ );
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for BandMatrix.
+//
+// \param m The matrix to be moved into this instance.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline BandMatrix<Type,SO>::BandMatrix( BandMatrix&& m ) noexcept
+   : m_       ( m.m_        )  // The current number of rows of the matrix
+   , n_       ( m.n_        )  // The current number of columns of the matrix
+   , kl_      ( m.kl_       )  // The current number of subdiagonals of the band
+   , ku_      ( m.ku_       )  // The current number of superdiagonals of the band
+   , capacity_( m.capacity_ )  // The maximum capacity of the matrix
+   , v_       ( m.v_        )  // The band matrix elements
+{
+   m.m_        = 0UL;
+   m.n_        = 0UL;
+   m.kl_       = 0UL;
+   m.ku_       = 0UL;
+   m.capacity_ = 0UL;
+   m.v_        = nullptr;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different matrices.
+//
+// \param m Matrix to be copied.
+//
+// This constructor initializes the band matrix as a copy of the given matrix. The bandwidth
+// of the band matrix is chosen as the smallest band that contains all non-default elements
+// of the given matrix. In case the given matrix is a band matrix, its bandwidth is adopted.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the foreign matrix
+        , bool SO2 >     // Storage order of the foreign matrix
+inline BandMatrix<Type,SO>::BandMatrix( const Matrix<MT,SO2>& m )
+   : BandMatrix()
+{
+   const CompositeType_t<MT> tmp( ~m );
+
+   size_t kl( 0UL ), ku( 0UL );
+   detectBandwidth( tmp, kl, ku );
+
+   resize( tmp.rows(), tmp.columns(), kl, ku, false );
+   reset();
+   assign( tmp );
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for BandMatrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline BandMatrix<Type,SO>::~BandMatrix()
+{
+   deallocate( v_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Proxy to the accessed matrix element.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices. Note that the
+// attempt to assign a non-zero value to an element outside of the band results in a
+// \a std::invalid_argument exception.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename BandMatrix<Type,SO>::Reference
+   BandMatrix<Type,SO>::operator()( size_t i, size_t j ) noexcept
+{
+   BLAZE_USER_ASSERT( i<m_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j<n_, "Invalid column access index" );
+   return Reference( *this, i, j );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices. Accesses to
+// elements outside of the band return a reference to zero.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename BandMatrix<Type,SO>::ConstReference
+   BandMatrix<Type,SO>::operator()( size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( i<m_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j<n_, "Invalid column access index" );
+   return ( inBand( i, j ) )?( v_[index(i,j)] ):( zero_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Proxy to the accessed matrix element.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// In contrast to the function call operator this function always performs a check of the
+// given access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename BandMatrix<Type,SO>::Reference
+   BandMatrix<Type,SO>::at( size_t i, size_t j )
+{
+   if( i >= m_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// In contrast to the function call operator this function always performs a check of the
+// given access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename BandMatrix<Type,SO>::ConstReference
+   BandMatrix<Type,SO>::at( size_t i, size_t j ) const
+{
+   if( i >= m_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the band storage.
+//
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the internal storage of the band matrix. Each row (in case
+// of row-major order) or column (in case of column-major order) occupies spacing() consecutive
+// elements. In case of row-major order the element \f$ (i,j) \f$ is stored at position
+// \f$ i \cdot spacing() + kl + j - i \f$, in case of column-major order it is stored at position
+// \f$ j \cdot spacing() + ku + i - j \f$. Note that the positions that do not correspond to an
+// element of the matrix (as for instance the first \a kl positions of the first row) are not
+// guaranteed to be zero.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename BandMatrix<Type,SO>::Pointer
+   BandMatrix<Type,SO>::data() noexcept
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the band storage.
+//
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the internal storage of the band matrix. Each row (in case
+// of row-major order) or column (in case of column-major order) occupies spacing() consecutive
+// elements. In case of row-major order the element \f$ (i,j) \f$ is stored at position
+// \f$ i \cdot spacing() + kl + j - i \f$, in case of column-major order it is stored at position
+// \f$ j \cdot spacing() + ku + i - j \f$. Note that the positions that do not correspond to an
+// element of the matrix (as for instance the first \a kl positions of the first row) are not
+// guaranteed to be zero.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename BandMatrix<Type,SO>::ConstPointer
+   BandMatrix<Type,SO>::data() const noexcept
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the band of row/column \a i.
+//
+// \param i The row/column index.
+// \return Pointer to the first stored element of row/column \a i.
+//
+// This function returns a pointer to the first element of row/column \a i within the band, i.e.
+// the element with column/row index bandBegin(i). The \f$ bandEnd(i)-bandBegin(i) \f$ elements
+// of the band of row/column \a i are stored consecutively.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename BandMatrix<Type,SO>::Pointer
+   BandMatrix<Type,SO>::data( size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid dense matrix row/column access index" );
+   return ( SO )?( v_ + index( bandBegin(i), i ) ):( v_ + index( i, bandBegin(i) ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the band of row/column \a i.
+//
+// \param i The row/column index.
+// \return Pointer to the first stored element of row/column \a i.
+//
+// This function returns a pointer to the first element of row/column \a i within the band, i.e.
+// the element with column/row index bandBegin(i). The \f$ bandEnd(i)-bandBegin(i) \f$ elements
+// of the band of row/column \a i are stored consecutively.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename BandMatrix<Type,SO>::ConstPointer
+   BandMatrix<Type,SO>::data( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid dense matrix row/column access index" );
+   return ( SO )?( v_ + index( bandBegin(i), i ) ):( v_ + index( i, bandBegin(i) ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+//
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// element of row \a i, in case the storage flag is set to \a columnMajor the function returns an
+// iterator to the first element of column \a i. Note that the iterator traverses all elements
+// of the row/column, including the elements outside of the band.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename BandMatrix<Type,SO>::Iterator
+   BandMatrix<Type,SO>::begin( size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid dense matrix row/column access index" );
+   return Iterator( *this, i, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+//
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// element of row \a i, in case the storage flag is set to \a columnMajor the function returns an
+// iterator to the first element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename BandMatrix<Type,SO>::ConstIterator
+   BandMatrix<Type,SO>::begin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid dense matrix row/column access index" );
+   return ConstIterator( *this, i, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+//
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// element of row \a i, in case the storage flag is set to \a columnMajor the function returns an
+// iterator to the first element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename BandMatrix<Type,SO>::ConstIterator
+   BandMatrix<Type,SO>::cbegin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid dense matrix row/column access index" );
+   return ConstIterator( *this, i, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+//
+// In case the storage order is set to \a rowMajor the function returns an iterator just past
+// the last element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator just past the last element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename BandMatrix<Type,SO>::Iterator
+   BandMatrix<Type,SO>::end( size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid dense matrix row/column access index" );
+   return Iterator( *this, i, ( SO )?( m_ ):( n_ ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+//
+// In case the storage order is set to \a rowMajor the function returns an iterator just past
+// the last element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator just past the last element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename BandMatrix<Type,SO>::ConstIterator
+   BandMatrix<Type,SO>::end( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid dense matrix row/column access index" );
+   return ConstIterator( *this, i, ( SO )?( m_ ):( n_ ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+//
+// In case the storage order is set to \a rowMajor the function returns an iterator just past
+// the last element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator just past the last element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename BandMatrix<Type,SO>::ConstIterator
+   BandMatrix<Type,SO>::cend( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid dense matrix row/column access index" );
+   return ConstIterator( *this, i, ( SO )?( m_ ):( n_ ) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Homogenous assignment to all elements within the band.
+//
+// \param rhs Scalar value to be assigned to all elements within the band.
+// \return Reference to the assigned matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline BandMatrix<Type,SO>& BandMatrix<Type,SO>::operator=( const Type& rhs )
+{
+   for( size_t k=0UL; k<lines(); ++k ) {
+      std::fill( data(k), data(k)+bandEnd(k)-bandBegin(k), rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief List assignment to all matrix elements.
+//
+// \param list The initializer list.
+// \return Reference to the assigned matrix.
+//
+// This assignment operator offers the option to directly assign to all elements of the matrix
+// by means of an initializer list:
+
+   \code
+   blaze::BandMatrix<int> A;
+   A = { { 1, 2 },
+         { 3, 4, 5 },
+         { 0, 6, 7 } };
+   \endcode
+
+// The matrix is resized according to the given initializer list and all its elements are
+// assigned the values from the given initializer list. Missing values are initialized as
+// default. The bandwidth of the matrix is adapted to the smallest band that contains all
+// non-zero elements of the list.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline BandMatrix<Type,SO>&
+   BandMatrix<Type,SO>::operator=( initializer_list< initializer_list<Type> > list )
+{
+   BandMatrix tmp( list );
+   swap( tmp );
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for BandMatrix.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned matrix.
+//
+// The matrix is resized according to the given \f$ M \times N \f$ matrix and initialized as a
+// copy of this matrix. The bandwidth of the given matrix is adopted.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline BandMatrix<Type,SO>& BandMatrix<Type,SO>::operator=( const BandMatrix& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   resize( rhs.m_, rhs.n_, rhs.kl_, rhs.ku_, false );
+   std::copy( rhs.v_, rhs.v_+lines()*spacing(), v_ );
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for BandMatrix.
+//
+// \param rhs The matrix to be moved into this instance.
+// \return Reference to the assigned matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline BandMatrix<Type,SO>& BandMatrix<Type,SO>::operator=( BandMatrix&& rhs ) noexcept
+{
+   deallocate( v_ );
+
+   m_        = rhs.m_;
+   n_        = rhs.n_;
+   kl_       = rhs.kl_;
+   ku_       = rhs.ku_;
+   capacity_ = rhs.capacity_;
+   v_        = rhs.v_;
+
+   rhs.m_        = 0UL;
+   rhs.n_        = 0UL;
+   rhs.kl_       = 0UL;
+   rhs.ku_       = 0UL;
+   rhs.capacity_ = 0UL;
+   rhs.v_        = nullptr;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different matrices.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned matrix.
+//
+// The matrix is resized according to the given \f$ M \times N \f$ matrix and initialized as a
+// copy of this matrix. The bandwidth of the band matrix is adapted to the smallest band that
+// contains all non-default elements of the given matrix. In case the given matrix is a band
+// matrix, its bandwidth is adopted.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline BandMatrix<Type,SO>& BandMatrix<Type,SO>::operator=( const Matrix<MT,SO2>& rhs )
+{
+   BandMatrix tmp( ~rhs );
+   swap( tmp );
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator for the addition of a matrix (\f$ A+=B \f$).
+//
+// \param rhs The right-hand side matrix to be added to the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument
+// exception is thrown. The band of the matrix is extended to contain all non-default elements
+// of the given matrix. In case both matrices are band matrices with the same storage order,
+// the addition is performed by means of contiguous, vectorizable updates of the bands.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline BandMatrix<Type,SO>& BandMatrix<Type,SO>::operator+=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( (~rhs).canAlias( this ) ) {
+      const ResultType_t<MT> tmp( ~rhs );
+      return (*this) += tmp;
+   }
+
+   const CompositeType_t<MT> tmp( ~rhs );
+
+   size_t kl( kl_ ), ku( ku_ );
+   detectBandwidth( tmp, kl, ku );
+   resize( m_, n_, kl, ku, true );
+
+   addAssign( tmp );
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator for the subtraction of a matrix (\f$ A-=B \f$).
+//
+// \param rhs The right-hand side matrix to be subtracted from the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument
+// exception is thrown. The band of the matrix is extended to contain all non-default elements
+// of the given matrix. In case both matrices are band matrices with the same storage order,
+// the subtraction is performed by means of contiguous, vectorizable updates of the bands.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline BandMatrix<Type,SO>& BandMatrix<Type,SO>::operator-=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( (~rhs).canAlias( this ) ) {
+      const ResultType_t<MT> tmp( ~rhs );
+      return (*this) -= tmp;
+   }
+
+   const CompositeType_t<MT> tmp( ~rhs );
+
+   size_t kl( kl_ ), ku( ku_ );
+   detectBandwidth( tmp, kl, ku );
+   resize( m_, n_, kl, ku, true );
+
+   subAssign( tmp );
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Schur product assignment operator for the multiplication of a matrix (\f$ A\circ=B \f$).
+//
+// \param rhs The right-hand side matrix for the Schur product.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument
+// exception is thrown. The bandwidth of the matrix remains unchanged.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline BandMatrix<Type,SO>& BandMatrix<Type,SO>::operator%=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( (~rhs).canAlias( this ) ) {
+      const ResultType_t<MT> tmp( ~rhs );
+      schurAssign( tmp );
+   }
+   else {
+      const CompositeType_t<MT> tmp( ~rhs );
+      schurAssign( tmp );
+   }
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication between a matrix and
+//        a scalar value (\f$ A*=s \f$).
+//
+// \param rhs The right-hand side scalar value for the multiplication.
+// \return Reference to the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename ST >  // Data type of the right-hand side scalar
+inline auto BandMatrix<Type,SO>::operator*=( ST rhs )
+   -> EnableIf_t< IsNumeric_v<ST>, BandMatrix& >
+{
+   const size_t nnz( lines() * spacing() );
+
+   for( size_t k=0UL; k<nnz; ++k ) {
+      v_[k] *= rhs;
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment operator for the division of a matrix by a scalar value
+//        (\f$ A/=s \f$).
+//
+// \param rhs The right-hand side scalar value for the division.
+// \return Reference to the matrix.
+//
+// \note A division by zero is only checked by an user assert.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename ST >  // Data type of the right-hand side scalar
+inline auto BandMatrix<Type,SO>::operator/=( ST rhs )
+   -> EnableIf_t< IsNumeric_v<ST>, BandMatrix& >
+{
+   BLAZE_USER_ASSERT( !isZero( rhs ), "Division by zero detected" );
+
+   const size_t nnz( lines() * spacing() );
+
+   for( size_t k=0UL; k<nnz; ++k ) {
+      v_[k] /= rhs;
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the matrix.
+//
+// \return The number of rows of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t BandMatrix<Type,SO>::rows() const noexcept
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the matrix.
+//
+// \return The number of columns of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t BandMatrix<Type,SO>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of subdiagonals of the band.
+//
+// \return The lower bandwidth of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t BandMatrix<Type,SO>::lowerBandwidth() const noexcept
+{
+   return kl_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of superdiagonals of the band.
+//
+// \return The upper bandwidth of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t BandMatrix<Type,SO>::upperBandwidth() const noexcept
+{
+   return ku_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the spacing between the beginning of two rows/columns of the band storage.
+//
+// \return The spacing between the beginning of two rows/columns.
+//
+// This function returns the spacing between the beginning of two rows/columns of the internal
+// band storage (see data()), i.e. the total number \f$ kl+ku+1 \f$ of elements of a row/column.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t BandMatrix<Type,SO>::spacing() const noexcept
+{
+   return kl_ + ku_ + 1UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the matrix.
+//
+// \return The capacity of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t BandMatrix<Type,SO>::capacity() const noexcept
+{
+   return capacity_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current capacity of the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The current capacity of row/column \a i.
+//
+// This function returns the number of elements that can be stored in the specified row/column,
+// i.e. the number of elements of row/column \a i within the band.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t BandMatrix<Type,SO>::capacity( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid row/column access index" );
+   return bandEnd(i) - bandBegin(i);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the index of the first element of row/column \a i within the band.
+//
+// \param i The index of the row/column.
+// \return The column/row index of the first element within the band.
+//
+// In case the storage order is set to \a rowMajor the function returns the index of the first
+// column of row \a i within the band, in case the storage flag is set to \a columnMajor the
+// function returns the index of the first row of column \a i within the band.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t BandMatrix<Type,SO>::bandBegin( size_t i ) const noexcept
+{
+   const size_t kb( ( SO )?( ku_ ):( kl_ ) );
+   return ( i > kb )?( i - kb ):( 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the index one past the last element of row/column \a i within the band.
+//
+// \param i The index of the row/column.
+// \return The column/row index one past the last element within the band.
+//
+// In case the storage order is set to \a rowMajor the function returns the index one past the
+// last column of row \a i within the band, in case the storage flag is set to \a columnMajor the
+// function returns the index one past the last row of column \a i within the band. For rows
+// (columns) of a rectangular matrix that lie completely outside of the band the function
+// returns the same index as bandBegin(), i.e. the band of the row (column) is empty.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t BandMatrix<Type,SO>::bandEnd( size_t i ) const noexcept
+{
+   const size_t ke( ( SO )?( kl_ ):( ku_ ) );
+   const size_t n ( ( SO )?( m_ ):( n_ ) );
+   return max( bandBegin(i), min( n, i+ke+1UL ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of non-zero elements in the matrix.
+//
+// \return The number of non-zero elements in the band matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t BandMatrix<Type,SO>::nonZeros() const
+{
+   size_t nonzeros( 0UL );
+
+   for( size_t k=0UL; k<lines(); ++k ) {
+      nonzeros += nonZeros( k );
+   }
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The number of non-zero elements of row/column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t BandMatrix<Type,SO>::nonZeros( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid row/column access index" );
+
+   const Type* p( data(i) );
+   const size_t len( bandEnd(i) - bandBegin(i) );
+
+   size_t nonzeros( 0UL );
+
+   for( size_t k=0UL; k<len; ++k ) {
+      if( !isDefault( p[k] ) )
+         ++nonzeros;
+   }
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void BandMatrix<Type,SO>::reset()
+{
+   using blaze::clear;
+
+   const size_t nnz( lines() * spacing() );
+
+   for( size_t k=0UL; k<nnz; ++k ) {
+      clear( v_[k] );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row/column to the default initial values.
+//
+// \param i The index of the row/column.
+// \return void
+//
+// This function resets the values in the specified row/column to their default value. In case
+// the storage order is set to \a rowMajor the function resets the values in row \a i, in case
+// the storage order is set to \a columnMajor the function resets the values in column \a i.
+// Note that the capacity of the row/column remains unchanged.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void BandMatrix<Type,SO>::reset( size_t i )
+{
+   using blaze::clear;
+
+   BLAZE_USER_ASSERT( i < lines(), "Invalid row/column access index" );
+
+   Type* p( data(i) );
+   const size_t len( bandEnd(i) - bandBegin(i) );
+
+   for( size_t k=0UL; k<len; ++k ) {
+      clear( p[k] );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the \f$ M \times N \f$ matrix.
+//
+// \return void
+//
+// After the clear() function, the size and the bandwidth of the matrix is 0.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void BandMatrix<Type,SO>::clear()
+{
+   m_  = 0UL;
+   n_  = 0UL;
+   kl_ = 0UL;
+   ku_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the size of the matrix.
+//
+// \param m The new number of rows of the matrix.
+// \param n The new number of columns of the matrix.
+// \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
+// \return void
+//
+// This function resizes the matrix using the given size to \f$ m \times n \f$. The bandwidth
+// of the matrix remains unchanged. During this operation, new dynamic memory may be allocated
+// in case the capacity of the matrix is too small. Note that this function may invalidate all
+// existing views (submatrices, rows, columns, ...) on the matrix if it is used to shrink the
+// matrix. Additionally, the resize operation potentially changes all matrix elements. In order
+// to preserve the old matrix values, the \a preserve flag can be set to \a true. In this case
+// new elements are default initialized.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void BandMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
+{
+   resize( m, n, kl_, ku_, preserve );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the size and the bandwidth of the matrix.
+//
+// \param m The new number of rows of the matrix.
+// \param n The new number of columns of the matrix.
+// \param kl The new number of subdiagonals of the band.
+// \param ku The new number of superdiagonals of the band.
+// \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
+// \return void
+//
+// This function resizes the matrix using the given size to \f$ m \times n \f$ and changes the
+// bandwidth of the matrix to \a kl subdiagonals and \a ku superdiagonals. During this operation,
+// new dynamic memory may be allocated in case the capacity of the matrix is too small. Note that
+// this function may invalidate all existing views (submatrices, rows, columns, ...) on the
+// matrix. Additionally, the resize operation potentially changes all matrix elements. In order
+// to preserve the old matrix values, the \a preserve flag can be set to \a true. In this case
+// new elements are default initialized and elements outside of the new band are discarded.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+void BandMatrix<Type,SO>::resize( size_t m, size_t n, size_t kl, size_t ku, bool preserve )
+{
+   if( m == m_ && n == n_ && kl == kl_ && ku == ku_ ) return;
+
+   if( preserve )
+   {
+      BandMatrix tmp( m, n, kl, ku );
+
+      const size_t mmin( min( m, m_ ) );
+      const size_t nmin( min( n, n_ ) );
+
+      for( size_t k=0UL; k<( SO ? nmin : mmin ); ++k ) {
+         const size_t jbegin( max( bandBegin(k), tmp.bandBegin(k) ) );
+         const size_t jend  ( min( bandEnd(k), tmp.bandEnd(k) ) );
+         if( jbegin < jend ) {
+            transfer( data(k) + ( jbegin - bandBegin(k) ), data(k) + ( jend - bandBegin(k) ),
+                      tmp.data(k) + ( jbegin - tmp.bandBegin(k) ) );
+         }
+      }
+
+      swap( tmp );
+      return;
+   }
+
+   const size_t nnz( ( SO ? n : m ) * ( kl + ku + 1UL ) );
+
+   if( nnz > capacity_ )
+   {
+      Type* BLAZE_RESTRICT v = allocate<Type>( nnz );
+
+      std::swap( v_, v );
+      deallocate( v );
+      capacity_ = nnz;
+   }
+
+   m_  = m;
+   n_  = n;
+   kl_ = kl;
+   ku_ = ku;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of the matrix.
+//
+// \param elements The new minimum capacity of the band matrix.
+// \return void
+//
+// This function increases the capacity of the band matrix to at least \a elements elements.
+// The current values of the matrix elements are preserved.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void BandMatrix<Type,SO>::reserve( size_t elements )
+{
+   using std::swap;
+
+   if( elements > capacity_ )
+   {
+      // Allocating a new array
+      Type* BLAZE_RESTRICT tmp = allocate<Type>( elements );
+
+      // Initializing the new array
+      transfer( v_, v_+capacity_, tmp );
+
+      // Replacing the old array
+      swap( tmp, v_ );
+      deallocate( tmp );
+      capacity_ = elements;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Requesting the removal of unused capacity.
+//
+// \return void
+//
+// This function minimizes the capacity of the matrix by removing unused capacity. Please note
+// that due to padding the capacity might not be reduced exactly to rows() times columns().
+// Please also note that in case a reallocation occurs, all iterators (including end()
+// iterators), all pointers and references to elements of this matrix are invalidated.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void BandMatrix<Type,SO>::shrinkToFit()
+{
+   if( lines() * spacing() < capacity_ ) {
+      BandMatrix( *this ).swap( *this );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two matrices.
+//
+// \param m The matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void BandMatrix<Type,SO>::swap( BandMatrix& m ) noexcept
+{
+   using std::swap;
+
+   swap( m_ , m.m_  );
+   swap( n_ , m.n_  );
+   swap( kl_, m.kl_ );
+   swap( ku_, m.ku_ );
+   swap( capacity_, m.capacity_ );
+   swap( v_ , m.v_  );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows/columns of the band storage.
+//
+// \return The number of rows (in case of row-major order) or columns (column-major order).
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t BandMatrix<Type,SO>::lines() const noexcept
+{
+   return ( SO )?( n_ ):( m_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the specified element is within the band of the matrix.
+//
+// \param i The row index of the element.
+// \param j The column index of the element.
+// \return \a true in case the element is stored, \a false if not.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline bool BandMatrix<Type,SO>::inBand( size_t i, size_t j ) const noexcept
+{
+   return ( i <= j+kl_ ) && ( j <= i+ku_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the position of the given element within the band storage.
+//
+// \param i The row index of the element.
+// \param j The column index of the element.
+// \return The position of the element within the band storage.
+//
+// This function computes the position of the element \f$ (i,j) \f$ within the band storage.
+// The element is required to be within the band.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t BandMatrix<Type,SO>::index( size_t i, size_t j ) const noexcept
+{
+   BLAZE_INTERNAL_ASSERT( inBand( i, j ), "Invalid access to element outside of the band" );
+
+   if( SO )
+      return j*spacing() + ku_ + i - j;
+   else
+      return i*spacing() + kl_ + j - i;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting a single element of the matrix.
+//
+// \param i The row index of the element.
+// \param j The column index of the element.
+// \param value The value to be assigned.
+// \return void
+// \exception std::invalid_argument Invalid assignment to element outside of the band.
+//
+// This function is used by the PackedProxy to set an element of the matrix. The attempt to
+// assign a non-default value to an element outside of the band results in a
+// \a std::invalid_argument exception.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void BandMatrix<Type,SO>::set( size_t i, size_t j, const Type& value )
+{
+   if( inBand( i, j ) ) {
+      v_[index(i,j)] = value;
+   }
+   else if( !isDefault( value ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid assignment to element outside of the band" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Extends the given bandwidth to contain all non-default elements of a dense matrix.
+//
+// \param m The dense matrix to be inspected.
+// \param kl The number of subdiagonals to be extended.
+// \param ku The number of superdiagonals to be extended.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the dense matrix
+        , bool SO2 >     // Storage order of the dense matrix
+inline void BandMatrix<Type,SO>::detectBandwidth( const DenseMatrix<MT,SO2>& m, size_t& kl, size_t& ku )
+{
+   const size_t M( ( SO2 )?( (~m).columns() ):( (~m).rows() ) );
+   const size_t N( ( SO2 )?( (~m).rows() ):( (~m).columns() ) );
+
+   for( size_t k=0UL; k<M; ++k ) {
+      for( size_t l=0UL; l<N; ++l )
+      {
+         const size_t i( ( SO2 )?( l ):( k ) );
+         const size_t j( ( SO2 )?( k ):( l ) );
+
+         if( !isDefault( (~m)(i,j) ) ) {
+            if( i > j ) kl = max( kl, i-j );
+            else        ku = max( ku, j-i );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Extends the given bandwidth to contain all non-default elements of a sparse matrix.
+//
+// \param m The sparse matrix to be inspected.
+// \param kl The number of subdiagonals to be extended.
+// \param ku The number of superdiagonals to be extended.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the sparse matrix
+        , bool SO2 >     // Storage order of the sparse matrix
+inline void BandMatrix<Type,SO>::detectBandwidth( const SparseMatrix<MT,SO2>& m, size_t& kl, size_t& ku )
+{
+   const size_t M( ( SO2 )?( (~m).columns() ):( (~m).rows() ) );
+
+   for( size_t k=0UL; k<M; ++k ) {
+      for( auto element=(~m).begin(k); element!=(~m).end(k); ++element )
+      {
+         const size_t i( ( SO2 )?( element->index() ):( k ) );
+         const size_t j( ( SO2 )?( k ):( element->index() ) );
+
+         if( !isDefault( element->value() ) ) {
+            if( i > j ) kl = max( kl, i-j );
+            else        ku = max( ku, j-i );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Extends the given bandwidth to contain the band of the given band matrix.
+//
+// \param m The band matrix to be inspected.
+// \param kl The number of subdiagonals to be extended.
+// \param ku The number of superdiagonals to be extended.
+// \return void
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO >       // Storage order
+template< typename Other  // Data type of the band matrix
+        , bool SO2 >      // Storage order of the band matrix
+inline void BandMatrix<Type,SO>::detectBandwidth( const BandMatrix<Other,SO2>& m, size_t& kl, size_t& ku ) noexcept
+{
+   kl = max( kl, m.kl_ );
+   ku = max( ku, m.ku_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NUMERIC FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief In-place transpose of the matrix.
+//
+// \return Reference to the transposed matrix.
+//
+// The transpose of a band matrix with \a kl subdiagonals and \a ku superdiagonals is a band
+// matrix with \a ku subdiagonals and \a kl superdiagonals.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline BandMatrix<Type,SO>& BandMatrix<Type,SO>::transpose()
+{
+   BandMatrix tmp( n_, m_, ku_, kl_ );
+
+   for( size_t k=0UL; k<lines(); ++k ) {
+      for( size_t l=bandBegin(k); l<bandEnd(k); ++l ) {
+         const size_t i( ( SO )?( l ):( k ) );
+         const size_t j( ( SO )?( k ):( l ) );
+         tmp.v_[tmp.index(j,i)] = v_[index(i,j)];
+      }
+   }
+
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place conjugate transpose of the matrix.
+//
+// \return Reference to the transposed matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline BandMatrix<Type,SO>& BandMatrix<Type,SO>::ctranspose()
+{
+   BandMatrix tmp( n_, m_, ku_, kl_ );
+
+   for( size_t k=0UL; k<lines(); ++k ) {
+      for( size_t l=bandBegin(k); l<bandEnd(k); ++l ) {
+         const size_t i( ( SO )?( l ):( k ) );
+         const size_t j( ( SO )?( k ):( l ) );
+         tmp.v_[tmp.index(j,i)] = conj( v_[index(i,j)] );
+      }
+   }
+
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scaling of the matrix by the scalar value \a scalar (\f$ A=B*s \f$).
+//
+// \param scalar The scalar value for the matrix scaling.
+// \return Reference to the matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the scalar value
+inline BandMatrix<Type,SO>& BandMatrix<Type,SO>::scale( const Other& scalar )
+{
+   const size_t nnz( lines() * spacing() );
+
+   for( size_t k=0UL; k<nnz; ++k ) {
+      v_[k] *= scalar;
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEBUGGING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the band matrix are intact.
+//
+// \return \a true in case the band matrix's invariants are intact, \a false otherwise.
+//
+// This function checks whether the invariants of the band matrix are intact, i.e. if its
+// state is valid. In case the invariants are intact, the function returns \a true, else it
+// will return \a false.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline bool BandMatrix<Type,SO>::isIntact() const noexcept
+{
+   if( lines() > 0UL && lines() * spacing() > capacity_ )
+      return false;
+
+   return true;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the foreign expression
+inline bool BandMatrix<Type,SO>::canAlias( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the foreign expression
+inline bool BandMatrix<Type,SO>::isAliased( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is properly aligned in memory.
+//
+// \return \a true in case the matrix is aligned, \a false if not.
+//
+// Since the rows/columns of the band storage do not start at fixed offsets, a band matrix is
+// never considered to be aligned.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline bool BandMatrix<Type,SO>::isAligned() const noexcept
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a false.
+//
+// Since the assignment to a band matrix may change its bandwidth, a band matrix cannot be
+// used in SMP assignments.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline bool BandMatrix<Type,SO>::canSMPAssign() const noexcept
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator. Note that only the elements within the band are assigned.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline void BandMatrix<Type,SO>::assign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t k=0UL; k<lines(); ++k ) {
+      Type* BLAZE_RESTRICT p( data(k) - bandBegin(k) );
+      for( size_t l=bandBegin(k); l<bandEnd(k); ++l ) {
+         p[l] = ( SO )?( (~rhs)(l,k) ):( (~rhs)(k,l) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator. Note that only the elements within the band are assigned.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side sparse matrix
+        , bool SO2 >     // Storage order of the right-hand side sparse matrix
+inline void BandMatrix<Type,SO>::assign( const SparseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   reset();
+
+   const size_t M( ( SO2 )?( n_ ):( m_ ) );
+
+   for( size_t k=0UL; k<M; ++k ) {
+      for( auto element=(~rhs).begin(k); element!=(~rhs).end(k); ++element ) {
+         const size_t i( ( SO2 )?( element->index() ):( k ) );
+         const size_t j( ( SO2 )?( k ):( element->index() ) );
+         if( inBand( i, j ) )
+            v_[index(i,j)] = element->value();
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Optimized implementation of the assignment of a band matrix.
+//
+// \param rhs The right-hand side band matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator. The band of the right-hand side matrix is required to be contained in
+// the band of this matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the right-hand side band matrix
+inline void BandMatrix<Type,SO>::assign( const BandMatrix<Other,SO>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == rhs.rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == rhs.columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( kl_ >= rhs.kl_ && ku_ >= rhs.ku_, "Invalid bandwidth" );
+
+   for( size_t k=0UL; k<lines(); ++k )
+   {
+      const size_t begin( rhs.bandBegin(k) );
+      const size_t end  ( rhs.bandEnd(k) );
+
+      Type* BLAZE_RESTRICT p( data(k) - bandBegin(k) );
+      const Other* BLAZE_RESTRICT q( rhs.data(k) - begin );
+
+      for( size_t l=bandBegin(k); l<begin; ++l )
+         p[l] = Type();
+      for( size_t l=begin; l<end; ++l )
+         p[l] = q[l];
+      for( size_t l=end; l<bandEnd(k); ++l )
+         p[l] = Type();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator. Note that only the elements within the band are updated.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline void BandMatrix<Type,SO>::addAssign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t k=0UL; k<lines(); ++k ) {
+      Type* BLAZE_RESTRICT p( data(k) - bandBegin(k) );
+      for( size_t l=bandBegin(k); l<bandEnd(k); ++l ) {
+         p[l] += ( SO )?( (~rhs)(l,k) ):( (~rhs)(k,l) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator. Note that only the elements within the band are updated.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side sparse matrix
+        , bool SO2 >     // Storage order of the right-hand side sparse matrix
+inline void BandMatrix<Type,SO>::addAssign( const SparseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   const size_t M( ( SO2 )?( n_ ):( m_ ) );
+
+   for( size_t k=0UL; k<M; ++k ) {
+      for( auto element=(~rhs).begin(k); element!=(~rhs).end(k); ++element ) {
+         const size_t i( ( SO2 )?( element->index() ):( k ) );
+         const size_t j( ( SO2 )?( k ):( element->index() ) );
+         if( inBand( i, j ) )
+            v_[index(i,j)] += element->value();
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Optimized implementation of the addition assignment of a band matrix.
+//
+// \param rhs The right-hand side band matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator. The band of the right-hand side matrix is required to be contained in
+// the band of this matrix. Since the band of each row/column is stored contiguously in both
+// matrices, the addition is performed by means of a single vectorizable loop per row/column.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the right-hand side band matrix
+inline void BandMatrix<Type,SO>::addAssign( const BandMatrix<Other,SO>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == rhs.rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == rhs.columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( kl_ >= rhs.kl_ && ku_ >= rhs.ku_, "Invalid bandwidth" );
+
+   for( size_t k=0UL; k<lines(); ++k )
+   {
+      const size_t len( rhs.bandEnd(k) - rhs.bandBegin(k) );
+
+      Type* BLAZE_RESTRICT p( data(k) + ( rhs.bandBegin(k) - bandBegin(k) ) );
+      const Other* BLAZE_RESTRICT q( rhs.data(k) );
+
+      for( size_t l=0UL; l<len; ++l )
+         p[l] += q[l];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator. Note that only the elements within the band are updated.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline void BandMatrix<Type,SO>::subAssign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t k=0UL; k<lines(); ++k ) {
+      Type* BLAZE_RESTRICT p( data(k) - bandBegin(k) );
+      for( size_t l=bandBegin(k); l<bandEnd(k); ++l ) {
+         p[l] -= ( SO )?( (~rhs)(l,k) ):( (~rhs)(k,l) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator. Note that only the elements within the band are updated.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side sparse matrix
+        , bool SO2 >     // Storage order of the right-hand side sparse matrix
+inline void BandMatrix<Type,SO>::subAssign( const SparseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   const size_t M( ( SO2 )?( n_ ):( m_ ) );
+
+   for( size_t k=0UL; k<M; ++k ) {
+      for( auto element=(~rhs).begin(k); element!=(~rhs).end(k); ++element ) {
+         const size_t i( ( SO2 )?( element->index() ):( k ) );
+         const size_t j( ( SO2 )?( k ):( element->index() ) );
+         if( inBand( i, j ) )
+            v_[index(i,j)] -= element->value();
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Optimized implementation of the subtraction assignment of a band matrix.
+//
+// \param rhs The right-hand side band matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator. The band of the right-hand side matrix is required to be contained in
+// the band of this matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the right-hand side band matrix
+inline void BandMatrix<Type,SO>::subAssign( const BandMatrix<Other,SO>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == rhs.rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == rhs.columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( kl_ >= rhs.kl_ && ku_ >= rhs.ku_, "Invalid bandwidth" );
+
+   for( size_t k=0UL; k<lines(); ++k )
+   {
+      const size_t len( rhs.bandEnd(k) - rhs.bandBegin(k) );
+
+      Type* BLAZE_RESTRICT p( data(k) + ( rhs.bandBegin(k) - bandBegin(k) ) );
+      const Other* BLAZE_RESTRICT q( rhs.data(k) );
+
+      for( size_t l=0UL; l<len; ++l )
+         p[l] -= q[l];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the Schur product assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix for the Schur product.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline void BandMatrix<Type,SO>::schurAssign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t k=0UL; k<lines(); ++k ) {
+      Type* BLAZE_RESTRICT p( data(k) - bandBegin(k) );
+      for( size_t l=bandBegin(k); l<bandEnd(k); ++l ) {
+         p[l] *= ( SO )?( (~rhs)(l,k) ):( (~rhs)(k,l) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the Schur product assignment of a sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix for the Schur product.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side sparse matrix
+        , bool SO2 >     // Storage order of the right-hand side sparse matrix
+inline void BandMatrix<Type,SO>::schurAssign( const SparseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   const BandMatrix tmp( *this );
+
+   reset();
+
+   const size_t M( ( SO2 )?( n_ ):( m_ ) );
+
+   for( size_t k=0UL; k<M; ++k ) {
+      for( auto element=(~rhs).begin(k); element!=(~rhs).end(k); ++element ) {
+         const size_t i( ( SO2 )?( element->index() ):( k ) );
+         const size_t j( ( SO2 )?( k ):( element->index() ) );
+         if( inBand( i, j ) )
+            v_[index(i,j)] = tmp.v_[index(i,j)] * element->value();
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BANDMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name BandMatrix operators */
+//@{
+template< typename Type, bool SO >
+void reset( BandMatrix<Type,SO>& m );
+
+template< typename Type, bool SO >
+void reset( BandMatrix<Type,SO>& m, size_t i );
+
+template< typename Type, bool SO >
+void clear( BandMatrix<Type,SO>& m );
+
+template< RelaxationFlag RF, typename Type, bool SO >
+bool isDefault( const BandMatrix<Type,SO>& m );
+
+template< typename Type, bool SO >
+bool isIntact( const BandMatrix<Type,SO>& m ) noexcept;
+
+template< typename Type, bool SO >
+void swap( BandMatrix<Type,SO>& a, BandMatrix<Type,SO>& b ) noexcept;
+
+template< typename Type, bool SO, typename VT >
+const MultTrait_t< BandMatrix<Type,SO>, VT >
+   operator*( const BandMatrix<Type,SO>& mat, const DenseVector<VT,false>& vec );
+
+template< typename Type, bool SO, typename MT, bool SO2 >
+const MultTrait_t< BandMatrix<Type,SO>, MT >
+   operator*( const BandMatrix<Type,SO>& lhs, const DenseMatrix<MT,SO2>& rhs );
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+const BandMatrix< MultTrait_t<T1,T2>, SO1 >
+   operator*( const BandMatrix<T1,SO1>& lhs, const BandMatrix<T2,SO2>& rhs );
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+const BandMatrix< AddTrait_t<T1,T2>, SO1 >
+   operator+( const BandMatrix<T1,SO1>& lhs, const BandMatrix<T2,SO2>& rhs );
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+const BandMatrix< SubTrait_t<T1,T2>, SO1 >
+   operator-( const BandMatrix<T1,SO1>& lhs, const BandMatrix<T2,SO2>& rhs );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given band matrix.
+// \ingroup band_matrix
+//
+// \param m The matrix to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void reset( BandMatrix<Type,SO>& m )
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row/column of the given band matrix.
+// \ingroup band_matrix
+//
+// \param m The matrix to be resetted.
+// \param i The index of the row/column to be resetted.
+// \return void
+//
+// This function resets the values in the specified row/column of the given band matrix to
+// their default value. In case the given matrix is a \a rowMajor matrix the function resets
+// the values in row \a i, if it is a \a columnMajor matrix the function resets the values in
+// column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void reset( BandMatrix<Type,SO>& m, size_t i )
+{
+   m.reset( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given band matrix.
+// \ingroup band_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void clear( BandMatrix<Type,SO>& m )
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given band matrix is in default state.
+// \ingroup band_matrix
+//
+// \param m The matrix to be tested for its default state.
+// \return \a true in case the given matrix's rows and columns are zero, \a false otherwise.
+//
+// This function checks whether the band matrix is in default (constructed) state, i.e. if
+// it's number of rows and columns is 0. In case it is in default state, the function returns
+// \a true, else it will return \a false.
+*/
+template< RelaxationFlag RF  // Relaxation flag
+        , typename Type      // Data type of the matrix
+        , bool SO >          // Storage order
+inline bool isDefault( const BandMatrix<Type,SO>& m )
+{
+   return ( m.rows() == 0UL && m.columns() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the given band matrix are intact.
+// \ingroup band_matrix
+//
+// \param m The band matrix to be tested.
+// \return \a true in case the given matrix's invariants are intact, \a false otherwise.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline bool isIntact( const BandMatrix<Type,SO>& m ) noexcept
+{
+   return m.isIntact();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two band matrices.
+// \ingroup band_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void swap( BandMatrix<Type,SO>& a, BandMatrix<Type,SO>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a band matrix and a dense vector
+//        (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup band_matrix
+//
+// \param mat The left-hand side band matrix for the multiplication.
+// \param vec The right-hand side dense vector for the multiplication.
+// \return The resulting vector.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This operator computes the product of a band matrix and a dense vector by means of a
+// dedicated kernel that traverses only the band of the matrix (see bmatdvecmult()). In
+// contrast to the general multiplication operator, the product is evaluated immediately.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename VT >  // Type of the right-hand side dense vector
+inline const MultTrait_t< BandMatrix<Type,SO>, VT >
+   operator*( const BandMatrix<Type,SO>& mat, const DenseVector<VT,false>& vec )
+{
+   using RT = MultTrait_t< BandMatrix<Type,SO>, VT >;
+
+   BLAZE_FUNCTION_TRACE;
+
+   if( mat.columns() != (~vec).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix and vector sizes do not match" );
+   }
+
+   return bmatdvecmult<RT>( mat, ~vec );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a band matrix and a dense matrix
+//        (\f$ C=A*B \f$).
+// \ingroup band_matrix
+//
+// \param lhs The left-hand side band matrix for the multiplication.
+// \param rhs The right-hand side dense matrix for the multiplication.
+// \return The resulting matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This operator computes the product of a band matrix and a dense matrix by means of a
+// dedicated kernel that traverses only the band of the matrix (see bmatdmatmult()). In
+// contrast to the general multiplication operator, the product is evaluated immediately.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline const MultTrait_t< BandMatrix<Type,SO>, MT >
+   operator*( const BandMatrix<Type,SO>& lhs, const DenseMatrix<MT,SO2>& rhs )
+{
+   using RT = MultTrait_t< BandMatrix<Type,SO>, MT >;
+
+   BLAZE_FUNCTION_TRACE;
+
+   if( lhs.columns() != (~rhs).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   return bmatdmatmult<RT>( lhs, ~rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of two band matrices
+//        (\f$ C=A*B \f$).
+// \ingroup band_matrix
+//
+// \param lhs The left-hand side band matrix for the multiplication.
+// \param rhs The right-hand side band matrix for the multiplication.
+// \return The resulting band matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This operator computes the product of two band matrices by means of a dedicated kernel that
+// traverses only the bands of the two matrices (see bmatbmatmult()). The result is a band
+// matrix, whose lower and upper bandwidth is the sum of the lower and upper bandwidths of the
+// two operands, respectively.
+*/
+template< typename T1  // Data type of the left-hand side band matrix
+        , bool SO1     // Storage order of the left-hand side band matrix
+        , typename T2  // Data type of the right-hand side band matrix
+        , bool SO2 >   // Storage order of the right-hand side band matrix
+inline const BandMatrix< MultTrait_t<T1,T2>, SO1 >
+   operator*( const BandMatrix<T1,SO1>& lhs, const BandMatrix<T2,SO2>& rhs )
+{
+   using RT = BandMatrix< MultTrait_t<T1,T2>, SO1 >;
+
+   BLAZE_FUNCTION_TRACE;
+
+   if( lhs.columns() != rhs.rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   return bmatbmatmult<RT>( lhs, rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition operator for the addition of two band matrices (\f$ C=A+B \f$).
+// \ingroup band_matrix
+//
+// \param lhs The left-hand side band matrix for the matrix addition.
+// \param rhs The right-hand side band matrix for the matrix addition.
+// \return The resulting band matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This operator computes the sum of two band matrices. The band of the result is the union of
+// the bands of the two operands. In contrast to the general addition operator, the sum is
+// evaluated immediately by means of contiguous updates of the bands.
+*/
+template< typename T1  // Data type of the left-hand side band matrix
+        , bool SO1     // Storage order of the left-hand side band matrix
+        , typename T2  // Data type of the right-hand side band matrix
+        , bool SO2 >   // Storage order of the right-hand side band matrix
+inline const BandMatrix< AddTrait_t<T1,T2>, SO1 >
+   operator+( const BandMatrix<T1,SO1>& lhs, const BandMatrix<T2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( lhs.rows() != rhs.rows() || lhs.columns() != rhs.columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   BandMatrix< AddTrait_t<T1,T2>, SO1 > tmp( lhs );
+   tmp += rhs;
+   return tmp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction operator for the subtraction of two band matrices (\f$ C=A-B \f$).
+// \ingroup band_matrix
+//
+// \param lhs The left-hand side band matrix for the matrix subtraction.
+// \param rhs The right-hand side band matrix to be subtracted from the matrix.
+// \return The resulting band matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This operator computes the difference of two band matrices. The band of the result is the
+// union of the bands of the two operands. In contrast to the general subtraction operator, the
+// difference is evaluated immediately by means of contiguous updates of the bands.
+*/
+template< typename T1  // Data type of the left-hand side band matrix
+        , bool SO1     // Storage order of the left-hand side band matrix
+        , typename T2  // Data type of the right-hand side band matrix
+        , bool SO2 >   // Storage order of the right-hand side band matrix
+inline const BandMatrix< SubTrait_t<T1,T2>, SO1 >
+   operator-( const BandMatrix<T1,SO1>& lhs, const BandMatrix<T2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( lhs.rows() != rhs.rows() || lhs.columns() != rhs.columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   BandMatrix< SubTrait_t<T1,T2>, SO1 > tmp( lhs );
+   tmp -= rhs;
+   return tmp;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISRESIZABLE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO >
+struct IsResizable< BandMatrix<T,SO> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISSHRINKABLE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO >
+struct IsShrinkable< BandMatrix<T,SO> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
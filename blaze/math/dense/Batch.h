@@ -0,0 +1,1383 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/Batch.h
+//  \brief Header file for the batched operations on small dense matrices
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_BATCH_H_
+#define _BLAZE_MATH_DENSE_BATCH_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/DenseMatrix.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/Inversion.h>
+#include <blaze/math/dense/LSE.h>
+#include <blaze/math/dense/PackingArena.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/shims/IsDivisor.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/typetraits/HasSIMDAdd.h>
+#include <blaze/math/typetraits/HasSIMDDiv.h>
+#include <blaze/math/typetraits/HasSIMDMult.h>
+#include <blaze/math/typetraits/HasSIMDSub.h>
+#include <blaze/math/typetraits/IsAdaptor.h>
+#include <blaze/math/typetraits/IsContiguous.h>
+#include <blaze/math/typetraits/IsDenseMatrix.h>
+#include <blaze/math/typetraits/IsDenseVector.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/math/typetraits/Size.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsFloatingPoint.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/RemoveCVRef.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  AUXILIARY TYPE TRAITS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary alias declaration for the element type of a batch.
+// \ingroup dense_matrix
+//
+// The BatchElement_t alias declaration evaluates to the type of the elements (i.e. the matrices
+// or vectors) stored in the given batch container type \a CT.
+*/
+template< typename CT >  // Type of the batch container
+using BatchElement_t = RemoveCVRef_t< decltype( std::declval<CT&>()[0UL] ) >;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary alias declaration for the type of a dimension of a batch element.
+// \ingroup dense_matrix
+//
+// In case the \a N-th dimension of the given matrix or vector type \a T is known at compile
+// time, the BatchDimension_t alias declaration evaluates to the according Size_t integral
+// constant. Otherwise it evaluates to \c size_t. This enables the compact batch kernels to
+// completely unroll all loops for fixed size matrices, as for instance StaticMatrix.
+*/
+template< typename T, size_t N >
+using BatchDimension_t = If_t< ( Size_v<T,N> != DefaultSize_v )
+                             , Size_t< static_cast<size_t>( Size_v<T,N> ) >
+                             , size_t >;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary alias declaration for the type of the number of rows of a batch element.
+// \ingroup dense_matrix
+*/
+template< typename T >
+using BatchRows_t = BatchDimension_t<T,0UL>;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary alias declaration for the type of the number of columns of a batch element.
+// \ingroup dense_matrix
+//
+// Within a batch, a dense vector is treated as a matrix with a single column.
+*/
+template< typename T >
+using BatchColumns_t = If_t< IsDenseVector_v<T>, Size_t<1UL>, BatchDimension_t<T,1UL> >;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary variable template for the selection of the compact batch kernels.
+// \ingroup dense_matrix
+//
+// This variable template evaluates to \a true in case the given type \a T is a contiguous,
+// non-adaptor dense matrix or dense vector type with floating point elements that support
+// vectorized addition, subtraction, multiplication, and division. Otherwise it evaluates to
+// \a false.
+*/
+template< typename T >
+constexpr bool IsCompactBatchType_v =
+   ( ( IsDenseMatrix_v<T> || IsDenseVector_v<T> ) && IsContiguous_v<T> && !IsAdaptor_v<T> &&
+     IsFloatingPoint_v< ElementType_t<T> > &&
+     HasSIMDAdd_v < ElementType_t<T>, ElementType_t<T> > &&
+     HasSIMDSub_v < ElementType_t<T>, ElementType_t<T> > &&
+     HasSIMDMult_v< ElementType_t<T>, ElementType_t<T> > &&
+     HasSIMDDiv_v < ElementType_t<T>, ElementType_t<T> > );
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary variable template for the selection of the compact batch kernels.
+// \ingroup dense_matrix
+//
+// This variable template evaluates to \a true in case both given types are compact batch types
+// (see IsCompactBatchType_v) with the same element type. In this case a batched operation on
+// the two types is performed by means of the compact, SIMD-interleaved batch kernels.
+*/
+template< typename T1, typename T2 >
+constexpr bool UseCompactBatch_v =
+   ( IsCompactBatchType_v<T1> && IsCompactBatchType_v<T2> &&
+     IsSame_v< ElementType_t<T1>, ElementType_t<T2> > );
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  AUXILIARY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of rows of a dense matrix within a batch.
+// \ingroup dense_matrix
+//
+// \param dm The dense matrix.
+// \return The number of rows of the matrix.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline size_t batchRows( const DenseMatrix<MT,SO>& dm ) noexcept
+{
+   return (~dm).rows();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of rows of a dense vector within a batch.
+// \ingroup dense_matrix
+//
+// \param dv The dense vector.
+// \return The size of the vector.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag of the dense vector
+inline size_t batchRows( const DenseVector<VT,TF>& dv ) noexcept
+{
+   return (~dv).size();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of columns of a dense matrix within a batch.
+// \ingroup dense_matrix
+//
+// \param dm The dense matrix.
+// \return The number of columns of the matrix.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline size_t batchColumns( const DenseMatrix<MT,SO>& dm ) noexcept
+{
+   return (~dm).columns();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of columns of a dense vector within a batch.
+// \ingroup dense_matrix
+//
+// \param dv The dense vector.
+// \return 1.
+//
+// Within a batch, a dense vector is treated as a matrix with a single column.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag of the dense vector
+inline size_t batchColumns( const DenseVector<VT,TF>& dv ) noexcept
+{
+   MAYBE_UNUSED( dv );
+
+   return 1UL;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Converts a runtime dimension of a batch element into the given dimension type.
+// \ingroup dense_matrix
+//
+// \param n The runtime dimension.
+// \return The dimension as \c size_t value.
+*/
+template< typename D >  // Type of the dimension
+inline auto batchDimension( size_t n ) noexcept
+   -> EnableIf_t< IsSame_v<D,size_t>, D >
+{
+   return n;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Converts a runtime dimension of a batch element into the given dimension type.
+// \ingroup dense_matrix
+//
+// \param n The runtime dimension.
+// \return The dimension as compile time integral constant.
+*/
+template< typename D >  // Type of the dimension
+inline auto batchDimension( size_t n ) noexcept
+   -> DisableIf_t< IsSame_v<D,size_t>, D >
+{
+   MAYBE_UNUSED( n );
+
+   BLAZE_INTERNAL_ASSERT( n == D::value, "Invalid compile time dimension detected" );
+
+   return D();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Resizing a dense matrix within a batch.
+// \ingroup dense_matrix
+//
+// \param dm The dense matrix to be resized.
+// \param m The new number of rows.
+// \param n The new number of columns.
+// \return void
+// \exception std::invalid_argument Invalid resize arguments for fixed size matrix.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline void batchResize( DenseMatrix<MT,SO>& dm, size_t m, size_t n )
+{
+   resize( ~dm, m, n, false );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Resizing a dense vector within a batch.
+// \ingroup dense_matrix
+//
+// \param dv The dense vector to be resized.
+// \param m The new size of the vector.
+// \param n The new number of columns (must be 1).
+// \return void
+// \exception std::invalid_argument Invalid resize arguments for fixed size vector.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag of the dense vector
+inline void batchResize( DenseVector<VT,TF>& dv, size_t m, size_t n )
+{
+   MAYBE_UNUSED( n );
+
+   BLAZE_INTERNAL_ASSERT( n == 1UL, "Invalid number of columns detected" );
+
+   resize( ~dv, m, false );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the resizing of a resizable batch container.
+// \ingroup dense_matrix
+//
+// \param batch The batch container to be resized.
+// \param count The new number of elements in the batch.
+// \return void
+//
+// This overload is selected for all batch containers providing a \c resize() member function
+// (as for instance \c std::vector or DynamicVector).
+*/
+template< typename CT >  // Type of the batch container
+inline auto resizeBatchBackend( CT& batch, size_t count, int )
+   -> decltype( batch.resize( count ), void() )
+{
+   if( batch.size() != count ) {
+      batch.resize( count );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the resizing of a fixed size batch container.
+// \ingroup dense_matrix
+//
+// \param batch The batch container to be resized.
+// \param count The new number of elements in the batch.
+// \return void
+// \exception std::invalid_argument Invalid batch sizes.
+//
+// This overload is selected for all batch containers without \c resize() member function (as
+// for instance \c std::array). Since the size of the batch cannot be adapted, a
+// \a std::invalid_argument exception is thrown in case the size does not match.
+*/
+template< typename CT >  // Type of the batch container
+inline void resizeBatchBackend( CT& batch, size_t count, long )
+{
+   if( batch.size() != count ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid batch sizes" );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Resizing a batch container to the given number of elements.
+// \ingroup dense_matrix
+//
+// \param batch The batch container to be resized.
+// \param count The new number of elements in the batch.
+// \return void
+// \exception std::invalid_argument Invalid batch sizes.
+*/
+template< typename CT >  // Type of the batch container
+inline void resizeBatch( CT& batch, size_t count )
+{
+   resizeBatchBackend( batch, count, 0 );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the memory offset of an element of a dense matrix within a batch.
+// \ingroup dense_matrix
+//
+// \param dm The dense matrix.
+// \param i The row index of the element.
+// \param j The column index of the element.
+// \return The offset of the element relative to the first element of the matrix.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline size_t batchOffset( const DenseMatrix<MT,SO>& dm, size_t i, size_t j ) noexcept
+{
+   return ( SO == rowMajor )?( i*(~dm).spacing() + j ):( j*(~dm).spacing() + i );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the memory offset of an element of a dense vector within a batch.
+// \ingroup dense_matrix
+//
+// \param dv The dense vector.
+// \param i The index of the element.
+// \param j The column index of the element (must be 0).
+// \return The offset of the element relative to the first element of the vector.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag of the dense vector
+inline size_t batchOffset( const DenseVector<VT,TF>& dv, size_t i, size_t j ) noexcept
+{
+   MAYBE_UNUSED( dv, j );
+
+   BLAZE_INTERNAL_ASSERT( j == 0UL, "Invalid column index detected" );
+
+   return i;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Gathers a group of matrices or vectors of a batch into the compact batch layout.
+// \ingroup dense_matrix
+//
+// \param buffer The target buffer in compact batch layout.
+// \param batch The batch container.
+// \param first The index of the first element of the group.
+// \param lanes The number of elements in the group \f$ [1..SIMDSIZE] \f$.
+// \param m The number of rows of each element.
+// \param n The number of columns of each element.
+// \param identity \a true to pad the unused lanes with the identity matrix, \a false for zeros.
+// \return void
+//
+// In the compact batch layout, element \f$ (i,j) \f$ of the \f$ l \f$-th matrix of the group is
+// stored at position \f$ (i*n+j)*SIMDSIZE+l \f$ of the buffer. Thus each SIMD vector contains
+// the same element of \a SIMDSIZE different matrices, which allows to process a full group with
+// a single sequence of vectorized operations. Unused lanes of an incomplete group are padded.
+*/
+template< typename Type  // Type of the buffer elements
+        , typename CT    // Type of the batch container
+        , typename MD    // Type of the number of rows
+        , typename ND >  // Type of the number of columns
+void batchGather( Type* buffer, const CT& batch, size_t first, size_t lanes,
+                  MD m, ND n, bool identity )
+{
+   constexpr size_t SIMDSIZE( SIMDTrait<Type>::size );
+
+   BLAZE_INTERNAL_ASSERT( lanes > 0UL && lanes <= SIMDSIZE, "Invalid number of lanes detected" );
+
+   const Type* data[SIMDSIZE];
+
+   for( size_t l=0UL; l<lanes; ++l ) {
+      data[l] = batch[first+l].data();
+   }
+
+   for( size_t i=0UL; i<m; ++i ) {
+      for( size_t j=0UL; j<n; ++j )
+      {
+         const size_t offset( batchOffset( batch[first], i, j ) );
+         Type* b( buffer + (i*n+j)*SIMDSIZE );
+
+         if( lanes == SIMDSIZE ) {
+            for( size_t l=0UL; l<SIMDSIZE; ++l ) {
+               b[l] = data[l][offset];
+            }
+            continue;
+         }
+
+         for( size_t l=0UL; l<lanes; ++l ) {
+            b[l] = data[l][offset];
+         }
+         for( size_t l=lanes; l<SIMDSIZE; ++l ) {
+            b[l] = ( identity && i == j ? Type(1) : Type(0) );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scatters a group of matrices or vectors from the compact batch layout into a batch.
+// \ingroup dense_matrix
+//
+// \param batch The target batch container.
+// \param buffer The source buffer in compact batch layout.
+// \param first The index of the first element of the group.
+// \param lanes The number of elements in the group \f$ [1..SIMDSIZE] \f$.
+// \param m The number of rows of each element.
+// \param n The number of columns of each element.
+// \param skip Bit mask of the lanes that must not be written (may be 0).
+// \return void
+*/
+template< typename CT    // Type of the batch container
+        , typename Type  // Type of the buffer elements
+        , typename MD    // Type of the number of rows
+        , typename ND >  // Type of the number of columns
+void batchScatter( CT& batch, const Type* buffer, size_t first, size_t lanes,
+                   MD m, ND n, size_t skip )
+{
+   constexpr size_t SIMDSIZE( SIMDTrait<Type>::size );
+
+   BLAZE_INTERNAL_ASSERT( lanes > 0UL && lanes <= SIMDSIZE, "Invalid number of lanes detected" );
+
+   Type* data[SIMDSIZE];
+
+   for( size_t l=0UL; l<lanes; ++l ) {
+      data[l] = ( skip & ( 1UL << l ) )?( nullptr ):( batch[first+l].data() );
+   }
+
+   for( size_t i=0UL; i<m; ++i ) {
+      for( size_t j=0UL; j<n; ++j )
+      {
+         const size_t offset( batchOffset( batch[first], i, j ) );
+         const Type* b( buffer + (i*n+j)*SIMDSIZE );
+
+         if( lanes == SIMDSIZE && skip == 0UL ) {
+            for( size_t l=0UL; l<SIMDSIZE; ++l ) {
+               data[l][offset] = b[l];
+            }
+            continue;
+         }
+
+         for( size_t l=0UL; l<lanes; ++l ) {
+            if( data[l] != nullptr ) {
+               data[l][offset] = b[l];
+            }
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the pivot tolerances of a group of square matrices in compact batch layout.
+// \ingroup dense_matrix
+//
+// \param tol The resulting pivot tolerance of each lane.
+// \param a The group of \f$ n \times n \f$ matrices in compact batch layout.
+// \param n The number of rows and columns of each matrix.
+// \return void
+//
+// The compact batch kernels do not perform any pivoting. Therefore the pivot of each lane is
+// compared to a tolerance relative to the largest absolute element of the according matrix.
+// Lanes with a pivot below this tolerance are recomputed by the pivoting default algorithms.
+*/
+template< typename Type  // Type of the matrix elements
+        , typename ND >  // Type of the number of rows and columns
+void batchTolerances( Type* tol, const Type* a, ND n )
+{
+   using std::abs;
+   using std::sqrt;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<Type>::size );
+
+   for( size_t l=0UL; l<SIMDSIZE; ++l ) {
+      tol[l] = Type(0);
+   }
+
+   for( size_t i=0UL; i<n*n; ++i ) {
+      for( size_t l=0UL; l<SIMDSIZE; ++l ) {
+         tol[l] = max( tol[l], abs( a[i*SIMDSIZE+l] ) );
+      }
+   }
+
+   const Type eps( sqrt( std::numeric_limits<Type>::epsilon() ) );
+
+   for( size_t l=0UL; l<SIMDSIZE; ++l ) {
+      tol[l] *= eps;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checks the pivots of a group of matrices in compact batch layout.
+// \ingroup dense_matrix
+//
+// \param pivot The SIMD vector of pivots.
+// \param tol The pivot tolerance of each lane.
+// \return Bit mask of all lanes with an insufficient pivot.
+*/
+template< typename Type >  // Type of the matrix elements
+inline size_t batchCheckPivots( const SIMDTrait_t<Type>& pivot, const Type* tol )
+{
+   using std::abs;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<Type>::size );
+
+   size_t failed( 0UL );
+
+   for( size_t l=0UL; l<SIMDSIZE; ++l ) {
+      const Type p( pivot[l] );
+      if( !isDivisor( p ) || !( abs( p ) > tol[l] ) ) {
+         failed |= ( 1UL << l );
+      }
+   }
+
+   return failed;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPACT BATCH KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compact batch kernel for the in-place inversion of a group of square dense matrices.
+// \ingroup dense_matrix
+//
+// \param a The group of \f$ n \times n \f$ matrices in compact batch layout.
+// \param n The number of rows and columns of each matrix.
+// \return Bit mask of all lanes that require pivoting.
+//
+// This kernel inverts all matrices of the group by means of a Gauss-Jordan elimination without
+// pivoting. The function returns the bit mask of all lanes that encountered a pivot below the
+// tolerance (see batchTolerances()). The results of these lanes are invalid and have to be
+// recomputed by the pivoting default inversion.
+*/
+template< typename Type  // Type of the matrix elements
+        , typename ND >  // Type of the number of rows and columns
+size_t batchInvertKernel( Type* a, ND n )
+{
+   using SIMDType = SIMDTrait_t<Type>;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<Type>::size );
+
+   Type tol[SIMDSIZE];
+   batchTolerances( tol, a, n );
+
+   const SIMDType zero;
+   const SIMDType one( set( Type(1) ) );
+
+   size_t failed( 0UL );
+
+   for( size_t k=0UL; k<n; ++k )
+   {
+      Type* ak( a + k*n*SIMDSIZE );
+
+      const SIMDType pivot( loada( ak + k*SIMDSIZE ) );
+      failed |= batchCheckPivots( pivot, tol );
+
+      const SIMDType inv( one / pivot );
+      storea( ak + k*SIMDSIZE, one );
+
+      for( size_t j=0UL; j<n; ++j ) {
+         storea( ak + j*SIMDSIZE, loada( ak + j*SIMDSIZE ) * inv );
+      }
+
+      for( size_t i=0UL; i<n; ++i )
+      {
+         if( i == k ) continue;
+
+         Type* ai( a + i*n*SIMDSIZE );
+
+         const SIMDType factor( loada( ai + k*SIMDSIZE ) );
+         storea( ai + k*SIMDSIZE, zero );
+
+         for( size_t j=0UL; j<n; ++j ) {
+            storea( ai + j*SIMDSIZE, loada( ai + j*SIMDSIZE ) - factor * loada( ak + j*SIMDSIZE ) );
+         }
+      }
+   }
+
+   return failed;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compact batch kernel for the solution of a group of linear systems of equations.
+// \ingroup dense_matrix
+//
+// \param a The group of \f$ n \times n \f$ system matrices in compact batch layout.
+// \param x The group of \f$ n \times r \f$ right-hand sides/solutions in compact batch layout.
+// \param n The number of rows and columns of each system matrix.
+// \param r The number of right-hand side vectors of each system.
+// \return Bit mask of all lanes that require pivoting.
+//
+// This kernel solves all linear systems of the group by means of an LU decomposition without
+// pivoting followed by a forward and backward substitution. The system matrices are destroyed
+// and the right-hand sides are replaced by the solutions. The function returns the bit mask of
+// all lanes that encountered a pivot below the tolerance (see batchTolerances()). The results
+// of these lanes are invalid and have to be recomputed by the pivoting default solver.
+*/
+template< typename Type  // Type of the matrix elements
+        , typename ND    // Type of the number of rows and columns of the system matrices
+        , typename RD >  // Type of the number of right-hand side vectors
+size_t batchSolveKernel( Type* a, Type* x, ND n, RD r )
+{
+   using SIMDType = SIMDTrait_t<Type>;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<Type>::size );
+
+   Type tol[SIMDSIZE];
+   batchTolerances( tol, a, n );
+
+   const SIMDType one( set( Type(1) ) );
+
+   size_t failed( 0UL );
+
+   for( size_t k=0UL; k<n; ++k )
+   {
+      Type* ak( a + k*n*SIMDSIZE );
+      Type* xk( x + k*r*SIMDSIZE );
+
+      const SIMDType pivot( loada( ak + k*SIMDSIZE ) );
+      failed |= batchCheckPivots( pivot, tol );
+
+      const SIMDType inv( one / pivot );
+
+      for( size_t j=k+1UL; j<n; ++j ) {
+         storea( ak + j*SIMDSIZE, loada( ak + j*SIMDSIZE ) * inv );
+      }
+      for( size_t j=0UL; j<r; ++j ) {
+         storea( xk + j*SIMDSIZE, loada( xk + j*SIMDSIZE ) * inv );
+      }
+
+      for( size_t i=k+1UL; i<n; ++i )
+      {
+         Type* ai( a + i*n*SIMDSIZE );
+         Type* xi( x + i*r*SIMDSIZE );
+
+         const SIMDType factor( loada( ai + k*SIMDSIZE ) );
+
+         for( size_t j=k+1UL; j<n; ++j ) {
+            storea( ai + j*SIMDSIZE, loada( ai + j*SIMDSIZE ) - factor * loada( ak + j*SIMDSIZE ) );
+         }
+         for( size_t j=0UL; j<r; ++j ) {
+            storea( xi + j*SIMDSIZE, loada( xi + j*SIMDSIZE ) - factor * loada( xk + j*SIMDSIZE ) );
+         }
+      }
+   }
+
+   for( size_t k=n; k-- > 1UL; )
+   {
+      const Type* xk( x + k*r*SIMDSIZE );
+
+      for( size_t i=0UL; i<k; ++i )
+      {
+         Type* xi( x + i*r*SIMDSIZE );
+
+         const SIMDType factor( loada( a + (i*n+k)*SIMDSIZE ) );
+
+         for( size_t j=0UL; j<r; ++j ) {
+            storea( xi + j*SIMDSIZE, loada( xi + j*SIMDSIZE ) - factor * loada( xk + j*SIMDSIZE ) );
+         }
+      }
+   }
+
+   return failed;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BACKEND FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Executes the given operation on all groups of a batch.
+// \ingroup dense_matrix
+//
+// \param count The total number of elements in the batch.
+// \param groups The total number of independent groups of the batch.
+// \param op The operation to be executed for a range of groups.
+// \return void
+//
+// In case the number of elements in the batch is larger or equal to the SMP batch threshold
+// (see the BLAZE_SMP_DMATBATCH_THRESHOLD configuration), the groups are distributed among the
+// threads of the active shared memory parallelization. Otherwise all groups are processed by
+// the calling thread.
+*/
+template< typename OP >  // Type of the group operation
+inline void batchExecute( size_t count, size_t groups, OP op )
+{
+   if( count >= SMP_DMATBATCH_THRESHOLD ) {
+      smpFor( groups, op );
+   }
+   else {
+      op( 0UL, groups );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the batched multiplication of SMP-assignable dense matrices.
+// \ingroup dense_matrix
+//
+// \param C The batch of result matrices.
+// \param A The batch of left-hand side matrices.
+// \param B The batch of right-hand side matrices.
+// \return void
+//
+// The products of the batch are computed one after another, since each individual assignment
+// may already be executed in parallel.
+*/
+template< typename CT1    // Type of the result batch
+        , typename CT2    // Type of the left-hand side batch
+        , typename CT3 >  // Type of the right-hand side batch
+inline auto batchMultBackend( CT1& C, const CT2& A, const CT3& B )
+   -> EnableIf_t< IsSMPAssignable_v< BatchElement_t<CT1> > >
+{
+   for( size_t i=0UL; i<A.size(); ++i ) {
+      C[i] = A[i] * B[i];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the batched multiplication of non-SMP-assignable dense matrices.
+// \ingroup dense_matrix
+//
+// \param C The batch of result matrices.
+// \param A The batch of left-hand side matrices.
+// \param B The batch of right-hand side matrices.
+// \return void
+//
+// The products of the batch are distributed among the threads of the active shared memory
+// parallelization. Each individual product is computed by the vectorized kernels of the
+// according matrix types.
+*/
+template< typename CT1    // Type of the result batch
+        , typename CT2    // Type of the left-hand side batch
+        , typename CT3 >  // Type of the right-hand side batch
+inline auto batchMultBackend( CT1& C, const CT2& A, const CT3& B )
+   -> DisableIf_t< IsSMPAssignable_v< BatchElement_t<CT1> > >
+{
+   const size_t count( A.size() );
+
+   batchExecute( count, count, [&C,&A,&B]( size_t begin, size_t end )
+   {
+      for( size_t i=begin; i<end; ++i ) {
+         C[i] = A[i] * B[i];
+      }
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default backend of the batched inversion of dense matrices.
+// \ingroup dense_matrix
+//
+// \param A The batch of matrices to be inverted.
+// \param n The number of rows and columns of the matrices.
+// \return void
+// \exception std::runtime_error Inversion of singular matrix failed.
+*/
+template< typename CT    // Type of the batch
+        , typename ND >  // Type of the number of rows and columns
+inline auto batchInvertBackend( CT& A, ND n )
+   -> DisableIf_t< UseCompactBatch_v< BatchElement_t<CT>, BatchElement_t<CT> > >
+{
+   MAYBE_UNUSED( n );
+
+   for( size_t i=0UL; i<A.size(); ++i ) {
+      invert( A[i] );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compact backend of the batched inversion of dense matrices.
+// \ingroup dense_matrix
+//
+// \param A The batch of matrices to be inverted.
+// \param n The number of rows and columns of the matrices.
+// \return void
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// All matrices that require pivoting are recomputed by the default inversion after the compact
+// kernels have processed the entire batch. Matrices smaller than 4x4 are directly inverted by
+// the closed-form kernels of the default inversion, which outperform the gather and scatter
+// operations of the compact layout for these sizes.
+*/
+template< typename CT    // Type of the batch
+        , typename ND >  // Type of the number of rows and columns
+inline auto batchInvertBackend( CT& A, ND n )
+   -> EnableIf_t< UseCompactBatch_v< BatchElement_t<CT>, BatchElement_t<CT> > >
+{
+   using Type = ElementType_t< BatchElement_t<CT> >;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<Type>::size );
+
+   const size_t count ( A.size() );
+   const size_t groups( ( count + SIMDSIZE - 1UL ) / SIMDSIZE );
+
+   if( n < 4UL ) {
+      for( size_t i=0UL; i<count; ++i ) {
+         invert( A[i] );
+      }
+      return;
+   }
+
+   std::unique_ptr<bool[]> failed( new bool[count]() );
+   bool* flags( failed.get() );
+
+   batchExecute( count, groups, [&A,n,count,flags]( size_t begin, size_t end )
+   {
+      DynamicMatrix<Type,rowMajor>& buffer(
+         PackingArena::instance().acquire<Type,rowMajor>( 1UL, n*n*SIMDSIZE ) );
+
+      Type* a( buffer.data() );
+
+      for( size_t g=begin; g<end; ++g )
+      {
+         const size_t first( g*SIMDSIZE );
+         const size_t lanes( min( count - first, size_t( SIMDSIZE ) ) );
+
+         batchGather( a, A, first, lanes, n, n, true );
+         const size_t mask( batchInvertKernel( a, n ) );
+         batchScatter( A, a, first, lanes, n, n, mask );
+
+         for( size_t l=0UL; l<lanes; ++l ) {
+            flags[first+l] = ( ( mask & ( 1UL << l ) ) != 0UL );
+         }
+      }
+   } );
+
+   for( size_t i=0UL; i<count; ++i ) {
+      if( flags[i] ) {
+         invert( A[i] );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default backend of the batched solution of linear systems of equations.
+// \ingroup dense_matrix
+//
+// \param A The batch of system matrices.
+// \param X The batch of solutions.
+// \param B The batch of right-hand sides.
+// \param n The number of rows and columns of the system matrices.
+// \param r The number of right-hand side vectors of each system.
+// \return void
+// \exception std::runtime_error Solving LSE with singular system matrix failed.
+*/
+template< typename CT1   // Type of the batch of system matrices
+        , typename CT2   // Type of the batch of solutions
+        , typename CT3   // Type of the batch of right-hand sides
+        , typename ND    // Type of the number of rows and columns of the system matrices
+        , typename RD >  // Type of the number of right-hand side vectors
+inline auto batchSolveBackend( const CT1& A, CT2& X, const CT3& B, ND n, RD r )
+   -> DisableIf_t< UseCompactBatch_v< BatchElement_t<CT1>, BatchElement_t<CT2> > &&
+                   UseCompactBatch_v< BatchElement_t<CT1>, BatchElement_t<CT3> > >
+{
+   MAYBE_UNUSED( n, r );
+
+   for( size_t i=0UL; i<A.size(); ++i ) {
+      solve( A[i], X[i], B[i] );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compact backend of the batched solution of linear systems of equations.
+// \ingroup dense_matrix
+//
+// \param A The batch of system matrices.
+// \param X The batch of solutions.
+// \param B The batch of right-hand sides.
+// \param n The number of rows and columns of the system matrices.
+// \param r The number of right-hand side vectors of each system.
+// \return void
+// \exception std::runtime_error Solving LSE with singular system matrix failed.
+//
+// All systems that require pivoting are recomputed by the default solver after the compact
+// kernels have processed the entire batch. Systems smaller than 5x5 are directly solved by the
+// closed-form kernels of the default solver, which outperform the gather and scatter operations
+// of the compact layout for these sizes.
+*/
+template< typename CT1   // Type of the batch of system matrices
+        , typename CT2   // Type of the batch of solutions
+        , typename CT3   // Type of the batch of right-hand sides
+        , typename ND    // Type of the number of rows and columns of the system matrices
+        , typename RD >  // Type of the number of right-hand side vectors
+inline auto batchSolveBackend( const CT1& A, CT2& X, const CT3& B, ND n, RD r )
+   -> EnableIf_t< UseCompactBatch_v< BatchElement_t<CT1>, BatchElement_t<CT2> > &&
+                  UseCompactBatch_v< BatchElement_t<CT1>, BatchElement_t<CT3> > >
+{
+   using Type = ElementType_t< BatchElement_t<CT1> >;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<Type>::size );
+
+   const size_t count ( A.size() );
+   const size_t groups( ( count + SIMDSIZE - 1UL ) / SIMDSIZE );
+
+   if( n < 5UL ) {
+      for( size_t i=0UL; i<count; ++i ) {
+         solve( A[i], X[i], B[i] );
+      }
+      return;
+   }
+
+   std::unique_ptr<bool[]> failed( new bool[count]() );
+   bool* flags( failed.get() );
+
+   batchExecute( count, groups, [&A,&X,&B,n,r,count,flags]( size_t begin, size_t end )
+   {
+      DynamicMatrix<Type,rowMajor>& buffer(
+         PackingArena::instance().acquire<Type,rowMajor>( 1UL, ( n*n + n*r )*SIMDSIZE ) );
+
+      Type* a( buffer.data() );
+      Type* x( a + n*n*SIMDSIZE );
+
+      for( size_t g=begin; g<end; ++g )
+      {
+         const size_t first( g*SIMDSIZE );
+         const size_t lanes( min( count - first, size_t( SIMDSIZE ) ) );
+
+         batchGather( a, A, first, lanes, n, n, true );
+         batchGather( x, B, first, lanes, n, r, false );
+         const size_t mask( batchSolveKernel( a, x, n, r ) );
+         batchScatter( X, x, first, lanes, n, r, mask );
+
+         for( size_t l=0UL; l<lanes; ++l ) {
+            flags[first+l] = ( ( mask & ( 1UL << l ) ) != 0UL );
+         }
+      }
+   } );
+
+   for( size_t i=0UL; i<count; ++i ) {
+      if( flags[i] ) {
+         solve( A[i], X[i], B[i] );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BATCHED OPERATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Batched operations */
+//@{
+template< typename CT1, typename CT2, typename CT3 >
+void batchMult( CT1& C, const CT2& A, const CT3& B );
+
+template< typename CT >
+void batchInvert( CT& A );
+
+template< typename CT1, typename CT2, typename CT3 >
+void batchSolve( const CT1& A, CT2& X, const CT3& B );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Batched multiplication of small dense matrices.
+// \ingroup dense_matrix
+//
+// \param C The batch of result matrices.
+// \param A The batch of left-hand side matrices.
+// \param B The batch of right-hand side matrices.
+// \return void
+// \exception std::invalid_argument Invalid batch sizes.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function computes the matrix products \f$ C[i] = A[i] * B[i] \f$ for all matrices of the
+// given batches. A batch is any contiguous container of dense matrices that provides a \c size()
+// member function and a subscript operator (as for instance \c std::vector, \c std::array, or a
+// DynamicVector of StaticMatrix or HybridMatrix elements). Note that \c std::vector requires an
+// AlignedAllocator in order to properly align StaticMatrix and HybridMatrix elements. All matrices
+// within a batch must have the same size. Resizable result batches (as for instance \c std::vector)
+// are resized to the size of \a A. In case the batches differ in size or the matrix sizes don't
+// match, a \a std::invalid_argument exception is thrown.
+
+   \code
+   using M4x4 = blaze::StaticMatrix<double,4UL,4UL>;
+   using Allocator = blaze::AlignedAllocator<M4x4>;
+
+   std::vector<M4x4,Allocator> A( 1000UL ), B( 1000UL ), C( 1000UL );
+   // ... Initialization of A and B
+
+   blaze::batchMult( C, A, B );  // Computes C[i] = A[i] * B[i] for all i
+   \endcode
+
+// Each product is computed by the vectorized kernels of the according matrix type. In case the
+// result matrices are not SMP-assignable (as for instance StaticMatrix or HybridMatrix), large
+// batches are distributed among the threads of the active shared memory parallelization (see
+// the BLAZE_SMP_DMATBATCH_THRESHOLD configuration).
+*/
+template< typename CT1    // Type of the result batch
+        , typename CT2    // Type of the left-hand side batch
+        , typename CT3 >  // Type of the right-hand side batch
+void batchMult( CT1& C, const CT2& A, const CT3& B )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( BatchElement_t<CT1> );
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( BatchElement_t<CT2> );
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( BatchElement_t<CT3> );
+
+   const size_t count( A.size() );
+
+   if( B.size() != count ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid batch sizes" );
+   }
+
+   resizeBatch( C, count );
+
+   if( count == 0UL )
+      return;
+
+   const size_t m( batchRows   ( A[0UL] ) );
+   const size_t k( batchColumns( A[0UL] ) );
+   const size_t n( batchColumns( B[0UL] ) );
+
+   for( size_t i=0UL; i<count; ++i ) {
+      if( batchRows( A[i] ) != m || batchColumns( A[i] ) != k ||
+          batchRows( B[i] ) != k || batchColumns( B[i] ) != n ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+      }
+   }
+
+   for( size_t i=0UL; i<count; ++i ) {
+      batchResize( C[i], m, n );
+   }
+
+   batchMultBackend( C, A, B );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Batched in-place inversion of small dense matrices.
+// \ingroup dense_matrix
+//
+// \param A The batch of dense matrices to be inverted.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function inverts all matrices of the given batch. A batch is any contiguous container of
+// dense square matrices that provides a \c size() member function and a subscript operator (as
+// for instance \c std::vector, \c std::array, or a DynamicVector of StaticMatrix or HybridMatrix
+// elements). All matrices within a batch must have the same size.
+
+   \code
+   using M4x4 = blaze::StaticMatrix<double,4UL,4UL>;
+   using Allocator = blaze::AlignedAllocator<M4x4>;
+
+   std::vector<M4x4,Allocator> A( 1000UL );
+   // ... Initialization of A
+
+   blaze::batchInvert( A );  // Inverts all 1000 matrices
+   \endcode
+
+// In case of contiguous matrices with \c float or \c double elements (as for instance StaticMatrix,
+// HybridMatrix, or DynamicMatrix), the matrices are inverted in groups of as many matrices as fit
+// into a single SIMD vector (for instance 8 \c double matrices in case of AVX-512). Each group is
+// interleaved into a compact layout, where each SIMD vector holds the same element of all matrices
+// of the group, and is inverted by means of a Gauss-Jordan elimination without pivoting. Thus the
+// SIMD units are fully utilized even for tiny matrices such as 4x4. Large batches are additionally
+// distributed among the threads of the active shared memory parallelization (see the
+// BLAZE_SMP_DMATBATCH_THRESHOLD configuration). All matrices that encounter a pivot that is
+// small in relation to the largest element of the matrix are inverted again by means of the
+// pivoting invert() function. Thus the accuracy of the result is comparable to individual
+// inversions. In case a matrix is singular, a \a std::runtime_error exception is thrown.
+//
+// \note This function can only be used if a fitting LAPACK library is available and linked to
+// the executable. Otherwise a linker error will be created.
+//
+// \note This function does only provide the basic exception safety guarantee, i.e. in case of an
+// exception \a A may already have been modified.
+*/
+template< typename CT >  // Type of the batch
+void batchInvert( CT& A )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( BatchElement_t<CT> );
+
+   const size_t count( A.size() );
+
+   if( count == 0UL )
+      return;
+
+   const auto n( batchDimension< BatchRows_t< BatchElement_t<CT> > >( batchRows( A[0UL] ) ) );
+
+   for( size_t i=0UL; i<count; ++i ) {
+      if( batchRows( A[i] ) != batchColumns( A[i] ) ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+      }
+      if( batchRows( A[i] ) != n ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+      }
+   }
+
+   batchInvertBackend( A, n );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Batched solution of small linear systems of equations (\f$ A[i]*X[i]=B[i] \f$).
+// \ingroup dense_matrix
+//
+// \param A The batch of system matrices.
+// \param X The batch of resulting solution vectors or matrices.
+// \param B The batch of right-hand side vectors or matrices.
+// \return void
+// \exception std::invalid_argument Invalid batch sizes.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::runtime_error Solving LSE with singular system matrix failed.
+//
+// This function solves the linear systems of equations \f$ A[i]*X[i]=B[i] \f$ for all systems
+// of the given batches. The right-hand sides and solutions can either be dense vectors or dense
+// matrices with multiple right-hand side vectors. A batch is any contiguous container that
+// provides a \c size() member function and a subscript operator (as for instance \c std::vector,
+// \c std::array, or a DynamicVector of StaticMatrix or StaticVector elements). All systems must
+// have the same size.
+
+   \code
+   using M3x3 = blaze::StaticMatrix<double,3UL,3UL>;
+   using V3   = blaze::StaticVector<double,3UL>;
+
+   std::vector< M3x3, blaze::AlignedAllocator<M3x3> > A( 1000UL );
+   std::vector< V3, blaze::AlignedAllocator<V3> > x( 1000UL ), b( 1000UL );
+   // ... Initialization of A and b
+
+   blaze::batchSolve( A, x, b );  // Solves A[i]*x[i]=b[i] for all i
+   \endcode
+
+// In case of contiguous matrices and vectors with \c float or \c double elements, the systems are
+// solved in groups of as many systems as fit into a single SIMD vector by means of an LU
+// decomposition without pivoting (see batchInvert() for a description of the compact batch
+// layout). Large batches are additionally distributed among the threads of the active shared
+// memory parallelization (see the BLAZE_SMP_DMATBATCH_THRESHOLD configuration). All systems that
+// encounter a pivot that is small in relation to the largest element of the system matrix are
+// solved again by means of the pivoting solve() function. In case a system matrix is singular, a
+// \a std::runtime_error exception is thrown.
+//
+// \note This function can only be used if a fitting LAPACK library is available and linked to
+// the executable. Otherwise a linker error will be created.
+//
+// \note This function does only provide the basic exception safety guarantee, i.e. in case of an
+// exception \a X may already have been modified.
+*/
+template< typename CT1    // Type of the batch of system matrices
+        , typename CT2    // Type of the batch of solutions
+        , typename CT3 >  // Type of the batch of right-hand sides
+void batchSolve( const CT1& A, CT2& X, const CT3& B )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( BatchElement_t<CT1> );
+
+   const size_t count( A.size() );
+
+   if( B.size() != count ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid batch sizes" );
+   }
+
+   resizeBatch( X, count );
+
+   if( count == 0UL )
+      return;
+
+   const auto n( batchDimension< BatchRows_t< BatchElement_t<CT1> > >( batchRows( A[0UL] ) ) );
+   const auto r( batchDimension< BatchColumns_t< BatchElement_t<CT3> > >( batchColumns( B[0UL] ) ) );
+
+   for( size_t i=0UL; i<count; ++i ) {
+      if( batchRows( A[i] ) != batchColumns( A[i] ) ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+      }
+      if( batchRows( A[i] ) != n || batchRows( B[i] ) != n || batchColumns( B[i] ) != r ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+      }
+   }
+
+   for( size_t i=0UL; i<count; ++i ) {
+      batchResize( X[i], n, r );
+   }
+
+   batchSolveBackend( A, X, B, n, r );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
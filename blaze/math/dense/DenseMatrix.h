@@ -50,6 +50,7 @@
 #include <blaze/math/Epsilon.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/lapack/clapack/potrf.h>
+#include <blaze/math/lapack/native/potf2.h>
 #include <blaze/math/ReductionFlag.h>
 #include <blaze/math/RelaxationFlag.h>
 #include <blaze/math/shims/Conjugate.h>
@@ -81,6 +82,7 @@
 #include <blaze/math/typetraits/RemoveAdaptor.h>
 #include <blaze/math/typetraits/UnderlyingBuiltin.h>
 #include <blaze/math/views/Check.h>
+#include <blaze/system/LAPACK.h>
 #include <blaze/util/algorithms/Max.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
@@ -2538,7 +2540,9 @@ bool isIdentity( const DenseMatrix<MT,SO>& dm )
 // element type results in a compile time error!
 //
 // \note This function can only be used if a fitting LAPACK library is available and linked to
-// the executable. Otherwise a call to this function will result in a linker error.
+// the executable. Otherwise a call to this function will result in a linker error. In case the
+// LAPACK mode is disabled (see the BLAZE_LAPACK_MODE switch), the check is performed by means of
+// the native Cholesky decomposition kernel, which does not require LAPACK.
 */
 template< typename MT  // Type of the dense matrix
         , bool SO >    // Storage order
@@ -2554,6 +2558,7 @@ bool isPositiveDefinite( const DenseMatrix<MT,SO>& dm )
 
    RemoveAdaptor_t< ResultType_t<MT> > L( ~dm );
 
+#if BLAZE_LAPACK_MODE
    char uplo( IsRowMajorMatrix_v<MT> ? 'U' : 'L' );
    int  n   ( numeric_cast<int>( (~L).rows()    ) );
    int  lda ( numeric_cast<int>( (~L).spacing() ) );
@@ -2562,6 +2567,9 @@ bool isPositiveDefinite( const DenseMatrix<MT,SO>& dm )
    potrf( uplo, n, (~L).data(), lda, &info );
 
    return ( info == 0 );
+#else
+   return ( nativePotf2<0UL>( L ) == 0 );
+#endif
 }
 //*************************************************************************************************
 
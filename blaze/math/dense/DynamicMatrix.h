@@ -124,6 +124,7 @@
 #include <blaze/util/IntegralConstant.h>
 #include <blaze/util/MaybeUnused.h>
 #include <blaze/util/Memory.h>
+#include <blaze/util/Numa.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/IsNumeric.h>
 #include <blaze/util/typetraits/IsSame.h>
@@ -433,6 +434,22 @@ class DynamicMatrix
    static constexpr size_t SIMDSIZE = SIMDTrait<ElementType>::size;
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Tag type for the construction of a matrix without any initialization.
+   struct Uninitialized {};
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\name Constructors */
+   //@{
+   inline DynamicMatrix( size_t m, size_t n, Uninitialized );
+   //@}
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Debugging functions*************************************************************************
    /*!\name Debugging functions */
@@ -600,13 +617,13 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix() noexcept
 template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
 inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n )
-   : m_       ( m )                            // The current number of rows of the matrix
-   , n_       ( n )                            // The current number of columns of the matrix
-   , nn_      ( addPadding( n ) )              // The alignment adjusted number of columns
-   , capacity_( m_*nn_ )                       // The maximum capacity of the matrix
-   , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
+   : DynamicMatrix( m, n, Uninitialized() )
 {
    if( IsVectorizable_v<Type> ) {
+      if( nn_ != n_ ) {
+         smpFirstTouch( *this, Type() );
+      }
+
       for( size_t i=0UL; i<m_; ++i ) {
          for( size_t j=n_; j<nn_; ++j ) {
             v_[i*nn_+j] = Type();
@@ -631,11 +648,21 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n )
 template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
 inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n, const Type& init )
-   : DynamicMatrix( m, n )
+   : DynamicMatrix( m, n, Uninitialized() )
 {
-   for( size_t i=0UL; i<m; ++i ) {
-      for( size_t j=0UL; j<n_; ++j ) {
-         v_[i*nn_+j] = init;
+   if( !smpFirstTouch( *this, init ) ) {
+      for( size_t i=0UL; i<m_; ++i ) {
+         for( size_t j=0UL; j<n_; ++j ) {
+            v_[i*nn_+j] = init;
+         }
+      }
+   }
+
+   if( IsVectorizable_v<Type> ) {
+      for( size_t i=0UL; i<m_; ++i ) {
+         for( size_t j=n_; j<nn_; ++j ) {
+            v_[i*nn_+j] = Type();
+         }
       }
    }
 
@@ -644,6 +671,28 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n, const Type& in
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ m \times n \f$ without any memory access.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+//
+// This constructor only allocates the required dynamic memory. In contrast to the public
+// constructors it does not even initialize the padding elements. Thus the delegating
+// constructor is responsible for the (first-touch) initialization of all elements.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n, Uninitialized )
+   : m_       ( m )                                // The current number of rows of the matrix
+   , n_       ( n )                                // The current number of columns of the matrix
+   , nn_      ( addPadding( n ) )                  // The alignment adjusted number of columns
+   , capacity_( m_*nn_ )                           // The maximum capacity of the matrix
+   , v_       ( numaAllocate<Type>( capacity_ ) )  // The matrix elements
+{}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief List initialization of all matrix elements.
 //
@@ -1803,9 +1852,11 @@ void DynamicMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
 
    const size_t nn( addPadding( n ) );
 
+   bool allocated( false );
+
    if( preserve )
    {
-      Type* BLAZE_RESTRICT v = allocate<Type>( m*nn );
+      Type* BLAZE_RESTRICT v = numaAllocate<Type>( m*nn );
       const size_t min_m( min( m, m_ ) );
       const size_t min_n( min( n, n_ ) );
 
@@ -1818,21 +1869,26 @@ void DynamicMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
       capacity_ = m*nn;
    }
    else if( m*nn > capacity_ ) {
-      Type* BLAZE_RESTRICT v = allocate<Type>( m*nn );
+      Type* BLAZE_RESTRICT v = numaAllocate<Type>( m*nn );
       swap( v_, v );
       deallocate( v );
       capacity_ = m*nn;
+      allocated = true;
    }
 
+   m_  = m;
+   n_  = n;
+   nn_ = nn;
+
    if( IsVectorizable_v<Type> ) {
+      if( allocated && nn != n ) {
+         smpFirstTouch( *this, Type() );
+      }
+
       for( size_t i=0UL; i<m; ++i )
          for( size_t j=n; j<nn; ++j )
             v_[i*nn+j] = Type();
    }
-
-   m_  = m;
-   n_  = n;
-   nn_ = nn;
 }
 //*************************************************************************************************
 
@@ -1878,7 +1934,7 @@ inline void DynamicMatrix<Type,SO>::reserve( size_t elements )
    if( elements > capacity_ )
    {
       // Allocating a new array
-      Type* BLAZE_RESTRICT tmp = allocate<Type>( elements );
+      Type* BLAZE_RESTRICT tmp = numaAllocate<Type>( elements );
 
       // Initializing the new array
       transfer( v_, v_+capacity_, tmp );
@@ -3485,6 +3541,22 @@ class DynamicMatrix<Type,true>
    static constexpr size_t SIMDSIZE = SIMDTrait<ElementType>::size;
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Tag type for the construction of a matrix without any initialization.
+   struct Uninitialized {};
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\name Constructors */
+   //@{
+   inline DynamicMatrix( size_t m, size_t n, Uninitialized );
+   //@}
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Debugging functions*************************************************************************
    /*!\name Debugging functions */
@@ -3621,13 +3693,13 @@ inline DynamicMatrix<Type,true>::DynamicMatrix() noexcept
 */
 template< typename Type >  // Data type of the matrix
 inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n )
-   : m_       ( m )                            // The current number of rows of the matrix
-   , mm_      ( addPadding( m ) )              // The alignment adjusted number of rows
-   , n_       ( n )                            // The current number of columns of the matrix
-   , capacity_( mm_*n_ )                       // The maximum capacity of the matrix
-   , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
+   : DynamicMatrix( m, n, Uninitialized() )
 {
    if( IsVectorizable_v<Type> ) {
+      if( mm_ != m_ ) {
+         smpFirstTouch( *this, Type() );
+      }
+
       for( size_t j=0UL; j<n_; ++j ) {
          for( size_t i=m_; i<mm_; ++i ) {
             v_[i+j*mm_] = Type();
@@ -3653,11 +3725,21 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n )
 */
 template< typename Type >  // Data type of the matrix
 inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n, const Type& init )
-   : DynamicMatrix( m, n )
+   : DynamicMatrix( m, n, Uninitialized() )
 {
-   for( size_t j=0UL; j<n_; ++j ) {
-      for( size_t i=0UL; i<m_; ++i ) {
-         v_[i+j*mm_] = init;
+   if( !smpFirstTouch( *this, init ) ) {
+      for( size_t j=0UL; j<n_; ++j ) {
+         for( size_t i=0UL; i<m_; ++i ) {
+            v_[i+j*mm_] = init;
+         }
+      }
+   }
+
+   if( IsVectorizable_v<Type> ) {
+      for( size_t j=0UL; j<n_; ++j ) {
+         for( size_t i=m_; i<mm_; ++i ) {
+            v_[i+j*mm_] = Type();
+         }
       }
    }
 
@@ -3667,6 +3749,29 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n, const Type&
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Constructor for a matrix of size \f$ m \times n \f$ without any memory access.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+//
+// This constructor only allocates the required dynamic memory. In contrast to the public
+// constructors it does not even initialize the padding elements. Thus the delegating
+// constructor is responsible for the (first-touch) initialization of all elements.
+*/
+template< typename Type >  // Data type of the matrix
+inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n, Uninitialized )
+   : m_       ( m )                                // The current number of rows of the matrix
+   , mm_      ( addPadding( m ) )                  // The alignment adjusted number of rows
+   , n_       ( n )                                // The current number of columns of the matrix
+   , capacity_( mm_*n_ )                           // The maximum capacity of the matrix
+   , v_       ( numaAllocate<Type>( capacity_ ) )  // The matrix elements
+{}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief List initialization of all matrix elements.
@@ -4837,9 +4942,11 @@ void DynamicMatrix<Type,true>::resize( size_t m, size_t n, bool preserve )
 
    const size_t mm( addPadding( m ) );
 
+   bool allocated( false );
+
    if( preserve )
    {
-      Type* BLAZE_RESTRICT v = allocate<Type>( mm*n );
+      Type* BLAZE_RESTRICT v = numaAllocate<Type>( mm*n );
       const size_t min_m( min( m, m_ ) );
       const size_t min_n( min( n, n_ ) );
 
@@ -4852,21 +4959,26 @@ void DynamicMatrix<Type,true>::resize( size_t m, size_t n, bool preserve )
       capacity_ = mm*n;
    }
    else if( mm*n > capacity_ ) {
-      Type* BLAZE_RESTRICT v = allocate<Type>( mm*n );
+      Type* BLAZE_RESTRICT v = numaAllocate<Type>( mm*n );
       swap( v_, v );
       deallocate( v );
       capacity_ = mm*n;
+      allocated = true;
    }
 
+   m_  = m;
+   mm_ = mm;
+   n_  = n;
+
    if( IsVectorizable_v<Type> ) {
+      if( allocated && mm != m ) {
+         smpFirstTouch( *this, Type() );
+      }
+
       for( size_t j=0UL; j<n; ++j )
          for( size_t i=m; i<mm; ++i )
             v_[i+j*mm] = Type();
    }
-
-   m_  = m;
-   mm_ = mm;
-   n_  = n;
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -4914,7 +5026,7 @@ inline void DynamicMatrix<Type,true>::reserve( size_t elements )
    if( elements > capacity_ )
    {
       // Allocating a new array
-      Type* BLAZE_RESTRICT tmp = allocate<Type>( elements );
+      Type* BLAZE_RESTRICT tmp = numaAllocate<Type>( elements );
 
       // Initializing the new array
       transfer( v_, v_+capacity_, tmp );
@@ -50,6 +50,7 @@
 #include <blaze/math/constraints/TransposeFlag.h>
 #include <blaze/math/dense/DenseIterator.h>
 #include <blaze/math/dense/Forward.h>
+#include <blaze/math/dispatch/Functions.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/SparseVector.h>
@@ -89,6 +90,7 @@
 #include <blaze/math/typetraits/IsContiguous.h>
 #include <blaze/math/typetraits/IsDenseMatrix.h>
 #include <blaze/math/typetraits/IsDenseVector.h>
+#include <blaze/math/typetraits/IsDispatchCompatible.h>
 #include <blaze/math/typetraits/IsMatrix.h>
 #include <blaze/math/typetraits/IsPadded.h>
 #include <blaze/math/typetraits/IsResizable.h>
@@ -120,8 +122,10 @@
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/IntegralConstant.h>
 #include <blaze/util/Memory.h>
+#include <blaze/util/Numa.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/IsNumeric.h>
+#include <blaze/util/typetraits/IsSame.h>
 #include <blaze/util/typetraits/IsVectorizable.h>
 #include <blaze/util/typetraits/RemoveConst.h>
 #include <blaze/util/typetraits/RemoveCV.h>
@@ -405,11 +409,40 @@ class DynamicVector
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename VT >
+   static constexpr bool DispatchAssign_v =
+      ( BLAZE_RUNTIME_DISPATCH_MODE &&
+        VectorizedAssign_v<VT> &&
+        IsDispatchCompatible_v<Type> &&
+        IsSame_v< Type, ElementType_t<VT> > &&
+        IsContiguous_v<VT> && HasConstDataAccess_v<VT> );
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**********************************************************************************************
    //! The number of elements packed within a single SIMD element.
    static constexpr size_t SIMDSIZE = SIMDTrait<ElementType>::size;
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Tag type for the construction of a vector without any initialization.
+   struct Uninitialized {};
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\name Constructors */
+   //@{
+   inline DynamicVector( size_t n, Uninitialized );
+   //@}
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Debugging functions*************************************************************************
    /*!\name Debugging functions */
@@ -440,7 +473,11 @@ class DynamicVector
    inline auto assign( const DenseVector<VT,TF>& rhs ) -> DisableIf_t< VectorizedAssign_v<VT> >;
 
    template< typename VT >
-   inline auto assign( const DenseVector<VT,TF>& rhs ) -> EnableIf_t< VectorizedAssign_v<VT> >;
+   inline auto assign( const DenseVector<VT,TF>& rhs )
+      -> EnableIf_t< VectorizedAssign_v<VT> && !DispatchAssign_v<VT> >;
+
+   template< typename VT >
+   inline auto assign( const DenseVector<VT,TF>& rhs ) -> EnableIf_t< DispatchAssign_v<VT> >;
 
    template< typename VT > inline void assign( const SparseVector<VT,TF>& rhs );
 
@@ -448,7 +485,11 @@ class DynamicVector
    inline auto addAssign( const DenseVector<VT,TF>& rhs ) -> DisableIf_t< VectorizedAddAssign_v<VT> >;
 
    template< typename VT >
-   inline auto addAssign( const DenseVector<VT,TF>& rhs ) -> EnableIf_t< VectorizedAddAssign_v<VT> >;
+   inline auto addAssign( const DenseVector<VT,TF>& rhs )
+      -> EnableIf_t< VectorizedAddAssign_v<VT> && !DispatchAssign_v<VT> >;
+
+   template< typename VT >
+   inline auto addAssign( const DenseVector<VT,TF>& rhs ) -> EnableIf_t< DispatchAssign_v<VT> >;
 
    template< typename VT > inline void addAssign( const SparseVector<VT,TF>& rhs );
 
@@ -456,7 +497,11 @@ class DynamicVector
    inline auto subAssign( const DenseVector<VT,TF>& rhs ) -> DisableIf_t< VectorizedSubAssign_v<VT> >;
 
    template< typename VT >
-   inline auto subAssign( const DenseVector<VT,TF>& rhs ) -> EnableIf_t< VectorizedSubAssign_v<VT> >;
+   inline auto subAssign( const DenseVector<VT,TF>& rhs )
+      -> EnableIf_t< VectorizedSubAssign_v<VT> && !DispatchAssign_v<VT> >;
+
+   template< typename VT >
+   inline auto subAssign( const DenseVector<VT,TF>& rhs ) -> EnableIf_t< DispatchAssign_v<VT> >;
 
    template< typename VT > inline void subAssign( const SparseVector<VT,TF>& rhs );
 
@@ -566,9 +611,7 @@ inline DynamicVector<Type,TF>::DynamicVector() noexcept
 template< typename Type  // Data type of the vector
         , bool TF >      // Transpose flag
 inline DynamicVector<Type,TF>::DynamicVector( size_t n )
-   : size_    ( n )                            // The current size/dimension of the vector
-   , capacity_( addPadding( n ) )              // The maximum capacity of the vector
-   , v_       ( allocate<Type>( capacity_ ) )  // The vector elements
+   : DynamicVector( n, Uninitialized() )
 {
    if( IsVectorizable_v<Type> ) {
       for( size_t i=size_; i<capacity_; ++i )
@@ -591,16 +634,42 @@ inline DynamicVector<Type,TF>::DynamicVector( size_t n )
 template< typename Type  // Data type of the vector
         , bool TF >      // Transpose flag
 inline DynamicVector<Type,TF>::DynamicVector( size_t n, const Type& init )
-   : DynamicVector( n )
+   : DynamicVector( n, Uninitialized() )
 {
-   for( size_t i=0UL; i<size_; ++i )
-      v_[i] = init;
+   if( !smpFirstTouch( *this, init ) ) {
+      for( size_t i=0UL; i<size_; ++i )
+         v_[i] = init;
+   }
+
+   if( IsVectorizable_v<Type> ) {
+      for( size_t i=size_; i<capacity_; ++i )
+         v_[i] = Type();
+   }
 
    BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
 }
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Constructor for a vector of size \a n without any memory access.
+//
+// \param n The size of the vector.
+//
+// This constructor only allocates the required dynamic memory. In contrast to the public
+// constructors it does not even initialize the padding elements. Thus the delegating
+// constructor is responsible for the (first-touch) initialization of all elements.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline DynamicVector<Type,TF>::DynamicVector( size_t n, Uninitialized )
+   : size_    ( n )                                // The current size/dimension of the vector
+   , capacity_( addPadding( n ) )                  // The maximum capacity of the vector
+   , v_       ( numaAllocate<Type>( capacity_ ) )  // The vector elements
+{}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief List initialization of all vector elements.
 //
@@ -1550,22 +1619,31 @@ inline void DynamicVector<Type,TF>::resize( size_t n, bool preserve )
    {
       // Allocating a new array
       const size_t newCapacity( addPadding( n ) );
-      Type* BLAZE_RESTRICT tmp = allocate<Type>( newCapacity );
+      Type* BLAZE_RESTRICT tmp = numaAllocate<Type>( newCapacity );
 
       // Initializing the new array
       if( preserve ) {
          transfer( v_, v_+size_, tmp );
       }
 
-      if( IsVectorizable_v<Type> ) {
-         for( size_t i=size_; i<newCapacity; ++i )
-            tmp[i] = Type();
-      }
-
       // Replacing the old array
       swap( v_, tmp );
       deallocate( tmp );
       capacity_ = newCapacity;
+
+      // Initializing the new elements (in parallel in case the old values are discarded)
+      if( IsVectorizable_v<Type> ) {
+         size_t i( size_ );
+
+         if( !preserve ) {
+            size_ = n;
+            if( smpFirstTouch( *this, Type() ) )
+               i = n;
+         }
+
+         for( ; i<newCapacity; ++i )
+            v_[i] = Type();
+      }
    }
    else if( IsVectorizable_v<Type> && n < size_ )
    {
@@ -1618,7 +1696,7 @@ inline void DynamicVector<Type,TF>::reserve( size_t n )
    {
       // Allocating a new array
       const size_t newCapacity( addPadding( n ) );
-      Type* BLAZE_RESTRICT tmp = allocate<Type>( newCapacity );
+      Type* BLAZE_RESTRICT tmp = numaAllocate<Type>( newCapacity );
 
       // Initializing the new array
       transfer( v_, v_+size_, tmp );
@@ -2104,7 +2182,7 @@ template< typename Type  // Data type of the vector
         , bool TF >      // Transpose flag
 template< typename VT >  // Type of the right-hand side dense vector
 inline auto DynamicVector<Type,TF>::assign( const DenseVector<VT,TF>& rhs )
-   -> EnableIf_t< VectorizedAssign_v<VT> >
+   -> EnableIf_t< VectorizedAssign_v<VT> && !DispatchAssign_v<VT> >
 {
    BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
 
@@ -2149,6 +2227,34 @@ inline auto DynamicVector<Type,TF>::assign( const DenseVector<VT,TF>& rhs )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Runtime dispatched implementation of the assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+template< typename VT >  // Type of the right-hand side dense vector
+inline auto DynamicVector<Type,TF>::assign( const DenseVector<VT,TF>& rhs )
+   -> EnableIf_t< DispatchAssign_v<VT> >
+{
+   BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
+
+   const bool stream( useStreaming &&
+                      ( size_ > ( cacheSize/( sizeof(Type) * 3UL ) ) ) &&
+                      !(~rhs).isAliased( this ) );
+
+   dispatchAssign( *this, ~rhs, stream );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Default implementation of the assignment of a sparse vector.
 //
@@ -2220,7 +2326,7 @@ template< typename Type  // Data type of the vector
         , bool TF >      // Transpose flag
 template< typename VT >  // Type of the right-hand side dense vector
 inline auto DynamicVector<Type,TF>::addAssign( const DenseVector<VT,TF>& rhs )
-   -> EnableIf_t< VectorizedAddAssign_v<VT> >
+   -> EnableIf_t< VectorizedAddAssign_v<VT> && !DispatchAssign_v<VT> >
 {
    BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
 
@@ -2251,6 +2357,30 @@ inline auto DynamicVector<Type,TF>::addAssign( const DenseVector<VT,TF>& rhs )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Runtime dispatched implementation of the addition assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+template< typename VT >  // Type of the right-hand side dense vector
+inline auto DynamicVector<Type,TF>::addAssign( const DenseVector<VT,TF>& rhs )
+   -> EnableIf_t< DispatchAssign_v<VT> >
+{
+   BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
+
+   dispatchAddAssign( *this, ~rhs );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Default implementation of the addition assignment of a sparse vector.
 //
@@ -2322,7 +2452,7 @@ template< typename Type  // Data type of the vector
         , bool TF >      // Transpose flag
 template< typename VT >  // Type of the right-hand side dense vector
 inline auto DynamicVector<Type,TF>::subAssign( const DenseVector<VT,TF>& rhs )
-   -> EnableIf_t< VectorizedSubAssign_v<VT> >
+   -> EnableIf_t< VectorizedSubAssign_v<VT> && !DispatchAssign_v<VT> >
 {
    BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
 
@@ -2353,6 +2483,30 @@ inline auto DynamicVector<Type,TF>::subAssign( const DenseVector<VT,TF>& rhs )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Runtime dispatched implementation of the subtraction assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+template< typename VT >  // Type of the right-hand side dense vector
+inline auto DynamicVector<Type,TF>::subAssign( const DenseVector<VT,TF>& rhs )
+   -> EnableIf_t< DispatchAssign_v<VT> >
+{
+   BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
+
+   dispatchSubAssign( *this, ~rhs );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Default implementation of the subtraction assignment of a sparse vector.
 //
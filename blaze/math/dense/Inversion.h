@@ -54,6 +54,7 @@
 #include <blaze/math/lapack/getri.h>
 #include <blaze/math/lapack/hetrf.h>
 #include <blaze/math/lapack/hetri.h>
+#include <blaze/math/lapack/native/Native.h>
 #include <blaze/math/lapack/potrf.h>
 #include <blaze/math/lapack/potri.h>
 #include <blaze/math/lapack/sytrf.h>
@@ -3379,7 +3380,8 @@ inline void invertByLU( DenseMatrix<MT,SO>& dm )
 */
 template< typename MT  // Type of the dense matrix
         , bool SO >    // Storage order of the dense matrix
-inline void invertByLDLT( DenseMatrix<MT,SO>& dm )
+inline auto invertByLDLT( DenseMatrix<MT,SO>& dm )
+   -> EnableIf_t< !UseNativeLAPACK_v<MT> >
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
    BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT> );
@@ -3411,6 +3413,51 @@ inline void invertByLDLT( DenseMatrix<MT,SO>& dm )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place LU-based inversion of the given symmetric dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The dense matrix to be inverted.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function inverts the given symmetric dense matrix in case the native LAPACK kernels are
+// used (see the BLAZE_LAPACK_MODE switch). Since there is no native Bunch-Kaufman decomposition,
+// the matrix is inverted by means of an LU decomposition and the symmetry of the result is
+// restored afterwards. The matrix inversion fails if ...
+//
+//  - ... the given matrix is not a square matrix;
+//  - ... the given matrix is singular and not invertible.
+//
+// In all failure cases an exception is thrown.
+//
+// \note This function does only provide the basic exception safety guarantee, i.e. in case of an
+// exception \a dm may already have been modified.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline auto invertByLDLT( DenseMatrix<MT,SO>& dm )
+   -> EnableIf_t< UseNativeLAPACK_v<MT> >
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT> );
+
+   BLAZE_USER_ASSERT( isSymmetric( ~dm ), "Invalid non-symmetric matrix detected" );
+
+   invertByLU( ~dm );
+
+   for( size_t i=1UL; i<(~dm).rows(); ++i ) {
+      for( size_t j=0UL; j<i; ++j ) {
+         (~dm)(j,i) = (~dm)(i,j);
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief In-place Bunch-Kaufman-based inversion of the given symmetric dense matrix.
@@ -3481,7 +3528,7 @@ inline auto invertByLDLH( DenseMatrix<MT,SO>& dm )
 template< typename MT  // Type of the dense matrix
         , bool SO >    // Storage order of the dense matrix
 inline auto invertByLDLH( DenseMatrix<MT,SO>& dm )
-   -> EnableIf_t< IsComplex_v< ElementType_t<MT> > >
+   -> EnableIf_t< IsComplex_v< ElementType_t<MT> > && !UseNativeLAPACK_v<MT> >
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
    BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT> );
@@ -3513,6 +3560,51 @@ inline auto invertByLDLH( DenseMatrix<MT,SO>& dm )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place LU-based inversion of the given Hermitian dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The dense matrix to be inverted.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function inverts the given Hermitian dense matrix in case the native LAPACK kernels are
+// used (see the BLAZE_LAPACK_MODE switch). Since there is no native Bunch-Kaufman decomposition,
+// the matrix is inverted by means of an LU decomposition and the Hermitian symmetry of the result is
+// restored afterwards. The matrix inversion fails if ...
+//
+//  - ... the given matrix is not a square matrix;
+//  - ... the given matrix is singular and not invertible.
+//
+// In all failure cases an exception is thrown.
+//
+// \note This function does only provide the basic exception safety guarantee, i.e. in case of an
+// exception \a dm may already have been modified.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline auto invertByLDLH( DenseMatrix<MT,SO>& dm )
+   -> EnableIf_t< IsComplex_v< ElementType_t<MT> > && UseNativeLAPACK_v<MT> >
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT> );
+
+   BLAZE_USER_ASSERT( isHermitian( ~dm ), "Invalid non-Hermitian matrix detected" );
+
+   invertByLU( ~dm );
+
+   for( size_t i=1UL; i<(~dm).rows(); ++i ) {
+      for( size_t j=0UL; j<i; ++j ) {
+         (~dm)(j,i) = conj( (~dm)(i,j) );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief In-place Cholesky-based inversion of the given symmetric PD dense matrix.
@@ -3882,7 +3974,9 @@ inline void invert( DenseMatrix<MT,SO>& dm );
 // matrices of any other element type results in a compile time error!
 //
 // \note This function can only be used if a fitting LAPACK library is available and linked to
-// the executable. Otherwise a linker error will be created.
+// the executable. Otherwise a linker error will be created. In case the LAPACK mode is disabled
+// (see the BLAZE_LAPACK_MODE switch), the inversion is performed by means of the native Blaze
+// kernels and no LAPACK library is required.
 //
 // \note This function does only provide the basic exception safety guarantee, i.e. in case of an
 // exception \a dm may already have been modified.
@@ -3929,7 +4023,9 @@ inline void invert( DenseMatrix<MT,SO>& dm )
 // matrices of any other element type results in a compile time error!
 //
 // \note This function can only be used if a fitting LAPACK library is available and linked to
-// the executable. Otherwise a linker error will be created.
+// the executable. Otherwise a linker error will be created. In case the LAPACK mode is disabled
+// (see the BLAZE_LAPACK_MODE switch), the inversion is performed by means of the native Blaze
+// kernels and no LAPACK library is required.
 //
 // \note This function does only provide the basic exception safety guarantee, i.e. in case of an
 // exception \a dm may already have been modified.
@@ -115,7 +115,10 @@ void llh( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& L );
 // element type results in a compile time error!
 //
 // \note This function can only be used if a fitting LAPACK library is available and linked to
-// the executable. Otherwise a call to this function will result in a linker error.
+// the executable. Otherwise a call to this function will result in a linker error. In case the
+// LAPACK mode is disabled (see the BLAZE_LAPACK_MODE switch) or in case of matrices with a small
+// compile time maximum size (as for instance StaticMatrix), the decomposition is computed by the
+// native Blaze kernels and no LAPACK library is required.
 //
 // \note This function does only provide the basic exception safety guarantee, i.e. in case of an
 // exception \a L may already have been modified.
@@ -46,9 +46,11 @@
 #include <blaze/math/constraints/ColumnMajorMatrix.h>
 #include <blaze/math/constraints/StrictlyTriangular.h>
 #include <blaze/math/constraints/Uniform.h>
+#include <blaze/math/dense/BandMatrix.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/lapack/gbsv.h>
 #include <blaze/math/lapack/gesv.h>
 #include <blaze/math/lapack/hesv.h>
 #include <blaze/math/lapack/sysv.h>
@@ -6491,6 +6493,142 @@ void solve( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& X, const DenseM
 }
 //*************************************************************************************************
 
+//*************************************************************************************************
+/*!\brief Solving the given \f$ N \times N \f$ band linear system of equations (\f$ A*x=b \f$).
+// \ingroup band_matrix
+//
+// \param A The NxN band system matrix.
+// \param x The dense solution vector.
+// \param b The N-dimensional dense right-hand side vector.
+// \return void
+// \exception std::invalid_argument Invalid non-square system matrix provided.
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function computes a solution for the given linear system of equations \f$ A*x=b \f$,
+// where \a A is the given band system matrix, \a x is the solution vector, and \a b is the given
+// right-hand side vector. In contrast to the \c solve() function for general dense matrices,
+// the system is solved by means of the banded LU decomposition of the LAPACK gbsv() functions,
+// which only operates on the band of the matrix. This overload is also selected by the solve
+// expression (i.e. <tt>x = solve( A, b )</tt>).
+
+   \code
+   blaze::BandMatrix<double> A( 100UL, 100UL, 1UL, 1UL );  // The tridiagonal system matrix
+   blaze::DynamicVector<double> b;  // The right-hand side vector
+   // ... Resizing and initialization
+
+   blaze::DynamicVector<double> x;  // The solution vector
+   solve( A, x, b );
+   \endcode
+
+// The function fails if ...
+//
+//  - ... the given system matrix is not a square matrix;
+//  - ... the size of the right-hand side vector doesn't match the dimensions of the system matrix;
+//  - ... the given system matrix is singular.
+//
+// In all failure cases an exception is thrown.
+//
+// \note This function can only be used if a fitting LAPACK library is available and linked to
+// the executable. Otherwise a linker error will be created.
+*/
+template< typename Type  // Data type of the band system matrix
+        , bool SO        // Storage order of the band system matrix
+        , typename VT1   // Type of the solution vector
+        , bool TF1       // Transpose flag of the solution vector
+        , typename VT2   // Type of the right-hand side vector
+        , bool TF2 >     // Transpose flag of the right-hand side vector
+void solve( const BandMatrix<Type,SO>& A, DenseVector<VT1,TF1>& x, const DenseVector<VT2,TF2>& b )
+{
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<VT1> );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<VT2> );
+
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( Type, ElementType_t<VT1> );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( Type, ElementType_t<VT2> );
+
+   if( A.rows() != A.columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square system matrix provided" );
+   }
+   else if( A.rows() != (~b).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side vector provided" );
+   }
+
+   resize( ~x, (~b).size() );
+   smpAssign( ~x, ~b );
+
+   gbsv( A, ~x );
+
+   BLAZE_INTERNAL_ASSERT( isIntact( ~x ), "Broken invariant detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving the given \f$ N \times N \f$ band linear system of equations (\f$ A*X=B \f$).
+// \ingroup band_matrix
+//
+// \param A The NxN band system matrix.
+// \param X The dense solution matrix.
+// \param B The N-dimensional dense right-hand side matrix.
+// \return void
+// \exception std::invalid_argument Invalid non-square system matrix provided.
+// \exception std::invalid_argument Invalid right-hand side matrix provided.
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function computes a solution for the given linear system of equations \f$ A*X=B \f$,
+// where \a A is the given band system matrix, the columns of \a X are the solution vectors, and
+// the columns of \a B are the given right-hand side vectors. The system is solved by means of
+// the banded LU decomposition of the LAPACK gbsv() functions.
+//
+// The function fails if ...
+//
+//  - ... the given system matrix is not a square matrix;
+//  - ... the number of rows of the right-hand side matrix doesn't match the dimensions of the system matrix;
+//  - ... the given system matrix is singular.
+//
+// In all failure cases an exception is thrown.
+//
+// \note This function can only be used if a fitting LAPACK library is available and linked to
+// the executable. Otherwise a linker error will be created.
+*/
+template< typename Type  // Data type of the band system matrix
+        , bool SO        // Storage order of the band system matrix
+        , typename MT2   // Type of the solution matrix
+        , bool SO2       // Storage order of the solution matrix
+        , typename MT3   // Type of the right-hand side matrix
+        , bool SO3 >     // Storage order of the right-hand side matrix
+void solve( const BandMatrix<Type,SO>& A, DenseMatrix<MT2,SO2>& X, const DenseMatrix<MT3,SO3>& B )
+{
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT2> );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT3> );
+
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( Type, ElementType_t<MT2> );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( Type, ElementType_t<MT3> );
+
+   if( A.rows() != A.columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square system matrix provided" );
+   }
+   else if( A.rows() != (~B).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side matrix provided" );
+   }
+
+   using MT5 = RemoveAdaptor_t< If_t< SO3, ResultType_t<MT3>, OppositeType_t<MT3> > >;
+
+   BLAZE_CONSTRAINT_MUST_BE_COLUMN_MAJOR_MATRIX_TYPE( MT5 );
+
+   MT5 Xtmp( B );
+
+   gbsv( A, Xtmp );
+
+   resize( ~X, Xtmp.rows(), Xtmp.columns() );
+   smpAssign( ~X, Xtmp );
+
+   BLAZE_INTERNAL_ASSERT( isIntact( ~X ), "Broken invariant detected" );
+}
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
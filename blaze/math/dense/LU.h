@@ -207,7 +207,10 @@ void lu( DenseMatrix<MT1,SO1>& A, Matrix<MT2,SO2>& P )
 // element type results in a compile time error!
 //
 // \note This function can only be used if a fitting LAPACK library is available and linked to
-// the executable. Otherwise a call to this function will result in a linker error.
+// the executable. Otherwise a call to this function will result in a linker error. In case the
+// LAPACK mode is disabled (see the BLAZE_LAPACK_MODE switch) or in case of matrices with a small
+// compile time maximum size (as for instance StaticMatrix), the decomposition is computed by the
+// native Blaze kernels and no LAPACK library is required.
 //
 // \note The LU decomposition will never fail, even for singular matrices. However, in case of a
 // singular matrix the resulting decomposition cannot be used for a matrix inversion or solving
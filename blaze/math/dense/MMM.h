@@ -56,6 +56,8 @@
 #include <blaze/math/constraints/Lower.h>
 #include <blaze/math/constraints/Upper.h>
 #include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/PackedMMM.h>
+#include <blaze/math/dense/PackingArena.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/IsOne.h>
@@ -70,6 +72,7 @@
 #include <blaze/system/Blocking.h>
 #include <blaze/util/algorithms/Min.h>
 #include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/IsFloatingPoint.h>
@@ -103,7 +106,8 @@ namespace blaze {
 // combinable, i.e. must provide a common SIMD interface.
 */
 template< typename MT1, typename MT2, typename MT3, typename ST >
-void mmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST beta )
+auto mmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST beta )
+   -> DisableIf_t< UsePackedMMM_v<MT1,MT2,MT3> >
 {
    using ET1 = ElementType_t<MT1>;
    using ET2 = ElementType_t<MT2>;
@@ -140,8 +144,9 @@ void mmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST be
 
    BLAZE_INTERNAL_ASSERT( A.columns() == B.rows(), "Invalid matrix sizes detected" );
 
-   DynamicMatrix<ET2,false> A2( M, KBLOCK );
-   DynamicMatrix<ET3,true>  B2( KBLOCK, JBLOCK );
+   PackingArena& arena( PackingArena::instance() );
+   DynamicMatrix<ET2,false>& A2( arena.acquire<ET2,false>( M, KBLOCK ) );
+   DynamicMatrix<ET3,true>&  B2( arena.acquire<ET3,true> ( KBLOCK, JBLOCK ) );
 
    if( isDefault( beta ) ) {
       reset( ~C );
@@ -603,7 +608,8 @@ void mmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST be
 // combinable, i.e. must provide a common SIMD interface.
 */
 template< typename MT1, typename MT2, typename MT3, typename ST >
-void mmm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST beta )
+auto mmm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST beta )
+   -> DisableIf_t< UsePackedMMM_v<MT1,MT2,MT3> >
 {
    using ET1 = ElementType_t<MT1>;
    using ET2 = ElementType_t<MT2>;
@@ -640,8 +646,9 @@ void mmm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST bet
 
    BLAZE_INTERNAL_ASSERT( A.columns() == B.rows(), "Invalid matrix sizes detected" );
 
-   DynamicMatrix<ET2,false> A2( IBLOCK, KBLOCK );
-   DynamicMatrix<ET3,true>  B2( KBLOCK, N );
+   PackingArena& arena( PackingArena::instance() );
+   DynamicMatrix<ET2,false>& A2( arena.acquire<ET2,false>( IBLOCK, KBLOCK ) );
+   DynamicMatrix<ET3,true>&  B2( arena.acquire<ET3,true> ( KBLOCK, N ) );
 
    if( isDefault( beta ) ) {
       reset( ~C );
@@ -1067,6 +1074,33 @@ void mmm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST bet
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packed compute kernel for a general dense matrix/dense matrix multiplication
+//        (\f$ C=\alpha*A*B+\beta*C \f$).
+// \ingroup dense_matrix
+//
+// \param C The target left-hand side dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \return void
+//
+// This function relays a general dense matrix/dense matrix multiplication of the form
+// \f$ C=\alpha*A*B+\beta*C \f$ to the packed kernel pmmm() in case all three matrices have
+// the same floating point element type and neither \a A nor \a B is a triangular matrix.
+*/
+template< typename MT1, bool SO, typename MT2, typename MT3, typename ST >
+inline auto mmm( DenseMatrix<MT1,SO>& C, const MT2& A, const MT3& B, ST alpha, ST beta )
+   -> EnableIf_t< UsePackedMMM_v<MT1,MT2,MT3> >
+{
+   pmmm( C, A, B, alpha, beta );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Compute kernel for a general dense matrix/dense matrix multiplication (\f$ C=A*B \f$).
@@ -1168,8 +1202,9 @@ void lmmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST b
 
    BLAZE_INTERNAL_ASSERT( A.columns() == B.rows(), "Invalid matrix sizes detected" );
 
-   DynamicMatrix<ET2,false> A2( M, KBLOCK );
-   DynamicMatrix<ET3,true>  B2( KBLOCK, JBLOCK );
+   PackingArena& arena( PackingArena::instance() );
+   DynamicMatrix<ET2,false>& A2( arena.acquire<ET2,false>( M, KBLOCK ) );
+   DynamicMatrix<ET3,true>&  B2( arena.acquire<ET3,true> ( KBLOCK, JBLOCK ) );
 
    decltype(auto) c( derestrict( ~C ) );
 
@@ -1694,8 +1729,9 @@ void lmmm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST be
 
    BLAZE_INTERNAL_ASSERT( A.columns() == B.rows(), "Invalid matrix sizes detected" );
 
-   DynamicMatrix<ET2,false> A2( IBLOCK, KBLOCK );
-   DynamicMatrix<ET3,true>  B2( KBLOCK, N );
+   PackingArena& arena( PackingArena::instance() );
+   DynamicMatrix<ET2,false>& A2( arena.acquire<ET2,false>( IBLOCK, KBLOCK ) );
+   DynamicMatrix<ET3,true>&  B2( arena.acquire<ET3,true> ( KBLOCK, N ) );
 
    decltype(auto) c( derestrict( ~C ) );
 
@@ -2238,8 +2274,9 @@ void ummm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST b
 
    BLAZE_INTERNAL_ASSERT( A.columns() == B.rows(), "Invalid matrix sizes detected" );
 
-   DynamicMatrix<ET2,false> A2( M, KBLOCK );
-   DynamicMatrix<ET3,true>  B2( KBLOCK, JBLOCK );
+   PackingArena& arena( PackingArena::instance() );
+   DynamicMatrix<ET2,false>& A2( arena.acquire<ET2,false>( M, KBLOCK ) );
+   DynamicMatrix<ET3,true>&  B2( arena.acquire<ET3,true> ( KBLOCK, JBLOCK ) );
 
    decltype(auto) c( derestrict( ~C ) );
 
@@ -2756,8 +2793,9 @@ void ummm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST be
 
    BLAZE_INTERNAL_ASSERT( A.columns() == B.rows(), "Invalid matrix sizes detected" );
 
-   DynamicMatrix<ET2,false> A2( IBLOCK, KBLOCK );
-   DynamicMatrix<ET3,true>  B2( KBLOCK, N );
+   PackingArena& arena( PackingArena::instance() );
+   DynamicMatrix<ET2,false>& A2( arena.acquire<ET2,false>( IBLOCK, KBLOCK ) );
+   DynamicMatrix<ET3,true>&  B2( arena.acquire<ET3,true> ( KBLOCK, N ) );
 
    decltype(auto) c( derestrict( ~C ) );
 
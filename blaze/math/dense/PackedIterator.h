@@ -0,0 +1,614 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/PackedIterator.h
+//  \brief Header file for the PackedIterator class template
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//
+//  * The names of its contributors may not be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_PACKEDITERATOR_H_
+#define _BLAZE_MATH_DENSE_PACKEDITERATOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <iterator>
+#include <blaze/math/typetraits/StorageOrder.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/typetraits/IsConst.h>
+#include <blaze/util/typetraits/IsReference.h>
+#include <blaze/util/typetraits/RemoveConst.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Implementation of a generic iterator for matrices with packed storage.
+// \ingroup math
+//
+// The PackedIterator represents a generic random-access iterator over a single row (row-major
+// matrices) or a single column (column-major matrices) of a matrix with packed triangular or
+// symmetric storage (see the PackedMatrix class template). Since in packed storage a row or
+// column is not contiguous in memory, the iterator does not refer to an element by pointer,
+// but by means of the row and column index, which are passed to the function call operator
+// of the underlying matrix. Therefore the iterator can be used for all kinds of packed
+// matrices, including the adaptors with proxy reference types.
+*/
+template< typename MT >  // Type of the matrix
+class PackedIterator
+{
+ private:
+   //**Type definitions****************************************************************************
+   using RMT = RemoveConst_t<MT>;  //!< Matrix type without const-qualifier.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Compilation switch for the storage order of the matrix.
+   static constexpr bool SO = StorageOrder_v<RMT>;
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   //! Reference return type.
+   using ReferenceType = If_t< IsConst_v<MT>
+                             , typename RMT::ConstReference
+                             , typename RMT::Reference >;
+
+   //! Pointer return type.
+   using PointerType = If_t< IsReference_v<ReferenceType>
+                           , RemoveReference_t<ReferenceType>*
+                           , ReferenceType >;
+
+   using IteratorCategory = std::random_access_iterator_tag;  //!< The iterator category.
+   using ValueType        = typename RMT::ElementType;        //!< Type of the underlying elements.
+   using DifferenceType   = ptrdiff_t;                        //!< Difference between two iterators.
+
+   // STL iterator requirements
+   using iterator_category = IteratorCategory;  //!< The iterator category.
+   using value_type        = ValueType;         //!< Type of the underlying elements.
+   using pointer           = PointerType;       //!< Pointer return type.
+   using reference         = ReferenceType;     //!< Reference return type.
+   using difference_type   = DifferenceType;    //!< Difference between two iterators.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline PackedIterator() noexcept;
+   explicit inline PackedIterator( MT& matrix, size_t line, size_t index ) noexcept;
+
+   template< typename MT2 >
+   inline PackedIterator( const PackedIterator<MT2>& it ) noexcept;
+
+   PackedIterator( const PackedIterator& ) = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   ~PackedIterator() = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline PackedIterator& operator+=( ptrdiff_t inc ) noexcept;
+   inline PackedIterator& operator-=( ptrdiff_t dec ) noexcept;
+
+   PackedIterator& operator=( const PackedIterator& ) = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Increment/decrement operators***************************************************************
+   /*!\name Increment/decrement operators */
+   //@{
+   inline PackedIterator&      operator++()      noexcept;
+   inline const PackedIterator operator++( int ) noexcept;
+   inline PackedIterator&      operator--()      noexcept;
+   inline const PackedIterator operator--( int ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Access operators****************************************************************************
+   /*!\name Access operators */
+   //@{
+   inline ReferenceType operator[]( size_t index ) const;
+   inline ReferenceType operator*() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline MT*    mat () const noexcept;
+   inline size_t line() const noexcept;
+   inline size_t idx () const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   MT*    matrix_;  //!< Pointer to the matrix.
+   size_t line_;    //!< Index of the row/column the iterator is traversing.
+   size_t index_;   //!< Index of the current element within the row/column.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Default constructor for the PackedIterator class.
+*/
+template< typename MT >  // Type of the matrix
+inline PackedIterator<MT>::PackedIterator() noexcept
+   : matrix_( nullptr )  // Pointer to the matrix
+   , line_  ( 0UL )      // Index of the row/column the iterator is traversing
+   , index_ ( 0UL )      // Index of the current element within the row/column
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for the PackedIterator class.
+//
+// \param matrix The matrix to be traversed.
+// \param line The index of the row/column to be traversed.
+// \param index The index of the initial element within the row/column.
+*/
+template< typename MT >  // Type of the matrix
+inline PackedIterator<MT>::PackedIterator( MT& matrix, size_t line, size_t index ) noexcept
+   : matrix_( &matrix )  // Pointer to the matrix
+   , line_  ( line    )  // Index of the row/column the iterator is traversing
+   , index_ ( index   )  // Index of the current element within the row/column
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different PackedIterator instances.
+//
+// \param it The foreign PackedIterator instance to be copied.
+*/
+template< typename MT >   // Type of the matrix
+template< typename MT2 >  // Type of the foreign matrix
+inline PackedIterator<MT>::PackedIterator( const PackedIterator<MT2>& it ) noexcept
+   : matrix_( it.mat()  )  // Pointer to the matrix
+   , line_  ( it.line() )  // Index of the row/column the iterator is traversing
+   , index_ ( it.idx()  )  // Index of the current element within the row/column
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator.
+//
+// \param inc The increment of the iterator.
+// \return Reference to the incremented iterator.
+*/
+template< typename MT >  // Type of the matrix
+inline PackedIterator<MT>& PackedIterator<MT>::operator+=( ptrdiff_t inc ) noexcept
+{
+   index_ += inc;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator.
+//
+// \param dec The decrement of the iterator.
+// \return Reference to the decremented iterator.
+*/
+template< typename MT >  // Type of the matrix
+inline PackedIterator<MT>& PackedIterator<MT>::operator-=( ptrdiff_t dec ) noexcept
+{
+   index_ -= dec;
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INCREMENT/DECREMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Pre-increment operator.
+//
+// \return Reference to the incremented iterator.
+*/
+template< typename MT >  // Type of the matrix
+inline PackedIterator<MT>& PackedIterator<MT>::operator++() noexcept
+{
+   ++index_;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Post-increment operator.
+//
+// \return The previous position of the iterator.
+*/
+template< typename MT >  // Type of the matrix
+inline const PackedIterator<MT> PackedIterator<MT>::operator++( int ) noexcept
+{
+   return PackedIterator( *matrix_, line_, index_++ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Pre-decrement operator.
+//
+// \return Reference to the decremented iterator.
+*/
+template< typename MT >  // Type of the matrix
+inline PackedIterator<MT>& PackedIterator<MT>::operator--() noexcept
+{
+   --index_;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Post-decrement operator.
+//
+// \return The previous position of the iterator.
+*/
+template< typename MT >  // Type of the matrix
+inline const PackedIterator<MT> PackedIterator<MT>::operator--( int ) noexcept
+{
+   return PackedIterator( *matrix_, line_, index_-- );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ACCESS OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Direct access to the underlying elements.
+//
+// \param index Access index.
+// \return Reference to the accessed value.
+*/
+template< typename MT >  // Type of the matrix
+inline typename PackedIterator<MT>::ReferenceType
+   PackedIterator<MT>::operator[]( size_t index ) const
+{
+   BLAZE_INTERNAL_ASSERT( matrix_ != nullptr, "Uninitialized packed iterator detected" );
+
+   if( SO )
+      return (*matrix_)( index_+index, line_ );
+   else
+      return (*matrix_)( line_, index_+index );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Direct access to the element at the current iterator position.
+//
+// \return Reference to the current element.
+*/
+template< typename MT >  // Type of the matrix
+inline typename PackedIterator<MT>::ReferenceType
+   PackedIterator<MT>::operator*() const
+{
+   return (*this)[0UL];
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Access to the traversed matrix.
+//
+// \return Pointer to the traversed matrix.
+*/
+template< typename MT >  // Type of the matrix
+inline MT* PackedIterator<MT>::mat() const noexcept
+{
+   return matrix_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Access to the index of the traversed row/column.
+//
+// \return Index of the traversed row/column.
+*/
+template< typename MT >  // Type of the matrix
+inline size_t PackedIterator<MT>::line() const noexcept
+{
+   return line_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Access to the current index of the iterator within the traversed row/column.
+//
+// \return Index of the current element.
+*/
+template< typename MT >  // Type of the matrix
+inline size_t PackedIterator<MT>::idx() const noexcept
+{
+   return index_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name PackedIterator operators */
+//@{
+template< typename MT1, typename MT2 >
+inline bool operator==( const PackedIterator<MT1>& lhs, const PackedIterator<MT2>& rhs ) noexcept;
+
+template< typename MT1, typename MT2 >
+inline bool operator!=( const PackedIterator<MT1>& lhs, const PackedIterator<MT2>& rhs ) noexcept;
+
+template< typename MT1, typename MT2 >
+inline bool operator<( const PackedIterator<MT1>& lhs, const PackedIterator<MT2>& rhs ) noexcept;
+
+template< typename MT1, typename MT2 >
+inline bool operator>( const PackedIterator<MT1>& lhs, const PackedIterator<MT2>& rhs ) noexcept;
+
+template< typename MT1, typename MT2 >
+inline bool operator<=( const PackedIterator<MT1>& lhs, const PackedIterator<MT2>& rhs ) noexcept;
+
+template< typename MT1, typename MT2 >
+inline bool operator>=( const PackedIterator<MT1>& lhs, const PackedIterator<MT2>& rhs ) noexcept;
+
+template< typename MT >
+inline const PackedIterator<MT> operator+( const PackedIterator<MT>& it, ptrdiff_t inc ) noexcept;
+
+template< typename MT >
+inline const PackedIterator<MT> operator+( ptrdiff_t inc, const PackedIterator<MT>& it ) noexcept;
+
+template< typename MT >
+inline const PackedIterator<MT> operator-( const PackedIterator<MT>& it, ptrdiff_t dec ) noexcept;
+
+template< typename MT1, typename MT2 >
+inline ptrdiff_t operator-( const PackedIterator<MT1>& lhs, const PackedIterator<MT2>& rhs ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Equality comparison between two PackedIterator objects.
+//
+// \param lhs The left-hand side iterator.
+// \param rhs The right-hand side iterator.
+// \return \a true if the iterators refer to the same element, \a false if not.
+*/
+template< typename MT1    // Matrix type of the left-hand side iterator
+        , typename MT2 >  // Matrix type of the right-hand side iterator
+inline bool operator==( const PackedIterator<MT1>& lhs, const PackedIterator<MT2>& rhs ) noexcept
+{
+   return lhs.idx() == rhs.idx();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inequality comparison between two PackedIterator objects.
+//
+// \param lhs The left-hand side iterator.
+// \param rhs The right-hand side iterator.
+// \return \a true if the iterators don't refer to the same element, \a false if they do.
+*/
+template< typename MT1    // Matrix type of the left-hand side iterator
+        , typename MT2 >  // Matrix type of the right-hand side iterator
+inline bool operator!=( const PackedIterator<MT1>& lhs, const PackedIterator<MT2>& rhs ) noexcept
+{
+   return lhs.idx() != rhs.idx();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Less-than comparison between two PackedIterator objects.
+//
+// \param lhs The left-hand side iterator.
+// \param rhs The right-hand side iterator.
+// \return \a true if the left-hand side iterator is smaller, \a false if not.
+*/
+template< typename MT1    // Matrix type of the left-hand side iterator
+        , typename MT2 >  // Matrix type of the right-hand side iterator
+inline bool operator<( const PackedIterator<MT1>& lhs, const PackedIterator<MT2>& rhs ) noexcept
+{
+   return lhs.idx() < rhs.idx();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Greater-than comparison between two PackedIterator objects.
+//
+// \param lhs The left-hand side iterator.
+// \param rhs The right-hand side iterator.
+// \return \a true if the left-hand side iterator is greater, \a false if not.
+*/
+template< typename MT1    // Matrix type of the left-hand side iterator
+        , typename MT2 >  // Matrix type of the right-hand side iterator
+inline bool operator>( const PackedIterator<MT1>& lhs, const PackedIterator<MT2>& rhs ) noexcept
+{
+   return lhs.idx() > rhs.idx();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Less-or-equal-than comparison between two PackedIterator objects.
+//
+// \param lhs The left-hand side iterator.
+// \param rhs The right-hand side iterator.
+// \return \a true if the left-hand side iterator is smaller or equal, \a false if not.
+*/
+template< typename MT1    // Matrix type of the left-hand side iterator
+        , typename MT2 >  // Matrix type of the right-hand side iterator
+inline bool operator<=( const PackedIterator<MT1>& lhs, const PackedIterator<MT2>& rhs ) noexcept
+{
+   return lhs.idx() <= rhs.idx();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Greater-or-equal-than comparison between two PackedIterator objects.
+//
+// \param lhs The left-hand side iterator.
+// \param rhs The right-hand side iterator.
+// \return \a true if the left-hand side iterator is greater or equal, \a false if not.
+*/
+template< typename MT1    // Matrix type of the left-hand side iterator
+        , typename MT2 >  // Matrix type of the right-hand side iterator
+inline bool operator>=( const PackedIterator<MT1>& lhs, const PackedIterator<MT2>& rhs ) noexcept
+{
+   return lhs.idx() >= rhs.idx();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition between a PackedIterator and an integral value.
+//
+// \param it The iterator to be incremented.
+// \param inc The number of elements the iterator is incremented.
+// \return The incremented iterator.
+*/
+template< typename MT >  // Type of the matrix
+inline const PackedIterator<MT> operator+( const PackedIterator<MT>& it, ptrdiff_t inc ) noexcept
+{
+   return PackedIterator<MT>( *it.mat(), it.line(), it.idx() + inc );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition between an integral value and a PackedIterator.
+//
+// \param inc The number of elements the iterator is incremented.
+// \param it The iterator to be incremented.
+// \return The incremented iterator.
+*/
+template< typename MT >  // Type of the matrix
+inline const PackedIterator<MT> operator+( ptrdiff_t inc, const PackedIterator<MT>& it ) noexcept
+{
+   return PackedIterator<MT>( *it.mat(), it.line(), it.idx() + inc );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction between a PackedIterator and an integral value.
+//
+// \param it The iterator to be decremented.
+// \param dec The number of elements the iterator is decremented.
+// \return The decremented iterator.
+*/
+template< typename MT >  // Type of the matrix
+inline const PackedIterator<MT> operator-( const PackedIterator<MT>& it, ptrdiff_t dec ) noexcept
+{
+   return PackedIterator<MT>( *it.mat(), it.line(), it.idx() - dec );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calculating the number of elements between two PackedIterator objects.
+//
+// \param lhs The left-hand side iterator.
+// \param rhs The right-hand side iterator.
+// \return The number of elements between the two iterators.
+*/
+template< typename MT1    // Matrix type of the left-hand side iterator
+        , typename MT2 >  // Matrix type of the right-hand side iterator
+inline ptrdiff_t operator-( const PackedIterator<MT1>& lhs, const PackedIterator<MT2>& rhs ) noexcept
+{
+   return lhs.idx() - rhs.idx();
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,553 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/PackedKernels.h
+//  \brief Header file for the packed matrix multiplication kernels
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//
+//  * The names of its contributors may not be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_PACKEDKERNELS_H_
+#define _BLAZE_MATH_DENSE_PACKEDKERNELS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/PackedMatrix.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/PrevMultiple.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasMutableDataAccess.h>
+#include <blaze/math/typetraits/HasSIMDAdd.h>
+#include <blaze/math/typetraits/HasSIMDConj.h>
+#include <blaze/math/typetraits/HasSIMDMult.h>
+#include <blaze/math/typetraits/IsContiguous.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsComplex.h>
+#include <blaze/util/typetraits/IsSame.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the packed matrix multiplication kernels.
+// \ingroup packed_matrix
+//
+// The packed matrix multiplication kernels compute the product of a packed matrix (see
+// PackedMatrix) with a dense vector or a dense matrix. The three boolean template parameters
+// specify how the stored lower triangle \f$ L \f$ is interpreted:
+//
+//  - LOW : the lower triangle (including the diagonal) is part of the matrix
+//  - UPP : the transposed lower triangle (including the diagonal) is part of the matrix
+//  - HERM: the transposed lower triangle is conjugated
+//
+// Thus the combination (LOW,UPP,HERM) is (true,true,false) for a symmetric matrix, (true,true,
+// true) for a Hermitian matrix, (true,false,false) for a lower matrix and (false,true,false)
+// for an upper matrix.
+*/
+template< bool HERM      // Conjugation flag
+        , typename T1    // Element type of the target
+        , typename T2    // Element type of the packed matrix
+        , typename T3 >  // Element type of the right-hand side operand
+struct PackedKernelHelper
+{
+   //**********************************************************************************************
+   //! Compilation switch for the SIMD optimized packed matrix/dense vector multiplication kernel.
+   static constexpr bool simdVec =
+      ( useOptimizedKernels &&
+        IsSame_v<T1,T2> && IsSame_v<T1,T3> &&
+        HasSIMDAdd_v<T1,T1> && HasSIMDMult_v<T1,T1> &&
+        ( !HERM || !IsComplex_v<T1> || HasSIMDConj_v<T1> ) );
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Compilation switch for the SIMD optimized packed matrix/dense matrix multiplication kernel.
+   static constexpr bool simdMat =
+      ( useOptimizedKernels &&
+        IsSame_v<T1,T2> && IsSame_v<T1,T3> &&
+        HasSIMDAdd_v<T1,T1> && HasSIMDMult_v<T1,T1> );
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the given element of the transposed lower triangle of a packed matrix.
+// \ingroup packed_matrix
+//
+// \param a The element of the stored lower triangle.
+// \return The conjugated element in case \a HERM is \a true, the unmodified element otherwise.
+*/
+template< bool HERM     // Conjugation flag
+        , typename T >  // Type of the element
+BLAZE_ALWAYS_INLINE auto packedTrans( const T& a )
+   -> EnableIf_t< HERM, T >
+{
+   return conj( a );
+}
+
+template< bool HERM     // Conjugation flag
+        , typename T >  // Type of the element
+BLAZE_ALWAYS_INLINE auto packedTrans( const T& a )
+   -> EnableIf_t< !HERM, const T& >
+{
+   return a;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PACKED MATRIX/DENSE VECTOR MULTIPLICATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default kernel for the multiplication of a packed matrix and a dense vector
+//        (\f$ \vec{y}+=A*\vec{x} \f$).
+// \ingroup packed_matrix
+//
+// \param y The target dense vector.
+// \param A The left-hand side packed matrix.
+// \param x The right-hand side dense vector.
+// \return void
+//
+// This function implements the default kernel for the multiplication of a packed matrix and a
+// dense vector. Each stored element of the matrix is read exactly once and is used both for
+// the lower and (depending on the LOW, UPP and HERM flags) the upper part of the product.
+*/
+template< bool LOW        // Flag for the lower part of the matrix
+        , bool UPP        // Flag for the upper part of the matrix
+        , bool HERM       // Conjugation flag
+        , typename VT1    // Type of the target dense vector
+        , typename Type   // Element type of the packed matrix
+        , bool SO         // Storage order of the packed matrix
+        , typename VT2 >  // Type of the right-hand side dense vector
+inline auto pmatdvecmultKernel( VT1& y, const PackedMatrix<Type,SO>& A, const VT2& x )
+   -> DisableIf_t< PackedKernelHelper< HERM, ElementType_t<VT1>, Type, ElementType_t<VT2> >::simdVec &&
+                   IsContiguous_v<VT1> && HasMutableDataAccess_v<VT1> &&
+                   IsContiguous_v<VT2> && HasConstDataAccess_v<VT2> >
+{
+   using ET = ElementType_t<VT1>;
+
+   const size_t N( A.rows() );
+
+   for( size_t k=0UL; k<N; ++k )
+   {
+      const Type* p( A.data(k) );
+
+      if( SO )
+      {
+         ET tmp( p[0UL] * x[k] );
+
+         for( size_t i=k+1UL; i<N; ++i ) {
+            if( UPP ) tmp  += packedTrans<HERM>( p[i-k] ) * x[i];
+            if( LOW ) y[i] += p[i-k] * x[k];
+         }
+
+         y[k] += tmp;
+      }
+      else
+      {
+         ET tmp( p[k] * x[k] );
+
+         for( size_t j=0UL; j<k; ++j ) {
+            if( LOW ) tmp  += p[j] * x[j];
+            if( UPP ) y[j] += packedTrans<HERM>( p[j] ) * x[k];
+         }
+
+         y[k] += tmp;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized kernel for the multiplication of a packed matrix and a dense vector
+//        (\f$ \vec{y}+=A*\vec{x} \f$).
+// \ingroup packed_matrix
+//
+// \param y The target dense vector.
+// \param A The left-hand side packed matrix.
+// \param x The right-hand side dense vector.
+// \return void
+//
+// This function implements the vectorized kernel for the multiplication of a packed matrix and
+// a dense vector. The stored elements of each row/column of the packed matrix are streamed
+// once: they are combined with \a x into a dot product for the lower part and are used for an
+// update of \a y for the upper part (or vice versa in case of column-major storage).
+*/
+template< bool LOW        // Flag for the lower part of the matrix
+        , bool UPP        // Flag for the upper part of the matrix
+        , bool HERM       // Conjugation flag
+        , typename VT1    // Type of the target dense vector
+        , typename Type   // Element type of the packed matrix
+        , bool SO         // Storage order of the packed matrix
+        , typename VT2 >  // Type of the right-hand side dense vector
+inline auto pmatdvecmultKernel( VT1& y, const PackedMatrix<Type,SO>& A, const VT2& x )
+   -> EnableIf_t< PackedKernelHelper< HERM, ElementType_t<VT1>, Type, ElementType_t<VT2> >::simdVec &&
+                  IsContiguous_v<VT1> && HasMutableDataAccess_v<VT1> &&
+                  IsContiguous_v<VT2> && HasConstDataAccess_v<VT2> >
+{
+   using SIMDType = SIMDTrait_t<Type>;
+
+   constexpr size_t SIMDSIZE( SIMDType::size );
+
+   const size_t N( A.rows() );
+
+   Type* const yp( y.data() );
+   const Type* const xp( x.data() );
+
+   for( size_t k=0UL; k<N; ++k )
+   {
+      const Type* p( A.data(k) );
+
+      if( SO )
+      {
+         const size_t len ( N - k - 1UL );
+         const size_t lpos( prevMultiple( len, SIMDSIZE ) );
+
+         const Type* const p1( p + 1UL );
+         const Type* const x1( xp + k + 1UL );
+         Type* const y1( yp + k + 1UL );
+
+         const SIMDType xk( set( xp[k] ) );
+         SIMDType xmm1;
+
+         for( size_t l=0UL; l<lpos; l+=SIMDSIZE ) {
+            const SIMDType a( loadu( p1+l ) );
+            if( UPP ) xmm1 += packedTrans<HERM>( a ) * loadu( x1+l );
+            if( LOW ) storeu( y1+l, SIMDType( loadu( y1+l ) + a * xk ) );
+         }
+
+         Type tmp( p[0UL] * xp[k] );
+         if( UPP ) tmp += sum( xmm1 );
+
+         for( size_t l=lpos; l<len; ++l ) {
+            if( UPP ) tmp   += packedTrans<HERM>( p1[l] ) * x1[l];
+            if( LOW ) y1[l] += p1[l] * xp[k];
+         }
+
+         yp[k] += tmp;
+      }
+      else
+      {
+         const size_t kpos( prevMultiple( k, SIMDSIZE ) );
+
+         const SIMDType xk( set( xp[k] ) );
+         SIMDType xmm1;
+
+         for( size_t j=0UL; j<kpos; j+=SIMDSIZE ) {
+            const SIMDType a( loadu( p+j ) );
+            if( LOW ) xmm1 += a * loadu( xp+j );
+            if( UPP ) storeu( yp+j, SIMDType( loadu( yp+j ) + packedTrans<HERM>( a ) * xk ) );
+         }
+
+         Type tmp( p[k] * xp[k] );
+         if( LOW ) tmp += sum( xmm1 );
+
+         for( size_t j=kpos; j<k; ++j ) {
+            if( LOW ) tmp   += p[j] * xp[j];
+            if( UPP ) yp[j] += packedTrans<HERM>( p[j] ) * xp[k];
+         }
+
+         yp[k] += tmp;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication of a packed matrix and a dense vector (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup packed_matrix
+//
+// \param A The left-hand side packed matrix.
+// \param x The right-hand side dense vector.
+// \return The resulting vector of type \a RT.
+//
+// This function computes the product of a packed matrix and a dense vector, which is interpreted
+// according to the LOW, UPP and HERM flags (see PackedKernelHelper). The right-hand side vector
+// is evaluated in case it is not contiguous in memory. The function is used by the packed
+// specializations of the SymmetricMatrix, HermitianMatrix, LowerMatrix, and UpperMatrix
+// adaptors.
+*/
+template< bool LOW       // Flag for the lower part of the matrix
+        , bool UPP       // Flag for the upper part of the matrix
+        , bool HERM      // Conjugation flag
+        , typename RT    // Type of the resulting dense vector
+        , typename Type  // Element type of the packed matrix
+        , bool SO        // Storage order of the packed matrix
+        , typename VT >  // Type of the right-hand side dense vector
+inline RT pmatdvecmult( const PackedMatrix<Type,SO>& A, const DenseVector<VT,false>& x )
+{
+   using XT = If_t< IsContiguous_v<VT> && HasConstDataAccess_v<VT>, const VT&, const ResultType_t<VT> >;
+
+   BLAZE_INTERNAL_ASSERT( A.columns() == (~x).size(), "Invalid vector size" );
+
+   XT x2( ~x );
+
+   RT y;
+   resize( y, A.rows(), false );
+   reset( y );
+
+   pmatdvecmultKernel<LOW,UPP,HERM>( y, A, x2 );
+
+   return y;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PACKED MATRIX/DENSE MATRIX MULTIPLICATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default row update for the packed matrix/dense matrix multiplication
+//        (\f$ C(i,:)+=a*B(k,:) \f$).
+// \ingroup packed_matrix
+//
+// \param C The target row-major dense matrix.
+// \param i The row index of the target matrix.
+// \param a The scalar factor.
+// \param B The right-hand side row-major dense matrix.
+// \param k The row index of the right-hand side matrix.
+// \return void
+*/
+template< typename MT1   // Type of the target dense matrix
+        , typename ET    // Type of the scalar factor
+        , typename MT2 > // Type of the right-hand side dense matrix
+inline auto pmatdmatmultRow( MT1& C, size_t i, const ET& a, const MT2& B, size_t k )
+   -> DisableIf_t< PackedKernelHelper< false, ElementType_t<MT1>, ET, ElementType_t<MT2> >::simdMat &&
+                   HasMutableDataAccess_v<MT1> && HasConstDataAccess_v<MT2> >
+{
+   const size_t N( B.columns() );
+
+   for( size_t j=0UL; j<N; ++j ) {
+      C(i,j) += a * B(k,j);
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized row update for the packed matrix/dense matrix multiplication
+//        (\f$ C(i,:)+=a*B(k,:) \f$).
+// \ingroup packed_matrix
+//
+// \param C The target row-major dense matrix.
+// \param i The row index of the target matrix.
+// \param a The scalar factor.
+// \param B The right-hand side row-major dense matrix.
+// \param k The row index of the right-hand side matrix.
+// \return void
+*/
+template< typename MT1   // Type of the target dense matrix
+        , typename ET    // Type of the scalar factor
+        , typename MT2 > // Type of the right-hand side dense matrix
+inline auto pmatdmatmultRow( MT1& C, size_t i, const ET& a, const MT2& B, size_t k )
+   -> EnableIf_t< PackedKernelHelper< false, ElementType_t<MT1>, ET, ElementType_t<MT2> >::simdMat &&
+                  HasMutableDataAccess_v<MT1> && HasConstDataAccess_v<MT2> >
+{
+   using SIMDType = SIMDTrait_t<ET>;
+
+   constexpr size_t SIMDSIZE( SIMDType::size );
+
+   const size_t N( B.columns() );
+   const size_t jpos( prevMultiple( N, SIMDSIZE ) );
+
+   ET* const c( C.data(i) );
+   const ET* const b( B.data(k) );
+
+   const SIMDType a1( set( a ) );
+
+   size_t j( 0UL );
+
+   for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL ) {
+      storeu( c+j             , SIMDType( loadu( c+j              ) + a1 * loadu( b+j              ) ) );
+      storeu( c+j+SIMDSIZE    , SIMDType( loadu( c+j+SIMDSIZE     ) + a1 * loadu( b+j+SIMDSIZE     ) ) );
+      storeu( c+j+SIMDSIZE*2UL, SIMDType( loadu( c+j+SIMDSIZE*2UL ) + a1 * loadu( b+j+SIMDSIZE*2UL ) ) );
+      storeu( c+j+SIMDSIZE*3UL, SIMDType( loadu( c+j+SIMDSIZE*3UL ) + a1 * loadu( b+j+SIMDSIZE*3UL ) ) );
+   }
+   for( ; j<jpos; j+=SIMDSIZE ) {
+      storeu( c+j, SIMDType( loadu( c+j ) + a1 * loadu( b+j ) ) );
+   }
+   for( ; j<N; ++j ) {
+      c[j] += a * b[j];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Kernel for the multiplication of a packed matrix and a row-major dense matrix
+//        (\f$ C+=A*B \f$).
+// \ingroup packed_matrix
+//
+// \param C The target row-major dense matrix.
+// \param A The left-hand side packed matrix.
+// \param B The right-hand side row-major dense matrix.
+// \return void
+//
+// This function implements the kernel for the multiplication of a packed matrix and a row-major
+// dense matrix. Each stored element \f$ a \f$ of the matrix is read exactly once and is used
+// for up to two row updates of the form \f$ C(i,:)+=a*B(k,:) \f$, which are vectorized in case
+// the element types of all three matrices are identical and provide a SIMD interface.
+*/
+template< bool LOW        // Flag for the lower part of the matrix
+        , bool UPP        // Flag for the upper part of the matrix
+        , bool HERM       // Conjugation flag
+        , typename MT1    // Type of the target dense matrix
+        , typename Type   // Element type of the packed matrix
+        , bool SO         // Storage order of the packed matrix
+        , typename MT2 >  // Type of the right-hand side dense matrix
+inline void pmatdmatmultKernel( MT1& C, const PackedMatrix<Type,SO>& A, const MT2& B )
+{
+   const size_t N( A.rows() );
+
+   for( size_t k=0UL; k<N; ++k )
+   {
+      const Type* p( A.data(k) );
+
+      if( SO )
+      {
+         pmatdmatmultRow( C, k, p[0UL], B, k );
+
+         for( size_t i=k+1UL; i<N; ++i ) {
+            if( UPP ) pmatdmatmultRow( C, k, packedTrans<HERM>( p[i-k] ), B, i );
+            if( LOW ) pmatdmatmultRow( C, i, p[i-k], B, k );
+         }
+      }
+      else
+      {
+         for( size_t j=0UL; j<k; ++j ) {
+            if( LOW ) pmatdmatmultRow( C, k, p[j], B, j );
+            if( UPP ) pmatdmatmultRow( C, j, packedTrans<HERM>( p[j] ), B, k );
+         }
+
+         pmatdmatmultRow( C, k, p[k], B, k );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication of a packed matrix and a dense matrix (\f$ C=A*B \f$).
+// \ingroup packed_matrix
+//
+// \param A The left-hand side packed matrix.
+// \param B The right-hand side dense matrix.
+// \return The resulting matrix of type \a RT.
+//
+// This function computes the product of a packed matrix and a dense matrix, which is interpreted
+// according to the LOW, UPP and HERM flags (see PackedKernelHelper). The kernel operates on
+// rows of \a B and \a C. Therefore \a B is converted to a row-major matrix and the product is
+// computed in a row-major temporary in case the given matrix types do not provide direct
+// access to their rows. The function is used by the packed specializations of the
+// SymmetricMatrix, HermitianMatrix, LowerMatrix, and UpperMatrix adaptors.
+*/
+template< bool LOW       // Flag for the lower part of the matrix
+        , bool UPP       // Flag for the upper part of the matrix
+        , bool HERM      // Conjugation flag
+        , typename RT    // Type of the resulting dense matrix
+        , typename Type  // Element type of the packed matrix
+        , bool SO        // Storage order of the packed matrix
+        , typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline RT pmatdmatmult( const PackedMatrix<Type,SO>& A, const DenseMatrix<MT,SO2>& B )
+{
+   using BT = If_t< IsRowMajorMatrix_v<MT> && HasConstDataAccess_v<MT>
+                  , const MT&
+                  , const DynamicMatrix< ElementType_t<MT>, rowMajor > >;
+
+   using CT = If_t< IsRowMajorMatrix_v<RT> && HasMutableDataAccess_v<RT>
+                  , RT
+                  , DynamicMatrix< ElementType_t<RT>, rowMajor > >;
+
+   BLAZE_INTERNAL_ASSERT( A.columns() == (~B).rows(), "Invalid matrix sizes" );
+
+   BT B2( ~B );
+
+   CT C;
+   resize( C, A.rows(), B2.columns(), false );
+   reset( C );
+
+   pmatdmatmultKernel<LOW,UPP,HERM>( C, A, B2 );
+
+   return RT( std::move( C ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,688 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/PackedMMM.h
+//  \brief Header file for the packed dense matrix multiplication kernel
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_PACKEDMMM_H_
+#define _BLAZE_MATH_DENSE_PACKEDMMM_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/Adaptor.h>
+#include <blaze/math/constraints/Computation.h>
+#include <blaze/math/constraints/DenseMatrix.h>
+#include <blaze/math/dense/PackedMMMBlocking.h>
+#include <blaze/math/dense/PackingArena.h>
+#include <blaze/math/dispatch/Functions.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/IsOne.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/math/typetraits/IsUpper.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/AlignedArray.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsFloatingPoint.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/IsVectorizable.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  TYPE TRAITS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compile time check whether the packed kernel can be used for the given matrices.
+// \ingroup dense_matrix
+//
+// The packed kernel is used for general (i.e. non-triangular) operands with identical floating
+// point element types in case vectorization is enabled. For triangular operands the panel based
+// mmm() kernel is preferable since it skips the zero blocks of the operands.
+*/
+template< typename MT1, typename MT2, typename MT3 >
+constexpr bool UsePackedMMM_v =
+   ( usePackedMatrixMultiplication &&
+     IsFloatingPoint_v< ElementType_t<MT1> > &&
+     IsVectorizable_v< ElementType_t<MT1> > &&
+     IsSame_v< ElementType_t<MT1>, ElementType_t<MT2> > &&
+     IsSame_v< ElementType_t<MT1>, ElementType_t<MT3> > &&
+     !IsLower_v<MT2> && !IsUpper_v<MT2> && !IsLower_v<MT3> && !IsUpper_v<MT3> );
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MICRO-KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Micro-kernel for a \f$ 4 \times 2 \f$ SIMD vector register tile (SSE).
+// \ingroup dense_matrix
+//
+// \param kc The depth of the packed panels.
+// \param a The packed \f$ 4 \times kc \f$ panel of the left-hand side operand.
+// \param b The packed \f$ kc \times NR \f$ panel of the right-hand side operand.
+// \param ab The aligned output tile.
+// \return void
+*/
+template< typename T >  // Element type
+BLAZE_ALWAYS_INLINE void pmmmKernel4x2( size_t kc, const T* BLAZE_RESTRICT a,
+                                        const T* BLAZE_RESTRICT b, T* BLAZE_RESTRICT ab )
+{
+   using SIMDType = SIMDTrait_t<T>;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<T>::size );
+
+   SIMDType xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8;
+
+   for( size_t k=0UL; k<kc; ++k )
+   {
+      const SIMDType b1( loada( b          ) );
+      const SIMDType b2( loada( b+SIMDSIZE ) );
+
+      SIMDType a1( set( a[0] ) );
+      xmm1 += a1 * b1;
+      xmm2 += a1 * b2;
+
+      a1 = set( a[1] );
+      xmm3 += a1 * b1;
+      xmm4 += a1 * b2;
+
+      a1 = set( a[2] );
+      xmm5 += a1 * b1;
+      xmm6 += a1 * b2;
+
+      a1 = set( a[3] );
+      xmm7 += a1 * b1;
+      xmm8 += a1 * b2;
+
+      a += 4UL;
+      b += 2UL*SIMDSIZE;
+   }
+
+   storea( ab             , xmm1 );
+   storea( ab+   SIMDSIZE , xmm2 );
+   storea( ab+ 2*SIMDSIZE , xmm3 );
+   storea( ab+ 3*SIMDSIZE , xmm4 );
+   storea( ab+ 4*SIMDSIZE , xmm5 );
+   storea( ab+ 5*SIMDSIZE , xmm6 );
+   storea( ab+ 6*SIMDSIZE , xmm7 );
+   storea( ab+ 7*SIMDSIZE , xmm8 );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Micro-kernel for a \f$ 6 \times 2 \f$ SIMD vector register tile (AVX/AVX2).
+// \ingroup dense_matrix
+//
+// \param kc The depth of the packed panels.
+// \param a The packed \f$ 6 \times kc \f$ panel of the left-hand side operand.
+// \param b The packed \f$ kc \times NR \f$ panel of the right-hand side operand.
+// \param ab The aligned output tile.
+// \return void
+*/
+template< typename T >  // Element type
+BLAZE_ALWAYS_INLINE void pmmmKernel6x2( size_t kc, const T* BLAZE_RESTRICT a,
+                                        const T* BLAZE_RESTRICT b, T* BLAZE_RESTRICT ab )
+{
+   using SIMDType = SIMDTrait_t<T>;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<T>::size );
+
+   SIMDType xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8, xmm9, xmm10, xmm11, xmm12;
+
+   for( size_t k=0UL; k<kc; ++k )
+   {
+      const SIMDType b1( loada( b          ) );
+      const SIMDType b2( loada( b+SIMDSIZE ) );
+
+      SIMDType a1( set( a[0] ) );
+      xmm1 += a1 * b1;
+      xmm2 += a1 * b2;
+
+      a1 = set( a[1] );
+      xmm3 += a1 * b1;
+      xmm4 += a1 * b2;
+
+      a1 = set( a[2] );
+      xmm5 += a1 * b1;
+      xmm6 += a1 * b2;
+
+      a1 = set( a[3] );
+      xmm7 += a1 * b1;
+      xmm8 += a1 * b2;
+
+      a1 = set( a[4] );
+      xmm9  += a1 * b1;
+      xmm10 += a1 * b2;
+
+      a1 = set( a[5] );
+      xmm11 += a1 * b1;
+      xmm12 += a1 * b2;
+
+      a += 6UL;
+      b += 2UL*SIMDSIZE;
+   }
+
+   storea( ab             , xmm1  );
+   storea( ab+   SIMDSIZE , xmm2  );
+   storea( ab+ 2*SIMDSIZE , xmm3  );
+   storea( ab+ 3*SIMDSIZE , xmm4  );
+   storea( ab+ 4*SIMDSIZE , xmm5  );
+   storea( ab+ 5*SIMDSIZE , xmm6  );
+   storea( ab+ 6*SIMDSIZE , xmm7  );
+   storea( ab+ 7*SIMDSIZE , xmm8  );
+   storea( ab+ 8*SIMDSIZE , xmm9  );
+   storea( ab+ 9*SIMDSIZE , xmm10 );
+   storea( ab+10*SIMDSIZE , xmm11 );
+   storea( ab+11*SIMDSIZE , xmm12 );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Micro-kernel for a \f$ 12 \times 2 \f$ SIMD vector register tile (AVX-512).
+// \ingroup dense_matrix
+//
+// \param kc The depth of the packed panels.
+// \param a The packed \f$ 12 \times kc \f$ panel of the left-hand side operand.
+// \param b The packed \f$ kc \times NR \f$ panel of the right-hand side operand.
+// \param ab The aligned output tile.
+// \return void
+*/
+template< typename T >  // Element type
+BLAZE_ALWAYS_INLINE void pmmmKernel12x2( size_t kc, const T* BLAZE_RESTRICT a,
+                                         const T* BLAZE_RESTRICT b, T* BLAZE_RESTRICT ab )
+{
+   using SIMDType = SIMDTrait_t<T>;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<T>::size );
+
+   SIMDType xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8, xmm9, xmm10, xmm11, xmm12,
+            xmm13, xmm14, xmm15, xmm16, xmm17, xmm18, xmm19, xmm20, xmm21, xmm22, xmm23, xmm24;
+
+   for( size_t k=0UL; k<kc; ++k )
+   {
+      const SIMDType b1( loada( b          ) );
+      const SIMDType b2( loada( b+SIMDSIZE ) );
+
+      SIMDType a1( set( a[0] ) );
+      SIMDType a2( set( a[1] ) );
+      xmm1 += a1 * b1;
+      xmm2 += a1 * b2;
+      xmm3 += a2 * b1;
+      xmm4 += a2 * b2;
+
+      a1 = set( a[2] );
+      a2 = set( a[3] );
+      xmm5 += a1 * b1;
+      xmm6 += a1 * b2;
+      xmm7 += a2 * b1;
+      xmm8 += a2 * b2;
+
+      a1 = set( a[4] );
+      a2 = set( a[5] );
+      xmm9  += a1 * b1;
+      xmm10 += a1 * b2;
+      xmm11 += a2 * b1;
+      xmm12 += a2 * b2;
+
+      a1 = set( a[6] );
+      a2 = set( a[7] );
+      xmm13 += a1 * b1;
+      xmm14 += a1 * b2;
+      xmm15 += a2 * b1;
+      xmm16 += a2 * b2;
+
+      a1 = set( a[8] );
+      a2 = set( a[9] );
+      xmm17 += a1 * b1;
+      xmm18 += a1 * b2;
+      xmm19 += a2 * b1;
+      xmm20 += a2 * b2;
+
+      a1 = set( a[10] );
+      a2 = set( a[11] );
+      xmm21 += a1 * b1;
+      xmm22 += a1 * b2;
+      xmm23 += a2 * b1;
+      xmm24 += a2 * b2;
+
+      a += 12UL;
+      b += 2UL*SIMDSIZE;
+   }
+
+   storea( ab             , xmm1  );
+   storea( ab+   SIMDSIZE , xmm2  );
+   storea( ab+ 2*SIMDSIZE , xmm3  );
+   storea( ab+ 3*SIMDSIZE , xmm4  );
+   storea( ab+ 4*SIMDSIZE , xmm5  );
+   storea( ab+ 5*SIMDSIZE , xmm6  );
+   storea( ab+ 6*SIMDSIZE , xmm7  );
+   storea( ab+ 7*SIMDSIZE , xmm8  );
+   storea( ab+ 8*SIMDSIZE , xmm9  );
+   storea( ab+ 9*SIMDSIZE , xmm10 );
+   storea( ab+10*SIMDSIZE , xmm11 );
+   storea( ab+11*SIMDSIZE , xmm12 );
+   storea( ab+12*SIMDSIZE , xmm13 );
+   storea( ab+13*SIMDSIZE , xmm14 );
+   storea( ab+14*SIMDSIZE , xmm15 );
+   storea( ab+15*SIMDSIZE , xmm16 );
+   storea( ab+16*SIMDSIZE , xmm17 );
+   storea( ab+17*SIMDSIZE , xmm18 );
+   storea( ab+18*SIMDSIZE , xmm19 );
+   storea( ab+19*SIMDSIZE , xmm20 );
+   storea( ab+20*SIMDSIZE , xmm21 );
+   storea( ab+21*SIMDSIZE , xmm22 );
+   storea( ab+22*SIMDSIZE , xmm23 );
+   storea( ab+23*SIMDSIZE , xmm24 );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Selection of the micro-kernel for the available instruction set.
+// \ingroup dense_matrix
+//
+// \param kc The depth of the packed panels.
+// \param a The packed \f$ MR \times kc \f$ panel of the left-hand side operand.
+// \param b The packed \f$ kc \times NR \f$ panel of the right-hand side operand.
+// \param ab The aligned output tile.
+// \return void
+*/
+template< typename T >  // Element type
+BLAZE_ALWAYS_INLINE void pmmmKernel( size_t kc, const T* BLAZE_RESTRICT a,
+                                     const T* BLAZE_RESTRICT b, T* BLAZE_RESTRICT ab )
+{
+   constexpr size_t MR( PackedMMMBlocking<T>::MR );
+
+   if( MR == 12UL )
+      pmmmKernel12x2( kc, a, b, ab );
+   else if( MR == 6UL )
+      pmmmKernel6x2( kc, a, b, ab );
+   else
+      pmmmKernel4x2( kc, a, b, ab );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PACKING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Access to an element of the left-hand side operand of the packed kernel.
+// \ingroup dense_matrix
+//
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param i The row index of the left-hand side operand.
+// \param k The column index of the left-hand side operand.
+// \return The accessed element.
+//
+// For a row-major target (\a SO = \a false) the packed kernel computes \f$ C=A*B \f$, for a
+// column-major target (\a SO = \a true) it computes \f$ C^T=B^T*A^T \f$, such that the SIMD
+// vectors of the register tiles always refer to contiguous elements of \a C.
+*/
+template< bool SO, typename MT2, typename MT3 >
+BLAZE_ALWAYS_INLINE decltype(auto) pmmmLeft( const MT2& A, const MT3& B, size_t i, size_t k )
+{
+   return SO ? B(k,i) : A(i,k);
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Access to an element of the right-hand side operand of the packed kernel.
+// \ingroup dense_matrix
+//
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param k The row index of the right-hand side operand.
+// \param j The column index of the right-hand side operand.
+// \return The accessed element.
+*/
+template< bool SO, typename MT2, typename MT3 >
+BLAZE_ALWAYS_INLINE decltype(auto) pmmmRight( const MT2& A, const MT3& B, size_t k, size_t j )
+{
+   return SO ? A(j,k) : B(k,j);
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packing of an \f$ mc \times kc \f$ block of the left-hand side operand.
+// \ingroup dense_matrix
+//
+// \param Ap The target buffer for the packed block.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param ic The first row of the block.
+// \param pc The first column of the block.
+// \param mc The number of rows of the block.
+// \param kc The number of columns of the block.
+// \param MR The number of rows of the register tile.
+// \return void
+//
+// The block is stored as a sequence of \f$ MR \times kc \f$ panels, each of which is stored
+// column by column. Incomplete panels are padded with zeros.
+*/
+template< bool SO, typename T, typename MT2, typename MT3 >
+void pmmmPackLeft( T* Ap, const MT2& A, const MT3& B,
+                   size_t ic, size_t pc, size_t mc, size_t kc, size_t MR )
+{
+   for( size_t ir=0UL; ir<mc; ir+=MR, Ap+=MR*kc )
+   {
+      const size_t mr( min( MR, mc-ir ) );
+
+      for( size_t r=0UL; r<mr; ++r ) {
+         for( size_t k=0UL; k<kc; ++k ) {
+            Ap[k*MR+r] = pmmmLeft<SO>( A, B, ic+ir+r, pc+k );
+         }
+      }
+
+      for( size_t r=mr; r<MR; ++r ) {
+         for( size_t k=0UL; k<kc; ++k ) {
+            Ap[k*MR+r] = T();
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packing of a \f$ kc \times nc \f$ block of the right-hand side operand.
+// \ingroup dense_matrix
+//
+// \param Bp The target buffer for the packed block.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param pc The first row of the block.
+// \param jc The first column of the block.
+// \param kc The number of rows of the block.
+// \param nc The number of columns of the block.
+// \param NR The number of columns of the register tile.
+// \return void
+//
+// The block is stored as a sequence of \f$ kc \times NR \f$ panels, each of which is stored
+// row by row. Incomplete panels are padded with zeros.
+*/
+template< bool SO, typename T, typename MT2, typename MT3 >
+void pmmmPackRight( T* Bp, const MT2& A, const MT3& B,
+                    size_t pc, size_t jc, size_t kc, size_t nc, size_t NR )
+{
+   for( size_t jr=0UL; jr<nc; jr+=NR, Bp+=NR*kc )
+   {
+      const size_t nr( min( NR, nc-jr ) );
+
+      for( size_t k=0UL; k<kc; ++k )
+      {
+         for( size_t c=0UL; c<nr; ++c ) {
+            Bp[k*NR+c] = pmmmRight<SO>( A, B, pc+k, jc+jr+c );
+         }
+
+         for( size_t c=nr; c<NR; ++c ) {
+            Bp[k*NR+c] = T();
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UPDATE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Update of a tile of the target matrix with a computed register tile.
+// \ingroup dense_matrix
+//
+// \param C The target dense matrix.
+// \param ab The computed \f$ MR \times NR \f$ register tile.
+// \param i The first row of the tile (the first column for a column-major target).
+// \param j The first column of the tile (the first row for a column-major target).
+// \param mr The number of valid rows of the tile.
+// \param nr The number of valid columns of the tile.
+// \param NR The number of columns of the register tile (a multiple of the SIMD size).
+// \param alpha The scaling factor for the tile.
+// \return void
+*/
+template< typename MT, bool SO, typename T >
+BLAZE_ALWAYS_INLINE void pmmmUpdate( DenseMatrix<MT,SO>& C, const T* ab, size_t i, size_t j,
+                                     size_t mr, size_t nr, size_t NR, T alpha )
+{
+   using SIMDType = SIMDTrait_t<T>;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<T>::size );
+
+   if( nr == NR )
+   {
+      const SIMDType factor( set( alpha ) );
+
+      for( size_t r=0UL; r<mr; ++r ) {
+         for( size_t v=0UL; v<NR; v+=SIMDSIZE ) {
+            if( SO ) (~C).storeu( j+v, i+r, (~C).loadu( j+v, i+r ) + factor * loada( ab+r*NR+v ) );
+            else     (~C).storeu( i+r, j+v, (~C).loadu( i+r, j+v ) + factor * loada( ab+r*NR+v ) );
+         }
+      }
+   }
+   else
+   {
+      for( size_t r=0UL; r<mr; ++r ) {
+         for( size_t c=0UL; c<nr; ++c ) {
+            if( SO ) (~C)(j+c,i+r) += alpha * ab[r*NR+c];
+            else     (~C)(i+r,j+c) += alpha * ab[r*NR+c];
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PACKED DENSE MATRIX MULTIPLICATION KERNEL
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packed compute kernel for a general dense matrix/dense matrix multiplication
+//        (\f$ C=\alpha*A*B+\beta*C \f$).
+// \ingroup dense_matrix
+//
+// \param C The target left-hand side dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \return void
+//
+// This function implements a packed, register-blocked compute kernel for a general dense
+// matrix/dense matrix multiplication of the form \f$ C=\alpha*A*B+\beta*C \f$ (see the
+// PackedMMMBlocking class template for the details of the blocking). Both \a A and \a B must be
+// non-expression dense matrix types, \a C must be a non-expression, non-adaptor dense matrix
+// type. The element types of all three matrices must be identical floating point types. The
+// packing buffers are taken from the PackingArena of the calling thread. In a parallel
+// evaluation every thread packs the blocks of its own part of the target matrix. In case the
+// runtime dispatch is active (see BLAZE_USE_RUNTIME_DISPATCH), the micro-kernel and the size of
+// the register tile are chosen according to the instruction set selected at runtime.
+*/
+template< typename MT1, bool SO, typename MT2, typename MT3, typename ST >
+void pmmm( DenseMatrix<MT1,SO>& C, const MT2& A, const MT3& B, ST alpha, ST beta )
+{
+   using ET = ElementType_t<MT1>;
+
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE    ( MT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE     ( MT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE ( MT1 );
+
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE   ( MT2 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT2 );
+
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE   ( MT3 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT3 );
+
+   const PackedMMMParameters params( packedMMMParameters<ET>() );
+
+   const size_t MR( params.mr );
+   const size_t NR( params.nr );
+   const size_t KC( params.kc );
+   const size_t MC( params.mc );
+   const size_t NC( params.nc );
+
+   BLAZE_INTERNAL_ASSERT( A.columns() == B.rows(), "Invalid matrix sizes detected" );
+
+   // For a column-major target the roles of the rows and columns are swapped (see pmmmLeft())
+   const size_t M( SO ? B.columns() : A.rows()    );
+   const size_t N( SO ? A.rows()    : B.columns() );
+   const size_t K( A.columns() );
+
+   if( isDefault( beta ) ) {
+      reset( ~C );
+   }
+   else if( !isOne( beta ) ) {
+      (~C) *= beta;
+   }
+
+   if( M == 0UL || N == 0UL || K == 0UL )
+      return;
+
+   const ET factor( alpha );
+
+   const size_t mcmax( min( MC, ( M + MR - 1UL ) / MR * MR ) );
+   const size_t ncmax( min( NC, ( N + NR - 1UL ) / NR * NR ) );
+   const size_t kcmax( min( KC, K ) );
+
+   PackingArena& arena( PackingArena::instance() );
+   ET* const Ap( arena.acquire<ET,rowMajor>   ( 1UL, mcmax*kcmax ).data() );
+   ET* const Bp( arena.acquire<ET,columnMajor>( kcmax*ncmax, 1UL ).data() );
+
+   AlignedArray<ET,PackedMMMBlocking<ET>::maxTileSize> ab;
+
+#if BLAZE_RUNTIME_DISPATCH_MODE
+   const auto gemmKernel( getKernelTable<ET>().gemmKernel );
+#endif
+
+   for( size_t jc=0UL; jc<N; jc+=NC )
+   {
+      const size_t nc( min( NC, N-jc ) );
+
+      for( size_t pc=0UL; pc<K; pc+=KC )
+      {
+         const size_t kc( min( KC, K-pc ) );
+
+         pmmmPackRight<SO>( Bp, A, B, pc, jc, kc, nc, NR );
+
+         for( size_t ic=0UL; ic<M; ic+=MC )
+         {
+            const size_t mc( min( MC, M-ic ) );
+
+            pmmmPackLeft<SO>( Ap, A, B, ic, pc, mc, kc, MR );
+
+            for( size_t jr=0UL; jr<nc; jr+=NR )
+            {
+               const size_t nr( min( NR, nc-jr ) );
+
+               for( size_t ir=0UL; ir<mc; ir+=MR )
+               {
+                  const size_t mr( min( MR, mc-ir ) );
+
+#if BLAZE_RUNTIME_DISPATCH_MODE
+                  gemmKernel( kc, Ap+ir*kc, Bp+jr*kc, ab.data() );
+#else
+                  pmmmKernel( kc, Ap+ir*kc, Bp+jr*kc, ab.data() );
+#endif
+                  pmmmUpdate( C, ab.data(), ic+ir, jc+jr, mr, nr, NR, factor );
+               }
+            }
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,232 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/PackedMMMBlocking.h
+//  \brief Header file for the blocking parameters of the packed dense matrix multiplication kernel
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_PACKEDMMMBLOCKING_H_
+#define _BLAZE_MATH_DENSE_PACKEDMMMBLOCKING_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/dispatch/Functions.h>
+#include <blaze/math/dispatch/KernelTable.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/typetraits/IsDispatchCompatible.h>
+#include <blaze/system/CacheSize.h>
+#include <blaze/system/Debugging.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  BLOCKING PARAMETERS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blocking parameters of the packed dense matrix multiplication kernel.
+// \ingroup dense_matrix
+//
+// The packed kernel computes \f$ C=\alpha*A*B+\beta*C \f$ by means of a three level blocking
+// hierarchy: A \f$ KC \times NC \f$ block of \a B is packed into a buffer that resides in the
+// last level cache (BLAZE_CACHE_SIZE), an \f$ MC \times KC \f$ block of \a A is packed into a
+// buffer that resides in the level 2 cache (BLAZE_L2_CACHE_SIZE), and a micro-kernel computes
+// an \f$ MR \times NR \f$ tile of \a C in registers while streaming a \f$ MR \times KC \f$ and
+// a \f$ KC \times NR \f$ panel through the level 1 cache (BLAZE_L1_CACHE_SIZE). The size of
+// the register tile depends on the available instruction set:
+//
+//  - AVX-512: \f$ 12 \times 2 \f$ SIMD vectors (24 of 32 vector registers for accumulation)
+//  - AVX/AVX2: \f$ 6 \times 2 \f$ SIMD vectors (12 of 16 vector registers for accumulation)
+//  - SSE: \f$ 4 \times 2 \f$ SIMD vectors (8 of 16 vector registers for accumulation)
+//
+// In case FMA is available, the micro-kernels use fused multiply-add operations. In debug mode
+// (see BLAZE_USE_DEBUG_MODE) small block sizes are used in order to test all code paths with
+// small matrices. In case the runtime dispatch is active (see BLAZE_USE_RUNTIME_DISPATCH), the
+// size of the register tile is determined by the instruction set selected at runtime and the
+// cache blocking is computed from it by means of the blockKC(), blockMC(), and blockNC()
+// functions (see packedMMMParameters()).
+*/
+template< typename T >  // Element type
+struct PackedMMMBlocking
+{
+   //**Blocking functions**************************************************************************
+   /*!\brief Computes the depth of the packed panels for the given register tile.
+   //
+   // \param mr The number of rows of the register tile.
+   // \param nr The number of columns of the register tile.
+   // \return The depth of the packed panels.
+   */
+   static constexpr size_t blockKC( size_t mr, size_t nr ) noexcept {
+      return ( BLAZE_DEBUG_MODE ? 16UL :
+         min( max( ( l1CacheSize / ( ( mr + nr ) * sizeof(T) ) ) / 16UL * 16UL, 64UL ), 1024UL ) );
+   }
+
+   /*!\brief Computes the number of rows of the packed block of the left-hand side operand.
+   //
+   // \param mr The number of rows of the register tile.
+   // \param kc The depth of the packed panels.
+   // \return The number of rows of the packed block.
+   */
+   static constexpr size_t blockMC( size_t mr, size_t kc ) noexcept {
+      return ( BLAZE_DEBUG_MODE ? 2UL*mr :
+         max( ( l2CacheSize / ( 2UL * kc * sizeof(T) ) ) / mr * mr, mr ) );
+   }
+
+   /*!\brief Computes the number of columns of the packed block of the right-hand side operand.
+   //
+   // \param nr The number of columns of the register tile.
+   // \param kc The depth of the packed panels.
+   // \return The number of columns of the packed block.
+   */
+   static constexpr size_t blockNC( size_t nr, size_t kc ) noexcept {
+      return ( BLAZE_DEBUG_MODE ? 2UL*nr :
+         max( ( cacheSize / ( 2UL * kc * sizeof(T) ) ) / nr * nr, nr ) );
+   }
+   //**********************************************************************************************
+
+   //! The number of elements in a SIMD vector.
+   static constexpr size_t SIMDSIZE = SIMDTrait<T>::size;
+
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
+   static constexpr size_t MR = 12UL;  //!< The number of rows of the register tile.
+#elif BLAZE_AVX_MODE
+   static constexpr size_t MR = 6UL;   //!< The number of rows of the register tile.
+#else
+   static constexpr size_t MR = 4UL;   //!< The number of rows of the register tile.
+#endif
+
+   //! The number of columns of the register tile.
+   static constexpr size_t NR = 2UL * SIMDSIZE;
+
+   //! The depth of the packed panels (level 1 cache blocking).
+   static constexpr size_t KC = blockKC( MR, NR );
+
+   //! The number of rows of the packed block of the left-hand side operand (level 2 blocking).
+   static constexpr size_t MC = blockMC( MR, KC );
+
+   //! The number of columns of the packed block of the right-hand side operand (level 3 blocking).
+   static constexpr size_t NC = blockNC( NR, KC );
+
+#if BLAZE_RUNTIME_DISPATCH_MODE
+   //! The maximum number of elements of a register tile.
+   static constexpr size_t maxTileSize = KernelTable<T>::maxTileSize;
+#else
+   //! The maximum number of elements of a register tile.
+   static constexpr size_t maxTileSize = MR * NR;
+#endif
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BLOCKING PARAMETERS AT RUNTIME
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The blocking parameters of a single packed dense matrix multiplication.
+// \ingroup dense_matrix
+*/
+struct PackedMMMParameters
+{
+   size_t mr;  //!< The number of rows of the register tile.
+   size_t nr;  //!< The number of columns of the register tile.
+   size_t kc;  //!< The depth of the packed panels.
+   size_t mc;  //!< The number of rows of the packed block of the left-hand side operand.
+   size_t nc;  //!< The number of columns of the packed block of the right-hand side operand.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the compile time blocking parameters of the packed kernel.
+// \ingroup dense_matrix
+//
+// \return The blocking parameters of the PackedMMMBlocking class template.
+*/
+template< typename T >  // Element type
+inline auto packedMMMParameters() noexcept
+   -> DisableIf_t< BLAZE_RUNTIME_DISPATCH_MODE && IsDispatchCompatible_v<T>, PackedMMMParameters >
+{
+   using Blocking = PackedMMMBlocking<T>;
+
+   return PackedMMMParameters{ Blocking::MR, Blocking::NR, Blocking::KC, Blocking::MC, Blocking::NC };
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+#if BLAZE_RUNTIME_DISPATCH_MODE
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the blocking parameters of the packed kernel for the current instruction set.
+// \ingroup dense_matrix
+//
+// \return The blocking parameters for the register tile of the selected instruction set.
+*/
+template< typename T >  // Element type
+inline auto packedMMMParameters() noexcept
+   -> EnableIf_t< IsDispatchCompatible_v<T>, PackedMMMParameters >
+{
+   using Blocking = PackedMMMBlocking<T>;
+
+   const KernelTable<T>& table( getKernelTable<T>() );
+   const size_t kc( Blocking::blockKC( table.mr, table.nr ) );
+
+   return PackedMMMParameters{ table.mr, table.nr, kc,
+                               Blocking::blockMC( table.mr, kc ),
+                               Blocking::blockNC( table.nr, kc ) };
+}
+/*! \endcond */
+#endif
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
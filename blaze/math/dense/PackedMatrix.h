@@ -0,0 +1,2304 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/PackedMatrix.h
+//  \brief Header file for the implementation of a packed symmetric matrix
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//
+//  * The names of its contributors may not be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_PACKEDMATRIX_H_
+#define _BLAZE_MATH_DENSE_PACKEDMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DenseMatrix.h>
+#include <blaze/math/dense/Forward.h>
+#include <blaze/math/dense/PackedIterator.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/InitializerList.h>
+#include <blaze/math/shims/Clear.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/Equal.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/IsZero.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/sparse/SparseMatrix.h>
+#include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/math/typetraits/IsShrinkable.h>
+#include <blaze/math/typetraits/IsSparseMatrix.h>
+#include <blaze/math/typetraits/IsSquare.h>
+#include <blaze/math/typetraits/IsSymmetric.h>
+#include <blaze/system/Restrict.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/algorithms/Transfer.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup packed_matrix PackedMatrix
+// \ingroup dense_matrix
+*/
+/*!\brief Efficient implementation of a dense matrix with packed symmetric storage.
+// \ingroup packed_matrix
+//
+// The PackedMatrix class template is the representation of an arbitrary sized, square dense
+// matrix that stores only a single triangle of its elements. The type of the elements and the
+// storage order of the matrix can be specified via the two template parameters:
+
+   \code
+   template< typename Type, bool SO >
+   class PackedMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. PackedMatrix can be used with any
+//          non-cv-qualified, non-reference, non-pointer element type.
+//  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//          The default value is blaze::rowMajor.
+//
+// A PackedMatrix of size \f$ N \times N \f$ stores only the \f$ N(N+1)/2 \f$ elements of the
+// lower triangle, which in contrast to a blaze::DynamicMatrix reduces the memory consumption
+// (and the memory traffic of all operations) by almost a factor of two. In case the storage
+// order is set to blaze::rowMajor, the lower triangle is stored row by row, i.e. row \a i
+// stores the \f$ i+1 \f$ elements \f$ (i,0) \ldots (i,i) \f$ consecutively. In case the storage
+// order is set to blaze::columnMajor, the lower triangle is stored column by column, i.e.
+// column \a j stores the \f$ N-j \f$ elements \f$ (j,j) \ldots (N-1,j) \f$ consecutively, which
+// corresponds to the packed storage format of LAPACK (for instance used by \c dsptrf or
+// \c dpptrf with \c uplo='L'). As an example, the following symmetric matrix
+
+                          \f[\left(\begin{array}{*{3}{c}}
+                          1 & 2 & 4 \\
+                          2 & 3 & 5 \\
+                          4 & 5 & 6 \\
+                          \end{array}\right)\f]
+
+// is stored as
+
+                          \f[\left(\begin{array}{*{6}{c}}
+                          1 & 2 & 3 & 4 & 5 & 6. \\
+                          \end{array}\right)\f]
+
+// in case of row-major order and as
+
+                          \f[\left(\begin{array}{*{6}{c}}
+                          1 & 2 & 4 & 3 & 5 & 6. \\
+                          \end{array}\right)\f]
+
+// in case of column-major order. On its own, a PackedMatrix represents a symmetric matrix: the
+// elements \f$ (i,j) \f$ and \f$ (j,i) \f$ refer to the same stored element and therefore a
+// change of one element also changes its counterpart. Additionally, a PackedMatrix serves as
+// storage backend for the blaze::SymmetricMatrix, blaze::HermitianMatrix, blaze::LowerMatrix,
+// and blaze::UpperMatrix adaptors, which interpret the stored triangle accordingly:
+
+   \code
+   using blaze::PackedMatrix;
+   using blaze::DynamicMatrix;
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   PackedMatrix<double,rowMajor> A( 3UL );  // Default initialized 3x3 symmetric matrix
+   A(0,2) = 4.0;                            // Also changes A(2,0)
+
+   PackedMatrix<double,columnMajor> B{ { 1, 2, 4 }, { 2, 3, 5 }, { 4, 5, 6 } };
+
+   DynamicMatrix<double> C( A + B );  // Addition of two packed matrices
+
+   blaze::LowerMatrix< PackedMatrix<double> > L( 3UL );  // Packed lower triangular matrix
+   blaze::SymmetricMatrix< PackedMatrix<double> > S( B );  // Packed symmetric matrix
+   \endcode
+
+// The elements of a row (for row-major matrices) or column (for column-major matrices) are not
+// stored contiguously in a packed matrix. Therefore PackedMatrix is not SIMD-enabled and does
+// not provide direct access to the data of a row or column (i.e. HasConstDataAccess evaluates
+// to \a false). Instead, the data() member functions provide access to the packed array and the
+// matrix/vector and matrix/matrix multiplications with the packed adaptors are performed by
+// dedicated kernels (see <tt><blaze/math/dense/PackedKernels.h></tt>) that traverse only the
+// stored triangle.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+class PackedMatrix
+   : public DenseMatrix< PackedMatrix<Type,SO>, SO >
+{
+ public:
+   //**Type definitions****************************************************************************
+   using This          = PackedMatrix<Type,SO>;     //!< Type of this PackedMatrix instance.
+   using BaseType      = DenseMatrix<This,SO>;      //!< Base type of this PackedMatrix instance.
+   using ResultType    = This;                      //!< Result type for expression template evaluations.
+   using OppositeType  = PackedMatrix<Type,!SO>;    //!< Result type with opposite storage order for expression template evaluations.
+   using TransposeType = PackedMatrix<Type,!SO>;    //!< Transpose type for expression template evaluations.
+   using ElementType   = Type;                      //!< Type of the matrix elements.
+   using SIMDType      = SIMDTrait_t<ElementType>;  //!< SIMD type of the matrix elements.
+   using ReturnType    = const Type&;               //!< Return type for expression template evaluations.
+   using CompositeType = const This&;               //!< Data type for composite expression templates.
+
+   using Reference      = Type&;        //!< Reference to a non-constant matrix value.
+   using ConstReference = const Type&;  //!< Reference to a constant matrix value.
+   using Pointer        = Type*;        //!< Pointer to a non-constant matrix value.
+   using ConstPointer   = const Type*;  //!< Pointer to a constant matrix value.
+
+   using Iterator      = PackedIterator<This>;        //!< Iterator over non-constant elements.
+   using ConstIterator = PackedIterator<const This>;  //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a PackedMatrix with different data/element type.
+   */
+   template< typename NewType >  // Data type of the other matrix
+   struct Rebind {
+      using Other = PackedMatrix<NewType,SO>;  //!< The type of the other PackedMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Resize struct definition********************************************************************
+   /*!\brief Resize mechanism to obtain a PackedMatrix with different fixed dimensions.
+   */
+   template< size_t NewM    // Number of rows of the other matrix
+           , size_t NewN >  // Number of columns of the other matrix
+   struct Resize {
+      using Other = PackedMatrix<Type,SO>;  //!< The type of the other PackedMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SIMD optimization.
+   /*! The \a simdEnabled compilation flag indicates whether expressions the matrix is involved
+       in can be optimized via SIMD operations. Since the elements of a row or column are not
+       stored contiguously, the \a simdEnabled compilation flag is always set to \a false. */
+   static constexpr bool simdEnabled = false;
+
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). Since rows and columns of a packed matrix cannot be assigned independently
+       without data races, the \a smpAssignable compilation flag is always set to \a false. */
+   static constexpr bool smpAssignable = false;
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+            inline PackedMatrix() noexcept;
+   explicit inline PackedMatrix( size_t n );
+            inline PackedMatrix( size_t n, const Type& init );
+            inline PackedMatrix( initializer_list< initializer_list<Type> > list );
+
+   inline PackedMatrix( const PackedMatrix& m );
+   inline PackedMatrix( PackedMatrix&& m ) noexcept;
+
+   template< typename MT, bool SO2 >
+   inline PackedMatrix( const Matrix<MT,SO2>& m );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~PackedMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator()( size_t i, size_t j ) noexcept;
+   inline ConstReference operator()( size_t i, size_t j ) const noexcept;
+   inline Reference      at( size_t i, size_t j );
+   inline ConstReference at( size_t i, size_t j ) const;
+   inline Pointer        data  () noexcept;
+   inline ConstPointer   data  () const noexcept;
+   inline Pointer        data  ( size_t i ) noexcept;
+   inline ConstPointer   data  ( size_t i ) const noexcept;
+   inline Iterator       begin ( size_t i ) noexcept;
+   inline ConstIterator  begin ( size_t i ) const noexcept;
+   inline ConstIterator  cbegin( size_t i ) const noexcept;
+   inline Iterator       end   ( size_t i ) noexcept;
+   inline ConstIterator  end   ( size_t i ) const noexcept;
+   inline ConstIterator  cend  ( size_t i ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline PackedMatrix& operator=( const Type& rhs );
+   inline PackedMatrix& operator=( initializer_list< initializer_list<Type> > list );
+
+   inline PackedMatrix& operator=( const PackedMatrix& rhs );
+   inline PackedMatrix& operator=( PackedMatrix&& rhs ) noexcept;
+
+   template< typename MT, bool SO2 > inline PackedMatrix& operator= ( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline PackedMatrix& operator+=( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline PackedMatrix& operator-=( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline PackedMatrix& operator%=( const Matrix<MT,SO2>& rhs );
+
+   template< typename ST >
+   inline auto operator*=( ST rhs ) -> EnableIf_t< IsNumeric_v<ST>, PackedMatrix& >;
+
+   template< typename ST >
+   inline auto operator/=( ST rhs ) -> EnableIf_t< IsNumeric_v<ST>, PackedMatrix& >;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const noexcept;
+   inline size_t columns() const noexcept;
+   inline size_t capacity() const noexcept;
+   inline size_t capacity( size_t i ) const noexcept;
+   inline size_t nonZeros() const;
+   inline size_t nonZeros( size_t i ) const;
+   inline void   reset();
+   inline void   reset( size_t i );
+   inline void   clear();
+          void   resize ( size_t n, bool preserve=true );
+   inline void   extend ( size_t n, bool preserve=true );
+   inline void   reserve( size_t elements );
+   inline void   shrinkToFit();
+   inline void   swap( PackedMatrix& m ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Numeric functions***************************************************************************
+   /*!\name Numeric functions */
+   //@{
+   inline PackedMatrix& transpose();
+   inline PackedMatrix& ctranspose();
+
+   template< typename Other > inline PackedMatrix& scale( const Other& scalar );
+   //@}
+   //**********************************************************************************************
+
+   //**Debugging functions*************************************************************************
+   /*!\name Debugging functions */
+   //@{
+   inline bool isIntact() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   inline bool isAligned   () const noexcept;
+   inline bool canSMPAssign() const noexcept;
+
+   template< typename MT, bool SO2 > inline void assign( const DenseMatrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline void assign( const SparseMatrix<MT,SO2>& rhs );
+
+   template< typename MT, bool SO2 > inline void addAssign( const DenseMatrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline void addAssign( const SparseMatrix<MT,SO2>& rhs );
+
+   template< typename MT, bool SO2 > inline void subAssign( const DenseMatrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline void subAssign( const SparseMatrix<MT,SO2>& rhs );
+
+   template< typename MT, bool SO2 > inline void schurAssign( const DenseMatrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline void schurAssign( const SparseMatrix<MT,SO2>& rhs );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline size_t elements( size_t n ) noexcept;
+   static inline size_t offset  ( size_t n, size_t k ) noexcept;
+   inline        size_t index   ( size_t i, size_t j ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t n_;                //!< The current number of rows and columns of the matrix.
+   size_t capacity_;         //!< The maximum capacity of the matrix.
+   Type* BLAZE_RESTRICT v_;  //!< The dynamically allocated packed matrix elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for PackedMatrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline PackedMatrix<Type,SO>::PackedMatrix() noexcept
+   : n_       ( 0UL )      // The current number of rows and columns of the matrix
+   , capacity_( 0UL )      // The maximum capacity of the matrix
+   , v_       ( nullptr )  // The packed matrix elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ n \times n \f$.
+//
+// \param n The number of rows and columns of the matrix.
+//
+// All matrix elements are initialized to their default value.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline PackedMatrix<Type,SO>::PackedMatrix( size_t n )
+   : PackedMatrix( n, Type() )
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a homogenous initialization of all \f$ n \times n \f$ matrix elements.
+//
+// \param n The number of rows and columns of the matrix.
+// \param init The initial value of the matrix elements.
+//
+// All matrix elements are initialized with the specified value.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline PackedMatrix<Type,SO>::PackedMatrix( size_t n, const Type& init )
+   : n_       ( n )                            // The current number of rows and columns of the matrix
+   , capacity_( elements( n ) )                // The maximum capacity of the matrix
+   , v_       ( allocate<Type>( capacity_ ) )  // The packed matrix elements
+{
+   std::fill( v_, v_+capacity_, init );
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief List initialization of all matrix elements.
+//
+// \param list The initializer list.
+// \exception std::invalid_argument Invalid setup of packed matrix.
+//
+// This constructor provides the option to explicitly initialize the elements of the matrix by
+// means of an initializer list:
+
+   \code
+   blaze::PackedMatrix<int> A{ { 1, 2, 4 },
+                               { 2, 3 },
+                               { 4, 0, 6 } };
+   \endcode
+
+// The matrix is sized according to the size of the initializer list and all its elements are
+// initialized by the values of the given initializer list. Missing values are initialized as
+// default (as e.g. the value 5 in the example). In case the given list does not represent a
+// symmetric matrix (as in the example), a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline PackedMatrix<Type,SO>::PackedMatrix( initializer_list< initializer_list<Type> > list )
+   : PackedMatrix( list.size() )
+{
+   size_t i( 0UL );
+
+   for( const auto& rowList : list )
+   {
+      if( rowList.size() > n_ ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid setup of packed matrix" );
+      }
+
+      size_t j( 0UL );
+      for( const auto& element : rowList ) {
+         if( j > i ) break;
+         v_[index(i,j)] = element;
+         ++j;
+      }
+
+      ++i;
+   }
+
+   i = 0UL;
+
+   for( const auto& rowList : list )
+   {
+      size_t j( 0UL );
+      for( const auto& element : rowList ) {
+         if( j > i && !equal( element, v_[index(j,i)] ) ) {
+            BLAZE_THROW_INVALID_ARGUMENT( "Invalid setup of packed matrix" );
+         }
+         ++j;
+      }
+
+      for( j=max( i+1UL, j ); j<n_; ++j ) {
+         if( !isDefault( v_[index(j,i)] ) ) {
+            BLAZE_THROW_INVALID_ARGUMENT( "Invalid setup of packed matrix" );
+         }
+      }
+
+      ++i;
+   }
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for PackedMatrix.
+//
+// \param m Matrix to be copied.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline PackedMatrix<Type,SO>::PackedMatrix( const PackedMatrix& m )
+   : n_       ( m.n_ )                         // The current number of rows and columns of the matrix
+   , capacity_( elements( n_ ) )               // The maximum capacity of the matrix
+   , v_       ( allocate<Type>( capacity_ ) )  // The packed matrix elements
+{
+   std::copy( m.v_, m.v_+capacity_, v_ );
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for PackedMatrix.
+//
+// \param m The matrix to be moved into this instance.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline PackedMatrix<Type,SO>::PackedMatrix( PackedMatrix&& m ) noexcept
+   : n_       ( m.n_        )  // The current number of rows and columns of the matrix
+   , capacity_( m.capacity_ )  // The maximum capacity of the matrix
+   , v_       ( m.v_        )  // The packed matrix elements
+{
+   m.n_        = 0UL;
+   m.capacity_ = 0UL;
+   m.v_        = nullptr;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different matrices.
+//
+// \param m Matrix to be copied.
+// \exception std::invalid_argument Invalid setup of packed matrix.
+//
+// This constructor initializes the packed matrix as a copy of the given matrix. In case the
+// given matrix is not a square, symmetric matrix, a \a std::invalid_argument exception is
+// thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the foreign matrix
+        , bool SO2 >     // Storage order of the foreign matrix
+inline PackedMatrix<Type,SO>::PackedMatrix( const Matrix<MT,SO2>& m )
+   : PackedMatrix( (~m).rows() )
+{
+   if( !isSquare( ~m ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid setup of packed matrix" );
+   }
+
+   const CompositeType_t<MT> tmp( ~m );
+
+   if( !IsSymmetric_v<MT> && !isSymmetric( tmp ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid setup of packed matrix" );
+   }
+
+   assign( tmp );
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for PackedMatrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline PackedMatrix<Type,SO>::~PackedMatrix()
+{
+   deallocate( v_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// Note that the elements \f$ (i,j) \f$ and \f$ (j,i) \f$ refer to the same stored element.
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename PackedMatrix<Type,SO>::Reference
+   PackedMatrix<Type,SO>::operator()( size_t i, size_t j ) noexcept
+{
+   BLAZE_USER_ASSERT( i<n_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j<n_, "Invalid column access index" );
+   return ( i >= j )?( v_[index(i,j)] ):( v_[index(j,i)] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference-to-const to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename PackedMatrix<Type,SO>::ConstReference
+   PackedMatrix<Type,SO>::operator()( size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( i<n_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j<n_, "Invalid column access index" );
+   return ( i >= j )?( v_[index(i,j)] ):( v_[index(j,i)] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// In contrast to the function call operator this function always performs a check of the
+// given access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename PackedMatrix<Type,SO>::Reference
+   PackedMatrix<Type,SO>::at( size_t i, size_t j )
+{
+   if( i >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference-to-const to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// In contrast to the function call operator this function always performs a check of the
+// given access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename PackedMatrix<Type,SO>::ConstReference
+   PackedMatrix<Type,SO>::at( size_t i, size_t j ) const
+{
+   if( i >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the packed matrix elements.
+//
+// \return Pointer to the packed array of the stored triangle.
+//
+// This function returns a pointer to the internal storage of the packed matrix. In case of a
+// row-major matrix, the array contains the rows of the lower triangle, in case of a column-major
+// matrix the array contains the columns of the lower triangle (see the class description).
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename PackedMatrix<Type,SO>::Pointer
+   PackedMatrix<Type,SO>::data() noexcept
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the packed matrix elements.
+//
+// \return Pointer to the packed array of the stored triangle.
+//
+// This function returns a pointer to the internal storage of the packed matrix. In case of a
+// row-major matrix, the array contains the rows of the lower triangle, in case of a column-major
+// matrix the array contains the columns of the lower triangle (see the class description).
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename PackedMatrix<Type,SO>::ConstPointer
+   PackedMatrix<Type,SO>::data() const noexcept
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the stored elements of row/column \a i.
+//
+// \param i The row/column index.
+// \return Pointer to the first stored element of row/column \a i.
+//
+// In case of a row-major matrix, this function returns a pointer to the \f$ i+1 \f$ stored
+// elements \f$ (i,0) \ldots (i,i) \f$ of row \a i. In case of a column-major matrix, this
+// function returns a pointer to the \f$ N-i \f$ stored elements \f$ (i,i) \ldots (N-1,i) \f$
+// of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename PackedMatrix<Type,SO>::Pointer
+   PackedMatrix<Type,SO>::data( size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid dense matrix row/column access index" );
+   return v_ + offset( n_, i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the stored elements of row/column \a i.
+//
+// \param i The row/column index.
+// \return Pointer to the first stored element of row/column \a i.
+//
+// In case of a row-major matrix, this function returns a pointer to the \f$ i+1 \f$ stored
+// elements \f$ (i,0) \ldots (i,i) \f$ of row \a i. In case of a column-major matrix, this
+// function returns a pointer to the \f$ N-i \f$ stored elements \f$ (i,i) \ldots (N-1,i) \f$
+// of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename PackedMatrix<Type,SO>::ConstPointer
+   PackedMatrix<Type,SO>::data( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid dense matrix row/column access index" );
+   return v_ + offset( n_, i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+//
+// This function returns a row/column iterator to the first element of row/column \a i. In case
+// the storage order is set to \a rowMajor the function returns an iterator to the first element
+// of row \a i, in case the storage flag is set to \a columnMajor the function returns an iterator
+// to the first element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename PackedMatrix<Type,SO>::Iterator
+   PackedMatrix<Type,SO>::begin( size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid dense matrix row/column access index" );
+   return Iterator( *this, i, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+//
+// This function returns a row/column iterator to the first element of row/column \a i. In case
+// the storage order is set to \a rowMajor the function returns an iterator to the first element
+// of row \a i, in case the storage flag is set to \a columnMajor the function returns an iterator
+// to the first element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename PackedMatrix<Type,SO>::ConstIterator
+   PackedMatrix<Type,SO>::begin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid dense matrix row/column access index" );
+   return ConstIterator( *this, i, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+//
+// This function returns a row/column iterator to the first element of row/column \a i. In case
+// the storage order is set to \a rowMajor the function returns an iterator to the first element
+// of row \a i, in case the storage flag is set to \a columnMajor the function returns an iterator
+// to the first element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename PackedMatrix<Type,SO>::ConstIterator
+   PackedMatrix<Type,SO>::cbegin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid dense matrix row/column access index" );
+   return ConstIterator( *this, i, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+//
+// This function returns a row/column iterator just past the last element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator just past
+// the last element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator just past the last element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename PackedMatrix<Type,SO>::Iterator
+   PackedMatrix<Type,SO>::end( size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid dense matrix row/column access index" );
+   return Iterator( *this, i, n_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+//
+// This function returns a row/column iterator just past the last element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator just past
+// the last element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator just past the last element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename PackedMatrix<Type,SO>::ConstIterator
+   PackedMatrix<Type,SO>::end( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid dense matrix row/column access index" );
+   return ConstIterator( *this, i, n_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+//
+// This function returns a row/column iterator just past the last element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator just past
+// the last element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator just past the last element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename PackedMatrix<Type,SO>::ConstIterator
+   PackedMatrix<Type,SO>::cend( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid dense matrix row/column access index" );
+   return ConstIterator( *this, i, n_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Homogenous assignment to all matrix elements.
+//
+// \param rhs Scalar value to be assigned to all matrix elements.
+// \return Reference to the assigned matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline PackedMatrix<Type,SO>& PackedMatrix<Type,SO>::operator=( const Type& rhs )
+{
+   std::fill( v_, v_+elements( n_ ), rhs );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief List assignment to all matrix elements.
+//
+// \param list The initializer list.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Invalid assignment to packed matrix.
+//
+// This assignment operator offers the option to directly assign to all elements of the matrix
+// by means of an initializer list. The matrix is resized according to the given initializer
+// list and all its elements are assigned the values from the given initializer list. Missing
+// values are initialized as default. In case the given list does not represent a symmetric
+// matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline PackedMatrix<Type,SO>&
+   PackedMatrix<Type,SO>::operator=( initializer_list< initializer_list<Type> > list )
+{
+   PackedMatrix tmp( list );
+   swap( tmp );
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for PackedMatrix.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned matrix.
+//
+// The packed matrix is resized according to the given \f$ N \times N \f$ matrix and initialized
+// as a copy of this matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline PackedMatrix<Type,SO>& PackedMatrix<Type,SO>::operator=( const PackedMatrix& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   resize( rhs.n_, false );
+   std::copy( rhs.v_, rhs.v_+elements( n_ ), v_ );
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for PackedMatrix.
+//
+// \param rhs The matrix to be moved into this instance.
+// \return Reference to the assigned matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline PackedMatrix<Type,SO>& PackedMatrix<Type,SO>::operator=( PackedMatrix&& rhs ) noexcept
+{
+   deallocate( v_ );
+
+   n_        = rhs.n_;
+   capacity_ = rhs.capacity_;
+   v_        = rhs.v_;
+
+   rhs.n_        = 0UL;
+   rhs.capacity_ = 0UL;
+   rhs.v_        = nullptr;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different matrices.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Invalid assignment to packed matrix.
+//
+// The packed matrix is resized according to the given \f$ N \times N \f$ matrix and initialized
+// as a copy of this matrix. In case the given matrix is not a square, symmetric matrix, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline PackedMatrix<Type,SO>& PackedMatrix<Type,SO>::operator=( const Matrix<MT,SO2>& rhs )
+{
+   if( !isSquare( ~rhs ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid assignment to packed matrix" );
+   }
+
+   const CompositeType_t<MT> tmp( ~rhs );
+
+   if( !IsSymmetric_v<MT> && !isSymmetric( tmp ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid assignment to packed matrix" );
+   }
+
+   if( tmp.canAlias( this ) ) {
+      PackedMatrix tmp2( tmp );
+      swap( tmp2 );
+   }
+   else {
+      resize( tmp.rows(), false );
+      if( IsSparseMatrix_v<MT> )
+         reset();
+      assign( tmp );
+   }
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator for the addition of a matrix (\f$ A+=B \f$).
+//
+// \param rhs The right-hand side matrix to be added to the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Invalid assignment to packed matrix.
+//
+// In case the current sizes of the two matrices don't match or in case the given matrix is not
+// symmetric, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline PackedMatrix<Type,SO>& PackedMatrix<Type,SO>::operator+=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != n_ || (~rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   const CompositeType_t<MT> tmp( ~rhs );
+
+   if( !IsSymmetric_v<MT> && !isSymmetric( tmp ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid assignment to packed matrix" );
+   }
+
+   if( tmp.canAlias( this ) ) {
+      const ResultType_t<MT> tmp2( tmp );
+      addAssign( tmp2 );
+   }
+   else {
+      addAssign( tmp );
+   }
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator for the subtraction of a matrix (\f$ A-=B \f$).
+//
+// \param rhs The right-hand side matrix to be subtracted from the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Invalid assignment to packed matrix.
+//
+// In case the current sizes of the two matrices don't match or in case the given matrix is not
+// symmetric, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline PackedMatrix<Type,SO>& PackedMatrix<Type,SO>::operator-=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != n_ || (~rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   const CompositeType_t<MT> tmp( ~rhs );
+
+   if( !IsSymmetric_v<MT> && !isSymmetric( tmp ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid assignment to packed matrix" );
+   }
+
+   if( tmp.canAlias( this ) ) {
+      const ResultType_t<MT> tmp2( tmp );
+      subAssign( tmp2 );
+   }
+   else {
+      subAssign( tmp );
+   }
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Schur product assignment operator for the multiplication of a matrix (\f$ A\circ=B \f$).
+//
+// \param rhs The right-hand side matrix for the Schur product.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Invalid assignment to packed matrix.
+//
+// In case the current sizes of the two matrices don't match or in case the given matrix is not
+// symmetric, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline PackedMatrix<Type,SO>& PackedMatrix<Type,SO>::operator%=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != n_ || (~rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   const CompositeType_t<MT> tmp( ~rhs );
+
+   if( !IsSymmetric_v<MT> && !isSymmetric( tmp ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid assignment to packed matrix" );
+   }
+
+   if( tmp.canAlias( this ) ) {
+      const ResultType_t<MT> tmp2( tmp );
+      schurAssign( tmp2 );
+   }
+   else {
+      schurAssign( tmp );
+   }
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication between a matrix and
+//        a scalar value (\f$ A*=s \f$).
+//
+// \param rhs The right-hand side scalar value for the multiplication.
+// \return Reference to the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename ST >  // Data type of the right-hand side scalar
+inline auto PackedMatrix<Type,SO>::operator*=( ST rhs )
+   -> EnableIf_t< IsNumeric_v<ST>, PackedMatrix& >
+{
+   const size_t nnz( elements( n_ ) );
+
+   for( size_t k=0UL; k<nnz; ++k ) {
+      v_[k] *= rhs;
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment operator for the division of a matrix by a scalar value
+//        (\f$ A/=s \f$).
+//
+// \param rhs The right-hand side scalar value for the division.
+// \return Reference to the matrix.
+//
+// \note A division by zero is only checked by an user assert.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename ST >  // Data type of the right-hand side scalar
+inline auto PackedMatrix<Type,SO>::operator/=( ST rhs )
+   -> EnableIf_t< IsNumeric_v<ST>, PackedMatrix& >
+{
+   BLAZE_USER_ASSERT( !isZero( rhs ), "Division by zero detected" );
+
+   const size_t nnz( elements( n_ ) );
+
+   for( size_t k=0UL; k<nnz; ++k ) {
+      v_[k] /= rhs;
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the matrix.
+//
+// \return The number of rows of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t PackedMatrix<Type,SO>::rows() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the matrix.
+//
+// \return The number of columns of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t PackedMatrix<Type,SO>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the matrix.
+//
+// \return The capacity of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t PackedMatrix<Type,SO>::capacity() const noexcept
+{
+   return capacity_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of stored elements in the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The number of stored elements in row/column \a i.
+//
+// In case of a row-major matrix, row \a i stores \f$ i+1 \f$ elements, in case of a column-major
+// matrix, column \a i stores \f$ N-i \f$ elements.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t PackedMatrix<Type,SO>::capacity( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid row/column access index" );
+   return ( SO )?( n_ - i ):( i + 1UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of non-zero elements in the matrix
+//
+// \return The number of non-zero elements in the packed matrix.
+//
+// Note that each non-zero element in the stored triangle (except for the diagonal elements)
+// represents two non-zero elements of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t PackedMatrix<Type,SO>::nonZeros() const
+{
+   size_t nonzeros( 0UL );
+
+   for( size_t i=0UL; i<n_; ++i ) {
+      for( size_t j=0UL; j<=i; ++j ) {
+         if( !isDefault<strict>( v_[index(i,j)] ) )
+            nonzeros += ( i == j )?( 1UL ):( 2UL );
+      }
+   }
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The number of non-zero elements of row/column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t PackedMatrix<Type,SO>::nonZeros( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid row/column access index" );
+
+   size_t nonzeros( 0UL );
+
+   for( size_t j=0UL; j<n_; ++j ) {
+      if( !isDefault<strict>( (*this)(i,j) ) )
+         ++nonzeros;
+   }
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void PackedMatrix<Type,SO>::reset()
+{
+   using blaze::clear;
+
+   const size_t nnz( elements( n_ ) );
+
+   for( size_t k=0UL; k<nnz; ++k ) {
+      clear( v_[k] );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row \b and column to the default initial values.
+//
+// \param i The index of the row/column.
+// \return void
+//
+// This function resets the values in the specified row \b and column to their default value.
+// Note that the capacity of the matrix remains unchanged.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void PackedMatrix<Type,SO>::reset( size_t i )
+{
+   using blaze::clear;
+
+   BLAZE_USER_ASSERT( i < n_, "Invalid row/column access index" );
+
+   for( size_t j=0UL; j<n_; ++j ) {
+      clear( (*this)(i,j) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the \f$ N \times N \f$ matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the matrix is 0.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void PackedMatrix<Type,SO>::clear()
+{
+   n_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the size of the matrix.
+//
+// \param n The new number of rows and columns of the matrix.
+// \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
+// \return void
+//
+// This function resizes the matrix using the given size to \f$ n \times n \f$. During this
+// operation, new dynamic memory may be allocated in case the capacity of the matrix is too
+// small. Note that this function may invalidate all existing views (submatrices, rows, columns,
+// ...) on the matrix if it is used to shrink the matrix. Additionally, the resize operation
+// potentially changes all matrix elements. In order to preserve the old matrix values, the
+// \a preserve flag can be set to \a true. In this case new elements are default initialized.
+// Please note that due to the layout of the packed storage, preserving resize operations of a
+// column-major matrix require a reallocation and a repacking of all elements.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+void PackedMatrix<Type,SO>::resize( size_t n, bool preserve )
+{
+   using std::swap;
+   using blaze::min;
+
+   if( n == n_ ) return;
+
+   const size_t nnz( elements( n ) );
+
+   if( preserve && SO )
+   {
+      Type* BLAZE_RESTRICT v = allocate<Type>( nnz );
+      const size_t min_n( min( n, n_ ) );
+
+      for( size_t j=0UL; j<n; ++j ) {
+         Type* const dst( v + offset( n, j ) );
+         const size_t copied( ( j < min_n )?( min_n - j ):( 0UL ) );
+         if( copied > 0UL ) {
+            transfer( v_+offset( n_, j ), v_+offset( n_, j )+copied, dst );
+         }
+         std::fill( dst+copied, dst+n-j, Type() );
+      }
+
+      swap( v_, v );
+      deallocate( v );
+      capacity_ = nnz;
+   }
+   else if( nnz > capacity_ )
+   {
+      Type* BLAZE_RESTRICT v = allocate<Type>( nnz );
+
+      if( preserve ) {
+         transfer( v_, v_+elements( n_ ), v );
+      }
+
+      swap( v_, v );
+      deallocate( v );
+      capacity_ = nnz;
+   }
+
+   if( preserve && !SO && n > n_ ) {
+      std::fill( v_+elements( n_ ), v_+nnz, Type() );
+   }
+
+   n_ = n;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Extending the size of the matrix.
+//
+// \param n Number of additional rows and columns.
+// \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
+// \return void
+//
+// This function increases the matrix size by \a n rows and \a n columns. During this operation,
+// new dynamic memory may be allocated in case the capacity of the matrix is too small. Therefore
+// this function potentially changes all matrix elements. In order to preserve the old matrix
+// values, the \a preserve flag can be set to \a true. In this case new elements are default
+// initialized.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void PackedMatrix<Type,SO>::extend( size_t n, bool preserve )
+{
+   resize( n_+n, preserve );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of the matrix.
+//
+// \param elements The new minimum capacity of the packed matrix.
+// \return void
+//
+// This function increases the capacity of the packed matrix to at least \a elements elements.
+// The current values of the matrix elements are preserved.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void PackedMatrix<Type,SO>::reserve( size_t elements )
+{
+   using std::swap;
+
+   if( elements > capacity_ )
+   {
+      // Allocating a new array
+      Type* BLAZE_RESTRICT tmp = allocate<Type>( elements );
+
+      // Initializing the new array
+      transfer( v_, v_+capacity_, tmp );
+
+      // Replacing the old array
+      swap( tmp, v_ );
+      deallocate( tmp );
+      capacity_ = elements;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Requesting the removal of unused capacity.
+//
+// \return void
+//
+// This function minimizes the capacity of the matrix by removing unused capacity. Please note
+// that in case a reallocation occurs, all iterators (including end() iterators), all pointers
+// and references to elements of this matrix are invalidated.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void PackedMatrix<Type,SO>::shrinkToFit()
+{
+   if( elements( n_ ) < capacity_ ) {
+      PackedMatrix( *this ).swap( *this );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two matrices.
+//
+// \param m The matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void PackedMatrix<Type,SO>::swap( PackedMatrix& m ) noexcept
+{
+   using std::swap;
+
+   swap( n_       , m.n_        );
+   swap( capacity_, m.capacity_ );
+   swap( v_       , m.v_        );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calculation of the number of stored elements of a \f$ n \times n \f$ packed matrix.
+//
+// \param n The number of rows and columns of the matrix.
+// \return The number of stored elements.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t PackedMatrix<Type,SO>::elements( size_t n ) noexcept
+{
+   return ( n * ( n + 1UL ) ) / 2UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calculation of the offset of the stored elements of row/column \a k.
+//
+// \param n The number of rows and columns of the matrix.
+// \param k The index of the row/column.
+// \return The offset of the first stored element of row/column \a k.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t PackedMatrix<Type,SO>::offset( size_t n, size_t k ) noexcept
+{
+   if( SO )
+      return ( k * ( 2UL*n - k + 1UL ) ) / 2UL;
+   else
+      return ( k * ( k + 1UL ) ) / 2UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calculation of the position of the element \f$ (i,j) \f$ of the lower triangle.
+//
+// \param i The row index of the element. The index has to be in the range \f$[j..N-1]\f$.
+// \param j The column index of the element. The index has to be in the range \f$[0..i]\f$.
+// \return The position of the element within the packed array.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t PackedMatrix<Type,SO>::index( size_t i, size_t j ) const noexcept
+{
+   BLAZE_INTERNAL_ASSERT( i >= j, "Invalid upper matrix element detected" );
+
+   if( SO )
+      return offset( n_, j ) + i - j;
+   else
+      return offset( n_, i ) + j;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NUMERIC FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief In-place transpose of the matrix.
+//
+// \return Reference to the transposed matrix.
+//
+// Since a packed matrix is symmetric, this function does not change the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline PackedMatrix<Type,SO>& PackedMatrix<Type,SO>::transpose()
+{
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place conjugate transpose of the matrix.
+//
+// \return Reference to the transposed matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline PackedMatrix<Type,SO>& PackedMatrix<Type,SO>::ctranspose()
+{
+   const size_t nnz( elements( n_ ) );
+
+   for( size_t k=0UL; k<nnz; ++k ) {
+      conjugate( v_[k] );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scaling of the matrix by the scalar value \a scalar (\f$ A=B*s \f$).
+//
+// \param scalar The scalar value for the matrix scaling.
+// \return Reference to the matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the scalar value
+inline PackedMatrix<Type,SO>& PackedMatrix<Type,SO>::scale( const Other& scalar )
+{
+   const size_t nnz( elements( n_ ) );
+
+   for( size_t k=0UL; k<nnz; ++k ) {
+      v_[k] *= scalar;
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEBUGGING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the packed matrix are intact.
+//
+// \return \a true in case the packed matrix's invariants are intact, \a false otherwise.
+//
+// This function checks whether the invariants of the packed matrix are intact, i.e. if its
+// state is valid. In case the invariants are intact, the function returns \a true, else it
+// will return \a false.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline bool PackedMatrix<Type,SO>::isIntact() const noexcept
+{
+   return ( elements( n_ ) <= capacity_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the foreign expression
+inline bool PackedMatrix<Type,SO>::canAlias( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the foreign expression
+inline bool PackedMatrix<Type,SO>::isAliased( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is properly aligned in memory.
+//
+// \return \a true in case the matrix is aligned, \a false if not.
+//
+// Since the rows/columns of a packed matrix are not stored contiguously, the matrix is never
+// considered to be aligned.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline bool PackedMatrix<Type,SO>::isAligned() const noexcept
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+//
+// Since the rows/columns of a packed matrix cannot be assigned independently, a packed matrix
+// cannot be used in SMP assignments.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline bool PackedMatrix<Type,SO>::canSMPAssign() const noexcept
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.\n
+// Note that only the lower triangle of the given matrix is assigned. The function is also used
+// by the packed adaptors, which are responsible for providing the according triangle.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline void PackedMatrix<Type,SO>::assign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   Type* BLAZE_RESTRICT v( v_ );
+
+   if( SO ) {
+      for( size_t j=0UL; j<n_; ++j )
+         for( size_t i=j; i<n_; ++i )
+            *v++ = (~rhs)(i,j);
+   }
+   else {
+      for( size_t i=0UL; i<n_; ++i )
+         for( size_t j=0UL; j<=i; ++j )
+            *v++ = (~rhs)(i,j);
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.\n
+// Note that only the lower triangle of the given matrix is assigned.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side sparse matrix
+        , bool SO2 >     // Storage order of the right-hand side sparse matrix
+inline void PackedMatrix<Type,SO>::assign( const SparseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t k=0UL; k<n_; ++k ) {
+      for( auto element=(~rhs).begin(k); element!=(~rhs).end(k); ++element ) {
+         const size_t i( ( SO2 )?( element->index() ):( k ) );
+         const size_t j( ( SO2 )?( k ):( element->index() ) );
+         if( i >= j )
+            v_[index(i,j)] = element->value();
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.\n
+// Note that only the lower triangle of the given matrix is added.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline void PackedMatrix<Type,SO>::addAssign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   Type* BLAZE_RESTRICT v( v_ );
+
+   if( SO ) {
+      for( size_t j=0UL; j<n_; ++j )
+         for( size_t i=j; i<n_; ++i )
+            *v++ += (~rhs)(i,j);
+   }
+   else {
+      for( size_t i=0UL; i<n_; ++i )
+         for( size_t j=0UL; j<=i; ++j )
+            *v++ += (~rhs)(i,j);
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.\n
+// Note that only the lower triangle of the given matrix is added.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side sparse matrix
+        , bool SO2 >     // Storage order of the right-hand side sparse matrix
+inline void PackedMatrix<Type,SO>::addAssign( const SparseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t k=0UL; k<n_; ++k ) {
+      for( auto element=(~rhs).begin(k); element!=(~rhs).end(k); ++element ) {
+         const size_t i( ( SO2 )?( element->index() ):( k ) );
+         const size_t j( ( SO2 )?( k ):( element->index() ) );
+         if( i >= j )
+            v_[index(i,j)] += element->value();
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.\n
+// Note that only the lower triangle of the given matrix is subtracted.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline void PackedMatrix<Type,SO>::subAssign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   Type* BLAZE_RESTRICT v( v_ );
+
+   if( SO ) {
+      for( size_t j=0UL; j<n_; ++j )
+         for( size_t i=j; i<n_; ++i )
+            *v++ -= (~rhs)(i,j);
+   }
+   else {
+      for( size_t i=0UL; i<n_; ++i )
+         for( size_t j=0UL; j<=i; ++j )
+            *v++ -= (~rhs)(i,j);
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.\n
+// Note that only the lower triangle of the given matrix is subtracted.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side sparse matrix
+        , bool SO2 >     // Storage order of the right-hand side sparse matrix
+inline void PackedMatrix<Type,SO>::subAssign( const SparseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t k=0UL; k<n_; ++k ) {
+      for( auto element=(~rhs).begin(k); element!=(~rhs).end(k); ++element ) {
+         const size_t i( ( SO2 )?( element->index() ):( k ) );
+         const size_t j( ( SO2 )?( k ):( element->index() ) );
+         if( i >= j )
+            v_[index(i,j)] -= element->value();
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the Schur product assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix for the Schur product.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.\n
+// Note that only the lower triangle of the given matrix is used.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline void PackedMatrix<Type,SO>::schurAssign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   Type* BLAZE_RESTRICT v( v_ );
+
+   if( SO ) {
+      for( size_t j=0UL; j<n_; ++j )
+         for( size_t i=j; i<n_; ++i )
+            *v++ *= (~rhs)(i,j);
+   }
+   else {
+      for( size_t i=0UL; i<n_; ++i )
+         for( size_t j=0UL; j<=i; ++j )
+            *v++ *= (~rhs)(i,j);
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the Schur product assignment of a sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix for the Schur product.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.\n
+// Note that only the lower triangle of the given matrix is used.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side sparse matrix
+        , bool SO2 >     // Storage order of the right-hand side sparse matrix
+inline void PackedMatrix<Type,SO>::schurAssign( const SparseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   PackedMatrix tmp( n_ );
+   tmp.assign( ~rhs );
+
+   const size_t nnz( elements( n_ ) );
+
+   for( size_t k=0UL; k<nnz; ++k ) {
+      v_[k] *= tmp.v_[k];
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PACKEDMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name PackedMatrix operators */
+//@{
+template< typename Type, bool SO >
+void reset( PackedMatrix<Type,SO>& m );
+
+template< typename Type, bool SO >
+void reset( PackedMatrix<Type,SO>& m, size_t i );
+
+template< typename Type, bool SO >
+void clear( PackedMatrix<Type,SO>& m );
+
+template< RelaxationFlag RF, typename Type, bool SO >
+bool isDefault( const PackedMatrix<Type,SO>& m );
+
+template< typename Type, bool SO >
+bool isIntact( const PackedMatrix<Type,SO>& m ) noexcept;
+
+template< typename Type, bool SO >
+void swap( PackedMatrix<Type,SO>& a, PackedMatrix<Type,SO>& b ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given packed matrix.
+// \ingroup packed_matrix
+//
+// \param m The matrix to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void reset( PackedMatrix<Type,SO>& m )
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row \b and column of the given packed matrix.
+// \ingroup packed_matrix
+//
+// \param m The matrix to be resetted.
+// \param i The index of the row/column to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void reset( PackedMatrix<Type,SO>& m, size_t i )
+{
+   m.reset( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given packed matrix.
+// \ingroup packed_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void clear( PackedMatrix<Type,SO>& m )
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given packed matrix is in default state.
+// \ingroup packed_matrix
+//
+// \param m The matrix to be tested for its default state.
+// \return \a true in case the given matrix's rows and columns are zero, \a false otherwise.
+//
+// This function checks whether the packed matrix is in default (constructed) state, i.e. if
+// it's number of rows and columns is 0. In case it is in default state, the function returns
+// \a true, else it will return \a false.
+*/
+template< RelaxationFlag RF  // Relaxation flag
+        , typename Type      // Data type of the matrix
+        , bool SO >          // Storage order
+inline bool isDefault( const PackedMatrix<Type,SO>& m )
+{
+   return ( m.rows() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the given packed matrix are intact.
+// \ingroup packed_matrix
+//
+// \param m The packed matrix to be tested.
+// \return \a true in case the given matrix's invariants are intact, \a false otherwise.
+//
+// This function checks whether the invariants of the packed matrix are intact, i.e. if its
+// state is valid. In case the invariants are intact, the function returns \a true, else it
+// will return \a false.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline bool isIntact( const PackedMatrix<Type,SO>& m ) noexcept
+{
+   return m.isIntact();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two packed matrices.
+// \ingroup packed_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void swap( PackedMatrix<Type,SO>& a, PackedMatrix<Type,SO>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISSYMMETRIC SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename Type, bool SO >
+struct IsSymmetric< PackedMatrix<Type,SO> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISSQUARE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename Type, bool SO >
+struct IsSquare< PackedMatrix<Type,SO> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISRESIZABLE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename Type, bool SO >
+struct IsResizable< PackedMatrix<Type,SO> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISSHRINKABLE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename Type, bool SO >
+struct IsShrinkable< PackedMatrix<Type,SO> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,581 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/PackedProxy.h
+//  \brief Header file for the PackedProxy class
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//
+//  * The names of its contributors may not be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_PACKEDPROXY_H_
+#define _BLAZE_MATH_DENSE_PACKEDPROXY_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/Matrix.h>
+#include <blaze/math/proxy/Proxy.h>
+#include <blaze/math/RelaxationFlag.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/IsNaN.h>
+#include <blaze/math/shims/IsOne.h>
+#include <blaze/math/shims/IsReal.h>
+#include <blaze/math/shims/IsZero.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Access proxy for adaptors with packed storage.
+// \ingroup math
+//
+// The PackedProxy provides controlled access to the elements of a non-const Hermitian, lower,
+// or upper matrix with packed storage (see the PackedMatrix class template). In contrast to
+// the proxies of the general dense adaptors, the PackedProxy does not hold a reference to the
+// accessed element, since in packed storage only a single triangle is stored and for instance
+// an upper element of a Hermitian matrix is not stored explicitly. Instead, the proxy stores
+// the row and column index of the accessed element and forwards all read accesses to the
+// function call operator and all write accesses to the \a set() function of the adaptor,
+// which guarantees that the adaptor invariant is not violated:
+
+   \code
+   using blaze::PackedMatrix;
+
+   blaze::LowerMatrix< PackedMatrix<int> > A( 3UL );
+
+   A(0,0) = -2;  //        ( -2 0 0 )
+   A(1,0) =  3;  // => A = (  3 0 0 )
+   A(2,1) =  5;  //        (  0 5 0 )
+
+   A(0,2) =  7;  // Invalid assignment to upper matrix element; results in an exception!
+   \endcode
+
+// The same proxy is used by the BandMatrix class template to reject the assignment of non-zero
+// values to elements outside of the stored band.
+*/
+template< typename MT >  // Type of the adaptor
+class PackedProxy
+   : public Proxy< PackedProxy<MT>, ElementType_t<MT> >
+{
+ public:
+   //**Type definitions****************************************************************************
+   using RepresentedType = ElementType_t<MT>;     //!< Type of the represented matrix element.
+   using ConstReference  = ConstReference_t<MT>;  //!< Reference-to-const to the represented element.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline PackedProxy( MT& matrix, size_t row, size_t column );
+   inline PackedProxy( const PackedProxy& pp );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   ~PackedProxy() = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline const PackedProxy& operator=( const PackedProxy& pp ) const;
+
+   template< typename T > inline const PackedProxy& operator= ( const T& value ) const;
+   template< typename T > inline const PackedProxy& operator+=( const T& value ) const;
+   template< typename T > inline const PackedProxy& operator-=( const T& value ) const;
+   template< typename T > inline const PackedProxy& operator*=( const T& value ) const;
+   template< typename T > inline const PackedProxy& operator/=( const T& value ) const;
+   template< typename T > inline const PackedProxy& operator%=( const T& value ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Access operators****************************************************************************
+   /*!\name Access operators */
+   //@{
+   inline const PackedProxy* operator->() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline ConstReference get() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Conversion operator*************************************************************************
+   /*!\name Conversion operator */
+   //@{
+   inline operator ConstReference() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   MT&    matrix_;  //!< Reference to the adaptor.
+   size_t row_;     //!< Row index of the accessed matrix element.
+   size_t column_;  //!< Column index of the accessed matrix element.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_MATRIX_TYPE       ( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( MT );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization constructor for a PackedProxy.
+//
+// \param matrix Reference to the adaptor.
+// \param row The row-index of the accessed matrix element.
+// \param column The column-index of the accessed matrix element.
+*/
+template< typename MT >  // Type of the adaptor
+inline PackedProxy<MT>::PackedProxy( MT& matrix, size_t row, size_t column )
+   : matrix_( matrix )  // Reference to the adaptor
+   , row_   ( row    )  // Row index of the accessed matrix element
+   , column_( column )  // Column index of the accessed matrix element
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for PackedProxy.
+//
+// \param pp Packed proxy to be copied.
+*/
+template< typename MT >  // Type of the adaptor
+inline PackedProxy<MT>::PackedProxy( const PackedProxy& pp )
+   : matrix_( pp.matrix_ )  // Reference to the adaptor
+   , row_   ( pp.row_    )  // Row index of the accessed matrix element
+   , column_( pp.column_ )  // Column index of the accessed matrix element
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for PackedProxy.
+//
+// \param pp Packed proxy to be copied.
+// \return Reference to the assigned proxy.
+// \exception std::invalid_argument Invalid assignment to matrix element.
+//
+// In case the assignment would violate the invariant of the adaptor, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename MT >  // Type of the adaptor
+inline const PackedProxy<MT>& PackedProxy<MT>::operator=( const PackedProxy& pp ) const
+{
+   matrix_.set( row_, column_, pp.get() );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment to the accessed matrix element.
+//
+// \param value The new value of the matrix element.
+// \return Reference to the assigned proxy.
+// \exception std::invalid_argument Invalid assignment to matrix element.
+//
+// In case the assignment would violate the invariant of the adaptor, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename MT >  // Type of the adaptor
+template< typename T >   // Type of the right-hand side value
+inline const PackedProxy<MT>& PackedProxy<MT>::operator=( const T& value ) const
+{
+   matrix_.set( row_, column_, value );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment to the accessed matrix element.
+//
+// \param value The right-hand side value to be added to the matrix element.
+// \return Reference to the assigned proxy.
+// \exception std::invalid_argument Invalid assignment to matrix element.
+//
+// In case the assignment would violate the invariant of the adaptor, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename MT >  // Type of the adaptor
+template< typename T >   // Type of the right-hand side value
+inline const PackedProxy<MT>& PackedProxy<MT>::operator+=( const T& value ) const
+{
+   matrix_.set( row_, column_, get() + value );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment to the accessed matrix element.
+//
+// \param value The right-hand side value to be subtracted from the matrix element.
+// \return Reference to the assigned proxy.
+// \exception std::invalid_argument Invalid assignment to matrix element.
+//
+// In case the assignment would violate the invariant of the adaptor, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename MT >  // Type of the adaptor
+template< typename T >   // Type of the right-hand side value
+inline const PackedProxy<MT>& PackedProxy<MT>::operator-=( const T& value ) const
+{
+   matrix_.set( row_, column_, get() - value );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment to the accessed matrix element.
+//
+// \param value The right-hand side value for the multiplication.
+// \return Reference to the assigned proxy.
+// \exception std::invalid_argument Invalid assignment to matrix element.
+//
+// In case the assignment would violate the invariant of the adaptor, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename MT >  // Type of the adaptor
+template< typename T >   // Type of the right-hand side value
+inline const PackedProxy<MT>& PackedProxy<MT>::operator*=( const T& value ) const
+{
+   matrix_.set( row_, column_, get() * value );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment to the accessed matrix element.
+//
+// \param value The right-hand side value for the division.
+// \return Reference to the assigned proxy.
+// \exception std::invalid_argument Invalid assignment to matrix element.
+//
+// In case the assignment would violate the invariant of the adaptor, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename MT >  // Type of the adaptor
+template< typename T >   // Type of the right-hand side value
+inline const PackedProxy<MT>& PackedProxy<MT>::operator/=( const T& value ) const
+{
+   matrix_.set( row_, column_, get() / value );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Modulo assignment to the accessed matrix element.
+//
+// \param value The right-hand side value for the modulo operation.
+// \return Reference to the assigned proxy.
+// \exception std::invalid_argument Invalid assignment to matrix element.
+//
+// In case the assignment would violate the invariant of the adaptor, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename MT >  // Type of the adaptor
+template< typename T >   // Type of the right-hand side value
+inline const PackedProxy<MT>& PackedProxy<MT>::operator%=( const T& value ) const
+{
+   matrix_.set( row_, column_, get() % value );
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ACCESS OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Direct access to the accessed matrix element.
+//
+// \return Pointer to the accessed matrix element.
+*/
+template< typename MT >  // Type of the adaptor
+inline const PackedProxy<MT>* PackedProxy<MT>::operator->() const noexcept
+{
+   return this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returning the value of the accessed matrix element.
+//
+// \return The current value of the accessed matrix element.
+*/
+template< typename MT >  // Type of the adaptor
+inline typename PackedProxy<MT>::ConstReference PackedProxy<MT>::get() const noexcept
+{
+   return const_cast<const MT&>( matrix_ )( row_, column_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONVERSION OPERATOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Conversion to the accessed matrix element.
+//
+// \return The current value of the accessed matrix element.
+*/
+template< typename MT >  // Type of the adaptor
+inline PackedProxy<MT>::operator ConstReference() const noexcept
+{
+   return get();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name PackedProxy global functions */
+//@{
+template< typename MT >
+void reset( const PackedProxy<MT>& proxy );
+
+template< typename MT >
+void clear( const PackedProxy<MT>& proxy );
+
+template< RelaxationFlag RF, typename MT >
+bool isDefault( const PackedProxy<MT>& proxy );
+
+template< RelaxationFlag RF, typename MT >
+bool isReal( const PackedProxy<MT>& proxy );
+
+template< RelaxationFlag RF, typename MT >
+bool isZero( const PackedProxy<MT>& proxy );
+
+template< RelaxationFlag RF, typename MT >
+bool isOne( const PackedProxy<MT>& proxy );
+
+template< typename MT >
+bool isnan( const PackedProxy<MT>& proxy );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the represented element to the default initial values.
+// \ingroup math
+//
+// \param proxy The given access proxy.
+// \return void
+//
+// This function resets the element represented by the access proxy to its default initial
+// value. Since elements in the restricted part of a lower or upper matrix are default values,
+// resetting such an element is a no-op and does not throw an exception.
+*/
+template< typename MT >
+inline void reset( const PackedProxy<MT>& proxy )
+{
+   using blaze::isDefault;
+
+   if( !isDefault( proxy.get() ) )
+      proxy = RepresentedType_t< PackedProxy<MT> >();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the represented element.
+// \ingroup math
+//
+// \param proxy The given access proxy.
+// \return void
+//
+// This function clears the element represented by the access proxy to its default initial
+// state.
+*/
+template< typename MT >
+inline void clear( const PackedProxy<MT>& proxy )
+{
+   using blaze::isDefault;
+
+   if( !isDefault( proxy.get() ) )
+      proxy = RepresentedType_t< PackedProxy<MT> >();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the represented element is in default state.
+// \ingroup math
+//
+// \param proxy The given access proxy.
+// \return \a true in case the represented element is in default state, \a false otherwise.
+*/
+template< RelaxationFlag RF, typename MT >
+inline bool isDefault( const PackedProxy<MT>& proxy )
+{
+   using blaze::isDefault;
+
+   return isDefault<RF>( proxy.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix element represents a real number.
+// \ingroup math
+//
+// \param proxy The given access proxy.
+// \return \a true in case the matrix element represents a real number, \a false otherwise.
+*/
+template< RelaxationFlag RF, typename MT >
+inline bool isReal( const PackedProxy<MT>& proxy )
+{
+   using blaze::isReal;
+
+   return isReal<RF>( proxy.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the represented element is 0.
+// \ingroup math
+//
+// \param proxy The given access proxy.
+// \return \a true in case the represented element is 0, \a false otherwise.
+*/
+template< RelaxationFlag RF, typename MT >
+inline bool isZero( const PackedProxy<MT>& proxy )
+{
+   using blaze::isZero;
+
+   return isZero<RF>( proxy.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the represented element is 1.
+// \ingroup math
+//
+// \param proxy The given access proxy.
+// \return \a true in case the represented element is 1, \a false otherwise.
+*/
+template< RelaxationFlag RF, typename MT >
+inline bool isOne( const PackedProxy<MT>& proxy )
+{
+   using blaze::isOne;
+
+   return isOne<RF>( proxy.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the represented element is not a number.
+// \ingroup math
+//
+// \param proxy The given access proxy.
+// \return \a true in case the represented element is in not a number, \a false otherwise.
+*/
+template< typename MT >
+inline bool isnan( const PackedProxy<MT>& proxy )
+{
+   using blaze::isnan;
+
+   return isnan( proxy.get() );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
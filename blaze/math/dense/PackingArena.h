@@ -0,0 +1,539 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/PackingArena.h
+//  \brief Header file for the thread-local packing arena of the dense matrix multiplication kernels
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_PACKINGARENA_H_
+#define _BLAZE_MATH_DENSE_PACKINGARENA_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+#include <utility>
+#include <vector>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/PackedMMMBlocking.h>
+#include <blaze/math/shims/NextMultiple.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/MemoryResource.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsVectorizable.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Statistics of the packing arena of the calling thread.
+// \ingroup dense_matrix
+*/
+struct PackingArenaStatistics
+{
+   size_t acquisitions;     //!< The number of packing buffers handed out to the calling thread.
+   size_t allocations;      //!< The number of heap allocations of the calling thread's arena.
+   size_t bytes;            //!< The number of bytes currently held by the calling thread's arena.
+   size_t totalAllocations; //!< The number of heap allocations of the arenas of all threads.
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Thread-local arena for the packing buffers of the dense matrix multiplication kernels.
+// \ingroup dense_matrix
+//
+// The blocked dense matrix multiplication kernels (mmm(), lmmm(), ummm(), and pmmm()) copy blocks
+// of their operands into contiguous, padded packing buffers. Instead of allocating these buffers
+// anew for every multiplication, the kernels draw them from the PackingArena of the calling
+// thread. Each buffer keeps its memory between multiplications and only grows in case a larger
+// buffer is requested. Growth is performed in size classes (four classes per power of two) in
+// order to avoid a sequence of small reallocations for slowly increasing matrix sizes. Hence in
+// the steady state, i.e. after the first multiplication of the largest size, no further heap
+// allocations take place.
+//
+// Every thread has its own arena, which is accessed via the instance() function. The memory of
+// the arena is released at the end of the thread or by an explicit call to release(). Please
+// note that the PackingArena is an implementation detail of the multiplication kernels. The
+// recommended way to interact with it is via the reservePackingArena(), releasePackingArena(),
+// getPackingArenaStatistics(), and resetPackingArenaStatistics() functions.
+*/
+class PackingArena
+   : private NonCopyable
+{
+ public:
+   //**Instance function***************************************************************************
+   /*!\name Instance function */
+   //@{
+   static inline PackingArena& instance();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Type, bool SO >
+   inline DynamicMatrix<Type,SO>& acquire( size_t m, size_t n );
+
+   template< typename Type, bool SO >
+   inline void reserve( size_t m, size_t n );
+
+   inline void release();
+
+   inline PackingArenaStatistics statistics() const noexcept;
+   inline void                   resetStatistics() noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   inline PackingArena();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Type, bool SO >
+   inline DynamicMatrix<Type,SO>& buffer();
+
+   template< typename Type, bool SO >
+   inline bool grow( DynamicMatrix<Type,SO>& buf, size_t m, size_t n );
+
+   template< typename Type, bool SO >
+   static inline void clearBuffer();
+
+   static inline size_t sizeClass( size_t elements ) noexcept;
+   static inline std::atomic<size_t>& totalAllocations() noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t acquisitions_;                   //!< The number of handed out packing buffers.
+   size_t allocations_;                    //!< The number of heap allocations.
+   size_t bytes_;                          //!< The number of bytes currently held by the arena.
+   std::vector<void(*)()> clearFunctions_; //!< The release functions of all used buffers.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The constructor of the PackingArena class.
+*/
+inline PackingArena::PackingArena()
+   : acquisitions_  ( 0UL )  // The number of handed out packing buffers
+   , allocations_   ( 0UL )  // The number of heap allocations
+   , bytes_         ( 0UL )  // The number of bytes currently held by the arena
+   , clearFunctions_()       // The release functions of all used buffers
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INSTANCE FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the packing arena of the calling thread.
+//
+// \return Reference to the packing arena of the calling thread.
+*/
+inline PackingArena& PackingArena::instance()
+{
+   static thread_local PackingArena arena;
+   return arena;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Hands out the packing buffer of the given element type and storage order.
+//
+// \param m The requested number of rows.
+// \param n The requested number of columns.
+// \return Reference to the \f$ m \times n \f$ packing buffer.
+//
+// This function returns a reference to the packing buffer of the calling thread for the given
+// element type and storage order, resized to \f$ m \times n \f$. The values of the elements
+// are unspecified, the padding elements are guaranteed to be zero. Heap memory is allocated
+// only in case the capacity of the buffer is insufficient. Note that there is exactly one
+// buffer per element type and storage order, i.e. a second call with the same template
+// arguments returns the same buffer.
+*/
+template< typename Type  // Data type of the buffer
+        , bool SO >      // Storage order of the buffer
+inline DynamicMatrix<Type,SO>& PackingArena::acquire( size_t m, size_t n )
+{
+   DynamicMatrix<Type,SO>& buf( buffer<Type,SO>() );
+   grow( buf, m, n );
+   buf.resize( m, n, false );
+   ++acquisitions_;
+   return buf;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reserves a packing buffer of the given element type and storage order.
+//
+// \param m The number of rows to reserve for.
+// \param n The number of columns to reserve for.
+// \return void
+//
+// This function makes sure that the packing buffer of the given element type and storage order
+// has sufficient capacity for \f$ m \times n \f$ elements.
+*/
+template< typename Type  // Data type of the buffer
+        , bool SO >      // Storage order of the buffer
+inline void PackingArena::reserve( size_t m, size_t n )
+{
+   grow( buffer<Type,SO>(), m, n );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Releases the memory of all packing buffers of the calling thread.
+//
+// \return void
+*/
+inline void PackingArena::release()
+{
+   for( void (*clear)() : clearFunctions_ ) {
+      clear();
+   }
+
+   bytes_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the statistics of the packing arena.
+//
+// \return The current statistics of the packing arena.
+*/
+inline PackingArenaStatistics PackingArena::statistics() const noexcept
+{
+   return PackingArenaStatistics{ acquisitions_, allocations_, bytes_, totalAllocations().load() };
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resets the counters of the packing arena.
+//
+// \return void
+//
+// This function resets the number of acquisitions and allocations of the calling thread. The
+// number of held bytes and the total number of allocations of all threads are not affected.
+*/
+inline void PackingArena::resetStatistics() noexcept
+{
+   acquisitions_ = 0UL;
+   allocations_  = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the packing buffer of the given element type and storage order.
+//
+// \return Reference to the packing buffer.
+//
+// On first use within a thread, the buffer registers its release function with the arena.
+*/
+template< typename Type  // Data type of the buffer
+        , bool SO >      // Storage order of the buffer
+inline DynamicMatrix<Type,SO>& PackingArena::buffer()
+{
+   static thread_local DynamicMatrix<Type,SO> buf;
+   static thread_local bool registered( false );
+
+   if( !registered ) {
+      clearFunctions_.push_back( &PackingArena::clearBuffer<Type,SO> );
+      registered = true;
+   }
+
+   return buf;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Increases the capacity of the given packing buffer if necessary.
+//
+// \param buf The packing buffer to be grown.
+// \param m The requested number of rows.
+// \param n The requested number of columns.
+// \return \a true in case new memory was allocated, \a false if not.
+//
+// The new capacity is rounded up to the next size class. In case memory is allocated, the
+// contents of the buffer are discarded.
+*/
+template< typename Type  // Data type of the buffer
+        , bool SO >      // Storage order of the buffer
+inline bool PackingArena::grow( DynamicMatrix<Type,SO>& buf, size_t m, size_t n )
+{
+   constexpr size_t SIMDSIZE( IsVectorizable_v<Type> ? SIMDTrait<Type>::size : 1UL );
+
+   const size_t elements( SO ? nextMultiple( m, SIMDSIZE ) * n : m * nextMultiple( n, SIMDSIZE ) );
+
+   if( elements <= buf.capacity() )
+      return false;
+
+   const size_t capacity( sizeClass( elements ) );
+
+   bytes_ -= buf.capacity() * sizeof( Type );
+
+   // The packing buffers outlive any arena section and are therefore always heap allocated
+   const MemoryResourceSection heap( nullptr );
+
+   DynamicMatrix<Type,SO> tmp;
+   tmp.reserve( capacity );
+   buf.swap( tmp );
+
+   bytes_ += capacity * sizeof( Type );
+   ++allocations_;
+   ++totalAllocations();
+
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Releases the memory of the packing buffer of the given element type and storage order.
+//
+// \return void
+*/
+template< typename Type  // Data type of the buffer
+        , bool SO >      // Storage order of the buffer
+inline void PackingArena::clearBuffer()
+{
+   DynamicMatrix<Type,SO> tmp;
+   instance().buffer<Type,SO>().swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Rounds the given number of elements up to the next size class.
+//
+// \param elements The requested number of elements.
+// \return The number of elements of the according size class.
+//
+// The size classes are spaced at a quarter of the power of two below the requested size,
+// which limits the memory overhead to 25%.
+*/
+inline size_t PackingArena::sizeClass( size_t elements ) noexcept
+{
+   if( elements <= 64UL )
+      return 64UL;
+
+   size_t power( 64UL );
+   while( power <= ( elements - 1UL ) / 2UL ) {
+      power *= 2UL;
+   }
+
+   return nextMultiple( elements, power / 4UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of heap allocations of the packing arenas of all threads.
+//
+// \return Reference to the global allocation counter.
+*/
+inline std::atomic<size_t>& PackingArena::totalAllocations() noexcept
+{
+   static std::atomic<size_t> count( 0UL );
+   return count;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PACKING ARENA FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Packing arena functions */
+//@{
+template< typename Type >
+inline void reservePackingArena( size_t n );
+
+inline void releasePackingArena();
+inline PackingArenaStatistics getPackingArenaStatistics();
+inline void resetPackingArenaStatistics();
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reserves the packing buffers of the calling thread for a given problem size.
+// \ingroup dense_matrix
+//
+// \param n The maximum number of rows and columns of the multiplied matrices.
+// \return void
+//
+// This function reserves the packing buffers of the calling thread such that the blocked dense
+// matrix multiplication kernels don't have to allocate any memory for multiplications between
+// matrices of element type \a Type with at most \a n rows and columns:
+
+   \code
+   blaze::reservePackingArena<double>( 800UL );
+
+   blaze::DynamicMatrix<double> A( 800UL, 800UL ), B( 800UL, 800UL ), C;
+   C = A * B;  // No allocation of packing buffers
+   \endcode
+
+// Note that every thread owns its own packing arena. In case the multiplication is executed
+// in parallel, the arenas of the worker threads grow on the first multiplication.
+*/
+template< typename Type >  // Element type of the multiplied matrices
+inline void reservePackingArena( size_t n )
+{
+   constexpr size_t KBLOCK( MMM_OUTER_BLOCK_SIZE * ( 16UL/sizeof(Type) ) );
+   constexpr size_t BLOCK ( MMM_INNER_BLOCK_SIZE );
+
+   PackingArena& arena( PackingArena::instance() );
+
+   // Packing buffers of the panel based kernels (mmm(), lmmm(), and ummm())
+   arena.reserve<Type,rowMajor>( max( n, BLOCK ), KBLOCK );
+   arena.reserve<Type,columnMajor>( KBLOCK, max( n, BLOCK ) );
+
+   // Packing buffers of the packed kernel (pmmm())
+   const PackedMMMParameters params( packedMMMParameters<Type>() );
+   const size_t mc( min( params.mc, ( n + params.mr - 1UL ) / params.mr * params.mr ) );
+   const size_t nc( min( params.nc, ( n + params.nr - 1UL ) / params.nr * params.nr ) );
+   const size_t kc( min( params.kc, n ) );
+   arena.reserve<Type,rowMajor>( 1UL, mc*kc );
+   arena.reserve<Type,columnMajor>( kc*nc, 1UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Releases the memory of all packing buffers of the calling thread.
+// \ingroup dense_matrix
+//
+// \return void
+*/
+inline void releasePackingArena()
+{
+   PackingArena::instance().release();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the statistics of the packing arena of the calling thread.
+// \ingroup dense_matrix
+//
+// \return The statistics of the packing arena of the calling thread.
+//
+// This function can be used to verify that repeated multiplications don't allocate memory:
+
+   \code
+   blaze::DynamicMatrix<double> A( 400UL, 400UL ), B( 400UL, 400UL ), C;
+
+   C = A * B;  // First multiplication: packing buffers are allocated
+   blaze::resetPackingArenaStatistics();
+
+   C = A * B;  // Steady state: no allocations
+   assert( blaze::getPackingArenaStatistics().allocations == 0UL );
+   \endcode
+*/
+inline PackingArenaStatistics getPackingArenaStatistics()
+{
+   return PackingArena::instance().statistics();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resets the acquisition and allocation counters of the packing arena of the calling thread.
+// \ingroup dense_matrix
+//
+// \return void
+*/
+inline void resetPackingArenaStatistics()
+{
+   PackingArena::instance().resetStatistics();
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
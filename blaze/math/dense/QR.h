@@ -168,7 +168,10 @@ inline auto qr_backend( MT1& A, const ElementType_t<MT1>* tau )
 // element type results in a compile time error!
 //
 // \note This function can only be used if a fitting LAPACK library is available and linked to
-// the executable. Otherwise a call to this function will result in a linker error.
+// the executable. Otherwise a call to this function will result in a linker error. In case the
+// LAPACK mode is disabled (see the BLAZE_LAPACK_MODE switch) or in case of matrices with a small
+// compile time maximum size (as for instance StaticMatrix), the decomposition is computed by the
+// native Blaze kernels and no LAPACK library is required.
 */
 template< typename MT1  // Type of matrix A
         , bool SO1      // Storage order of matrix A
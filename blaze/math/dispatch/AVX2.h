@@ -0,0 +1,175 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dispatch/AVX2.h
+//  \brief Header file for the AVX2 variants of the dispatched kernels
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DISPATCH_AVX2_H_
+#define _BLAZE_MATH_DISPATCH_AVX2_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/system/Vectorization.h>
+
+#if BLAZE_RUNTIME_DISPATCH_MODE
+#  include <immintrin.h>
+#  include <blaze/math/dispatch/KernelTable.h>
+#  include <blaze/util/Types.h>
+#endif
+
+
+#if BLAZE_RUNTIME_DISPATCH_MODE
+
+#if defined(__clang__)
+#  pragma clang attribute push( __attribute__((target("avx2,fma"))), apply_to = function )
+#else
+#  pragma GCC push_options
+#  pragma GCC target("avx2,fma")
+#endif
+
+namespace blaze {
+
+namespace dispatch {
+
+namespace avx2 {
+
+//=================================================================================================
+//
+//  SIMD OPERATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD operations of the AVX2 variants of the dispatched kernels.
+// \ingroup dispatch
+*/
+template< typename T >  // Element type
+struct VecOps;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the VecOps class template for single precision values.
+// \ingroup dispatch
+*/
+template<>
+struct VecOps<float>
+{
+   using Type = __m256;  //!< The type of a SIMD vector.
+
+   static constexpr size_t size      = 8UL;   //!< The number of values in a SIMD vector.
+   static constexpr size_t alignment = 32UL;  //!< The alignment of a SIMD vector.
+   static constexpr size_t MR        = 6UL;   //!< The number of rows of the register tile.
+
+   static inline Type zero  ()                           { return _mm256_setzero_ps(); }
+   static inline Type set   ( float v )                  { return _mm256_set1_ps( v ); }
+   static inline Type loadu ( const float* p )           { return _mm256_loadu_ps( p ); }
+   static inline void storeu( float* p, Type a )         { _mm256_storeu_ps( p, a ); }
+   static inline void stream( float* p, Type a )         { _mm256_stream_ps( p, a ); }
+   static inline Type add   ( Type a, Type b )           { return _mm256_add_ps( a, b ); }
+   static inline Type sub   ( Type a, Type b )           { return _mm256_sub_ps( a, b ); }
+   static inline Type mul   ( Type a, Type b )           { return _mm256_mul_ps( a, b ); }
+   static inline Type fmadd ( Type a, Type b, Type c )   { return _mm256_fmadd_ps( a, b, c ); }
+
+   static inline float sum( Type a ) {
+      __m128 b( _mm_add_ps( _mm256_castps256_ps128( a ), _mm256_extractf128_ps( a, 1 ) ) );
+      b = _mm_add_ps( b, _mm_movehl_ps( b, b ) );
+      return _mm_cvtss_f32( _mm_add_ss( b, _mm_shuffle_ps( b, b, 1 ) ) );
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the VecOps class template for double precision values.
+// \ingroup dispatch
+*/
+template<>
+struct VecOps<double>
+{
+   using Type = __m256d;  //!< The type of a SIMD vector.
+
+   static constexpr size_t size      = 4UL;   //!< The number of values in a SIMD vector.
+   static constexpr size_t alignment = 32UL;  //!< The alignment of a SIMD vector.
+   static constexpr size_t MR        = 6UL;   //!< The number of rows of the register tile.
+
+   static inline Type zero  ()                           { return _mm256_setzero_pd(); }
+   static inline Type set   ( double v )                 { return _mm256_set1_pd( v ); }
+   static inline Type loadu ( const double* p )          { return _mm256_loadu_pd( p ); }
+   static inline void storeu( double* p, Type a )        { _mm256_storeu_pd( p, a ); }
+   static inline void stream( double* p, Type a )        { _mm256_stream_pd( p, a ); }
+   static inline Type add   ( Type a, Type b )           { return _mm256_add_pd( a, b ); }
+   static inline Type sub   ( Type a, Type b )           { return _mm256_sub_pd( a, b ); }
+   static inline Type mul   ( Type a, Type b )           { return _mm256_mul_pd( a, b ); }
+   static inline Type fmadd ( Type a, Type b, Type c )   { return _mm256_fmadd_pd( a, b, c ); }
+
+   static inline double sum( Type a ) {
+      const __m128d b( _mm_add_pd( _mm256_castpd256_pd128( a ), _mm256_extractf128_pd( a, 1 ) ) );
+      return _mm_cvtsd_f64( _mm_add_sd( b, _mm_unpackhi_pd( b, b ) ) );
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  KERNELS
+//
+//=================================================================================================
+
+#include <blaze/math/dispatch/Kernels.h>
+
+} // namespace avx2
+
+} // namespace dispatch
+
+} // namespace blaze
+
+#if defined(__clang__)
+#  pragma clang attribute pop
+#else
+#  pragma GCC pop_options
+#endif
+
+#endif
+
+#endif
@@ -0,0 +1,291 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dispatch/Functions.h
+//  \brief Header file for the runtime dispatched kernel functions
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DISPATCH_FUNCTIONS_H_
+#define _BLAZE_MATH_DISPATCH_FUNCTIONS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/system/Vectorization.h>
+
+#if BLAZE_RUNTIME_DISPATCH_MODE
+#  include <blaze/math/Aliases.h>
+#  include <blaze/math/constraints/ConstDataAccess.h>
+#  include <blaze/math/constraints/MutableDataAccess.h>
+#  include <blaze/math/dispatch/AVX2.h>
+#  include <blaze/math/dispatch/AVX512F.h>
+#  include <blaze/math/dispatch/InstructionSet.h>
+#  include <blaze/math/dispatch/KernelTable.h>
+#  include <blaze/math/dispatch/SSE2.h>
+#  include <blaze/math/expressions/DenseMatrix.h>
+#  include <blaze/math/expressions/DenseVector.h>
+#  include <blaze/util/Assert.h>
+#  include <blaze/util/Types.h>
+#  include <blaze/util/typetraits/RemoveCV.h>
+#endif
+
+
+namespace blaze {
+
+#if BLAZE_RUNTIME_DISPATCH_MODE
+
+//=================================================================================================
+//
+//  KERNEL SELECTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the kernel table of the currently selected instruction set.
+// \ingroup dispatch
+//
+// \return Reference to the kernel table for the element type \a T.
+//
+// This function returns the table of the kernels that are compiled for the instruction set
+// that is currently selected (see getInstructionSet()). The element type \a T is required to
+// be either \c float or \c double.
+*/
+template< typename T >  // Element type
+inline const KernelTable<T>& getKernelTable() noexcept
+{
+   switch( getInstructionSet() ) {
+      case InstructionSet::avx512f: return dispatch::avx512f::getKernelTable<T>();
+      case InstructionSet::avx2   : return dispatch::avx2::getKernelTable<T>();
+      default                     : return dispatch::sse2::getKernelTable<T>();
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DISPATCHED KERNEL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Runtime dispatched kernel for a dense matrix/dense vector multiplication
+//        (\f$ \vec{y}=\alpha*A*\vec{x}+\beta*\vec{y} \f$).
+// \ingroup dispatch
+//
+// \param y The target left-hand side dense vector.
+// \param A The left-hand side dense matrix operand.
+// \param x The right-hand side dense vector operand.
+// \param alpha The scaling factor for \f$ A*\vec{x} \f$.
+// \param beta The scaling factor for \f$ \vec{y} \f$.
+// \return void
+//
+// This function performs the dense matrix/dense vector multiplication by means of the kernel
+// of the currently selected instruction set. All operands are required to provide access to
+// their contiguous \c float or \c double elements via the data() member function.
+*/
+template< typename VT1   // Type of the left-hand side target vector
+        , typename MT1   // Type of the left-hand side matrix operand
+        , bool SO        // Storage order of the left-hand side matrix operand
+        , typename VT2   // Type of the right-hand side vector operand
+        , typename ST >  // Type of the scalar factors
+inline void dispatchGemv( DenseVector<VT1,false>& y, const DenseMatrix<MT1,SO>& A,
+                          const DenseVector<VT2,false>& x, ST alpha, ST beta )
+{
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( VT1 );
+   BLAZE_CONSTRAINT_MUST_HAVE_CONST_DATA_ACCESS  ( MT1 );
+   BLAZE_CONSTRAINT_MUST_HAVE_CONST_DATA_ACCESS  ( VT2 );
+
+   using ET = RemoveCV_t< ElementType_t<VT1> >;
+
+   BLAZE_INTERNAL_ASSERT( (~A).rows()    == (~y).size(), "Invalid vector size" );
+   BLAZE_INTERNAL_ASSERT( (~A).columns() == (~x).size(), "Invalid vector size" );
+
+   const KernelTable<ET>& table( getKernelTable<ET>() );
+
+   ( SO ? table.tgemv : table.gemv )( (~A).rows(), (~A).columns(), (~A).data(), (~A).spacing(),
+                                      (~x).data(), (~y).data(), ET( alpha ), ET( beta ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Runtime dispatched summation of a range of a dense vector.
+// \ingroup dispatch
+//
+// \param dv The given dense vector.
+// \param begin The index of the first element of the range.
+// \param end The index one past the last element of the range.
+// \return The sum of the elements in the range \f$ [begin..end) \f$.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline ElementType_t<VT> dispatchSum( const DenseVector<VT,TF>& dv, size_t begin, size_t end )
+{
+   BLAZE_CONSTRAINT_MUST_HAVE_CONST_DATA_ACCESS( VT );
+
+   using ET = RemoveCV_t< ElementType_t<VT> >;
+
+   BLAZE_INTERNAL_ASSERT( begin <= end && end <= (~dv).size(), "Invalid index range" );
+
+   return getKernelTable<ET>().sum( end-begin, (~dv).data()+begin );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Runtime dispatched inner product of a range of two dense vectors.
+// \ingroup dispatch
+//
+// \param lhs The left-hand side dense vector.
+// \param rhs The right-hand side dense vector.
+// \param begin The index of the first element of the range.
+// \param end The index one past the last element of the range.
+// \return The inner product of the elements in the range \f$ [begin..end) \f$.
+*/
+template< typename VT1   // Type of the left-hand side dense vector
+        , bool TF1       // Transpose flag of the left-hand side dense vector
+        , typename VT2   // Type of the right-hand side dense vector
+        , bool TF2 >     // Transpose flag of the right-hand side dense vector
+inline ElementType_t<VT1>
+   dispatchDot( const DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& rhs,
+                size_t begin, size_t end )
+{
+   BLAZE_CONSTRAINT_MUST_HAVE_CONST_DATA_ACCESS( VT1 );
+   BLAZE_CONSTRAINT_MUST_HAVE_CONST_DATA_ACCESS( VT2 );
+
+   using ET = RemoveCV_t< ElementType_t<VT1> >;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
+   BLAZE_INTERNAL_ASSERT( begin <= end && end <= (~lhs).size(), "Invalid index range" );
+
+   return getKernelTable<ET>().dot( end-begin, (~lhs).data()+begin, (~rhs).data()+begin );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Runtime dispatched assignment of a dense vector (\f$ \vec{y}=\vec{x} \f$).
+// \ingroup dispatch
+//
+// \param y The target left-hand side dense vector.
+// \param x The right-hand side dense vector.
+// \param stream \a true in case the target should be written via non-temporal stores.
+// \return void
+*/
+template< typename VT1  // Type of the left-hand side target vector
+        , typename VT2  // Type of the right-hand side dense vector
+        , bool TF >     // Transpose flag
+inline void dispatchAssign( DenseVector<VT1,TF>& y, const DenseVector<VT2,TF>& x, bool stream )
+{
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( VT1 );
+   BLAZE_CONSTRAINT_MUST_HAVE_CONST_DATA_ACCESS  ( VT2 );
+
+   using ET = RemoveCV_t< ElementType_t<VT1> >;
+
+   BLAZE_INTERNAL_ASSERT( (~y).size() == (~x).size(), "Invalid vector sizes" );
+
+   getKernelTable<ET>().copy( (~y).size(), (~x).data(), (~y).data(), stream );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Runtime dispatched addition assignment of a dense vector (\f$ \vec{y}+=\vec{x} \f$).
+// \ingroup dispatch
+//
+// \param y The target left-hand side dense vector.
+// \param x The right-hand side dense vector.
+// \return void
+*/
+template< typename VT1  // Type of the left-hand side target vector
+        , typename VT2  // Type of the right-hand side dense vector
+        , bool TF >     // Transpose flag
+inline void dispatchAddAssign( DenseVector<VT1,TF>& y, const DenseVector<VT2,TF>& x )
+{
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( VT1 );
+   BLAZE_CONSTRAINT_MUST_HAVE_CONST_DATA_ACCESS  ( VT2 );
+
+   using ET = RemoveCV_t< ElementType_t<VT1> >;
+
+   BLAZE_INTERNAL_ASSERT( (~y).size() == (~x).size(), "Invalid vector sizes" );
+
+   getKernelTable<ET>().add( (~y).size(), (~x).data(), (~y).data() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Runtime dispatched subtraction assignment of a dense vector (\f$ \vec{y}-=\vec{x} \f$).
+// \ingroup dispatch
+//
+// \param y The target left-hand side dense vector.
+// \param x The right-hand side dense vector.
+// \return void
+*/
+template< typename VT1  // Type of the left-hand side target vector
+        , typename VT2  // Type of the right-hand side dense vector
+        , bool TF >     // Transpose flag
+inline void dispatchSubAssign( DenseVector<VT1,TF>& y, const DenseVector<VT2,TF>& x )
+{
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( VT1 );
+   BLAZE_CONSTRAINT_MUST_HAVE_CONST_DATA_ACCESS  ( VT2 );
+
+   using ET = RemoveCV_t< ElementType_t<VT1> >;
+
+   BLAZE_INTERNAL_ASSERT( (~y).size() == (~x).size(), "Invalid vector sizes" );
+
+   getKernelTable<ET>().sub( (~y).size(), (~x).data(), (~y).data() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+#endif
+
+} // namespace blaze
+
+#endif
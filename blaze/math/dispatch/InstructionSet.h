@@ -0,0 +1,275 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dispatch/InstructionSet.h
+//  \brief Header file for the runtime detection and selection of the instruction set
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DISPATCH_INSTRUCTIONSET_H_
+#define _BLAZE_MATH_DISPATCH_INSTRUCTIONSET_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/system/Vectorization.h>
+
+#if BLAZE_RUNTIME_DISPATCH_MODE
+#  include <atomic>
+#  include <cstdlib>
+#  include <cstring>
+#  include <ostream>
+#  include <blaze/util/Exception.h>
+#endif
+
+
+namespace blaze {
+
+#if BLAZE_RUNTIME_DISPATCH_MODE
+
+//=================================================================================================
+//
+//  INSTRUCTION SET IDENTIFIERS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Identifiers of the instruction sets supported by the runtime dispatch.
+// \ingroup dispatch
+//
+// In case the runtime dispatch is enabled (see the BLAZE_USE_RUNTIME_DISPATCH switch), the
+// performance critical kernels of the Blaze library are compiled for each of these instruction
+// sets. The identifiers are ordered, i.e. every instruction set includes all instruction sets
+// with a smaller identifier.
+*/
+enum class InstructionSet : int
+{
+   sse2    = 0,  //!< The SSE2 instruction set (the x86-64 baseline).
+   avx2    = 1,  //!< The AVX2 and FMA instruction sets.
+   avx512f = 2   //!< The AVX-512 foundation instruction set.
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Global output operator for instruction set identifiers.
+// \ingroup dispatch
+//
+// \param os Reference to the output stream.
+// \param is The instruction set identifier to be printed.
+// \return Reference to the output stream.
+*/
+inline std::ostream& operator<<( std::ostream& os, InstructionSet is )
+{
+   switch( is ) {
+      case InstructionSet::avx512f: return os << "avx512f";
+      case InstructionSet::avx2   : return os << "avx2";
+      default                     : return os << "sse2";
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INSTRUCTION SET DETECTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Detects the most capable instruction set of the executing CPU.
+// \ingroup dispatch
+//
+// \return The most capable instruction set supported by both the CPU and the operating system.
+//
+// This function queries the CPU via CPUID. An instruction set is only reported in case the
+// operating system also saves the according register state on context switches. AVX2 is only
+// reported in combination with FMA.
+*/
+inline InstructionSet detectInstructionSet() noexcept
+{
+   __builtin_cpu_init();
+
+   if( __builtin_cpu_supports( "avx512f" ) ) {
+      return InstructionSet::avx512f;
+   }
+   else if( __builtin_cpu_supports( "avx2" ) && __builtin_cpu_supports( "fma" ) ) {
+      return InstructionSet::avx2;
+   }
+   else {
+      return InstructionSet::sse2;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given instruction set is supported by the executing CPU.
+// \ingroup dispatch
+//
+// \param is The instruction set to be checked.
+// \return \a true in case the instruction set is supported, \a false if not.
+*/
+inline bool isSupported( InstructionSet is ) noexcept
+{
+   return static_cast<int>( is ) <= static_cast<int>( detectInstructionSet() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the instruction set selected at program startup.
+// \ingroup dispatch
+//
+// \return The instruction set selected at program startup.
+//
+// The initial instruction set is the most capable instruction set of the executing CPU (see
+// detectInstructionSet()). It can be restricted via the \c BLAZE_INSTRUCTION_SET environment
+// variable, which may be set to \c sse2, \c avx2, or \c avx512f. Values that name an instruction
+// set that is not supported by the CPU or that cannot be parsed are ignored.
+*/
+#if (defined _MSC_VER)
+#  pragma warning(push)
+#  pragma warning(disable:4996)
+#endif
+inline InstructionSet initialInstructionSet() noexcept
+{
+   const InstructionSet detected( detectInstructionSet() );
+   const char* env = std::getenv( "BLAZE_INSTRUCTION_SET" );
+
+   if( env == nullptr ) {
+      return detected;
+   }
+
+   InstructionSet requested( detected );
+
+   if     ( std::strcmp( env, "sse2"    ) == 0 ) requested = InstructionSet::sse2;
+   else if( std::strcmp( env, "avx2"    ) == 0 ) requested = InstructionSet::avx2;
+   else if( std::strcmp( env, "avx512f" ) == 0 ) requested = InstructionSet::avx512f;
+
+   return ( static_cast<int>( requested ) < static_cast<int>( detected ) ) ? requested : detected;
+}
+#if (defined _MSC_VER)
+#  pragma warning(pop)
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the storage of the currently selected instruction set.
+// \ingroup dispatch
+//
+// \return Reference to the atomic storage of the currently selected instruction set.
+//
+// The instruction set is detected once, on the first call of this function.
+*/
+inline std::atomic<InstructionSet>& instructionSetStorage() noexcept
+{
+   static std::atomic<InstructionSet> is( initialInstructionSet() );
+   return is;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INSTRUCTION SET SELECTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the instruction set used by the dispatched kernels.
+// \ingroup dispatch
+//
+// \return The instruction set used by the dispatched kernels.
+//
+// This function returns the instruction set that is used by the runtime dispatched kernels of
+// the Blaze library. By default, this is the most capable instruction set of the executing CPU,
+// potentially restricted by the \c BLAZE_INSTRUCTION_SET environment variable:
+
+   \code
+   std::cout << blaze::getInstructionSet() << "\n";  // Prints for instance "avx2"
+   \endcode
+
+// \note This function is only available in case the runtime dispatch is enabled (see the
+// BLAZE_USE_RUNTIME_DISPATCH switch and the BLAZE_RUNTIME_DISPATCH_MODE macro).
+*/
+inline InstructionSet getInstructionSet() noexcept
+{
+   return instructionSetStorage().load( std::memory_order_relaxed );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Selects the instruction set used by the dispatched kernels.
+// \ingroup dispatch
+//
+// \param is The instruction set to be used by the dispatched kernels.
+// \return void
+// \exception std::invalid_argument Unsupported instruction set.
+//
+// This function selects the instruction set that is used by all subsequent calls of the runtime
+// dispatched kernels of the Blaze library. In case the given instruction set is not supported
+// by the executing CPU, a \a std::invalid_argument exception is thrown. The function is meant
+// for testing and benchmarking purposes and should not be called while other threads execute
+// Blaze operations.
+
+   \code
+   blaze::setInstructionSet( blaze::InstructionSet::sse2 );  // Use the SSE2 kernels
+   \endcode
+
+// \note This function is only available in case the runtime dispatch is enabled (see the
+// BLAZE_USE_RUNTIME_DISPATCH switch and the BLAZE_RUNTIME_DISPATCH_MODE macro).
+*/
+inline void setInstructionSet( InstructionSet is )
+{
+   if( !isSupported( is ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Unsupported instruction set" );
+   }
+
+   instructionSetStorage().store( is, std::memory_order_relaxed );
+}
+//*************************************************************************************************
+
+#endif
+
+} // namespace blaze
+
+#endif
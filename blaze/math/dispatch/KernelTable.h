@@ -0,0 +1,136 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dispatch/KernelTable.h
+//  \brief Header file for the table of the dispatched kernels
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DISPATCH_KERNELTABLE_H_
+#define _BLAZE_MATH_DISPATCH_KERNELTABLE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdint>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Table of the kernels of one instruction set for the runtime dispatch.
+// \ingroup dispatch
+//
+// The KernelTable class template holds the pointers to all kernels that are compiled for a
+// particular instruction set (see blaze::InstructionSet) and element type \a T (\c float or
+// \c double). All kernels operate on contiguous arrays. The following kernels are provided:
+//
+//  - \a gemmKernel: The micro-kernel of the packed dense matrix multiplication. It computes the
+//    product of a packed \f$ mr \times kc \f$ panel of the left-hand side operand (stored column
+//    by column) and a packed \f$ kc \times nr \f$ panel of the right-hand side operand (stored
+//    row by row) and stores the resulting \f$ mr \times nr \f$ tile row by row.
+//  - \a gemv and \a tgemv: The computation of \f$ \vec{y}=\alpha*A*\vec{x}+\beta*\vec{y} \f$ for
+//    a row-major and column-major matrix \a A, respectively. For \f$ \beta=0 \f$ the initial
+//    values of \a y are ignored.
+//  - \a sum and \a dot: The summation of an array and the inner product of two arrays.
+//  - \a copy, \a add and \a sub: The assignment, addition assignment and subtraction assignment
+//    of an array. In case \a copy is called with \a stream set to \a true, the target is written
+//    via non-temporal stores.
+*/
+template< typename T >  // Element type
+struct KernelTable
+{
+   //**Type definitions****************************************************************************
+   using GemmKernel = void (*)( size_t kc, const T* a, const T* b, T* ab );
+   using GemvKernel = void (*)( size_t m, size_t n, const T* A, size_t lda,
+                                const T* x, T* y, T alpha, T beta );
+   using SumKernel  = T    (*)( size_t n, const T* x );
+   using DotKernel  = T    (*)( size_t n, const T* x, const T* y );
+   using CopyKernel = void (*)( size_t n, const T* x, T* y, bool stream );
+   using AddKernel  = void (*)( size_t n, const T* x, T* y );
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! The maximum number of elements of a register tile of the matrix multiplication kernels.
+   static constexpr size_t maxTileSize = 24UL * ( 64UL / sizeof(T) );
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   size_t     mr;          //!< The number of rows of the register tile of the gemm kernel.
+   size_t     nr;          //!< The number of columns of the register tile of the gemm kernel.
+   GemmKernel gemmKernel;  //!< The micro-kernel of the packed dense matrix multiplication.
+   GemvKernel gemv;        //!< The row-major dense matrix/dense vector multiplication kernel.
+   GemvKernel tgemv;       //!< The column-major dense matrix/dense vector multiplication kernel.
+   SumKernel  sum;         //!< The summation kernel.
+   DotKernel  dot;         //!< The inner product kernel.
+   CopyKernel copy;        //!< The assignment kernel.
+   AddKernel  add;         //!< The addition assignment kernel.
+   AddKernel  sub;         //!< The subtraction assignment kernel.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Requests the complete unrolling of the following loop with a compile time trip count.
+// \ingroup dispatch
+*/
+#if defined(__clang__)
+#  define BLAZE_DISPATCH_UNROLL _Pragma("unroll")
+#elif defined(__GNUC__) && ( __GNUC__ >= 8 )
+#  define BLAZE_DISPATCH_UNROLL _Pragma("GCC unroll 32")
+#else
+#  define BLAZE_DISPATCH_UNROLL
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
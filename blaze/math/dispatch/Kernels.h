@@ -0,0 +1,537 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dispatch/Kernels.h
+//  \brief Implementation of the dispatched kernels for a single instruction set
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+// This file is intentionally not protected by an include guard. It is included once by each of
+// the instruction set specific headers (see <blaze/math/dispatch/SSE2.h>, AVX2.h and AVX512F.h)
+// within the namespace of the instruction set and within a region that compiles all functions
+// for the according target. All kernels are implemented in terms of the VecOps class template
+// of the including header.
+
+
+//=================================================================================================
+//
+//  DENSE MATRIX MULTIPLICATION KERNEL
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Micro-kernel of the packed dense matrix multiplication.
+// \ingroup dispatch
+//
+// \param kc The depth of the packed panels.
+// \param a The packed \f$ MR \times kc \f$ panel of the left-hand side operand.
+// \param b The packed \f$ kc \times NR \f$ panel of the right-hand side operand.
+// \param ab The output tile.
+// \return void
+//
+// This function computes an \f$ MR \times NR \f$ register tile with \f$ NR \f$ being twice the
+// number of values in a SIMD vector (see KernelTable for the layout of the panels).
+*/
+template< typename T >  // Element type
+void gemmKernel( size_t kc, const T* __restrict a, const T* __restrict b, T* __restrict ab )
+{
+   using Ops  = VecOps<T>;
+   using Type = typename Ops::Type;
+
+   constexpr size_t MR( Ops::MR );
+   constexpr size_t SIMDSIZE( Ops::size );
+
+   Type xmm[MR][2];
+
+   BLAZE_DISPATCH_UNROLL
+   for( size_t r=0UL; r<MR; ++r ) {
+      xmm[r][0] = Ops::zero();
+      xmm[r][1] = Ops::zero();
+   }
+
+   for( size_t k=0UL; k<kc; ++k )
+   {
+      const Type b1( Ops::loadu( b          ) );
+      const Type b2( Ops::loadu( b+SIMDSIZE ) );
+
+      BLAZE_DISPATCH_UNROLL
+      for( size_t r=0UL; r<MR; ++r ) {
+         const Type a1( Ops::set( a[r] ) );
+         xmm[r][0] = Ops::fmadd( a1, b1, xmm[r][0] );
+         xmm[r][1] = Ops::fmadd( a1, b2, xmm[r][1] );
+      }
+
+      a += MR;
+      b += 2UL*SIMDSIZE;
+   }
+
+   BLAZE_DISPATCH_UNROLL
+   for( size_t r=0UL; r<MR; ++r ) {
+      Ops::storeu( ab+r*2UL*SIMDSIZE         , xmm[r][0] );
+      Ops::storeu( ab+r*2UL*SIMDSIZE+SIMDSIZE, xmm[r][1] );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DENSE MATRIX/DENSE VECTOR MULTIPLICATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Kernel for the multiplication of a row-major dense matrix and a dense vector
+//        (\f$ \vec{y}=\alpha*A*\vec{x}+\beta*\vec{y} \f$).
+// \ingroup dispatch
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param A Pointer to the first element of the matrix.
+// \param lda The spacing between two rows of the matrix.
+// \param x Pointer to the first element of the right-hand side vector.
+// \param y Pointer to the first element of the target vector.
+// \param alpha The scaling factor for \f$ A*\vec{x} \f$.
+// \param beta The scaling factor for \f$ \vec{y} \f$.
+// \return void
+//
+// The kernel computes four rows at a time, each of which as a SIMD inner product.
+*/
+template< typename T >  // Element type
+void gemvKernel( size_t m, size_t n, const T* A, size_t lda, const T* x, T* y, T alpha, T beta )
+{
+   using Ops  = VecOps<T>;
+   using Type = typename Ops::Type;
+
+   constexpr size_t SIMDSIZE( Ops::size );
+
+   const size_t jpos( n - n % SIMDSIZE );
+
+   const auto update = [alpha,beta]( T& target, T value ) {
+      target = ( beta == T(0) ) ? alpha*value : alpha*value + beta*target;
+   };
+
+   size_t i( 0UL );
+
+   for( ; (i+4UL) <= m; i+=4UL )
+   {
+      const T* a1( A + i*lda );
+      const T* a2( a1 + lda );
+      const T* a3( a2 + lda );
+      const T* a4( a3 + lda );
+
+      Type xmm1( Ops::zero() ), xmm2( Ops::zero() ), xmm3( Ops::zero() ), xmm4( Ops::zero() );
+
+      for( size_t j=0UL; j<jpos; j+=SIMDSIZE ) {
+         const Type x1( Ops::loadu( x+j ) );
+         xmm1 = Ops::fmadd( Ops::loadu( a1+j ), x1, xmm1 );
+         xmm2 = Ops::fmadd( Ops::loadu( a2+j ), x1, xmm2 );
+         xmm3 = Ops::fmadd( Ops::loadu( a3+j ), x1, xmm3 );
+         xmm4 = Ops::fmadd( Ops::loadu( a4+j ), x1, xmm4 );
+      }
+
+      T value1( Ops::sum( xmm1 ) ), value2( Ops::sum( xmm2 ) );
+      T value3( Ops::sum( xmm3 ) ), value4( Ops::sum( xmm4 ) );
+
+      for( size_t j=jpos; j<n; ++j ) {
+         value1 += a1[j] * x[j];
+         value2 += a2[j] * x[j];
+         value3 += a3[j] * x[j];
+         value4 += a4[j] * x[j];
+      }
+
+      update( y[i    ], value1 );
+      update( y[i+1UL], value2 );
+      update( y[i+2UL], value3 );
+      update( y[i+3UL], value4 );
+   }
+
+   for( ; i<m; ++i )
+   {
+      const T* a1( A + i*lda );
+
+      Type xmm1( Ops::zero() );
+
+      for( size_t j=0UL; j<jpos; j+=SIMDSIZE ) {
+         xmm1 = Ops::fmadd( Ops::loadu( a1+j ), Ops::loadu( x+j ), xmm1 );
+      }
+
+      T value1( Ops::sum( xmm1 ) );
+
+      for( size_t j=jpos; j<n; ++j ) {
+         value1 += a1[j] * x[j];
+      }
+
+      update( y[i], value1 );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Kernel for the multiplication of a column-major dense matrix and a dense vector
+//        (\f$ \vec{y}=\alpha*A*\vec{x}+\beta*\vec{y} \f$).
+// \ingroup dispatch
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param A Pointer to the first element of the matrix.
+// \param lda The spacing between two columns of the matrix.
+// \param x Pointer to the first element of the right-hand side vector.
+// \param y Pointer to the first element of the target vector.
+// \param alpha The scaling factor for \f$ A*\vec{x} \f$.
+// \param beta The scaling factor for \f$ \vec{y} \f$.
+// \return void
+//
+// The kernel adds four scaled columns at a time to the target vector.
+*/
+template< typename T >  // Element type
+void tgemvKernel( size_t m, size_t n, const T* A, size_t lda, const T* x, T* y, T alpha, T beta )
+{
+   using Ops  = VecOps<T>;
+   using Type = typename Ops::Type;
+
+   constexpr size_t SIMDSIZE( Ops::size );
+
+   const size_t ipos( m - m % SIMDSIZE );
+
+   if( beta == T(0) ) {
+      for( size_t i=0UL; i<m; ++i )
+         y[i] = T(0);
+   }
+   else if( beta != T(1) ) {
+      for( size_t i=0UL; i<m; ++i )
+         y[i] *= beta;
+   }
+
+   size_t j( 0UL );
+
+   for( ; (j+4UL) <= n; j+=4UL )
+   {
+      const T* a1( A + j*lda );
+      const T* a2( a1 + lda );
+      const T* a3( a2 + lda );
+      const T* a4( a3 + lda );
+
+      const T x1( alpha*x[j    ] );
+      const T x2( alpha*x[j+1UL] );
+      const T x3( alpha*x[j+2UL] );
+      const T x4( alpha*x[j+3UL] );
+
+      const Type factor1( Ops::set( x1 ) );
+      const Type factor2( Ops::set( x2 ) );
+      const Type factor3( Ops::set( x3 ) );
+      const Type factor4( Ops::set( x4 ) );
+
+      for( size_t i=0UL; i<ipos; i+=SIMDSIZE ) {
+         Type y1( Ops::loadu( y+i ) );
+         y1 = Ops::fmadd( Ops::loadu( a1+i ), factor1, y1 );
+         y1 = Ops::fmadd( Ops::loadu( a2+i ), factor2, y1 );
+         y1 = Ops::fmadd( Ops::loadu( a3+i ), factor3, y1 );
+         y1 = Ops::fmadd( Ops::loadu( a4+i ), factor4, y1 );
+         Ops::storeu( y+i, y1 );
+      }
+
+      for( size_t i=ipos; i<m; ++i ) {
+         y[i] += a1[i]*x1 + a2[i]*x2 + a3[i]*x3 + a4[i]*x4;
+      }
+   }
+
+   for( ; j<n; ++j )
+   {
+      const T* a1( A + j*lda );
+
+      const T x1( alpha*x[j] );
+      const Type factor1( Ops::set( x1 ) );
+
+      for( size_t i=0UL; i<ipos; i+=SIMDSIZE ) {
+         Ops::storeu( y+i, Ops::fmadd( Ops::loadu( a1+i ), factor1, Ops::loadu( y+i ) ) );
+      }
+
+      for( size_t i=ipos; i<m; ++i ) {
+         y[i] += a1[i]*x1;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  REDUCTION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Kernel for the summation of an array.
+// \ingroup dispatch
+//
+// \param n The number of elements of the array.
+// \param x Pointer to the first element of the array.
+// \return The sum of all elements.
+*/
+template< typename T >  // Element type
+T sumKernel( size_t n, const T* x )
+{
+   using Ops  = VecOps<T>;
+   using Type = typename Ops::Type;
+
+   constexpr size_t SIMDSIZE( Ops::size );
+
+   Type xmm1( Ops::zero() ), xmm2( Ops::zero() ), xmm3( Ops::zero() ), xmm4( Ops::zero() );
+   size_t i( 0UL );
+
+   for( ; (i+SIMDSIZE*4UL) <= n; i+=SIMDSIZE*4UL ) {
+      xmm1 = Ops::add( xmm1, Ops::loadu( x+i             ) );
+      xmm2 = Ops::add( xmm2, Ops::loadu( x+i+SIMDSIZE    ) );
+      xmm3 = Ops::add( xmm3, Ops::loadu( x+i+SIMDSIZE*2UL ) );
+      xmm4 = Ops::add( xmm4, Ops::loadu( x+i+SIMDSIZE*3UL ) );
+   }
+   for( ; (i+SIMDSIZE) <= n; i+=SIMDSIZE ) {
+      xmm1 = Ops::add( xmm1, Ops::loadu( x+i ) );
+   }
+
+   T value( Ops::sum( Ops::add( Ops::add( xmm1, xmm2 ), Ops::add( xmm3, xmm4 ) ) ) );
+
+   for( ; i<n; ++i ) {
+      value += x[i];
+   }
+
+   return value;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Kernel for the inner product of two arrays.
+// \ingroup dispatch
+//
+// \param n The number of elements of the arrays.
+// \param x Pointer to the first element of the left-hand side array.
+// \param y Pointer to the first element of the right-hand side array.
+// \return The inner product of the two arrays.
+*/
+template< typename T >  // Element type
+T dotKernel( size_t n, const T* x, const T* y )
+{
+   using Ops  = VecOps<T>;
+   using Type = typename Ops::Type;
+
+   constexpr size_t SIMDSIZE( Ops::size );
+
+   Type xmm1( Ops::zero() ), xmm2( Ops::zero() ), xmm3( Ops::zero() ), xmm4( Ops::zero() );
+   size_t i( 0UL );
+
+   for( ; (i+SIMDSIZE*4UL) <= n; i+=SIMDSIZE*4UL ) {
+      xmm1 = Ops::fmadd( Ops::loadu( x+i             ), Ops::loadu( y+i             ), xmm1 );
+      xmm2 = Ops::fmadd( Ops::loadu( x+i+SIMDSIZE    ), Ops::loadu( y+i+SIMDSIZE    ), xmm2 );
+      xmm3 = Ops::fmadd( Ops::loadu( x+i+SIMDSIZE*2UL ), Ops::loadu( y+i+SIMDSIZE*2UL ), xmm3 );
+      xmm4 = Ops::fmadd( Ops::loadu( x+i+SIMDSIZE*3UL ), Ops::loadu( y+i+SIMDSIZE*3UL ), xmm4 );
+   }
+   for( ; (i+SIMDSIZE) <= n; i+=SIMDSIZE ) {
+      xmm1 = Ops::fmadd( Ops::loadu( x+i ), Ops::loadu( y+i ), xmm1 );
+   }
+
+   T value( Ops::sum( Ops::add( Ops::add( xmm1, xmm2 ), Ops::add( xmm3, xmm4 ) ) ) );
+
+   for( ; i<n; ++i ) {
+      value += x[i] * y[i];
+   }
+
+   return value;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Kernel for the assignment of an array (\f$ \vec{y}=\vec{x} \f$).
+// \ingroup dispatch
+//
+// \param n The number of elements of the arrays.
+// \param x Pointer to the first element of the source array.
+// \param y Pointer to the first element of the target array.
+// \param stream \a true in case the target should be written via non-temporal stores.
+// \return void
+*/
+template< typename T >  // Element type
+void copyKernel( size_t n, const T* x, T* y, bool stream )
+{
+   using Ops = VecOps<T>;
+
+   constexpr size_t SIMDSIZE( Ops::size );
+
+   size_t i( 0UL );
+
+   if( stream )
+   {
+      for( ; i<n && reinterpret_cast<std::uintptr_t>( y+i ) % Ops::alignment != 0UL; ++i ) {
+         y[i] = x[i];
+      }
+      for( ; (i+SIMDSIZE) <= n; i+=SIMDSIZE ) {
+         Ops::stream( y+i, Ops::loadu( x+i ) );
+      }
+   }
+   else
+   {
+      for( ; (i+SIMDSIZE*4UL) <= n; i+=SIMDSIZE*4UL ) {
+         Ops::storeu( y+i             , Ops::loadu( x+i             ) );
+         Ops::storeu( y+i+SIMDSIZE    , Ops::loadu( x+i+SIMDSIZE    ) );
+         Ops::storeu( y+i+SIMDSIZE*2UL, Ops::loadu( x+i+SIMDSIZE*2UL ) );
+         Ops::storeu( y+i+SIMDSIZE*3UL, Ops::loadu( x+i+SIMDSIZE*3UL ) );
+      }
+      for( ; (i+SIMDSIZE) <= n; i+=SIMDSIZE ) {
+         Ops::storeu( y+i, Ops::loadu( x+i ) );
+      }
+   }
+
+   for( ; i<n; ++i ) {
+      y[i] = x[i];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Kernel for the addition assignment of an array (\f$ \vec{y}+=\vec{x} \f$).
+// \ingroup dispatch
+//
+// \param n The number of elements of the arrays.
+// \param x Pointer to the first element of the source array.
+// \param y Pointer to the first element of the target array.
+// \return void
+*/
+template< typename T >  // Element type
+void addKernel( size_t n, const T* x, T* y )
+{
+   using Ops = VecOps<T>;
+
+   constexpr size_t SIMDSIZE( Ops::size );
+
+   size_t i( 0UL );
+
+   for( ; (i+SIMDSIZE*2UL) <= n; i+=SIMDSIZE*2UL ) {
+      Ops::storeu( y+i         , Ops::add( Ops::loadu( y+i          ), Ops::loadu( x+i          ) ) );
+      Ops::storeu( y+i+SIMDSIZE, Ops::add( Ops::loadu( y+i+SIMDSIZE ), Ops::loadu( x+i+SIMDSIZE ) ) );
+   }
+   for( ; (i+SIMDSIZE) <= n; i+=SIMDSIZE ) {
+      Ops::storeu( y+i, Ops::add( Ops::loadu( y+i ), Ops::loadu( x+i ) ) );
+   }
+   for( ; i<n; ++i ) {
+      y[i] += x[i];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Kernel for the subtraction assignment of an array (\f$ \vec{y}-=\vec{x} \f$).
+// \ingroup dispatch
+//
+// \param n The number of elements of the arrays.
+// \param x Pointer to the first element of the source array.
+// \param y Pointer to the first element of the target array.
+// \return void
+*/
+template< typename T >  // Element type
+void subKernel( size_t n, const T* x, T* y )
+{
+   using Ops = VecOps<T>;
+
+   constexpr size_t SIMDSIZE( Ops::size );
+
+   size_t i( 0UL );
+
+   for( ; (i+SIMDSIZE*2UL) <= n; i+=SIMDSIZE*2UL ) {
+      Ops::storeu( y+i         , Ops::sub( Ops::loadu( y+i          ), Ops::loadu( x+i          ) ) );
+      Ops::storeu( y+i+SIMDSIZE, Ops::sub( Ops::loadu( y+i+SIMDSIZE ), Ops::loadu( x+i+SIMDSIZE ) ) );
+   }
+   for( ; (i+SIMDSIZE) <= n; i+=SIMDSIZE ) {
+      Ops::storeu( y+i, Ops::sub( Ops::loadu( y+i ), Ops::loadu( x+i ) ) );
+   }
+   for( ; i<n; ++i ) {
+      y[i] -= x[i];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  KERNEL TABLE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the table of the kernels of this instruction set.
+// \ingroup dispatch
+//
+// \return Reference to the kernel table for the element type \a T.
+*/
+template< typename T >  // Element type
+const KernelTable<T>& getKernelTable() noexcept
+{
+   static const KernelTable<T> table{ VecOps<T>::MR, 2UL*VecOps<T>::size,
+                                      &gemmKernel<T>, &gemvKernel<T>, &tgemvKernel<T>,
+                                      &sumKernel<T>, &dotKernel<T>,
+                                      &copyKernel<T>, &addKernel<T>, &subKernel<T> };
+   return table;
+}
+/*! \endcond */
+//*************************************************************************************************
@@ -56,6 +56,7 @@
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/Forward.h>
+#include <blaze/math/expressions/MatMatMultChain.h>
 #include <blaze/math/expressions/MatMatMultExpr.h>
 #include <blaze/math/expressions/MatScalarMultExpr.h>
 #include <blaze/math/expressions/SparseVector.h>
@@ -115,6 +116,7 @@
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
 #include <blaze/util/IntegralConstant.h>
+#include <blaze/util/KernelProfile.h>
 #include <blaze/util/mpl/If.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/IsBuiltin.h>
@@ -529,6 +531,11 @@ class DMatDMatMultExpr
          return;
       }
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( rhs.lhs_, rhs.rhs_,
+             [&lhs]( const auto& expr ){ assign( ~lhs, expr ); } ) ) {
+         return;
+      }
+
       LT A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side dense matrix operand
       RT B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -562,10 +569,22 @@ class DMatDMatMultExpr
    {
       if( ( IsDiagonal_v<MT5> ) ||
           ( !BLAZE_DEBUG_MODE && B.columns() <= SIMDSIZE*10UL ) ||
-          ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_PROFILE( "dmatdmatmult.assign.small", 1UL, A.rows(), B.columns(), A.columns(),
+                               2.0*A.rows()*B.columns()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + B.rows()*B.columns() +
+                                                     C.rows()*C.columns() ) );
          selectSmallAssignKernel( C, A, B );
-      else
+      }
+      else {
+         BLAZE_KERNEL_PROFILE( ( UseBlasKernel_v<MT3,MT4,MT5> ? "dmatdmatmult.assign.blas"
+                                                              : "dmatdmatmult.assign.large" ),
+                               1UL, A.rows(), B.columns(), A.columns(),
+                               2.0*A.rows()*B.columns()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + B.rows()*B.columns() +
+                                                     C.rows()*C.columns() ) );
          selectBlasAssignKernel( C, A, B );
+      }
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -2144,6 +2163,11 @@ class DMatDMatMultExpr
          return;
       }
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( rhs.lhs_, rhs.rhs_,
+             [&lhs]( const auto& expr ){ addAssign( ~lhs, expr ); } ) ) {
+         return;
+      }
+
       LT A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side dense matrix operand
       RT B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -2177,10 +2201,22 @@ class DMatDMatMultExpr
    {
       if( ( IsDiagonal_v<MT5> ) ||
           ( !BLAZE_DEBUG_MODE && B.columns() <= SIMDSIZE*10UL ) ||
-          ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_PROFILE( "dmatdmatmult.addassign.small", 1UL, A.rows(), B.columns(), A.columns(),
+                               2.0*A.rows()*B.columns()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + B.rows()*B.columns() +
+                                                     2UL*C.rows()*C.columns() ) );
          selectSmallAddAssignKernel( C, A, B );
-      else
+      }
+      else {
+         BLAZE_KERNEL_PROFILE( ( UseBlasKernel_v<MT3,MT4,MT5> ? "dmatdmatmult.addassign.blas"
+                                                              : "dmatdmatmult.addassign.large" ),
+                               1UL, A.rows(), B.columns(), A.columns(),
+                               2.0*A.rows()*B.columns()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + B.rows()*B.columns() +
+                                                     2UL*C.rows()*C.columns() ) );
          selectBlasAddAssignKernel( C, A, B );
+      }
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -3285,6 +3321,11 @@ class DMatDMatMultExpr
          return;
       }
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( rhs.lhs_, rhs.rhs_,
+             [&lhs]( const auto& expr ){ subAssign( ~lhs, expr ); } ) ) {
+         return;
+      }
+
       LT A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side dense matrix operand
       RT B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -3318,10 +3359,22 @@ class DMatDMatMultExpr
    {
       if( ( IsDiagonal_v<MT5> ) ||
           ( !BLAZE_DEBUG_MODE && B.columns() <= SIMDSIZE*10UL ) ||
-          ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_PROFILE( "dmatdmatmult.subassign.small", 1UL, A.rows(), B.columns(), A.columns(),
+                               2.0*A.rows()*B.columns()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + B.rows()*B.columns() +
+                                                     2UL*C.rows()*C.columns() ) );
          selectSmallSubAssignKernel( C, A, B );
-      else
+      }
+      else {
+         BLAZE_KERNEL_PROFILE( ( UseBlasKernel_v<MT3,MT4,MT5> ? "dmatdmatmult.subassign.blas"
+                                                              : "dmatdmatmult.subassign.large" ),
+                               1UL, A.rows(), B.columns(), A.columns(),
+                               2.0*A.rows()*B.columns()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + B.rows()*B.columns() +
+                                                     2UL*C.rows()*C.columns() ) );
          selectBlasSubAssignKernel( C, A, B );
+      }
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -4476,6 +4529,11 @@ class DMatDMatMultExpr
          return;
       }
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( rhs.lhs_, rhs.rhs_,
+             [&lhs]( const auto& expr ){ smpAssign( ~lhs, expr ); } ) ) {
+         return;
+      }
+
       LT A( rhs.lhs_ );  // Evaluation of the left-hand side dense matrix operand
       RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense matrix operand
 
@@ -4601,6 +4659,11 @@ class DMatDMatMultExpr
          return;
       }
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( rhs.lhs_, rhs.rhs_,
+             [&lhs]( const auto& expr ){ smpAddAssign( ~lhs, expr ); } ) ) {
+         return;
+      }
+
       LT A( rhs.lhs_ );  // Evaluation of the left-hand side dense matrix operand
       RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense matrix operand
 
@@ -4688,6 +4751,11 @@ class DMatDMatMultExpr
          return;
       }
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( rhs.lhs_, rhs.rhs_,
+             [&lhs]( const auto& expr ){ smpSubAssign( ~lhs, expr ); } ) ) {
+         return;
+      }
+
       LT A( rhs.lhs_ );  // Evaluation of the left-hand side dense matrix operand
       RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense matrix operand
 
@@ -5168,6 +5236,11 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
          return;
       }
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( left, right,
+             [&lhs,&rhs]( const auto& expr ){ assign( ~lhs, expr * rhs.scalar_ ); } ) ) {
+         return;
+      }
+
       LT A( serial( left  ) );  // Evaluation of the left-hand side dense matrix operand
       RT B( serial( right ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -5201,10 +5274,22 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
    {
       if( ( IsDiagonal_v<MT5> ) ||
           ( !BLAZE_DEBUG_MODE && B.columns() <= SIMDSIZE*10UL ) ||
-          ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_PROFILE( "dmatdmatmult.assign.small", 1UL, A.rows(), B.columns(), A.columns(),
+                               2.0*A.rows()*B.columns()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + B.rows()*B.columns() +
+                                                     C.rows()*C.columns() ) );
          selectSmallAssignKernel( C, A, B, scalar );
-      else
+      }
+      else {
+         BLAZE_KERNEL_PROFILE( ( UseBlasKernel_v<MT3,MT4,MT5,ST2> ? "dmatdmatmult.assign.blas"
+                                                                  : "dmatdmatmult.assign.large" ),
+                               1UL, A.rows(), B.columns(), A.columns(),
+                               2.0*A.rows()*B.columns()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + B.rows()*B.columns() +
+                                                     C.rows()*C.columns() ) );
          selectBlasAssignKernel( C, A, B, scalar );
+      }
    }
    //**********************************************************************************************
 
@@ -6807,6 +6892,11 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
          return;
       }
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( left, right,
+             [&lhs,&rhs]( const auto& expr ){ addAssign( ~lhs, expr * rhs.scalar_ ); } ) ) {
+         return;
+      }
+
       LT A( serial( left  ) );  // Evaluation of the left-hand side dense matrix operand
       RT B( serial( right ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -6840,10 +6930,22 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
    {
       if( ( IsDiagonal_v<MT5> ) ||
           ( !BLAZE_DEBUG_MODE && B.columns() <= SIMDSIZE*10UL ) ||
-          ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_PROFILE( "dmatdmatmult.addassign.small", 1UL, A.rows(), B.columns(), A.columns(),
+                               2.0*A.rows()*B.columns()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + B.rows()*B.columns() +
+                                                     2UL*C.rows()*C.columns() ) );
          selectSmallAddAssignKernel( C, A, B, scalar );
-      else
+      }
+      else {
+         BLAZE_KERNEL_PROFILE( ( UseBlasKernel_v<MT3,MT4,MT5,ST2> ? "dmatdmatmult.addassign.blas"
+                                                                  : "dmatdmatmult.addassign.large" ),
+                               1UL, A.rows(), B.columns(), A.columns(),
+                               2.0*A.rows()*B.columns()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + B.rows()*B.columns() +
+                                                     2UL*C.rows()*C.columns() ) );
          selectBlasAddAssignKernel( C, A, B, scalar );
+      }
    }
    //**********************************************************************************************
 
@@ -8035,6 +8137,11 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
          return;
       }
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( left, right,
+             [&lhs,&rhs]( const auto& expr ){ subAssign( ~lhs, expr * rhs.scalar_ ); } ) ) {
+         return;
+      }
+
       LT A( serial( left  ) );  // Evaluation of the left-hand side dense matrix operand
       RT B( serial( right ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -8068,10 +8175,22 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
    {
       if( ( IsDiagonal_v<MT5> ) ||
           ( !BLAZE_DEBUG_MODE && B.columns() <= SIMDSIZE*10UL ) ||
-          ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_PROFILE( "dmatdmatmult.subassign.small", 1UL, A.rows(), B.columns(), A.columns(),
+                               2.0*A.rows()*B.columns()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + B.rows()*B.columns() +
+                                                     2UL*C.rows()*C.columns() ) );
          selectSmallSubAssignKernel( C, A, B, scalar );
-      else
+      }
+      else {
+         BLAZE_KERNEL_PROFILE( ( UseBlasKernel_v<MT3,MT4,MT5,ST2> ? "dmatdmatmult.subassign.blas"
+                                                                  : "dmatdmatmult.subassign.large" ),
+                               1UL, A.rows(), B.columns(), A.columns(),
+                               2.0*A.rows()*B.columns()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + B.rows()*B.columns() +
+                                                     2UL*C.rows()*C.columns() ) );
          selectBlasSubAssignKernel( C, A, B, scalar );
+      }
    }
    //**********************************************************************************************
 
@@ -9312,6 +9431,11 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
          return;
       }
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( left, right,
+             [&lhs,&rhs]( const auto& expr ){ smpAssign( ~lhs, expr * rhs.scalar_ ); } ) ) {
+         return;
+      }
+
       LT A( left  );  // Evaluation of the left-hand side dense matrix operand
       RT B( right );  // Evaluation of the right-hand side dense matrix operand
 
@@ -9438,6 +9562,11 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
          return;
       }
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( left, right,
+             [&lhs,&rhs]( const auto& expr ){ smpAddAssign( ~lhs, expr * rhs.scalar_ ); } ) ) {
+         return;
+      }
+
       LT A( left  );  // Evaluation of the left-hand side dense matrix operand
       RT B( right );  // Evaluation of the right-hand side dense matrix operand
 
@@ -9527,6 +9656,11 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
          return;
       }
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( left, right,
+             [&lhs,&rhs]( const auto& expr ){ smpSubAssign( ~lhs, expr * rhs.scalar_ ); } ) ) {
+         return;
+      }
+
       LT A( left  );  // Evaluation of the left-hand side dense matrix operand
       RT B( right );  // Evaluation of the right-hand side dense matrix operand
 
@@ -49,6 +49,7 @@
 #include <blaze/math/constraints/MatMatMultExpr.h>
 #include <blaze/math/constraints/MatVecMultExpr.h>
 #include <blaze/math/constraints/RequiresEvaluation.h>
+#include <blaze/math/dispatch/Functions.h>
 #include <blaze/math/constraints/RowMajorMatrix.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/Computation.h>
@@ -71,6 +72,7 @@
 #include <blaze/math/typetraits/IsComputation.h>
 #include <blaze/math/typetraits/IsContiguous.h>
 #include <blaze/math/typetraits/IsDiagonal.h>
+#include <blaze/math/typetraits/IsDispatchCompatible.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsLower.h>
 #include <blaze/math/typetraits/IsPadded.h>
@@ -92,6 +94,7 @@
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
 #include <blaze/util/IntegralConstant.h>
+#include <blaze/util/KernelProfile.h>
 #include <blaze/util/mpl/If.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/IsBuiltin.h>
@@ -178,6 +181,25 @@ class DMatDVecMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! In case the matrix type and the two involved vector types are suited for a runtime
+       dispatched kernel, the variable will be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   static constexpr bool UseDispatchKernel_v =
+      ( BLAZE_RUNTIME_DISPATCH_MODE && !UseBlasKernel_v<T1,T2,T3> &&
+        IsContiguous_v<T1> && HasMutableDataAccess_v<T1> &&
+        IsContiguous_v<T2> && HasConstDataAccess_v<T2> &&
+        IsContiguous_v<T3> && HasConstDataAccess_v<T3> &&
+        !IsDiagonal_v<T2> && !IsLower_v<T2> && !IsUpper_v<T2> &&
+        T1::simdEnabled && T2::simdEnabled && T3::simdEnabled &&
+        IsDispatchCompatible_v< ElementType_t<T1> > &&
+        IsSame_v< ElementType_t<T1>, ElementType_t<T2> > &&
+        IsSame_v< ElementType_t<T1>, ElementType_t<T3> > );
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**********************************************************************************************
    /*! \cond BLAZE_INTERNAL */
    //! Helper variable template for the explicit application of the SFINAE principle.
@@ -446,10 +468,22 @@ class DMatDVecMultExpr
    {
       if( ( IsDiagonal_v<MT1> ) ||
           ( IsComputation_v<MT> && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < DMATDVECMULT_THRESHOLD ) )
+          ( A.rows() * A.columns() < DMATDVECMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_PROFILE( "dmatdvecmult.assign.small", 1UL, A.rows(), A.columns(), 1UL,
+                               2.0*A.rows()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + x.size() +
+                                                     y.size() ) );
          selectSmallAssignKernel( y, A, x );
-      else
+      }
+      else {
+         BLAZE_KERNEL_PROFILE( ( UseBlasKernel_v<VT1,MT1,VT2> ? "dmatdvecmult.assign.blas"
+                                                              : "dmatdvecmult.assign.large" ),
+                               1UL, A.rows(), A.columns(), 1UL,
+                               2.0*A.rows()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + x.size() +
+                                                     y.size() ) );
          selectBlasAssignKernel( y, A, x );
+      }
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1128,7 +1162,7 @@ class DMatDVecMultExpr
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2 >  // Type of the right-hand side vector operand
    static inline auto selectBlasAssignKernel( VT1& y, const MT1& A, const VT2& x )
-      -> DisableIf_t< UseBlasKernel_v<VT1,MT1,VT2> >
+      -> DisableIf_t< UseBlasKernel_v<VT1,MT1,VT2> || UseDispatchKernel_v<VT1,MT1,VT2> >
    {
       selectLargeAssignKernel( y, A, x );
    }
@@ -1170,6 +1204,35 @@ class DMatDVecMultExpr
 #endif
    //**********************************************************************************************
 
+   //**Dispatch-based assignment to dense vectors***************************************************
+#if BLAZE_RUNTIME_DISPATCH_MODE
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Runtime dispatched assignment of a dense matrix-dense vector multiplication
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function performs the dense matrix-dense vector multiplication by means of the kernel of
+   // the instruction set selected at runtime (see BLAZE_USE_RUNTIME_DISPATCH).
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline auto selectBlasAssignKernel( VT1& y, const MT1& A, const VT2& x )
+      -> EnableIf_t< UseDispatchKernel_v<VT1,MT1,VT2> >
+   {
+      using ET = ElementType_t<VT1>;
+
+      dispatchGemv( y, A, x, ET(1), ET(0) );
+   }
+   /*! \endcond */
+#endif
+   //**********************************************************************************************
+
    //**Assignment to sparse vectors****************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a dense matrix-dense vector multiplication to a sparse vector
@@ -1256,10 +1319,22 @@ class DMatDVecMultExpr
    {
       if( ( IsDiagonal_v<MT1> ) ||
           ( IsComputation_v<MT> && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < DMATDVECMULT_THRESHOLD ) )
+          ( A.rows() * A.columns() < DMATDVECMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_PROFILE( "dmatdvecmult.addassign.small", 1UL, A.rows(), A.columns(), 1UL,
+                               2.0*A.rows()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + x.size() +
+                                                     2UL*y.size() ) );
          selectSmallAddAssignKernel( y, A, x );
-      else
+      }
+      else {
+         BLAZE_KERNEL_PROFILE( ( UseBlasKernel_v<VT1,MT1,VT2> ? "dmatdvecmult.addassign.blas"
+                                                              : "dmatdvecmult.addassign.large" ),
+                               1UL, A.rows(), A.columns(), 1UL,
+                               2.0*A.rows()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + x.size() +
+                                                     2UL*y.size() ) );
          selectBlasAddAssignKernel( y, A, x );
+      }
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1936,7 +2011,7 @@ class DMatDVecMultExpr
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2 >  // Type of the right-hand side vector operand
    static inline auto selectBlasAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
-      -> DisableIf_t< UseBlasKernel_v<VT1,MT1,VT2> >
+      -> DisableIf_t< UseBlasKernel_v<VT1,MT1,VT2> || UseDispatchKernel_v<VT1,MT1,VT2> >
    {
       selectLargeAddAssignKernel( y, A, x );
    }
@@ -1979,6 +2054,35 @@ class DMatDVecMultExpr
 #endif
    //**********************************************************************************************
 
+   //**Dispatch-based addition assignment to dense vectors******************************************
+#if BLAZE_RUNTIME_DISPATCH_MODE
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Runtime dispatched addition assignment of a matrix-vector multiplication
+   //        (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function performs the dense matrix-dense vector multiplication by means of the kernel of
+   // the instruction set selected at runtime (see BLAZE_USE_RUNTIME_DISPATCH).
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline auto selectBlasAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+      -> EnableIf_t< UseDispatchKernel_v<VT1,MT1,VT2> >
+   {
+      using ET = ElementType_t<VT1>;
+
+      dispatchGemv( y, A, x, ET(1), ET(1) );
+   }
+   /*! \endcond */
+#endif
+   //**********************************************************************************************
+
    //**Addition assignment to sparse vectors*******************************************************
    // No special implementation for the addition assignment to sparse vectors.
    //**********************************************************************************************
@@ -2039,10 +2143,22 @@ class DMatDVecMultExpr
    {
       if( ( IsDiagonal_v<MT1> ) ||
           ( IsComputation_v<MT> && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < DMATDVECMULT_THRESHOLD ) )
+          ( A.rows() * A.columns() < DMATDVECMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_PROFILE( "dmatdvecmult.subassign.small", 1UL, A.rows(), A.columns(), 1UL,
+                               2.0*A.rows()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + x.size() +
+                                                     2UL*y.size() ) );
          selectSmallSubAssignKernel( y, A, x );
-      else
+      }
+      else {
+         BLAZE_KERNEL_PROFILE( ( UseBlasKernel_v<VT1,MT1,VT2> ? "dmatdvecmult.subassign.blas"
+                                                              : "dmatdvecmult.subassign.large" ),
+                               1UL, A.rows(), A.columns(), 1UL,
+                               2.0*A.rows()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + x.size() +
+                                                     2UL*y.size() ) );
          selectBlasSubAssignKernel( y, A, x );
+      }
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -2720,7 +2836,7 @@ class DMatDVecMultExpr
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2 >  // Type of the right-hand side vector operand
    static inline auto selectBlasSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
-      -> DisableIf_t< UseBlasKernel_v<VT1,MT1,VT2> >
+      -> DisableIf_t< UseBlasKernel_v<VT1,MT1,VT2> || UseDispatchKernel_v<VT1,MT1,VT2> >
    {
       selectLargeSubAssignKernel( y, A, x );
    }
@@ -2763,6 +2879,35 @@ class DMatDVecMultExpr
 #endif
    //**********************************************************************************************
 
+   //**Dispatch-based subtraction assignment to dense vectors***************************************
+#if BLAZE_RUNTIME_DISPATCH_MODE
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Runtime dispatched subtraction assignment of a matrix-vector multiplication
+   //        (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function performs the dense matrix-dense vector multiplication by means of the kernel of
+   // the instruction set selected at runtime (see BLAZE_USE_RUNTIME_DISPATCH).
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline auto selectBlasSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+      -> EnableIf_t< UseDispatchKernel_v<VT1,MT1,VT2> >
+   {
+      using ET = ElementType_t<VT1>;
+
+      dispatchGemv( y, A, x, ET(-1), ET(1) );
+   }
+   /*! \endcond */
+#endif
+   //**********************************************************************************************
+
    //**Subtraction assignment to sparse vectors****************************************************
    // No special implementation for the subtraction assignment to sparse vectors.
    //**********************************************************************************************
@@ -3166,6 +3311,26 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
         !( IsBuiltin_v< ElementType_t<T1> > && IsComplex_v<T4> ) );
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! In case the matrix type, the two involved vector types, and the scalar type are suited
+       for a runtime dispatched kernel, the variable will be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3, typename T4 >
+   static constexpr bool UseDispatchKernel_v =
+      ( BLAZE_RUNTIME_DISPATCH_MODE && !UseBlasKernel_v<T1,T2,T3,T4> &&
+        IsContiguous_v<T1> && HasMutableDataAccess_v<T1> &&
+        IsContiguous_v<T2> && HasConstDataAccess_v<T2> &&
+        IsContiguous_v<T3> && HasConstDataAccess_v<T3> &&
+        !IsDiagonal_v<T2> && !IsLower_v<T2> && !IsUpper_v<T2> &&
+        T1::simdEnabled && T2::simdEnabled && T3::simdEnabled &&
+        IsDispatchCompatible_v< ElementType_t<T1> > &&
+        IsSame_v< ElementType_t<T1>, ElementType_t<T2> > &&
+        IsSame_v< ElementType_t<T1>, ElementType_t<T3> > &&
+        !( IsBuiltin_v< ElementType_t<T1> > && IsComplex_v<T4> ) );
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**********************************************************************************************
    //! Helper variable template for the explicit application of the SFINAE principle.
    /*! In case the two involved vector types, the matrix type, and the scalar type are suited
@@ -3414,10 +3579,22 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
    {
       if( ( IsDiagonal_v<MT1> ) ||
           ( IsComputation_v<MT> && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < DMATDVECMULT_THRESHOLD ) )
+          ( A.rows() * A.columns() < DMATDVECMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_PROFILE( "dmatdvecmult.assign.small", 1UL, A.rows(), A.columns(), 1UL,
+                               2.0*A.rows()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + x.size() +
+                                                     y.size() ) );
          selectSmallAssignKernel( y, A, x, scalar );
-      else
+      }
+      else {
+         BLAZE_KERNEL_PROFILE( ( UseBlasKernel_v<VT1,MT1,VT2,ST2> ? "dmatdvecmult.assign.blas"
+                                                                  : "dmatdvecmult.assign.large" ),
+                               1UL, A.rows(), A.columns(), 1UL,
+                               2.0*A.rows()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + x.size() +
+                                                     y.size() ) );
          selectBlasAssignKernel( y, A, x, scalar );
+      }
    }
    //**********************************************************************************************
 
@@ -4116,7 +4293,7 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
            , typename VT2    // Type of the right-hand side vector operand
            , typename ST2 >  // Type of the scalar value
    static inline auto selectBlasAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
-      -> DisableIf_t< UseBlasKernel_v<VT1,MT1,VT2,ST2> >
+      -> DisableIf_t< UseBlasKernel_v<VT1,MT1,VT2,ST2> || UseDispatchKernel_v<VT1,MT1,VT2,ST2> >
    {
       selectLargeAssignKernel( y, A, x, scalar );
    }
@@ -4157,6 +4334,35 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 #endif
    //**********************************************************************************************
 
+   //**Dispatch-based assignment to dense vectors***************************************************
+#if BLAZE_RUNTIME_DISPATCH_MODE
+   /*!\brief Runtime dispatched assignment of a scaled dense matrix-dense vector multiplication
+   //        (\f$ \vec{y}=s*A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function performs the scaled dense matrix-dense vector multiplication by means of the
+   // kernel of the instruction set selected at runtime (see BLAZE_USE_RUNTIME_DISPATCH).
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2    // Type of the right-hand side vector operand
+           , typename ST2 >  // Type of the scalar value
+   static inline auto selectBlasAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
+      -> EnableIf_t< UseDispatchKernel_v<VT1,MT1,VT2,ST2> >
+   {
+      using ET = ElementType_t<VT1>;
+
+      dispatchGemv( y, A, x, ET(scalar), ET(0) );
+   }
+#endif
+   //**********************************************************************************************
+
    //**Assignment to sparse vectors****************************************************************
    /*!\brief Assignment of a scaled dense matrix-dense vector multiplication to a sparse vector
    //        (\f$ \vec{y}=s*A*\vec{x} \f$).
@@ -4243,10 +4449,22 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
    {
       if( ( IsDiagonal_v<MT1> ) ||
           ( IsComputation_v<MT> && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < DMATDVECMULT_THRESHOLD ) )
+          ( A.rows() * A.columns() < DMATDVECMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_PROFILE( "dmatdvecmult.addassign.small", 1UL, A.rows(), A.columns(), 1UL,
+                               2.0*A.rows()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + x.size() +
+                                                     2UL*y.size() ) );
          selectSmallAddAssignKernel( y, A, x, scalar );
-      else
+      }
+      else {
+         BLAZE_KERNEL_PROFILE( ( UseBlasKernel_v<VT1,MT1,VT2,ST2> ? "dmatdvecmult.addassign.blas"
+                                                                  : "dmatdvecmult.addassign.large" ),
+                               1UL, A.rows(), A.columns(), 1UL,
+                               2.0*A.rows()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + x.size() +
+                                                     2UL*y.size() ) );
          selectBlasAddAssignKernel( y, A, x, scalar );
+      }
    }
    //**********************************************************************************************
 
@@ -4923,7 +5141,7 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
            , typename VT2    // Type of the right-hand side vector operand
            , typename ST2 >  // Type of the scalar value
    static inline auto selectBlasAddAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
-      -> DisableIf_t< UseBlasKernel_v<VT1,MT1,VT2,ST2> >
+      -> DisableIf_t< UseBlasKernel_v<VT1,MT1,VT2,ST2> || UseDispatchKernel_v<VT1,MT1,VT2,ST2> >
    {
       selectLargeAddAssignKernel( y, A, x, scalar );
    }
@@ -4965,6 +5183,35 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 #endif
    //**********************************************************************************************
 
+   //**Dispatch-based addition assignment to dense vectors******************************************
+#if BLAZE_RUNTIME_DISPATCH_MODE
+   /*!\brief Runtime dispatched addition assignment of a scaled dense matrix-dense vector multiplication
+   //        (\f$ \vec{y}+=s*A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function performs the scaled dense matrix-dense vector multiplication by means of the
+   // kernel of the instruction set selected at runtime (see BLAZE_USE_RUNTIME_DISPATCH).
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2    // Type of the right-hand side vector operand
+           , typename ST2 >  // Type of the scalar value
+   static inline auto selectBlasAddAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
+      -> EnableIf_t< UseDispatchKernel_v<VT1,MT1,VT2,ST2> >
+   {
+      using ET = ElementType_t<VT1>;
+
+      dispatchGemv( y, A, x, ET(scalar), ET(1) );
+   }
+#endif
+   //**********************************************************************************************
+
    //**Addition assignment to sparse vectors*******************************************************
    // No special implementation for the addition assignment to sparse vectors.
    //**********************************************************************************************
@@ -5027,10 +5274,22 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
    {
       if( ( IsDiagonal_v<MT1> ) ||
           ( IsComputation_v<MT> && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < DMATDVECMULT_THRESHOLD ) )
+          ( A.rows() * A.columns() < DMATDVECMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_PROFILE( "dmatdvecmult.subassign.small", 1UL, A.rows(), A.columns(), 1UL,
+                               2.0*A.rows()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + x.size() +
+                                                     2UL*y.size() ) );
          selectSmallSubAssignKernel( y, A, x, scalar );
-      else
+      }
+      else {
+         BLAZE_KERNEL_PROFILE( ( UseBlasKernel_v<VT1,MT1,VT2,ST2> ? "dmatdvecmult.subassign.blas"
+                                                                  : "dmatdvecmult.subassign.large" ),
+                               1UL, A.rows(), A.columns(), 1UL,
+                               2.0*A.rows()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + x.size() +
+                                                     2UL*y.size() ) );
          selectBlasSubAssignKernel( y, A, x, scalar );
+      }
    }
    //**********************************************************************************************
 
@@ -5707,7 +5966,7 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
            , typename VT2    // Type of the right-hand side vector operand
            , typename ST2 >  // Type of the scalar value
    static inline auto selectBlasSubAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
-      -> DisableIf_t< UseBlasKernel_v<VT1,MT1,VT2,ST2> >
+      -> DisableIf_t< UseBlasKernel_v<VT1,MT1,VT2,ST2> || UseDispatchKernel_v<VT1,MT1,VT2,ST2> >
    {
       selectLargeSubAssignKernel( y, A, x, scalar );
    }
@@ -5749,6 +6008,35 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 #endif
    //**********************************************************************************************
 
+   //**Dispatch-based subtraction assignment to dense vectors***************************************
+#if BLAZE_RUNTIME_DISPATCH_MODE
+   /*!\brief Runtime dispatched subtraction assignment of a scaled dense matrix-dense vector multiplication
+   //        (\f$ \vec{y}-=s*A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function performs the scaled dense matrix-dense vector multiplication by means of the
+   // kernel of the instruction set selected at runtime (see BLAZE_USE_RUNTIME_DISPATCH).
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2    // Type of the right-hand side vector operand
+           , typename ST2 >  // Type of the scalar value
+   static inline auto selectBlasSubAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
+      -> EnableIf_t< UseDispatchKernel_v<VT1,MT1,VT2,ST2> >
+   {
+      using ET = ElementType_t<VT1>;
+
+      dispatchGemv( y, A, x, ET(-scalar), ET(1) );
+   }
+#endif
+   //**********************************************************************************************
+
    //**Subtraction assignment to sparse vectors****************************************************
    // No special implementation for the subtraction assignment to sparse vectors.
    //**********************************************************************************************
@@ -49,13 +49,14 @@
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/lapack/getrf.h>
+#include <blaze/math/RelaxationFlag.h>
+#include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/typetraits/IsSquare.h>
 #include <blaze/math/typetraits/IsStrictlyTriangular.h>
 #include <blaze/math/typetraits/IsTriangular.h>
 #include <blaze/math/typetraits/IsUniTriangular.h>
 #include <blaze/math/typetraits/RemoveAdaptor.h>
 #include <blaze/util/Assert.h>
-#include <blaze/util/NumericCast.h>
 #include <blaze/util/Types.h>
 
 
@@ -336,22 +337,19 @@ ElementType_t<MT> detNxN( const DenseMatrix<MT,SO>& dm )
 
    URT A( ~dm );
 
-   blas_int_t n   ( numeric_cast<blas_int_t>( A.rows()    ) );
-   blas_int_t lda ( numeric_cast<blas_int_t>( A.spacing() ) );
-   blas_int_t info( 0 );
+   const size_t n( A.rows() );
 
    const std::unique_ptr<blas_int_t[]> ipiv( new blas_int_t[n] );
 
-   getrf( n, n, A.data(), lda, ipiv.get(), &info );
-
-   if( info > 0 ) {
-      return ET(0);
-   }
+   getrf( A, ipiv.get() );
 
    ET determinant = ET(1);
 
-   for( int i=0; i<n; ++i ) {
-      determinant *= ( ipiv[i] == (i+1) )?( A(i,i) ):( -A(i,i) );
+   for( size_t i=0UL; i<n; ++i ) {
+      if( isDefault<strict>( A(i,i) ) ) {
+         return ET(0);
+      }
+      determinant *= ( ipiv[i] == blas_int_t(i+1) )?( A(i,i) ):( -A(i,i) );
    }
 
    return determinant;
@@ -377,7 +375,11 @@ ElementType_t<MT> detNxN( const DenseMatrix<MT,SO>& dm )
 // not guarantee that it is possible to compute the determinant with the given matrix!
 //
 // \note This function can only be used if a fitting LAPACK library is available and linked to
-// the executable. Otherwise a linker error will be created.
+// the executable. Otherwise a linker error will be created. In case the LAPACK mode is disabled
+// (see the BLAZE_LAPACK_MODE switch), the determinant is computed by means of the native LU
+// decomposition and no LAPACK library is required. In case the LAPACK mode is disabled
+// (see the BLAZE_LAPACK_MODE switch), the determinant is computed by means of the native LU
+// decomposition and no LAPACK library is required.
 */
 template< typename MT  // Type of the dense matrix
         , bool SO >    // Storage order of the dense matrix
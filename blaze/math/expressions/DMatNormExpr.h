@@ -44,6 +44,7 @@
 #include <blaze/math/Aliases.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/functors/Abs.h>
+#include <blaze/math/functors/Add.h>
 #include <blaze/math/functors/Bind2nd.h>
 #include <blaze/math/functors/Cbrt.h>
 #include <blaze/math/functors/L1Norm.h>
@@ -63,13 +64,18 @@
 #include <blaze/math/shims/IsZero.h>
 #include <blaze/math/shims/PrevMultiple.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/ParallelReduce.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/typetraits/HasLoad.h>
 #include <blaze/math/typetraits/HasSIMDAdd.h>
 #include <blaze/math/typetraits/IsPadded.h>
 #include <blaze/math/typetraits/IsSIMDEnabled.h>
 #include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/system/Blocking.h>
 #include <blaze/system/Optimizations.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/FunctionTrace.h>
 #include <blaze/util/IntegralConstant.h>
@@ -132,54 +138,56 @@ struct DMatNormHelper
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Default backend implementation of the norm of a row-major dense matrix.
+/*!\brief Default backend implementation of the norm of a range of rows of a row-major dense
+//        matrix.
 // \ingroup dense_matrix
 //
 // \param dm The given row-major dense matrix for the norm computation.
+// \param ibegin The index of the first row of the range.
+// \param iend The index one past the last row of the range.
 // \param abs The functor for the abs operation.
 // \param power The functor for the power operation.
-// \param root The functor for the root operation.
-// \return The norm of the given matrix.
+// \return The sum of the powers of the absolute values of the given rows.
 //
-// This function implements the performance optimized norm of a row-major dense matrix. Due to
+// This function implements the performance optimized norm of the non-empty row range
+// \f$ [ibegin..iend) \f$ of a row-major dense matrix (without the final root operation). Due to
 // the explicit application of the SFINAE principle, this function can only be selected by the
 // compiler in case vectorization cannot be applied.
 */
-template< typename MT      // Type of the dense matrix
-        , typename Abs     // Type of the abs opertaion
-        , typename Power   // Type of the power operation
-        , typename Root >  // Type of the root operation
-inline decltype(auto) norm_backend( const DenseMatrix<MT,false>& dm, Abs abs, Power power, Root root, FalseType )
+template< typename MT       // Type of the dense matrix
+        , typename Abs      // Type of the abs opertaion
+        , typename Power >  // Type of the power operation
+inline ElementType_t<MT>
+   dmatnorm( const DenseMatrix<MT,false>& dm, size_t ibegin, size_t iend, Abs abs, Power power, FalseType )
 {
    using CT = CompositeType_t<MT>;
    using ET = ElementType_t<MT>;
-   using RT = decltype( evaluate( root( std::declval<ET>() ) ) );
 
-   if( (~dm).rows() == 0UL || (~dm).columns() == 0UL ) return RT();
+   BLAZE_INTERNAL_ASSERT( ibegin < iend && iend <= (~dm).rows(), "Invalid row range" );
+   BLAZE_INTERNAL_ASSERT( (~dm).columns() > 0UL, "Invalid number of columns" );
 
    CT tmp( ~dm );
 
-   const size_t M( tmp.rows()    );
    const size_t N( tmp.columns() );
 
-   ET norm( power( abs( tmp(0UL,0UL) ) ) );
+   ET norm( power( abs( tmp(ibegin,0UL) ) ) );
 
    {
       size_t j( 1UL );
 
       for( ; (j+4UL) <= N; j+=4UL ) {
-         norm += power( abs( tmp(0UL,j    ) ) ) + power( abs( tmp(0UL,j+1UL) ) ) +
-                 power( abs( tmp(0UL,j+2UL) ) ) + power( abs( tmp(0UL,j+3UL) ) );
+         norm += power( abs( tmp(ibegin,j    ) ) ) + power( abs( tmp(ibegin,j+1UL) ) ) +
+                 power( abs( tmp(ibegin,j+2UL) ) ) + power( abs( tmp(ibegin,j+3UL) ) );
       }
       for( ; (j+2UL) <= N; j+=2UL ) {
-         norm += power( abs( tmp(0UL,j) ) ) + power( abs( tmp(0UL,j+1UL) ) );
+         norm += power( abs( tmp(ibegin,j) ) ) + power( abs( tmp(ibegin,j+1UL) ) );
       }
       for( ; j<N; ++j ) {
-         norm += power( abs( tmp(0UL,j) ) );
+         norm += power( abs( tmp(ibegin,j) ) );
       }
    }
 
-   for( size_t i=1UL; i<M; ++i )
+   for( size_t i=ibegin+1UL; i<iend; ++i )
    {
       size_t j( 0UL );
 
@@ -195,7 +203,7 @@ inline decltype(auto) norm_backend( const DenseMatrix<MT,false>& dm, Abs abs, Po
       }
    }
 
-   return evaluate( root( norm ) );
+   return norm;
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -203,54 +211,56 @@ inline decltype(auto) norm_backend( const DenseMatrix<MT,false>& dm, Abs abs, Po
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Default backend implementation of the norm of a column-major dense matrix.
+/*!\brief Default backend implementation of the norm of a range of columns of a column-major
+//        dense matrix.
 // \ingroup dense_matrix
 //
 // \param dm The given column-major dense matrix for the norm computation.
+// \param jbegin The index of the first column of the range.
+// \param jend The index one past the last column of the range.
 // \param abs The functor for the abs operation.
 // \param power The functor for the power operation.
-// \param root The functor for the root operation.
-// \return The norm of the given matrix.
+// \return The sum of the powers of the absolute values of the given columns.
 //
-// This function implements the performance optimized norm of a column-major dense matrix. Due
-// to the explicit application of the SFINAE principle, this function can only be selected by
-// the compiler in case vectorization cannot be applied.
+// This function implements the performance optimized norm of the non-empty column range
+// \f$ [jbegin..jend) \f$ of a column-major dense matrix (without the final root operation).
+// Due to the explicit application of the SFINAE principle, this function can only be selected
+// by the compiler in case vectorization cannot be applied.
 */
-template< typename MT      // Type of the dense matrix
-        , typename Abs     // Type of the abs operation
-        , typename Power   // Type of the power operation
-        , typename Root >  // Type of the root operation
-inline decltype(auto) norm_backend( const DenseMatrix<MT,true>& dm, Abs abs, Power power, Root root, FalseType )
+template< typename MT       // Type of the dense matrix
+        , typename Abs      // Type of the abs operation
+        , typename Power >  // Type of the power operation
+inline ElementType_t<MT>
+   dmatnorm( const DenseMatrix<MT,true>& dm, size_t jbegin, size_t jend, Abs abs, Power power, FalseType )
 {
    using CT = CompositeType_t<MT>;
    using ET = ElementType_t<MT>;
-   using RT = decltype( evaluate( root( std::declval<ET>() ) ) );
 
-   if( (~dm).rows() == 0UL || (~dm).columns() == 0UL ) return RT();
+   BLAZE_INTERNAL_ASSERT( jbegin < jend && jend <= (~dm).columns(), "Invalid column range" );
+   BLAZE_INTERNAL_ASSERT( (~dm).rows() > 0UL, "Invalid number of rows" );
 
    CT tmp( ~dm );
 
-   const size_t M( tmp.rows()    );
-   const size_t N( tmp.columns() );
+   const size_t M( tmp.rows() );
 
-   ET norm( power( abs( tmp(0UL,0UL) ) ) );
+   ET norm( power( abs( tmp(0UL,jbegin) ) ) );
 
    {
       size_t i( 1UL );
 
       for( ; (i+4UL) <= M; i+=4UL ) {
-         norm += power( abs( tmp(i    ,0UL) ) ) + power( abs( tmp(i+1UL,0UL) ) ) +
-                 power( abs( tmp(i+2UL,0UL) ) ) + power( abs( tmp(i+3UL,0UL) ) );
+         norm += power( abs( tmp(i    ,jbegin) ) ) + power( abs( tmp(i+1UL,jbegin) ) ) +
+                 power( abs( tmp(i+2UL,jbegin) ) ) + power( abs( tmp(i+3UL,jbegin) ) );
       }
       for( ; (i+2UL) <= M; i+=2UL ) {
-         norm += power( abs( tmp(i,0UL) ) ) + power( abs( tmp(i+1UL,0UL) ) );
+         norm += power( abs( tmp(i,jbegin) ) ) + power( abs( tmp(i+1UL,jbegin) ) );
       }
       for( ; i<M; ++i ) {
-         norm += power( abs( tmp(i,0UL) ) );
+         norm += power( abs( tmp(i,jbegin) ) );
       }
    }
 
-   for( size_t j=1UL; j<N; ++j )
+   for( size_t j=jbegin+1UL; j<jend; ++j )
    {
       size_t i( 0UL );
 
@@ -266,7 +276,7 @@ inline decltype(auto) norm_backend( const DenseMatrix<MT,true>& dm, Abs abs, Pow
       }
    }
 
-   return evaluate( root( norm ) );
+   return norm;
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -274,36 +284,37 @@ inline decltype(auto) norm_backend( const DenseMatrix<MT,true>& dm, Abs abs, Pow
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief SIMD optimized backend implementation of the norm of a row-major dense matrix.
+/*!\brief SIMD optimized backend implementation of the norm of a range of rows of a row-major
+//        dense matrix.
 // \ingroup dense_matrix
 //
 // \param dm The given row-major dense matrix for the norm computation.
+// \param ibegin The index of the first row of the range.
+// \param iend The index one past the last row of the range.
 // \param abs The functor for the abs operation.
 // \param power The functor for the power operation.
-// \param root The functor for the root operation.
-// \return The norm of the given matrix.
+// \return The sum of the powers of the absolute values of the given rows.
 //
-// This function implements the performance optimized norm of a row-major dense matrix. Due to
+// This function implements the performance optimized norm of the non-empty row range
+// \f$ [ibegin..iend) \f$ of a row-major dense matrix (without the final root operation). Due to
 // the explicit application of the SFINAE principle, this function can only be selected by the
 // compiler in case vectorization can be applied.
 */
-template< typename MT      // Type of the dense matrix
-        , typename Abs     // Type of the abs operation
-        , typename Power   // Type of the power operation
-        , typename Root >  // Type of the root operation
-inline decltype(auto) norm_backend( const DenseMatrix<MT,false>& dm, Abs abs, Power power, Root root, TrueType )
+template< typename MT       // Type of the dense matrix
+        , typename Abs      // Type of the abs operation
+        , typename Power >  // Type of the power operation
+inline ElementType_t<MT>
+   dmatnorm( const DenseMatrix<MT,false>& dm, size_t ibegin, size_t iend, Abs abs, Power power, TrueType )
 {
    using CT = CompositeType_t<MT>;
    using ET = ElementType_t<MT>;
-   using RT = decltype( evaluate( root( std::declval<ET>() ) ) );
 
    static constexpr size_t SIMDSIZE = SIMDTrait<ET>::size;
 
-   if( (~dm).rows() == 0UL || (~dm).columns() == 0UL ) return RT();
+   BLAZE_INTERNAL_ASSERT( ibegin < iend && iend <= (~dm).rows(), "Invalid row range" );
 
    CT tmp( ~dm );
 
-   const size_t M( tmp.rows()    );
    const size_t N( tmp.columns() );
 
    constexpr bool remainder( !IsPadded_v< RemoveReference_t<CT> > );
@@ -314,7 +325,7 @@ inline decltype(auto) norm_backend( const DenseMatrix<MT,false>& dm, Abs abs, Po
    SIMDTrait_t<ET> xmm1, xmm2, xmm3, xmm4;
    ET norm{};
 
-   for( size_t i=0UL; i<M; ++i )
+   for( size_t i=ibegin; i<iend; ++i )
    {
       size_t j( 0UL );
 
@@ -338,7 +349,7 @@ inline decltype(auto) norm_backend( const DenseMatrix<MT,false>& dm, Abs abs, Po
 
    norm += sum( xmm1 + xmm2 + xmm3 + xmm4 );
 
-   return evaluate( root( norm ) );
+   return norm;
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -346,37 +357,38 @@ inline decltype(auto) norm_backend( const DenseMatrix<MT,false>& dm, Abs abs, Po
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief SIMD optimized backend implementation of the norm of a column-major dense matrix.
+/*!\brief SIMD optimized backend implementation of the norm of a range of columns of a
+//        column-major dense matrix.
 // \ingroup dense_matrix
 //
 // \param dm The given column-major dense matrix for the norm computation.
+// \param jbegin The index of the first column of the range.
+// \param jend The index one past the last column of the range.
 // \param abs The functor for the abs operation.
 // \param power The functor for the power operation.
-// \param root The functor for the root operation.
-// \return The norm of the given matrix.
+// \return The sum of the powers of the absolute values of the given columns.
 //
-// This function implements the performance optimized norm of a column-major dense matrix. Due
-// to the explicit application of the SFINAE principle, this function can only be selected by
-// the compiler in case vectorization can be applied.
+// This function implements the performance optimized norm of the non-empty column range
+// \f$ [jbegin..jend) \f$ of a column-major dense matrix (without the final root operation).
+// Due to the explicit application of the SFINAE principle, this function can only be selected
+// by the compiler in case vectorization can be applied.
 */
-template< typename MT      // Type of the dense matrix
-        , typename Abs     // Type of the abs operation
-        , typename Power   // Type of the power operation
-        , typename Root >  // Type of the root operation
-inline decltype(auto) norm_backend( const DenseMatrix<MT,true>& dm, Abs abs, Power power, Root root, TrueType )
+template< typename MT       // Type of the dense matrix
+        , typename Abs      // Type of the abs operation
+        , typename Power >  // Type of the power operation
+inline ElementType_t<MT>
+   dmatnorm( const DenseMatrix<MT,true>& dm, size_t jbegin, size_t jend, Abs abs, Power power, TrueType )
 {
    using CT = CompositeType_t<MT>;
    using ET = ElementType_t<MT>;
-   using RT = decltype( evaluate( root( std::declval<ET>() ) ) );
 
    static constexpr size_t SIMDSIZE = SIMDTrait<ET>::size;
 
-   if( (~dm).rows() == 0UL || (~dm).columns() == 0UL ) return RT();
+   BLAZE_INTERNAL_ASSERT( jbegin < jend && jend <= (~dm).columns(), "Invalid column range" );
 
    CT tmp( ~dm );
 
-   const size_t M( tmp.rows()    );
-   const size_t N( tmp.columns() );
+   const size_t M( tmp.rows() );
 
    constexpr bool remainder( !IsPadded_v< RemoveReference_t<CT> > );
 
@@ -386,7 +398,7 @@ inline decltype(auto) norm_backend( const DenseMatrix<MT,true>& dm, Abs abs, Pow
    SIMDTrait_t<ET> xmm1, xmm2, xmm3, xmm4;
    ET norm{};
 
-   for( size_t j=0UL; j<N; ++j )
+   for( size_t j=jbegin; j<jend; ++j )
    {
       size_t i( 0UL );
 
@@ -410,7 +422,7 @@ inline decltype(auto) norm_backend( const DenseMatrix<MT,true>& dm, Abs abs, Pow
 
    norm += sum( xmm1 + xmm2 + xmm3 + xmm4 );
 
-   return evaluate( root( norm ) );
+   return norm;
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -436,6 +448,13 @@ inline decltype(auto) norm_backend( const DenseMatrix<MT,true>& dm, Abs abs, Pow
    // ... Resizing and initialization
    const double l2 = norm( A, blaze::Pow2(), blaze::Sqrt() );
    \endcode
+
+// In case the number of elements of the matrix is larger or equal to the SMP dense matrix total
+// reduction threshold (see the BLAZE_SMP_DMATTOTALREDUCE_THRESHOLD configuration), the rows (in
+// case of a row-major matrix) or columns (in case of a column-major matrix) are split into blocks
+// containing roughly REDUCTION_BLOCK_SIZE elements each, the blocks are processed in parallel
+// and the partial results are combined in a fixed order (see smpReduce()). Thus for a given
+// threshold the result does not depend on the number of threads.
 */
 template< typename MT      // Type of the dense matrix
         , bool SO          // Storage order
@@ -444,7 +463,38 @@ template< typename MT      // Type of the dense matrix
         , typename Root >  // Type of the root operation
 decltype(auto) norm_backend( const DenseMatrix<MT,SO>& dm, Abs abs, Power power, Root root )
 {
-   return norm_backend( ~dm, abs, power, root, Bool_t< DMatNormHelper<MT,Abs,Power>::value >() );
+   using CT = CompositeType_t<MT>;
+   using ET = ElementType_t<MT>;
+   using RT = decltype( evaluate( root( std::declval<ET>() ) ) );
+
+   using Vectorized = Bool_t< DMatNormHelper<MT,Abs,Power>::value >;
+
+   const size_t M( (~dm).rows()    );
+   const size_t N( (~dm).columns() );
+
+   if( M == 0UL || N == 0UL ) return RT();
+
+   CT tmp( ~dm );
+
+   BLAZE_INTERNAL_ASSERT( tmp.rows()    == M, "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( tmp.columns() == N, "Invalid number of columns" );
+
+   const size_t outer( SO ? N : M );
+   const size_t inner( SO ? M : N );
+
+   if( M*N < SMP_DMATTOTALREDUCE_THRESHOLD ) {
+      return evaluate( root( dmatnorm( tmp, 0UL, outer, abs, power, Vectorized() ) ) );
+   }
+
+   const size_t chunk ( max( REDUCTION_BLOCK_SIZE / inner, 1UL ) );
+   const size_t blocks( ( outer - 1UL ) / chunk + 1UL );
+
+   const auto block = [&tmp,&abs,&power,outer,chunk]( size_t b ) {
+      const size_t begin( b*chunk );
+      return dmatnorm( tmp, begin, min( begin+chunk, outer ), abs, power, Vectorized() );
+   };
+
+   return evaluate( root( smpReduce<ET>( blocks, canSMPReduce( ~dm ), block, Add() ) ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -63,6 +63,7 @@
 #include <blaze/math/shims/PrevMultiple.h>
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/ParallelReduce.h>
 #include <blaze/math/traits/ReduceTrait.h>
 #include <blaze/math/typetraits/HasLoad.h>
 #include <blaze/math/typetraits/IsExpression.h>
@@ -71,15 +72,19 @@
 #include <blaze/math/typetraits/IsUniform.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
 #include <blaze/math/views/Check.h>
+#include <blaze/system/Blocking.h>
 #include <blaze/system/HostDevice.h>
 #include <blaze/system/MacroDisable.h>
 #include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
 #include <blaze/util/mpl/If.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/typetraits/AlignmentOf.h>
 #include <blaze/util/typetraits/HasMember.h>
 #include <blaze/util/typetraits/IsSame.h>
 #include <blaze/util/typetraits/RemoveReference.h>
@@ -1547,45 +1552,43 @@ struct DMatReduceExprHelper
 // \ingroup dense_matrix
 //
 // \param dm The given row-major dense matrix for the reduction computation.
+// \param ibegin The index of the first row of the range.
+// \param iend The index one past the last row of the range.
 // \param op The reduction operation.
 // \return The result of the reduction operation.
 //
-// This function implements the performance optimized reduction operation for a row-major dense
-// matrix. Due to the explicit application of the SFINAE principle, this function can only be
+// This function implements the performance optimized reduction operation for the non-empty
+// row range \f$ [ibegin..iend) \f$ of a row-major dense matrix. Due to the explicit application of the SFINAE principle, this function can only be
 // selected by the compiler in case vectorization cannot be applied.
 */
 template< typename MT    // Type of the dense matrix
         , typename OP >  // Type of the reduction operation
-inline auto dmatreduce( const DenseMatrix<MT,false>& dm, OP op )
+inline auto dmatreduce( const DenseMatrix<MT,false>& dm, size_t ibegin, size_t iend, OP op )
    -> DisableIf_t< DMatReduceExprHelper<MT,OP>::value, ElementType_t<MT> >
 {
    using CT = CompositeType_t<MT>;
    using ET = ElementType_t<MT>;
 
-   const size_t M( (~dm).rows()    );
    const size_t N( (~dm).columns() );
 
-   if( M == 0UL || N == 0UL ) return ET{};
-   if( M == 1UL && N == 1UL ) return (~dm)(0UL,0UL);
+   BLAZE_INTERNAL_ASSERT( ibegin < iend && iend <= (~dm).rows(), "Invalid row range" );
+   BLAZE_INTERNAL_ASSERT( N > 0UL, "Invalid number of columns" );
 
    CT tmp( ~dm );
 
-   BLAZE_INTERNAL_ASSERT( tmp.rows()    == M, "Invalid number of rows"    );
-   BLAZE_INTERNAL_ASSERT( tmp.columns() == N, "Invalid number of columns" );
-
    ET redux0{};
 
    {
-      redux0 = tmp(0UL,0UL);
+      redux0 = tmp(ibegin,0UL);
 
       for( size_t j=1UL; j<N; ++j ) {
-         redux0 = op( redux0, tmp(0UL,j) );
+         redux0 = op( redux0, tmp(ibegin,j) );
       }
    }
 
-   size_t i( 1UL );
+   size_t i( ibegin+1UL );
 
-   for( ; (i+2UL) <= M; i+=2UL )
+   for( ; (i+2UL) <= iend; i+=2UL )
    {
       ET redux1( tmp(i    ,0UL) );
       ET redux2( tmp(i+1UL,0UL) );
@@ -1599,7 +1602,7 @@ inline auto dmatreduce( const DenseMatrix<MT,false>& dm, OP op )
       redux0 = op( redux0, redux1 );
    }
 
-   if( i < M )
+   if( i < iend )
    {
       ET redux1( tmp(i,0UL) );
 
@@ -1622,31 +1625,30 @@ inline auto dmatreduce( const DenseMatrix<MT,false>& dm, OP op )
 // \ingroup dense_matrix
 //
 // \param dm The given row-major dense matrix for the reduction computation.
+// \param ibegin The index of the first row of the range.
+// \param iend The index one past the last row of the range.
 // \param op The reduction operation.
 // \return The result of the reduction operation.
 //
-// This function implements the performance optimized reduction operation for a row-major dense
-// matrix. Due to the explicit application of the SFINAE principle, this function can only be
+// This function implements the performance optimized reduction operation for the non-empty
+// row range \f$ [ibegin..iend) \f$ of a row-major dense matrix. Due to the explicit application of the SFINAE principle, this function can only be
 // selected by the compiler in case vectorization can be applied.
 */
 template< typename MT    // Type of the dense matrix
         , typename OP >  // Type of the reduction operation
-inline auto dmatreduce( const DenseMatrix<MT,false>& dm, OP op )
+inline auto dmatreduce( const DenseMatrix<MT,false>& dm, size_t ibegin, size_t iend, OP op )
    -> EnableIf_t< DMatReduceExprHelper<MT,OP>::value, ElementType_t<MT> >
 {
    using CT = CompositeType_t<MT>;
    using ET = ElementType_t<MT>;
 
-   const size_t M( (~dm).rows()    );
    const size_t N( (~dm).columns() );
 
-   if( M == 0UL || N == 0UL ) return ET{};
+   BLAZE_INTERNAL_ASSERT( ibegin < iend && iend <= (~dm).rows(), "Invalid row range" );
+   BLAZE_INTERNAL_ASSERT( N > 0UL, "Invalid number of columns" );
 
    CT tmp( ~dm );
 
-   BLAZE_INTERNAL_ASSERT( tmp.rows()    == M, "Invalid number of rows"    );
-   BLAZE_INTERNAL_ASSERT( tmp.columns() == N, "Invalid number of columns" );
-
    constexpr size_t SIMDSIZE = SIMDTrait<ET>::size;
 
    alignas( AlignmentOf_v<ET> ) ET array1[SIMDSIZE];
@@ -1664,11 +1666,11 @@ inline auto dmatreduce( const DenseMatrix<MT,false>& dm, OP op )
       SIMDTrait_t<ET> xmm1;
 
       {
-         xmm1 = tmp.load(0UL,0UL);
+         xmm1 = tmp.load(ibegin,0UL);
          size_t j( SIMDSIZE );
 
          for( ; j<jpos; j+=SIMDSIZE ) {
-            xmm1 = op( xmm1, tmp.load(0UL,j) );
+            xmm1 = op( xmm1, tmp.load(ibegin,j) );
          }
 
          if( jpos < N )
@@ -1676,16 +1678,16 @@ inline auto dmatreduce( const DenseMatrix<MT,false>& dm, OP op )
             storea( array1, xmm1 );
 
             for( ; j<N; ++j ) {
-               array1[0UL] = op( array1[0UL], tmp(0UL,j) );
+               array1[0UL] = op( array1[0UL], tmp(ibegin,j) );
             }
 
             xmm1 = loada( array1 );
          }
       }
 
-      size_t i( 1UL );
+      size_t i( ibegin+1UL );
 
-      for( ; (i+4UL) <= M; i+=4UL )
+      for( ; (i+4UL) <= iend; i+=4UL )
       {
          xmm1 = op( xmm1, tmp.load(i,0UL) );
          SIMDTrait_t<ET> xmm2( tmp.load(i+1UL,0UL) );
@@ -1725,7 +1727,7 @@ inline auto dmatreduce( const DenseMatrix<MT,false>& dm, OP op )
          xmm1 = op( xmm1, xmm3 );
       }
 
-      if( i+2UL <= M )
+      if( i+2UL <= iend )
       {
          xmm1 = op( xmm1, tmp.load(i,0UL) );
          SIMDTrait_t<ET> xmm2( tmp.load(i+1UL,0UL) );
@@ -1755,7 +1757,7 @@ inline auto dmatreduce( const DenseMatrix<MT,false>& dm, OP op )
          i += 2UL;
       }
 
-      if( i < M )
+      if( i < iend )
       {
          xmm1 = op( xmm1, tmp.load(i,0UL) );
          size_t j( SIMDSIZE );
@@ -1781,12 +1783,12 @@ inline auto dmatreduce( const DenseMatrix<MT,false>& dm, OP op )
    else
    {
       {
-         redux = tmp(0UL,0UL);
+         redux = tmp(ibegin,0UL);
          for( size_t j=1UL; j<N; ++j ) {
-            redux = op( redux, tmp(0UL,j) );
+            redux = op( redux, tmp(ibegin,j) );
          }
       }
-      for( size_t i=1UL; i<M; ++i ) {
+      for( size_t i=ibegin+1UL; i<iend; ++i ) {
          for( size_t j=0UL; j<N; ++j ) {
             redux = op( redux, tmp(i,j) );
          }
@@ -1805,114 +1807,150 @@ inline auto dmatreduce( const DenseMatrix<MT,false>& dm, OP op )
 // \ingroup dense_matrix
 //
 // \param dm The given row-major dense matrix for the summation.
+// \param ibegin The index of the first row of the range.
+// \param iend The index one past the last row of the range.
 // \return The result of the summation.
 //
-// This function implements the performance optimized summation for a row-major dense matrix.
-// Due to the explicit application of the SFINAE principle, this function can only be selected
-// by the compiler in case vectorization can be applied.
+// This function implements the performance optimized summation for the non-empty row range
+// \f$ [ibegin..iend) \f$ of a row-major dense matrix. In case the matrix is not padded, the
+// trailing elements of each row are loaded as a zero-padded SIMD vector. Thus the summation
+// performs exactly the same operations as for a padded matrix, i.e. the result doesn't depend
+// on the padding of the operand (as for instance for an unaligned submatrix and its evaluation
+// into a temporary matrix). Due to the explicit application of the SFINAE principle, this
+// function can only be selected by the compiler in case vectorization can be applied.
 */
 template< typename MT >  // Type of the dense matrix
-inline auto dmatreduce( const DenseMatrix<MT,false>& dm, Add /*op*/ )
+inline auto dmatreduce( const DenseMatrix<MT,false>& dm, size_t ibegin, size_t iend, Add /*op*/ )
    -> EnableIf_t< DMatReduceExprHelper<MT,Add>::value, ElementType_t<MT> >
 {
    using CT = CompositeType_t<MT>;
    using ET = ElementType_t<MT>;
 
-   const size_t M( (~dm).rows()    );
    const size_t N( (~dm).columns() );
 
-   if( M == 0UL || N == 0UL ) return ET{};
+   BLAZE_INTERNAL_ASSERT( ibegin < iend && iend <= (~dm).rows(), "Invalid row range" );
+   BLAZE_INTERNAL_ASSERT( N > 0UL, "Invalid number of columns" );
 
    CT tmp( ~dm );
 
-   BLAZE_INTERNAL_ASSERT( tmp.rows()    == M, "Invalid number of rows"    );
-   BLAZE_INTERNAL_ASSERT( tmp.columns() == N, "Invalid number of columns" );
-
    constexpr bool remainder( !IsPadded_v< RemoveReference_t<CT> > );
    constexpr size_t SIMDSIZE = SIMDTrait<ET>::size;
 
-   ET redux{};
+   const size_t jpos( remainder ? prevMultiple( N, SIMDSIZE ) : N );
+   BLAZE_INTERNAL_ASSERT( jpos <= N, "Invalid end calculation" );
 
-   if( !remainder || N >= SIMDSIZE )
+   const auto load = [&tmp,jpos,N]( size_t i, size_t j ) -> SIMDTrait_t<ET>
    {
-      const size_t jpos( remainder ? prevMultiple( N, SIMDSIZE ) : N );
-      BLAZE_INTERNAL_ASSERT( jpos <= N, "Invalid end calculation" );
-
-      SIMDTrait_t<ET> xmm1;
-      size_t i( 0UL );
-
-      for( ; (i+4UL) <= M; i+=4UL )
-      {
-         xmm1 += tmp.load(i,0UL);
-         SIMDTrait_t<ET> xmm2( tmp.load(i+1UL,0UL) );
-         SIMDTrait_t<ET> xmm3( tmp.load(i+2UL,0UL) );
-         SIMDTrait_t<ET> xmm4( tmp.load(i+3UL,0UL) );
-         size_t j( SIMDSIZE );
+      if( !remainder || j < jpos ) {
+         return tmp.load(i,j);
+      }
 
-         for( ; j<jpos; j+=SIMDSIZE ) {
-            xmm1 += tmp.load(i    ,j);
-            xmm2 += tmp.load(i+1UL,j);
-            xmm3 += tmp.load(i+2UL,j);
-            xmm4 += tmp.load(i+3UL,j);
-         }
-         for( ; remainder && j<N; ++j ) {
-            redux += tmp(i    ,j);
-            redux += tmp(i+1UL,j);
-            redux += tmp(i+2UL,j);
-            redux += tmp(i+3UL,j);
-         }
+      alignas( AlignmentOf_v<ET> ) ET array[SIMDSIZE] = {};
 
-         xmm1 += xmm2;
-         xmm3 += xmm4;
-         xmm1 += xmm3;
+      for( size_t k=j; k<N; ++k ) {
+         array[k-j] = tmp(i,k);
       }
 
-      if( i+2UL <= M )
-      {
-         xmm1 += tmp.load(i,0UL);
-         SIMDTrait_t<ET> xmm2( tmp.load(i+1UL,0UL) );
-         size_t j( SIMDSIZE );
-
-         for( ; j<jpos; j+=SIMDSIZE ) {
-            xmm1 += tmp.load(i    ,j);
-            xmm2 += tmp.load(i+1UL,j);
-         }
-         for( ; remainder && j<N; ++j ) {
-            redux += tmp(i    ,j);
-            redux += tmp(i+1UL,j);
-         }
+      return loada( array );
+   };
 
-         xmm1 += xmm2;
+   SIMDTrait_t<ET> xmm1;
+   size_t i( ibegin );
 
-         i += 2UL;
+   for( ; (i+4UL) <= iend; i+=4UL )
+   {
+      xmm1 += load(i,0UL);
+      SIMDTrait_t<ET> xmm2( load(i+1UL,0UL) );
+      SIMDTrait_t<ET> xmm3( load(i+2UL,0UL) );
+      SIMDTrait_t<ET> xmm4( load(i+3UL,0UL) );
+
+      for( size_t j=SIMDSIZE; j<N; j+=SIMDSIZE ) {
+         xmm1 += load(i    ,j);
+         xmm2 += load(i+1UL,j);
+         xmm3 += load(i+2UL,j);
+         xmm4 += load(i+3UL,j);
       }
 
-      if( i < M )
-      {
-         xmm1 += tmp.load(i,0UL);
-         size_t j( SIMDSIZE );
+      xmm1 += xmm2;
+      xmm3 += xmm4;
+      xmm1 += xmm3;
+   }
 
-         for( ; j<jpos; j+=SIMDSIZE ) {
-            xmm1 += tmp.load(i,j);
-         }
-         for( ; remainder && j<N; ++j ) {
-            redux += tmp(i,j);
-         }
+   if( i+2UL <= iend )
+   {
+      xmm1 += load(i,0UL);
+      SIMDTrait_t<ET> xmm2( load(i+1UL,0UL) );
+
+      for( size_t j=SIMDSIZE; j<N; j+=SIMDSIZE ) {
+         xmm1 += load(i    ,j);
+         xmm2 += load(i+1UL,j);
       }
 
-      redux += sum( xmm1 );
+      xmm1 += xmm2;
+
+      i += 2UL;
    }
-   else
+
+   if( i < iend )
    {
-      for( size_t i=0UL; i<M; ++i ) {
-         for( size_t j=0UL; j<N; ++j ) {
-            redux += tmp(i,j);
-         }
+      for( size_t j=0UL; j<N; j+=SIMDSIZE ) {
+         xmm1 += load(i,j);
       }
    }
 
-   return redux;
+   return sum( xmm1 );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the reduction of a row-major dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given row-major dense matrix for the reduction computation.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function reduces the given row-major dense matrix by means of the row range kernels.
+// In case the number of elements of the matrix is larger or equal to the SMP dense matrix total
+// reduction threshold (see the BLAZE_SMP_DMATTOTALREDUCE_THRESHOLD configuration), the matrix
+// is split into blocks of rows containing roughly REDUCTION_BLOCK_SIZE elements each, the
+// blocks are reduced in parallel and the partial results are combined in a fixed order (see
+// smpReduce()). Thus for a given threshold the result does not depend on the number of threads.
+*/
+template< typename MT    // Type of the dense matrix
+        , typename OP >  // Type of the reduction operation
+inline ElementType_t<MT> dmatreduce( const DenseMatrix<MT,false>& dm, OP op )
+{
+   using CT = CompositeType_t<MT>;
+   using ET = ElementType_t<MT>;
+
+   const size_t M( (~dm).rows()    );
+   const size_t N( (~dm).columns() );
+
+   if( M == 0UL || N == 0UL ) return ET{};
+   if( M == 1UL && N == 1UL ) return (~dm)(0UL,0UL);
+
+   CT tmp( ~dm );
+
+   BLAZE_INTERNAL_ASSERT( tmp.rows()    == M, "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( tmp.columns() == N, "Invalid number of columns" );
+
+   if( M*N < SMP_DMATTOTALREDUCE_THRESHOLD ) {
+      return dmatreduce( tmp, 0UL, M, op );
+   }
+
+   const size_t rows  ( max( REDUCTION_BLOCK_SIZE / N, 1UL ) );
+   const size_t blocks( ( M - 1UL ) / rows + 1UL );
+
+   const auto block = [&tmp,&op,M,rows]( size_t b ) {
+      const size_t ibegin( b*rows );
+      return dmatreduce( tmp, ibegin, min( ibegin+rows, M ), op );
+   };
 
+   return smpReduce<ET>( blocks, canSMPReduce( ~dm ), block, op );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -54,6 +54,7 @@
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/Forward.h>
+#include <blaze/math/expressions/MatMatMultChain.h>
 #include <blaze/math/expressions/MatMatMultExpr.h>
 #include <blaze/math/functors/DeclDiag.h>
 #include <blaze/math/functors/DeclHerm.h>
@@ -461,6 +462,11 @@ class DMatSMatMultExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( rhs.lhs_, rhs.rhs_,
+             [&lhs]( const auto& expr ){ assign( ~lhs, expr ); } ) ) {
+         return;
+      }
+
       LT A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side dense matrix operand
       RT B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side sparse matrix operand
 
@@ -820,6 +826,11 @@ class DMatSMatMultExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( rhs.lhs_, rhs.rhs_,
+             [&lhs]( const auto& expr ){ addAssign( ~lhs, expr ); } ) ) {
+         return;
+      }
+
       LT A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side dense matrix operand
       RT B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side sparse matrix operand
 
@@ -1017,6 +1028,11 @@ class DMatSMatMultExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( rhs.lhs_, rhs.rhs_,
+             [&lhs]( const auto& expr ){ subAssign( ~lhs, expr ); } ) ) {
+         return;
+      }
+
       LT A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side dense matrix operand
       RT B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side sparse matrix operand
 
@@ -1260,6 +1276,11 @@ class DMatSMatMultExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( rhs.lhs_, rhs.rhs_,
+             [&lhs]( const auto& expr ){ smpAssign( ~lhs, expr ); } ) ) {
+         return;
+      }
+
       LT A( rhs.lhs_ );  // Evaluation of the left-hand side dense matrix operand
       RT B( rhs.rhs_ );  // Evaluation of the right-hand side sparse matrix operand
 
@@ -1381,6 +1402,11 @@ class DMatSMatMultExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( rhs.lhs_, rhs.rhs_,
+             [&lhs]( const auto& expr ){ smpAddAssign( ~lhs, expr ); } ) ) {
+         return;
+      }
+
       LT A( rhs.lhs_ );  // Evaluation of the left-hand side dense matrix operand
       RT B( rhs.rhs_ );  // Evaluation of the right-hand side sparse matrix operand
 
@@ -1465,6 +1491,11 @@ class DMatSMatMultExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( rhs.lhs_, rhs.rhs_,
+             [&lhs]( const auto& expr ){ smpSubAssign( ~lhs, expr ); } ) ) {
+         return;
+      }
+
       LT A( rhs.lhs_ );  // Evaluation of the left-hand side dense matrix operand
       RT B( rhs.rhs_ );  // Evaluation of the right-hand side sparse matrix operand
 
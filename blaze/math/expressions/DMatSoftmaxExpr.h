@@ -40,21 +40,207 @@
 // Includes
 //*************************************************************************************************
 
+#include <limits>
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DynamicVector.h>
 #include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DVecSoftmaxExpr.h>
 #include <blaze/math/ReductionFlag.h>
+#include <blaze/math/shims/Exp.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/smp/ParallelReduce.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/typetraits/IsAdaptor.h>
+#include <blaze/math/typetraits/IsUniform.h>
 #include <blaze/math/views/Check.h>
 #include <blaze/math/views/Column.h>
 #include <blaze/math/views/Row.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsBuiltin.h>
+#include <blaze/util/typetraits/RemoveCVRef.h>
 
 
 namespace blaze {
 
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the dense matrix softmax function.
+// \ingroup dense_matrix
+*/
+template< typename MT >  // Type of the dense matrix
+struct DMatSoftmaxHelper
+{
+   //**Type definitions****************************************************************************
+   //! Element type of the dense matrix expression.
+   using ET = ElementType_t<MT>;
+
+   //! Result type of the softmax function.
+   using RT = ResultType_t< decltype( exp( std::declval<MT>() ) ) >;
+
+   //! Type of the normalizer (i.e. the maximum element and the sum of the shifted exponentials).
+   using NT = std::pair< ET, RemoveCVRef_t< decltype( exp( std::declval<ET>() ) ) > >;
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Compilation switch for the fused total softmax kernel.
+   static constexpr bool fused = ( IsBuiltin_v<ET> && !IsUniform_v<RT> );
+
+   //! Compilation switch for the fused row-/columnwise softmax kernels.
+   static constexpr bool fusedwise = ( fused && !IsAdaptor_v<RT> );
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  GLOBAL FUNCTIONS
 //
 //=================================================================================================
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the specified row of the given matrix.
+// \ingroup dense_matrix
+//
+// \param matrix The given matrix.
+// \param k The index of the row.
+// \return View on the specified row.
+*/
+template< typename MT >  // Type of the matrix
+inline decltype(auto) softmaxLine( MT& matrix, size_t k, FalseType )
+{
+   return row( matrix, k, unchecked );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the specified column of the given matrix.
+// \ingroup dense_matrix
+//
+// \param matrix The given matrix.
+// \param k The index of the column.
+// \return View on the specified column.
+*/
+template< typename MT >  // Type of the matrix
+inline decltype(auto) softmaxLine( MT& matrix, size_t k, TrueType )
+{
+   return column( matrix, k, unchecked );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default backend implementation of the softmax function for the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix for the softmax computation.
+// \return The resulting matrix.
+//
+// This function computes the softmax function by means of the exponential function and a
+// subsequent normalization. It is selected for matrices with non-builtin element type (for
+// instance complex numbers) and for uniform matrices.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+auto softmax_backend( const DenseMatrix<MT,SO>& dm, FalseType )
+{
+   auto tmp( evaluate( exp( ~dm ) ) );
+   const auto scalar( sum( tmp ) );
+   tmp /= scalar;
+   return tmp;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fused backend implementation of the softmax function for the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix for the softmax computation.
+// \return The resulting matrix.
+//
+// This function computes the softmax function in two passes over the given dense matrix: The
+// first pass computes the maximum element \f$ m \f$ and the sum \f$ s = \sum e^{x_{ij}-m} \f$
+// row by row (or column by column in case of a column-major matrix), the second pass directly
+// writes \f$ e^{x_{ij}-m} / s \f$ to the resulting matrix. In case the number of elements of
+// the matrix is larger or equal to the SMP dense matrix total reduction threshold, the first
+// pass is executed in parallel (see smpReduce()).
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+auto softmax_backend( const DenseMatrix<MT,SO>& dm, TrueType )
+{
+   using CT = CompositeType_t<MT>;
+   using RT = typename DMatSoftmaxHelper<MT>::RT;
+   using NT = typename DMatSoftmaxHelper<MT>::NT;
+
+   const size_t M( (~dm).rows()    );
+   const size_t N( (~dm).columns() );
+
+   if( M == 0UL || N == 0UL ) return RT( exp( ~dm ) );
+
+   CT tmp( ~dm );
+
+   const size_t outer( SO ? N : M );
+   const size_t inner( SO ? M : N );
+   const size_t chunk( M*N < SMP_DMATTOTALREDUCE_THRESHOLD
+                       ? outer
+                       : max( REDUCTION_BLOCK_SIZE / inner, 1UL ) );
+   const size_t blocks( ( outer - 1UL ) / chunk + 1UL );
+
+   const auto block = [&tmp,outer,inner,chunk]( size_t b )
+   {
+      const size_t begin( b*chunk );
+      const size_t end  ( min( begin+chunk, outer ) );
+
+      NT norm( dvecsoftmax( softmaxLine( tmp, begin, Bool_t<SO>() ), 0UL, inner ) );
+
+      for( size_t k=begin+1UL; k<end; ++k ) {
+         norm = softmaxCombine( norm, dvecsoftmax( softmaxLine( tmp, k, Bool_t<SO>() ), 0UL, inner ) );
+      }
+
+      return norm;
+   };
+
+   const auto combine = []( const NT& lhs, const NT& rhs ) {
+      return softmaxCombine( lhs, rhs );
+   };
+
+   const NT norm( smpReduce<NT>( blocks, canSMPReduce( ~dm ), block, combine ) );
+
+   return RT( exp( tmp - norm.first ) / norm.second );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Computes the softmax function for the given dense matrix.
 // \ingroup dense_matrix
@@ -82,16 +268,211 @@ namespace blaze {
    blaze::StaticMatrix<double,3UL,3UL> B;
    B = softmax( A );
    \endcode
+
+// For matrices of built-in data type the softmax function is computed as
+// \f$ e^{x_{ij}-m} / \sum e^{x_{kl}-m} \f$, where \f$ m \f$ is the maximum element. Thus the
+// result is well-defined even for large elements that would overflow the exponential function.
+// The maximum and the sum are computed in a single pass and the result is written in a second
+// pass without creating an intermediate temporary.
 */
 template< typename MT  // Type of the dense matrix
         , bool SO >    // Storage order
 auto softmax( const DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return softmax_backend( ~dm, Bool_t< DMatSoftmaxHelper<MT>::fused >() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default backend implementation of the row-/columnwise softmax function for the given
+//        dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix for the softmax computation.
+// \return The resulting matrix.
+//
+// This function computes the row-/columnwise softmax function by means of the exponential
+// function and a subsequent normalization of each row/column. It is selected for matrices
+// with non-builtin element type (for instance complex numbers), for uniform matrices, and
+// for matrix adaptors.
+*/
+template< ReductionFlag RF  // Reduction flag
+        , typename MT       // Type of the dense matrix
+        , bool SO >         // Storage order
+auto softmax_backend( const DenseMatrix<MT,SO>& dm, FalseType )
 {
    auto tmp( evaluate( exp( ~dm ) ) );
-   const auto scalar( sum( tmp ) );
-   tmp /= scalar;
+
+   if( RF == rowwise ) {
+      for( size_t i=0UL; i<tmp.rows(); ++i ) {
+         auto r = row( tmp, i, unchecked );
+         const auto scalar( sum( r ) );
+         r /= scalar;
+      }
+   }
+   else {
+      for( size_t j=0UL; j<tmp.columns(); ++j ) {
+         auto c = column( tmp, j, unchecked );
+         const auto scalar( sum( c ) );
+         c /= scalar;
+      }
+   }
+
    return tmp;
 }
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fused softmax kernel for a range of contiguous rows/columns of a dense matrix.
+// \ingroup dense_matrix
+//
+// \param result The resulting matrix.
+// \param tmp The given dense matrix.
+// \param begin The index of the first row/column.
+// \param end The index one past the last row/column.
+// \return void
+//
+// This function computes the softmax function for the rows \f$ [begin..end) \f$ of a row-major
+// matrix (\a LT = \a FalseType) or the columns \f$ [begin..end) \f$ of a column-major matrix
+// (\a LT = \a TrueType). For each row/column the normalizer is computed in a single pass (see
+// dvecsoftmax()) and the result is written in a second pass.
+*/
+template< typename LT     // Line type (rows or columns)
+        , typename MT1    // Type of the resulting matrix
+        , typename MT2 >  // Type of the given dense matrix
+void softmaxContiguous( MT1& result, const MT2& tmp, size_t begin, size_t end )
+{
+   for( size_t k=begin; k<end; ++k )
+   {
+      const auto src( softmaxLine( tmp, k, LT() ) );
+      const auto norm( dvecsoftmax( src, 0UL, src.size() ) );
+
+      auto dst( softmaxLine( result, k, LT() ) );
+      dst = serial( exp( src - norm.first ) / norm.second );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fused softmax kernel for a range of strided rows/columns of a dense matrix.
+// \ingroup dense_matrix
+//
+// \param result The resulting matrix.
+// \param tmp The given dense matrix.
+// \param begin The index of the first row/column.
+// \param end The index one past the last row/column.
+// \return void
+//
+// This function computes the softmax function for the rows \f$ [begin..end) \f$ of a
+// column-major matrix (\a LT = \a FalseType) or the columns \f$ [begin..end) \f$ of a row-major
+// matrix (\a LT = \a TrueType). The normalizers of all rows/columns are updated simultaneously
+// while streaming through the contiguous columns/rows of the matrix, which results in the same
+// memory access pattern as for a contiguous softmax. The maxima start at the lowest finite value,
+// such that elements equal to negative infinity don't contribute to the sums.
+*/
+template< typename LT     // Line type (rows or columns)
+        , typename MT1    // Type of the resulting matrix
+        , typename MT2 >  // Type of the given dense matrix
+void softmaxStrided( MT1& result, const MT2& tmp, size_t begin, size_t end )
+{
+   using ET = ElementType_t<MT2>;
+   using ST = RemoveCVRef_t< decltype( exp( std::declval<ET>() ) ) >;
+
+   constexpr bool TF( LT::value );
+
+   const size_t n( end - begin );
+   const size_t cross( LT::value ? tmp.rows() : tmp.columns() );
+
+   const auto slice = [begin,n]( auto& matrix, size_t k ) {
+      return subvector( softmaxLine( matrix, k, Bool_t<!LT::value>() ), begin, n, unchecked );
+   };
+
+   DynamicVector<ET,TF> max1( n, std::numeric_limits<ET>::lowest() );
+   DynamicVector<ET,TF> max2( n );
+   DynamicVector<ST,TF> sums( n, ST(0) );
+
+   for( size_t k=0UL; k<cross; ++k ) {
+      const auto src( slice( tmp, k ) );
+      max2 = serial( max( max1, src ) );
+      sums = serial( sums * exp( max1 - max2 ) + exp( src - max2 ) );
+      swap( max1, max2 );
+   }
+
+   for( size_t k=0UL; k<cross; ++k ) {
+      auto dst( slice( result, k ) );
+      dst = serial( exp( slice( tmp, k ) - max1 ) / sums );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fused backend implementation of the row-/columnwise softmax function for the given
+//        dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix for the softmax computation.
+// \return The resulting matrix.
+//
+// This function computes the row-/columnwise softmax function in two passes over each row or
+// column without creating an intermediate temporary for the exponentials. In case the number
+// of rows/columns is larger or equal to the SMP dense matrix reduction threshold and the
+// matrix can be assigned in parallel, the rows/columns are distributed among the available
+// threads (see smpFor()).
+*/
+template< ReductionFlag RF  // Reduction flag
+        , typename MT       // Type of the dense matrix
+        , bool SO >         // Storage order
+auto softmax_backend( const DenseMatrix<MT,SO>& dm, TrueType )
+{
+   using CT = CompositeType_t<MT>;
+   using RT = typename DMatSoftmaxHelper<MT>::RT;
+   using LT = Bool_t< RF == columnwise >;
+
+   const size_t M( (~dm).rows()    );
+   const size_t N( (~dm).columns() );
+
+   if( M == 0UL || N == 0UL ) return RT( exp( ~dm ) );
+
+   CT tmp( ~dm );
+
+   RT result;
+   resize( result, M, N, false );
+
+   const auto kernel = [&result,&tmp]( size_t begin, size_t end )
+   {
+      if( LT::value == SO ) {
+         softmaxContiguous<LT>( result, tmp, begin, end );
+      }
+      else {
+         softmaxStrided<LT>( result, tmp, begin, end );
+      }
+   };
+
+   const size_t lines( RF == rowwise ? M : N );
+
+   if( canSMPReduce( ~dm ) && lines >= SMP_DMATREDUCE_THRESHOLD && !isParallelSectionActive() ) {
+      smpFor( lines, kernel );
+   }
+   else {
+      kernel( 0UL, lines );
+   }
+
+   return result;
+}
+/*! \endcond */
 //*************************************************************************************************
 
 
@@ -130,30 +511,21 @@ auto softmax( const DenseMatrix<MT,SO>& dm )
    blaze::StaticMatrix<double,3UL,3UL> C;
    C = softmax<columnwise>( A );
    \endcode
+
+// For matrices of built-in data type each row/column is shifted by its maximum element before
+// the exponential function is applied. Thus the result is well-defined even for large elements
+// that would overflow the exponential function. The maximum and the sum of each row/column are
+// computed in a single pass and the result is written in a second pass without creating an
+// intermediate temporary. For large matrices the rows/columns are processed in parallel.
 */
 template< ReductionFlag RF  // Reduction flag
         , typename MT       // Type of the dense matrix
         , bool SO >         // Storage order
 auto softmax( const DenseMatrix<MT,SO>& dm )
 {
-   auto tmp( evaluate( exp( ~dm ) ) );
+   BLAZE_FUNCTION_TRACE;
 
-   if( RF == rowwise ) {
-      for( size_t i=0UL; i<tmp.rows(); ++i ) {
-         auto r = row( tmp, i, unchecked );
-         const auto scalar( sum( r ) );
-         r /= scalar;
-      }
-   }
-   else {
-      for( size_t j=0UL; j<tmp.columns(); ++j ) {
-         auto c = column( tmp, j, unchecked );
-         const auto scalar( sum( c ) );
-         c /= scalar;
-      }
-   }
-
-   return tmp;
+   return softmax_backend<RF>( ~dm, Bool_t< DMatSoftmaxHelper<MT>::fusedwise >() );
 }
 //*************************************************************************************************
 
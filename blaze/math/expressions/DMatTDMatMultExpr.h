@@ -54,6 +54,7 @@
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/Forward.h>
+#include <blaze/math/expressions/MatMatMultChain.h>
 #include <blaze/math/expressions/MatMatMultExpr.h>
 #include <blaze/math/expressions/MatScalarMultExpr.h>
 #include <blaze/math/functors/DeclDiag.h>
@@ -108,6 +109,7 @@
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
 #include <blaze/util/IntegralConstant.h>
+#include <blaze/util/KernelProfile.h>
 #include <blaze/util/mpl/If.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/IsBuiltin.h>
@@ -506,6 +508,11 @@ class DMatTDMatMultExpr
          return;
       }
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( rhs.lhs_, rhs.rhs_,
+             [&lhs]( const auto& expr ){ assign( ~lhs, expr ); } ) ) {
+         return;
+      }
+
       LT A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side dense matrix operand
       RT B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -538,10 +545,22 @@ class DMatTDMatMultExpr
    static inline void selectAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
       if( ( IsDiagonal_v<MT4> || IsDiagonal_v<MT5> ) ||
-          ( C.rows() * C.columns() < DMATTDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < DMATTDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_PROFILE( "dmattdmatmult.assign.small", 1UL, A.rows(), B.columns(), A.columns(),
+                               2.0*A.rows()*B.columns()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + B.rows()*B.columns() +
+                                                     C.rows()*C.columns() ) );
          selectSmallAssignKernel( C, A, B );
-      else
+      }
+      else {
+         BLAZE_KERNEL_PROFILE( ( UseBlasKernel_v<MT3,MT4,MT5> ? "dmattdmatmult.assign.blas"
+                                                              : "dmattdmatmult.assign.large" ),
+                               1UL, A.rows(), B.columns(), A.columns(),
+                               2.0*A.rows()*B.columns()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + B.rows()*B.columns() +
+                                                     C.rows()*C.columns() ) );
          selectBlasAssignKernel( C, A, B );
+      }
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -2855,6 +2874,11 @@ class DMatTDMatMultExpr
          return;
       }
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( rhs.lhs_, rhs.rhs_,
+             [&lhs]( const auto& expr ){ addAssign( ~lhs, expr ); } ) ) {
+         return;
+      }
+
       LT A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side dense matrix operand
       RT B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -2887,10 +2911,22 @@ class DMatTDMatMultExpr
    static inline void selectAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
       if( ( IsDiagonal_v<MT4> || IsDiagonal_v<MT5> ) ||
-          ( C.rows() * C.columns() < DMATTDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < DMATTDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_PROFILE( "dmattdmatmult.addassign.small", 1UL, A.rows(), B.columns(), A.columns(),
+                               2.0*A.rows()*B.columns()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + B.rows()*B.columns() +
+                                                     2UL*C.rows()*C.columns() ) );
          selectSmallAddAssignKernel( C, A, B );
-      else
+      }
+      else {
+         BLAZE_KERNEL_PROFILE( ( UseBlasKernel_v<MT3,MT4,MT5> ? "dmattdmatmult.addassign.blas"
+                                                              : "dmattdmatmult.addassign.large" ),
+                               1UL, A.rows(), B.columns(), A.columns(),
+                               2.0*A.rows()*B.columns()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + B.rows()*B.columns() +
+                                                     2UL*C.rows()*C.columns() ) );
          selectBlasAddAssignKernel( C, A, B );
+      }
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -4609,6 +4645,11 @@ class DMatTDMatMultExpr
          return;
       }
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( rhs.lhs_, rhs.rhs_,
+             [&lhs]( const auto& expr ){ subAssign( ~lhs, expr ); } ) ) {
+         return;
+      }
+
       LT A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side dense matrix operand
       RT B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -4641,10 +4682,22 @@ class DMatTDMatMultExpr
    static inline void selectSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
       if( ( IsDiagonal_v<MT4> || IsDiagonal_v<MT5> ) ||
-          ( C.rows() * C.columns() < DMATTDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < DMATTDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_PROFILE( "dmattdmatmult.subassign.small", 1UL, A.rows(), B.columns(), A.columns(),
+                               2.0*A.rows()*B.columns()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + B.rows()*B.columns() +
+                                                     2UL*C.rows()*C.columns() ) );
          selectSmallSubAssignKernel( C, A, B );
-      else
+      }
+      else {
+         BLAZE_KERNEL_PROFILE( ( UseBlasKernel_v<MT3,MT4,MT5> ? "dmattdmatmult.subassign.blas"
+                                                              : "dmattdmatmult.subassign.large" ),
+                               1UL, A.rows(), B.columns(), A.columns(),
+                               2.0*A.rows()*B.columns()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + B.rows()*B.columns() +
+                                                     2UL*C.rows()*C.columns() ) );
          selectBlasSubAssignKernel( C, A, B );
+      }
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -6414,6 +6467,11 @@ class DMatTDMatMultExpr
          return;
       }
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( rhs.lhs_, rhs.rhs_,
+             [&lhs]( const auto& expr ){ smpAssign( ~lhs, expr ); } ) ) {
+         return;
+      }
+
       LT A( rhs.lhs_ );  // Evaluation of the left-hand side dense matrix operand
       RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense matrix operand
 
@@ -6501,6 +6559,11 @@ class DMatTDMatMultExpr
          return;
       }
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( rhs.lhs_, rhs.rhs_,
+             [&lhs]( const auto& expr ){ smpAddAssign( ~lhs, expr ); } ) ) {
+         return;
+      }
+
       LT A( rhs.lhs_ );  // Evaluation of the left-hand side dense matrix operand
       RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense matrix operand
 
@@ -6550,6 +6613,11 @@ class DMatTDMatMultExpr
          return;
       }
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( rhs.lhs_, rhs.rhs_,
+             [&lhs]( const auto& expr ){ smpSubAssign( ~lhs, expr ); } ) ) {
+         return;
+      }
+
       LT A( rhs.lhs_ );  // Evaluation of the left-hand side dense matrix operand
       RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense matrix operand
 
@@ -6979,6 +7047,11 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
          return;
       }
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( left, right,
+             [&lhs,&rhs]( const auto& expr ){ assign( ~lhs, expr * rhs.scalar_ ); } ) ) {
+         return;
+      }
+
       LT A( serial( left  ) );  // Evaluation of the left-hand side dense matrix operand
       RT B( serial( right ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -7011,10 +7084,22 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
    static inline void selectAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
    {
       if( ( IsDiagonal_v<MT4> || IsDiagonal_v<MT5> ) ||
-          ( C.rows() * C.columns() < DMATTDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < DMATTDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_PROFILE( "dmattdmatmult.assign.small", 1UL, A.rows(), B.columns(), A.columns(),
+                               2.0*A.rows()*B.columns()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + B.rows()*B.columns() +
+                                                     C.rows()*C.columns() ) );
          selectSmallAssignKernel( C, A, B, scalar );
-      else
+      }
+      else {
+         BLAZE_KERNEL_PROFILE( ( UseBlasKernel_v<MT3,MT4,MT5,ST2> ? "dmattdmatmult.assign.blas"
+                                                                  : "dmattdmatmult.assign.large" ),
+                               1UL, A.rows(), B.columns(), A.columns(),
+                               2.0*A.rows()*B.columns()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + B.rows()*B.columns() +
+                                                     C.rows()*C.columns() ) );
          selectBlasAssignKernel( C, A, B, scalar );
+      }
    }
    //**********************************************************************************************
 
@@ -9329,6 +9414,11 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
          return;
       }
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( left, right,
+             [&lhs,&rhs]( const auto& expr ){ addAssign( ~lhs, expr * rhs.scalar_ ); } ) ) {
+         return;
+      }
+
       LT A( serial( left  ) );  // Evaluation of the left-hand side dense matrix operand
       RT B( serial( right ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -9361,10 +9451,22 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
    static inline void selectAddAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
    {
       if( ( IsDiagonal_v<MT4> || IsDiagonal_v<MT5> ) ||
-          ( C.rows() * C.columns() < DMATTDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < DMATTDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_PROFILE( "dmattdmatmult.addassign.small", 1UL, A.rows(), B.columns(), A.columns(),
+                               2.0*A.rows()*B.columns()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + B.rows()*B.columns() +
+                                                     2UL*C.rows()*C.columns() ) );
          selectSmallAddAssignKernel( C, A, B, scalar );
-      else
+      }
+      else {
+         BLAZE_KERNEL_PROFILE( ( UseBlasKernel_v<MT3,MT4,MT5,ST2> ? "dmattdmatmult.addassign.blas"
+                                                                  : "dmattdmatmult.addassign.large" ),
+                               1UL, A.rows(), B.columns(), A.columns(),
+                               2.0*A.rows()*B.columns()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + B.rows()*B.columns() +
+                                                     2UL*C.rows()*C.columns() ) );
          selectBlasAddAssignKernel( C, A, B, scalar );
+      }
    }
    //**********************************************************************************************
 
@@ -11120,6 +11222,11 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
          return;
       }
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( left, right,
+             [&lhs,&rhs]( const auto& expr ){ subAssign( ~lhs, expr * rhs.scalar_ ); } ) ) {
+         return;
+      }
+
       LT A( serial( left  ) );  // Evaluation of the left-hand side dense matrix operand
       RT B( serial( right ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -11152,10 +11259,22 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
    static inline void selectSubAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
    {
       if( ( IsDiagonal_v<MT4> || IsDiagonal_v<MT5> ) ||
-          ( C.rows() * C.columns() < DMATTDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < DMATTDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_PROFILE( "dmattdmatmult.subassign.small", 1UL, A.rows(), B.columns(), A.columns(),
+                               2.0*A.rows()*B.columns()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + B.rows()*B.columns() +
+                                                     2UL*C.rows()*C.columns() ) );
          selectSmallSubAssignKernel( C, A, B, scalar );
-      else
+      }
+      else {
+         BLAZE_KERNEL_PROFILE( ( UseBlasKernel_v<MT3,MT4,MT5,ST2> ? "dmattdmatmult.subassign.blas"
+                                                                  : "dmattdmatmult.subassign.large" ),
+                               1UL, A.rows(), B.columns(), A.columns(),
+                               2.0*A.rows()*B.columns()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + B.rows()*B.columns() +
+                                                     2UL*C.rows()*C.columns() ) );
          selectBlasSubAssignKernel( C, A, B, scalar );
+      }
    }
    //**********************************************************************************************
 
@@ -12966,6 +13085,11 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
          return;
       }
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( left, right,
+             [&lhs,&rhs]( const auto& expr ){ smpAssign( ~lhs, expr * rhs.scalar_ ); } ) ) {
+         return;
+      }
+
       LT A( left  );  // Evaluation of the left-hand side dense matrix operand
       RT B( right );  // Evaluation of the right-hand side dense matrix operand
 
@@ -13053,6 +13177,11 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
          return;
       }
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( left, right,
+             [&lhs,&rhs]( const auto& expr ){ smpAddAssign( ~lhs, expr * rhs.scalar_ ); } ) ) {
+         return;
+      }
+
       LT A( left  );  // Evaluation of the left-hand side dense matrix operand
       RT B( right );  // Evaluation of the right-hand side dense matrix operand
 
@@ -13103,6 +13232,11 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
          return;
       }
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( left, right,
+             [&lhs,&rhs]( const auto& expr ){ smpSubAssign( ~lhs, expr * rhs.scalar_ ); } ) ) {
+         return;
+      }
+
       LT A( left  );  // Evaluation of the left-hand side dense matrix operand
       RT B( right );  // Evaluation of the right-hand side dense matrix operand
 
@@ -54,6 +54,7 @@
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/Forward.h>
+#include <blaze/math/expressions/MatMatMultChain.h>
 #include <blaze/math/expressions/MatMatMultExpr.h>
 #include <blaze/math/functors/DeclDiag.h>
 #include <blaze/math/functors/DeclHerm.h>
@@ -454,6 +455,11 @@ class DMatTSMatMultExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( rhs.lhs_, rhs.rhs_,
+             [&lhs]( const auto& expr ){ assign( ~lhs, expr ); } ) ) {
+         return;
+      }
+
       LT A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side dense matrix operand
       RT B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side sparse matrix operand
 
@@ -881,6 +887,11 @@ class DMatTSMatMultExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( rhs.lhs_, rhs.rhs_,
+             [&lhs]( const auto& expr ){ addAssign( ~lhs, expr ); } ) ) {
+         return;
+      }
+
       LT A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side dense matrix operand
       RT B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side sparse matrix operand
 
@@ -1209,6 +1220,11 @@ class DMatTSMatMultExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( rhs.lhs_, rhs.rhs_,
+             [&lhs]( const auto& expr ){ subAssign( ~lhs, expr ); } ) ) {
+         return;
+      }
+
       LT A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side dense matrix operand
       RT B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side sparse matrix operand
 
@@ -1583,6 +1599,11 @@ class DMatTSMatMultExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( rhs.lhs_, rhs.rhs_,
+             [&lhs]( const auto& expr ){ smpAssign( ~lhs, expr ); } ) ) {
+         return;
+      }
+
       LT A( rhs.lhs_ );  // Evaluation of the left-hand side dense matrix operand
       RT B( rhs.rhs_ );  // Evaluation of the right-hand side sparse matrix operand
 
@@ -1697,6 +1718,11 @@ class DMatTSMatMultExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( rhs.lhs_, rhs.rhs_,
+             [&lhs]( const auto& expr ){ smpAddAssign( ~lhs, expr ); } ) ) {
+         return;
+      }
+
       LT A( rhs.lhs_ );  // Evaluation of the left-hand side dense matrix operand
       RT B( rhs.rhs_ );  // Evaluation of the right-hand side sparse matrix operand
 
@@ -1773,6 +1799,11 @@ class DMatTSMatMultExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( rhs.lhs_, rhs.rhs_,
+             [&lhs]( const auto& expr ){ smpSubAssign( ~lhs, expr ); } ) ) {
+         return;
+      }
+
       LT A( rhs.lhs_ );  // Evaluation of the left-hand side dense matrix operand
       RT B( rhs.rhs_ );  // Evaluation of the right-hand side sparse matrix operand
 
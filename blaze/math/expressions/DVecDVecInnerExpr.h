@@ -41,21 +41,30 @@
 //*************************************************************************************************
 
 #include <blaze/math/Aliases.h>
+#include <blaze/math/dispatch/Functions.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/shims/PrevMultiple.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/ParallelReduce.h>
 #include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
 #include <blaze/math/typetraits/HasSIMDAdd.h>
 #include <blaze/math/typetraits/HasSIMDMult.h>
+#include <blaze/math/typetraits/IsContiguous.h>
+#include <blaze/math/typetraits/IsDispatchCompatible.h>
 #include <blaze/math/typetraits/IsPadded.h>
 #include <blaze/math/typetraits/IsSIMDCombinable.h>
+#include <blaze/system/Blocking.h>
 #include <blaze/system/MacroDisable.h>
 #include <blaze/system/Optimizations.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Min.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsSame.h>
 #include <blaze/util/typetraits/RemoveReference.h>
 
 
@@ -93,6 +102,16 @@ struct DVecDVecInnerExprHelper
         HasSIMDAdd_v< ElementType_t<CT1>, ElementType_t<CT1> > &&
         HasSIMDMult_v< ElementType_t<CT1>, ElementType_t<CT1> > );
    //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Compilation switch for the runtime dispatched inner product kernel.
+   static constexpr bool dispatch =
+      ( BLAZE_RUNTIME_DISPATCH_MODE && value &&
+        IsContiguous_v<CT1> && HasConstDataAccess_v<CT1> &&
+        IsContiguous_v<CT2> && HasConstDataAccess_v<CT2> &&
+        IsDispatchCompatible_v< ElementType_t<CT1> > &&
+        IsSame_v< ElementType_t<CT1>, ElementType_t<CT2> > );
+   //**********************************************************************************************
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -108,21 +127,25 @@ struct DVecDVecInnerExprHelper
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Default backend implementation of the scalar product (inner product) of two dense
-//        vectors (\f$ s=\vec{a}*\vec{b} \f$).
+/*!\brief Default backend implementation of the scalar product (inner product) of a range of two
+//        dense vectors (\f$ s=\vec{a}*\vec{b} \f$).
 // \ingroup dense_vector
 //
 // \param lhs The left-hand side dense vector for the inner product.
 // \param rhs The right-hand side dense vector for the inner product.
-// \return The scalar product.
+// \param begin The index of the first element of the range.
+// \param end The index one past the last element of the range.
+// \return The scalar product of the given range.
 //
-// This function implements the performance optimized scalar product of two dense vectors.
-// Due to the explicit application of the SFINAE principle, this function can only be selected
-// by the compiler in case vectorization cannot be applied.
+// This function implements the performance optimized scalar product of the non-empty range
+// \f$ [begin..end) \f$ of two dense vectors. Due to the explicit application of the SFINAE
+// principle, this function can only be selected by the compiler in case vectorization cannot
+// be applied.
 */
 template< typename VT1    // Type of the left-hand side dense vector
         , typename VT2 >  // Type of the right-hand side dense vector
-inline auto dvecdvecinner( const DenseVector<VT1,true>& lhs, const DenseVector<VT2,false>& rhs )
+inline auto dvecdvecinner( const DenseVector<VT1,true>& lhs, const DenseVector<VT2,false>& rhs,
+                           size_t begin, size_t end )
    -> DisableIf_t< DVecDVecInnerExprHelper<VT1,VT2>::value
                  , const MultTrait_t< ElementType_t<VT1>, ElementType_t<VT2> > >
 {
@@ -133,26 +156,25 @@ inline auto dvecdvecinner( const DenseVector<VT1,true>& lhs, const DenseVector<V
    using MultType = MultTrait_t<ET1,ET2>;
 
    BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
-
-   if( (~lhs).size() == 0UL ) return MultType();
+   BLAZE_INTERNAL_ASSERT( begin < end && end <= (~lhs).size(), "Invalid index range" );
 
    CT1 left ( ~lhs );
    CT2 right( ~rhs );
 
-   MultType sp( left[0UL] * right[0UL] );
-   size_t i( 1UL );
+   MultType sp( left[begin] * right[begin] );
+   size_t i( begin+1UL );
 
-   for( ; (i+4UL) <= left.size(); i+=4UL ) {
+   for( ; (i+4UL) <= end; i+=4UL ) {
       sp += left[i    ] * right[i    ] +
             left[i+1UL] * right[i+1UL] +
             left[i+2UL] * right[i+2UL] +
             left[i+3UL] * right[i+3UL];
    }
-   for( ; (i+2UL) <= left.size(); i+=2UL ) {
+   for( ; (i+2UL) <= end; i+=2UL ) {
       sp += left[i    ] * right[i    ] +
             left[i+1UL] * right[i+1UL];
    }
-   for( ; i<left.size(); ++i ) {
+   for( ; i<end; ++i ) {
       sp += left[i] * right[i];
    }
 
@@ -164,22 +186,27 @@ inline auto dvecdvecinner( const DenseVector<VT1,true>& lhs, const DenseVector<V
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief SIMD optimized backend implementation of the scalar product (inner product) of two
-//        dense vectors (\f$ s=\vec{a}*\vec{b} \f$).
+/*!\brief SIMD optimized backend implementation of the scalar product (inner product) of a range
+//        of two dense vectors (\f$ s=\vec{a}*\vec{b} \f$).
 // \ingroup dense_vector
 //
 // \param lhs The left-hand side dense vector for the inner product.
 // \param rhs The right-hand side dense vector for the inner product.
-// \return The scalar product.
+// \param begin The index of the first element of the range.
+// \param end The index one past the last element of the range.
+// \return The scalar product of the given range.
 //
-// This function implements the performance optimized scalar product of two dense vectors.
-// Due to the explicit application of the SFINAE principle, this function can only be selected
-// by the compiler in case vectorization can be applied.
+// This function implements the performance optimized scalar product of the non-empty range
+// \f$ [begin..end) \f$ of two dense vectors. The index \a begin is required to be a multiple
+// of the SIMD size. Due to the explicit application of the SFINAE principle, this function
+// can only be selected by the compiler in case vectorization can be applied.
 */
 template< typename VT1    // Type of the left-hand side dense vector
         , typename VT2 >  // Type of the right-hand side dense vector
-inline auto dvecdvecinner( const DenseVector<VT1,true>& lhs, const DenseVector<VT2,false>& rhs )
-   -> EnableIf_t< DVecDVecInnerExprHelper<VT1,VT2>::value
+inline auto dvecdvecinner( const DenseVector<VT1,true>& lhs, const DenseVector<VT2,false>& rhs,
+                           size_t begin, size_t end )
+   -> EnableIf_t< DVecDVecInnerExprHelper<VT1,VT2>::value &&
+                  !DVecDVecInnerExprHelper<VT1,VT2>::dispatch
                 , const MultTrait_t< ElementType_t<VT1>, ElementType_t<VT2> > >
 {
    using CT1      = CompositeType_t<VT1>;
@@ -190,23 +217,21 @@ inline auto dvecdvecinner( const DenseVector<VT1,true>& lhs, const DenseVector<V
    using ET2      = ElementType_t<VT2>;
    using MultType = MultTrait_t<ET1,ET2>;
 
-   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
+   constexpr size_t SIMDSIZE = SIMDTrait<MultType>::size;
+   constexpr bool remainder( !IsPadded_v<XT1> || !IsPadded_v<XT2> );
 
-   if( (~lhs).size() == 0UL ) return MultType();
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
+   BLAZE_INTERNAL_ASSERT( begin < end && end <= (~lhs).size(), "Invalid index range" );
+   BLAZE_INTERNAL_ASSERT( begin % SIMDSIZE == 0UL, "Invalid range alignment" );
 
    CT1 left ( ~lhs );
    CT2 right( ~rhs );
 
-   constexpr size_t SIMDSIZE = SIMDTrait<MultType>::size;
-   constexpr bool remainder( !IsPadded_v<XT1> || !IsPadded_v<XT2> );
-
-   const size_t N( left.size() );
-
-   const size_t ipos( remainder ? prevMultiple( N, SIMDSIZE ): N );
-   BLAZE_INTERNAL_ASSERT( ipos <= N, "Invalid end calculation" );
+   const size_t ipos( remainder ? begin + prevMultiple( end-begin, SIMDSIZE ) : end );
+   BLAZE_INTERNAL_ASSERT( ipos <= end, "Invalid end calculation" );
 
    SIMDTrait_t<MultType> xmm1, xmm2, xmm3, xmm4;
-   size_t i( 0UL );
+   size_t i( begin );
 
    for( ; (i+SIMDSIZE*3UL) < ipos; i+=SIMDSIZE*4UL ) {
       xmm1 = xmm1 + ( left.load(i             ) * right.load(i             ) );
@@ -224,7 +249,7 @@ inline auto dvecdvecinner( const DenseVector<VT1,true>& lhs, const DenseVector<V
 
    MultType sp( sum( xmm1 + xmm2 + xmm3 + xmm4 ) );
 
-   for( ; remainder && i<N; ++i ) {
+   for( ; remainder && i<end; ++i ) {
       sp += left[i] * right[i];
    }
 
@@ -234,6 +259,103 @@ inline auto dvecdvecinner( const DenseVector<VT1,true>& lhs, const DenseVector<V
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+#if BLAZE_RUNTIME_DISPATCH_MODE
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Runtime dispatched backend implementation of the scalar product (inner product) of a
+//        range of two dense vectors (\f$ s=\vec{a}*\vec{b} \f$).
+// \ingroup dense_vector
+//
+// \param lhs The left-hand side dense vector for the inner product.
+// \param rhs The right-hand side dense vector for the inner product.
+// \param begin The index of the first element of the range.
+// \param end The index one past the last element of the range.
+// \return The scalar product of the given range.
+//
+// This function implements the scalar product of the non-empty range \f$ [begin..end) \f$ of
+// two contiguous dense vectors by means of the kernel of the instruction set selected at runtime
+// (see BLAZE_USE_RUNTIME_DISPATCH). Due to the explicit application of the SFINAE principle,
+// this function can only be selected by the compiler in case the runtime dispatch is active.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename VT2 >  // Type of the right-hand side dense vector
+inline auto dvecdvecinner( const DenseVector<VT1,true>& lhs, const DenseVector<VT2,false>& rhs,
+                           size_t begin, size_t end )
+   -> EnableIf_t< DVecDVecInnerExprHelper<VT1,VT2>::dispatch
+                , const MultTrait_t< ElementType_t<VT1>, ElementType_t<VT2> > >
+{
+   using CT1 = CompositeType_t<VT1>;
+   using CT2 = CompositeType_t<VT2>;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
+   BLAZE_INTERNAL_ASSERT( begin < end && end <= (~lhs).size(), "Invalid index range" );
+
+   CT1 left ( ~lhs );
+   CT2 right( ~rhs );
+
+   return dispatchDot( left, right, begin, end );
+}
+/*! \endcond */
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the scalar product (inner product) of two dense vectors
+//        (\f$ s=\vec{a}*\vec{b} \f$).
+// \ingroup dense_vector
+//
+// \param lhs The left-hand side dense vector for the inner product.
+// \param rhs The right-hand side dense vector for the inner product.
+// \return The scalar product.
+//
+// In case the size of the vectors is smaller than the SMP dense vector/dense vector inner
+// product threshold, the scalar product is computed in a single pass. Otherwise the vectors
+// are split into blocks of fixed size, the blocks are processed in parallel and the partial
+// results are combined in a fixed order (see smpReduce()). Thus the result does not depend
+// on the number of threads.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename VT2 >  // Type of the right-hand side dense vector
+inline const MultTrait_t< ElementType_t<VT1>, ElementType_t<VT2> >
+   dvecdvecinner( const DenseVector<VT1,true>& lhs, const DenseVector<VT2,false>& rhs )
+{
+   using CT1      = CompositeType_t<VT1>;
+   using CT2      = CompositeType_t<VT2>;
+   using ET1      = ElementType_t<VT1>;
+   using ET2      = ElementType_t<VT2>;
+   using MultType = MultTrait_t<ET1,ET2>;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
+
+   const size_t N( (~lhs).size() );
+
+   if( N == 0UL ) return MultType();
+
+   CT1 left ( ~lhs );
+   CT2 right( ~rhs );
+
+   if( N < SMP_DVECDVECINNER_THRESHOLD ) {
+      return dvecdvecinner( left, right, 0UL, N );
+   }
+
+   const size_t blocks( ( N - 1UL ) / REDUCTION_BLOCK_SIZE + 1UL );
+   const bool parallel( canSMPReduce( ~lhs ) && canSMPReduce( ~rhs ) );
+
+   const auto block = [&left,&right,N]( size_t b ) {
+      const size_t begin( b*REDUCTION_BLOCK_SIZE );
+      return dvecdvecinner( left, right, begin, min( begin+REDUCTION_BLOCK_SIZE, N ) );
+   };
+
+   const auto add = []( const MultType& a, const MultType& b ) { return a + b; };
+
+   return smpReduce<MultType>( blocks, parallel, block, add );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Multiplication operator for the scalar product (inner product) of two dense vectors
 //        (\f$ s=\vec{a}*\vec{b} \f$).
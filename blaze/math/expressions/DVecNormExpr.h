@@ -44,6 +44,7 @@
 #include <blaze/math/Aliases.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/functors/Abs.h>
+#include <blaze/math/functors/Add.h>
 #include <blaze/math/functors/Bind2nd.h>
 #include <blaze/math/functors/Cbrt.h>
 #include <blaze/math/functors/L1Norm.h>
@@ -63,13 +64,16 @@
 #include <blaze/math/shims/IsZero.h>
 #include <blaze/math/shims/PrevMultiple.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/ParallelReduce.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/typetraits/HasLoad.h>
 #include <blaze/math/typetraits/HasSIMDAdd.h>
 #include <blaze/math/typetraits/IsPadded.h>
 #include <blaze/math/typetraits/IsSIMDEnabled.h>
 #include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/system/Blocking.h>
 #include <blaze/system/Optimizations.h>
+#include <blaze/system/Thresholds.h>
 #include <blaze/util/algorithms/Min.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/FunctionTrace.h>
@@ -133,51 +137,50 @@ struct DVecNormHelper
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Default backend implementation of the norm of a dense vector.
+/*!\brief Default backend implementation of the norm of a range of a dense vector.
 // \ingroup dense_vector
 //
 // \param dv The given dense vector for the norm computation.
+// \param begin The index of the first element of the range.
+// \param end The index one past the last element of the range.
 // \param abs The functor for the abs operation.
 // \param power The functor for the power operation.
-// \param root The functor for the root operation.
-// \return The norm of the given vector.
+// \return The sum of the powers of the absolute values of the given range.
 //
-// This function implements the performance optimized norm of a dense vector. Due to the
+// This function implements the performance optimized norm of the non-empty range
+// \f$ [begin..end) \f$ of a dense vector (without the final root operation). Due to the
 // explicit application of the SFINAE principle, this function can only be selected by the
 // compiler in case vectorization cannot be applied.
 */
-template< typename VT      // Type of the dense vector
-        , bool TF          // Transpose flag
-        , typename Abs     // Type of the abs operation
-        , typename Power   // Type of the power operation
-        , typename Root >  // Type of the root operation
-inline decltype(auto) norm_backend( const DenseVector<VT,TF>& dv, Abs abs, Power power, Root root, FalseType )
+template< typename VT       // Type of the dense vector
+        , bool TF           // Transpose flag
+        , typename Abs      // Type of the abs operation
+        , typename Power >  // Type of the power operation
+inline ElementType_t<VT>
+   dvecnorm( const DenseVector<VT,TF>& dv, size_t begin, size_t end, Abs abs, Power power, FalseType )
 {
    using CT = CompositeType_t<VT>;
    using ET = ElementType_t<VT>;
-   using RT = decltype( evaluate( root( std::declval<ET>() ) ) );
 
-   if( (~dv).size() == 0UL ) return RT();
+   BLAZE_INTERNAL_ASSERT( begin < end && end <= (~dv).size(), "Invalid index range" );
 
    CT tmp( ~dv );
 
-   const size_t N( tmp.size() );
+   ET norm( power( abs( tmp[begin] ) ) );
+   size_t i( begin+1UL );
 
-   ET norm( power( abs( tmp[0UL] ) ) );
-   size_t i( 1UL );
-
-   for( ; (i+4UL) <= N; i+=4UL ) {
+   for( ; (i+4UL) <= end; i+=4UL ) {
       norm += power( abs( tmp[i    ] ) ) + power( abs( tmp[i+1UL] ) ) +
               power( abs( tmp[i+2UL] ) ) + power( abs( tmp[i+3UL] ) );
    }
-   for( ; (i+2UL) <= N; i+=2UL ) {
+   for( ; (i+2UL) <= end; i+=2UL ) {
       norm += power( abs( tmp[i] ) ) + power( abs( tmp[i+1UL] ) );
    }
-   for( ; i<N; ++i ) {
+   for( ; i<end; ++i ) {
       norm += power( abs( tmp[i] ) );
    }
 
-   return evaluate( root( norm ) );
+   return norm;
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -185,45 +188,46 @@ inline decltype(auto) norm_backend( const DenseVector<VT,TF>& dv, Abs abs, Power
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief SIMD optimized backend implementation of the norm of a dense vector.
+/*!\brief SIMD optimized backend implementation of the norm of a range of a dense vector.
 // \ingroup dense_vector
 //
 // \param dv The given dense vector for the norm computation.
+// \param begin The index of the first element of the range.
+// \param end The index one past the last element of the range.
 // \param abs The functor for the abs operation.
 // \param power The functor for the power operation.
-// \param root The functor for the root operation.
-// \return The norm of the given vector.
+// \return The sum of the powers of the absolute values of the given range.
 //
-// This function implements the performance optimized norm of a dense vector. Due to the
-// explicit application of the SFINAE principle, this function can only be selected by the
-// compiler in case vectorization can be applied.
+// This function implements the performance optimized norm of the non-empty range
+// \f$ [begin..end) \f$ of a dense vector (without the final root operation). The index \a begin
+// is required to be a multiple of the SIMD size. Due to the explicit application of the SFINAE
+// principle, this function can only be selected by the compiler in case vectorization can be
+// applied.
 */
-template< typename VT      // Type of the dense vector
-        , bool TF          // Transpose flag
-        , typename Abs     // Type of the abs operation
-        , typename Power   // Type of the power operation
-        , typename Root >  // Type of the root operation
-inline decltype(auto) norm_backend( const DenseVector<VT,TF>& dv, Abs abs, Power power, Root root, TrueType )
+template< typename VT       // Type of the dense vector
+        , bool TF           // Transpose flag
+        , typename Abs      // Type of the abs operation
+        , typename Power >  // Type of the power operation
+inline ElementType_t<VT>
+   dvecnorm( const DenseVector<VT,TF>& dv, size_t begin, size_t end, Abs abs, Power power, TrueType )
 {
    using CT = CompositeType_t<VT>;
    using ET = ElementType_t<VT>;
-   using RT = decltype( evaluate( root( std::declval<ET>() ) ) );
 
    static constexpr size_t SIMDSIZE = SIMDTrait<ET>::size;
 
-   if( (~dv).size() == 0UL ) return RT();
+   BLAZE_INTERNAL_ASSERT( begin < end && end <= (~dv).size(), "Invalid index range" );
+   BLAZE_INTERNAL_ASSERT( begin % SIMDSIZE == 0UL, "Invalid range alignment" );
 
    CT tmp( ~dv );
 
-   const size_t N( tmp.size() );
-
    constexpr bool remainder( !IsPadded_v< RemoveReference_t<VT> > );
 
-   const size_t ipos( remainder ? prevMultiple( N, SIMDSIZE ) : N );
-   BLAZE_INTERNAL_ASSERT( ipos <= N, "Invalid end calculation" );
+   const size_t ipos( remainder ? begin + prevMultiple( end-begin, SIMDSIZE ) : end );
+   BLAZE_INTERNAL_ASSERT( ipos <= end, "Invalid end calculation" );
 
    SIMDTrait_t<ET> xmm1, xmm2, xmm3, xmm4;
-   size_t i( 0UL );
+   size_t i( begin );
 
    for( ; (i+SIMDSIZE*3UL) < ipos; i+=SIMDSIZE*4UL ) {
       xmm1 += power( abs( tmp.load(i             ) ) );
@@ -241,11 +245,11 @@ inline decltype(auto) norm_backend( const DenseVector<VT,TF>& dv, Abs abs, Power
 
    ET norm( sum( xmm1 + xmm2 + xmm3 + xmm4 ) );
 
-   for( ; remainder && i<N; ++i ) {
+   for( ; remainder && i<end; ++i ) {
       norm += power( abs( tmp[i] ) );
    }
 
-   return evaluate( root( norm ) );
+   return norm;
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -271,6 +275,12 @@ inline decltype(auto) norm_backend( const DenseVector<VT,TF>& dv, Abs abs, Power
    // ... Resizing and initialization
    const double l2 = norm( a, blaze::Noop(), blaze::Pow2(), blaze::Sqrt() );
    \endcode
+
+// In case the size of the vector is larger or equal to the SMP dense vector reduction threshold
+// (see the BLAZE_SMP_DVECREDUCE_THRESHOLD configuration), the vector is split into blocks of
+// fixed size, the blocks are processed in parallel and the partial results are combined in a
+// fixed order (see smpReduce()). Thus for a given threshold the result does not depend on the
+// number of threads.
 */
 template< typename VT      // Type of the dense vector
         , bool TF          // Transpose flag
@@ -279,7 +289,32 @@ template< typename VT      // Type of the dense vector
         , typename Root >  // Type of the root operation
 inline decltype(auto) norm_backend( const DenseVector<VT,TF>& dv, Abs abs, Power power, Root root )
 {
-   return norm_backend( ~dv, abs, power, root, Bool_t< DVecNormHelper<VT,Abs,Power>::value >() );
+   using CT = CompositeType_t<VT>;
+   using ET = ElementType_t<VT>;
+   using RT = decltype( evaluate( root( std::declval<ET>() ) ) );
+
+   using Vectorized = Bool_t< DVecNormHelper<VT,Abs,Power>::value >;
+
+   const size_t N( (~dv).size() );
+
+   if( N == 0UL ) return RT();
+
+   CT tmp( ~dv );
+
+   BLAZE_INTERNAL_ASSERT( tmp.size() == N, "Invalid vector size" );
+
+   if( N < SMP_DVECREDUCE_THRESHOLD ) {
+      return evaluate( root( dvecnorm( tmp, 0UL, N, abs, power, Vectorized() ) ) );
+   }
+
+   const size_t blocks( ( N - 1UL ) / REDUCTION_BLOCK_SIZE + 1UL );
+
+   const auto block = [&tmp,&abs,&power,N]( size_t b ) {
+      const size_t begin( b*REDUCTION_BLOCK_SIZE );
+      return dvecnorm( tmp, begin, min( begin+REDUCTION_BLOCK_SIZE, N ), abs, power, Vectorized() );
+   };
+
+   return evaluate( root( smpReduce<ET>( blocks, canSMPReduce( ~dv ), block, Add() ) ) );
 }
 /*! \endcond */
 //*************************************************************************************************
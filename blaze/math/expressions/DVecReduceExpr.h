@@ -41,6 +41,7 @@
 //*************************************************************************************************
 
 #include <blaze/math/Aliases.h>
+#include <blaze/math/dispatch/Functions.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/functors/Add.h>
 #include <blaze/math/functors/Max.h>
@@ -48,15 +49,24 @@
 #include <blaze/math/functors/Mult.h>
 #include <blaze/math/shims/PrevMultiple.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/ParallelReduce.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
 #include <blaze/math/typetraits/HasLoad.h>
+#include <blaze/math/typetraits/IsContiguous.h>
+#include <blaze/math/typetraits/IsDispatchCompatible.h>
 #include <blaze/math/typetraits/IsPadded.h>
 #include <blaze/math/typetraits/IsSIMDEnabled.h>
 #include <blaze/math/typetraits/IsUniform.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Min.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/typetraits/AlignmentOf.h>
 #include <blaze/util/typetraits/HasMember.h>
+#include <blaze/util/typetraits/IsSame.h>
 #include <blaze/util/typetraits/RemoveReference.h>
 
 
@@ -90,6 +100,13 @@ struct DVecReduceExprHelper
       ( CT::simdEnabled &&
         If_t< HasSIMDEnabled_v<OP>, GetSIMDEnabled<OP,ET,ET>, HasLoad<OP> >::value );
    //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Compilation switch for the runtime dispatched summation kernel.
+   static constexpr bool dispatch =
+      ( BLAZE_RUNTIME_DISPATCH_MODE && value && IsSame_v<OP,Add> &&
+        IsContiguous_v<CT> && HasConstDataAccess_v<CT> && IsDispatchCompatible_v<ET> );
+   //**********************************************************************************************
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -105,48 +122,48 @@ struct DVecReduceExprHelper
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Default backend implementation of the reduction of a dense vector.
+/*!\brief Default backend implementation of the reduction of a range of a dense vector.
 // \ingroup dense_vector
 //
 // \param dv The given dense vector for the reduction computation.
+// \param begin The index of the first element of the range.
+// \param end The index one past the last element of the range.
 // \param op The reduction operation.
 // \return The result of the reduction operation.
 //
-// This function implements the performance optimized reduction operation for a dense vector. Due
-// to the explicit application of the SFINAE principle, this function can only be selected by the
-// compiler in case vectorization cannot be applied.
+// This function implements the performance optimized reduction operation for the non-empty
+// range \f$ [begin..end) \f$ of a dense vector. Due to the explicit application of the SFINAE
+// principle, this function can only be selected by the compiler in case vectorization cannot
+// be applied.
 */
 template< typename VT    // Type of the dense vector
         , bool TF        // Transpose flag
         , typename OP >  // Type of the reduction operation
-inline auto dvecreduce( const DenseVector<VT,TF>& dv, OP op )
+inline auto dvecreduce( const DenseVector<VT,TF>& dv, size_t begin, size_t end, OP op )
    -> DisableIf_t< DVecReduceExprHelper<VT,OP>::value, ElementType_t<VT> >
 {
    using CT = CompositeType_t<VT>;
    using ET = ElementType_t<VT>;
 
-   const size_t N( (~dv).size() );
+   BLAZE_INTERNAL_ASSERT( begin < end && end <= (~dv).size(), "Invalid index range" );
 
-   if( N == 0UL ) return ET{};
-   if( N == 1UL ) return (~dv)[0UL];
+   if( begin+1UL == end ) return (~dv)[begin];
 
    CT tmp( ~dv );
 
-   BLAZE_INTERNAL_ASSERT( tmp.size() == N, "Invalid vector size" );
-
-   ET redux1( tmp[0UL] );
-   ET redux2( tmp[1UL] );
-   size_t i( 2UL );
+   ET redux1( tmp[begin    ] );
+   ET redux2( tmp[begin+1UL] );
+   size_t i( begin+2UL );
 
-   for( ; (i+4UL) <= N; i+=4UL ) {
+   for( ; (i+4UL) <= end; i+=4UL ) {
       redux1 = op( op( redux1, tmp[i    ] ), tmp[i+1UL] );
       redux2 = op( op( redux2, tmp[i+2UL] ), tmp[i+3UL] );
    }
-   for( ; (i+2UL) <= N; i+=2UL ) {
+   for( ; (i+2UL) <= end; i+=2UL ) {
       redux1 = op( redux1, tmp[i    ] );
       redux2 = op( redux2, tmp[i+1UL] );
    }
-   for( ; i<N; ++i ) {
+   for( ; i<end; ++i ) {
       redux1 = op( redux1, tmp[i] );
    }
 
@@ -158,49 +175,51 @@ inline auto dvecreduce( const DenseVector<VT,TF>& dv, OP op )
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief SIMD optimized backend implementation of the reduction of a dense vector.
+/*!\brief SIMD optimized backend implementation of the reduction of a range of a dense vector.
 // \ingroup dense_vector
 //
 // \param dv The given dense vector for the reduction computation.
+// \param begin The index of the first element of the range.
+// \param end The index one past the last element of the range.
 // \param op The reduction operation.
 // \return The result of the reduction operation.
 //
-// This function implements the performance optimized reduction operation for a dense vector. Due
-// to the explicit application of the SFINAE principle, this function can only be selected by the
-// compiler in case vectorization can be applied.
+// This function implements the performance optimized reduction operation for the non-empty
+// range \f$ [begin..end) \f$ of a dense vector. The index \a begin is required to be a multiple
+// of the SIMD size. Due to the explicit application of the SFINAE principle, this function can
+// only be selected by the compiler in case vectorization can be applied.
 */
 template< typename VT    // Type of the dense vector
         , bool TF        // Transpose flag
         , typename OP >  // Type of the reduction operation
-inline auto dvecreduce( const DenseVector<VT,TF>& dv, OP op )
+inline auto dvecreduce( const DenseVector<VT,TF>& dv, size_t begin, size_t end, OP op )
    -> EnableIf_t< DVecReduceExprHelper<VT,OP>::value, ElementType_t<VT> >
 {
    using CT = CompositeType_t<VT>;
    using ET = ElementType_t<VT>;
 
-   const size_t N( (~dv).size() );
+   constexpr size_t SIMDSIZE = SIMDTrait<ET>::size;
 
-   if( N == 0UL ) return ET{};
+   BLAZE_INTERNAL_ASSERT( begin < end && end <= (~dv).size(), "Invalid index range" );
+   BLAZE_INTERNAL_ASSERT( begin % SIMDSIZE == 0UL, "Invalid range alignment" );
 
    CT tmp( ~dv );
 
-   BLAZE_INTERNAL_ASSERT( tmp.size() == N, "Invalid vector size" );
-
-   constexpr size_t SIMDSIZE = SIMDTrait<ET>::size;
+   const size_t n( end - begin );
 
    ET redux{};
 
-   if( N >= SIMDSIZE )
+   if( n >= SIMDSIZE )
    {
-      const size_t ipos( prevMultiple( N, SIMDSIZE ) );
-      BLAZE_INTERNAL_ASSERT( ipos <= N, "Invalid end calculation" );
+      const size_t ipos( begin + prevMultiple( n, SIMDSIZE ) );
+      BLAZE_INTERNAL_ASSERT( ipos <= end, "Invalid end calculation" );
 
-      SIMDTrait_t<ET> xmm1( tmp.load(0UL) );
+      SIMDTrait_t<ET> xmm1( tmp.load(begin) );
 
-      if( N >= SIMDSIZE*2UL )
+      if( n >= SIMDSIZE*2UL )
       {
-         SIMDTrait_t<ET> xmm2( tmp.load(SIMDSIZE) );
-         size_t i( SIMDSIZE*2UL );
+         SIMDTrait_t<ET> xmm2( tmp.load(begin+SIMDSIZE) );
+         size_t i( begin+SIMDSIZE*2UL );
 
          for( ; (i+SIMDSIZE) < ipos; i+=SIMDSIZE*2UL ) {
             xmm1 = op( xmm1, tmp.load(i         ) );
@@ -215,13 +234,13 @@ inline auto dvecreduce( const DenseVector<VT,TF>& dv, OP op )
 
       redux = reduce( xmm1, op );
 
-      for( size_t i=ipos; i<N; ++i ) {
+      for( size_t i=ipos; i<end; ++i ) {
          redux = op( redux, tmp[i] );
       }
    }
    else {
-      redux = tmp[0UL];
-      for( size_t i=1UL; i<N; ++i ) {
+      redux = tmp[begin];
+      for( size_t i=begin+1UL; i<end; ++i ) {
          redux = op( redux, tmp[i] );
       }
    }
@@ -234,74 +253,162 @@ inline auto dvecreduce( const DenseVector<VT,TF>& dv, OP op )
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief SIMD optimized backend implementation of the summation of a dense vector.
+/*!\brief SIMD optimized backend implementation of the summation of a range of a dense vector.
 // \ingroup dense_vector
 //
 // \param dv The given dense vector for the summation.
+// \param begin The index of the first element of the range.
+// \param end The index one past the last element of the range.
 // \return The result of the summation.
 //
-// This function implements the performance optimized summation for a dense vector. Due to
-// the explicit application of the SFINAE principle, this function can only be selected by
-// the compiler in case vectorization can be applied.
+// This function implements the performance optimized summation for the non-empty range
+// \f$ [begin..end) \f$ of a dense vector. The index \a begin is required to be a multiple of
+// the SIMD size. In case the vector is not padded, the trailing elements of the range are
+// loaded as a zero-padded SIMD vector. Thus the summation performs exactly the same operations
+// as for a padded vector, i.e. the result doesn't depend on the padding of the operand (as for
+// instance for an unaligned subvector and its evaluation into a temporary vector). Due to the
+// explicit application of the SFINAE principle, this function can only be selected by the
+// compiler in case vectorization can be applied.
 */
 template< typename VT  // Type of the dense vector
         , bool TF >    // Transpose flag
-inline auto dvecreduce( const DenseVector<VT,TF>& dv, Add /*op*/ )
-   -> EnableIf_t< DVecReduceExprHelper<VT,Add>::value, ElementType_t<VT> >
+inline auto dvecreduce( const DenseVector<VT,TF>& dv, size_t begin, size_t end, Add /*op*/ )
+   -> EnableIf_t< DVecReduceExprHelper<VT,Add>::value &&
+                  !DVecReduceExprHelper<VT,Add>::dispatch, ElementType_t<VT> >
 {
    using CT = CompositeType_t<VT>;
    using ET = ElementType_t<VT>;
 
-   const size_t N( (~dv).size() );
+   constexpr bool remainder( !IsPadded_v< RemoveReference_t<CT> > );
+   constexpr size_t SIMDSIZE = SIMDTrait<ET>::size;
 
-   if( N == 0UL ) return ET{};
+   BLAZE_INTERNAL_ASSERT( begin < end && end <= (~dv).size(), "Invalid index range" );
+   BLAZE_INTERNAL_ASSERT( begin % SIMDSIZE == 0UL, "Invalid range alignment" );
 
    CT tmp( ~dv );
 
-   BLAZE_INTERNAL_ASSERT( tmp.size() == N, "Invalid vector size" );
-
-   constexpr bool remainder( !IsPadded_v< RemoveReference_t<CT> > );
-   constexpr size_t SIMDSIZE = SIMDTrait<ET>::size;
-
-   ET redux{};
+   const size_t n( end - begin );
+   const size_t ipos( remainder ? begin + prevMultiple( n, SIMDSIZE ) : end );
+   BLAZE_INTERNAL_ASSERT( ipos <= end, "Invalid end calculation" );
 
-   if( !remainder || N >= SIMDSIZE )
+   const auto load = [&tmp,ipos,end]( size_t i ) -> SIMDTrait_t<ET>
    {
-      const size_t ipos( remainder ? prevMultiple( N, SIMDSIZE ) : N );
-      BLAZE_INTERNAL_ASSERT( ipos <= N, "Invalid end calculation" );
+      if( !remainder || i < ipos ) {
+         return tmp.load(i);
+      }
 
-      SIMDTrait_t<ET> xmm1( tmp.load(0UL) );
+      alignas( AlignmentOf_v<ET> ) ET array[SIMDSIZE] = {};
 
-      if( remainder ? N >= SIMDSIZE*2UL : N > SIMDSIZE )
-      {
-         SIMDTrait_t<ET> xmm2( tmp.load(SIMDSIZE) );
-         size_t i( SIMDSIZE*2UL );
+      for( size_t k=i; k<end; ++k ) {
+         array[k-i] = tmp[k];
+      }
 
-         for( ; (i+SIMDSIZE) < ipos; i+=SIMDSIZE*2UL ) {
-            xmm1 += tmp.load(i         );
-            xmm2 += tmp.load(i+SIMDSIZE);
-         }
-         for( ; i<ipos; i+=SIMDSIZE ) {
-            xmm1 += tmp.load(i);
-         }
+      return loada( array );
+   };
 
-         xmm1 += xmm2;
-      }
+   SIMDTrait_t<ET> xmm1( load(begin) );
 
-      redux = sum( xmm1 );
+   if( n > SIMDSIZE )
+   {
+      SIMDTrait_t<ET> xmm2( load(begin+SIMDSIZE) );
+      size_t i( begin+SIMDSIZE*2UL );
 
-      for( size_t i=ipos; remainder && i<N; ++i ) {
-         redux += tmp[i];
+      for( ; (i+SIMDSIZE) < end; i+=SIMDSIZE*2UL ) {
+         xmm1 += load(i         );
+         xmm2 += load(i+SIMDSIZE);
       }
-   }
-   else {
-      redux = tmp[0UL];
-      for( size_t i=1UL; i<N; ++i ) {
-         redux += tmp[i];
+      for( ; i<end; i+=SIMDSIZE ) {
+         xmm1 += load(i);
       }
+
+      xmm1 += xmm2;
    }
 
-   return redux;
+   return sum( xmm1 );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+#if BLAZE_RUNTIME_DISPATCH_MODE
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Runtime dispatched backend implementation of the summation of a range of a dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector for the summation.
+// \param begin The index of the first element of the range.
+// \param end The index one past the last element of the range.
+// \return The result of the summation.
+//
+// This function implements the summation for the non-empty range \f$ [begin..end) \f$ of a
+// contiguous dense vector by means of the kernel of the instruction set selected at runtime
+// (see BLAZE_USE_RUNTIME_DISPATCH). Due to the explicit application of the SFINAE principle,
+// this function can only be selected by the compiler in case the runtime dispatch is active.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline auto dvecreduce( const DenseVector<VT,TF>& dv, size_t begin, size_t end, Add /*op*/ )
+   -> EnableIf_t< DVecReduceExprHelper<VT,Add>::dispatch, ElementType_t<VT> >
+{
+   using CT = CompositeType_t<VT>;
+
+   BLAZE_INTERNAL_ASSERT( begin < end && end <= (~dv).size(), "Invalid index range" );
+
+   CT tmp( ~dv );
+
+   return dispatchSum( tmp, begin, end );
+}
+/*! \endcond */
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the reduction of a dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector for the reduction computation.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function reduces the given dense vector by means of the range kernels. In case the size
+// of the vector is larger or equal to the SMP dense vector reduction threshold (see the
+// BLAZE_SMP_DVECREDUCE_THRESHOLD configuration), the vector is split into blocks of fixed size
+// (see REDUCTION_BLOCK_SIZE), the blocks are reduced in parallel and the partial results are
+// combined in a fixed order (see smpReduce()). Thus for a given threshold the result does not
+// depend on the number of threads.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the reduction operation
+inline ElementType_t<VT> dvecreduce( const DenseVector<VT,TF>& dv, OP op )
+{
+   using CT = CompositeType_t<VT>;
+   using ET = ElementType_t<VT>;
+
+   const size_t N( (~dv).size() );
+
+   if( N == 0UL ) return ET{};
+   if( N == 1UL ) return (~dv)[0UL];
+
+   CT tmp( ~dv );
+
+   BLAZE_INTERNAL_ASSERT( tmp.size() == N, "Invalid vector size" );
+
+   if( N < SMP_DVECREDUCE_THRESHOLD ) {
+      return dvecreduce( tmp, 0UL, N, op );
+   }
+
+   const size_t blocks( ( N - 1UL ) / REDUCTION_BLOCK_SIZE + 1UL );
+
+   const auto block = [&tmp,&op,N]( size_t b ) {
+      const size_t begin( b*REDUCTION_BLOCK_SIZE );
+      return dvecreduce( tmp, begin, min( begin+REDUCTION_BLOCK_SIZE, N ), op );
+   };
+
+   return smpReduce<ET>( blocks, canSMPReduce( ~dv ), block, op );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -378,7 +485,9 @@ inline auto dvecreduce( const DenseVector<VT,TF>& dv, Max /*op*/ )
 //
 // Please note that the evaluation order of the reduction operation is unspecified. Thus the
 // behavior is non-deterministic if \a op is not associative or not commutative. Also, the
-// operation is undefined if the given reduction operation modifies the values.
+// operation is undefined if the given reduction operation modifies the values. Large vectors
+// are reduced in parallel (see the BLAZE_SMP_DVECREDUCE_THRESHOLD configuration), but the
+// order of evaluation does not depend on the number of threads.
 */
 template< typename VT    // Type of the dense vector
         , bool TF        // Transpose flag
@@ -40,17 +40,418 @@
 // Includes
 //*************************************************************************************************
 
+#include <limits>
+#include <utility>
+#include <blaze/math/Aliases.h>
 #include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/shims/Exp.h>
+#include <blaze/math/shims/PrevMultiple.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/smp/ParallelReduce.h>
+#include <blaze/math/typetraits/HasSIMDAdd.h>
+#include <blaze/math/typetraits/HasSIMDExp.h>
+#include <blaze/math/typetraits/HasSIMDMax.h>
+#include <blaze/math/typetraits/HasSIMDMult.h>
+#include <blaze/math/typetraits/HasSIMDSub.h>
+#include <blaze/math/typetraits/IsUniform.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/AlignmentOf.h>
+#include <blaze/util/typetraits/IsBuiltin.h>
+#include <blaze/util/typetraits/RemoveCVRef.h>
+#include <blaze/util/typetraits/RemoveReference.h>
 
 
 namespace blaze {
 
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the dense vector softmax function.
+// \ingroup dense_vector
+*/
+template< typename VT >  // Type of the dense vector
+struct DVecSoftmaxHelper
+{
+   //**Type definitions****************************************************************************
+   //! Composite type of the dense vector expression.
+   using CT = RemoveReference_t< CompositeType_t<VT> >;
+
+   //! Element type of the dense vector expression.
+   using ET = ElementType_t<CT>;
+
+   //! Result type of the softmax function.
+   using RT = ResultType_t< decltype( exp( std::declval<VT>() ) ) >;
+
+   //! Type of the normalizer (i.e. the maximum element and the sum of the shifted exponentials).
+   using NT = std::pair< ET, RemoveCVRef_t< decltype( exp( std::declval<ET>() ) ) > >;
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Compilation switch for the fused softmax kernels.
+   static constexpr bool fused = ( IsBuiltin_v<ET> && !IsUniform_v<RT> );
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Compilation switch for the SIMD optimized softmax kernels.
+   static constexpr bool simd =
+      ( useOptimizedKernels &&
+        CT::simdEnabled &&
+        HasSIMDExp_v<ET> &&
+        HasSIMDMax_v<ET,ET> &&
+        HasSIMDSub_v<ET,ET> &&
+        HasSIMDAdd_v<ET,ET> &&
+        HasSIMDMult_v<ET,ET> );
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  GLOBAL FUNCTIONS
 //
 //=================================================================================================
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the given element is negative infinity.
+// \ingroup dense_vector
+//
+// \param x The element to be checked.
+// \return \a true in case the element is negative infinity, \a false if not.
+*/
+template< typename ET >  // Type of the element
+inline bool isSoftmaxNegInf( const ET& x )
+{
+   return std::numeric_limits<ET>::has_infinity && x == -std::numeric_limits<ET>::infinity();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Updates the given softmax normalizer with the given element.
+// \ingroup dense_vector
+//
+// \param norm The normalizer to be updated (maximum element and sum of the shifted exponentials).
+// \param x The next element.
+// \return void
+//
+// This function performs a single step of the online normalizer calculation of the softmax
+// function: In case \a x is larger than the current maximum, the current sum is rescaled to
+// the new maximum. Thus all exponentials are computed for non-positive arguments only. Elements
+// equal to negative infinity don't contribute to the sum and a maximum equal to negative infinity
+// is replaced without rescaling, which avoids the evaluation of \f$ e^{-\infty+\infty} \f$.
+*/
+template< typename ET    // Type of the maximum element
+        , typename ST >  // Type of the sum of the shifted exponentials
+inline void softmaxUpdate( std::pair<ET,ST>& norm, const ET& x )
+{
+   if( norm.first < x ) {
+      norm.second = ( isSoftmaxNegInf( norm.first )
+                      ? ST(1)
+                      : norm.second * exp( norm.first - x ) + ST(1) );
+      norm.first  = x;
+   }
+   else if( !isSoftmaxNegInf( x ) ) {
+      norm.second += exp( x - norm.first );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Combines two softmax normalizers.
+// \ingroup dense_vector
+//
+// \param lhs The left-hand side normalizer.
+// \param rhs The right-hand side normalizer.
+// \return The combined normalizer.
+//
+// A normalizer with a maximum equal to negative infinity doesn't contribute to the combined
+// normalizer.
+*/
+template< typename ET    // Type of the maximum element
+        , typename ST >  // Type of the sum of the shifted exponentials
+inline std::pair<ET,ST> softmaxCombine( const std::pair<ET,ST>& lhs, const std::pair<ET,ST>& rhs )
+{
+   if( isSoftmaxNegInf( rhs.first ) ) {
+      return lhs;
+   }
+   else if( isSoftmaxNegInf( lhs.first ) ) {
+      return rhs;
+   }
+   else if( lhs.first < rhs.first ) {
+      return { rhs.first, lhs.second * exp( lhs.first - rhs.first ) + rhs.second };
+   }
+   else {
+      return { lhs.first, lhs.second + rhs.second * exp( rhs.first - lhs.first ) };
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default backend implementation of the softmax normalizer of a range of a dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector.
+// \param begin The index of the first element of the range.
+// \param end The index one past the last element of the range.
+// \return The maximum element and the sum of the shifted exponentials of the range.
+//
+// This function computes the maximum element \f$ m \f$ and the sum \f$ \sum e^{x_i-m} \f$ of
+// the non-empty range \f$ [begin..end) \f$ of a dense vector in a single pass. Due to the
+// explicit application of the SFINAE principle, this function can only be selected by the
+// compiler in case vectorization cannot be applied.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline auto dvecsoftmax( const DenseVector<VT,TF>& dv, size_t begin, size_t end )
+   -> DisableIf_t< DVecSoftmaxHelper<VT>::simd, typename DVecSoftmaxHelper<VT>::NT >
+{
+   using CT = CompositeType_t<VT>;
+   using NT = typename DVecSoftmaxHelper<VT>::NT;
+   using ST = typename NT::second_type;
+
+   BLAZE_INTERNAL_ASSERT( begin < end && end <= (~dv).size(), "Invalid index range" );
+
+   CT tmp( ~dv );
+
+   NT norm( tmp[begin], ST(1) );
+
+   for( size_t i=begin+1UL; i<end; ++i ) {
+      softmaxUpdate( norm, tmp[i] );
+   }
+
+   return norm;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized backend implementation of the softmax normalizer of a range of a dense
+//        vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector.
+// \param begin The index of the first element of the range.
+// \param end The index one past the last element of the range.
+// \return The maximum element and the sum of the shifted exponentials of the range.
+//
+// This function computes the maximum element \f$ m \f$ and the sum \f$ \sum e^{x_i-m} \f$ of
+// the non-empty range \f$ [begin..end) \f$ of a dense vector in a single pass. Each SIMD lane
+// keeps its own maximum and sum, which are combined after the pass. The range is processed in
+// chunks of SIMD vectors: The maximum of a chunk is determined first, such that the sum is
+// rescaled once per chunk and only a single exponential is computed per element. The lane
+// maxima start at the lowest finite value, such that elements equal to negative infinity don't
+// contribute to the sum. The index \a begin is
+// required to be a multiple of the SIMD size. Due to the explicit application of the SFINAE
+// principle, this function can only be selected by the compiler in case vectorization can be
+// applied.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline auto dvecsoftmax( const DenseVector<VT,TF>& dv, size_t begin, size_t end )
+   -> EnableIf_t< DVecSoftmaxHelper<VT>::simd, typename DVecSoftmaxHelper<VT>::NT >
+{
+   using CT = CompositeType_t<VT>;
+   using ET = ElementType_t<VT>;
+   using NT = typename DVecSoftmaxHelper<VT>::NT;
+
+   static constexpr size_t SIMDSIZE  = SIMDTrait<ET>::size;
+   static constexpr size_t CHUNKSIZE = 8UL*SIMDSIZE;
+
+   BLAZE_INTERNAL_ASSERT( begin < end && end <= (~dv).size(), "Invalid index range" );
+   BLAZE_INTERNAL_ASSERT( begin % SIMDSIZE == 0UL, "Invalid range alignment" );
+
+   CT tmp( ~dv );
+
+   const size_t ipos( begin + prevMultiple( end-begin, SIMDSIZE ) );
+   BLAZE_INTERNAL_ASSERT( ipos <= end, "Invalid end calculation" );
+
+   NT norm;
+   size_t i( begin );
+
+   if( i < ipos )
+   {
+      SIMDTrait_t<ET> xmm1( set( std::numeric_limits<ET>::lowest() ) );
+      SIMDTrait_t<ET> xmm2( set( ET(0) ) );
+
+      while( i < ipos )
+      {
+         const size_t jpos( min( i+CHUNKSIZE, ipos ) );
+
+         SIMDTrait_t<ET> xmm3( xmm1 );
+
+         for( size_t j=i; j<jpos; j+=SIMDSIZE ) {
+            xmm3 = max( xmm3, tmp.load(j) );
+         }
+
+         xmm2 = xmm2 * exp( xmm1 - xmm3 );
+
+         for( ; i<jpos; i+=SIMDSIZE ) {
+            xmm2 = xmm2 + exp( tmp.load(i) - xmm3 );
+         }
+
+         xmm1 = xmm3;
+      }
+
+      alignas( AlignmentOf_v<ET> ) ET array1[SIMDSIZE];
+      alignas( AlignmentOf_v<ET> ) ET array2[SIMDSIZE];
+
+      storea( array1, xmm1 );
+      storea( array2, xmm2 );
+
+      norm = NT( array1[0UL], array2[0UL] );
+
+      for( size_t k=1UL; k<SIMDSIZE; ++k ) {
+         norm = softmaxCombine( norm, NT( array1[k], array2[k] ) );
+      }
+   }
+   else
+   {
+      norm = NT( tmp[i], ET(1) );
+      ++i;
+   }
+
+   for( ; i<end; ++i ) {
+      softmaxUpdate( norm, tmp[i] );
+   }
+
+   return norm;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the softmax normalizer of a dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given non-empty dense vector.
+// \return The maximum element and the sum of the shifted exponentials.
+//
+// This function computes the maximum element \f$ m \f$ and the sum \f$ \sum e^{x_i-m} \f$ of
+// the given dense vector in a single pass. In case the size of the vector is larger or equal
+// to the SMP dense vector reduction threshold, the vector is split into blocks of fixed size,
+// which are processed in parallel and are combined in a fixed order (see smpReduce()).
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline typename DVecSoftmaxHelper<VT>::NT dvecsoftmax( const DenseVector<VT,TF>& dv )
+{
+   using CT = CompositeType_t<VT>;
+   using NT = typename DVecSoftmaxHelper<VT>::NT;
+
+   const size_t N( (~dv).size() );
+
+   BLAZE_INTERNAL_ASSERT( N > 0UL, "Invalid vector size" );
+
+   CT tmp( ~dv );
+
+   if( N < SMP_DVECREDUCE_THRESHOLD ) {
+      return dvecsoftmax( tmp, 0UL, N );
+   }
+
+   const size_t blocks( ( N - 1UL ) / REDUCTION_BLOCK_SIZE + 1UL );
+
+   const auto block = [&tmp,N]( size_t b ) {
+      const size_t begin( b*REDUCTION_BLOCK_SIZE );
+      return dvecsoftmax( tmp, begin, min( begin+REDUCTION_BLOCK_SIZE, N ) );
+   };
+
+   const auto combine = []( const NT& lhs, const NT& rhs ) {
+      return softmaxCombine( lhs, rhs );
+   };
+
+   return smpReduce<NT>( blocks, canSMPReduce( ~dv ), block, combine );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default backend implementation of the softmax function for the given dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector for the softmax computation.
+// \return The resulting dense vector.
+//
+// This function computes the softmax function by means of the exponential function and a
+// subsequent normalization. It is selected for vectors with non-builtin element type (for
+// instance complex numbers) and for uniform vectors.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+auto softmax_backend( const DenseVector<VT,TF>& dv, FalseType )
+{
+   auto tmp( evaluate( exp( ~dv ) ) );
+   const auto scalar( sum( ~tmp ) );
+   tmp /= scalar;
+   return tmp;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fused backend implementation of the softmax function for the given dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector for the softmax computation.
+// \return The resulting dense vector.
+//
+// This function computes the softmax function in two passes over the given dense vector: The
+// first pass computes the maximum element \f$ m \f$ and the sum \f$ s = \sum e^{x_i-m} \f$, the
+// second pass directly writes \f$ e^{x_i-m} / s \f$ to the resulting vector.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+auto softmax_backend( const DenseVector<VT,TF>& dv, TrueType )
+{
+   using CT = CompositeType_t<VT>;
+   using RT = typename DVecSoftmaxHelper<VT>::RT;
+
+   if( (~dv).size() == 0UL ) return RT();
+
+   CT tmp( ~dv );
+
+   const auto norm( dvecsoftmax( tmp ) );
+
+   return RT( exp( tmp - norm.first ) / norm.second );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Computes the softmax function for the given dense vector.
 // \ingroup dense_vector
@@ -61,15 +462,20 @@ namespace blaze {
 // This function computes the softmax function (i.e. the normalized exponential function) for
 // the given dense vector \a dv (see also https://en.wikipedia.org/wiki/Softmax_function). The
 // resulting dense vector consists of real values in the range (0..1], which add up to 1.
+//
+// For vectors of built-in data type the softmax function is computed as
+// \f$ e^{x_i-m} / \sum e^{x_j-m} \f$, where \f$ m \f$ is the maximum element. Thus the result
+// is well-defined even for large elements that would overflow the exponential function (as for
+// instance 100 for single precision values). The maximum and the sum are computed in a single
+// pass and the result is written in a second pass without creating an intermediate temporary.
 */
 template< typename VT  // Type of the dense vector
         , bool TF >    // Transpose flag
 auto softmax( const DenseVector<VT,TF>& dv )
 {
-   auto tmp( evaluate( exp( ~dv ) ) );
-   const auto scalar( sum( ~tmp ) );
-   tmp /= scalar;
-   return tmp;
+   BLAZE_FUNCTION_TRACE;
+
+   return softmax_backend( ~dv, Bool_t< DVecSoftmaxHelper<VT>::fused >() );
 }
 //*************************************************************************************************
 
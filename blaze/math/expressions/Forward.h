@@ -127,6 +127,8 @@ template< typename, typename > class DVecSVecOuterExpr;
 template< typename, typename, bool > class DVecSVecSubExpr;
 template< typename, bool > class DVecTransExpr;
 template< typename, bool > class DVecTransposer;
+template< typename, typename, bool > class KronDMatMultExpr;
+template< typename, typename > class KronDVecMultExpr;
 template< typename, bool > class Matrix;
 template< typename, bool > class SMatDeclDiagExpr;
 template< typename, bool > class SMatDeclHermExpr;
@@ -0,0 +1,993 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/expressions/KronDMatMultExpr.h
+//  \brief Header file for the Kronecker product/dense matrix multiplication expression
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_EXPRESSIONS_KRONDMATMULTEXPR_H_
+#define _BLAZE_MATH_EXPRESSIONS_KRONDMATMULTEXPR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/constraints/DenseMatrix.h>
+#include <blaze/math/constraints/MatMatKronExpr.h>
+#include <blaze/math/constraints/RequiresEvaluation.h>
+#include <blaze/math/constraints/StorageOrder.h>
+#include <blaze/math/dense/CustomMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/Computation.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/Forward.h>
+#include <blaze/math/expressions/MatInvExpr.h>
+#include <blaze/math/expressions/MatMatKronExpr.h>
+#include <blaze/math/expressions/MultExpr.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/typetraits/IsComputation.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/RequiresEvaluation.h>
+#include <blaze/math/typetraits/StorageOrder.h>
+#include <blaze/math/views/Check.h>
+#include <blaze/math/views/Forward.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS KRONDMATMULTEXPR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Expression object for the multiplication of a Kronecker product and a dense matrix.
+// \ingroup dense_matrix_expression
+//
+// The KronDMatMultExpr class represents the compile time expression for the multiplication
+// of a Kronecker product \f$ A \otimes B \f$ of an \f$ M \times N \f$ matrix \a A and a
+// \f$ P \times Q \f$ matrix \a B with a dense \f$ N*Q \times R \f$ matrix \a C. The Kronecker
+// product is never formed explicitly. Instead, the result is computed column block-wise by
+// means of the identity \f$ (A \otimes B) vec(X) = vec(A X B^T) \f$ in two steps: First, the
+// \a N blocks \f$ C_j \f$ of \a Q rows each are multiplied by \a B, the products \f$ B C_j \f$
+// are stored consecutively in the row-major \f$ N \times P*R \f$ matrix \a T. Second, the
+// row-major \f$ M \times P*R \f$ result \f$ A T \f$ is reinterpreted as \f$ M*P \times R \f$
+// matrix. In case any of the two factors is a Kronecker product itself, the according
+// multiplication again avoids forming the product, which allows to apply chains of Kronecker
+// products of arbitrary length.
+*/
+template< typename MT1  // Type of the left-hand side Kronecker product
+        , typename MT2  // Type of the right-hand side dense matrix
+        , bool SO >     // Storage order
+class KronDMatMultExpr
+   : public MultExpr< DenseMatrix< KronDMatMultExpr<MT1,MT2,SO>, SO > >
+   , private Computation
+{
+ private:
+   //**Type definitions****************************************************************************
+   using RT1 = ResultType_t<MT1>;     //!< Result type of the left-hand side Kronecker product.
+   using RT2 = ResultType_t<MT2>;     //!< Result type of the right-hand side dense matrix expression.
+   using CT2 = CompositeType_t<MT2>;  //!< Composite type of the right-hand side dense matrix expression.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Compilation switch for the composite type of the right-hand side dense matrix expression.
+   static constexpr bool evaluateRight = ( IsComputation_v<MT2> || RequiresEvaluation_v<MT2> );
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   using This          = KronDMatMultExpr<MT1,MT2,SO>;  //!< Type of this KronDMatMultExpr instance.
+   using BaseType      = DenseMatrix<This,SO>;          //!< Base type of this KronDMatMultExpr instance.
+   using ResultType    = MultTrait_t<RT1,RT2>;          //!< Result type for expression template evaluations.
+   using OppositeType  = OppositeType_t<ResultType>;    //!< Result type with opposite storage order for expression template evaluations.
+   using TransposeType = TransposeType_t<ResultType>;   //!< Transpose type for expression template evaluations.
+   using ElementType   = ElementType_t<ResultType>;     //!< Resulting element type.
+   using ReturnType    = const ElementType;             //!< Return type for expression template evaluations.
+
+   //! Data type for composite expression templates.
+   using CompositeType = const ResultType;
+
+   //! Composite type of the left-hand side Kronecker product.
+   using LeftOperand = If_t< IsExpression_v<MT1>, const MT1, const MT1& >;
+
+   //! Composite type of the right-hand side dense matrix expression.
+   using RightOperand = If_t< IsExpression_v<MT2>, const MT2, const MT2& >;
+
+   //! Type for the assignment of the right-hand side dense matrix operand.
+   using RT = If_t< evaluateRight, const RT2, CT2 >;
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the expression template evaluation strategy.
+   static constexpr bool simdEnabled = false;
+
+   //! Compilation switch for the expression template assignment strategy.
+   static constexpr bool smpAssignable = false;
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the KronDMatMultExpr class.
+   //
+   // \param lhs The left-hand side Kronecker product of the multiplication expression.
+   // \param rhs The right-hand side dense matrix operand of the multiplication expression.
+   */
+   inline KronDMatMultExpr( const MT1& lhs, const MT2& rhs ) noexcept
+      : lhs_( lhs )  // Left-hand side Kronecker product of the multiplication expression
+      , rhs_( rhs )  // Right-hand side dense matrix of the multiplication expression
+   {
+      BLAZE_INTERNAL_ASSERT( lhs.columns() == rhs.rows(), "Invalid matrix sizes" );
+   }
+   //**********************************************************************************************
+
+   //**Access operator*****************************************************************************
+   /*!\brief 2D-access to the matrix elements.
+   //
+   // \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+   // \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+   // \return The resulting value.
+   //
+   // The element is computed as the inner product of the according row of the Kronecker product
+   // and the according column of the dense matrix.
+   */
+   inline ReturnType operator()( size_t i, size_t j ) const {
+      BLAZE_INTERNAL_ASSERT( i < lhs_.rows()   , "Invalid row access index"    );
+      BLAZE_INTERNAL_ASSERT( j < rhs_.columns(), "Invalid column access index" );
+      return row( lhs_, i, unchecked ) * column( rhs_, j, unchecked );
+   }
+   //**********************************************************************************************
+
+   //**At function*********************************************************************************
+   /*!\brief Checked access to the matrix elements.
+   //
+   // \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+   // \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+   // \return The resulting value.
+   // \exception std::out_of_range Invalid matrix access index.
+   */
+   inline ReturnType at( size_t i, size_t j ) const {
+      if( i >= lhs_.rows() ) {
+         BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+      }
+      if( j >= rhs_.columns() ) {
+         BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+      }
+      return (*this)(i,j);
+   }
+   //**********************************************************************************************
+
+   //**Rows function*******************************************************************************
+   /*!\brief Returns the current number of rows of the matrix.
+   //
+   // \return The number of rows of the matrix.
+   */
+   inline size_t rows() const noexcept {
+      return lhs_.rows();
+   }
+   //**********************************************************************************************
+
+   //**Columns function****************************************************************************
+   /*!\brief Returns the current number of columns of the matrix.
+   //
+   // \return The number of columns of the matrix.
+   */
+   inline size_t columns() const noexcept {
+      return rhs_.columns();
+   }
+   //**********************************************************************************************
+
+   //**Left operand access*************************************************************************
+   /*!\brief Returns the left-hand side Kronecker product operand.
+   //
+   // \return The left-hand side Kronecker product operand.
+   */
+   inline LeftOperand leftOperand() const noexcept {
+      return lhs_;
+   }
+   //**********************************************************************************************
+
+   //**Right operand access************************************************************************
+   /*!\brief Returns the right-hand side dense matrix operand.
+   //
+   // \return The right-hand side dense matrix operand.
+   */
+   inline RightOperand rightOperand() const noexcept {
+      return rhs_;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can alias with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case an aliasing effect is possible, \a false if not.
+   */
+   template< typename T >
+   inline bool canAlias( const T* alias ) const noexcept {
+      return ( lhs_.isAliased( alias ) || rhs_.isAliased( alias ) );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression is aliased with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case the given alias is contained in this expression, \a false if not.
+   */
+   template< typename T >
+   inline bool isAliased( const T* alias ) const noexcept {
+      return ( lhs_.isAliased( alias ) || rhs_.isAliased( alias ) );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   LeftOperand  lhs_;  //!< Left-hand side Kronecker product of the multiplication expression.
+   RightOperand rhs_;  //!< Right-hand side dense matrix of the multiplication expression.
+   //**********************************************************************************************
+
+   //**Assignment to dense matrices****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a Kronecker product-dense matrix multiplication to a dense matrix
+   //        (\f$ C=(A \otimes B)*D \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a Kronecker product-dense
+   // matrix multiplication expression to a dense matrix. The Kronecker product is not formed,
+   // but applied by means of two matrix multiplications with its factors.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO2 >   // Storage order of the target dense matrix
+   friend inline void assign( DenseMatrix<MT,SO2>& lhs, const KronDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      if( (~lhs).rows() == 0UL || (~lhs).columns() == 0UL ) {
+         return;
+      }
+      else if( rhs.lhs_.columns() == 0UL ) {
+         reset( ~lhs );
+         return;
+      }
+
+      const auto& A( rhs.lhs_.leftOperand()  );
+      const auto& B( rhs.lhs_.rightOperand() );
+
+      const size_t m( A.rows()    );
+      const size_t n( A.columns() );
+      const size_t p( B.rows()    );
+      const size_t q( B.columns() );
+      const size_t r( rhs.rhs_.columns() );
+
+      RT C( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side dense matrix operand
+
+      DynamicVector<ElementType> t( n*p*r );
+      for( size_t j=0UL; j<n; ++j ) {
+         CustomMatrix<ElementType,unaligned,unpadded,rowMajor> Tj( t.data()+j*p*r, p, r );
+         assign( Tj, B * submatrix( C, j*q, 0UL, q, r, unchecked ) );
+      }
+      const CustomMatrix<ElementType,unaligned,unpadded,rowMajor> T( t.data(), n, p*r );
+
+      DynamicVector<ElementType> y( m*p*r );
+      CustomMatrix<ElementType,unaligned,unpadded,rowMajor> Y( y.data(), m, p*r );
+      assign( Y, A * T );
+
+      const CustomMatrix<ElementType,unaligned,unpadded,rowMajor> R( y.data(), m*p, r );
+      assign( ~lhs, R );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Assignment to sparse matrices***************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a Kronecker product-dense matrix multiplication to a sparse matrix
+   //        (\f$ C=(A \otimes B)*D \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side sparse matrix.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a Kronecker product-dense
+   // matrix multiplication expression to a sparse matrix.
+   */
+   template< typename MT  // Type of the target sparse matrix
+           , bool SO2 >   // Storage order of the target sparse matrix
+   friend inline void assign( SparseMatrix<MT,SO2>& lhs, const KronDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      using TmpType = If_t< SO == SO2, ResultType, OppositeType >;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( OppositeType );
+      BLAZE_CONSTRAINT_MUST_BE_MATRIX_WITH_STORAGE_ORDER( ResultType, SO );
+      BLAZE_CONSTRAINT_MUST_BE_MATRIX_WITH_STORAGE_ORDER( OppositeType, !SO );
+      BLAZE_CONSTRAINT_MATRICES_MUST_HAVE_SAME_STORAGE_ORDER( MT, TmpType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( TmpType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      const TmpType tmp( serial( rhs ) );
+      assign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to dense matrices*******************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a Kronecker product-dense matrix multiplication to a dense
+   //        matrix (\f$ C+=(A \otimes B)*D \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized addition assignment of a Kronecker
+   // product-dense matrix multiplication expression to a dense matrix.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO2 >   // Storage order of the target dense matrix
+   friend inline void addAssign( DenseMatrix<MT,SO2>& lhs, const KronDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_MATRIX_WITH_STORAGE_ORDER( ResultType, SO );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      const ResultType tmp( serial( rhs ) );
+      addAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to sparse matrices******************************************************
+   // No special implementation for the addition assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**Subtraction assignment to dense matrices****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a Kronecker product-dense matrix multiplication to a dense
+   //        matrix (\f$ C-=(A \otimes B)*D \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized subtraction assignment of a Kronecker
+   // product-dense matrix multiplication expression to a dense matrix.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO2 >   // Storage order of the target dense matrix
+   friend inline void subAssign( DenseMatrix<MT,SO2>& lhs, const KronDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_MATRIX_WITH_STORAGE_ORDER( ResultType, SO );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      const ResultType tmp( serial( rhs ) );
+      subAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Subtraction assignment to sparse matrices***************************************************
+   // No special implementation for the subtraction assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**Schur product assignment to dense matrices**************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Schur product assignment of a Kronecker product-dense matrix multiplication to a
+   //        dense matrix (\f$ C\circ=(A \otimes B)*D \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression for the Schur product.
+   // \return void
+   //
+   // This function implements the performance optimized Schur product assignment of a Kronecker
+   // product-dense matrix multiplication expression to a dense matrix.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO2 >   // Storage order of the target dense matrix
+   friend inline void schurAssign( DenseMatrix<MT,SO2>& lhs, const KronDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_MATRIX_WITH_STORAGE_ORDER( ResultType, SO );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      const ResultType tmp( serial( rhs ) );
+      schurAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Schur product assignment to sparse matrices*************************************************
+   // No special implementation for the Schur product assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**Multiplication assignment to dense matrices*************************************************
+   // No special implementation for the multiplication assignment to dense matrices.
+   //**********************************************************************************************
+
+   //**Multiplication assignment to sparse matrices************************************************
+   // No special implementation for the multiplication assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**SMP assignment to dense matrices************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a Kronecker product-dense matrix multiplication to a dense matrix
+   //        (\f$ C=(A \otimes B)*D \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a Kronecker product-
+   // dense matrix multiplication expression to a dense matrix. The parallelization is applied
+   // to the underlying matrix multiplications.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO2 >   // Storage order of the target dense matrix
+   friend inline void smpAssign( DenseMatrix<MT,SO2>& lhs, const KronDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      if( (~lhs).rows() == 0UL || (~lhs).columns() == 0UL ) {
+         return;
+      }
+      else if( rhs.lhs_.columns() == 0UL ) {
+         reset( ~lhs );
+         return;
+      }
+
+      const auto& A( rhs.lhs_.leftOperand()  );
+      const auto& B( rhs.lhs_.rightOperand() );
+
+      const size_t m( A.rows()    );
+      const size_t n( A.columns() );
+      const size_t p( B.rows()    );
+      const size_t q( B.columns() );
+      const size_t r( rhs.rhs_.columns() );
+
+      RT C( rhs.rhs_ );  // Evaluation of the right-hand side dense matrix operand
+
+      DynamicVector<ElementType> t( n*p*r );
+      for( size_t j=0UL; j<n; ++j ) {
+         CustomMatrix<ElementType,unaligned,unpadded,rowMajor> Tj( t.data()+j*p*r, p, r );
+         smpAssign( Tj, B * submatrix( C, j*q, 0UL, q, r, unchecked ) );
+      }
+      const CustomMatrix<ElementType,unaligned,unpadded,rowMajor> T( t.data(), n, p*r );
+
+      DynamicVector<ElementType> y( m*p*r );
+      CustomMatrix<ElementType,unaligned,unpadded,rowMajor> Y( y.data(), m, p*r );
+      smpAssign( Y, A * T );
+
+      const CustomMatrix<ElementType,unaligned,unpadded,rowMajor> R( y.data(), m*p, r );
+      smpAssign( ~lhs, R );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP assignment to sparse matrices***********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a Kronecker product-dense matrix multiplication to a sparse matrix
+   //        (\f$ C=(A \otimes B)*D \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side sparse matrix.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a Kronecker product-
+   // dense matrix multiplication expression to a sparse matrix.
+   */
+   template< typename MT  // Type of the target sparse matrix
+           , bool SO2 >   // Storage order of the target sparse matrix
+   friend inline void smpAssign( SparseMatrix<MT,SO2>& lhs, const KronDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      using TmpType = If_t< SO == SO2, ResultType, OppositeType >;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( OppositeType );
+      BLAZE_CONSTRAINT_MUST_BE_MATRIX_WITH_STORAGE_ORDER( ResultType, SO );
+      BLAZE_CONSTRAINT_MUST_BE_MATRIX_WITH_STORAGE_ORDER( OppositeType, !SO );
+      BLAZE_CONSTRAINT_MATRICES_MUST_HAVE_SAME_STORAGE_ORDER( MT, TmpType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( TmpType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      const TmpType tmp( rhs );
+      smpAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP addition assignment to dense matrices***************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP addition assignment of a Kronecker product-dense matrix multiplication to a dense
+   //        matrix (\f$ C+=(A \otimes B)*D \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized SMP addition assignment of a Kronecker
+   // product-dense matrix multiplication expression to a dense matrix.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO2 >   // Storage order of the target dense matrix
+   friend inline void smpAddAssign( DenseMatrix<MT,SO2>& lhs, const KronDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_MATRIX_WITH_STORAGE_ORDER( ResultType, SO );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      const ResultType tmp( rhs );
+      smpAddAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP addition assignment to sparse matrices**************************************************
+   // No special implementation for the SMP addition assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**SMP subtraction assignment to dense matrices************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP subtraction assignment of a Kronecker product-dense matrix multiplication to a
+   //        dense matrix (\f$ C-=(A \otimes B)*D \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized SMP subtraction assignment of a
+   // Kronecker product-dense matrix multiplication expression to a dense matrix.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO2 >   // Storage order of the target dense matrix
+   friend inline void smpSubAssign( DenseMatrix<MT,SO2>& lhs, const KronDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_MATRIX_WITH_STORAGE_ORDER( ResultType, SO );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      const ResultType tmp( rhs );
+      smpSubAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP subtraction assignment to sparse matrices***********************************************
+   // No special implementation for the SMP subtraction assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**SMP Schur product assignment to dense matrices**********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP Schur product assignment of a Kronecker product-dense matrix multiplication to a
+   //        dense matrix (\f$ C\circ=(A \otimes B)*D \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression for the Schur product.
+   // \return void
+   //
+   // This function implements the performance optimized SMP Schur product assignment of a
+   // Kronecker product-dense matrix multiplication expression to a dense matrix.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO2 >   // Storage order of the target dense matrix
+   friend inline void smpSchurAssign( DenseMatrix<MT,SO2>& lhs, const KronDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_MATRIX_WITH_STORAGE_ORDER( ResultType, SO );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      const ResultType tmp( rhs );
+      smpSchurAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP Schur product assignment to sparse matrices*********************************************
+   // No special implementation for the SMP Schur product assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**SMP multiplication assignment to dense matrices*********************************************
+   // No special implementation for the SMP multiplication assignment to dense matrices.
+   //**********************************************************************************************
+
+   //**SMP multiplication assignment to sparse matrices********************************************
+   // No special implementation for the SMP multiplication assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_MATMATKRONEXPR_TYPE( MT1 );
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( MT2 );
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( ResultType );
+   BLAZE_CONSTRAINT_MUST_BE_MATRIX_WITH_STORAGE_ORDER( ResultType, SO );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL BINARY ARITHMETIC OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a Kronecker product and a dense
+//        matrix (\f$ C=(A \otimes B)*D \f$).
+// \ingroup dense_matrix
+//
+// \param lhs The left-hand side Kronecker product for the multiplication.
+// \param rhs The right-hand side dense matrix for the multiplication.
+// \return The resulting matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This operator implements a performance optimized treatment of the multiplication of a
+// Kronecker product and a dense matrix:
+
+   \code
+   blaze::DynamicMatrix<double> A, B, C, D, E;
+   // ... Resizing and initialization
+   E = kron( A, B ) * D;
+   E = kron( kron( A, B ), C ) * D;
+   \endcode
+
+// Instead of forming the Kronecker product it applies the identity
+// \f$ (A \otimes B) vec(X) = vec(A X B^T) \f$ to all columns of \a D at once and computes the
+// result by means of two matrix multiplications. Both factors of the Kronecker product can be
+// dense or sparse matrices and can again be Kronecker products. In case the number of columns
+// of the Kronecker product doesn't match the number of rows of the dense matrix, a
+// \a std::invalid_argument exception is thrown.
+//
+// \note Columns of the expression object (see column() and columns()) are again computed as
+// Kronecker product-dense matrix multiplications. Individual elements and all other views on
+// the expression object (as for instance row() or submatrix()) are computed via the according
+// rows of the Kronecker product and should only be used for a small number of elements.
+*/
+template< typename MT1  // Matrix base type of the left-hand side Kronecker product
+        , typename MT2  // Type of the right-hand side dense matrix
+        , bool SO >     // Storage order of the right-hand side dense matrix
+inline decltype(auto)
+   operator*( const MatMatKronExpr<MT1>& lhs, const DenseMatrix<MT2,SO>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~lhs).columns() != (~rhs).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   using KT = MatrixType_t<MT1>;
+   using RT = MultTrait_t< ResultType_t<KT>, ResultType_t<MT2> >;
+
+   using ReturnType = const KronDMatMultExpr< KT, MT2, StorageOrder_v<RT> >;
+   return ReturnType( ~lhs, ~rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication operator for the multiplication of a Kronecker product and a scaled
+//        dense matrix (\f$ C=(A \otimes B)*(D*s) \f$).
+// \ingroup dense_matrix
+//
+// \param lhs The left-hand side Kronecker product for the multiplication.
+// \param rhs The right-hand side scaled dense matrix for the multiplication.
+// \return The scaled result matrix.
+//
+// This operator implements a performance optimized treatment of the multiplication of a
+// Kronecker product and a scaled dense matrix. It restructures the expression
+// \f$ C=(A \otimes B)*(D*s) \f$ to the expression \f$ C=((A \otimes B)*D)*s \f$.
+*/
+template< typename MT1  // Matrix base type of the left-hand side Kronecker product
+        , typename MT2  // Type of the dense matrix of the right-hand side expression
+        , typename ST   // Type of the scalar of the right-hand side expression
+        , bool SO >     // Storage order of the right-hand side expression
+inline decltype(auto)
+   operator*( const MatMatKronExpr<MT1>& lhs, const DMatScalarMultExpr<MT2,ST,SO>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return ( lhs * rhs.leftOperand() ) * rhs.rightOperand();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication operator for the multiplication of a Kronecker product and a matrix
+//        inversion expression (\f$ C=(A \otimes B)*inv(D) \f$).
+// \ingroup dense_matrix
+//
+// \param lhs The left-hand side Kronecker product for the multiplication.
+// \param rhs The right-hand side matrix inversion for the multiplication.
+// \return The resulting matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This operator implements the multiplication of a Kronecker product and a matrix inversion
+// expression. The inverse is evaluated and multiplied without forming the Kronecker product.
+*/
+template< typename MT1    // Matrix base type of the left-hand side Kronecker product
+        , typename MT2 >  // Matrix base type of the right-hand side expression
+inline decltype(auto)
+   operator*( const MatMatKronExpr<MT1>& lhs, const MatInvExpr<MT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~lhs).columns() != (~rhs).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   using KT = MatrixType_t<MT1>;
+   using IT = MatrixType_t<MT2>;
+   using RT = MultTrait_t< ResultType_t<KT>, ResultType_t<IT> >;
+
+   using ReturnType = const KronDMatMultExpr< KT, IT, StorageOrder_v<RT> >;
+   return ReturnType( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL RESTRUCTURING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creating a view on a specific submatrix of the given Kronecker product-dense matrix
+//        multiplication.
+// \ingroup dense_matrix
+//
+// \param matrix The constant Kronecker product-dense matrix multiplication.
+// \param args The runtime submatrix arguments.
+// \return View on the specified submatrix of the multiplication.
+//
+// This function returns an expression representing the specified submatrix of the given
+// Kronecker product-dense matrix multiplication.
+*/
+template< AlignmentFlag AF    // Alignment flag
+        , size_t... CSAs      // Compile time submatrix arguments
+        , typename MT1        // Type of the left-hand side Kronecker product
+        , typename MT2        // Type of the right-hand side dense matrix
+        , bool SO             // Storage order
+        , typename... RSAs >  // Runtime submatrix arguments
+inline decltype(auto) submatrix( const KronDMatMultExpr<MT1,MT2,SO>& matrix, RSAs... args )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   const SubmatrixData<CSAs...> sd( args... );
+
+   decltype(auto) left ( matrix.leftOperand()  );
+   decltype(auto) right( matrix.rightOperand() );
+
+   return submatrix<AF>( left, sd.row(), 0UL, sd.rows(), left.columns() ) *
+          submatrix<AF>( right, 0UL, sd.column(), right.rows(), sd.columns() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creating a view on a specific row of the given Kronecker product-dense matrix
+//        multiplication.
+// \ingroup dense_matrix
+//
+// \param matrix The constant Kronecker product-dense matrix multiplication.
+// \param args The runtime row arguments.
+// \return View on the specified row of the multiplication.
+//
+// This function returns an expression representing the specified row of the given Kronecker
+// product-dense matrix multiplication.
+*/
+template< size_t... CRAs      // Compile time row arguments
+        , typename MT1        // Type of the left-hand side Kronecker product
+        , typename MT2        // Type of the right-hand side dense matrix
+        , bool SO             // Storage order
+        , typename... RRAs >  // Runtime row arguments
+inline decltype(auto) row( const KronDMatMultExpr<MT1,MT2,SO>& matrix, RRAs... args )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return row<CRAs...>( matrix.leftOperand(), args... ) * matrix.rightOperand();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creating a view on a selection of rows of the given Kronecker product-dense matrix
+//        multiplication.
+// \ingroup dense_matrix
+//
+// \param matrix The constant Kronecker product-dense matrix multiplication.
+// \param args The runtime row arguments.
+// \return View on the specified selection of rows of the multiplication.
+//
+// This function returns an expression representing the specified selection of rows of the
+// given Kronecker product-dense matrix multiplication.
+*/
+template< size_t... CRAs    // Compile time row arguments
+        , typename MT1      // Type of the left-hand side Kronecker product
+        , typename MT2      // Type of the right-hand side dense matrix
+        , bool SO           // Storage order
+        , typename... RRAs  // Runtime row arguments
+        , EnableIf_t< ( sizeof...( CRAs ) + sizeof...( RRAs ) > 0UL ) >* = nullptr >
+inline decltype(auto) rows( const KronDMatMultExpr<MT1,MT2,SO>& matrix, RRAs... args )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return rows<CRAs...>( matrix.leftOperand(), args... ) * matrix.rightOperand();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creating a view on a specific column of the given Kronecker product-dense matrix
+//        multiplication.
+// \ingroup dense_matrix
+//
+// \param matrix The constant Kronecker product-dense matrix multiplication.
+// \param args The runtime column arguments.
+// \return View on the specified column of the multiplication.
+//
+// This function returns an expression representing the specified column of the given Kronecker
+// product-dense matrix multiplication, which is again a Kronecker product-dense vector
+// multiplication.
+*/
+template< size_t... CCAs      // Compile time column arguments
+        , typename MT1        // Type of the left-hand side Kronecker product
+        , typename MT2        // Type of the right-hand side dense matrix
+        , bool SO             // Storage order
+        , typename... RCAs >  // Runtime column arguments
+inline decltype(auto) column( const KronDMatMultExpr<MT1,MT2,SO>& matrix, RCAs... args )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return matrix.leftOperand() * column<CCAs...>( matrix.rightOperand(), args... );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creating a view on a selection of columns of the given Kronecker product-dense matrix
+//        multiplication.
+// \ingroup dense_matrix
+//
+// \param matrix The constant Kronecker product-dense matrix multiplication.
+// \param args The runtime column arguments.
+// \return View on the specified selection of columns of the multiplication.
+//
+// This function returns an expression representing the specified selection of columns of the
+// given Kronecker product-dense matrix multiplication, which is again a Kronecker product-dense
+// matrix multiplication.
+*/
+template< size_t... CCAs    // Compile time column arguments
+        , typename MT1      // Type of the left-hand side Kronecker product
+        , typename MT2      // Type of the right-hand side dense matrix
+        , bool SO           // Storage order
+        , typename... RCAs  // Runtime column arguments
+        , EnableIf_t< ( sizeof...( CCAs ) + sizeof...( RCAs ) > 0UL ) >* = nullptr >
+inline decltype(auto) columns( const KronDMatMultExpr<MT1,MT2,SO>& matrix, RCAs... args )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return matrix.leftOperand() * columns<CCAs...>( matrix.rightOperand(), args... );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
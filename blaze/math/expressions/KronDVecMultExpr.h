@@ -0,0 +1,843 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/expressions/KronDVecMultExpr.h
+//  \brief Header file for the Kronecker product/dense vector multiplication expression
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_EXPRESSIONS_KRONDVECMULTEXPR_H_
+#define _BLAZE_MATH_EXPRESSIONS_KRONDVECMULTEXPR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/constraints/DenseVector.h>
+#include <blaze/math/constraints/MatMatKronExpr.h>
+#include <blaze/math/constraints/RequiresEvaluation.h>
+#include <blaze/math/constraints/TransposeFlag.h>
+#include <blaze/math/dense/CustomMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/Computation.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Forward.h>
+#include <blaze/math/expressions/MatMatKronExpr.h>
+#include <blaze/math/expressions/MultExpr.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/views/Forward.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS KRONDVECMULTEXPR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Expression object for the multiplication of a Kronecker product and a dense vector.
+// \ingroup dense_vector_expression
+//
+// The KronDVecMultExpr class represents the compile time expression for the multiplication
+// of a Kronecker product \f$ A \otimes B \f$ of an \f$ M \times N \f$ matrix \a A and a
+// \f$ P \times Q \f$ matrix \a B with a dense column vector \a x of size \f$ N*Q \f$. The
+// Kronecker product is never formed explicitly. Instead, \a x is interpreted as the row-major
+// \f$ N \times Q \f$ matrix \a X and the result is computed via the identity
+
+                          \f[ (A \otimes B) vec(X) = vec(A X B^T), \f]
+
+// i.e. by means of the two matrix multiplications \f$ T=B X^T \f$ and \f$ Y=A T^T \f$. In case
+// any of the two factors is a Kronecker product itself, the according multiplication again
+// avoids forming the product, which allows to apply chains of Kronecker products of arbitrary
+// length.
+*/
+template< typename MT    // Type of the left-hand side Kronecker product
+        , typename VT >  // Type of the right-hand side dense vector
+class KronDVecMultExpr
+   : public MultExpr< DenseVector< KronDVecMultExpr<MT,VT>, false > >
+   , private Computation
+{
+ private:
+   //**Type definitions****************************************************************************
+   using MRT = ResultType_t<MT>;    //!< Result type of the left-hand side Kronecker product.
+   using VRT = ResultType_t<VT>;    //!< Result type of the right-hand side dense vector expression.
+   using VET = ElementType_t<VRT>;  //!< Element type of the right-hand side dense vector expression.
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   using This          = KronDVecMultExpr<MT,VT>;      //!< Type of this KronDVecMultExpr instance.
+   using BaseType      = DenseVector<This,false>;      //!< Base type of this KronDVecMultExpr instance.
+   using ResultType    = MultTrait_t<MRT,VRT>;         //!< Result type for expression template evaluations.
+   using TransposeType = TransposeType_t<ResultType>;  //!< Transpose type for expression template evaluations.
+   using ElementType   = ElementType_t<ResultType>;    //!< Resulting element type.
+   using ReturnType    = const ElementType;            //!< Return type for expression template evaluations.
+
+   //! Data type for composite expression templates.
+   using CompositeType = const ResultType;
+
+   //! Composite type of the left-hand side Kronecker product.
+   using LeftOperand = If_t< IsExpression_v<MT>, const MT, const MT& >;
+
+   //! Composite type of the right-hand side dense vector expression.
+   using RightOperand = If_t< IsExpression_v<VT>, const VT, const VT& >;
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the expression template evaluation strategy.
+   static constexpr bool simdEnabled = false;
+
+   //! Compilation switch for the expression template assignment strategy.
+   static constexpr bool smpAssignable = false;
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the KronDVecMultExpr class.
+   //
+   // \param mat The left-hand side Kronecker product of the multiplication expression.
+   // \param vec The right-hand side dense vector operand of the multiplication expression.
+   */
+   inline KronDVecMultExpr( const MT& mat, const VT& vec ) noexcept
+      : mat_( mat )  // Left-hand side Kronecker product of the multiplication expression
+      , vec_( vec )  // Right-hand side dense vector of the multiplication expression
+   {
+      BLAZE_INTERNAL_ASSERT( mat_.columns() == vec_.size(), "Invalid matrix and vector sizes" );
+   }
+   //**********************************************************************************************
+
+   //**Subscript operator**************************************************************************
+   /*!\brief Subscript operator for the direct access to the vector elements.
+   //
+   // \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+   // \return The resulting value.
+   //
+   // The element is computed as the inner product of the according row of the Kronecker product
+   // and the vector, i.e. the access costs \f$ O(N*Q) \f$ operations.
+   */
+   inline ReturnType operator[]( size_t index ) const {
+      BLAZE_INTERNAL_ASSERT( index < mat_.rows(), "Invalid vector access index" );
+      return row( mat_, index, unchecked ) * vec_;
+   }
+   //**********************************************************************************************
+
+   //**At function*********************************************************************************
+   /*!\brief Checked access to the vector elements.
+   //
+   // \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+   // \return The resulting value.
+   // \exception std::out_of_range Invalid vector access index.
+   */
+   inline ReturnType at( size_t index ) const {
+      if( index >= mat_.rows() ) {
+         BLAZE_THROW_OUT_OF_RANGE( "Invalid vector access index" );
+      }
+      return (*this)[index];
+   }
+   //**********************************************************************************************
+
+   //**Size function*******************************************************************************
+   /*!\brief Returns the current size/dimension of the vector.
+   //
+   // \return The size of the vector.
+   */
+   inline size_t size() const noexcept {
+      return mat_.rows();
+   }
+   //**********************************************************************************************
+
+   //**Left operand access*************************************************************************
+   /*!\brief Returns the left-hand side Kronecker product operand.
+   //
+   // \return The left-hand side Kronecker product operand.
+   */
+   inline LeftOperand leftOperand() const noexcept {
+      return mat_;
+   }
+   //**********************************************************************************************
+
+   //**Right operand access************************************************************************
+   /*!\brief Returns the right-hand side dense vector operand.
+   //
+   // \return The right-hand side dense vector operand.
+   */
+   inline RightOperand rightOperand() const noexcept {
+      return vec_;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can alias with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case an aliasing effect is possible, \a false if not.
+   */
+   template< typename T >
+   inline bool canAlias( const T* alias ) const noexcept {
+      return ( mat_.isAliased( alias ) || vec_.isAliased( alias ) );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression is aliased with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case the given alias is contained in this expression, \a false if not.
+   */
+   template< typename T >
+   inline bool isAliased( const T* alias ) const noexcept {
+      return ( mat_.isAliased( alias ) || vec_.isAliased( alias ) );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   LeftOperand  mat_;  //!< Left-hand side Kronecker product of the multiplication expression.
+   RightOperand vec_;  //!< Right-hand side dense vector of the multiplication expression.
+   //**********************************************************************************************
+
+   //**Assignment to dense vectors*****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a Kronecker product-dense vector multiplication to a dense vector
+   //        (\f$ \vec{y}=(A \otimes B)*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a Kronecker product-dense
+   // vector multiplication expression to a dense vector. The vector is reshaped into a row-major
+   // matrix \a X and the result is computed as \f$ A (B X^T)^T \f$ without forming the Kronecker
+   // product.
+   */
+   template< typename VT2 >  // Type of the target dense vector
+   friend inline void assign( DenseVector<VT2,false>& lhs, const KronDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      if( (~lhs).size() == 0UL ) {
+         return;
+      }
+      else if( rhs.mat_.columns() == 0UL ) {
+         reset( ~lhs );
+         return;
+      }
+
+      const auto& A( rhs.mat_.leftOperand()  );
+      const auto& B( rhs.mat_.rightOperand() );
+
+      const size_t m( A.rows()    );
+      const size_t n( A.columns() );
+      const size_t p( B.rows()    );
+      const size_t q( B.columns() );
+
+      DynamicVector<VET> x( serial( rhs.vec_ ) );
+      const CustomMatrix<VET,unaligned,unpadded,rowMajor> X( x.data(), n, q );
+
+      DynamicVector<ElementType> t( p*n );
+      CustomMatrix<ElementType,unaligned,unpadded,rowMajor> T( t.data(), p, n );
+      assign( T, B * trans( X ) );
+
+      DynamicVector<ElementType> y( m*p );
+      CustomMatrix<ElementType,unaligned,unpadded,rowMajor> Y( y.data(), m, p );
+      assign( Y, A * trans( T ) );
+
+      assign( ~lhs, y );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Assignment to sparse vectors****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a Kronecker product-dense vector multiplication to a sparse vector
+   //        (\f$ \vec{y}=(A \otimes B)*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side sparse vector.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a Kronecker product-dense
+   // vector multiplication expression to a sparse vector.
+   */
+   template< typename VT2 >  // Type of the target sparse vector
+   friend inline void assign( SparseVector<VT2,false>& lhs, const KronDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_VECTOR_WITH_TRANSPOSE_FLAG( ResultType, false );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( serial( rhs ) );
+      assign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to dense vectors********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a Kronecker product-dense vector multiplication to a dense
+   //        vector (\f$ \vec{y}+=(A \otimes B)*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized addition assignment of a Kronecker
+   // product-dense vector multiplication expression to a dense vector.
+   */
+   template< typename VT2 >  // Type of the target dense vector
+   friend inline void addAssign( DenseVector<VT2,false>& lhs, const KronDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_VECTOR_WITH_TRANSPOSE_FLAG( ResultType, false );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( serial( rhs ) );
+      addAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to sparse vectors*******************************************************
+   // No special implementation for the addition assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**Subtraction assignment to dense vectors*****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a Kronecker product-dense vector multiplication to a dense
+   //        vector (\f$ \vec{y}-=(A \otimes B)*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized subtraction assignment of a Kronecker
+   // product-dense vector multiplication expression to a dense vector.
+   */
+   template< typename VT2 >  // Type of the target dense vector
+   friend inline void subAssign( DenseVector<VT2,false>& lhs, const KronDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_VECTOR_WITH_TRANSPOSE_FLAG( ResultType, false );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( serial( rhs ) );
+      subAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Subtraction assignment to sparse vectors****************************************************
+   // No special implementation for the subtraction assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**Multiplication assignment to dense vectors**************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Multiplication assignment of a Kronecker product-dense vector multiplication to a
+   //        dense vector (\f$ \vec{y}*=(A \otimes B)*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be multiplied.
+   // \return void
+   //
+   // This function implements the performance optimized multiplication assignment of a
+   // Kronecker product-dense vector multiplication expression to a dense vector.
+   */
+   template< typename VT2 >  // Type of the target dense vector
+   friend inline void multAssign( DenseVector<VT2,false>& lhs, const KronDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_VECTOR_WITH_TRANSPOSE_FLAG( ResultType, false );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( serial( rhs ) );
+      multAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Multiplication assignment to sparse vectors*************************************************
+   // No special implementation for the multiplication assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**Division assignment to dense vectors********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Division assignment of a Kronecker product-dense vector multiplication to a dense
+   //        vector (\f$ \vec{y}/=(A \otimes B)*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression divisor.
+   // \return void
+   //
+   // This function implements the performance optimized division assignment of a Kronecker
+   // product-dense vector multiplication expression to a dense vector.
+   */
+   template< typename VT2 >  // Type of the target dense vector
+   friend inline void divAssign( DenseVector<VT2,false>& lhs, const KronDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_VECTOR_WITH_TRANSPOSE_FLAG( ResultType, false );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( serial( rhs ) );
+      divAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Division assignment to sparse vectors*******************************************************
+   // No special implementation for the division assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**SMP assignment to dense vectors*************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a Kronecker product-dense vector multiplication to a dense vector
+   //        (\f$ \vec{y}=(A \otimes B)*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a Kronecker product-
+   // dense vector multiplication expression to a dense vector. The parallelization is applied
+   // to the two underlying matrix multiplications.
+   */
+   template< typename VT2 >  // Type of the target dense vector
+   friend inline void smpAssign( DenseVector<VT2,false>& lhs, const KronDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      if( (~lhs).size() == 0UL ) {
+         return;
+      }
+      else if( rhs.mat_.columns() == 0UL ) {
+         reset( ~lhs );
+         return;
+      }
+
+      const auto& A( rhs.mat_.leftOperand()  );
+      const auto& B( rhs.mat_.rightOperand() );
+
+      const size_t m( A.rows()    );
+      const size_t n( A.columns() );
+      const size_t p( B.rows()    );
+      const size_t q( B.columns() );
+
+      DynamicVector<VET> x( rhs.vec_ );
+      const CustomMatrix<VET,unaligned,unpadded,rowMajor> X( x.data(), n, q );
+
+      DynamicVector<ElementType> t( p*n );
+      CustomMatrix<ElementType,unaligned,unpadded,rowMajor> T( t.data(), p, n );
+      smpAssign( T, B * trans( X ) );
+
+      DynamicVector<ElementType> y( m*p );
+      CustomMatrix<ElementType,unaligned,unpadded,rowMajor> Y( y.data(), m, p );
+      smpAssign( Y, A * trans( T ) );
+
+      smpAssign( ~lhs, y );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP assignment to sparse vectors************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a Kronecker product-dense vector multiplication to a sparse vector
+   //        (\f$ \vec{y}=(A \otimes B)*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side sparse vector.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a Kronecker product-
+   // dense vector multiplication expression to a sparse vector.
+   */
+   template< typename VT2 >  // Type of the target sparse vector
+   friend inline void smpAssign( SparseVector<VT2,false>& lhs, const KronDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_VECTOR_WITH_TRANSPOSE_FLAG( ResultType, false );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( rhs );
+      smpAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP addition assignment to dense vectors****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP addition assignment of a Kronecker product-dense vector multiplication to a dense
+   //        vector (\f$ \vec{y}+=(A \otimes B)*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized SMP addition assignment of a Kronecker
+   // product-dense vector multiplication expression to a dense vector.
+   */
+   template< typename VT2 >  // Type of the target dense vector
+   friend inline void smpAddAssign( DenseVector<VT2,false>& lhs, const KronDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_VECTOR_WITH_TRANSPOSE_FLAG( ResultType, false );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( rhs );
+      smpAddAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP addition assignment to sparse vectors***************************************************
+   // No special implementation for the SMP addition assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**SMP subtraction assignment to dense vectors*************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP subtraction assignment of a Kronecker product-dense vector multiplication to a
+   //        dense vector (\f$ \vec{y}-=(A \otimes B)*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized SMP subtraction assignment of a
+   // Kronecker product-dense vector multiplication expression to a dense vector.
+   */
+   template< typename VT2 >  // Type of the target dense vector
+   friend inline void smpSubAssign( DenseVector<VT2,false>& lhs, const KronDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_VECTOR_WITH_TRANSPOSE_FLAG( ResultType, false );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( rhs );
+      smpSubAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP subtraction assignment to sparse vectors************************************************
+   // No special implementation for the SMP subtraction assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**SMP multiplication assignment to dense vectors**********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP multiplication assignment of a Kronecker product-dense vector multiplication to
+   //        a dense vector (\f$ \vec{y}*=(A \otimes B)*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be multiplied.
+   // \return void
+   //
+   // This function implements the performance optimized SMP multiplication assignment of a
+   // Kronecker product-dense vector multiplication expression to a dense vector.
+   */
+   template< typename VT2 >  // Type of the target dense vector
+   friend inline void smpMultAssign( DenseVector<VT2,false>& lhs, const KronDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_VECTOR_WITH_TRANSPOSE_FLAG( ResultType, false );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( rhs );
+      smpMultAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP multiplication assignment to sparse vectors*********************************************
+   // No special implementation for the SMP multiplication assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**SMP division assignment to dense vectors****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP division assignment of a Kronecker product-dense vector multiplication to a dense
+   //        vector (\f$ \vec{y}/=(A \otimes B)*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression divisor.
+   // \return void
+   //
+   // This function implements the performance optimized SMP division assignment of a Kronecker
+   // product-dense vector multiplication expression to a dense vector.
+   */
+   template< typename VT2 >  // Type of the target dense vector
+   friend inline void smpDivAssign( DenseVector<VT2,false>& lhs, const KronDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_VECTOR_WITH_TRANSPOSE_FLAG( ResultType, false );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( rhs );
+      smpDivAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP division assignment to sparse vectors***************************************************
+   // No special implementation for the SMP division assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_MATMATKRONEXPR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( VT );
+   BLAZE_CONSTRAINT_MUST_BE_VECTOR_WITH_TRANSPOSE_FLAG( VT, false );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL BINARY ARITHMETIC OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a Kronecker product and a dense
+//        vector (\f$ \vec{y}=(A \otimes B)*\vec{x} \f$).
+// \ingroup dense_vector
+//
+// \param mat The left-hand side Kronecker product for the multiplication.
+// \param vec The right-hand side dense vector for the multiplication.
+// \return The resulting vector.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This operator implements a performance optimized treatment of the multiplication of a
+// Kronecker product and a dense vector:
+
+   \code
+   blaze::DynamicMatrix<double> A, B, C;
+   blaze::DynamicVector<double> x, y;
+   // ... Resizing and initialization
+   y = kron( A, B ) * x;
+   y = kron( kron( A, B ), C ) * x;
+   \endcode
+
+// Instead of forming the Kronecker product it applies the identity
+// \f$ (A \otimes B) vec(X) = vec(A X B^T) \f$ and computes the result by means of two matrix
+// multiplications. Both factors of the Kronecker product can be dense or sparse matrices and
+// can again be Kronecker products. In case the number of columns of the Kronecker product
+// doesn't match the size of the vector, a \a std::invalid_argument exception is thrown.
+//
+// \note Individual elements of the expression object and views on the expression object (as
+// for instance subvector() and elements()) are computed via the according rows of the Kronecker
+// product. Thus they don't profit from the factorization and should only be used for a small
+// number of elements.
+*/
+template< typename MT    // Matrix base type of the left-hand side Kronecker product
+        , typename VT >  // Type of the right-hand side dense vector
+inline decltype(auto)
+   operator*( const MatMatKronExpr<MT>& mat, const DenseVector<VT,false>& vec )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~mat).columns() != (~vec).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix and vector sizes do not match" );
+   }
+
+   using ReturnType = const KronDVecMultExpr< MatrixType_t<MT>, VT >;
+   return ReturnType( ~mat, ~vec );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication operator for the multiplication of a Kronecker product and a scaled
+//        dense vector (\f$ \vec{y}=(A \otimes B)*(\vec{x}*s) \f$).
+// \ingroup dense_vector
+//
+// \param mat The left-hand side Kronecker product for the multiplication.
+// \param vec The right-hand side scaled dense vector for the multiplication.
+// \return The scaled result vector.
+//
+// This operator implements a performance optimized treatment of the multiplication of a
+// Kronecker product and a scaled dense vector. It restructures the expression
+// \f$ \vec{y}=(A \otimes B)*(\vec{x}*s) \f$ to the expression \f$ \vec{y}=((A \otimes B)*\vec{x})*s \f$.
+*/
+template< typename MT    // Matrix base type of the left-hand side Kronecker product
+        , typename VT    // Type of the dense vector of the right-hand side expression
+        , typename ST >  // Type of the scalar of the right-hand side expression
+inline decltype(auto)
+   operator*( const MatMatKronExpr<MT>& mat, const DVecScalarMultExpr<VT,ST,false>& vec )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return ( mat * vec.leftOperand() ) * vec.rightOperand();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL RESTRUCTURING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creating a view on a specific subvector of the given Kronecker product-dense vector
+//        multiplication.
+// \ingroup dense_vector
+//
+// \param vector The constant Kronecker product-dense vector multiplication.
+// \param args The runtime subvector arguments.
+// \return View on the specified subvector of the multiplication.
+//
+// This function returns an expression representing the specified subvector of the given
+// Kronecker product-dense vector multiplication.
+*/
+template< AlignmentFlag AF    // Alignment flag
+        , size_t... CSAs      // Compile time subvector arguments
+        , typename MT         // Type of the left-hand side Kronecker product
+        , typename VT         // Type of the right-hand side dense vector
+        , typename... RSAs >  // Runtime subvector arguments
+inline decltype(auto) subvector( const KronDVecMultExpr<MT,VT>& vector, RSAs... args )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   const SubvectorData<CSAs...> sd( args... );
+
+   decltype(auto) left ( vector.leftOperand()  );
+   decltype(auto) right( vector.rightOperand() );
+
+   return submatrix<AF>( left, sd.offset(), 0UL, sd.size(), left.columns() ) * right;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creating a view on a selection of elements of the given Kronecker product-dense vector
+//        multiplication.
+// \ingroup dense_vector
+//
+// \param vector The constant Kronecker product-dense vector multiplication.
+// \param args The runtime element arguments.
+// \return View on the specified elements of the multiplication.
+//
+// This function returns an expression representing the specified elements of the given
+// Kronecker product-dense vector multiplication.
+*/
+template< size_t... CEAs      // Compile time element arguments
+        , typename MT         // Type of the left-hand side Kronecker product
+        , typename VT         // Type of the right-hand side dense vector
+        , typename... REAs >  // Runtime element arguments
+inline decltype(auto) elements( const KronDVecMultExpr<MT,VT>& vector, REAs... args )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return rows<CEAs...>( vector.leftOperand(), args... ) * vector.rightOperand();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,579 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/expressions/MatMatMultChain.h
+//  \brief Header file for the reordering of matrix multiplication chains
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_EXPRESSIONS_MATMATMULTCHAIN_H_
+#define _BLAZE_MATH_EXPRESSIONS_MATMATMULTCHAIN_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <array>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/typetraits/IsMatMatMultExpr.h>
+#include <blaze/math/typetraits/IsSparseMatrix.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/RemoveCVRef.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS MATMATMULTCHAINLENGTH
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compile time evaluation of the number of factors of a matrix multiplication chain.
+// \ingroup math
+//
+// This type trait evaluates the number of factors of the matrix multiplication chain represented
+// by the given type \a MT. In case \a MT is a matrix/matrix multiplication expression, the value
+// is the sum of the number of factors of its two operands, otherwise the value is 1.
+*/
+template< typename MT, typename = void >
+struct MatMatMultChainLength
+   : public IntegralConstant<size_t,1UL>
+{};
+
+template< typename MT >
+struct MatMatMultChainLength< MT, EnableIf_t< IsMatMatMultExpr_v<MT> > >
+   : public IntegralConstant< size_t, MatMatMultChainLength< RemoveCVRef_t< LeftOperand_t<MT> > >::value +
+                                      MatMatMultChainLength< RemoveCVRef_t< RightOperand_t<MT> > >::value >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary variable template for the MatMatMultChainLength type trait.
+// \ingroup math
+*/
+template< typename MT >
+constexpr size_t MatMatMultChainLength_v = MatMatMultChainLength< RemoveCVRef_t<MT> >::value;
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS MATMATMULTCHAINFACTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Cost model information about a single factor of a matrix multiplication chain.
+// \ingroup math
+*/
+struct MatMatMultChainFactor
+{
+   size_t rows    = 0UL;    //!< The number of rows of the factor.
+   size_t columns = 0UL;    //!< The number of columns of the factor.
+   double nonZeros = 0.0;   //!< The (estimated) number of non-zero elements of the factor.
+   bool sparse = false;     //!< \a true in case the factor is a sparse matrix, \a false if not.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COST MODEL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Estimates the number of multiply-add operations of a matrix multiplication.
+// \ingroup math
+//
+// \param a The left-hand side factor of the multiplication.
+// \param b The right-hand side factor of the multiplication.
+// \return The estimated number of multiply-add operations.
+//
+// In case either of the two factors is a sparse matrix, only its non-zero elements contribute
+// to the number of operations. For the multiplication of two sparse matrices the non-zero
+// elements are assumed to be uniformly distributed.
+*/
+inline double matMatMultChainCost( const MatMatMultChainFactor& a, const MatMatMultChainFactor& b ) noexcept
+{
+   const double m( a.rows );
+   const double k( a.columns );
+   const double n( b.columns );
+
+   if( a.sparse && b.sparse )
+      return ( k > 0.0 )?( a.nonZeros * b.nonZeros / k ):( 0.0 );
+   else if( a.sparse )
+      return a.nonZeros * n;
+   else if( b.sparse )
+      return m * b.nonZeros;
+   else
+      return m * k * n;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Estimates the properties of the result of a matrix multiplication.
+// \ingroup math
+//
+// \param a The left-hand side factor of the multiplication.
+// \param b The right-hand side factor of the multiplication.
+// \return The estimated properties of the resulting matrix.
+//
+// The result of a matrix multiplication is only sparse in case both factors are sparse.
+*/
+inline MatMatMultChainFactor
+   matMatMultChainResult( const MatMatMultChainFactor& a, const MatMatMultChainFactor& b ) noexcept
+{
+   MatMatMultChainFactor result;
+
+   result.rows    = a.rows;
+   result.columns = b.columns;
+   result.sparse  = a.sparse && b.sparse;
+
+   const double size( double( a.rows ) * double( b.columns ) );
+
+   if( result.sparse && a.columns > 0UL )
+      result.nonZeros = min( size, a.nonZeros * b.nonZeros / a.columns );
+   else if( result.sparse )
+      result.nonZeros = 0.0;
+   else
+      result.nonZeros = size;
+
+   return result;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CHAIN ANALYSIS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Collects the cost model information of a dense factor of a matrix multiplication chain.
+// \ingroup math
+//
+// \param mat The dense factor.
+// \param factors The array of factors.
+// \param index The index of the next factor.
+// \return void
+*/
+template< typename MT   // Type of the factor
+        , size_t L >    // Number of factors of the chain
+inline auto collectMatMatMultChain( const MT& mat, std::array<MatMatMultChainFactor,L>& factors, size_t& index )
+   -> EnableIf_t< !IsMatMatMultExpr_v<MT> && !IsSparseMatrix_v<MT> >
+{
+   factors[index].rows     = mat.rows();
+   factors[index].columns  = mat.columns();
+   factors[index].nonZeros = double( mat.rows() ) * double( mat.columns() );
+   factors[index].sparse   = false;
+   ++index;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Collects the cost model information of a sparse factor of a matrix multiplication chain.
+// \ingroup math
+//
+// \param mat The sparse factor.
+// \param factors The array of factors.
+// \param index The index of the next factor.
+// \return void
+*/
+template< typename MT   // Type of the factor
+        , size_t L >    // Number of factors of the chain
+inline auto collectMatMatMultChain( const MT& mat, std::array<MatMatMultChainFactor,L>& factors, size_t& index )
+   -> EnableIf_t< !IsMatMatMultExpr_v<MT> && IsSparseMatrix_v<MT> >
+{
+   factors[index].rows     = mat.rows();
+   factors[index].columns  = mat.columns();
+   factors[index].nonZeros = double( mat.nonZeros() );
+   factors[index].sparse   = true;
+   ++index;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Collects the cost model information of all factors of a matrix multiplication chain.
+// \ingroup math
+//
+// \param mat The matrix/matrix multiplication expression.
+// \param factors The array of factors.
+// \param index The index of the next factor.
+// \return void
+*/
+template< typename MT   // Type of the matrix/matrix multiplication expression
+        , size_t L >    // Number of factors of the chain
+inline auto collectMatMatMultChain( const MT& mat, std::array<MatMatMultChainFactor,L>& factors, size_t& index )
+   -> EnableIf_t< IsMatMatMultExpr_v<MT> >
+{
+   collectMatMatMultChain( mat.leftOperand() , factors, index );
+   collectMatMatMultChain( mat.rightOperand(), factors, index );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Collects the split positions reachable by rotating the left-hand side operand.
+// \ingroup math
+//
+// \param splits The array of split positions.
+// \param count The number of split positions.
+// \return void
+//
+// This function collects all split positions of a chain \f$ (X_1*X_2)*Y \f$ that can be reached
+// by repeated rotations to \f$ X_1*(X_2*Y) \f$, i.e. the number of factors of all left operands
+// along the left spine of the left-hand side operand \a MT.
+*/
+template< typename MT, size_t L >
+inline auto collectLeftSplits( std::array<size_t,L>& splits, size_t& count )
+   -> DisableIf_t< IsMatMatMultExpr_v<MT> >
+{
+   MAYBE_UNUSED( splits, count );
+}
+
+template< typename MT   // Type of the left-hand side operand
+        , size_t L >    // Number of factors of the chain
+inline auto collectLeftSplits( std::array<size_t,L>& splits, size_t& count )
+   -> EnableIf_t< IsMatMatMultExpr_v<MT> >
+{
+   using LT = RemoveCVRef_t< LeftOperand_t<MT> >;
+
+   splits[count++] = MatMatMultChainLength_v<LT>;
+   collectLeftSplits<LT>( splits, count );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Collects the split positions reachable by rotating the right-hand side operand.
+// \ingroup math
+//
+// \param splits The array of split positions.
+// \param count The number of split positions.
+// \param offset The number of factors left of the right-hand side operand.
+// \return void
+//
+// This function collects all split positions of a chain \f$ X*(Y_1*Y_2) \f$ that can be reached
+// by repeated rotations to \f$ (X*Y_1)*Y_2 \f$, i.e. the positions after all left operands along
+// the right spine of the right-hand side operand \a MT.
+*/
+template< typename MT, size_t L >
+inline auto collectRightSplits( std::array<size_t,L>& splits, size_t& count, size_t offset )
+   -> DisableIf_t< IsMatMatMultExpr_v<MT> >
+{
+   MAYBE_UNUSED( splits, count, offset );
+}
+
+template< typename MT   // Type of the right-hand side operand
+        , size_t L >    // Number of factors of the chain
+inline auto collectRightSplits( std::array<size_t,L>& splits, size_t& count, size_t offset )
+   -> EnableIf_t< IsMatMatMultExpr_v<MT> >
+{
+   using LT = RemoveCVRef_t< LeftOperand_t<MT> >;
+   using RT = RemoveCVRef_t< RightOperand_t<MT> >;
+
+   offset += MatMatMultChainLength_v<LT>;
+   splits[count++] = offset;
+   collectRightSplits<RT>( splits, count, offset );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Selection of the rotation of a matrix multiplication chain.
+// \ingroup math
+//
+// \param factors The cost model information of all factors of the chain.
+// \param current The current split position of the chain.
+// \param leftSplits The split positions reachable by rotating the left-hand side operand.
+// \param nl The number of split positions reachable by rotating the left-hand side operand.
+// \param rightSplits The split positions reachable by rotating the right-hand side operand.
+// \param nr The number of split positions reachable by rotating the right-hand side operand.
+// \return -1 for a rotation to the left, 1 for a rotation to the right, 0 for no rotation.
+//
+// This function computes the minimum cost of all subchains of the given chain by means of the
+// classic matrix chain dynamic programming algorithm. Based on this, the cost of the chain is
+// evaluated for every reachable split position of the outermost multiplication. A rotation is
+// only selected in case it leads to a split position with a strictly smaller cost. Since the
+// subsequent evaluation of the rotated chain applies the same criterion, the outermost split
+// is moved step by step towards the optimal reachable position.
+*/
+template< size_t L >  // Number of factors of the chain
+inline int selectMatMatMultRotation( const std::array<MatMatMultChainFactor,L>& factors, size_t current,
+                                     const std::array<size_t,L>& leftSplits, size_t nl,
+                                     const std::array<size_t,L>& rightSplits, size_t nr )
+{
+   std::array<double,L*L> cost;
+   std::array<MatMatMultChainFactor,L*L> result;
+
+   for( size_t i=0UL; i<L; ++i ) {
+      cost[i*L+i]   = 0.0;
+      result[i*L+i] = factors[i];
+   }
+
+   for( size_t len=2UL; len<=L; ++len ) {
+      for( size_t i=0UL; i+len<=L; ++i )
+      {
+         const size_t j( i+len-1UL );
+
+         for( size_t s=i; s<j; ++s )
+         {
+            const double c( cost[i*L+s] + cost[(s+1UL)*L+j] +
+                            matMatMultChainCost( result[i*L+s], result[(s+1UL)*L+j] ) );
+
+            if( s == i || c < cost[i*L+j] ) {
+               cost[i*L+j]   = c;
+               result[i*L+j] = matMatMultChainResult( result[i*L+s], result[(s+1UL)*L+j] );
+            }
+         }
+      }
+   }
+
+   const auto splitCost = [&cost,&result]( size_t s )
+   {
+      return cost[s-1UL] + cost[s*L+L-1UL] +
+             matMatMultChainCost( result[s-1UL], result[s*L+L-1UL] );
+   };
+
+   double best( splitCost( current ) );
+   int rotation( 0 );
+
+   for( size_t i=0UL; i<nl; ++i ) {
+      const double c( splitCost( leftSplits[i] ) );
+      if( c < best ) {
+         best = c;
+         rotation = -1;
+      }
+   }
+
+   for( size_t i=0UL; i<nr; ++i ) {
+      const double c( splitCost( rightSplits[i] ) );
+      if( c < best ) {
+         best = c;
+         rotation = 1;
+      }
+   }
+
+   return rotation;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  REORDERING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Rotation of the matrix multiplication chain \f$ (X_1*X_2)*Y \f$ to \f$ X_1*(X_2*Y) \f$.
+// \ingroup math
+//
+// \param lhs The left-hand side matrix/matrix multiplication.
+// \param rhs The right-hand side matrix operand.
+// \param op The assignment operation for the rotated chain.
+// \return void
+*/
+template< typename MT1   // Type of the left-hand side matrix/matrix multiplication
+        , typename MT2   // Type of the right-hand side matrix operand
+        , typename OP >  // Type of the assignment operation
+inline auto rotateMatMatMultChain( const MT1& lhs, const MT2& rhs, OP op, IntegralConstant<int,-1> )
+   -> EnableIf_t< IsMatMatMultExpr_v<MT1> >
+{
+   op( lhs.leftOperand() * ( lhs.rightOperand() * rhs ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Rotation of the matrix multiplication chain \f$ X*(Y_1*Y_2) \f$ to \f$ (X*Y_1)*Y_2 \f$.
+// \ingroup math
+//
+// \param lhs The left-hand side matrix operand.
+// \param rhs The right-hand side matrix/matrix multiplication.
+// \param op The assignment operation for the rotated chain.
+// \return void
+*/
+template< typename MT1   // Type of the left-hand side matrix operand
+        , typename MT2   // Type of the right-hand side matrix/matrix multiplication
+        , typename OP >  // Type of the assignment operation
+inline auto rotateMatMatMultChain( const MT1& lhs, const MT2& rhs, OP op, IntegralConstant<int,1> )
+   -> EnableIf_t< IsMatMatMultExpr_v<MT2> >
+{
+   op( ( lhs * rhs.leftOperand() ) * rhs.rightOperand() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fallback for an impossible rotation of a matrix multiplication chain.
+// \ingroup math
+//
+// \return void
+*/
+template< typename MT1, typename MT2, typename OP, int R >
+inline auto rotateMatMatMultChain( const MT1&, const MT2&, OP, IntegralConstant<int,R> )
+   -> EnableIf_t< ( R == -1 && !IsMatMatMultExpr_v<MT1> ) || ( R == 1 && !IsMatMatMultExpr_v<MT2> ) >
+{}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reordering of a matrix multiplication chain \f$ X*Y \f$.
+// \ingroup math
+//
+// \param lhs The left-hand side operand of the outermost multiplication.
+// \param rhs The right-hand side operand of the outermost multiplication.
+// \param op The assignment operation for the reordered chain.
+// \return \a true in case the chain has been reordered and assigned, \a false if not.
+//
+// This function is used by the matrix/matrix multiplication expressions to select the cheapest
+// evaluation order of a chain of matrix multiplications (as for instance \f$ A*B*C \f$) at
+// runtime. In case either of the two operands is itself a matrix/matrix multiplication and the
+// cost model (see selectMatMatMultRotation()) predicts that a different order is cheaper, the
+// chain is rotated and passed to the given assignment operation. In this case the function
+// returns \a true and the calling assignment operation has to skip its own evaluation. In all
+// other cases the function returns \a false without any effect.
+//
+// The reordering can be disabled for specific multiplications via the \a Enabled template
+// parameter and for all multiplications via the BLAZE_USE_MATRIX_CHAIN_REORDERING switch.
+*/
+template< bool Enabled   // Compile time switch for the reordering
+        , typename MT1   // Type of the left-hand side operand
+        , typename MT2   // Type of the right-hand side operand
+        , typename OP >  // Type of the assignment operation
+inline auto reassociateMatMatMult( const MT1& lhs, const MT2& rhs, OP op )
+   -> EnableIf_t< useMatrixChainReordering && Enabled &&
+                  ( IsMatMatMultExpr_v<MT1> || IsMatMatMultExpr_v<MT2> ), bool >
+{
+   constexpr size_t L( MatMatMultChainLength_v<MT1> + MatMatMultChainLength_v<MT2> );
+
+   std::array<MatMatMultChainFactor,L> factors;
+   size_t index( 0UL );
+
+   collectMatMatMultChain( lhs, factors, index );
+   collectMatMatMultChain( rhs, factors, index );
+
+   std::array<size_t,L> leftSplits{};
+   std::array<size_t,L> rightSplits{};
+   size_t nl( 0UL );
+   size_t nr( 0UL );
+
+   collectLeftSplits<MT1>( leftSplits, nl );
+   collectRightSplits<MT2>( rightSplits, nr, MatMatMultChainLength_v<MT1> );
+
+   const int rotation( selectMatMatMultRotation( factors, MatMatMultChainLength_v<MT1>,
+                                                 leftSplits, nl, rightSplits, nr ) );
+
+   if( rotation < 0 ) {
+      rotateMatMatMultChain( lhs, rhs, op, IntegralConstant<int,-1>() );
+      return true;
+   }
+   else if( rotation > 0 ) {
+      rotateMatMatMultChain( lhs, rhs, op, IntegralConstant<int,1>() );
+      return true;
+   }
+
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reordering of a matrix multiplication \f$ X*Y \f$ that is not part of a chain.
+// \ingroup math
+//
+// \return \a false.
+*/
+template< bool Enabled, typename MT1, typename MT2, typename OP >
+inline auto reassociateMatMatMult( const MT1&, const MT2&, OP )
+   -> EnableIf_t< !( useMatrixChainReordering && Enabled &&
+                     ( IsMatMatMultExpr_v<MT1> || IsMatMatMultExpr_v<MT2> ) ), bool >
+{
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
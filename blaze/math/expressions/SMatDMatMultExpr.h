@@ -53,6 +53,7 @@
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/Forward.h>
+#include <blaze/math/expressions/MatMatMultChain.h>
 #include <blaze/math/expressions/MatMatMultExpr.h>
 #include <blaze/math/functors/DeclDiag.h>
 #include <blaze/math/functors/DeclHerm.h>
@@ -486,6 +487,11 @@ class SMatDMatMultExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( rhs.lhs_, rhs.rhs_,
+             [&lhs]( const auto& expr ){ assign( ~lhs, expr ); } ) ) {
+         return;
+      }
+
       LT A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side sparse matrix operand
       RT B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -901,6 +907,11 @@ class SMatDMatMultExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( rhs.lhs_, rhs.rhs_,
+             [&lhs]( const auto& expr ){ addAssign( ~lhs, expr ); } ) ) {
+         return;
+      }
+
       LT A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side sparse matrix operand
       RT B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -1258,6 +1269,11 @@ class SMatDMatMultExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( rhs.lhs_, rhs.rhs_,
+             [&lhs]( const auto& expr ){ subAssign( ~lhs, expr ); } ) ) {
+         return;
+      }
+
       LT A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side sparse matrix operand
       RT B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -1662,6 +1678,11 @@ class SMatDMatMultExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( rhs.lhs_, rhs.rhs_,
+             [&lhs]( const auto& expr ){ smpAssign( ~lhs, expr ); } ) ) {
+         return;
+      }
+
       LT A( rhs.lhs_ );  // Evaluation of the left-hand side sparse matrix operand
       RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense matrix operand
 
@@ -1745,6 +1766,11 @@ class SMatDMatMultExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( rhs.lhs_, rhs.rhs_,
+             [&lhs]( const auto& expr ){ smpAddAssign( ~lhs, expr ); } ) ) {
+         return;
+      }
+
       LT A( rhs.lhs_ );  // Evaluation of the left-hand side sparse matrix operand
       RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense matrix operand
 
@@ -1790,6 +1816,11 @@ class SMatDMatMultExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( rhs.lhs_, rhs.rhs_,
+             [&lhs]( const auto& expr ){ smpSubAssign( ~lhs, expr ); } ) ) {
+         return;
+      }
+
       LT A( rhs.lhs_ );  // Evaluation of the left-hand side sparse matrix operand
       RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense matrix operand
 
@@ -41,6 +41,7 @@
 //*************************************************************************************************
 
 #include <algorithm>
+#include <vector>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/Identity.h>
 #include <blaze/math/constraints/MatMatMultExpr.h>
@@ -58,6 +59,10 @@
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/sparse/Forward.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/typetraits/IsColumnMajorMatrix.h>
 #include <blaze/math/typetraits/IsDiagonal.h>
@@ -65,6 +70,7 @@
 #include <blaze/math/typetraits/IsIdentity.h>
 #include <blaze/math/typetraits/IsLower.h>
 #include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/math/typetraits/IsSparseMatrix.h>
 #include <blaze/math/typetraits/IsStrictlyLower.h>
 #include <blaze/math/typetraits/IsStrictlyUpper.h>
 #include <blaze/math/typetraits/IsSymmetric.h>
@@ -84,10 +90,233 @@
 #include <blaze/util/mpl/If.h>
 #include <blaze/util/SmallArray.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsSame.h>
 
 
 namespace blaze {
 
+//=================================================================================================
+//
+//  CLASS SMATSMATMULTACCUMULATOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Row accumulator for the parallel sparse matrix-sparse matrix multiplication.
+// \ingroup sparse_matrix
+//
+// The SMatSMatMultAccumulator class template collects the contributions to a single row of a
+// sparse matrix-sparse matrix product. Depending on the maximum number of contributions to the
+// row, the accumulator either uses a dense table over all columns of the result or an open
+// addressing hash table, whose size is proportional to the number of contributions. Therefore
+// the memory traffic of very sparse rows is independent of the number of columns of the result.
+*/
+template< typename Type >  // Type of the accumulated values
+class SMatSMatMultAccumulator
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the SMatSMatMultAccumulator class template.
+   //
+   // \param n The number of columns of the resulting matrix.
+   */
+   explicit inline SMatSMatMultAccumulator( size_t n )
+      : n_      ( n )      // The number of columns of the resulting matrix
+      , dense_  ( false )  // Flag for the dense accumulation of the current row
+      , mask_   ( 0UL )    // Bit mask for the hash table
+      , table_  ()         // Dense table of positions
+      , keys_   ()         // Column indices of the hash table
+      , slots_  ()         // Positions of the hash table
+      , columns_()         // Column indices of the current row
+      , values_ ()         // Accumulated values of the current row
+   {}
+   //**********************************************************************************************
+
+   //**Init function*******************************************************************************
+   /*!\brief Prepares the accumulator for the next row.
+   //
+   // \param flops The maximum number of contributions to the next row.
+   // \return void
+   */
+   inline void init( size_t flops )
+   {
+      dense_ = ( flops * denseFactor >= n_ );
+
+      if( dense_ ) {
+         if( table_.size() != n_ )
+            table_.assign( n_, invalid );
+      }
+      else {
+         size_t capacity( 16UL );
+         while( capacity < flops + flops )
+            capacity *= 2UL;
+         if( keys_.size() < capacity ) {
+            keys_.resize( capacity );
+            slots_.resize( capacity );
+         }
+         std::fill( keys_.begin(), keys_.begin()+capacity, invalid );
+         mask_ = capacity - 1UL;
+      }
+   }
+   //**********************************************************************************************
+
+   //**Insert function*****************************************************************************
+   /*!\brief Registers a contribution to the given column of the current row.
+   //
+   // \param j The column index of the contribution.
+   // \return void
+   */
+   inline void insert( size_t j )
+   {
+      size_t& pos( position( j ) );
+      if( pos == invalid ) {
+         pos = columns_.size();
+         columns_.push_back( j );
+      }
+   }
+   //**********************************************************************************************
+
+   //**Add function********************************************************************************
+   /*!\brief Adds a contribution to the given column of the current row.
+   //
+   // \param j The column index of the contribution.
+   // \param value The value of the contribution.
+   // \return void
+   */
+   template< typename T >  // Type of the contribution
+   inline void add( size_t j, const T& value )
+   {
+      size_t& pos( position( j ) );
+      if( pos == invalid ) {
+         pos = columns_.size();
+         columns_.push_back( j );
+         values_.push_back( value );
+      }
+      else {
+         values_[pos] += value;
+      }
+   }
+   //**********************************************************************************************
+
+   //**Size function*******************************************************************************
+   /*!\brief Returns the number of non-zero columns of the current row.
+   //
+   // \return The number of non-zero columns of the current row.
+   */
+   inline size_t size() const noexcept
+   {
+      return columns_.size();
+   }
+   //**********************************************************************************************
+
+   //**Store function******************************************************************************
+   /*!\brief Appends the accumulated row to the given sparse matrix.
+   //
+   // \param C The target sparse matrix.
+   // \param i The index of the target row.
+   // \return void
+   //
+   // This function appends all non-default accumulated values in ascending column order to row
+   // \a i of the given matrix. The capacity of the row has to be sufficient for all elements.
+   */
+   template< typename MT >  // Type of the target sparse matrix
+   inline void store( MT& C, size_t i )
+   {
+      std::sort( columns_.begin(), columns_.end() );
+
+      for( size_t j : columns_ ) {
+         const Type& value( values_[ position( j ) ] );
+         if( !isDefault( value ) )
+            C.append( i, j, value );
+      }
+   }
+   //**********************************************************************************************
+
+   //**Clear function******************************************************************************
+   /*!\brief Resets the accumulator after the completion of a row.
+   //
+   // \return void
+   */
+   inline void clear()
+   {
+      if( dense_ ) {
+         for( size_t j : columns_ )
+            table_[j] = invalid;
+      }
+
+      columns_.clear();
+      values_.clear();
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Position function***************************************************************************
+   /*!\brief Returns the position of the given column within the current row.
+   //
+   // \param j The column index.
+   // \return Reference to the position of the column (\a invalid in case of a new column).
+   */
+   inline size_t& position( size_t j )
+   {
+      if( dense_ )
+         return table_[j];
+
+      size_t k( ( j * 2654435761UL ) & mask_ );
+      while( keys_[k] != j ) {
+         if( keys_[k] == invalid ) {
+            keys_ [k] = j;
+            slots_[k] = invalid;
+            break;
+         }
+         k = ( k + 1UL ) & mask_;
+      }
+      return slots_[k];
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Marker for unused table entries.
+   static constexpr size_t invalid = size_t(-1);
+
+   //! Minimum ratio between the columns of the result and the contributions for hashing.
+   static constexpr size_t denseFactor = 16UL;
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   size_t n_;                     //!< The number of columns of the resulting matrix.
+   bool dense_;                   //!< Flag for the dense accumulation of the current row.
+   size_t mask_;                  //!< Bit mask for the hash table.
+   std::vector<size_t> table_;    //!< Dense table of positions.
+   std::vector<size_t> keys_;     //!< Column indices of the hash table.
+   std::vector<size_t> slots_;    //!< Positions of the hash table.
+   std::vector<size_t> columns_;  //!< Column indices of the current row.
+   std::vector<Type> values_;     //!< Accumulated values of the current row.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+/*! \cond BLAZE_INTERNAL */
+template< typename Type >
+constexpr size_t SMatSMatMultAccumulator<Type>::invalid;
+
+template< typename Type >
+constexpr size_t SMatSMatMultAccumulator<Type>::denseFactor;
+/*! \endcond */
+
+
+
+
 //=================================================================================================
 //
 //  CLASS SMATSMATMULTEXPR
@@ -150,6 +379,26 @@ class SMatSMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! This variable template is a helper for the selection of the parallel evaluation strategy.
+       In case the target matrix is a sparse matrix and the result type of the multiplication is
+       a row-major CompressedMatrix, the variable is set to 1 and the two-phase parallel kernel
+       is selected. Otherwise the variable is set to 0 and the default strategy is chosen. */
+   template< typename T1 >
+   static constexpr bool UseParallelKernel_v =
+      ( IsSparseMatrix_v<T1> &&
+        IsSame_v< MultTrait_t<RT1,RT2>
+                , CompressedMatrix< ElementType_t< MultTrait_t<RT1,RT2> >, false > > );
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Number of row blocks of approximately equal work for the parallel kernel.
+   static constexpr size_t smpBlocks = 1024UL;
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
    using This          = SMatSMatMultExpr<MT1,MT2>;    //!< Type of this SMatSMatMultExpr instance.
@@ -890,7 +1139,7 @@ class SMatSMatMultExpr
    template< typename MT  // Type of the target matrix
            , bool SO >    // Storage order of the target matrix
    friend inline auto smpAssign( Matrix<MT,SO>& lhs, const SMatSMatMultExpr& rhs )
-      -> EnableIf_t< IsEvaluationRequired_v<MT,MT1,MT2> >
+      -> EnableIf_t< IsEvaluationRequired_v<MT,MT1,MT2> && !UseParallelKernel_v<MT> >
    {
       BLAZE_FUNCTION_TRACE;
 
@@ -943,6 +1192,203 @@ class SMatSMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMP assignment to row-major sparse matrices************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a sparse matrix-sparse matrix multiplication to a row-major sparse
+   //        matrix (\f$ C=A*B \f$).
+   // \ingroup sparse_matrix
+   //
+   // \param lhs The target left-hand side sparse matrix.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a sparse matrix-sparse
+   // matrix multiplication expression to a row-major sparse matrix. The rows of the result are
+   // split into blocks of approximately equal work, which are processed in two parallel phases:
+   // The symbolic phase computes the exact number of non-zero elements of each row, which is
+   // used to allocate the resulting matrix. The numeric phase subsequently computes the values
+   // and appends them directly to the preallocated rows. Due to the explicit application of the
+   // SFINAE principle this function can only be selected by the compiler in case the result
+   // type of the multiplication is a row-major CompressedMatrix.
+   */
+   template< typename MT >  // Type of the target sparse matrix
+   friend inline auto smpAssign( SparseMatrix<MT,false>& lhs, const SMatSMatMultExpr& rhs )
+      -> EnableIf_t< UseParallelKernel_v<MT> >
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      CT1 A( rhs.lhs_ );  // Evaluation of the left-hand side sparse matrix operand
+      CT2 B( rhs.rhs_ );  // Evaluation of the right-hand side sparse matrix operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.lhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.lhs_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( B.rows()    == rhs.rhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == rhs.rhs_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).rows()     , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == (~lhs).columns()  , "Invalid number of columns" );
+
+      if( isSerialSectionActive() || getNumThreads() < 2UL || !rhs.canSMPAssign() ) {
+         assign( ~lhs, A * B );
+         return;
+      }
+
+      const size_t m( A.rows()    );
+      const size_t n( B.columns() );
+
+      // Computing the maximum number of contributions to each row of the resulting matrix
+      std::vector<size_t> flops( m+1UL, 0UL );
+
+      smpFor( m, [&A,&B,&flops]( size_t begin, size_t end )
+      {
+         for( size_t i=begin; i<end; ++i ) {
+            size_t count( 0UL );
+            const auto lend( A.end(i) );
+            for( auto lelem=A.begin(i); lelem!=lend; ++lelem ) {
+               count += B.nonZeros( lelem->index() );
+            }
+            flops[i+1UL] = count;
+         }
+      } );
+
+      for( size_t i=0UL; i<m; ++i ) {
+         flops[i+1UL] += flops[i];
+      }
+
+      // Partitioning the rows into blocks of approximately equal work
+      const size_t blocks( min( m, smpBlocks ) );
+      std::vector<size_t> bounds( blocks+1UL, m );
+
+      for( size_t k=0UL; k<blocks; ++k ) {
+         const size_t work( ( flops[m] / blocks ) * k );
+         bounds[k] = std::lower_bound( flops.begin(), flops.begin()+m, work ) - flops.begin();
+      }
+
+      // Symbolic phase: computing the exact number of non-zero elements of each row
+      std::vector<size_t> nonzeros( m, 0UL );
+
+      smpFor( blocks, [&A,&B,&flops,&bounds,&nonzeros,n]( size_t begin, size_t end )
+      {
+         SMatSMatMultAccumulator<ElementType> accumulator( n );
+
+         for( size_t i=bounds[begin]; i<bounds[end]; ++i )
+         {
+            accumulator.init( flops[i+1UL] - flops[i] );
+
+            const auto lend( A.end(i) );
+            for( auto lelem=A.begin(i); lelem!=lend; ++lelem ) {
+               const auto rend( B.end( lelem->index() ) );
+               for( auto relem=B.begin( lelem->index() ); relem!=rend; ++relem ) {
+                  accumulator.insert( relem->index() );
+               }
+            }
+
+            nonzeros[i] = accumulator.size();
+            accumulator.clear();
+         }
+      } );
+
+      // Numeric phase: computing the values directly into the preallocated rows
+      ResultType C( m, n, nonzeros );
+
+      smpFor( blocks, [&A,&B,&C,&flops,&bounds,n]( size_t begin, size_t end )
+      {
+         SMatSMatMultAccumulator<ElementType> accumulator( n );
+
+         for( size_t i=bounds[begin]; i<bounds[end]; ++i )
+         {
+            accumulator.init( flops[i+1UL] - flops[i] );
+
+            const auto lend( A.end(i) );
+            for( auto lelem=A.begin(i); lelem!=lend; ++lelem ) {
+               const auto rend( B.end( lelem->index() ) );
+               for( auto relem=B.begin( lelem->index() ); relem!=rend; ++relem ) {
+                  accumulator.add( relem->index(), lelem->value() * relem->value() );
+               }
+            }
+
+            accumulator.store( C, i );
+            accumulator.clear();
+         }
+      } );
+
+      SMatSMatMultExpr::transfer( ~lhs, C );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP assignment to column-major sparse matrices*********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a sparse matrix-sparse matrix multiplication to a column-major
+   //        sparse matrix (\f$ C=A*B \f$).
+   // \ingroup sparse_matrix
+   //
+   // \param lhs The target left-hand side sparse matrix.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a sparse matrix-sparse
+   // matrix multiplication expression to a column-major sparse matrix. The multiplication is
+   // evaluated in parallel into a row-major temporary, which is subsequently transposed into the
+   // target matrix.
+   */
+   template< typename MT >  // Type of the target sparse matrix
+   friend inline auto smpAssign( SparseMatrix<MT,true>& lhs, const SMatSMatMultExpr& rhs )
+      -> EnableIf_t< UseParallelKernel_v<MT> && !CanExploitSymmetry_v<MT,MT1,MT2> >
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      ResultType tmp( rhs.rows(), rhs.columns() );
+      smpAssign( tmp, rhs );
+      (~lhs).reserve( tmp.nonZeros() );
+      assign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Transfer of the parallel result*************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Transfer of the result of the parallel kernel to a target of the same type.
+   // \ingroup sparse_matrix
+   //
+   // \param lhs The target left-hand side sparse matrix.
+   // \param C The result of the parallel kernel.
+   // \return void
+   */
+   template< typename MT >  // Type of the target sparse matrix
+   static inline auto transfer( MT& lhs, ResultType& C )
+      -> EnableIf_t< IsSame_v<MT,ResultType> >
+   {
+      lhs.swap( C );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Transfer of the parallel result*************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Transfer of the result of the parallel kernel to a target of different type.
+   // \ingroup sparse_matrix
+   //
+   // \param lhs The target left-hand side sparse matrix.
+   // \param C The result of the parallel kernel.
+   // \return void
+   */
+   template< typename MT >  // Type of the target sparse matrix
+   static inline auto transfer( MT& lhs, ResultType& C )
+      -> DisableIf_t< IsSame_v<MT,ResultType> >
+   {
+      assign( lhs, C );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP addition assignment to dense matrices***************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief SMP addition assignment of a sparse matrix-sparse matrix multiplication to a dense
@@ -1157,6 +1603,20 @@ class SMatSMatMultExpr
 
 
 
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+/*! \cond BLAZE_INTERNAL */
+template< typename MT1, typename MT2 >
+constexpr size_t SMatSMatMultExpr<MT1,MT2>::smpBlocks;
+/*! \endcond */
+
+
+
+
 //=================================================================================================
 //
 //  GLOBAL BINARY ARITHMETIC OPERATORS
@@ -48,21 +48,244 @@
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/SparseVector.h>
+#include <blaze/math/shims/PrevMultiple.h>
+#include <blaze/math/SIMD.h>
 #include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasSIMDAdd.h>
+#include <blaze/math/typetraits/HasSIMDGather.h>
+#include <blaze/math/typetraits/HasSIMDMult.h>
+#include <blaze/math/typetraits/IsContiguous.h>
+#include <blaze/math/typetraits/IsSoAIterator.h>
 #include <blaze/system/MacroDisable.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
+#include <blaze/util/IntegralConstant.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsSame.h>
 #include <blaze/util/typetraits/RemoveReference.h>
 
 
 namespace blaze {
 
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the gather-based index type of a sparse vector.
+// \ingroup sparse_vector
+*/
+template< typename IteratorType  // Type of the sparse vector iterator
+        , bool = IsSoAIterator_v<IteratorType> >
+struct SVecDVecInnerExprIndex
+{
+   //**********************************************************************************************
+   //! Placeholder index type in case the sparse vector does not provide split storage.
+   using Type = void;
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the SVecDVecInnerExprIndex class template for split storage.
+// \ingroup sparse_vector
+*/
+template< typename IteratorType >  // Type of the sparse vector iterator
+struct SVecDVecInnerExprIndex<IteratorType,true>
+{
+   //**********************************************************************************************
+   //! Type of the indices stored in the sparse vector.
+   using Type = typename IteratorType::IndexType;
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the sparse vector/dense vector scalar multiplication.
+// \ingroup sparse_vector
+*/
+template< typename VT1    // Type of the left-hand side sparse vector
+        , typename VT2 >  // Type of the right-hand side dense vector
+struct SVecDVecInnerExprHelper
+{
+   //**Type definitions****************************************************************************
+   //! Composite type of the left-hand side sparse vector expression.
+   using CT1 = RemoveReference_t< CompositeType_t<VT1> >;
+
+   //! Composite type of the right-hand side dense vector expression.
+   using CT2 = RemoveReference_t< CompositeType_t<VT2> >;
+
+   //! Type of the indices of the left-hand side sparse vector expression.
+   using IT = typename SVecDVecInnerExprIndex< ConstIterator_t<CT1> >::Type;
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   static constexpr bool value =
+      ( useOptimizedKernels &&
+        IsSoAIterator_v< ConstIterator_t<CT1> > &&
+        IsContiguous_v<CT2> &&
+        HasConstDataAccess_v<CT2> &&
+        IsSame_v< ElementType_t<CT1>, ElementType_t<CT2> > &&
+        HasSIMDGather_v< ElementType_t<CT1>, IT > &&
+        HasSIMDAdd_v< ElementType_t<CT1>, ElementType_t<CT1> > &&
+        HasSIMDMult_v< ElementType_t<CT1>, ElementType_t<CT1> > );
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  GLOBAL BINARY ARITHMETIC OPERATORS
 //
 //=================================================================================================
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default backend implementation of the scalar product (inner product) of a sparse and
+//        a dense vector (\f$ s=\vec{a}*\vec{b} \f$).
+// \ingroup sparse_vector
+//
+// \param lhs The left-hand side sparse vector for the inner product.
+// \param rhs The right-hand side dense vector for the inner product.
+// \return The scalar product.
+//
+// This function implements the default scalar product of a sparse and a dense vector. Due to
+// the explicit application of the SFINAE principle, this function can only be selected by the
+// compiler in case the gather-based kernel cannot be applied.
+*/
+template< typename VT1    // Type of the left-hand side sparse vector
+        , typename VT2 >  // Type of the right-hand side dense vector
+inline auto svecdvecinner( const SparseVector<VT1,true>& lhs, const DenseVector<VT2,false>& rhs )
+   -> DisableIf_t< SVecDVecInnerExprHelper<VT1,VT2>::value
+                 , const MultTrait_t< ElementType_t<VT1>, ElementType_t<VT2> > >
+{
+   using CT1      = CompositeType_t<VT1>;
+   using CT2      = CompositeType_t<VT2>;
+   using ET1      = ElementType_t<VT1>;
+   using ET2      = ElementType_t<VT2>;
+   using MultType = MultTrait_t<ET1,ET2>;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
+
+   CT1 left ( ~lhs );
+   CT2 right( ~rhs );
+
+   auto element( left.begin() );
+   auto end    ( left.end()   );
+
+   MultType sp{};
+
+   if( element != end ) {
+      sp = element->value() * right[ element->index() ];
+      ++element;
+      for( ; element!=end; ++element )
+         sp += element->value() * right[ element->index() ];
+   }
+
+   return sp;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Gather-based backend implementation of the scalar product (inner product) of a sparse
+//        and a dense vector (\f$ s=\vec{a}*\vec{b} \f$).
+// \ingroup sparse_vector
+//
+// \param lhs The left-hand side sparse vector for the inner product.
+// \param rhs The right-hand side dense vector for the inner product.
+// \return The scalar product.
+//
+// This function implements the SIMD optimized scalar product of a sparse vector with split
+// value/index storage and a contiguous dense vector. The values of the sparse vector are loaded
+// directly from the value array, whereas the according elements of the dense vector are loaded
+// by means of SIMD gathers via the index array. Due to the explicit application of the SFINAE
+// principle, this function can only be selected by the compiler in case the gather-based kernel
+// can be applied.
+*/
+template< typename VT1    // Type of the left-hand side sparse vector
+        , typename VT2 >  // Type of the right-hand side dense vector
+inline auto svecdvecinner( const SparseVector<VT1,true>& lhs, const DenseVector<VT2,false>& rhs )
+   -> EnableIf_t< SVecDVecInnerExprHelper<VT1,VT2>::value
+                , const MultTrait_t< ElementType_t<VT1>, ElementType_t<VT2> > >
+{
+   using CT1      = CompositeType_t<VT1>;
+   using CT2      = CompositeType_t<VT2>;
+   using ET1      = ElementType_t<VT1>;
+   using ET2      = ElementType_t<VT2>;
+   using MultType = MultTrait_t<ET1,ET2>;
+   using IT       = typename SVecDVecInnerExprHelper<VT1,VT2>::IT;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
+
+   CT1 left ( ~lhs );
+   CT2 right( ~rhs );
+
+   auto element( left.begin() );
+   auto end    ( left.end()   );
+
+   const size_t nonzeros( end - element );
+
+   if( nonzeros == 0UL ) return MultType();
+
+   const auto* values ( element.valueBase() );
+   const IT*   indices( element.indexBase() );
+   const auto* data   ( right.data() );
+
+   constexpr size_t SIMDSIZE = SIMDTrait<MultType>::size;
+
+   // The 4-byte gathers interpret the indices as signed integral values
+   const bool vectorizable( sizeof(IT) == 8UL || right.size() <= 0x7FFFFFFFUL );
+   const size_t ipos( vectorizable ? prevMultiple( nonzeros, SIMDSIZE ) : 0UL );
+   BLAZE_INTERNAL_ASSERT( ipos <= nonzeros, "Invalid end calculation" );
+
+   SIMDTrait_t<MultType> xmm1, xmm2, xmm3, xmm4;
+   size_t i( 0UL );
+
+   for( ; (i+SIMDSIZE*3UL) < ipos; i+=SIMDSIZE*4UL ) {
+      xmm1 = xmm1 + ( loadu( values+i              ) * gather( data, indices+i              ) );
+      xmm2 = xmm2 + ( loadu( values+i+SIMDSIZE     ) * gather( data, indices+i+SIMDSIZE     ) );
+      xmm3 = xmm3 + ( loadu( values+i+SIMDSIZE*2UL ) * gather( data, indices+i+SIMDSIZE*2UL ) );
+      xmm4 = xmm4 + ( loadu( values+i+SIMDSIZE*3UL ) * gather( data, indices+i+SIMDSIZE*3UL ) );
+   }
+   for( ; (i+SIMDSIZE) < ipos; i+=SIMDSIZE*2UL ) {
+      xmm1 = xmm1 + ( loadu( values+i          ) * gather( data, indices+i          ) );
+      xmm2 = xmm2 + ( loadu( values+i+SIMDSIZE ) * gather( data, indices+i+SIMDSIZE ) );
+   }
+   for( ; i<ipos; i+=SIMDSIZE ) {
+      xmm1 = xmm1 + ( loadu( values+i ) * gather( data, indices+i ) );
+   }
+
+   MultType sp( sum( xmm1 + xmm2 + xmm3 + xmm4 ) );
+
+   for( ; i<nonzeros; ++i ) {
+      sp += values[i] * data[ indices[i] ];
+   }
+
+   return sp;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Multiplication operator for the scalar product (inner product) of a sparse and a
 //        dense vector (\f$ s=\vec{a}*\vec{b} \f$).
@@ -101,14 +324,6 @@ inline decltype(auto)
 {
    BLAZE_FUNCTION_TRACE;
 
-   using CT1      = CompositeType_t<VT1>;    // Composite type of the left-hand side sparse vector expression
-   using CT2      = CompositeType_t<VT2>;    // Composite type of the right-hand side dense vector expression
-   using XT1      = RemoveReference_t<CT1>;  // Auxiliary type for the left-hand side composite type
-   using XT2      = RemoveReference_t<CT2>;  // Auxiliary type for the right-hand side composite type
-   using ET1      = ElementType_t<XT1>;      // Element type of the left-hand side sparse vector expression
-   using ET2      = ElementType_t<XT2>;      // Element type of the right-hand side dense vector expression
-   using MultType = MultTrait_t<ET1,ET2>;    // Multiplication result type
-
    BLAZE_CONSTRAINT_MUST_BE_SPARSE_VECTOR_TYPE( VT1 );
    BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE ( VT2 );
    BLAZE_CONSTRAINT_MUST_BE_ROW_VECTOR_TYPE   ( VT1 );
@@ -118,22 +333,7 @@ inline decltype(auto)
       BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
    }
 
-   CT1 left ( ~lhs );
-   CT2 right( ~rhs );
-
-   auto element( left.begin() );
-   auto end    ( left.end()   );
-
-   MultType sp{};
-
-   if( element != end ) {
-      sp = element->value() * right[ element->index() ];
-      ++element;
-      for( ; element!=end; ++element )
-         sp += element->value() * right[ element->index() ];
-   }
-
-   return sp;
+   return svecdvecinner( ~lhs, ~rhs );
 }
 //*************************************************************************************************
 
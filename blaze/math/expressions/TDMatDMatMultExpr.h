@@ -54,6 +54,7 @@
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/Forward.h>
+#include <blaze/math/expressions/MatMatMultChain.h>
 #include <blaze/math/expressions/MatMatMultExpr.h>
 #include <blaze/math/expressions/MatScalarMultExpr.h>
 #include <blaze/math/functors/DeclDiag.h>
@@ -110,6 +111,7 @@
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
 #include <blaze/util/IntegralConstant.h>
+#include <blaze/util/KernelProfile.h>
 #include <blaze/util/mpl/If.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/IsBuiltin.h>
@@ -508,6 +510,11 @@ class TDMatDMatMultExpr
          return;
       }
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( rhs.lhs_, rhs.rhs_,
+             [&lhs]( const auto& expr ){ assign( ~lhs, expr ); } ) ) {
+         return;
+      }
+
       LT A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side dense matrix operand
       RT B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -542,10 +549,22 @@ class TDMatDMatMultExpr
       if( ( IsDiagonal_v<MT4> && IsDiagonal_v<MT5> ) ||
           ( !BLAZE_DEBUG_MODE && IsRowMajorMatrix_v<MT3> && B.columns() <= SIMDSIZE*10UL ) ||
           ( !BLAZE_DEBUG_MODE && IsColumnMajorMatrix_v<MT3> && A.rows() <= SIMDSIZE*10UL ) ||
-          ( C.rows() * C.columns() < TDMATDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < TDMATDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_PROFILE( "tdmatdmatmult.assign.small", 1UL, A.rows(), B.columns(), A.columns(),
+                               2.0*A.rows()*B.columns()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + B.rows()*B.columns() +
+                                                     C.rows()*C.columns() ) );
          selectSmallAssignKernel( C, A, B );
-      else
+      }
+      else {
+         BLAZE_KERNEL_PROFILE( ( UseBlasKernel_v<MT3,MT4,MT5> ? "tdmatdmatmult.assign.blas"
+                                                              : "tdmatdmatmult.assign.large" ),
+                               1UL, A.rows(), B.columns(), A.columns(),
+                               2.0*A.rows()*B.columns()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + B.rows()*B.columns() +
+                                                     C.rows()*C.columns() ) );
          selectBlasAssignKernel( C, A, B );
+      }
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -3292,6 +3311,11 @@ class TDMatDMatMultExpr
          return;
       }
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( rhs.lhs_, rhs.rhs_,
+             [&lhs]( const auto& expr ){ addAssign( ~lhs, expr ); } ) ) {
+         return;
+      }
+
       LT A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side dense matrix operand
       RT B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -3326,10 +3350,22 @@ class TDMatDMatMultExpr
       if( ( IsDiagonal_v<MT4> && IsDiagonal_v<MT5> ) ||
           ( !BLAZE_DEBUG_MODE && IsRowMajorMatrix_v<MT3> && B.columns() <= SIMDSIZE*10UL ) ||
           ( !BLAZE_DEBUG_MODE && IsColumnMajorMatrix_v<MT3> && A.rows() <= SIMDSIZE*10UL ) ||
-          ( C.rows() * C.columns() < TDMATDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < TDMATDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_PROFILE( "tdmatdmatmult.addassign.small", 1UL, A.rows(), B.columns(), A.columns(),
+                               2.0*A.rows()*B.columns()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + B.rows()*B.columns() +
+                                                     2UL*C.rows()*C.columns() ) );
          selectSmallAddAssignKernel( C, A, B );
-      else
+      }
+      else {
+         BLAZE_KERNEL_PROFILE( ( UseBlasKernel_v<MT3,MT4,MT5> ? "tdmatdmatmult.addassign.blas"
+                                                              : "tdmatdmatmult.addassign.large" ),
+                               1UL, A.rows(), B.columns(), A.columns(),
+                               2.0*A.rows()*B.columns()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + B.rows()*B.columns() +
+                                                     2UL*C.rows()*C.columns() ) );
          selectBlasAddAssignKernel( C, A, B );
+      }
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -5142,6 +5178,11 @@ class TDMatDMatMultExpr
          return;
       }
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( rhs.lhs_, rhs.rhs_,
+             [&lhs]( const auto& expr ){ subAssign( ~lhs, expr ); } ) ) {
+         return;
+      }
+
       LT A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side dense matrix operand
       RT B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -5176,10 +5217,22 @@ class TDMatDMatMultExpr
       if( ( IsDiagonal_v<MT4> && IsDiagonal_v<MT5> ) ||
           ( !BLAZE_DEBUG_MODE && IsRowMajorMatrix_v<MT3> && B.columns() <= SIMDSIZE*10UL ) ||
           ( !BLAZE_DEBUG_MODE && IsColumnMajorMatrix_v<MT3> && A.rows() <= SIMDSIZE*10UL ) ||
-          ( C.rows() * C.columns() < TDMATDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < TDMATDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_PROFILE( "tdmatdmatmult.subassign.small", 1UL, A.rows(), B.columns(), A.columns(),
+                               2.0*A.rows()*B.columns()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + B.rows()*B.columns() +
+                                                     2UL*C.rows()*C.columns() ) );
          selectSmallSubAssignKernel( C, A, B );
-      else
+      }
+      else {
+         BLAZE_KERNEL_PROFILE( ( UseBlasKernel_v<MT3,MT4,MT5> ? "tdmatdmatmult.subassign.blas"
+                                                              : "tdmatdmatmult.subassign.large" ),
+                               1UL, A.rows(), B.columns(), A.columns(),
+                               2.0*A.rows()*B.columns()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + B.rows()*B.columns() +
+                                                     2UL*C.rows()*C.columns() ) );
          selectBlasSubAssignKernel( C, A, B );
+      }
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -7044,6 +7097,11 @@ class TDMatDMatMultExpr
          return;
       }
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( rhs.lhs_, rhs.rhs_,
+             [&lhs]( const auto& expr ){ smpAssign( ~lhs, expr ); } ) ) {
+         return;
+      }
+
       LT A( rhs.lhs_ );  // Evaluation of the left-hand side dense matrix operand
       RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense matrix operand
 
@@ -7132,6 +7190,11 @@ class TDMatDMatMultExpr
          return;
       }
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( rhs.lhs_, rhs.rhs_,
+             [&lhs]( const auto& expr ){ smpAddAssign( ~lhs, expr ); } ) ) {
+         return;
+      }
+
       LT A( rhs.lhs_ );  // Evaluation of the left-hand side dense matrix operand
       RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense matrix operand
 
@@ -7181,6 +7244,11 @@ class TDMatDMatMultExpr
          return;
       }
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( rhs.lhs_, rhs.rhs_,
+             [&lhs]( const auto& expr ){ smpSubAssign( ~lhs, expr ); } ) ) {
+         return;
+      }
+
       LT A( rhs.lhs_ );  // Evaluation of the left-hand side dense matrix operand
       RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense matrix operand
 
@@ -7612,6 +7680,11 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, true >
          return;
       }
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( left, right,
+             [&lhs,&rhs]( const auto& expr ){ assign( ~lhs, expr * rhs.scalar_ ); } ) ) {
+         return;
+      }
+
       LT A( serial( left  ) );  // Evaluation of the left-hand side dense matrix operand
       RT B( serial( right ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -7646,10 +7719,22 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, true >
       if( ( IsDiagonal_v<MT4> && IsDiagonal_v<MT5> ) ||
           ( !BLAZE_DEBUG_MODE && IsRowMajorMatrix_v<MT3> && B.columns() <= SIMDSIZE*10UL ) ||
           ( !BLAZE_DEBUG_MODE && IsColumnMajorMatrix_v<MT3> && A.rows() <= SIMDSIZE*10UL ) ||
-          ( C.rows() * C.columns() < TDMATDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < TDMATDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_PROFILE( "tdmatdmatmult.assign.small", 1UL, A.rows(), B.columns(), A.columns(),
+                               2.0*A.rows()*B.columns()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + B.rows()*B.columns() +
+                                                     C.rows()*C.columns() ) );
          selectSmallAssignKernel( C, A, B, scalar );
-      else
+      }
+      else {
+         BLAZE_KERNEL_PROFILE( ( UseBlasKernel_v<MT3,MT4,MT5,ST2> ? "tdmatdmatmult.assign.blas"
+                                                                  : "tdmatdmatmult.assign.large" ),
+                               1UL, A.rows(), B.columns(), A.columns(),
+                               2.0*A.rows()*B.columns()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + B.rows()*B.columns() +
+                                                     C.rows()*C.columns() ) );
          selectBlasAssignKernel( C, A, B, scalar );
+      }
    }
    //**********************************************************************************************
 
@@ -10432,6 +10517,11 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, true >
          return;
       }
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( left, right,
+             [&lhs,&rhs]( const auto& expr ){ addAssign( ~lhs, expr * rhs.scalar_ ); } ) ) {
+         return;
+      }
+
       LT A( serial( left  ) );  // Evaluation of the left-hand side dense matrix operand
       RT B( serial( right ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -10466,10 +10556,22 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, true >
       if( ( IsDiagonal_v<MT4> && IsDiagonal_v<MT5> ) ||
           ( !BLAZE_DEBUG_MODE && IsRowMajorMatrix_v<MT3> && B.columns() <= SIMDSIZE*10UL ) ||
           ( !BLAZE_DEBUG_MODE && IsColumnMajorMatrix_v<MT3> && A.rows() <= SIMDSIZE*10UL ) ||
-          ( C.rows() * C.columns() < TDMATDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < TDMATDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_PROFILE( "tdmatdmatmult.addassign.small", 1UL, A.rows(), B.columns(), A.columns(),
+                               2.0*A.rows()*B.columns()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + B.rows()*B.columns() +
+                                                     2UL*C.rows()*C.columns() ) );
          selectSmallAddAssignKernel( C, A, B, scalar );
-      else
+      }
+      else {
+         BLAZE_KERNEL_PROFILE( ( UseBlasKernel_v<MT3,MT4,MT5,ST2> ? "tdmatdmatmult.addassign.blas"
+                                                                  : "tdmatdmatmult.addassign.large" ),
+                               1UL, A.rows(), B.columns(), A.columns(),
+                               2.0*A.rows()*B.columns()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + B.rows()*B.columns() +
+                                                     2UL*C.rows()*C.columns() ) );
          selectBlasAddAssignKernel( C, A, B, scalar );
+      }
    }
    //**********************************************************************************************
 
@@ -12427,6 +12529,11 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, true >
          return;
       }
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( left, right,
+             [&lhs,&rhs]( const auto& expr ){ subAssign( ~lhs, expr * rhs.scalar_ ); } ) ) {
+         return;
+      }
+
       LT A( serial( left  ) );  // Evaluation of the left-hand side dense matrix operand
       RT B( serial( right ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -12461,10 +12568,22 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, true >
       if( ( IsDiagonal_v<MT4> && IsDiagonal_v<MT5> ) ||
           ( !BLAZE_DEBUG_MODE && IsRowMajorMatrix_v<MT3> && B.columns() <= SIMDSIZE*10UL ) ||
           ( !BLAZE_DEBUG_MODE && IsColumnMajorMatrix_v<MT3> && A.rows() <= SIMDSIZE*10UL ) ||
-          ( C.rows() * C.columns() < TDMATDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < TDMATDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_PROFILE( "tdmatdmatmult.subassign.small", 1UL, A.rows(), B.columns(), A.columns(),
+                               2.0*A.rows()*B.columns()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + B.rows()*B.columns() +
+                                                     2UL*C.rows()*C.columns() ) );
          selectSmallSubAssignKernel( C, A, B, scalar );
-      else
+      }
+      else {
+         BLAZE_KERNEL_PROFILE( ( UseBlasKernel_v<MT3,MT4,MT5,ST2> ? "tdmatdmatmult.subassign.blas"
+                                                                  : "tdmatdmatmult.subassign.large" ),
+                               1UL, A.rows(), B.columns(), A.columns(),
+                               2.0*A.rows()*B.columns()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + B.rows()*B.columns() +
+                                                     2UL*C.rows()*C.columns() ) );
          selectBlasSubAssignKernel( C, A, B, scalar );
+      }
    }
    //**********************************************************************************************
 
@@ -14472,6 +14591,11 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, true >
          return;
       }
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( left, right,
+             [&lhs,&rhs]( const auto& expr ){ smpAssign( ~lhs, expr * rhs.scalar_ ); } ) ) {
+         return;
+      }
+
       LT A( left  );  // Evaluation of the left-hand side dense matrix operand
       RT B( right );  // Evaluation of the right-hand side dense matrix operand
 
@@ -14559,6 +14683,11 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, true >
          return;
       }
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( left, right,
+             [&lhs,&rhs]( const auto& expr ){ smpAddAssign( ~lhs, expr * rhs.scalar_ ); } ) ) {
+         return;
+      }
+
       LT A( left  );  // Evaluation of the left-hand side dense matrix operand
       RT B( right );  // Evaluation of the right-hand side dense matrix operand
 
@@ -14609,6 +14738,11 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, true >
          return;
       }
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( left, right,
+             [&lhs,&rhs]( const auto& expr ){ smpSubAssign( ~lhs, expr * rhs.scalar_ ); } ) ) {
+         return;
+      }
+
       LT A( left  );  // Evaluation of the left-hand side dense matrix operand
       RT B( right );  // Evaluation of the right-hand side dense matrix operand
 
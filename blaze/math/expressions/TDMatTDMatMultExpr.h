@@ -55,6 +55,7 @@
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/Forward.h>
+#include <blaze/math/expressions/MatMatMultChain.h>
 #include <blaze/math/expressions/MatMatMultExpr.h>
 #include <blaze/math/expressions/MatScalarMultExpr.h>
 #include <blaze/math/functors/DeclDiag.h>
@@ -113,6 +114,7 @@
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
 #include <blaze/util/IntegralConstant.h>
+#include <blaze/util/KernelProfile.h>
 #include <blaze/util/mpl/If.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/IsBuiltin.h>
@@ -527,6 +529,11 @@ class TDMatTDMatMultExpr
          return;
       }
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( rhs.lhs_, rhs.rhs_,
+             [&lhs]( const auto& expr ){ assign( ~lhs, expr ); } ) ) {
+         return;
+      }
+
       LT A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side dense matrix operand
       RT B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -560,10 +567,22 @@ class TDMatTDMatMultExpr
    {
       if( ( IsDiagonal_v<MT4> ) ||
           ( !BLAZE_DEBUG_MODE && A.rows() <= SIMDSIZE*10UL ) ||
-          ( C.rows() * C.columns() < TDMATTDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < TDMATTDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_PROFILE( "tdmattdmatmult.assign.small", 1UL, A.rows(), B.columns(), A.columns(),
+                               2.0*A.rows()*B.columns()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + B.rows()*B.columns() +
+                                                     C.rows()*C.columns() ) );
          selectSmallAssignKernel( C, A, B );
-      else
+      }
+      else {
+         BLAZE_KERNEL_PROFILE( ( UseBlasKernel_v<MT3,MT4,MT5> ? "tdmattdmatmult.assign.blas"
+                                                              : "tdmattdmatmult.assign.large" ),
+                               1UL, A.rows(), B.columns(), A.columns(),
+                               2.0*A.rows()*B.columns()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + B.rows()*B.columns() +
+                                                     C.rows()*C.columns() ) );
          selectBlasAssignKernel( C, A, B );
+      }
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -2148,6 +2167,11 @@ class TDMatTDMatMultExpr
          return;
       }
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( rhs.lhs_, rhs.rhs_,
+             [&lhs]( const auto& expr ){ addAssign( ~lhs, expr ); } ) ) {
+         return;
+      }
+
       LT A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side dense matrix operand
       RT B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -2181,10 +2205,22 @@ class TDMatTDMatMultExpr
    {
       if( ( IsDiagonal_v<MT4> ) ||
           ( !BLAZE_DEBUG_MODE && A.rows() <= SIMDSIZE*10UL ) ||
-          ( C.rows() * C.columns() < TDMATTDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < TDMATTDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_PROFILE( "tdmattdmatmult.addassign.small", 1UL, A.rows(), B.columns(), A.columns(),
+                               2.0*A.rows()*B.columns()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + B.rows()*B.columns() +
+                                                     2UL*C.rows()*C.columns() ) );
          selectSmallAddAssignKernel( C, A, B );
-      else
+      }
+      else {
+         BLAZE_KERNEL_PROFILE( ( UseBlasKernel_v<MT3,MT4,MT5> ? "tdmattdmatmult.addassign.blas"
+                                                              : "tdmattdmatmult.addassign.large" ),
+                               1UL, A.rows(), B.columns(), A.columns(),
+                               2.0*A.rows()*B.columns()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + B.rows()*B.columns() +
+                                                     2UL*C.rows()*C.columns() ) );
          selectBlasAddAssignKernel( C, A, B );
+      }
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -3289,6 +3325,11 @@ class TDMatTDMatMultExpr
          return;
       }
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( rhs.lhs_, rhs.rhs_,
+             [&lhs]( const auto& expr ){ subAssign( ~lhs, expr ); } ) ) {
+         return;
+      }
+
       LT A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side dense matrix operand
       RT B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -3322,10 +3363,22 @@ class TDMatTDMatMultExpr
    {
       if( ( IsDiagonal_v<MT4> ) ||
           ( !BLAZE_DEBUG_MODE && A.rows() <= SIMDSIZE*10UL ) ||
-          ( C.rows() * C.columns() < TDMATTDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < TDMATTDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_PROFILE( "tdmattdmatmult.subassign.small", 1UL, A.rows(), B.columns(), A.columns(),
+                               2.0*A.rows()*B.columns()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + B.rows()*B.columns() +
+                                                     2UL*C.rows()*C.columns() ) );
          selectSmallSubAssignKernel( C, A, B );
-      else
+      }
+      else {
+         BLAZE_KERNEL_PROFILE( ( UseBlasKernel_v<MT3,MT4,MT5> ? "tdmattdmatmult.subassign.blas"
+                                                              : "tdmattdmatmult.subassign.large" ),
+                               1UL, A.rows(), B.columns(), A.columns(),
+                               2.0*A.rows()*B.columns()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + B.rows()*B.columns() +
+                                                     2UL*C.rows()*C.columns() ) );
          selectBlasSubAssignKernel( C, A, B );
+      }
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -4478,6 +4531,11 @@ class TDMatTDMatMultExpr
          return;
       }
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( rhs.lhs_, rhs.rhs_,
+             [&lhs]( const auto& expr ){ smpAssign( ~lhs, expr ); } ) ) {
+         return;
+      }
+
       LT A( rhs.lhs_ );  // Evaluation of the left-hand side dense matrix operand
       RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense matrix operand
 
@@ -4604,6 +4662,11 @@ class TDMatTDMatMultExpr
          return;
       }
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( rhs.lhs_, rhs.rhs_,
+             [&lhs]( const auto& expr ){ smpAddAssign( ~lhs, expr ); } ) ) {
+         return;
+      }
+
       LT A( rhs.lhs_ );  // Evaluation of the left-hand side dense matrix operand
       RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense matrix operand
 
@@ -4692,6 +4755,11 @@ class TDMatTDMatMultExpr
          return;
       }
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( rhs.lhs_, rhs.rhs_,
+             [&lhs]( const auto& expr ){ smpSubAssign( ~lhs, expr ); } ) ) {
+         return;
+      }
+
       LT A( rhs.lhs_ );  // Evaluation of the left-hand side dense matrix operand
       RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense matrix operand
 
@@ -5174,6 +5242,11 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, true >
          return;
       }
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( left, right,
+             [&lhs,&rhs]( const auto& expr ){ assign( ~lhs, expr * rhs.scalar_ ); } ) ) {
+         return;
+      }
+
       LT A( serial( left  ) );  // Evaluation of the left-hand side dense matrix operand
       RT B( serial( right ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -5207,10 +5280,22 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, true >
    {
       if( ( IsDiagonal_v<MT4> ) ||
           ( !BLAZE_DEBUG_MODE && A.rows() <= SIMDSIZE*10UL ) ||
-          ( C.rows() * C.columns() < TDMATTDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < TDMATTDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_PROFILE( "tdmattdmatmult.assign.small", 1UL, A.rows(), B.columns(), A.columns(),
+                               2.0*A.rows()*B.columns()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + B.rows()*B.columns() +
+                                                     C.rows()*C.columns() ) );
          selectSmallAssignKernel( C, A, B, scalar );
-      else
+      }
+      else {
+         BLAZE_KERNEL_PROFILE( ( UseBlasKernel_v<MT3,MT4,MT5,ST2> ? "tdmattdmatmult.assign.blas"
+                                                                  : "tdmattdmatmult.assign.large" ),
+                               1UL, A.rows(), B.columns(), A.columns(),
+                               2.0*A.rows()*B.columns()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + B.rows()*B.columns() +
+                                                     C.rows()*C.columns() ) );
          selectBlasAssignKernel( C, A, B, scalar );
+      }
    }
    //**********************************************************************************************
 
@@ -6813,6 +6898,11 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, true >
          return;
       }
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( left, right,
+             [&lhs,&rhs]( const auto& expr ){ addAssign( ~lhs, expr * rhs.scalar_ ); } ) ) {
+         return;
+      }
+
       LT A( serial( left  ) );  // Evaluation of the left-hand side dense matrix operand
       RT B( serial( right ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -6846,10 +6936,22 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, true >
    {
       if( ( IsDiagonal_v<MT4> ) ||
           ( !BLAZE_DEBUG_MODE && A.rows() <= SIMDSIZE*10UL ) ||
-          ( C.rows() * C.columns() < TDMATTDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < TDMATTDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_PROFILE( "tdmattdmatmult.addassign.small", 1UL, A.rows(), B.columns(), A.columns(),
+                               2.0*A.rows()*B.columns()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + B.rows()*B.columns() +
+                                                     2UL*C.rows()*C.columns() ) );
          selectSmallAddAssignKernel( C, A, B, scalar );
-      else
+      }
+      else {
+         BLAZE_KERNEL_PROFILE( ( UseBlasKernel_v<MT3,MT4,MT5,ST2> ? "tdmattdmatmult.addassign.blas"
+                                                                  : "tdmattdmatmult.addassign.large" ),
+                               1UL, A.rows(), B.columns(), A.columns(),
+                               2.0*A.rows()*B.columns()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + B.rows()*B.columns() +
+                                                     2UL*C.rows()*C.columns() ) );
          selectBlasAddAssignKernel( C, A, B, scalar );
+      }
    }
    //**********************************************************************************************
 
@@ -8043,6 +8145,11 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, true >
          return;
       }
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( left, right,
+             [&lhs,&rhs]( const auto& expr ){ subAssign( ~lhs, expr * rhs.scalar_ ); } ) ) {
+         return;
+      }
+
       LT A( serial( left  ) );  // Evaluation of the left-hand side dense matrix operand
       RT B( serial( right ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -8076,10 +8183,22 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, true >
    {
       if( ( IsDiagonal_v<MT4> ) ||
           ( !BLAZE_DEBUG_MODE && A.rows() <= SIMDSIZE*10UL ) ||
-          ( C.rows() * C.columns() < TDMATTDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < TDMATTDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_PROFILE( "tdmattdmatmult.subassign.small", 1UL, A.rows(), B.columns(), A.columns(),
+                               2.0*A.rows()*B.columns()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + B.rows()*B.columns() +
+                                                     2UL*C.rows()*C.columns() ) );
          selectSmallSubAssignKernel( C, A, B, scalar );
-      else
+      }
+      else {
+         BLAZE_KERNEL_PROFILE( ( UseBlasKernel_v<MT3,MT4,MT5,ST2> ? "tdmattdmatmult.subassign.blas"
+                                                                  : "tdmattdmatmult.subassign.large" ),
+                               1UL, A.rows(), B.columns(), A.columns(),
+                               2.0*A.rows()*B.columns()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + B.rows()*B.columns() +
+                                                     2UL*C.rows()*C.columns() ) );
          selectBlasSubAssignKernel( C, A, B, scalar );
+      }
    }
    //**********************************************************************************************
 
@@ -9321,6 +9440,11 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, true >
          return;
       }
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( left, right,
+             [&lhs,&rhs]( const auto& expr ){ smpAssign( ~lhs, expr * rhs.scalar_ ); } ) ) {
+         return;
+      }
+
       LT A( left  );  // Evaluation of the left-hand side dense matrix operand
       RT B( right );  // Evaluation of the right-hand side dense matrix operand
 
@@ -9447,6 +9571,11 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, true >
          return;
       }
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( left, right,
+             [&lhs,&rhs]( const auto& expr ){ smpAddAssign( ~lhs, expr * rhs.scalar_ ); } ) ) {
+         return;
+      }
+
       LT A( left  );  // Evaluation of the left-hand side dense matrix operand
       RT B( right );  // Evaluation of the right-hand side dense matrix operand
 
@@ -9537,6 +9666,11 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, true >
          return;
       }
 
+      if( reassociateMatMatMult<!( SF || HF || LF || UF )>( left, right,
+             [&lhs,&rhs]( const auto& expr ){ smpSubAssign( ~lhs, expr * rhs.scalar_ ); } ) ) {
+         return;
+      }
+
       LT A( left  );  // Evaluation of the left-hand side dense matrix operand
       RT B( right );  // Evaluation of the right-hand side dense matrix operand
 
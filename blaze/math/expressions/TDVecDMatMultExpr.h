@@ -94,6 +94,7 @@
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
 #include <blaze/util/IntegralConstant.h>
+#include <blaze/util/KernelProfile.h>
 #include <blaze/util/mpl/If.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/IsBuiltin.h>
@@ -448,10 +449,22 @@ class TDVecDMatMultExpr
    {
       if( ( IsDiagonal_v<MT1> ) ||
           ( IsComputation_v<MT> && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < TDVECDMATMULT_THRESHOLD ) )
+          ( A.rows() * A.columns() < TDVECDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_PROFILE( "tdvecdmatmult.assign.small", 1UL, A.rows(), A.columns(), 1UL,
+                               2.0*A.rows()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + x.size() +
+                                                     y.size() ) );
          selectSmallAssignKernel( y, x, A );
-      else
+      }
+      else {
+         BLAZE_KERNEL_PROFILE( ( UseBlasKernel_v<VT1,VT2,MT1> ? "tdvecdmatmult.assign.blas"
+                                                              : "tdvecdmatmult.assign.large" ),
+                               1UL, A.rows(), A.columns(), 1UL,
+                               2.0*A.rows()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + x.size() +
+                                                     y.size() ) );
          selectBlasAssignKernel( y, x, A );
+      }
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1082,10 +1095,22 @@ class TDVecDMatMultExpr
    {
       if( ( IsDiagonal_v<MT1> ) ||
           ( IsComputation_v<MT> && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < TDVECDMATMULT_THRESHOLD ) )
+          ( A.rows() * A.columns() < TDVECDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_PROFILE( "tdvecdmatmult.addassign.small", 1UL, A.rows(), A.columns(), 1UL,
+                               2.0*A.rows()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + x.size() +
+                                                     2UL*y.size() ) );
          selectSmallAddAssignKernel( y, x, A );
-      else
+      }
+      else {
+         BLAZE_KERNEL_PROFILE( ( UseBlasKernel_v<VT1,VT2,MT1> ? "tdvecdmatmult.addassign.blas"
+                                                              : "tdvecdmatmult.addassign.large" ),
+                               1UL, A.rows(), A.columns(), 1UL,
+                               2.0*A.rows()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + x.size() +
+                                                     2UL*y.size() ) );
          selectBlasAddAssignKernel( y, x, A );
+      }
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1666,10 +1691,22 @@ class TDVecDMatMultExpr
    {
       if( ( IsDiagonal_v<MT1> ) ||
           ( IsComputation_v<MT> && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < TDVECDMATMULT_THRESHOLD ) )
+          ( A.rows() * A.columns() < TDVECDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_PROFILE( "tdvecdmatmult.subassign.small", 1UL, A.rows(), A.columns(), 1UL,
+                               2.0*A.rows()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + x.size() +
+                                                     2UL*y.size() ) );
          selectSmallSubAssignKernel( y, x, A );
-      else
+      }
+      else {
+         BLAZE_KERNEL_PROFILE( ( UseBlasKernel_v<VT1,VT2,MT1> ? "tdvecdmatmult.subassign.blas"
+                                                              : "tdvecdmatmult.subassign.large" ),
+                               1UL, A.rows(), A.columns(), 1UL,
+                               2.0*A.rows()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + x.size() +
+                                                     2UL*y.size() ) );
          selectBlasSubAssignKernel( y, x, A );
+      }
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -2843,10 +2880,22 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
    {
       if( ( IsDiagonal_v<MT1> ) ||
           ( IsComputation_v<MT> && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < TDVECDMATMULT_THRESHOLD ) )
+          ( A.rows() * A.columns() < TDVECDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_PROFILE( "tdvecdmatmult.assign.small", 1UL, A.rows(), A.columns(), 1UL,
+                               2.0*A.rows()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + x.size() +
+                                                     y.size() ) );
          selectSmallAssignKernel( y, x, A, scalar );
-      else
+      }
+      else {
+         BLAZE_KERNEL_PROFILE( ( UseBlasKernel_v<VT1,VT2,MT1,ST2> ? "tdvecdmatmult.assign.blas"
+                                                                  : "tdvecdmatmult.assign.large" ),
+                               1UL, A.rows(), A.columns(), 1UL,
+                               2.0*A.rows()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + x.size() +
+                                                     y.size() ) );
          selectBlasAssignKernel( y, x, A, scalar );
+      }
    }
    //**********************************************************************************************
 
@@ -3486,10 +3535,22 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
    {
       if( ( IsDiagonal_v<MT1> ) ||
           ( IsComputation_v<MT> && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < TDVECDMATMULT_THRESHOLD ) )
+          ( A.rows() * A.columns() < TDVECDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_PROFILE( "tdvecdmatmult.addassign.small", 1UL, A.rows(), A.columns(), 1UL,
+                               2.0*A.rows()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + x.size() +
+                                                     2UL*y.size() ) );
          selectSmallAddAssignKernel( y, x, A, scalar );
-      else
+      }
+      else {
+         BLAZE_KERNEL_PROFILE( ( UseBlasKernel_v<VT1,VT2,MT1,ST2> ? "tdvecdmatmult.addassign.blas"
+                                                                  : "tdvecdmatmult.addassign.large" ),
+                               1UL, A.rows(), A.columns(), 1UL,
+                               2.0*A.rows()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + x.size() +
+                                                     2UL*y.size() ) );
          selectBlasAddAssignKernel( y, x, A, scalar );
+      }
    }
    //**********************************************************************************************
 
@@ -4050,10 +4111,22 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
    {
       if( ( IsDiagonal_v<MT1> ) ||
           ( IsComputation_v<MT> && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < TDVECDMATMULT_THRESHOLD ) )
+          ( A.rows() * A.columns() < TDVECDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_PROFILE( "tdvecdmatmult.subassign.small", 1UL, A.rows(), A.columns(), 1UL,
+                               2.0*A.rows()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + x.size() +
+                                                     2UL*y.size() ) );
          selectSmallSubAssignKernel( y, x, A, scalar );
-      else
+      }
+      else {
+         BLAZE_KERNEL_PROFILE( ( UseBlasKernel_v<VT1,VT2,MT1,ST2> ? "tdvecdmatmult.subassign.blas"
+                                                                  : "tdvecdmatmult.subassign.large" ),
+                               1UL, A.rows(), A.columns(), 1UL,
+                               2.0*A.rows()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + x.size() +
+                                                     2UL*y.size() ) );
          selectBlasSubAssignKernel( y, x, A, scalar );
+      }
    }
    //**********************************************************************************************
 
@@ -91,6 +91,7 @@
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
 #include <blaze/util/IntegralConstant.h>
+#include <blaze/util/KernelProfile.h>
 #include <blaze/util/mpl/If.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/IsBuiltin.h>
@@ -445,10 +446,22 @@ class TDVecTDMatMultExpr
    {
       if( ( IsDiagonal_v<MT1> ) ||
           ( IsComputation_v<MT> && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < TDVECTDMATMULT_THRESHOLD ) )
+          ( A.rows() * A.columns() < TDVECTDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_PROFILE( "tdvectdmatmult.assign.small", 1UL, A.rows(), A.columns(), 1UL,
+                               2.0*A.rows()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + x.size() +
+                                                     y.size() ) );
          selectSmallAssignKernel( y, x, A );
-      else
+      }
+      else {
+         BLAZE_KERNEL_PROFILE( ( UseBlasKernel_v<VT1,VT2,MT1> ? "tdvectdmatmult.assign.blas"
+                                                              : "tdvectdmatmult.assign.large" ),
+                               1UL, A.rows(), A.columns(), 1UL,
+                               2.0*A.rows()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + x.size() +
+                                                     y.size() ) );
          selectBlasAssignKernel( y, x, A );
+      }
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1255,10 +1268,22 @@ class TDVecTDMatMultExpr
    {
       if( ( IsDiagonal_v<MT1> ) ||
           ( IsComputation_v<MT> && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < TDVECTDMATMULT_THRESHOLD ) )
+          ( A.rows() * A.columns() < TDVECTDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_PROFILE( "tdvectdmatmult.addassign.small", 1UL, A.rows(), A.columns(), 1UL,
+                               2.0*A.rows()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + x.size() +
+                                                     2UL*y.size() ) );
          selectSmallAddAssignKernel( y, x, A );
-      else
+      }
+      else {
+         BLAZE_KERNEL_PROFILE( ( UseBlasKernel_v<VT1,VT2,MT1> ? "tdvectdmatmult.addassign.blas"
+                                                              : "tdvectdmatmult.addassign.large" ),
+                               1UL, A.rows(), A.columns(), 1UL,
+                               2.0*A.rows()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + x.size() +
+                                                     2UL*y.size() ) );
          selectBlasAddAssignKernel( y, x, A );
+      }
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -2040,10 +2065,22 @@ class TDVecTDMatMultExpr
    {
       if( ( IsDiagonal_v<MT1> ) ||
           ( IsComputation_v<MT> && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < TDVECTDMATMULT_THRESHOLD ) )
+          ( A.rows() * A.columns() < TDVECTDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_PROFILE( "tdvectdmatmult.subassign.small", 1UL, A.rows(), A.columns(), 1UL,
+                               2.0*A.rows()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + x.size() +
+                                                     2UL*y.size() ) );
          selectSmallSubAssignKernel( y, x, A );
-      else
+      }
+      else {
+         BLAZE_KERNEL_PROFILE( ( UseBlasKernel_v<VT1,VT2,MT1> ? "tdvectdmatmult.subassign.blas"
+                                                              : "tdvectdmatmult.subassign.large" ),
+                               1UL, A.rows(), A.columns(), 1UL,
+                               2.0*A.rows()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + x.size() +
+                                                     2UL*y.size() ) );
          selectBlasSubAssignKernel( y, x, A );
+      }
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -3417,10 +3454,22 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
    {
       if( ( IsDiagonal_v<MT1> ) ||
           ( IsComputation_v<MT> && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < TDVECTDMATMULT_THRESHOLD ) )
+          ( A.rows() * A.columns() < TDVECTDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_PROFILE( "tdvectdmatmult.assign.small", 1UL, A.rows(), A.columns(), 1UL,
+                               2.0*A.rows()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + x.size() +
+                                                     y.size() ) );
          selectSmallAssignKernel( y, x, A, scalar );
-      else
+      }
+      else {
+         BLAZE_KERNEL_PROFILE( ( UseBlasKernel_v<VT1,VT2,MT1,ST2> ? "tdvectdmatmult.assign.blas"
+                                                                  : "tdvectdmatmult.assign.large" ),
+                               1UL, A.rows(), A.columns(), 1UL,
+                               2.0*A.rows()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + x.size() +
+                                                     y.size() ) );
          selectBlasAssignKernel( y, x, A, scalar );
+      }
    }
    //**********************************************************************************************
 
@@ -4248,10 +4297,22 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
    {
       if( ( IsDiagonal_v<MT1> ) ||
           ( IsComputation_v<MT> && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < TDVECDMATMULT_THRESHOLD ) )
+          ( A.rows() * A.columns() < TDVECDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_PROFILE( "tdvectdmatmult.addassign.small", 1UL, A.rows(), A.columns(), 1UL,
+                               2.0*A.rows()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + x.size() +
+                                                     2UL*y.size() ) );
          selectSmallAddAssignKernel( y, x, A, scalar );
-      else
+      }
+      else {
+         BLAZE_KERNEL_PROFILE( ( UseBlasKernel_v<VT1,VT2,MT1,ST2> ? "tdvectdmatmult.addassign.blas"
+                                                                  : "tdvectdmatmult.addassign.large" ),
+                               1UL, A.rows(), A.columns(), 1UL,
+                               2.0*A.rows()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + x.size() +
+                                                     2UL*y.size() ) );
          selectBlasAddAssignKernel( y, x, A, scalar );
+      }
    }
    //**********************************************************************************************
 
@@ -5036,10 +5097,22 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
    {
       if( ( IsDiagonal_v<MT1> ) ||
           ( IsComputation_v<MT> && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < TDVECDMATMULT_THRESHOLD ) )
+          ( A.rows() * A.columns() < TDVECDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_PROFILE( "tdvectdmatmult.subassign.small", 1UL, A.rows(), A.columns(), 1UL,
+                               2.0*A.rows()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + x.size() +
+                                                     2UL*y.size() ) );
          selectSmallSubAssignKernel( y, x, A, scalar );
-      else
+      }
+      else {
+         BLAZE_KERNEL_PROFILE( ( UseBlasKernel_v<VT1,VT2,MT1,ST2> ? "tdvectdmatmult.subassign.blas"
+                                                                  : "tdvectdmatmult.subassign.large" ),
+                               1UL, A.rows(), A.columns(), 1UL,
+                               2.0*A.rows()*A.columns(),
+                               sizeof(ElementType)*( A.rows()*A.columns() + x.size() +
+                                                     2UL*y.size() ) );
          selectBlasSubAssignKernel( y, x, A, scalar );
+      }
    }
    //**********************************************************************************************
 
@@ -0,0 +1,343 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/clapack/gbsv.h
+//  \brief Header file for the CLAPACK gbsv wrapper functions
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//
+//  * The names of its contributors may not be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_LAPACK_CLAPACK_GBSV_H_
+#define _BLAZE_MATH_LAPACK_CLAPACK_GBSV_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+#include <blaze/math/blas/Types.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+//=================================================================================================
+//
+//  LAPACK FORWARD DECLARATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+#if !defined(INTEL_MKL_VERSION)
+extern "C" {
+
+void sgbsv_( blaze::blas_int_t* n, blaze::blas_int_t* kl, blaze::blas_int_t* ku,
+             blaze::blas_int_t* nrhs, float* AB, blaze::blas_int_t* ldab, blaze::blas_int_t* ipiv,
+             float* B, blaze::blas_int_t* ldb, blaze::blas_int_t* info );
+void dgbsv_( blaze::blas_int_t* n, blaze::blas_int_t* kl, blaze::blas_int_t* ku,
+             blaze::blas_int_t* nrhs, double* AB, blaze::blas_int_t* ldab, blaze::blas_int_t* ipiv,
+             double* B, blaze::blas_int_t* ldb, blaze::blas_int_t* info );
+void cgbsv_( blaze::blas_int_t* n, blaze::blas_int_t* kl, blaze::blas_int_t* ku,
+             blaze::blas_int_t* nrhs, float* AB, blaze::blas_int_t* ldab, blaze::blas_int_t* ipiv,
+             float* B, blaze::blas_int_t* ldb, blaze::blas_int_t* info );
+void zgbsv_( blaze::blas_int_t* n, blaze::blas_int_t* kl, blaze::blas_int_t* ku,
+             blaze::blas_int_t* nrhs, double* AB, blaze::blas_int_t* ldab, blaze::blas_int_t* ipiv,
+             double* B, blaze::blas_int_t* ldb, blaze::blas_int_t* info );
+
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  LAPACK GENERAL BAND LINEAR SYSTEM FUNCTIONS (GBSV)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name LAPACK general band linear system functions (gbsv) */
+//@{
+void gbsv( blas_int_t n, blas_int_t kl, blas_int_t ku, blas_int_t nrhs, float* AB, blas_int_t ldab,
+           blas_int_t* ipiv, float* B, blas_int_t ldb, blas_int_t* info );
+
+void gbsv( blas_int_t n, blas_int_t kl, blas_int_t ku, blas_int_t nrhs, double* AB,
+           blas_int_t ldab, blas_int_t* ipiv, double* B, blas_int_t ldb, blas_int_t* info );
+
+void gbsv( blas_int_t n, blas_int_t kl, blas_int_t ku, blas_int_t nrhs, complex<float>* AB,
+           blas_int_t ldab, blas_int_t* ipiv, complex<float>* B, blas_int_t ldb, blas_int_t* info );
+
+void gbsv( blas_int_t n, blas_int_t kl, blas_int_t ku, blas_int_t nrhs, complex<double>* AB,
+           blas_int_t ldab, blas_int_t* ipiv, complex<double>* B, blas_int_t ldb, blas_int_t* info );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for solving a single precision general band linear system of equations
+//        (\f$ A*X=B \f$).
+// \ingroup lapack_solver
+//
+// \param n The number of rows/columns of the band matrix \f$[0..\infty)\f$.
+// \param kl The number of subdiagonals within the band of the matrix \f$[0..\infty)\f$.
+// \param ku The number of superdiagonals within the band of the matrix \f$[0..\infty)\f$.
+// \param nrhs The number of right-hand side vectors \f$[0..\infty)\f$.
+// \param AB Pointer to the first element of the single precision column-major band storage.
+// \param ldab The total number of elements between two columns of the band storage \f$[2kl+ku+1..\infty)\f$.
+// \param ipiv Auxiliary array of size \a n for the pivot indices.
+// \param B Pointer to the first element of the column-major matrix.
+// \param ldb The total number of elements between two columns of matrix \a B \f$[0..\infty)\f$.
+// \param info Return code of the function call.
+// \return void
+//
+// This function uses the LAPACK sgbsv() function to compute the solution to the system of linear
+// equations \f$ A*X=B \f$, where \a A is a \a n-by-\a n band matrix with \a kl subdiagonals and
+// \a ku superdiagonals and \a X and \a B are \a n-by-\a nrhs matrices. The band is expected in
+// rows \a kl to \a 2kl+ku of \a AB, i.e. \f$ A(i,j) \f$ is stored in \f$ AB(kl+ku+i-j,j) \f$.
+//
+// The LU decomposition with partial pivoting and row interchanges is used to factor \a A as
+
+                          \f[ A = P \cdot L \cdot U, \f]
+
+// where \c P is a permutation matrix, \c L is a product of permutation and unit lower triangular
+// band matrices with \a kl subdiagonals, and \c U is an upper triangular band matrix with
+// \a kl+ku superdiagonals. The factored form of \a A is then used to solve the system of equations.
+//
+// The \a info argument provides feedback on the success of the function call:
+//
+//   - = 0: The function finished successfully.
+//   - < 0: If info = -i, the i-th argument had an illegal value.
+//   - > 0: If info = i, the decomposition has been completed, but since factor U(i,i) is exactly
+//          singular the solution could not be computed.
+//
+// For more information on the sgbsv() function, see the LAPACK online documentation browser:
+//
+//        http://www.netlib.org/lapack/explore-html/
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+inline void gbsv( blas_int_t n, blas_int_t kl, blas_int_t ku, blas_int_t nrhs, float* AB,
+                  blas_int_t ldab, blas_int_t* ipiv, float* B, blas_int_t ldb, blas_int_t* info )
+{
+#if defined(INTEL_MKL_VERSION)
+   BLAZE_STATIC_ASSERT( sizeof( MKL_INT ) == sizeof( blas_int_t ) );
+#endif
+
+   sgbsv_( &n, &kl, &ku, &nrhs, AB, &ldab, ipiv, B, &ldb, info );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for solving a double precision general band linear system of equations
+//        (\f$ A*X=B \f$).
+// \ingroup lapack_solver
+//
+// \param n The number of rows/columns of the band matrix \f$[0..\infty)\f$.
+// \param kl The number of subdiagonals within the band of the matrix \f$[0..\infty)\f$.
+// \param ku The number of superdiagonals within the band of the matrix \f$[0..\infty)\f$.
+// \param nrhs The number of right-hand side vectors \f$[0..\infty)\f$.
+// \param AB Pointer to the first element of the double precision column-major band storage.
+// \param ldab The total number of elements between two columns of the band storage \f$[2kl+ku+1..\infty)\f$.
+// \param ipiv Auxiliary array of size \a n for the pivot indices.
+// \param B Pointer to the first element of the column-major matrix.
+// \param ldb The total number of elements between two columns of matrix \a B \f$[0..\infty)\f$.
+// \param info Return code of the function call.
+// \return void
+//
+// This function uses the LAPACK dgbsv() function to compute the solution to the system of linear
+// equations \f$ A*X=B \f$, where \a A is a \a n-by-\a n band matrix with \a kl subdiagonals and
+// \a ku superdiagonals and \a X and \a B are \a n-by-\a nrhs matrices. The band is expected in
+// rows \a kl to \a 2kl+ku of \a AB, i.e. \f$ A(i,j) \f$ is stored in \f$ AB(kl+ku+i-j,j) \f$.
+//
+// The LU decomposition with partial pivoting and row interchanges is used to factor \a A as
+
+                          \f[ A = P \cdot L \cdot U, \f]
+
+// where \c P is a permutation matrix, \c L is a product of permutation and unit lower triangular
+// band matrices with \a kl subdiagonals, and \c U is an upper triangular band matrix with
+// \a kl+ku superdiagonals. The factored form of \a A is then used to solve the system of equations.
+//
+// The \a info argument provides feedback on the success of the function call:
+//
+//   - = 0: The function finished successfully.
+//   - < 0: If info = -i, the i-th argument had an illegal value.
+//   - > 0: If info = i, the decomposition has been completed, but since factor U(i,i) is exactly
+//          singular the solution could not be computed.
+//
+// For more information on the dgbsv() function, see the LAPACK online documentation browser:
+//
+//        http://www.netlib.org/lapack/explore-html/
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+inline void gbsv( blas_int_t n, blas_int_t kl, blas_int_t ku, blas_int_t nrhs, double* AB,
+                  blas_int_t ldab, blas_int_t* ipiv, double* B, blas_int_t ldb, blas_int_t* info )
+{
+#if defined(INTEL_MKL_VERSION)
+   BLAZE_STATIC_ASSERT( sizeof( MKL_INT ) == sizeof( blas_int_t ) );
+#endif
+
+   dgbsv_( &n, &kl, &ku, &nrhs, AB, &ldab, ipiv, B, &ldb, info );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for solving a single precision complex general band linear system of
+//        equations (\f$ A*X=B \f$).
+// \ingroup lapack_solver
+//
+// \param n The number of rows/columns of the band matrix \f$[0..\infty)\f$.
+// \param kl The number of subdiagonals within the band of the matrix \f$[0..\infty)\f$.
+// \param ku The number of superdiagonals within the band of the matrix \f$[0..\infty)\f$.
+// \param nrhs The number of right-hand side vectors \f$[0..\infty)\f$.
+// \param AB Pointer to the first element of the single precision complex column-major band storage.
+// \param ldab The total number of elements between two columns of the band storage \f$[2kl+ku+1..\infty)\f$.
+// \param ipiv Auxiliary array of size \a n for the pivot indices.
+// \param B Pointer to the first element of the column-major matrix.
+// \param ldb The total number of elements between two columns of matrix \a B \f$[0..\infty)\f$.
+// \param info Return code of the function call.
+// \return void
+//
+// This function uses the LAPACK cgbsv() function to compute the solution to the system of linear
+// equations \f$ A*X=B \f$, where \a A is a \a n-by-\a n band matrix with \a kl subdiagonals and
+// \a ku superdiagonals and \a X and \a B are \a n-by-\a nrhs matrices. The band is expected in
+// rows \a kl to \a 2kl+ku of \a AB, i.e. \f$ A(i,j) \f$ is stored in \f$ AB(kl+ku+i-j,j) \f$.
+//
+// The LU decomposition with partial pivoting and row interchanges is used to factor \a A as
+
+                          \f[ A = P \cdot L \cdot U, \f]
+
+// where \c P is a permutation matrix, \c L is a product of permutation and unit lower triangular
+// band matrices with \a kl subdiagonals, and \c U is an upper triangular band matrix with
+// \a kl+ku superdiagonals. The factored form of \a A is then used to solve the system of equations.
+//
+// The \a info argument provides feedback on the success of the function call:
+//
+//   - = 0: The function finished successfully.
+//   - < 0: If info = -i, the i-th argument had an illegal value.
+//   - > 0: If info = i, the decomposition has been completed, but since factor U(i,i) is exactly
+//          singular the solution could not be computed.
+//
+// For more information on the cgbsv() function, see the LAPACK online documentation browser:
+//
+//        http://www.netlib.org/lapack/explore-html/
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+inline void gbsv( blas_int_t n, blas_int_t kl, blas_int_t ku, blas_int_t nrhs, complex<float>* AB,
+                  blas_int_t ldab, blas_int_t* ipiv, complex<float>* B, blas_int_t ldb,
+                  blas_int_t* info )
+{
+   BLAZE_STATIC_ASSERT( sizeof( complex<float> ) == 2UL*sizeof( float ) );
+
+#if defined(INTEL_MKL_VERSION)
+   BLAZE_STATIC_ASSERT( sizeof( MKL_INT ) == sizeof( blas_int_t ) );
+   BLAZE_STATIC_ASSERT( sizeof( MKL_Complex8 ) == sizeof( complex<float> ) );
+   using ET = MKL_Complex8;
+#else
+   using ET = float;
+#endif
+
+   cgbsv_( &n, &kl, &ku, &nrhs, reinterpret_cast<ET*>( AB ), &ldab, ipiv,
+           reinterpret_cast<ET*>( B ), &ldb, info );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for solving a double precision complex general band linear system of
+//        equations (\f$ A*X=B \f$).
+// \ingroup lapack_solver
+//
+// \param n The number of rows/columns of the band matrix \f$[0..\infty)\f$.
+// \param kl The number of subdiagonals within the band of the matrix \f$[0..\infty)\f$.
+// \param ku The number of superdiagonals within the band of the matrix \f$[0..\infty)\f$.
+// \param nrhs The number of right-hand side vectors \f$[0..\infty)\f$.
+// \param AB Pointer to the first element of the double precision complex column-major band storage.
+// \param ldab The total number of elements between two columns of the band storage \f$[2kl+ku+1..\infty)\f$.
+// \param ipiv Auxiliary array of size \a n for the pivot indices.
+// \param B Pointer to the first element of the column-major matrix.
+// \param ldb The total number of elements between two columns of matrix \a B \f$[0..\infty)\f$.
+// \param info Return code of the function call.
+// \return void
+//
+// This function uses the LAPACK zgbsv() function to compute the solution to the system of linear
+// equations \f$ A*X=B \f$, where \a A is a \a n-by-\a n band matrix with \a kl subdiagonals and
+// \a ku superdiagonals and \a X and \a B are \a n-by-\a nrhs matrices. The band is expected in
+// rows \a kl to \a 2kl+ku of \a AB, i.e. \f$ A(i,j) \f$ is stored in \f$ AB(kl+ku+i-j,j) \f$.
+//
+// The LU decomposition with partial pivoting and row interchanges is used to factor \a A as
+
+                          \f[ A = P \cdot L \cdot U, \f]
+
+// where \c P is a permutation matrix, \c L is a product of permutation and unit lower triangular
+// band matrices with \a kl subdiagonals, and \c U is an upper triangular band matrix with
+// \a kl+ku superdiagonals. The factored form of \a A is then used to solve the system of equations.
+//
+// The \a info argument provides feedback on the success of the function call:
+//
+//   - = 0: The function finished successfully.
+//   - < 0: If info = -i, the i-th argument had an illegal value.
+//   - > 0: If info = i, the decomposition has been completed, but since factor U(i,i) is exactly
+//          singular the solution could not be computed.
+//
+// For more information on the zgbsv() function, see the LAPACK online documentation browser:
+//
+//        http://www.netlib.org/lapack/explore-html/
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+inline void gbsv( blas_int_t n, blas_int_t kl, blas_int_t ku, blas_int_t nrhs, complex<double>* AB,
+                  blas_int_t ldab, blas_int_t* ipiv, complex<double>* B, blas_int_t ldb,
+                  blas_int_t* info )
+{
+   BLAZE_STATIC_ASSERT( sizeof( complex<double> ) == 2UL*sizeof( double ) );
+
+#if defined(INTEL_MKL_VERSION)
+   BLAZE_STATIC_ASSERT( sizeof( MKL_INT ) == sizeof( blas_int_t ) );
+   BLAZE_STATIC_ASSERT( sizeof( MKL_Complex16 ) == sizeof( complex<double> ) );
+   using ET = MKL_Complex16;
+#else
+   using ET = double;
+#endif
+
+   zgbsv_( &n, &kl, &ku, &nrhs, reinterpret_cast<ET*>( AB ), &ldab, ipiv,
+           reinterpret_cast<ET*>( B ), &ldb, info );
+}
+//*************************************************************************************************
+
+
+} // namespace blaze
+
+#endif
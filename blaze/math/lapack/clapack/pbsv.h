@@ -0,0 +1,365 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/clapack/pbsv.h
+//  \brief Header file for the CLAPACK pbsv wrapper functions
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//
+//  * The names of its contributors may not be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_LAPACK_CLAPACK_PBSV_H_
+#define _BLAZE_MATH_LAPACK_CLAPACK_PBSV_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+#include <blaze/math/blas/Types.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+//=================================================================================================
+//
+//  LAPACK FORWARD DECLARATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+#if !defined(INTEL_MKL_VERSION)
+extern "C" {
+
+void spbsv_( char* uplo, blaze::blas_int_t* n, blaze::blas_int_t* kd, blaze::blas_int_t* nrhs,
+             float* AB, blaze::blas_int_t* ldab, float* B, blaze::blas_int_t* ldb,
+             blaze::blas_int_t* info, blaze::fortran_charlen_t nuplo );
+void dpbsv_( char* uplo, blaze::blas_int_t* n, blaze::blas_int_t* kd, blaze::blas_int_t* nrhs,
+             double* AB, blaze::blas_int_t* ldab, double* B, blaze::blas_int_t* ldb,
+             blaze::blas_int_t* info, blaze::fortran_charlen_t nuplo );
+void cpbsv_( char* uplo, blaze::blas_int_t* n, blaze::blas_int_t* kd, blaze::blas_int_t* nrhs,
+             float* AB, blaze::blas_int_t* ldab, float* B, blaze::blas_int_t* ldb,
+             blaze::blas_int_t* info, blaze::fortran_charlen_t nuplo );
+void zpbsv_( char* uplo, blaze::blas_int_t* n, blaze::blas_int_t* kd, blaze::blas_int_t* nrhs,
+             double* AB, blaze::blas_int_t* ldab, double* B, blaze::blas_int_t* ldb,
+             blaze::blas_int_t* info, blaze::fortran_charlen_t nuplo );
+
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  LAPACK POSITIVE DEFINITE BAND LINEAR SYSTEM FUNCTIONS (PBSV)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name LAPACK positive definite band linear system functions (pbsv) */
+//@{
+void pbsv( char uplo, blas_int_t n, blas_int_t kd, blas_int_t nrhs, float* AB, blas_int_t ldab,
+           float* B, blas_int_t ldb, blas_int_t* info );
+
+void pbsv( char uplo, blas_int_t n, blas_int_t kd, blas_int_t nrhs, double* AB, blas_int_t ldab,
+           double* B, blas_int_t ldb, blas_int_t* info );
+
+void pbsv( char uplo, blas_int_t n, blas_int_t kd, blas_int_t nrhs, complex<float>* AB,
+           blas_int_t ldab, complex<float>* B, blas_int_t ldb, blas_int_t* info );
+
+void pbsv( char uplo, blas_int_t n, blas_int_t kd, blas_int_t nrhs, complex<double>* AB,
+           blas_int_t ldab, complex<double>* B, blas_int_t ldb, blas_int_t* info );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for solving a positive definite single precision band linear system of
+//        equations (\f$ A*X=B \f$).
+// \ingroup lapack_solver
+//
+// \param uplo \c 'L' to use the lower part of the matrix, \c 'U' to use the upper part.
+// \param n The number of rows/columns of the band matrix \f$[0..\infty)\f$.
+// \param kd The number of sub- or superdiagonals within the band of the matrix \f$[0..\infty)\f$.
+// \param nrhs The number of right-hand side vectors \f$[0..\infty)\f$.
+// \param AB Pointer to the first element of the single precision column-major band storage.
+// \param ldab The total number of elements between two columns of the band storage \f$[kd+1..\infty)\f$.
+// \param B Pointer to the first element of the column-major matrix.
+// \param ldb The total number of elements between two columns of matrix \a B \f$[0..\infty)\f$.
+// \param info Return code of the function call.
+// \return void
+//
+// This function uses the LAPACK spbsv() function to compute the solution to the positive definite
+// system of linear equations \f$ A*X=B \f$, where \a A is a \a n-by-\a n positive definite band
+// matrix with \a kd sub- and superdiagonals and \a X and \a B are \a n-by-\a nrhs matrices. In
+// case \a uplo is set to \c 'U', \f$ A(i,j) \f$ is stored in \f$ AB(kd+i-j,j) \f$ for
+// \f$ j-kd \leq i \leq j \f$, in case \a uplo is set to \c 'L', \f$ A(i,j) \f$ is stored in
+// \f$ AB(i-j,j) \f$ for \f$ j \leq i \leq j+kd \f$.
+//
+// The Cholesky decomposition is used to factor \a A as
+
+                      \f[ A = U^{T} U \texttt{ (if uplo = 'U'), or }
+                          A = L L^{T} \texttt{ (if uplo = 'L'), } \f]
+
+// where \c U is an upper triangular band matrix and \c L is a lower triangular band matrix with
+// the same number of super- or subdiagonals as \a A. The resulting decomposition is stored
+// within \a AB. The factored form of \a A is then used to solve the system of equations.
+//
+// The \a info argument provides feedback on the success of the function call:
+//
+//   - = 0: The function finished successfully.
+//   - < 0: If info = -i, the i-th argument had an illegal value.
+//   - > 0: If info = i, the leading minor of order i is not positive definite, so the decomposition
+//          could not be completed and the solution has not been computed.
+//
+// For more information on the spbsv() function, see the LAPACK online documentation browser:
+//
+//        http://www.netlib.org/lapack/explore-html/
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+inline void pbsv( char uplo, blas_int_t n, blas_int_t kd, blas_int_t nrhs, float* AB,
+                  blas_int_t ldab, float* B, blas_int_t ldb, blas_int_t* info )
+{
+#if defined(INTEL_MKL_VERSION)
+   BLAZE_STATIC_ASSERT( sizeof( MKL_INT ) == sizeof( blas_int_t ) );
+#endif
+
+   spbsv_( &uplo, &n, &kd, &nrhs, AB, &ldab, B, &ldb, info
+#if !defined(INTEL_MKL_VERSION)
+         , blaze::fortran_charlen_t(1)
+#endif
+         );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for solving a positive definite double precision band linear system of
+//        equations (\f$ A*X=B \f$).
+// \ingroup lapack_solver
+//
+// \param uplo \c 'L' to use the lower part of the matrix, \c 'U' to use the upper part.
+// \param n The number of rows/columns of the band matrix \f$[0..\infty)\f$.
+// \param kd The number of sub- or superdiagonals within the band of the matrix \f$[0..\infty)\f$.
+// \param nrhs The number of right-hand side vectors \f$[0..\infty)\f$.
+// \param AB Pointer to the first element of the double precision column-major band storage.
+// \param ldab The total number of elements between two columns of the band storage \f$[kd+1..\infty)\f$.
+// \param B Pointer to the first element of the column-major matrix.
+// \param ldb The total number of elements between two columns of matrix \a B \f$[0..\infty)\f$.
+// \param info Return code of the function call.
+// \return void
+//
+// This function uses the LAPACK dpbsv() function to compute the solution to the positive definite
+// system of linear equations \f$ A*X=B \f$, where \a A is a \a n-by-\a n positive definite band
+// matrix with \a kd sub- and superdiagonals and \a X and \a B are \a n-by-\a nrhs matrices. In
+// case \a uplo is set to \c 'U', \f$ A(i,j) \f$ is stored in \f$ AB(kd+i-j,j) \f$ for
+// \f$ j-kd \leq i \leq j \f$, in case \a uplo is set to \c 'L', \f$ A(i,j) \f$ is stored in
+// \f$ AB(i-j,j) \f$ for \f$ j \leq i \leq j+kd \f$.
+//
+// The Cholesky decomposition is used to factor \a A as
+
+                      \f[ A = U^{T} U \texttt{ (if uplo = 'U'), or }
+                          A = L L^{T} \texttt{ (if uplo = 'L'), } \f]
+
+// where \c U is an upper triangular band matrix and \c L is a lower triangular band matrix with
+// the same number of super- or subdiagonals as \a A. The resulting decomposition is stored
+// within \a AB. The factored form of \a A is then used to solve the system of equations.
+//
+// The \a info argument provides feedback on the success of the function call:
+//
+//   - = 0: The function finished successfully.
+//   - < 0: If info = -i, the i-th argument had an illegal value.
+//   - > 0: If info = i, the leading minor of order i is not positive definite, so the decomposition
+//          could not be completed and the solution has not been computed.
+//
+// For more information on the dpbsv() function, see the LAPACK online documentation browser:
+//
+//        http://www.netlib.org/lapack/explore-html/
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+inline void pbsv( char uplo, blas_int_t n, blas_int_t kd, blas_int_t nrhs, double* AB,
+                  blas_int_t ldab, double* B, blas_int_t ldb, blas_int_t* info )
+{
+#if defined(INTEL_MKL_VERSION)
+   BLAZE_STATIC_ASSERT( sizeof( MKL_INT ) == sizeof( blas_int_t ) );
+#endif
+
+   dpbsv_( &uplo, &n, &kd, &nrhs, AB, &ldab, B, &ldb, info
+#if !defined(INTEL_MKL_VERSION)
+         , blaze::fortran_charlen_t(1)
+#endif
+         );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for solving a positive definite single precision complex band linear
+//        system of equations (\f$ A*X=B \f$).
+// \ingroup lapack_solver
+//
+// \param uplo \c 'L' to use the lower part of the matrix, \c 'U' to use the upper part.
+// \param n The number of rows/columns of the band matrix \f$[0..\infty)\f$.
+// \param kd The number of sub- or superdiagonals within the band of the matrix \f$[0..\infty)\f$.
+// \param nrhs The number of right-hand side vectors \f$[0..\infty)\f$.
+// \param AB Pointer to the first element of the single precision complex column-major band storage.
+// \param ldab The total number of elements between two columns of the band storage \f$[kd+1..\infty)\f$.
+// \param B Pointer to the first element of the column-major matrix.
+// \param ldb The total number of elements between two columns of matrix \a B \f$[0..\infty)\f$.
+// \param info Return code of the function call.
+// \return void
+//
+// This function uses the LAPACK cpbsv() function to compute the solution to the positive definite
+// system of linear equations \f$ A*X=B \f$, where \a A is a \a n-by-\a n positive definite band
+// matrix with \a kd sub- and superdiagonals and \a X and \a B are \a n-by-\a nrhs matrices. In
+// case \a uplo is set to \c 'U', \f$ A(i,j) \f$ is stored in \f$ AB(kd+i-j,j) \f$ for
+// \f$ j-kd \leq i \leq j \f$, in case \a uplo is set to \c 'L', \f$ A(i,j) \f$ is stored in
+// \f$ AB(i-j,j) \f$ for \f$ j \leq i \leq j+kd \f$.
+//
+// The Cholesky decomposition is used to factor \a A as
+
+                      \f[ A = U^{T} U \texttt{ (if uplo = 'U'), or }
+                          A = L L^{T} \texttt{ (if uplo = 'L'), } \f]
+
+// where \c U is an upper triangular band matrix and \c L is a lower triangular band matrix with
+// the same number of super- or subdiagonals as \a A. The resulting decomposition is stored
+// within \a AB. The factored form of \a A is then used to solve the system of equations.
+//
+// The \a info argument provides feedback on the success of the function call:
+//
+//   - = 0: The function finished successfully.
+//   - < 0: If info = -i, the i-th argument had an illegal value.
+//   - > 0: If info = i, the leading minor of order i is not positive definite, so the decomposition
+//          could not be completed and the solution has not been computed.
+//
+// For more information on the cpbsv() function, see the LAPACK online documentation browser:
+//
+//        http://www.netlib.org/lapack/explore-html/
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+inline void pbsv( char uplo, blas_int_t n, blas_int_t kd, blas_int_t nrhs, complex<float>* AB,
+                  blas_int_t ldab, complex<float>* B, blas_int_t ldb, blas_int_t* info )
+{
+   BLAZE_STATIC_ASSERT( sizeof( complex<float> ) == 2UL*sizeof( float ) );
+
+#if defined(INTEL_MKL_VERSION)
+   BLAZE_STATIC_ASSERT( sizeof( MKL_INT ) == sizeof( blas_int_t ) );
+   BLAZE_STATIC_ASSERT( sizeof( MKL_Complex8 ) == sizeof( complex<float> ) );
+   using ET = MKL_Complex8;
+#else
+   using ET = float;
+#endif
+
+   cpbsv_( &uplo, &n, &kd, &nrhs, reinterpret_cast<ET*>( AB ), &ldab, reinterpret_cast<ET*>( B ),
+           &ldb, info
+#if !defined(INTEL_MKL_VERSION)
+         , blaze::fortran_charlen_t(1)
+#endif
+         );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for solving a positive definite double precision complex band linear
+//        system of equations (\f$ A*X=B \f$).
+// \ingroup lapack_solver
+//
+// \param uplo \c 'L' to use the lower part of the matrix, \c 'U' to use the upper part.
+// \param n The number of rows/columns of the band matrix \f$[0..\infty)\f$.
+// \param kd The number of sub- or superdiagonals within the band of the matrix \f$[0..\infty)\f$.
+// \param nrhs The number of right-hand side vectors \f$[0..\infty)\f$.
+// \param AB Pointer to the first element of the double precision complex column-major band storage.
+// \param ldab The total number of elements between two columns of the band storage \f$[kd+1..\infty)\f$.
+// \param B Pointer to the first element of the column-major matrix.
+// \param ldb The total number of elements between two columns of matrix \a B \f$[0..\infty)\f$.
+// \param info Return code of the function call.
+// \return void
+//
+// This function uses the LAPACK zpbsv() function to compute the solution to the positive definite
+// system of linear equations \f$ A*X=B \f$, where \a A is a \a n-by-\a n positive definite band
+// matrix with \a kd sub- and superdiagonals and \a X and \a B are \a n-by-\a nrhs matrices. In
+// case \a uplo is set to \c 'U', \f$ A(i,j) \f$ is stored in \f$ AB(kd+i-j,j) \f$ for
+// \f$ j-kd \leq i \leq j \f$, in case \a uplo is set to \c 'L', \f$ A(i,j) \f$ is stored in
+// \f$ AB(i-j,j) \f$ for \f$ j \leq i \leq j+kd \f$.
+//
+// The Cholesky decomposition is used to factor \a A as
+
+                      \f[ A = U^{T} U \texttt{ (if uplo = 'U'), or }
+                          A = L L^{T} \texttt{ (if uplo = 'L'), } \f]
+
+// where \c U is an upper triangular band matrix and \c L is a lower triangular band matrix with
+// the same number of super- or subdiagonals as \a A. The resulting decomposition is stored
+// within \a AB. The factored form of \a A is then used to solve the system of equations.
+//
+// The \a info argument provides feedback on the success of the function call:
+//
+//   - = 0: The function finished successfully.
+//   - < 0: If info = -i, the i-th argument had an illegal value.
+//   - > 0: If info = i, the leading minor of order i is not positive definite, so the decomposition
+//          could not be completed and the solution has not been computed.
+//
+// For more information on the zpbsv() function, see the LAPACK online documentation browser:
+//
+//        http://www.netlib.org/lapack/explore-html/
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+inline void pbsv( char uplo, blas_int_t n, blas_int_t kd, blas_int_t nrhs, complex<double>* AB,
+                  blas_int_t ldab, complex<double>* B, blas_int_t ldb, blas_int_t* info )
+{
+   BLAZE_STATIC_ASSERT( sizeof( complex<double> ) == 2UL*sizeof( double ) );
+
+#if defined(INTEL_MKL_VERSION)
+   BLAZE_STATIC_ASSERT( sizeof( MKL_INT ) == sizeof( blas_int_t ) );
+   BLAZE_STATIC_ASSERT( sizeof( MKL_Complex16 ) == sizeof( complex<double> ) );
+   using ET = MKL_Complex16;
+#else
+   using ET = double;
+#endif
+
+   zpbsv_( &uplo, &n, &kd, &nrhs, reinterpret_cast<ET*>( AB ), &ldab, reinterpret_cast<ET*>( B ),
+           &ldb, info
+#if !defined(INTEL_MKL_VERSION)
+         , blaze::fortran_charlen_t(1)
+#endif
+         );
+}
+//*************************************************************************************************
+
+
+} // namespace blaze
+
+#endif
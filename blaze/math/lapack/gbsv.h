@@ -0,0 +1,297 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/gbsv.h
+//  \brief Header file for the LAPACK general band linear system solver functions (gbsv)
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//
+//  * The names of its contributors may not be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_LAPACK_GBSV_H_
+#define _BLAZE_MATH_LAPACK_GBSV_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <memory>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/Adaptor.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/constraints/Computation.h>
+#include <blaze/math/constraints/Contiguous.h>
+#include <blaze/math/constraints/MutableDataAccess.h>
+#include <blaze/math/dense/BandMatrix.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/lapack/clapack/gbsv.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/SameType.h>
+#include <blaze/util/NumericCast.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  LAPACK GENERAL BAND LINEAR SYSTEM FUNCTIONS (GBSV)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name LAPACK general band linear system functions (gbsv) */
+//@{
+template< typename Type, bool SO, typename VT, bool TF >
+void gbsv( const BandMatrix<Type,SO>& A, DenseVector<VT,TF>& b );
+
+template< typename Type, bool SO, typename MT, bool SO2 >
+void gbsv( const BandMatrix<Type,SO>& A, DenseMatrix<MT,SO2>& B );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Copies the given band matrix into the LAPACK band storage of the gbsv() functions.
+// \ingroup lapack_solver
+//
+// \param A The band matrix to be copied.
+// \param AB The target array of size \f$ (2 \cdot kl+ku+1) \cdot n \f$.
+// \param ldab The leading dimension of the target array (\f$ 2 \cdot kl+ku+1 \f$).
+// \return void
+//
+// This function copies the elements of the band matrix into the column-major LAPACK band
+// storage, i.e. the element \f$ (i,j) \f$ is stored at position \f$ (kl+ku+i-j,j) \f$. The
+// first \a kl rows of the target array are required by the LU decomposition and are expected
+// to be zero.
+*/
+template< typename Type  // Data type of the band matrix
+        , bool SO >      // Storage order of the band matrix
+inline void gbsvBandStorage( const BandMatrix<Type,SO>& A, Type* AB, size_t ldab )
+{
+   const size_t kl( A.lowerBandwidth() );
+   const size_t ku( A.upperBandwidth() );
+   const size_t N ( SO ? A.columns() : A.rows() );
+
+   for( size_t k=0UL; k<N; ++k )
+   {
+      const Type* p( A.data(k) - A.bandBegin(k) );
+
+      for( size_t l=A.bandBegin(k); l<A.bandEnd(k); ++l ) {
+         const size_t i( SO ? l : k );
+         const size_t j( SO ? k : l );
+         AB[j*ldab+kl+ku+i-j] = p[l];
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for solving a general band linear system of equations (\f$ A*x=b \f$).
+// \ingroup lapack_solver
+//
+// \param A The band system matrix.
+// \param b The right-hand side vector.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function uses the LAPACK gbsv() functions to compute the solution to the system of linear
+// equations \f$ A*x=b \f$, where \a A is a \a n-by-\a n band matrix with \a kl subdiagonals and
+// \a ku superdiagonals and \a x and \a b are n-dimensional vectors. Note that the function only
+// works for band matrices with \c float, \c double, \c complex<float>, or \c complex<double>
+// element type. The attempt to call the function with matrices of any other element type results
+// in a compile time error!
+//
+// In contrast to the gbsv() functions for general dense matrices, the band matrix is copied into
+// a temporary LAPACK band storage with additional \a kl superdiagonals for the fill-in of the LU
+// decomposition with partial pivoting. Therefore the given band matrix remains unchanged and the
+// computational cost is \f$ O(n \cdot kl \cdot (kl+ku)) \f$ instead of \f$ O(n^3) \f$. If the
+// function exits successfully, the vector \a b contains the solution of the linear system.
+//
+// The function fails if ...
+//
+//  - ... the given system matrix is not a square matrix;
+//  - ... the given system matrix is singular and not invertible.
+//
+// In all failure cases an exception is thrown.
+//
+// For more information on the gbsv() functions (i.e. sgbsv(), dgbsv(), cgbsv(), and zgbsv()),
+// see the LAPACK online documentation browser:
+//
+//        http://www.netlib.org/lapack/explore-html/
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+template< typename Type  // Data type of the band matrix
+        , bool SO        // Storage order of the band matrix
+        , typename VT    // Type of the right-hand side vector
+        , bool TF >      // Transpose flag of the right-hand side vector
+inline void gbsv( const BandMatrix<Type,SO>& A, DenseVector<VT,TF>& b )
+{
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( VT );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( VT );
+   BLAZE_CONSTRAINT_MUST_BE_CONTIGUOUS_TYPE( VT );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( Type, ElementType_t<VT> );
+
+   if( A.rows() != A.columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( (~b).size() != A.rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side vector provided" );
+   }
+
+   const size_t ldab( 2UL*A.lowerBandwidth() + A.upperBandwidth() + 1UL );
+
+   blas_int_t n   ( numeric_cast<blas_int_t>( A.rows() ) );
+   blas_int_t kl  ( numeric_cast<blas_int_t>( A.lowerBandwidth() ) );
+   blas_int_t ku  ( numeric_cast<blas_int_t>( A.upperBandwidth() ) );
+   blas_int_t nrhs( 1 );
+   blas_int_t ldb ( numeric_cast<blas_int_t>( (~b).size() ) );
+   blas_int_t info( 0 );
+
+   if( n == 0 ) {
+      return;
+   }
+
+   std::unique_ptr<Type[]> AB( new Type[ldab*A.columns()]() );
+   std::unique_ptr<blas_int_t[]> ipiv( new blas_int_t[n] );
+
+   gbsvBandStorage( A, AB.get(), ldab );
+
+   gbsv( n, kl, ku, nrhs, AB.get(), numeric_cast<blas_int_t>( ldab ), ipiv.get(),
+         (~b).data(), ldb, &info );
+
+   BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid function argument" );
+
+   if( info > 0 ) {
+      BLAZE_THROW_LAPACK_ERROR( "Inversion of singular matrix failed" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for solving a general band linear system of equations (\f$ A*X=B \f$).
+// \ingroup lapack_solver
+//
+// \param A The band system matrix.
+// \param B The matrix of right-hand sides.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid right-hand side matrix provided.
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function uses the LAPACK gbsv() functions to compute the solution to the system of linear
+// equations:
+//
+//  - \f$ A*X  =B   \f$ if \a B is column-major
+//  - \f$ A*X^T=B^T \f$ if \a B is row-major
+//
+// In this context the band system matrix \a A is a \a n-by-\a n matrix with \a kl subdiagonals
+// and \a ku superdiagonals and \a X and \a B are either row-major \a m-by-\a n matrices or
+// column-major \a n-by-\a m matrices. Note that the function only works for band matrices with
+// \c float, \c double, \c complex<float>, or \c complex<double> element type. The attempt to call
+// the function with matrices of any other element type results in a compile time error!
+//
+// The band matrix is copied into a temporary LAPACK band storage and remains unchanged. If the
+// function exits successfully, the matrix \a B contains the solution of the linear system.
+//
+// The function fails if ...
+//
+//  - ... the given system matrix is not a square matrix;
+//  - ... the sizes of the two given matrices do not match;
+//  - ... the given system matrix is singular and not invertible.
+//
+// In all failure cases an exception is thrown.
+//
+// For more information on the gbsv() functions (i.e. sgbsv(), dgbsv(), cgbsv(), and zgbsv()),
+// see the LAPACK online documentation browser:
+//
+//        http://www.netlib.org/lapack/explore-html/
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+template< typename Type  // Data type of the band matrix
+        , bool SO        // Storage order of the band matrix
+        , typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline void gbsv( const BandMatrix<Type,SO>& A, DenseMatrix<MT,SO2>& B )
+{
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( MT );
+   BLAZE_CONSTRAINT_MUST_BE_CONTIGUOUS_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( Type, ElementType_t<MT> );
+
+   if( A.rows() != A.columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   const size_t ldab( 2UL*A.lowerBandwidth() + A.upperBandwidth() + 1UL );
+
+   blas_int_t n   ( numeric_cast<blas_int_t>( A.rows() ) );
+   blas_int_t kl  ( numeric_cast<blas_int_t>( A.lowerBandwidth() ) );
+   blas_int_t ku  ( numeric_cast<blas_int_t>( A.upperBandwidth() ) );
+   blas_int_t mrhs( numeric_cast<blas_int_t>( SO2 ? (~B).rows() : (~B).columns() ) );
+   blas_int_t nrhs( numeric_cast<blas_int_t>( SO2 ? (~B).columns() : (~B).rows() ) );
+   blas_int_t ldb ( numeric_cast<blas_int_t>( (~B).spacing() ) );
+   blas_int_t info( 0 );
+
+   if( n != mrhs ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side matrix provided" );
+   }
+
+   if( n == 0 ) {
+      return;
+   }
+
+   std::unique_ptr<Type[]> AB( new Type[ldab*A.columns()]() );
+   std::unique_ptr<blas_int_t[]> ipiv( new blas_int_t[n] );
+
+   gbsvBandStorage( A, AB.get(), ldab );
+
+   gbsv( n, kl, ku, nrhs, AB.get(), numeric_cast<blas_int_t>( ldab ), ipiv.get(),
+         (~B).data(), ldb, &info );
+
+   BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid function argument" );
+
+   if( info > 0 ) {
+      BLAZE_THROW_LAPACK_ERROR( "Inversion of singular matrix failed" );
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -50,8 +50,14 @@
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/lapack/clapack/gelqf.h>
 #include <blaze/math/lapack/clapack/geqrf.h>
+#include <blaze/math/lapack/native/geqrf.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/util/algorithms/Min.h>
 #include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/MaybeUnused.h>
 #include <blaze/util/NumericCast.h>
+#include <blaze/util/Types.h>
 
 
 namespace blaze {
@@ -71,6 +77,76 @@ void geqrf( DenseMatrix<MT,SO>& A, ElementType_t<MT>* tau );
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native backend of the QR decomposition of the given dense matrix.
+// \ingroup lapack_decomposition
+//
+// \param A The matrix to be decomposed.
+// \param tau Array for the scalar factors of the elementary reflectors; size >= min( \a m, \a n ).
+// \return The LAPACK info value.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline auto geqrf_backend( DenseMatrix<MT,SO>& A, ElementType_t<MT>* tau )
+   -> EnableIf_t< UseNativeLAPACK_v<MT>, blas_int_t >
+{
+   constexpr size_t M( NativeSize_v<MT,0UL> );
+   constexpr size_t N( NativeSize_v<MT,1UL> );
+
+   auto Q( nativeView( ~A ) );
+   nativeGeqrf<M,N>( Q, tau );
+
+   if( !SO ) {
+      const size_t k( min( (~A).rows(), (~A).columns() ) );
+      for( size_t i=0UL; i<k; ++i ) {
+         tau[i] = conj( tau[i] );
+      }
+   }
+
+   return 0;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief LAPACK backend of the QR decomposition of the given dense matrix.
+// \ingroup lapack_decomposition
+//
+// \param A The matrix to be decomposed.
+// \param tau Array for the scalar factors of the elementary reflectors; size >= min( \a m, \a n ).
+// \return The LAPACK info value.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline auto geqrf_backend( DenseMatrix<MT,SO>& A, ElementType_t<MT>* tau )
+   -> EnableIf_t< !UseNativeLAPACK_v<MT>, blas_int_t >
+{
+   using ET = ElementType_t<MT>;
+
+   blas_int_t m   ( numeric_cast<blas_int_t>( SO ? (~A).rows() : (~A).columns() ) );
+   blas_int_t n   ( numeric_cast<blas_int_t>( SO ? (~A).columns() : (~A).rows() ) );
+   blas_int_t lda ( numeric_cast<blas_int_t>( (~A).spacing() ) );
+   blas_int_t info( 0 );
+
+   blas_int_t lwork( ( SO ? n : m ) * lda );
+   const std::unique_ptr<ET[]> work( new ET[lwork] );
+
+   if( SO ) {
+      geqrf( m, n, (~A).data(), lda, tau, work.get(), lwork, &info );
+   }
+   else {
+      gelqf( m, n, (~A).data(), lda, tau, work.get(), lwork, &info );
+   }
+
+   return info;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief LAPACK kernel for the QR decomposition of the given dense matrix.
 // \ingroup lapack_decomposition
@@ -111,7 +187,9 @@ void geqrf( DenseMatrix<MT,SO>& A, ElementType_t<MT>* tau );
 //
 // \note This function can only be used if a fitting LAPACK library, which supports this function,
 // is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// linker error. In case the LAPACK mode is disabled (see the BLAZE_LAPACK_MODE switch) or in case
+// of matrices with a small compile time maximum size (as for instance StaticMatrix), the function
+// is computed by native Blaze kernels, which do not require LAPACK.
 */
 template< typename MT  // Type of the dense matrix
         , bool SO >    // Storage order of the dense matrix
@@ -123,28 +201,15 @@ inline void geqrf( DenseMatrix<MT,SO>& A, ElementType_t<MT>* tau )
    BLAZE_CONSTRAINT_MUST_BE_CONTIGUOUS_TYPE( MT );
    BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT> );
 
-   using ET = ElementType_t<MT>;
-
-   blas_int_t m   ( numeric_cast<blas_int_t>( SO ? (~A).rows() : (~A).columns() ) );
-   blas_int_t n   ( numeric_cast<blas_int_t>( SO ? (~A).columns() : (~A).rows() ) );
-   blas_int_t lda ( numeric_cast<blas_int_t>( (~A).spacing() ) );
-   blas_int_t info( 0 );
-
-   if( m == 0 || n == 0 ) {
+   if( (~A).rows() == 0UL || (~A).columns() == 0UL ) {
       return;
    }
 
-   blas_int_t lwork( ( SO ? n : m ) * lda );
-   const std::unique_ptr<ET[]> work( new ET[lwork] );
-
-   if( SO ) {
-      geqrf( m, n, (~A).data(), lda, tau, work.get(), lwork, &info );
-   }
-   else {
-      gelqf( m, n, (~A).data(), lda, tau, work.get(), lwork, &info );
-   }
+   const blas_int_t info( geqrf_backend( ~A, tau ) );
 
    BLAZE_INTERNAL_ASSERT( info == 0, "Invalid argument for QR decomposition" );
+
+   MAYBE_UNUSED( info );
 }
 //*************************************************************************************************
 
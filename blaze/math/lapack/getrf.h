@@ -48,8 +48,12 @@
 #include <blaze/math/constraints/MutableDataAccess.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/lapack/clapack/getrf.h>
+#include <blaze/math/lapack/native/getrf.h>
 #include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/MaybeUnused.h>
 #include <blaze/util/NumericCast.h>
+#include <blaze/util/Types.h>
 
 
 namespace blaze {
@@ -69,6 +73,57 @@ void getrf( DenseMatrix<MT,SO>& A, blas_int_t* ipiv );
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native backend of the LU decomposition of the given dense general matrix.
+// \ingroup lapack_decomposition
+//
+// \param A The matrix to be decomposed.
+// \param ipiv Auxiliary array for the pivot indices; size >= min( \a m, \a n ).
+// \return The LAPACK info value.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline auto getrf_backend( DenseMatrix<MT,SO>& A, blas_int_t* ipiv )
+   -> EnableIf_t< UseNativeLAPACK_v<MT>, blas_int_t >
+{
+   constexpr size_t M( SO ? NativeSize_v<MT,0UL> : NativeSize_v<MT,1UL> );
+   constexpr size_t N( SO ? NativeSize_v<MT,1UL> : NativeSize_v<MT,0UL> );
+
+   auto L( lapackView( ~A ) );
+   return nativeGetrf<M,N>( L, ipiv );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief LAPACK backend of the LU decomposition of the given dense general matrix.
+// \ingroup lapack_decomposition
+//
+// \param A The matrix to be decomposed.
+// \param ipiv Auxiliary array for the pivot indices; size >= min( \a m, \a n ).
+// \return The LAPACK info value.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline auto getrf_backend( DenseMatrix<MT,SO>& A, blas_int_t* ipiv )
+   -> EnableIf_t< !UseNativeLAPACK_v<MT>, blas_int_t >
+{
+   blas_int_t m   ( numeric_cast<blas_int_t>( SO ? (~A).rows() : (~A).columns() ) );
+   blas_int_t n   ( numeric_cast<blas_int_t>( SO ? (~A).columns() : (~A).rows() ) );
+   blas_int_t lda ( numeric_cast<blas_int_t>( (~A).spacing() ) );
+   blas_int_t info( 0 );
+
+   getrf( m, n, (~A).data(), lda, ipiv, &info );
+
+   return info;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief LAPACK kernel for the LU decomposition of the given dense general matrix.
 // \ingroup lapack_decomposition
@@ -110,7 +165,9 @@ void getrf( DenseMatrix<MT,SO>& A, blas_int_t* ipiv );
 //
 // \note This function can only be used if a fitting LAPACK library, which supports this function,
 // is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// linker error. In case the LAPACK mode is disabled (see the BLAZE_LAPACK_MODE switch) or in case
+// of matrices with a small compile time maximum size (as for instance StaticMatrix), the function
+// is computed by native Blaze kernels, which do not require LAPACK.
 //
 // \note The LU decomposition will never fail, even for singular matrices. However, in case of a
 // singular matrix the resulting decomposition cannot be used for a matrix inversion or solving
@@ -126,18 +183,15 @@ inline void getrf( DenseMatrix<MT,SO>& A, blas_int_t* ipiv )
    BLAZE_CONSTRAINT_MUST_BE_CONTIGUOUS_TYPE( MT );
    BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT> );
 
-   blas_int_t m   ( numeric_cast<blas_int_t>( SO ? (~A).rows() : (~A).columns() ) );
-   blas_int_t n   ( numeric_cast<blas_int_t>( SO ? (~A).columns() : (~A).rows() ) );
-   blas_int_t lda ( numeric_cast<blas_int_t>( (~A).spacing() ) );
-   blas_int_t info( 0 );
-
-   if( m == 0 || n == 0 ) {
+   if( (~A).rows() == 0UL || (~A).columns() == 0UL ) {
       return;
    }
 
-   getrf( m, n, (~A).data(), lda, ipiv, &info );
+   const blas_int_t info( getrf_backend( ~A, ipiv ) );
 
    BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid argument for LU decomposition" );
+
+   MAYBE_UNUSED( info );
 }
 //*************************************************************************************************
 
@@ -50,8 +50,11 @@
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/lapack/clapack/getri.h>
+#include <blaze/math/lapack/native/getri.h>
 #include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
 #include <blaze/util/NumericCast.h>
+#include <blaze/util/Types.h>
 
 
 namespace blaze {
@@ -71,6 +74,58 @@ void getri( DenseMatrix<MT,SO>& A, const blas_int_t* ipiv );
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native backend of the inversion of the given dense general matrix.
+// \ingroup lapack_inversion
+//
+// \param A The LU decomposed matrix to be inverted.
+// \param ipiv Auxiliary array for the pivot indices; size >= min( \a m, \a n ).
+// \return The LAPACK info value.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline auto getri_backend( DenseMatrix<MT,SO>& A, const blas_int_t* ipiv )
+   -> EnableIf_t< UseNativeLAPACK_v<MT>, blas_int_t >
+{
+   auto L( lapackView( ~A ) );
+   return nativeGetri<NativeSize_v<MT,0UL>>( L, ipiv );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief LAPACK backend of the inversion of the given dense general matrix.
+// \ingroup lapack_inversion
+//
+// \param A The LU decomposed matrix to be inverted.
+// \param ipiv Auxiliary array for the pivot indices; size >= min( \a m, \a n ).
+// \return The LAPACK info value.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline auto getri_backend( DenseMatrix<MT,SO>& A, const blas_int_t* ipiv )
+   -> EnableIf_t< !UseNativeLAPACK_v<MT>, blas_int_t >
+{
+   using ET = ElementType_t<MT>;
+
+   blas_int_t n   ( numeric_cast<blas_int_t>( (~A).columns() ) );
+   blas_int_t lda ( numeric_cast<blas_int_t>( (~A).spacing() ) );
+   blas_int_t info( 0 );
+
+   blas_int_t lwork( n*lda );
+   const std::unique_ptr<ET[]> work( new ET[lwork] );
+
+   getri( n, (~A).data(), lda, ipiv, work.get(), lwork, &info );
+
+   return info;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief LAPACK kernel for the inversion of the given dense general matrix.
 // \ingroup lapack_inversion
@@ -101,7 +156,9 @@ void getri( DenseMatrix<MT,SO>& A, const blas_int_t* ipiv );
 //
 // \note This function can only be used if a fitting LAPACK library, which supports this function,
 // is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// linker error. In case the LAPACK mode is disabled (see the BLAZE_LAPACK_MODE switch) or in case
+// of matrices with a small compile time maximum size (as for instance StaticMatrix), the function
+// is computed by native Blaze kernels, which do not require LAPACK.
 //
 // \note This function does only provide the basic exception safety guarantee, i.e. in case of an
 // exception \a A may already have been modified.
@@ -116,24 +173,15 @@ inline void getri( DenseMatrix<MT,SO>& A, const blas_int_t* ipiv )
    BLAZE_CONSTRAINT_MUST_BE_CONTIGUOUS_TYPE( MT );
    BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT> );
 
-   using ET = ElementType_t<MT>;
-
    if( !isSquare( ~A ) ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
    }
 
-   blas_int_t n   ( numeric_cast<blas_int_t>( (~A).columns() ) );
-   blas_int_t lda ( numeric_cast<blas_int_t>( (~A).spacing() ) );
-   blas_int_t info( 0 );
-
-   if( n == 0 ) {
+   if( (~A).rows() == 0UL ) {
       return;
    }
 
-   blas_int_t lwork( n*lda );
-   const std::unique_ptr<ET[]> work( new ET[lwork] );
-
-   getri( n, (~A).data(), lda, ipiv, work.get(), lwork, &info );
+   const blas_int_t info( getri_backend( ~A, ipiv ) );
 
    BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid argument for matrix inversion" );
 
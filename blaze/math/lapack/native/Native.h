@@ -0,0 +1,263 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/native/Native.h
+//  \brief Header file for the common functionality of the native LAPACK kernels
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_LAPACK_NATIVE_NATIVE_H_
+#define _BLAZE_MATH_LAPACK_NATIVE_NATIVE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/dense/CustomMatrix.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/shims/Abs.h>
+#include <blaze/math/shims/Imaginary.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/typetraits/MaxSize.h>
+#include <blaze/math/typetraits/Size.h>
+#include <blaze/system/LAPACK.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  NATIVE LAPACK SETTINGS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Block size of the blocked native LAPACK kernels.
+// \ingroup lapack
+//
+// Matrices with at most this number of rows or columns are decomposed by the unblocked native
+// kernels. Larger matrices are decomposed block by block, where the updates of the trailing
+// matrices are performed by dense matrix multiplications (including their SMP parallelization).
+*/
+constexpr size_t NATIVE_LAPACK_BLOCK_SIZE = 64UL;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Maximum number of rows and columns of fixed size matrices handled by the native kernels.
+// \ingroup lapack
+//
+// Matrices with a compile time maximum number of rows and columns (as for instance StaticMatrix
+// and HybridMatrix) up to this size are always decomposed by the native LAPACK kernels, also
+// in case the LAPACK mode is enabled (see BLAZE_LAPACK_MODE).
+*/
+constexpr ptrdiff_t NATIVE_LAPACK_MAX_FIXED_SIZE = 32L;
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NATIVE LAPACK TYPE TRAITS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compile time check whether the native LAPACK kernels are used for the given matrix type.
+// \ingroup lapack
+//
+// This type trait evaluates to \a true in case the LAPACK mode is disabled (see
+// BLAZE_LAPACK_MODE) or in case the given matrix type \a MT has a small compile time maximum
+// number of rows and columns. Otherwise it evaluates to \a false.
+*/
+template< typename MT >  // Type of the dense matrix
+struct UseNativeLAPACK
+   : public BoolConstant< !BLAZE_LAPACK_MODE ||
+                          ( MaxSize_v<MT,0UL> != DefaultMaxSize_v &&
+                            MaxSize_v<MT,1UL> != DefaultMaxSize_v &&
+                            MaxSize_v<MT,0UL> <= NATIVE_LAPACK_MAX_FIXED_SIZE &&
+                            MaxSize_v<MT,1UL> <= NATIVE_LAPACK_MAX_FIXED_SIZE ) >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary variable template for the UseNativeLAPACK type trait.
+// \ingroup lapack
+*/
+template< typename MT >  // Type of the dense matrix
+constexpr bool UseNativeLAPACK_v = UseNativeLAPACK<MT>::value;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compile time number of rows (\a N = 0) or columns (\a N = 1) of the given matrix type.
+// \ingroup lapack
+//
+// This variable template evaluates to the number of rows or columns of the given matrix type in
+// case it is known at compile time. Otherwise it evaluates to 0, in which case the native LAPACK
+// kernels determine the size at runtime.
+*/
+template< typename MT  // Type of the dense matrix
+        , size_t N >   // Dimension
+constexpr size_t NativeSize_v = ( Size_v<MT,N> > 0L ? Size_v<MT,N> : 0L );
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NATIVE LAPACK VIEWS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unaligned, unpadded view on the elements of a dense matrix with data access.
+// \ingroup lapack
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+using NativeView = CustomMatrix<Type,unaligned,unpadded,SO>;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns a view on the given dense matrix.
+// \ingroup lapack
+//
+// \param A The given dense matrix.
+// \return The view on the elements of the given matrix.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline NativeView<ElementType_t<MT>,SO> nativeView( DenseMatrix<MT,SO>& A )
+{
+   return NativeView<ElementType_t<MT>,SO>( (~A).data(), (~A).rows(), (~A).columns(), (~A).spacing() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns a column-major view on the given dense matrix as seen by LAPACK.
+// \ingroup lapack
+//
+// \param A The given dense matrix.
+// \return The column-major view on the elements of the given matrix.
+//
+// This function returns a column-major view on the elements of the given dense matrix that
+// corresponds to the interpretation of the matrix by LAPACK: In case of a column-major matrix
+// the view represents the matrix itself, in case of a row-major matrix it represents the
+// transpose of the matrix.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline NativeView<ElementType_t<MT>,columnMajor> lapackView( DenseMatrix<MT,SO>& A )
+{
+   return NativeView<ElementType_t<MT>,columnMajor>( (~A).data(),
+                                                      ( SO ? (~A).rows() : (~A).columns() ),
+                                                      ( SO ? (~A).columns() : (~A).rows() ),
+                                                      (~A).spacing() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns a view on the transpose of the given dense matrix.
+// \ingroup lapack
+//
+// \param A The given dense matrix.
+// \return The view on the transpose of the given matrix.
+//
+// This function returns a view of opposite storage order on the elements of the given dense
+// matrix, which represents the transpose of the matrix. It enables the native LAPACK kernels to
+// treat the upper part of a matrix as the lower part of its transpose.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline NativeView<ElementType_t<MT>,!SO> transposedView( DenseMatrix<MT,SO>& A )
+{
+   return NativeView<ElementType_t<MT>,!SO>( (~A).data(), (~A).columns(), (~A).rows(), (~A).spacing() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NATIVE LAPACK UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the pivoting criterion of the given value (\f$ |re(x)| + |im(x)| \f$).
+// \ingroup lapack
+//
+// \param x The given value.
+// \return The sum of the absolute values of the real and imaginary part.
+*/
+template< typename T >  // Type of the value
+inline auto pivotValue( const T& x )
+{
+   return abs( real( x ) ) + abs( imag( x ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
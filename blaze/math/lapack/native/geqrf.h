@@ -0,0 +1,334 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/native/geqrf.h
+//  \brief Header file for the native QR decomposition kernels
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_LAPACK_NATIVE_GEQRF_H_
+#define _BLAZE_MATH_LAPACK_NATIVE_GEQRF_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/lapack/native/Native.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/Imaginary.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/shims/Sqrt.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  NATIVE HOUSEHOLDER REFLECTORS (LARFG/LARFT)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native generation of the Householder reflector for the given column of a dense matrix.
+// \ingroup lapack
+//
+// \param A The dense matrix.
+// \param j The index of the column (and of the diagonal element) of the reflector.
+// \return The scalar factor \a tau of the reflector.
+//
+// This function generates an elementary reflector \f$ H = I - tau \cdot v \cdot v^{H} \f$ such
+// that \f$ H^{H} \f$ maps the column vector \f$ A(j:m,j) \f$ to \f$ (beta,0,...,0)^{T} \f$ with
+// real \a beta in the same form as the LAPACK \c larfg() function: \a beta is stored in
+// \f$ A(j,j) \f$ and the vector \a v (with \f$ v(0) = 1 \f$) is stored in \f$ A(j+1:m,j) \f$.
+*/
+template< typename MT >  // Type of the dense matrix
+ElementType_t<MT> nativeLarfg( MT& A, size_t j )
+{
+   using ET = ElementType_t<MT>;
+   using RT = decltype( real( ET() ) );
+
+   const size_t m( A.rows() );
+
+   RT xnorm( 0 );
+   for( size_t i=j+1UL; i<m; ++i ) {
+      xnorm += real( A(i,j) * conj( A(i,j) ) );
+   }
+
+   const ET  alpha( A(j,j) );
+   const RT alphr( real( alpha ) );
+   const RT alphi( imag( alpha ) );
+
+   if( isDefault( xnorm ) && isDefault( alphi ) ) {
+      return ET(0);
+   }
+
+   RT beta( sqrt( alphr*alphr + alphi*alphi + xnorm ) );
+   if( alphr >= RT(0) ) {
+      beta = -beta;
+   }
+
+   const ET tau( ( ET(beta) - alpha ) / ET(beta) );
+   const ET scale( ET(1) / ( alpha - ET(beta) ) );
+
+   for( size_t i=j+1UL; i<m; ++i ) {
+      A(i,j) *= scale;
+   }
+
+   A(j,j) = beta;
+
+   return tau;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native computation of the triangular factor of a block of Householder reflectors.
+// \ingroup lapack
+//
+// \param V The unit lower trapezoidal matrix of Householder vectors.
+// \param tau The scalar factors of the Householder reflectors.
+// \param T The resulting upper triangular factor.
+// \return void
+//
+// This function computes the upper triangular matrix \c T of the block reflector
+// \f$ H = H(0) H(1) ... H(k-1) = I - V \cdot T \cdot V^{H} \f$ in the same form as the LAPACK
+// \c larft() function (forward direction, columnwise storage).
+*/
+template< typename MT1   // Type of the matrix of Householder vectors
+        , typename ET    // Type of the scalar factors
+        , typename MT2 > // Type of the triangular factor
+void nativeLarft( const MT1& V, const ET* tau, MT2& T )
+{
+   const size_t m( V.rows() );
+   const size_t k( V.columns() );
+
+   for( size_t i=0UL; i<k; ++i )
+   {
+      if( isDefault( tau[i] ) ) {
+         for( size_t j=0UL; j<=i; ++j ) {
+            T(j,i) = ET(0);
+         }
+         continue;
+      }
+
+      for( size_t j=0UL; j<i; ++j ) {
+         ET sum( conj( V(i,j) ) );
+         for( size_t r=i+1UL; r<m; ++r ) {
+            sum += conj( V(r,j) ) * V(r,i);
+         }
+         T(j,i) = -tau[i] * sum;
+      }
+
+      for( size_t j=0UL; j<i; ++j ) {
+         ET sum( T(j,j) * T(j,i) );
+         for( size_t l=j+1UL; l<i; ++l ) {
+            sum += T(j,l) * T(l,i);
+         }
+         T(j,i) = sum;
+      }
+
+      T(i,i) = tau[i];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Copies the unit lower trapezoidal matrix of Householder vectors from a dense matrix.
+// \ingroup lapack
+//
+// \param A The dense matrix containing the Householder vectors below its diagonal.
+// \param V The resulting unit lower trapezoidal matrix.
+// \return void
+*/
+template< typename MT1   // Type of the dense matrix
+        , typename MT2 > // Type of the matrix of Householder vectors
+void nativeCopyReflectors( const MT1& A, MT2& V )
+{
+   using ET = ElementType_t<MT2>;
+
+   const size_t m( A.rows() );
+   const size_t k( A.columns() );
+
+   V.resize( m, k, false );
+
+   for( size_t j=0UL; j<k; ++j ) {
+      for( size_t i=0UL; i<j; ++i ) {
+         V(i,j) = ET(0);
+      }
+      V(j,j) = ET(1);
+      for( size_t i=j+1UL; i<m; ++i ) {
+         V(i,j) = A(i,j);
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NATIVE QR DECOMPOSITION (GEQR2/GEQRF)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native unblocked QR decomposition of a dense matrix.
+// \ingroup lapack
+//
+// \param dm The matrix to be decomposed.
+// \param tau Array for the scalar factors of the Householder reflectors; size >= min( \a m, \a n ).
+// \return void
+//
+// This function computes the QR decomposition \f$ A = Q \cdot R \f$ in the same form as the
+// LAPACK \c geqr2() function: \c R is stored in the upper part of the matrix, the Householder
+// vectors are stored below the diagonal. In case the number of rows \a M and columns \a N are
+// known at compile time, all loop bounds are compile time constants.
+*/
+template< size_t M     // Compile time number of rows (0 for runtime size)
+        , size_t N     // Compile time number of columns (0 for runtime size)
+        , typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void nativeGeqr2( DenseMatrix<MT,SO>& dm, ElementType_t<MT>* tau )
+{
+   using ET = ElementType_t<MT>;
+
+   MT& A( ~dm );
+
+   const size_t m( M ? M : A.rows() );
+   const size_t n( N ? N : A.columns() );
+   const size_t k( min( m, n ) );
+
+   for( size_t i=0UL; i<k; ++i )
+   {
+      tau[i] = nativeLarfg( A, i );
+
+      const ET ctau( conj( tau[i] ) );
+
+      if( isDefault( ctau ) ) continue;
+
+      for( size_t c=i+1UL; c<n; ++c )
+      {
+         ET w( A(i,c) );
+         for( size_t r=i+1UL; r<m; ++r ) {
+            w += conj( A(r,i) ) * A(r,c);
+         }
+         w *= ctau;
+
+         A(i,c) -= w;
+         for( size_t r=i+1UL; r<m; ++r ) {
+            A(r,c) -= A(r,i) * w;
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native blocked QR decomposition of a dense matrix.
+// \ingroup lapack
+//
+// \param dm The matrix to be decomposed.
+// \param tau Array for the scalar factors of the Householder reflectors; size >= min( \a m, \a n ).
+// \return void
+//
+// This function computes the QR decomposition \f$ A = Q \cdot R \f$ in the same form as the
+// LAPACK \c geqrf() function. Small matrices are decomposed by the unblocked kernel. For larger
+// matrices each panel of NATIVE_LAPACK_BLOCK_SIZE columns is decomposed by the unblocked kernel
+// and the according block reflector \f$ I - V \cdot T \cdot V^{H} \f$ is applied to the
+// trailing matrix by means of dense matrix multiplications.
+*/
+template< size_t M     // Compile time number of rows (0 for runtime size)
+        , size_t N     // Compile time number of columns (0 for runtime size)
+        , typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void nativeGeqrf( DenseMatrix<MT,SO>& dm, ElementType_t<MT>* tau )
+{
+   using ET = ElementType_t<MT>;
+
+   constexpr size_t NB( NATIVE_LAPACK_BLOCK_SIZE );
+
+   MT& A( ~dm );
+
+   const size_t m( M ? M : A.rows() );
+   const size_t n( N ? N : A.columns() );
+   const size_t k( min( m, n ) );
+
+   if( k <= NB || n <= NB ) {
+      nativeGeqr2<M,N>( A, tau );
+      return;
+   }
+
+   DynamicMatrix<ET,columnMajor> V, T( NB, NB, ET(0) ), W;
+
+   for( size_t i=0UL; i<k; i+=NB )
+   {
+      const size_t ib( min( k-i, NB ) );
+
+      auto panel( submatrix( A, i, i, m-i, ib ) );
+      nativeGeqr2<0UL,0UL>( panel, tau+i );
+
+      if( i+ib >= n ) continue;
+
+      nativeCopyReflectors( panel, V );
+      auto T1( submatrix( T, 0UL, 0UL, ib, ib ) );
+      nativeLarft( V, tau+i, T1 );
+
+      auto C( submatrix( A, i, i+ib, m-i, n-i-ib ) );
+      W = ctrans( V ) * C;
+      W = ctrans( T1 ) * W;
+      C -= V * W;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,230 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/native/getrf.h
+//  \brief Header file for the native LU decomposition kernels
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_LAPACK_NATIVE_GETRF_H_
+#define _BLAZE_MATH_LAPACK_NATIVE_GETRF_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/blas/Types.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/lapack/native/Native.h>
+#include <blaze/math/RelaxationFlag.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  NATIVE LU DECOMPOSITION (GETF2/GETRF)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native unblocked LU decomposition of a column-major dense matrix.
+// \ingroup lapack
+//
+// \param dm The matrix to be decomposed.
+// \param ipiv Auxiliary array for the (1-based) pivot indices; size >= min( \a m, \a n ).
+// \return 0 on success, \a j+1 in case \f$ U(j,j) \f$ is exactly zero.
+//
+// This function computes the LU decomposition \f$ A = P \cdot L \cdot U \f$ with partial
+// pivoting and row interchanges in the same form as the LAPACK \c getf2() function. In case
+// the number of rows \a M and columns \a N are known at compile time, all loop bounds are
+// compile time constants.
+*/
+template< size_t M     // Compile time number of rows (0 for runtime size)
+        , size_t N     // Compile time number of columns (0 for runtime size)
+        , typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+blas_int_t nativeGetf2( DenseMatrix<MT,SO>& dm, blas_int_t* ipiv )
+{
+   using ET = ElementType_t<MT>;
+
+   using std::swap;
+
+   MT& A( ~dm );
+
+   const size_t m( M ? M : A.rows() );
+   const size_t n( N ? N : A.columns() );
+   const size_t k( min( m, n ) );
+
+   blas_int_t info( 0 );
+
+   for( size_t j=0UL; j<k; ++j )
+   {
+      size_t p( j );
+      auto pmax( pivotValue( A(j,j) ) );
+
+      for( size_t i=j+1UL; i<m; ++i ) {
+         const auto value( pivotValue( A(i,j) ) );
+         if( value > pmax ) {
+            pmax = value;
+            p = i;
+         }
+      }
+
+      ipiv[j] = static_cast<blas_int_t>( p+1UL );
+
+      if( !isDefault<strict>( A(p,j) ) )
+      {
+         if( p != j ) {
+            for( size_t c=0UL; c<n; ++c ) {
+               swap( A(j,c), A(p,c) );
+            }
+         }
+
+         const ET scale( ET(1) / A(j,j) );
+         for( size_t i=j+1UL; i<m; ++i ) {
+            A(i,j) *= scale;
+         }
+      }
+      else if( info == 0 ) {
+         info = static_cast<blas_int_t>( j+1UL );
+      }
+
+      for( size_t c=j+1UL; c<n; ++c ) {
+         const ET tmp( A(j,c) );
+         for( size_t i=j+1UL; i<m; ++i ) {
+            A(i,c) -= A(i,j) * tmp;
+         }
+      }
+   }
+
+   return info;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native blocked LU decomposition of a column-major dense matrix.
+// \ingroup lapack
+//
+// \param dm The matrix to be decomposed.
+// \param ipiv Auxiliary array for the (1-based) pivot indices; size >= min( \a m, \a n ).
+// \return 0 on success, \a j+1 in case \f$ U(j,j) \f$ is exactly zero.
+//
+// This function computes the LU decomposition \f$ A = P \cdot L \cdot U \f$ with partial
+// pivoting and row interchanges in the same form as the LAPACK \c getrf() function. Small
+// matrices are decomposed by the unblocked kernel. Larger matrices are decomposed by a right
+// looking blocked algorithm: Each panel of NATIVE_LAPACK_BLOCK_SIZE columns is decomposed by
+// the unblocked kernel and the trailing matrix is updated by a dense matrix multiplication,
+// which is parallelized in case the SMP thresholds are exceeded.
+*/
+template< size_t M     // Compile time number of rows (0 for runtime size)
+        , size_t N     // Compile time number of columns (0 for runtime size)
+        , typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+blas_int_t nativeGetrf( DenseMatrix<MT,SO>& dm, blas_int_t* ipiv )
+{
+   using std::swap;
+
+   constexpr size_t NB( NATIVE_LAPACK_BLOCK_SIZE );
+
+   MT& A( ~dm );
+
+   const size_t m( M ? M : A.rows() );
+   const size_t n( N ? N : A.columns() );
+   const size_t k( min( m, n ) );
+
+   if( k <= NB ) {
+      return nativeGetf2<M,N>( A, ipiv );
+   }
+
+   blas_int_t info( 0 );
+
+   for( size_t j=0UL; j<k; j+=NB )
+   {
+      const size_t jb( min( k-j, NB ) );
+
+      auto panel( submatrix( A, j, j, m-j, jb ) );
+      const blas_int_t iinfo( nativeGetf2<0UL,0UL>( panel, ipiv+j ) );
+
+      if( info == 0 && iinfo > 0 ) {
+         info = iinfo + static_cast<blas_int_t>( j );
+      }
+
+      for( size_t i=j; i<j+jb; ++i )
+      {
+         ipiv[i] += static_cast<blas_int_t>( j );
+
+         const size_t p( ipiv[i]-1 );
+         if( p == i ) continue;
+
+         for( size_t c=0UL; c<j; ++c ) {
+            swap( A(i,c), A(p,c) );
+         }
+         for( size_t c=j+jb; c<n; ++c ) {
+            swap( A(i,c), A(p,c) );
+         }
+      }
+
+      if( j+jb >= n ) continue;
+
+      auto A12( submatrix( A, j, j+jb, jb, n-j-jb ) );
+
+      for( size_t c=0UL; c<A12.columns(); ++c ) {
+         for( size_t l=0UL; l<jb; ++l ) {
+            const auto tmp( A12(l,c) );
+            for( size_t i=l+1UL; i<jb; ++i ) {
+               A12(i,c) -= A(j+i,j+l) * tmp;
+            }
+         }
+      }
+
+      if( j+jb < m ) {
+         submatrix( A, j+jb, j+jb, m-j-jb, n-j-jb ) -= submatrix( A, j+jb, j, m-j-jb, jb ) * A12;
+      }
+   }
+
+   return info;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,178 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/native/getri.h
+//  \brief Header file for the native LU-based matrix inversion kernel
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_LAPACK_NATIVE_GETRI_H_
+#define _BLAZE_MATH_LAPACK_NATIVE_GETRI_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/blas/Types.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/lapack/native/Native.h>
+#include <blaze/math/lapack/native/trtri.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/views/Column.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  NATIVE LU-BASED MATRIX INVERSION (GETRI)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native inversion of a column-major dense matrix based on its LU decomposition.
+// \ingroup lapack
+//
+// \param dm The LU decomposed matrix to be inverted.
+// \param ipiv The (1-based) pivot indices of the LU decomposition.
+// \return 0 on success, \a j+1 in case \f$ U(j,j) \f$ is exactly zero.
+//
+// This function computes the inverse of a square matrix from its LU decomposition as computed
+// by nativeGetrf() in the same form as the LAPACK \c getri() function: It inverts \c U and then
+// solves the system \f$ A^{-1} \cdot L = U^{-1} \f$ for \f$ A^{-1} \f$. For large matrices the
+// system is solved block by block, where the bulk of the work is performed by dense matrix
+// multiplications.
+*/
+template< size_t N     // Compile time number of rows and columns (0 for runtime size)
+        , typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+blas_int_t nativeGetri( DenseMatrix<MT,SO>& dm, const blas_int_t* ipiv )
+{
+   using ET = ElementType_t<MT>;
+
+   using std::swap;
+
+   constexpr size_t NB( NATIVE_LAPACK_BLOCK_SIZE );
+
+   MT& A( ~dm );
+
+   const size_t n( N ? N : A.rows() );
+
+   if( n == 0UL ) {
+      return 0;
+   }
+
+   auto U( transposedView( A ) );
+   const blas_int_t info( nativeTrtri<N>( U, false ) );
+
+   if( info > 0 ) {
+      return info;
+   }
+
+   if( n <= NB )
+   {
+      ET work[N ? N : 1UL];
+      DynamicMatrix<ET,columnMajor> buffer;
+
+      ET* w( work );
+      if( !N ) {
+         buffer.resize( n, 1UL, false );
+         w = buffer.data();
+      }
+
+      for( size_t j=n; j-- > 0UL; )
+      {
+         for( size_t i=j+1UL; i<n; ++i ) {
+            w[i] = A(i,j);
+            A(i,j) = ET(0);
+         }
+
+         for( size_t l=j+1UL; l<n; ++l ) {
+            const ET tmp( w[l] );
+            for( size_t i=0UL; i<n; ++i ) {
+               A(i,j) -= A(i,l) * tmp;
+            }
+         }
+      }
+   }
+   else
+   {
+      DynamicMatrix<ET,columnMajor> W( n, NB );
+
+      for( size_t j=((n-1UL)/NB)*NB; ; j-=NB )
+      {
+         const size_t jb( min( n-j, NB ) );
+
+         for( size_t jj=j; jj<j+jb; ++jj ) {
+            for( size_t i=jj+1UL; i<n; ++i ) {
+               W(i,jj-j) = A(i,jj);
+               A(i,jj) = ET(0);
+            }
+         }
+
+         if( j+jb < n ) {
+            submatrix( A, 0UL, j, n, jb ) -=
+               submatrix( A, 0UL, j+jb, n, n-j-jb ) * submatrix( W, j+jb, 0UL, n-j-jb, jb );
+         }
+
+         for( size_t c=jb; c-- > 0UL; ) {
+            for( size_t l=c+1UL; l<jb; ++l ) {
+               column( A, j+c ) -= column( A, j+l ) * W(j+l,c);
+            }
+         }
+
+         if( j == 0UL ) break;
+      }
+   }
+
+   for( size_t j=n-1UL; j-- > 0UL; ) {
+      const size_t p( ipiv[j]-1 );
+      if( p != j ) {
+         for( size_t i=0UL; i<n; ++i ) {
+            swap( A(i,j), A(i,p) );
+         }
+      }
+   }
+
+   return 0;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,120 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/native/potf2.h
+//  \brief Header file for the native unblocked Cholesky decomposition kernel
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_LAPACK_NATIVE_POTF2_H_
+#define _BLAZE_MATH_LAPACK_NATIVE_POTF2_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/blas/Types.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/shims/Sqrt.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  NATIVE UNBLOCKED CHOLESKY DECOMPOSITION (POTF2)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native unblocked Cholesky decomposition of the lower part of a dense matrix.
+// \ingroup lapack
+//
+// \param dm The positive definite matrix to be decomposed.
+// \return 0 on success, \a j+1 in case the leading minor of order \a j+1 is not positive definite.
+//
+// This function computes the lower Cholesky factor \c L (\f$ A = L \cdot L^{H} \f$) of the
+// given square matrix based on the lower part of the matrix. The factor is stored in the lower
+// part of the matrix, the strictly upper part is not accessed. In contrast to the LAPACK
+// \c potf2() function the native kernel works for any element type and can therefore also be
+// used without linking a LAPACK library. In case the number of rows and columns \a N is known
+// at compile time, all loop bounds are compile time constants.
+*/
+template< size_t N     // Compile time number of rows and columns (0 for runtime size)
+        , typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+blas_int_t nativePotf2( DenseMatrix<MT,SO>& dm )
+{
+   using ET = ElementType_t<MT>;
+
+   MT& A( ~dm );
+
+   const size_t n( N ? N : A.rows() );
+
+   for( size_t j=0UL; j<n; ++j )
+   {
+      auto ajj( real( A(j,j) ) );
+      for( size_t k=0UL; k<j; ++k ) {
+         ajj -= real( A(j,k) * conj( A(j,k) ) );
+      }
+
+      if( !( ajj > decltype(ajj)(0) ) ) {
+         return static_cast<blas_int_t>( j+1UL );
+      }
+
+      ajj = sqrt( ajj );
+      A(j,j) = ajj;
+
+      for( size_t k=0UL; k<j; ++k ) {
+         const ET tmp( conj( A(j,k) ) );
+         for( size_t i=j+1UL; i<n; ++i ) {
+            A(i,j) -= A(i,k) * tmp;
+         }
+      }
+
+      const auto scale( decltype(ajj)(1) / ajj );
+      for( size_t i=j+1UL; i<n; ++i ) {
+         A(i,j) *= scale;
+      }
+   }
+
+   return 0;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
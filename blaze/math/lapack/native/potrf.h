@@ -0,0 +1,144 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/native/potrf.h
+//  \brief Header file for the native blocked Cholesky decomposition kernel
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_LAPACK_NATIVE_POTRF_H_
+#define _BLAZE_MATH_LAPACK_NATIVE_POTRF_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/blas/Types.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/lapack/native/Native.h>
+#include <blaze/math/lapack/native/potf2.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/views/Column.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  NATIVE BLOCKED CHOLESKY DECOMPOSITION (POTRF)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native blocked Cholesky decomposition of the lower part of a dense matrix.
+// \ingroup lapack
+//
+// \param dm The positive definite matrix to be decomposed.
+// \return 0 on success, \a j+1 in case the leading minor of order \a j+1 is not positive definite.
+//
+// This function computes the lower Cholesky factor \c L (\f$ A = L \cdot L^{H} \f$) of the
+// given square matrix in the same form as the LAPACK \c potrf() function. Small matrices are
+// decomposed by the unblocked kernel (see nativePotf2()). Larger matrices are decomposed by a
+// right looking blocked algorithm, which updates the lower part of the trailing matrix by dense
+// matrix multiplications. The strictly upper part of the matrix is not accessed.
+*/
+template< size_t N     // Compile time number of rows and columns (0 for runtime size)
+        , typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+blas_int_t nativePotrf( DenseMatrix<MT,SO>& dm )
+{
+   constexpr size_t NB( NATIVE_LAPACK_BLOCK_SIZE );
+
+   MT& A( ~dm );
+
+   const size_t n( N ? N : A.rows() );
+
+   if( n <= NB ) {
+      return nativePotf2<N>( A );
+   }
+
+   for( size_t j=0UL; j<n; j+=NB )
+   {
+      const size_t jb( min( n-j, NB ) );
+
+      auto A11( submatrix( A, j, j, jb, jb ) );
+      const blas_int_t info( nativePotf2<0UL>( A11 ) );
+
+      if( info > 0 ) {
+         return info + static_cast<blas_int_t>( j );
+      }
+
+      if( j+jb >= n ) break;
+
+      const size_t n2( n-j-jb );
+      auto A21( submatrix( A, j+jb, j, n2, jb ) );
+
+      for( size_t c=0UL; c<jb; ++c ) {
+         auto col( column( A21, c ) );
+         for( size_t l=0UL; l<c; ++l ) {
+            col -= column( A21, l ) * conj( A11(c,l) );
+         }
+         col *= decltype( real( A11(c,c) ) )(1) / real( A11(c,c) );
+      }
+
+      for( size_t b=0UL; b<n2; b+=NB )
+      {
+         const size_t bw( min( n2-b, NB ) );
+
+         const auto L1( submatrix( A21, b, 0UL, bw, jb ) );
+         const auto D( evaluate( L1 * ctrans( L1 ) ) );
+
+         for( size_t c=0UL; c<bw; ++c ) {
+            for( size_t i=c; i<bw; ++i ) {
+               A(j+jb+b+i,j+jb+b+c) -= D(i,c);
+            }
+         }
+
+         if( b+bw < n2 ) {
+            submatrix( A, j+jb+b+bw, j+jb+b, n2-b-bw, bw ) -=
+               submatrix( A21, b+bw, 0UL, n2-b-bw, jb ) * ctrans( L1 );
+         }
+      }
+   }
+
+   return 0;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,137 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/native/potri.h
+//  \brief Header file for the native Cholesky-based matrix inversion kernel
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_LAPACK_NATIVE_POTRI_H_
+#define _BLAZE_MATH_LAPACK_NATIVE_POTRI_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/blas/Types.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/lapack/native/Native.h>
+#include <blaze/math/lapack/native/trtri.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  NATIVE CHOLESKY-BASED MATRIX INVERSION (POTRI)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native inversion of a positive definite matrix based on its lower Cholesky factor.
+// \ingroup lapack
+//
+// \param dm The lower Cholesky factor \c L of the matrix to be inverted.
+// \return 0 on success, \a j+1 in case \f$ L(j,j) \f$ is exactly zero.
+//
+// This function computes the lower part of the inverse \f$ A^{-1} = L^{-H} \cdot L^{-1} \f$
+// from the lower Cholesky factor as computed by nativePotrf() in the same form as the LAPACK
+// \c potri() function. The strictly upper part of the matrix is not accessed. For large
+// matrices the product of the inverted factors is computed by a dense matrix multiplication.
+*/
+template< size_t N     // Compile time number of rows and columns (0 for runtime size)
+        , typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+blas_int_t nativePotri( DenseMatrix<MT,SO>& dm )
+{
+   using ET = ElementType_t<MT>;
+
+   MT& A( ~dm );
+
+   const size_t n( N ? N : A.rows() );
+
+   const blas_int_t info( nativeTrtri<N>( A, false ) );
+
+   if( info > 0 ) {
+      return info;
+   }
+
+   if( n <= NATIVE_LAPACK_BLOCK_SIZE )
+   {
+      for( size_t i=0UL; i<n; ++i )
+      {
+         for( size_t j=0UL; j<i; ++j ) {
+            ET sum( conj( A(i,i) ) * A(i,j) );
+            for( size_t k=i+1UL; k<n; ++k ) {
+               sum += conj( A(k,i) ) * A(k,j);
+            }
+            A(i,j) = sum;
+         }
+
+         ET sum( conj( A(i,i) ) * A(i,i) );
+         for( size_t k=i+1UL; k<n; ++k ) {
+            sum += conj( A(k,i) ) * A(k,i);
+         }
+         A(i,i) = sum;
+      }
+   }
+   else
+   {
+      DynamicMatrix<ET,columnMajor> L( n, n, ET(0) );
+
+      for( size_t j=0UL; j<n; ++j ) {
+         for( size_t i=j; i<n; ++i ) {
+            L(i,j) = A(i,j);
+         }
+      }
+
+      const DynamicMatrix<ET,columnMajor> C( ctrans( L ) * L );
+
+      for( size_t j=0UL; j<n; ++j ) {
+         for( size_t i=j; i<n; ++i ) {
+            A(i,j) = C(i,j);
+         }
+      }
+   }
+
+   return 0;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
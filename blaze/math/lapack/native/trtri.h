@@ -0,0 +1,231 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/native/trtri.h
+//  \brief Header file for the native triangular matrix inversion kernel
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_LAPACK_NATIVE_TRTRI_H_
+#define _BLAZE_MATH_LAPACK_NATIVE_TRTRI_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/blas/Types.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/lapack/native/Native.h>
+#include <blaze/math/RelaxationFlag.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/views/Column.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  NATIVE TRIANGULAR MATRIX INVERSION (TRTI2/TRTRI)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native in-place inversion of a lower triangular dense matrix.
+// \ingroup lapack
+//
+// \param dm The lower triangular matrix to be inverted.
+// \param unit \a true in case the matrix is unitriangular, \a false if not.
+// \return 0 on success, \a j+1 in case \f$ A(j,j) \f$ is exactly zero.
+//
+// This function inverts the lower part of the given square matrix in the same form as the
+// LAPACK \c trti2() function. The strictly upper part of the matrix is not accessed and in case
+// of a unitriangular matrix the diagonal elements are not accessed either. Upper triangular
+// matrices are inverted by means of a transposed view (see transposedView()). In case the number
+// of rows and columns \a N is known at compile time, all loop bounds are compile time constants.
+*/
+template< size_t N     // Compile time number of rows and columns (0 for runtime size)
+        , typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+blas_int_t nativeTrti2( DenseMatrix<MT,SO>& dm, bool unit )
+{
+   using ET = ElementType_t<MT>;
+
+   MT& A( ~dm );
+
+   const size_t n( N ? N : A.rows() );
+
+   if( !unit ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         if( isDefault<strict>( A(j,j) ) )
+            return static_cast<blas_int_t>( j+1UL );
+      }
+   }
+
+   for( size_t j=n; j-- > 0UL; )
+   {
+      ET ajj( -1 );
+
+      if( !unit ) {
+         A(j,j) = ET(1) / A(j,j);
+         ajj = -A(j,j);
+      }
+
+      for( size_t l=n-1UL; l>j; --l )
+      {
+         const ET tmp( A(l,j) );
+         for( size_t i=l+1UL; i<n; ++i ) {
+            A(i,j) += tmp * A(i,l);
+         }
+         if( !unit ) {
+            A(l,j) *= A(l,l);
+         }
+      }
+
+      for( size_t i=j+1UL; i<n; ++i ) {
+         A(i,j) *= ajj;
+      }
+   }
+
+   return 0;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native blocked in-place inversion of a lower triangular dense matrix.
+// \ingroup lapack
+//
+// \param dm The lower triangular matrix to be inverted.
+// \param unit \a true in case the matrix is unitriangular, \a false if not.
+// \return 0 on success, \a j+1 in case \f$ A(j,j) \f$ is exactly zero.
+//
+// This function inverts the lower part of the given square matrix in the same form as the
+// LAPACK \c trtri() function. Small matrices are inverted by the unblocked kernel (see
+// nativeTrti2()). Larger matrices are inverted block column by block column, starting with the
+// last one. The bulk of the work, i.e. the multiplication of each block column with the already
+// inverted trailing matrix, is performed by dense matrix multiplications.
+*/
+template< size_t N     // Compile time number of rows and columns (0 for runtime size)
+        , typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+blas_int_t nativeTrtri( DenseMatrix<MT,SO>& dm, bool unit )
+{
+   using ET = ElementType_t<MT>;
+
+   constexpr size_t NB( NATIVE_LAPACK_BLOCK_SIZE );
+
+   MT& A( ~dm );
+
+   const size_t n( N ? N : A.rows() );
+
+   if( n <= NB ) {
+      return nativeTrti2<N>( A, unit );
+   }
+
+   if( !unit ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         if( isDefault<strict>( A(j,j) ) )
+            return static_cast<blas_int_t>( j+1UL );
+      }
+   }
+
+   DynamicMatrix<ET,columnMajor> D( NB, NB, ET(0) );
+
+   for( size_t j=((n-1UL)/NB)*NB; ; j-=NB )
+   {
+      const size_t jb( min( n-j, NB ) );
+      const size_t n2( n-j-jb );
+
+      if( n2 > 0UL )
+      {
+         auto A21( submatrix( A, j+jb, j, n2, jb ) );
+
+         // Computing A21 = inv(L22) * A21 from the bottom up
+         for( size_t r=((n2-1UL)/NB)*NB; ; r-=NB )
+         {
+            const size_t rb( min( n2-r, NB ) );
+
+            auto D1( submatrix( D, 0UL, 0UL, rb, rb ) );
+            for( size_t c=0UL; c<rb; ++c ) {
+               D1(c,c) = unit ? ET(1) : A(j+jb+r+c,j+jb+r+c);
+               for( size_t i=c+1UL; i<rb; ++i ) {
+                  D1(i,c) = A(j+jb+r+i,j+jb+r+c);
+               }
+            }
+
+            auto X( submatrix( A21, r, 0UL, rb, jb ) );
+            X = D1 * X;
+
+            if( r > 0UL ) {
+               X += submatrix( A, j+jb+r, j+jb, rb, r ) * submatrix( A21, 0UL, 0UL, r, jb );
+            }
+
+            if( r == 0UL ) break;
+         }
+
+         // Computing A21 = -A21 * inv(L11) (the columns right of c are already negated)
+         for( size_t c=jb; c-- > 0UL; )
+         {
+            auto col( column( A21, c ) );
+            for( size_t l=c+1UL; l<jb; ++l ) {
+               col += column( A21, l ) * A(j+l,j+c);
+            }
+            if( unit ) {
+               col = -col;
+            }
+            else {
+               col *= ET(-1) / A(j+c,j+c);
+            }
+         }
+      }
+
+      auto A11( submatrix( A, j, j, jb, jb ) );
+      nativeTrti2<0UL>( A11, unit );
+
+      if( j == 0UL ) break;
+   }
+
+   return 0;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
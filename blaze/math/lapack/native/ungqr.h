@@ -0,0 +1,208 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/native/ungqr.h
+//  \brief Header file for the native reconstruction kernels of Q from a QR decomposition
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_LAPACK_NATIVE_UNGQR_H_
+#define _BLAZE_MATH_LAPACK_NATIVE_UNGQR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/lapack/native/geqrf.h>
+#include <blaze/math/lapack/native/Native.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  NATIVE RECONSTRUCTION OF Q FROM A QR DECOMPOSITION (UNG2R/UNGQR)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native unblocked reconstruction of the matrix Q from a QR decomposition.
+// \ingroup lapack
+//
+// \param dm The matrix containing the Householder vectors of the QR decomposition.
+// \param k The number of Householder reflectors.
+// \param tau The scalar factors of the Householder reflectors.
+// \return void
+//
+// This function generates the \a m-by-\a n matrix \c Q with orthonormal columns, which is
+// defined as the first \a n columns of the product of \a k Householder reflectors as computed
+// by nativeGeqrf(), in the same form as the LAPACK \c ung2r() and \c org2r() functions.
+*/
+template< size_t M     // Compile time number of rows (0 for runtime size)
+        , size_t N     // Compile time number of columns (0 for runtime size)
+        , typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void nativeUng2r( DenseMatrix<MT,SO>& dm, size_t k, const ElementType_t<MT>* tau )
+{
+   using ET = ElementType_t<MT>;
+
+   MT& A( ~dm );
+
+   const size_t m( M ? M : A.rows() );
+   const size_t n( N ? N : A.columns() );
+
+   for( size_t j=k; j<n; ++j ) {
+      for( size_t i=0UL; i<m; ++i ) {
+         A(i,j) = ET(0);
+      }
+      A(j,j) = ET(1);
+   }
+
+   for( size_t i=k; i-- > 0UL; )
+   {
+      if( !isDefault( tau[i] ) )
+      {
+         for( size_t c=i+1UL; c<n; ++c )
+         {
+            ET w( A(i,c) );
+            for( size_t r=i+1UL; r<m; ++r ) {
+               w += conj( A(r,i) ) * A(r,c);
+            }
+            w *= tau[i];
+
+            A(i,c) -= w;
+            for( size_t r=i+1UL; r<m; ++r ) {
+               A(r,c) -= A(r,i) * w;
+            }
+         }
+      }
+
+      for( size_t r=i+1UL; r<m; ++r ) {
+         A(r,i) *= -tau[i];
+      }
+
+      A(i,i) = ET(1) - tau[i];
+
+      for( size_t r=0UL; r<i; ++r ) {
+         A(r,i) = ET(0);
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native blocked reconstruction of the matrix Q from a QR decomposition.
+// \ingroup lapack
+//
+// \param dm The matrix containing the Householder vectors of the QR decomposition.
+// \param k The number of Householder reflectors.
+// \param tau The scalar factors of the Householder reflectors.
+// \return void
+//
+// This function generates the \a m-by-\a n matrix \c Q with orthonormal columns, which is
+// defined as the first \a n columns of the product of \a k Householder reflectors as computed
+// by nativeGeqrf(), in the same form as the LAPACK \c ungqr() and \c orgqr() functions. For
+// large matrices the reflectors are applied block by block by means of dense matrix
+// multiplications.
+*/
+template< size_t M     // Compile time number of rows (0 for runtime size)
+        , size_t N     // Compile time number of columns (0 for runtime size)
+        , typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void nativeUngqr( DenseMatrix<MT,SO>& dm, size_t k, const ElementType_t<MT>* tau )
+{
+   using ET = ElementType_t<MT>;
+
+   constexpr size_t NB( NATIVE_LAPACK_BLOCK_SIZE );
+
+   MT& A( ~dm );
+
+   const size_t m( M ? M : A.rows() );
+   const size_t n( N ? N : A.columns() );
+
+   if( k <= NB || n <= NB ) {
+      nativeUng2r<M,N>( A, k, tau );
+      return;
+   }
+
+   const size_t kk( ( ( k-1UL ) / NB ) * NB );
+
+   for( size_t j=kk; j<n; ++j ) {
+      for( size_t i=0UL; i<kk; ++i ) {
+         A(i,j) = ET(0);
+      }
+   }
+
+   auto last( submatrix( A, kk, kk, m-kk, n-kk ) );
+   nativeUng2r<0UL,0UL>( last, k-kk, tau+kk );
+
+   DynamicMatrix<ET,columnMajor> V, T( NB, NB, ET(0) ), W;
+
+   for( size_t j=kk; j>0UL; )
+   {
+      j -= NB;
+
+      auto panel( submatrix( A, j, j, m-j, NB ) );
+
+      nativeCopyReflectors( panel, V );
+      nativeLarft( V, tau+j, T );
+
+      auto C( submatrix( A, j, j+NB, m-j, n-j-NB ) );
+      W = ctrans( V ) * C;
+      W = T * W;
+      C -= V * W;
+
+      nativeUng2r<0UL,0UL>( panel, NB, tau+j );
+
+      for( size_t c=j; c<j+NB; ++c ) {
+         for( size_t i=0UL; i<j; ++i ) {
+            A(i,c) = ET(0);
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,315 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/pbsv.h
+//  \brief Header file for the LAPACK positive definite band linear system solver functions (pbsv)
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//
+//  * The names of its contributors may not be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_LAPACK_PBSV_H_
+#define _BLAZE_MATH_LAPACK_PBSV_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <memory>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/Adaptor.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/constraints/Computation.h>
+#include <blaze/math/constraints/Contiguous.h>
+#include <blaze/math/constraints/MutableDataAccess.h>
+#include <blaze/math/dense/BandMatrix.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/lapack/clapack/pbsv.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/SameType.h>
+#include <blaze/util/NumericCast.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  LAPACK POSITIVE DEFINITE BAND LINEAR SYSTEM FUNCTIONS (PBSV)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name LAPACK positive definite band linear system functions (pbsv) */
+//@{
+template< typename Type, bool SO, typename VT, bool TF >
+void pbsv( const BandMatrix<Type,SO>& A, DenseVector<VT,TF>& b, char uplo );
+
+template< typename Type, bool SO, typename MT, bool SO2 >
+void pbsv( const BandMatrix<Type,SO>& A, DenseMatrix<MT,SO2>& B, char uplo );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Copies the given band matrix into the LAPACK band storage of the pbsv() functions.
+// \ingroup lapack_solver
+//
+// \param A The band matrix to be copied.
+// \param AB The target array of size \f$ (kd+1) \cdot n \f$.
+// \param uplo \c 'L' to copy the lower part of the band, \c 'U' to copy the upper part.
+// \return void
+//
+// This function copies either the upper or the lower part of the band matrix into the
+// column-major LAPACK band storage with \f$ kd+1 \f$ rows, where \a kd is the number of
+// superdiagonals (\c 'U') or subdiagonals (\c 'L') of the band matrix. In case \a uplo is
+// \c 'U', the element \f$ (i,j) \f$ is stored at position \f$ (kd+i-j,j) \f$, in case
+// \a uplo is \c 'L', it is stored at position \f$ (i-j,j) \f$.
+*/
+template< typename Type  // Data type of the band matrix
+        , bool SO >      // Storage order of the band matrix
+inline void pbsvBandStorage( const BandMatrix<Type,SO>& A, Type* AB, char uplo )
+{
+   const size_t kd  ( uplo == 'L' ? A.lowerBandwidth() : A.upperBandwidth() );
+   const size_t ldab( kd + 1UL );
+   const size_t N   ( SO ? A.columns() : A.rows() );
+
+   for( size_t k=0UL; k<N; ++k )
+   {
+      const Type* p( A.data(k) - A.bandBegin(k) );
+
+      for( size_t l=A.bandBegin(k); l<A.bandEnd(k); ++l )
+      {
+         const size_t i( SO ? l : k );
+         const size_t j( SO ? k : l );
+
+         if( uplo == 'L' && i >= j )
+            AB[j*ldab+i-j] = p[l];
+         else if( uplo == 'U' && i <= j )
+            AB[j*ldab+kd+i-j] = p[l];
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for solving a positive definite band linear system of equations
+//        (\f$ A*x=b \f$).
+// \ingroup lapack_solver
+//
+// \param A The band system matrix.
+// \param b The right-hand side vector.
+// \param uplo \c 'L' to use the lower part of the band, \c 'U' to use the upper part.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+// \exception std::invalid_argument Invalid uplo argument provided.
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function uses the LAPACK pbsv() functions to compute the solution to the system of linear
+// equations \f$ A*x=b \f$, where \a A is a symmetric (or Hermitian) positive definite \a n-by-\a n
+// band matrix and \a x and \a b are n-dimensional vectors. Only the lower (\c 'L') or upper
+// (\c 'U') part of the band is referenced, i.e. the band matrix may store only one of the two
+// parts of the band. Note that the function only works for band matrices with \c float,
+// \c double, \c complex<float>, or \c complex<double> element type. The attempt to call the
+// function with matrices of any other element type results in a compile time error!
+//
+// The referenced part of the band matrix is copied into a temporary LAPACK band storage and is
+// decomposed by means of a banded Cholesky decomposition at a computational cost of
+// \f$ O(n \cdot kd^2) \f$. The given band matrix remains unchanged. If the function exits
+// successfully, the vector \a b contains the solution of the linear system.
+//
+// The function fails if ...
+//
+//  - ... the given system matrix is not a square matrix;
+//  - ... the given \a uplo argument is neither \c 'L' nor \c 'U';
+//  - ... the given system matrix is not positive definite.
+//
+// In all failure cases an exception is thrown.
+//
+// For more information on the pbsv() functions (i.e. spbsv(), dpbsv(), cpbsv(), and zpbsv()),
+// see the LAPACK online documentation browser:
+//
+//        http://www.netlib.org/lapack/explore-html/
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+template< typename Type  // Data type of the band matrix
+        , bool SO        // Storage order of the band matrix
+        , typename VT    // Type of the right-hand side vector
+        , bool TF >      // Transpose flag of the right-hand side vector
+inline void pbsv( const BandMatrix<Type,SO>& A, DenseVector<VT,TF>& b, char uplo )
+{
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( VT );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( VT );
+   BLAZE_CONSTRAINT_MUST_BE_CONTIGUOUS_TYPE( VT );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( Type, ElementType_t<VT> );
+
+   if( A.rows() != A.columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( (~b).size() != A.rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side vector provided" );
+   }
+
+   if( uplo != 'L' && uplo != 'U' ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid uplo argument provided" );
+   }
+
+   const size_t ldab( ( uplo == 'L' ? A.lowerBandwidth() : A.upperBandwidth() ) + 1UL );
+
+   blas_int_t n   ( numeric_cast<blas_int_t>( A.rows() ) );
+   blas_int_t kd  ( numeric_cast<blas_int_t>( ldab - 1UL ) );
+   blas_int_t nrhs( 1 );
+   blas_int_t ldb ( numeric_cast<blas_int_t>( (~b).size() ) );
+   blas_int_t info( 0 );
+
+   if( n == 0 ) {
+      return;
+   }
+
+   std::unique_ptr<Type[]> AB( new Type[ldab*A.columns()]() );
+
+   pbsvBandStorage( A, AB.get(), uplo );
+
+   pbsv( uplo, n, kd, nrhs, AB.get(), numeric_cast<blas_int_t>( ldab ), (~b).data(), ldb, &info );
+
+   BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid function argument" );
+
+   if( info > 0 ) {
+      BLAZE_THROW_LAPACK_ERROR( "Inversion of singular matrix failed" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for solving a positive definite band linear system of equations
+//        (\f$ A*X=B \f$).
+// \ingroup lapack_solver
+//
+// \param A The band system matrix.
+// \param B The matrix of right-hand sides.
+// \param uplo \c 'L' to use the lower part of the band, \c 'U' to use the upper part.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid right-hand side matrix provided.
+// \exception std::invalid_argument Invalid uplo argument provided.
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function uses the LAPACK pbsv() functions to compute the solution to the system of linear
+// equations:
+//
+//  - \f$ A*X  =B   \f$ if \a B is column-major
+//  - \f$ A*X^T=B^T \f$ if \a B is row-major
+//
+// In this context the symmetric (or Hermitian) positive definite band system matrix \a A is a
+// \a n-by-\a n matrix and \a X and \a B are either row-major \a m-by-\a n matrices or
+// column-major \a n-by-\a m matrices. Only the lower (\c 'L') or upper (\c 'U') part of the band
+// is referenced. Note that the function only works for band matrices with \c float, \c double,
+// \c complex<float>, or \c complex<double> element type. The attempt to call the function with
+// matrices of any other element type results in a compile time error!
+//
+// The referenced part of the band matrix is copied into a temporary LAPACK band storage and
+// remains unchanged. If the function exits successfully, the matrix \a B contains the solution
+// of the linear system.
+//
+// The function fails if ...
+//
+//  - ... the given system matrix is not a square matrix;
+//  - ... the given \a uplo argument is neither \c 'L' nor \c 'U';
+//  - ... the sizes of the two given matrices do not match;
+//  - ... the given system matrix is not positive definite.
+//
+// In all failure cases an exception is thrown.
+//
+// For more information on the pbsv() functions (i.e. spbsv(), dpbsv(), cpbsv(), and zpbsv()),
+// see the LAPACK online documentation browser:
+//
+//        http://www.netlib.org/lapack/explore-html/
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+template< typename Type  // Data type of the band matrix
+        , bool SO        // Storage order of the band matrix
+        , typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline void pbsv( const BandMatrix<Type,SO>& A, DenseMatrix<MT,SO2>& B, char uplo )
+{
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( MT );
+   BLAZE_CONSTRAINT_MUST_BE_CONTIGUOUS_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( Type, ElementType_t<MT> );
+
+   if( A.rows() != A.columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( uplo != 'L' && uplo != 'U' ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid uplo argument provided" );
+   }
+
+   const size_t ldab( ( uplo == 'L' ? A.lowerBandwidth() : A.upperBandwidth() ) + 1UL );
+
+   blas_int_t n   ( numeric_cast<blas_int_t>( A.rows() ) );
+   blas_int_t kd  ( numeric_cast<blas_int_t>( ldab - 1UL ) );
+   blas_int_t mrhs( numeric_cast<blas_int_t>( SO2 ? (~B).rows() : (~B).columns() ) );
+   blas_int_t nrhs( numeric_cast<blas_int_t>( SO2 ? (~B).columns() : (~B).rows() ) );
+   blas_int_t ldb ( numeric_cast<blas_int_t>( (~B).spacing() ) );
+   blas_int_t info( 0 );
+
+   if( n != mrhs ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side matrix provided" );
+   }
+
+   if( n == 0 ) {
+      return;
+   }
+
+   std::unique_ptr<Type[]> AB( new Type[ldab*A.columns()]() );
+
+   pbsvBandStorage( A, AB.get(), uplo );
+
+   pbsv( uplo, n, kd, nrhs, AB.get(), numeric_cast<blas_int_t>( ldab ), (~B).data(), ldb, &info );
+
+   BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid function argument" );
+
+   if( info > 0 ) {
+      BLAZE_THROW_LAPACK_ERROR( "Inversion of singular matrix failed" );
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -49,9 +49,12 @@
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/lapack/clapack/potri.h>
+#include <blaze/math/lapack/native/potri.h>
 #include <blaze/math/typetraits/IsRowMajorMatrix.h>
 #include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
 #include <blaze/util/NumericCast.h>
+#include <blaze/util/Types.h>
 
 
 namespace blaze {
@@ -71,6 +74,63 @@ void potri( DenseMatrix<MT,SO>& A, char uplo );
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native backend of the inversion of the given dense positive definite matrix.
+// \ingroup lapack_inversion
+//
+// \param A The matrix to be inverted.
+// \param uplo \c 'L' to use the lower part of the matrix, \c 'U' to use the upper part.
+// \return The LAPACK info value.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline auto potri_backend( DenseMatrix<MT,SO>& A, char uplo )
+   -> EnableIf_t< UseNativeLAPACK_v<MT>, blas_int_t >
+{
+   if( uplo == 'L' ) {
+      auto L( nativeView( ~A ) );
+      return nativePotri<NativeSize_v<MT,0UL>>( L );
+   }
+   else {
+      auto L( transposedView( ~A ) );
+      return nativePotri<NativeSize_v<MT,0UL>>( L );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief LAPACK backend of the inversion of the given dense positive definite matrix.
+// \ingroup lapack_inversion
+//
+// \param A The matrix to be inverted.
+// \param uplo \c 'L' to use the lower part of the matrix, \c 'U' to use the upper part.
+// \return The LAPACK info value.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline auto potri_backend( DenseMatrix<MT,SO>& A, char uplo )
+   -> EnableIf_t< !UseNativeLAPACK_v<MT>, blas_int_t >
+{
+   blas_int_t n   ( numeric_cast<blas_int_t>( (~A).rows()    ) );
+   blas_int_t lda ( numeric_cast<blas_int_t>( (~A).spacing() ) );
+   blas_int_t info( 0 );
+
+   if( IsRowMajorMatrix_v<MT> ) {
+      ( uplo == 'L' )?( uplo = 'U' ):( uplo = 'L' );
+   }
+
+   potri( uplo, n, (~A).data(), lda, &info );
+
+   return info;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief LAPACK kernel for the inversion of the given dense positive definite matrix.
 // \ingroup lapack_inversion
@@ -105,7 +165,9 @@ void potri( DenseMatrix<MT,SO>& A, char uplo );
 //
 // \note This function can only be used if a fitting LAPACK library, which supports this function,
 // is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// linker error. In case the LAPACK mode is disabled (see the BLAZE_LAPACK_MODE switch) or in case
+// of matrices with a small compile time maximum size (as for instance StaticMatrix), the function
+// is computed by native Blaze kernels, which do not require LAPACK.
 //
 // \note This function does only provide the basic exception safety guarantee, i.e. in case of an
 // exception \a A may already have been modified.
@@ -128,19 +190,11 @@ inline void potri( DenseMatrix<MT,SO>& A, char uplo )
       BLAZE_THROW_INVALID_ARGUMENT( "Invalid uplo argument provided" );
    }
 
-   blas_int_t n   ( numeric_cast<blas_int_t>( (~A).columns() ) );
-   blas_int_t lda ( numeric_cast<blas_int_t>( (~A).spacing() ) );
-   blas_int_t info( 0 );
-
-   if( n == 0 ) {
+   if( (~A).rows() == 0UL ) {
       return;
    }
 
-   if( IsRowMajorMatrix_v<MT> ) {
-      ( uplo == 'L' )?( uplo = 'U' ):( uplo = 'L' );
-   }
-
-   potri( uplo, n, (~A).data(), lda, &info );
+   const blas_int_t info( potri_backend( ~A, uplo ) );
 
    BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid argument for matrix inversion" );
 
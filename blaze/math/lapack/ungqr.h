@@ -50,9 +50,17 @@
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/lapack/clapack/unglq.h>
 #include <blaze/math/lapack/clapack/ungqr.h>
+#include <blaze/math/lapack/native/ungqr.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/util/algorithms/Min.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/constraints/Complex.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/MaybeUnused.h>
 #include <blaze/util/NumericCast.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsBuiltin.h>
 
 
 namespace blaze {
@@ -72,6 +80,84 @@ void ungqr( DenseMatrix<MT,SO>& A, const ElementType_t<MT>* tau );
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native backend of the reconstruction of the matrix Q from a QR decomposition.
+// \ingroup lapack_decomposition
+//
+// \param A The decomposed matrix.
+// \param tau Array for the scalar factors of the elementary reflectors; size >= min( \a m, \a n ).
+// \return The LAPACK info value.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline auto ungqr_backend( DenseMatrix<MT,SO>& A, const ElementType_t<MT>* tau )
+   -> EnableIf_t< UseNativeLAPACK_v<MT>, blas_int_t >
+{
+   using ET = ElementType_t<MT>;
+
+   constexpr size_t M( NativeSize_v<MT,0UL> );
+
+   const size_t k( min( (~A).rows(), (~A).columns() ) );
+
+   auto V( nativeView( ~A ) );
+   auto Q( submatrix( V, 0UL, 0UL, V.rows(), k ) );
+
+   if( SO || IsBuiltin_v<ET> ) {
+      nativeUngqr<M,0UL>( Q, k, tau );
+   }
+   else {
+      const std::unique_ptr<ET[]> ctau( new ET[k] );
+      for( size_t i=0UL; i<k; ++i ) {
+         ctau[i] = conj( tau[i] );
+      }
+      nativeUngqr<M,0UL>( Q, k, ctau.get() );
+   }
+
+   return 0;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief LAPACK backend of the reconstruction of the matrix Q from a QR decomposition.
+// \ingroup lapack_decomposition
+//
+// \param A The decomposed matrix.
+// \param tau Array for the scalar factors of the elementary reflectors; size >= min( \a m, \a n ).
+// \return The LAPACK info value.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline auto ungqr_backend( DenseMatrix<MT,SO>& A, const ElementType_t<MT>* tau )
+   -> EnableIf_t< !UseNativeLAPACK_v<MT>, blas_int_t >
+{
+   using ET = ElementType_t<MT>;
+
+   blas_int_t m   ( numeric_cast<blas_int_t>( SO ? (~A).rows() : (~A).columns() ) );
+   blas_int_t n   ( numeric_cast<blas_int_t>( SO ? (~A).columns() : (~A).rows() ) );
+   blas_int_t k   ( min( m, n ) );
+   blas_int_t lda ( numeric_cast<blas_int_t>( (~A).spacing() ) );
+   blas_int_t info( 0 );
+
+   blas_int_t lwork( k*lda );
+   const std::unique_ptr<ET[]> work( new ET[lwork] );
+
+   if( SO ) {
+      ungqr( m, k, k, (~A).data(), lda, tau, work.get(), lwork, &info );
+   }
+   else {
+      unglq( k, n, k, (~A).data(), lda, tau, work.get(), lwork, &info );
+   }
+
+   return info;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief LAPACK kernel for the reconstruction of the orthogonal matrix Q from a QR decomposition.
 // \ingroup lapack_decomposition
@@ -114,7 +200,9 @@ void ungqr( DenseMatrix<MT,SO>& A, const ElementType_t<MT>* tau );
 //
 // \note This function can only be used if a fitting LAPACK library, which supports this function,
 // is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// linker error. In case the LAPACK mode is disabled (see the BLAZE_LAPACK_MODE switch) or in case
+// of matrices with a small compile time maximum size (as for instance StaticMatrix), the function
+// is computed by native Blaze kernels, which do not require LAPACK.
 */
 template< typename MT, bool SO >
 inline void ungqr( DenseMatrix<MT,SO>& A, const ElementType_t<MT>* tau )
@@ -126,29 +214,15 @@ inline void ungqr( DenseMatrix<MT,SO>& A, const ElementType_t<MT>* tau )
    BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT> );
    BLAZE_CONSTRAINT_MUST_BE_COMPLEX_TYPE( ElementType_t<MT> );
 
-   using ET = ElementType_t<MT>;
-
-   blas_int_t m   ( numeric_cast<blas_int_t>( SO ? (~A).rows() : (~A).columns() ) );
-   blas_int_t n   ( numeric_cast<blas_int_t>( SO ? (~A).columns() : (~A).rows() ) );
-   blas_int_t k   ( min( m, n ) );
-   blas_int_t lda ( numeric_cast<blas_int_t>( (~A).spacing() ) );
-   blas_int_t info( 0 );
-
-   if( k == 0 ) {
+   if( (~A).rows() == 0UL || (~A).columns() == 0UL ) {
       return;
    }
 
-   blas_int_t lwork( k*lda );
-   const std::unique_ptr<ET[]> work( new ET[lwork] );
-
-   if( SO ) {
-      ungqr( m, k, k, (~A).data(), lda, tau, work.get(), lwork, &info );
-   }
-   else {
-      unglq( k, n, k, (~A).data(), lda, tau, work.get(), lwork, &info );
-   }
+   const blas_int_t info( ungqr_backend( ~A, tau ) );
 
    BLAZE_INTERNAL_ASSERT( info == 0, "Invalid argument for Q reconstruction" );
+
+   MAYBE_UNUSED( info );
 }
 //*************************************************************************************************
 
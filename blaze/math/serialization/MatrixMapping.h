@@ -0,0 +1,511 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/serialization/MatrixMapping.h
+//  \brief Header file for the MatrixMapping class
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SERIALIZATION_MATRIXMAPPING_H_
+#define _BLAZE_MATH_SERIALIZATION_MATRIXMAPPING_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/dense/CustomMatrix.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/serialization/TypeValueMapping.h>
+#include <blaze/math/shims/NextMultiple.h>
+#include <blaze/math/sparse/CustomCompressedMatrix.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/serialization/MemoryMap.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Zero-copy access to matrices serialized in the mappable format.
+// \ingroup math_serialization
+//
+// The MatrixMapping class provides read-only access to a single matrix that has been serialized
+// in the mappable (version 2) format (see the MatrixSerializer class). The file is mapped into
+// memory via a MemoryMap and the elements of the matrix are accessed in place via a CustomMatrix
+// (dense matrices) or CustomCompressedMatrix (sparse matrices), i.e. without reading or copying
+// any element:
+
+   \code
+   // Serialization of a dense and a sparse matrix in the mappable format
+   {
+      blaze::DynamicMatrix<double,blaze::rowMajor> D( 1000UL, 1000UL );
+      blaze::CompressedMatrix<float,blaze::columnMajor> S( 5000UL, 5000UL );
+
+      // ... Initialization
+
+      blaze::Archive<std::ofstream> archive( "matrices.blaze" );
+      serialize( archive, D, blaze::mappable );
+      serialize( archive, S, blaze::mappable );
+   }
+
+   // Zero-copy access to both matrices
+   {
+      blaze::MatrixMapping m1( "matrices.blaze" );
+      blaze::MatrixMapping m2( "matrices.blaze", m1.size() );
+
+      // Aligned view on the dense matrix
+      blaze::CustomMatrix<const double,blaze::aligned,blaze::unpadded,blaze::rowMajor> D
+         = m1.dense<double,blaze::rowMajor>();
+
+      // Read-only view on the sparse matrix
+      blaze::CustomCompressedMatrix<float,blaze::columnMajor> S
+         = m2.sparse<float,blaze::columnMajor>();
+
+      blaze::DynamicVector<double> x( 1000UL, 1.0 );
+      blaze::DynamicVector<double> y = D * x;
+   }
+   \endcode
+
+// Each record of the mappable format starts with a 64-byte header and all arrays of elements are
+// padded to multiples of 64 bytes. Therefore all rows (row-major) or columns (column-major) of
+// the dense view start at a 64-byte boundary and the view is always aligned. Since the elements
+// of a mapped matrix cannot be modified, the view is unpadded, i.e. the zero padding of the
+// file is never exposed as part of the matrix. The
+// offset of a record within the file has to be a multiple of 64 bytes, which is guaranteed for
+// all records in a file that exclusively contains matrices in the mappable format. The size of
+// a record is given by the size() function and can be used to access the next record in the
+// file. Note that all views returned by the dense() and sparse() functions are only valid as
+// long as the MatrixMapping or any copy of it exists.
+//
+// In case the file cannot be mapped or the file does not contain a valid record in the mappable
+// format at the given offset, a \a std::runtime_error exception is thrown. In case a view is
+// requested with an element type or storage order that does not match the record, a
+// \a std::invalid_argument exception is thrown.
+*/
+class MatrixMapping
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline MatrixMapping( const std::string& file, size_t offset = 0UL );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows      () const noexcept;
+   inline size_t columns   () const noexcept;
+   inline size_t nonZeros  () const noexcept;
+   inline size_t spacing   () const noexcept;
+   inline size_t size      () const noexcept;
+   inline bool   isDense   () const noexcept;
+   inline bool   isRowMajor() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**View functions******************************************************************************
+   /*!\name View functions */
+   //@{
+   template< typename Type, bool SO >
+   CustomMatrix<const Type,aligned,unpadded,SO> dense() const;
+
+   template< typename Type, bool SO >
+   CustomCompressedMatrix<Type,SO> sparse() const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Type, bool SO >
+   void checkElementType() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Constants***********************************************************************************
+   /*!\name Constants */
+   //@{
+   static constexpr size_t alignment  = 64UL;  //!< Alignment of all records of the mappable format.
+   static constexpr size_t headerSize = 64UL;  //!< Size in bytes of the header of a record.
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::shared_ptr<const MemoryMap> map_;  //!< The memory mapping of the file.
+   const byte_t* record_;                  //!< Pointer to the first byte of the record.
+   uint8_t  type_;                         //!< The type of the matrix.
+   uint8_t  elementType_;                  //!< The type of an element.
+   uint8_t  elementSize_;                  //!< The size in bytes of a single element of the matrix.
+   uint64_t rows_;                         //!< The number of rows of the matrix.
+   uint64_t columns_;                      //!< The number of columns of the matrix.
+   uint64_t number_;                       //!< The total number of elements contained in the matrix.
+   uint64_t spacing_;                      //!< The spacing between two rows/columns of a dense matrix.
+   size_t   size_;                         //!< The total size in bytes of the record.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creating a mapping of the matrix record at the given offset of the given file.
+//
+// \param file The name of the file to be mapped.
+// \param offset The offset in bytes of the record within the file.
+// \exception std::runtime_error Invalid matrix record.
+//
+// This constructor maps the given file into memory and validates the header of the record at
+// the given offset. In case the file cannot be mapped, the offset is not a multiple of 64 bytes,
+// or the record is not a valid matrix record in the mappable format, a \a std::runtime_error
+// exception is thrown. In case of a sparse matrix, additionally the offsets of all rows/columns
+// are validated. The indices of the non-zero elements are only validated in case
+// BLAZE_USER_ASSERT() is active.
+*/
+inline MatrixMapping::MatrixMapping( const std::string& file, size_t offset )
+   : map_        ( std::make_shared<const MemoryMap>( file ) )  // The memory mapping of the file
+   , record_     ( nullptr )  // Pointer to the first byte of the record
+   , type_       ( 0U  )      // The type of the matrix
+   , elementType_( 0U  )      // The type of an element
+   , elementSize_( 0U  )      // The size in bytes of a single element of the matrix
+   , rows_       ( 0UL )      // The number of rows of the matrix
+   , columns_    ( 0UL )      // The number of columns of the matrix
+   , number_     ( 0UL )      // The total number of elements contained in the matrix
+   , spacing_    ( 0UL )      // The spacing between two rows/columns of a dense matrix
+   , size_       ( 0UL )      // The total size in bytes of the record
+{
+   if( offset % alignment != 0UL ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid record offset detected" );
+   }
+
+   if( offset > map_->size() || map_->size() - offset < headerSize ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+   }
+
+   record_ = map_->data() + offset;
+
+   uint8_t version  ( 0U );
+   uint8_t indexSize( 0U );
+
+   std::memcpy( &version     , record_     , 1UL );
+   std::memcpy( &type_       , record_ +  1, 1UL );
+   std::memcpy( &elementType_, record_ +  2, 1UL );
+   std::memcpy( &elementSize_, record_ +  3, 1UL );
+   std::memcpy( &indexSize   , record_ +  4, 1UL );
+   std::memcpy( &rows_       , record_ +  8, 8UL );
+   std::memcpy( &columns_    , record_ + 16, 8UL );
+   std::memcpy( &number_     , record_ + 24, 8UL );
+   std::memcpy( &spacing_    , record_ + 32, 8UL );
+
+   if( version != 2U ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid version detected" );
+   }
+   else if( ( type_ & 1U ) != 1U || ( type_ & (~7U) ) != 0U ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid matrix type detected" );
+   }
+   else if( elementSize_ == 0U || alignment % elementSize_ != 0UL ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid element size detected" );
+   }
+   else if( number_ > rows_*columns_ ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid number of elements detected" );
+   }
+
+   const size_t M( isRowMajor() ? rows_ : columns_ );
+   const size_t N( isRowMajor() ? columns_ : rows_ );
+   const size_t available( map_->size() - offset - headerSize );
+
+   if( isDense() )
+   {
+      if( indexSize != 0U || spacing_ < N || ( spacing_ * elementSize_ ) % alignment != 0UL ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Invalid dense matrix layout detected" );
+      }
+
+      size_ = headerSize + M*spacing_*elementSize_;
+
+      if( M*spacing_*elementSize_ > available ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Invalid file size detected" );
+      }
+   }
+   else
+   {
+      if( indexSize != sizeof( uint64_t ) || spacing_ != 0UL ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Invalid sparse matrix layout detected" );
+      }
+
+      size_ = headerSize + nextMultiple( ( M+1UL )*sizeof( uint64_t ), alignment )
+                         + nextMultiple( number_*sizeof( uint64_t ), alignment )
+                         + nextMultiple( number_*elementSize_, alignment );
+
+      if( size_ - headerSize > available ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Invalid file size detected" );
+      }
+
+      const uint64_t* offsets( reinterpret_cast<const uint64_t*>( record_ + headerSize ) );
+
+      if( offsets[0] != 0UL || offsets[M] != number_ ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Invalid sparse matrix layout detected" );
+      }
+
+      for( size_t k=0UL; k<M; ++k ) {
+         if( offsets[k] > offsets[k+1UL] ) {
+            BLAZE_THROW_RUNTIME_ERROR( "Invalid sparse matrix layout detected" );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows of the mapped matrix.
+//
+// \return The number of rows of the matrix.
+*/
+inline size_t MatrixMapping::rows() const noexcept
+{
+   return rows_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of columns of the mapped matrix.
+//
+// \return The number of columns of the matrix.
+*/
+inline size_t MatrixMapping::columns() const noexcept
+{
+   return columns_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of stored elements of the mapped matrix.
+//
+// \return The number of non-zero elements (sparse) or the total number of elements (dense).
+*/
+inline size_t MatrixMapping::nonZeros() const noexcept
+{
+   return number_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the spacing between two rows/columns of the mapped dense matrix.
+//
+// \return The spacing between two rows/columns (dense) or 0 (sparse).
+*/
+inline size_t MatrixMapping::spacing() const noexcept
+{
+   return spacing_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total size in bytes of the mapped record.
+//
+// \return The size in bytes of the record.
+//
+// The size of a record is always a multiple of 64 bytes. It can be used as offset to the next
+// record within the same file.
+*/
+inline size_t MatrixMapping::size() const noexcept
+{
+   return size_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the mapped matrix is a dense matrix.
+//
+// \return \a true in case of a dense matrix, \a false in case of a sparse matrix.
+*/
+inline bool MatrixMapping::isDense() const noexcept
+{
+   return ( type_ & 2U ) == 0U;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the mapped matrix is stored in row-major order.
+//
+// \return \a true in case of a row-major matrix, \a false in case of a column-major matrix.
+*/
+inline bool MatrixMapping::isRowMajor() const noexcept
+{
+   return ( type_ & 4U ) == 0U;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checks the requested element type and storage order against the mapped matrix.
+//
+// \return void
+// \exception std::invalid_argument Invalid element type.
+// \exception std::invalid_argument Invalid storage order.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO >      // Storage order
+void MatrixMapping::checkElementType() const
+{
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( Type );
+
+   if( elementType_ != TypeValueMapping<Type>::value || elementSize_ != sizeof( Type ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid element type" );
+   }
+
+   if( isRowMajor() == SO ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid storage order" );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  VIEW FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns an aligned view on the mapped dense matrix.
+//
+// \return Read-only view on the mapped dense matrix.
+// \exception std::invalid_argument Invalid matrix type.
+// \exception std::invalid_argument Invalid element type.
+// \exception std::invalid_argument Invalid storage order.
+//
+// This function returns a read-only CustomMatrix view on the elements of the mapped dense
+// matrix. No element is copied. The view is only valid as long as the mapping exists. In case
+// the mapped matrix is a sparse matrix or the given element type or storage order does not
+// match the mapped matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO >      // Storage order
+CustomMatrix<const Type,aligned,unpadded,SO> MatrixMapping::dense() const
+{
+   if( !isDense() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid matrix type" );
+   }
+
+   checkElementType<Type,SO>();
+
+   if( rows_ == 0UL || columns_ == 0UL ) {
+      return CustomMatrix<const Type,aligned,unpadded,SO>();
+   }
+
+   const Type* values( reinterpret_cast<const Type*>( record_ + headerSize ) );
+
+   return CustomMatrix<const Type,aligned,unpadded,SO>( values, rows_, columns_, spacing_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a read-only view on the mapped sparse matrix.
+//
+// \return Read-only view on the mapped sparse matrix.
+// \exception std::invalid_argument Invalid matrix type.
+// \exception std::invalid_argument Invalid element type.
+// \exception std::invalid_argument Invalid storage order.
+//
+// This function returns a CustomCompressedMatrix view on the offsets, indices, and values of
+// the mapped sparse matrix. No element is copied. The view is only valid as long as the mapping
+// exists. In case the mapped matrix is a dense matrix or the given element type or storage order
+// does not match the mapped matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO >      // Storage order
+CustomCompressedMatrix<Type,SO> MatrixMapping::sparse() const
+{
+   BLAZE_STATIC_ASSERT_MSG( sizeof( size_t ) == sizeof( uint64_t ), "Unsupported size of indices" );
+
+   if( isDense() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid matrix type" );
+   }
+
+   checkElementType<Type,SO>();
+
+   const size_t M( SO ? columns_ : rows_ );
+
+   const byte_t* offsets( record_ + headerSize );
+   const byte_t* indices( offsets + nextMultiple( ( M+1UL )*sizeof( uint64_t ), alignment ) );
+   const byte_t* values ( indices + nextMultiple( number_*sizeof( uint64_t ), alignment ) );
+
+   return CustomCompressedMatrix<Type,SO>( rows_, columns_,
+                                           reinterpret_cast<const size_t*>( offsets ),
+                                           reinterpret_cast<const size_t*>( indices ),
+                                           reinterpret_cast<const Type*>( values ) );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -40,26 +40,65 @@
 // Includes
 //*************************************************************************************************
 
+#include <vector>
 #include <blaze/math/Aliases.h>
+#include <blaze/math/AlignmentFlag.h>
 #include <blaze/math/constraints/Matrix.h>
+#include <blaze/math/dense/CustomMatrix.h>
 #include <blaze/math/dense/DynamicMatrix.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/SparseMatrix.h>
 #include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/PaddingFlag.h>
 #include <blaze/math/serialization/TypeValueMapping.h>
+#include <blaze/math/shims/NextMultiple.h>
 #include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/CustomCompressedMatrix.h>
 #include <blaze/math/typetraits/IsDenseMatrix.h>
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/math/typetraits/IsRowMajorMatrix.h>
 #include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Numeric.h>
 #include <blaze/util/EnableIf.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/StaticAssert.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/IsNumeric.h>
 
 
 namespace blaze {
 
+//=================================================================================================
+//
+//  TAG TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Tag type for the selection of the mappable matrix serialization format.
+// \ingroup math_serialization
+//
+// Passing the \a blaze::mappable tag to the serialize() function selects the mappable (version 2)
+// serialization format. In this format all elements of a matrix are stored in exactly the same
+// layout as in memory (see the MatrixSerializer class for a detailed description), which allows
+// to access a serialized matrix via a MatrixMapping without copying any elements.
+*/
+struct Mappable {};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Global Mappable tag instance.
+// \ingroup math_serialization
+*/
+constexpr Mappable mappable{};
+//*************************************************************************************************
+
+
+
+
+
 //=================================================================================================
 //
 //  CLASS DEFINITION
@@ -153,6 +192,43 @@ namespace blaze {
 //
 // In case an error is encountered during (de-)serialization, a \a std::runtime_exception is
 // thrown.
+//
+// \n \section matrix_serialization_mappable Mappable Format
+//
+// In addition to the default (version 1) format, matrices with numeric element type can be
+// serialized in the mappable (version 2) format by passing the \a blaze::mappable tag:
+
+   \code
+   blaze::DynamicMatrix<double,rowMajor> D;
+   blaze::CompressedMatrix<float,rowMajor> S;
+
+   // ... Resizing and initialization
+
+   blaze::Archive<std::ofstream> archive( "matrices.blaze" );
+   serialize( archive, D, blaze::mappable );
+   serialize( archive, S, blaze::mappable );
+   \endcode
+
+// Each matrix is stored as a record consisting of a 64-byte header and a payload, whose size is
+// also a multiple of 64 bytes:
+//
+//  - Header: version (uint8_t, 2), matrix type (uint8_t), element type (uint8_t), element size
+//    (uint8_t), index size (uint8_t, 8 for sparse and 0 for dense matrices), three reserved
+//    bytes, the number of rows, columns and elements (uint64_t), the spacing between two rows
+//    (row-major) or columns (column-major) of a dense matrix (uint64_t, 0 for sparse matrices),
+//    and 24 bytes of zero padding.
+//  - Dense payload: the elements of all rows (row-major) or columns (column-major), each padded
+//    with zeros to the spacing, which is a multiple of 64 bytes.
+//  - Sparse payload: \f$ K+1 \f$ offsets (uint64_t), the indices of all non-zero elements
+//    (uint64_t), and the values of all non-zero elements, where \f$ K \f$ is the number of rows
+//    (row-major) or columns (column-major) of the matrix. Each of the three arrays is padded
+//    with zeros to a multiple of 64 bytes.
+//
+// Matrices in the mappable format are deserialized via the deserialize() function like any
+// other matrix. In addition, a record that starts at a 64-byte boundary of a file can be
+// accessed via a MatrixMapping, which provides a zero-copy CustomMatrix or CustomCompressedMatrix
+// view on the memory mapped file. Since the size of every record is a multiple of 64 bytes, this
+// holds for all records in a file that exclusively contains matrices in the mappable format.
 */
 class MatrixSerializer
 {
@@ -206,6 +282,9 @@ class MatrixSerializer
    //@{
    template< typename Archive, typename MT, bool SO >
    void serialize( Archive& archive, const Matrix<MT,SO>& mat );
+
+   template< typename Archive, typename MT, bool SO >
+   void serialize( Archive& archive, const Matrix<MT,SO>& mat, Mappable );
    //@}
    //**********************************************************************************************
 
@@ -229,6 +308,18 @@ class MatrixSerializer
 
    template< typename Archive, typename MT, bool SO >
    void serializeMatrix( Archive& archive, const SparseMatrix<MT,SO>& mat );
+
+   template< typename Archive, typename MT >
+   void serializeMappableHeader( Archive& archive, const MT& mat, size_t number, size_t spacing );
+
+   template< typename Archive, typename MT, bool SO >
+   void serializeMappableMatrix( Archive& archive, const DenseMatrix<MT,SO>& mat );
+
+   template< typename Archive, typename MT, bool SO >
+   void serializeMappableMatrix( Archive& archive, const SparseMatrix<MT,SO>& mat );
+
+   template< typename Archive >
+   void serializePadding( Archive& archive, size_t bytes );
    //@}
    //**********************************************************************************************
 
@@ -297,6 +388,24 @@ class MatrixSerializer
 
    template< typename Archive, typename MT >
    void deserializeSparseColumnMatrix( Archive& archive, SparseMatrix<MT,columnMajor>& mat );
+
+   template< typename Archive, typename MT >
+   DisableIf_t< IsNumeric_v< ElementType_t<MT> > >
+      deserializeMappableMatrix( Archive& archive, MT& mat );
+
+   template< typename Archive, typename MT >
+   EnableIf_t< IsNumeric_v< ElementType_t<MT> > >
+      deserializeMappableMatrix( Archive& archive, MT& mat );
+
+   template< typename Archive >
+   void deserializePadding( Archive& archive, size_t bytes );
+   //@}
+   //**********************************************************************************************
+
+   //**Constants***********************************************************************************
+   /*!\name Constants */
+   //@{
+   static constexpr size_t alignment = 64UL;  //!< Alignment of all records of the mappable format.
    //@}
    //**********************************************************************************************
 
@@ -310,6 +419,8 @@ class MatrixSerializer
    uint64_t rows_;         //!< The number of rows of the matrix.
    uint64_t columns_;      //!< The number of columns of the matrix.
    uint64_t number_;       //!< The total number of elements contained in the matrix.
+   uint8_t  indexSize_;    //!< The size in bytes of a single index (mappable format only).
+   uint64_t spacing_;      //!< The spacing between two rows/columns (mappable format only).
    //@}
    //**********************************************************************************************
 };
@@ -335,6 +446,8 @@ MatrixSerializer::MatrixSerializer()
    , rows_       ( 0UL )  // The number of rows of the matrix
    , columns_    ( 0UL )  // The number of columns of the matrix
    , number_     ( 0UL )  // The total number of elements contained in the matrix
+   , indexSize_  ( 0U  )  // The size in bytes of a single index
+   , spacing_    ( 0UL )  // The spacing between two rows/columns
 {}
 //*************************************************************************************************
 
@@ -370,6 +483,37 @@ void MatrixSerializer::serialize( Archive& archive, const Matrix<MT,SO>& mat )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Serializes the given matrix in the mappable format and writes it to the archive.
+//
+// \param archive The archive to be written.
+// \param mat The matrix to be serialized.
+// \return void
+// \exception std::runtime_error Error during serialization.
+//
+// This function serializes the given matrix in the mappable (version 2) format. Note that this
+// format is only available for matrices with numeric element type.
+*/
+template< typename Archive  // Type of the archive
+        , typename MT       // Type of the matrix
+        , bool SO >         // Storage order
+void MatrixSerializer::serialize( Archive& archive, const Matrix<MT,SO>& mat, Mappable )
+{
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( ElementType_t<MT> );
+   BLAZE_STATIC_ASSERT_MSG( alignment % sizeof( ElementType_t<MT> ) == 0UL,
+                            "Element size does not divide the alignment of the mappable format" );
+
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Faulty archive detected" );
+   }
+
+   CompositeType_t<MT> A( ~mat );  // Evaluation of the matrix expression
+
+   serializeMappableMatrix( archive, A );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Serializes all meta information about the given matrix.
 //
@@ -471,6 +615,159 @@ void MatrixSerializer::serializeMatrix( Archive& archive, const SparseMatrix<MT,
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Serializes all meta information about the given matrix in the mappable format.
+//
+// \param archive The archive to be written.
+// \param mat The matrix to be serialized.
+// \param number The total number of stored elements of the matrix.
+// \param spacing The spacing between two rows/columns (dense matrices only).
+// \return void
+// \exception std::runtime_error File header could not be serialized.
+*/
+template< typename Archive  // Type of the archive
+        , typename MT >     // Type of the matrix
+void MatrixSerializer::serializeMappableHeader( Archive& archive, const MT& mat,
+                                                size_t number, size_t spacing )
+{
+   using ET = ElementType_t<MT>;
+
+   archive << uint8_t ( 2U );
+   archive << uint8_t ( MatrixValueMapping<MT>::value );
+   archive << uint8_t ( TypeValueMapping<ET>::value );
+   archive << uint8_t ( sizeof( ET ) );
+   archive << uint8_t ( IsDenseMatrix_v<MT> ? 0U : sizeof( uint64_t ) );
+   archive << uint8_t ( 0U ) << uint8_t( 0U ) << uint8_t( 0U );
+   archive << uint64_t( mat.rows() );
+   archive << uint64_t( mat.columns() );
+   archive << uint64_t( number );
+   archive << uint64_t( spacing );
+   serializePadding( archive, 40UL );
+
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "File header could not be serialized" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Serializes the elements of a dense matrix in the mappable format.
+//
+// \param archive The archive to be written.
+// \param mat The matrix to be serialized.
+// \return void
+// \exception std::runtime_error Dense matrix could not be serialized.
+//
+// All rows (row-major) or columns (column-major) of the matrix are written with a spacing of a
+// multiple of 64 bytes. The padding elements are initialized to zero.
+*/
+template< typename Archive  // Type of the archive
+        , typename MT       // Type of the matrix
+        , bool SO >         // Storage order
+void MatrixSerializer::serializeMappableMatrix( Archive& archive, const DenseMatrix<MT,SO>& mat )
+{
+   using ET = ElementType_t<MT>;
+
+   const size_t M( SO ? (~mat).columns() : (~mat).rows() );
+   const size_t N( SO ? (~mat).rows() : (~mat).columns() );
+
+   std::vector<ET> buffer( nextMultiple( N, alignment / sizeof( ET ) ) );
+
+   serializeMappableHeader( archive, ~mat, M*N, buffer.size() );
+
+   for( size_t k=0UL; k<M; ++k ) {
+      for( size_t l=0UL; l<N; ++l ) {
+         buffer[l] = ( SO ? (~mat)(l,k) : (~mat)(k,l) );
+      }
+      archive.write( buffer.data(), buffer.size() );
+   }
+
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Dense matrix could not be serialized" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Serializes the elements of a sparse matrix in the mappable format.
+//
+// \param archive The archive to be written.
+// \param mat The matrix to be serialized.
+// \return void
+// \exception std::runtime_error Sparse matrix could not be serialized.
+//
+// The matrix is written as three consecutive arrays of offsets, indices, and values, each of
+// which is padded to a multiple of 64 bytes.
+*/
+template< typename Archive  // Type of the archive
+        , typename MT       // Type of the matrix
+        , bool SO >         // Storage order
+void MatrixSerializer::serializeMappableMatrix( Archive& archive, const SparseMatrix<MT,SO>& mat )
+{
+   using ET = ElementType_t<MT>;
+
+   const size_t M( SO ? (~mat).columns() : (~mat).rows() );
+
+   std::vector<uint64_t> offsets( M+1UL, 0UL );
+
+   for( size_t k=0UL; k<M; ++k ) {
+      offsets[k+1UL] = offsets[k] + (~mat).nonZeros( k );
+   }
+
+   serializeMappableHeader( archive, ~mat, offsets[M], 0UL );
+
+   archive.write( offsets.data(), offsets.size() );
+   serializePadding( archive, offsets.size()*sizeof( uint64_t ) );
+
+   std::vector<uint64_t> indices;
+   std::vector<ET> values;
+
+   for( size_t k=0UL; k<M; ++k ) {
+      indices.clear();
+      for( auto element=(~mat).begin(k); element!=(~mat).end(k); ++element ) {
+         indices.push_back( element->index() );
+      }
+      if( indices.size() != offsets[k+1UL] - offsets[k] ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Sparse matrix could not be serialized" );
+      }
+      archive.write( indices.data(), indices.size() );
+   }
+   serializePadding( archive, offsets[M]*sizeof( uint64_t ) );
+
+   for( size_t k=0UL; k<M; ++k ) {
+      values.clear();
+      for( auto element=(~mat).begin(k); element!=(~mat).end(k); ++element ) {
+         values.push_back( element->value() );
+      }
+      archive.write( values.data(), values.size() );
+   }
+   serializePadding( archive, offsets[M]*sizeof( ET ) );
+
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Sparse matrix could not be serialized" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Pads the given number of bytes with zeros to the next multiple of 64 bytes.
+//
+// \param archive The archive to be written.
+// \param bytes The number of bytes written since the last 64-byte boundary.
+// \return void
+*/
+template< typename Archive >  // Type of the archive
+void MatrixSerializer::serializePadding( Archive& archive, size_t bytes )
+{
+   const uint8_t padding[alignment] = {};
+   archive.write( padding, nextMultiple( bytes, alignment ) - bytes );
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -517,13 +814,27 @@ void MatrixSerializer::deserializeHeader( Archive& archive, const MT& mat )
 {
    using ET = ElementType_t<MT>;
 
-   if( !( archive >> version_ >> type_ >> elementType_ >> elementSize_ >> rows_ >> columns_ >> number_ ) ) {
+   if( !( archive >> version_ >> type_ >> elementType_ >> elementSize_ ) ) {
       BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
    }
-   else if( version_ != 1UL ) {
+   else if( version_ == 1U ) {
+      if( !( archive >> rows_ >> columns_ >> number_ ) ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+      }
+   }
+   else if( version_ == 2U ) {
+      uint8_t reserved[3];
+      if( !( archive >> indexSize_ ) || !archive.read( reserved, 3UL ) ||
+          !( archive >> rows_ >> columns_ >> number_ >> spacing_ ) ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+      }
+      deserializePadding( archive, 40UL );
+   }
+   else {
       BLAZE_THROW_RUNTIME_ERROR( "Invalid version detected" );
    }
-   else if( ( type_ & 1U ) != 1U || ( type_ & (~7U) ) != 0U ) {
+
+   if( ( type_ & 1U ) != 1U || ( type_ & (~7U) ) != 0U ) {
       BLAZE_THROW_RUNTIME_ERROR( "Invalid matrix type detected" );
    }
    else if( elementType_ != TypeValueMapping<ET>::value ) {
@@ -538,6 +849,15 @@ void MatrixSerializer::deserializeHeader( Archive& archive, const MT& mat )
    else if( number_ > rows_*columns_ ) {
       BLAZE_THROW_RUNTIME_ERROR( "Invalid number of elements detected" );
    }
+   else if( version_ == 2U && ( type_ & 2U ) == 0U &&
+            ( indexSize_ != 0U || spacing_ < ( ( type_ & 4U ) ? rows_ : columns_ ) ||
+              ( spacing_ * elementSize_ ) % alignment != 0UL ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid dense matrix layout detected" );
+   }
+   else if( version_ == 2U && ( type_ & 2U ) != 0U &&
+            ( indexSize_ != sizeof( uint64_t ) || spacing_ != 0UL ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid sparse matrix layout detected" );
+   }
 }
 //*************************************************************************************************
 
@@ -604,7 +924,10 @@ template< typename Archive  // Type of the archive
         , typename MT >     // Type of the matrix
 void MatrixSerializer::deserializeMatrix( Archive& archive, MT& mat )
 {
-   if( type_ == 1U ) {
+   if( version_ == 2U ) {
+      deserializeMappableMatrix( archive, mat );
+   }
+   else if( type_ == 1U ) {
       deserializeDenseRowMatrix( archive, ~mat );
    }
    else if( type_ == 5UL ) {
@@ -1178,6 +1501,131 @@ struct MatrixSerializer::MatrixValueMappingHelper<false,false>
 
 
 
+//*************************************************************************************************
+/*!\brief Deserializes a matrix in the mappable format from the archive.
+//
+// \param archive The archive to be read from.
+// \param mat The matrix to be reconstituted.
+// \return void
+// \exception std::runtime_error Invalid element type detected.
+//
+// This function is selected for matrices with non-numeric element type, which cannot be stored
+// in the mappable format. It therefore always throws a \a std::runtime_error exception.
+*/
+template< typename Archive  // Type of the archive
+        , typename MT >     // Type of the matrix
+DisableIf_t< IsNumeric_v< ElementType_t<MT> > >
+   MatrixSerializer::deserializeMappableMatrix( Archive& archive, MT& mat )
+{
+   MAYBE_UNUSED( archive, mat );
+
+   BLAZE_THROW_RUNTIME_ERROR( "Invalid element type detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes a matrix in the mappable format from the archive.
+//
+// \param archive The archive to be read from.
+// \param mat The matrix to be reconstituted.
+// \return void
+// \exception std::runtime_error Matrix could not be deserialized.
+//
+// This function deserializes a dense or sparse matrix in the mappable (version 2) format from
+// the archive and reconstitutes the given matrix. The serialized elements are read in a single
+// block and assigned to the given matrix via a CustomMatrix or CustomCompressedMatrix view. In
+// case any error is detected during the deserialization process, a \a std::runtime_error is
+// thrown.
+*/
+template< typename Archive  // Type of the archive
+        , typename MT >     // Type of the matrix
+EnableIf_t< IsNumeric_v< ElementType_t<MT> > >
+   MatrixSerializer::deserializeMappableMatrix( Archive& archive, MT& mat )
+{
+   using ET = ElementType_t<MT>;
+
+   const bool   columnMajorLayout( ( type_ & 4U ) != 0U );
+   const size_t M( columnMajorLayout ? columns_ : rows_ );
+   const size_t N( columnMajorLayout ? rows_ : columns_ );
+
+   if( ( type_ & 2U ) == 0U )
+   {
+      std::vector<ET> values( M*spacing_ );
+
+      if( !archive.read( values.data(), values.size() ) ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Dense matrix could not be deserialized" );
+      }
+
+      if( M == 0UL || N == 0UL ) return;
+
+      if( columnMajorLayout ) {
+         ~mat = CustomMatrix<const ET,unaligned,unpadded,columnMajor>( values.data(), rows_, columns_, spacing_ );
+      }
+      else {
+         ~mat = CustomMatrix<const ET,unaligned,unpadded,rowMajor>( values.data(), rows_, columns_, spacing_ );
+      }
+   }
+   else
+   {
+      std::vector<uint64_t> offsets( M+1UL );
+      std::vector<uint64_t> indices( number_ );
+      std::vector<ET> values( number_ );
+
+      archive.read( offsets.data(), offsets.size() );
+      deserializePadding( archive, offsets.size()*sizeof( uint64_t ) );
+      archive.read( indices.data(), indices.size() );
+      deserializePadding( archive, indices.size()*sizeof( uint64_t ) );
+      archive.read( values.data(), values.size() );
+      deserializePadding( archive, values.size()*sizeof( ET ) );
+
+      if( !archive || offsets[0] != 0UL || offsets[M] != number_ ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Sparse matrix could not be deserialized" );
+      }
+
+      for( size_t k=0UL; k<M; ++k ) {
+         if( offsets[k] > offsets[k+1UL] ) {
+            BLAZE_THROW_RUNTIME_ERROR( "Invalid sparse matrix layout detected" );
+         }
+         for( size_t l=offsets[k]; l<offsets[k+1UL]; ++l ) {
+            if( indices[l] >= N || ( l > offsets[k] && indices[l-1UL] >= indices[l] ) ) {
+               BLAZE_THROW_RUNTIME_ERROR( "Invalid sparse matrix layout detected" );
+            }
+         }
+      }
+
+      const std::vector<size_t> begin( offsets.begin(), offsets.end() );
+
+      if( columnMajorLayout ) {
+         ~mat = CustomCompressedMatrix<ET,columnMajor,uint64_t>(
+                   rows_, columns_, begin.data(), indices.data(), values.data() );
+      }
+      else {
+         ~mat = CustomCompressedMatrix<ET,rowMajor,uint64_t>(
+                   rows_, columns_, begin.data(), indices.data(), values.data() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Skips the zero padding to the next multiple of 64 bytes.
+//
+// \param archive The archive to be read from.
+// \param bytes The number of bytes read since the last 64-byte boundary.
+// \return void
+*/
+template< typename Archive >  // Type of the archive
+void MatrixSerializer::deserializePadding( Archive& archive, size_t bytes )
+{
+   uint8_t padding[alignment];
+   archive.read( padding, nextMultiple( bytes, alignment ) - bytes );
+}
+//*************************************************************************************************
+
+
+
 
 //=================================================================================================
 //
@@ -1260,6 +1708,51 @@ void serialize( Archive& archive, const Matrix<MT,SO>& mat )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Serializes the given matrix in the mappable format and writes it to the archive.
+//
+// \param archive The archive to be written.
+// \param mat The matrix to be serialized.
+// \return void
+// \exception std::runtime_error Matrix could not be serialized.
+//
+// This serialize() function converts the given matrix with numeric element type into the
+// mappable (version 2) binary representation. In this format the elements are stored in the
+// same layout as in memory, padded to multiples of 64 bytes:
+
+   \code
+   // Serialization of a dense and a sparse matrix in the mappable format
+   {
+      blaze::DynamicMatrix<double,blaze::rowMajor> D;
+      blaze::CompressedMatrix<double,blaze::rowMajor> S;
+
+      // ... Resizing and initialization
+
+      blaze::Archive<std::ofstream> archive( "matrices.blaze" );
+      serialize( archive, D, blaze::mappable );
+      serialize( archive, S, blaze::mappable );
+   }
+
+   // Zero-copy access to the dense matrix via a memory mapping of the file
+   {
+      blaze::MatrixMapping mapping( "matrices.blaze" );
+      auto D = mapping.dense<double,blaze::rowMajor>();
+   }
+   \endcode
+
+// Matrices in the mappable format can be deserialized via the deserialize() function as any
+// other matrix. Additionally, they can be accessed without copy via a MatrixMapping.
+*/
+template< typename Archive  // Type of the archive
+        , typename MT       // Type of the matrix
+        , bool SO >         // Storage order
+void serialize( Archive& archive, const Matrix<MT,SO>& mat, Mappable )
+{
+   MatrixSerializer().serialize( archive, ~mat, mappable );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Deserializes a matrix from the given archive.
 //
@@ -41,6 +41,7 @@
 //*************************************************************************************************
 
 #include <blaze/math/simd/BasicTypes.h>
+#include <blaze/math/simd/NativeMath.h>
 #include <blaze/system/Inline.h>
 #include <blaze/system/Vectorization.h>
 
@@ -60,7 +61,9 @@ namespace blaze {
 // \param a The vector of single precision floating point values.
 // \return The resulting vector.
 //
-// This operation is only available via the SVML for SSE, AVX, MIC, and AVX-512.
+// This operation is available via the SVML for SSE, AVX, MIC, and AVX-512. Without the SVML
+// it is available via the native SIMD math kernels for SSE2, AVX, and AVX-512 (see the
+// BLAZE_USE_SIMD_MATH switch), which have a maximum error of 1.5 ulp.
 */
 template< typename T >  // Type of the operand
 BLAZE_ALWAYS_INLINE const SIMDfloat exp( const SIMDf32<T>& a ) noexcept
@@ -76,6 +79,10 @@ BLAZE_ALWAYS_INLINE const SIMDfloat exp( const SIMDf32<T>& a ) noexcept
 {
    return _mm_exp_ps( (~a).eval().value );
 }
+#elif BLAZE_SIMD_MATH_MODE
+{
+   return nativeExp( (~a).eval() );
+}
 #else
 = delete;
 #endif
@@ -97,7 +104,9 @@ BLAZE_ALWAYS_INLINE const SIMDfloat exp( const SIMDf32<T>& a ) noexcept
 // \param a The vector of double precision floating point values.
 // \return The resulting vector.
 //
-// This operation is only available via the SVML for SSE, AVX, MIC, and AVX-512.
+// This operation is available via the SVML for SSE, AVX, MIC, and AVX-512. Without the SVML
+// it is available via the native SIMD math kernels for SSE2, AVX, and AVX-512 (see the
+// BLAZE_USE_SIMD_MATH switch), which have a maximum error of 2 ulp.
 */
 template< typename T >  // Type of the operand
 BLAZE_ALWAYS_INLINE const SIMDdouble exp( const SIMDf64<T>& a ) noexcept
@@ -113,6 +122,10 @@ BLAZE_ALWAYS_INLINE const SIMDdouble exp( const SIMDf64<T>& a ) noexcept
 {
    return _mm_exp_pd( (~a).eval().value );
 }
+#elif BLAZE_SIMD_MATH_MODE
+{
+   return nativeExp( (~a).eval() );
+}
 #else
 = delete;
 #endif
@@ -0,0 +1,189 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/simd/Gather.h
+//  \brief Header file for the SIMD gather functionality
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SIMD_GATHER_H_
+#define _BLAZE_MATH_SIMD_GATHER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/simd/BasicTypes.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/typetraits/HasSize.h>
+#include <blaze/util/typetraits/IsIntegral.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  32-BIT FLOATING POINT SIMD TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Gathers a vector of single precision floating point values via 4-byte indices.
+// \ingroup simd
+//
+// \param address The base address of the single precision floating point values.
+// \param index The first of the indices of the values to be gathered.
+// \return The vector of gathered values.
+//
+// This function loads the values \c address[index[0]], \c address[index[1]], ... into a
+// vector of single precision floating point values. Note that the indices are interpreted
+// as signed integral values. This operation is only available for AVX2 and AVX-512.
+*/
+template< typename IT >  // Type of the indices
+BLAZE_ALWAYS_INLINE const EnableIf_t< IsIntegral_v<IT> && HasSize_v<IT,4UL>, SIMDfloat >
+   gather( const float* address, const IT* index ) noexcept
+#if BLAZE_AVX512F_MODE
+{
+   return _mm512_i32gather_ps( _mm512_loadu_si512( index ), address, 4 );
+}
+#elif BLAZE_AVX2_MODE
+{
+   return _mm256_i32gather_ps( address, _mm256_loadu_si256( reinterpret_cast<const __m256i*>( index ) ), 4 );
+}
+#else
+= delete;
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Gathers a vector of single precision floating point values via 8-byte indices.
+// \ingroup simd
+//
+// \param address The base address of the single precision floating point values.
+// \param index The first of the indices of the values to be gathered.
+// \return The vector of gathered values.
+//
+// This function loads the values \c address[index[0]], \c address[index[1]], ... into a
+// vector of single precision floating point values. This operation is only available for
+// AVX2 and AVX-512.
+*/
+template< typename IT >  // Type of the indices
+BLAZE_ALWAYS_INLINE const EnableIf_t< IsIntegral_v<IT> && HasSize_v<IT,8UL>, SIMDfloat >
+   gather( const float* address, const IT* index ) noexcept
+#if BLAZE_AVX512F_MODE
+{
+   const __m256 lo( _mm512_i64gather_ps( _mm512_loadu_si512( index     ), address, 4 ) );
+   const __m256 hi( _mm512_i64gather_ps( _mm512_loadu_si512( index+8UL ), address, 4 ) );
+   return _mm512_castpd_ps( _mm512_insertf64x4( _mm512_castpd256_pd512( _mm256_castps_pd( lo ) )
+                                              , _mm256_castps_pd( hi ), 1 ) );
+}
+#elif BLAZE_AVX2_MODE
+{
+   const __m128 lo( _mm256_i64gather_ps( address, _mm256_loadu_si256( reinterpret_cast<const __m256i*>( index     ) ), 4 ) );
+   const __m128 hi( _mm256_i64gather_ps( address, _mm256_loadu_si256( reinterpret_cast<const __m256i*>( index+4UL ) ), 4 ) );
+   return _mm256_insertf128_ps( _mm256_castps128_ps256( lo ), hi, 1 );
+}
+#else
+= delete;
+#endif
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  64-BIT FLOATING POINT SIMD TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Gathers a vector of double precision floating point values via 4-byte indices.
+// \ingroup simd
+//
+// \param address The base address of the double precision floating point values.
+// \param index The first of the indices of the values to be gathered.
+// \return The vector of gathered values.
+//
+// This function loads the values \c address[index[0]], \c address[index[1]], ... into a
+// vector of double precision floating point values. Note that the indices are interpreted
+// as signed integral values. This operation is only available for AVX2 and AVX-512.
+*/
+template< typename IT >  // Type of the indices
+BLAZE_ALWAYS_INLINE const EnableIf_t< IsIntegral_v<IT> && HasSize_v<IT,4UL>, SIMDdouble >
+   gather( const double* address, const IT* index ) noexcept
+#if BLAZE_AVX512F_MODE
+{
+   return _mm512_i32gather_pd( _mm256_loadu_si256( reinterpret_cast<const __m256i*>( index ) ), address, 8 );
+}
+#elif BLAZE_AVX2_MODE
+{
+   return _mm256_i32gather_pd( address, _mm_loadu_si128( reinterpret_cast<const __m128i*>( index ) ), 8 );
+}
+#else
+= delete;
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Gathers a vector of double precision floating point values via 8-byte indices.
+// \ingroup simd
+//
+// \param address The base address of the double precision floating point values.
+// \param index The first of the indices of the values to be gathered.
+// \return The vector of gathered values.
+//
+// This function loads the values \c address[index[0]], \c address[index[1]], ... into a
+// vector of double precision floating point values. This operation is only available for
+// AVX2 and AVX-512.
+*/
+template< typename IT >  // Type of the indices
+BLAZE_ALWAYS_INLINE const EnableIf_t< IsIntegral_v<IT> && HasSize_v<IT,8UL>, SIMDdouble >
+   gather( const double* address, const IT* index ) noexcept
+#if BLAZE_AVX512F_MODE
+{
+   return _mm512_i64gather_pd( _mm512_loadu_si512( index ), address, 8 );
+}
+#elif BLAZE_AVX2_MODE
+{
+   return _mm256_i64gather_pd( address, _mm256_loadu_si256( reinterpret_cast<const __m256i*>( index ) ), 8 );
+}
+#else
+= delete;
+#endif
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,2039 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/simd/NativeMath.h
+//  \brief Header file for the native SIMD math kernels
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SIMD_NATIVEMATH_H_
+#define _BLAZE_MATH_SIMD_NATIVEMATH_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <limits>
+#include <blaze/math/simd/BasicTypes.h>
+#include <blaze/math/simd/Div.h>
+#include <blaze/math/simd/FMA.h>
+#include <blaze/math/simd/Loadu.h>
+#include <blaze/math/simd/Set.h>
+#include <blaze/math/simd/Storeu.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/Types.h>
+
+
+#if BLAZE_SIMD_MATH_MODE
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  32-BIT FLOATING POINT PRIMITIVES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Lane-wise selection \f$ a<b \; ? \; x \; : \; y \f$ for single precision values.
+// \ingroup simd
+//
+// \param a The left-hand side operand of the comparison.
+// \param b The right-hand side operand of the comparison.
+// \param x The values selected for lanes where \a a is less than \a b.
+// \param y The values selected for all other lanes (including unordered lanes).
+// \return The resulting vector.
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat
+   nativeSelectLess( const SIMDfloat& a, const SIMDfloat& b,
+                     const SIMDfloat& x, const SIMDfloat& y ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   return _mm512_mask_blend_ps( _mm512_cmp_ps_mask( a.value, b.value, _CMP_LT_OQ ), y.value, x.value );
+#elif BLAZE_AVX_MODE
+   return _mm256_blendv_ps( y.value, x.value, _mm256_cmp_ps( a.value, b.value, _CMP_LT_OQ ) );
+#else
+   const __m128 mask( _mm_cmplt_ps( a.value, b.value ) );
+   return _mm_or_ps( _mm_and_ps( mask, x.value ), _mm_andnot_ps( mask, y.value ) );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Lane-wise selection \f$ a==b \; ? \; x \; : \; y \f$ for single precision values.
+// \ingroup simd
+//
+// \param a The left-hand side operand of the comparison.
+// \param b The right-hand side operand of the comparison.
+// \param x The values selected for lanes where \a a is equal to \a b.
+// \param y The values selected for all other lanes (including unordered lanes).
+// \return The resulting vector.
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat
+   nativeSelectEqual( const SIMDfloat& a, const SIMDfloat& b,
+                      const SIMDfloat& x, const SIMDfloat& y ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   return _mm512_mask_blend_ps( _mm512_cmp_ps_mask( a.value, b.value, _CMP_EQ_OQ ), y.value, x.value );
+#elif BLAZE_AVX_MODE
+   return _mm256_blendv_ps( y.value, x.value, _mm256_cmp_ps( a.value, b.value, _CMP_EQ_OQ ) );
+#else
+   const __m128 mask( _mm_cmpeq_ps( a.value, b.value ) );
+   return _mm_or_ps( _mm_and_ps( mask, x.value ), _mm_andnot_ps( mask, y.value ) );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Lane-wise selection based on the sign bit of \a s for single precision values.
+// \ingroup simd
+//
+// \param s The vector whose sign bits control the selection.
+// \param x The values selected for lanes with a set sign bit.
+// \param y The values selected for lanes with a cleared sign bit.
+// \return The resulting vector.
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat
+   nativeSelectNegative( const SIMDfloat& s, const SIMDfloat& x, const SIMDfloat& y ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   const __mmask16 mask( _mm512_cmplt_epi32_mask( _mm512_castps_si512( s.value ), _mm512_setzero_si512() ) );
+   return _mm512_mask_blend_ps( mask, y.value, x.value );
+#elif BLAZE_AVX_MODE
+   return _mm256_blendv_ps( y.value, x.value, s.value );
+#else
+   const __m128 mask( _mm_castsi128_ps( _mm_srai_epi32( _mm_castps_si128( s.value ), 31 ) ) );
+   return _mm_or_ps( _mm_and_ps( mask, x.value ), _mm_andnot_ps( mask, y.value ) );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the absolute values of a vector of single precision values.
+// \ingroup simd
+//
+// \param a The vector of single precision values.
+// \return The resulting vector.
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat nativeAbs( const SIMDfloat& a ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   return _mm512_castsi512_ps( _mm512_and_epi32( _mm512_castps_si512( a.value ),
+                                                 _mm512_set1_epi32( 0x7FFFFFFF ) ) );
+#elif BLAZE_AVX_MODE
+   return _mm256_andnot_ps( _mm256_set1_ps( -0.0F ), a.value );
+#else
+   return _mm_andnot_ps( _mm_set1_ps( -0.0F ), a.value );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Flips the sign of all values in \a x whose corresponding value in \a s is negative.
+// \ingroup simd
+//
+// \param x The vector of single precision values.
+// \param s The vector providing the sign bits.
+// \return The resulting vector.
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat nativeFlipSign( const SIMDfloat& x, const SIMDfloat& s ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   const __m512i sign( _mm512_castps_si512( _mm512_set1_ps( -0.0F ) ) );
+   return _mm512_castsi512_ps( _mm512_xor_epi32( _mm512_castps_si512( x.value ),
+                                                 _mm512_and_epi32( _mm512_castps_si512( s.value ), sign ) ) );
+#elif BLAZE_AVX_MODE
+   return _mm256_xor_ps( x.value, _mm256_and_ps( s.value, _mm256_set1_ps( -0.0F ) ) );
+#else
+   return _mm_xor_ps( x.value, _mm_and_ps( s.value, _mm_set1_ps( -0.0F ) ) );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Rounds a vector of single precision values to the nearest integers (ties to even).
+// \ingroup simd
+//
+// \param a The vector of single precision values.
+// \return The resulting vector.
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat nativeRound( const SIMDfloat& a ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   return _mm512_roundscale_ps( a.value, ( _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC ) );
+#elif BLAZE_AVX_MODE
+   return _mm256_round_ps( a.value, ( _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC ) );
+#elif BLAZE_SSE4_MODE
+   return _mm_round_ps( a.value, ( _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC ) );
+#else
+   const __m128 sign ( _mm_set1_ps( -0.0F ) );
+   const __m128 magic( _mm_set1_ps( 8388608.0F ) );  // 2^23
+   const __m128 abs  ( _mm_andnot_ps( sign, a.value ) );
+   const __m128 tmp  ( _mm_or_ps( _mm_sub_ps( _mm_add_ps( abs, magic ), magic ),
+                                  _mm_and_ps( sign, a.value ) ) );
+   const __m128 mask ( _mm_cmplt_ps( abs, magic ) );
+   return _mm_or_ps( _mm_and_ps( mask, tmp ), _mm_andnot_ps( mask, a.value ) );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes \f$ 2^n \f$ for a vector of integral single precision values in \f$ [-126..127] \f$.
+// \ingroup simd
+//
+// \param n The vector of integral exponents.
+// \return The resulting vector.
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat nativePow2( const SIMDfloat& n ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   return _mm512_castsi512_ps( _mm512_slli_epi32( _mm512_add_epi32( _mm512_cvtps_epi32( n.value ),
+                                                                    _mm512_set1_epi32( 127 ) ), 23 ) );
+#elif BLAZE_AVX2_MODE
+   return _mm256_castsi256_ps( _mm256_slli_epi32( _mm256_add_epi32( _mm256_cvtps_epi32( n.value ),
+                                                                    _mm256_set1_epi32( 127 ) ), 23 ) );
+#elif BLAZE_AVX_MODE
+   const __m256i e   ( _mm256_cvtps_epi32( n.value ) );
+   const __m128i bias( _mm_set1_epi32( 127 ) );
+   const __m128i lo  ( _mm_slli_epi32( _mm_add_epi32( _mm256_castsi256_si128( e ), bias ), 23 ) );
+   const __m128i hi  ( _mm_slli_epi32( _mm_add_epi32( _mm256_extractf128_si256( e, 1 ), bias ), 23 ) );
+   return _mm256_castsi256_ps( _mm256_insertf128_si256( _mm256_castsi128_si256( lo ), hi, 1 ) );
+#else
+   return _mm_castsi128_ps( _mm_slli_epi32( _mm_add_epi32( _mm_cvtps_epi32( n.value ),
+                                                           _mm_set1_epi32( 127 ) ), 23 ) );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes \f$ p \cdot 2^n \f$ for a vector of integral single precision values in
+//        \f$ [-252..254] \f$.
+// \ingroup simd
+//
+// \param p The vector of single precision values.
+// \param n The vector of integral exponents.
+// \return The resulting vector.
+//
+// The scaling is performed in two steps to provide gradual underflow and a correct overflow
+// to infinity.
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat nativeScale( const SIMDfloat& p, const SIMDfloat& n ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   return _mm512_scalef_ps( p.value, n.value );
+#else
+   const SIMDfloat n1( nativeRound( n * set( 0.5F ) ) );
+   const SIMDfloat n2( n - n1 );
+   const SIMDfloat tmp( p * nativePow2( n1 ) );
+   return tmp * nativePow2( n2 );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Extracts the binary exponent \f$ e \f$ of positive, normalized single precision values
+//        such that \f$ a = m \cdot 2^e \f$ with \f$ m \in [0.5..1) \f$.
+// \ingroup simd
+//
+// \param a The vector of positive, normalized single precision values.
+// \return The resulting vector of integral exponents.
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat nativeExponent( const SIMDfloat& a ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   return _mm512_add_ps( _mm512_getexp_ps( a.value ), _mm512_set1_ps( 1.0F ) );
+#elif BLAZE_AVX2_MODE
+   return _mm256_cvtepi32_ps( _mm256_sub_epi32( _mm256_srli_epi32( _mm256_castps_si256( a.value ), 23 ),
+                                                _mm256_set1_epi32( 126 ) ) );
+#elif BLAZE_AVX_MODE
+   const __m256i bits( _mm256_castps_si256( a.value ) );
+   const __m128i bias( _mm_set1_epi32( 126 ) );
+   const __m128i lo  ( _mm_sub_epi32( _mm_srli_epi32( _mm256_castsi256_si128( bits ), 23 ), bias ) );
+   const __m128i hi  ( _mm_sub_epi32( _mm_srli_epi32( _mm256_extractf128_si256( bits, 1 ), 23 ), bias ) );
+   return _mm256_cvtepi32_ps( _mm256_insertf128_si256( _mm256_castsi128_si256( lo ), hi, 1 ) );
+#else
+   return _mm_cvtepi32_ps( _mm_sub_epi32( _mm_srli_epi32( _mm_castps_si128( a.value ), 23 ),
+                                          _mm_set1_epi32( 126 ) ) );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Extracts the mantissa \f$ m \in [0.5..1) \f$ of positive, normalized single precision
+//        values such that \f$ a = m \cdot 2^e \f$.
+// \ingroup simd
+//
+// \param a The vector of positive, normalized single precision values.
+// \return The resulting vector of mantissas.
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat nativeMantissa( const SIMDfloat& a ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   return _mm512_getmant_ps( a.value, _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_zero );
+#elif BLAZE_AVX_MODE
+   return _mm256_or_ps( _mm256_and_ps( a.value, _mm256_castsi256_ps( _mm256_set1_epi32( 0x007FFFFF ) ) ),
+                        _mm256_set1_ps( 0.5F ) );
+#else
+   return _mm_or_ps( _mm_and_ps( a.value, _mm_castsi128_ps( _mm_set1_epi32( 0x007FFFFF ) ) ),
+                     _mm_set1_ps( 0.5F ) );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether any absolute value of \a a is greater than \a limit or NaN.
+// \ingroup simd
+//
+// \param a The vector of single precision values.
+// \param limit The vector of (broadcast) limits.
+// \return \a true in case any value exceeds the limit, \a false if not.
+*/
+BLAZE_ALWAYS_INLINE bool nativeAnyAbsGreater( const SIMDfloat& a, const SIMDfloat& limit ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   return _mm512_cmp_ps_mask( nativeAbs( a ).value, limit.value, _CMP_LE_OQ ) != 0xFFFF;
+#elif BLAZE_AVX_MODE
+   return _mm256_movemask_ps( _mm256_cmp_ps( nativeAbs( a ).value, limit.value, _CMP_LE_OQ ) ) != 0xFF;
+#else
+   return _mm_movemask_ps( _mm_cmple_ps( nativeAbs( a ).value, limit.value ) ) != 0xF;
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Converts the lower half of a vector of single precision values to double precision.
+// \ingroup simd
+//
+// \param a The vector of single precision values.
+// \return The resulting vector of double precision values.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble nativeLowToDouble( const SIMDfloat& a ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   return _mm512_cvtps_pd( _mm512_castps512_ps256( a.value ) );
+#elif BLAZE_AVX_MODE
+   return _mm256_cvtps_pd( _mm256_castps256_ps128( a.value ) );
+#else
+   return _mm_cvtps_pd( a.value );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Converts the upper half of a vector of single precision values to double precision.
+// \ingroup simd
+//
+// \param a The vector of single precision values.
+// \return The resulting vector of double precision values.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble nativeHighToDouble( const SIMDfloat& a ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   return _mm512_cvtps_pd( _mm256_castpd_ps( _mm512_extractf64x4_pd( _mm512_castps_pd( a.value ), 1 ) ) );
+#elif BLAZE_AVX_MODE
+   return _mm256_cvtps_pd( _mm256_extractf128_ps( a.value, 1 ) );
+#else
+   return _mm_cvtps_pd( _mm_movehl_ps( a.value, a.value ) );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Converts two vectors of double precision values into a vector of single precision values.
+// \ingroup simd
+//
+// \param lo The double precision values for the lower half.
+// \param hi The double precision values for the upper half.
+// \return The resulting vector of single precision values.
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat nativeToFloat( const SIMDdouble& lo, const SIMDdouble& hi ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   return _mm512_castpd_ps( _mm512_insertf64x4( _mm512_castpd256_pd512( _mm256_castps_pd( _mm512_cvtpd_ps( lo.value ) ) ),
+                                                _mm256_castps_pd( _mm512_cvtpd_ps( hi.value ) ), 1 ) );
+#elif BLAZE_AVX_MODE
+   return _mm256_insertf128_ps( _mm256_castps128_ps256( _mm256_cvtpd_ps( lo.value ) ),
+                                _mm256_cvtpd_ps( hi.value ), 1 );
+#else
+   return _mm_movelh_ps( _mm_cvtpd_ps( lo.value ), _mm_cvtpd_ps( hi.value ) );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  64-BIT FLOATING POINT PRIMITIVES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Lane-wise selection \f$ a<b \; ? \; x \; : \; y \f$ for double precision values.
+// \ingroup simd
+//
+// \param a The left-hand side operand of the comparison.
+// \param b The right-hand side operand of the comparison.
+// \param x The values selected for lanes where \a a is less than \a b.
+// \param y The values selected for all other lanes (including unordered lanes).
+// \return The resulting vector.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble
+   nativeSelectLess( const SIMDdouble& a, const SIMDdouble& b,
+                     const SIMDdouble& x, const SIMDdouble& y ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   return _mm512_mask_blend_pd( _mm512_cmp_pd_mask( a.value, b.value, _CMP_LT_OQ ), y.value, x.value );
+#elif BLAZE_AVX_MODE
+   return _mm256_blendv_pd( y.value, x.value, _mm256_cmp_pd( a.value, b.value, _CMP_LT_OQ ) );
+#else
+   const __m128d mask( _mm_cmplt_pd( a.value, b.value ) );
+   return _mm_or_pd( _mm_and_pd( mask, x.value ), _mm_andnot_pd( mask, y.value ) );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Lane-wise selection \f$ a==b \; ? \; x \; : \; y \f$ for double precision values.
+// \ingroup simd
+//
+// \param a The left-hand side operand of the comparison.
+// \param b The right-hand side operand of the comparison.
+// \param x The values selected for lanes where \a a is equal to \a b.
+// \param y The values selected for all other lanes (including unordered lanes).
+// \return The resulting vector.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble
+   nativeSelectEqual( const SIMDdouble& a, const SIMDdouble& b,
+                      const SIMDdouble& x, const SIMDdouble& y ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   return _mm512_mask_blend_pd( _mm512_cmp_pd_mask( a.value, b.value, _CMP_EQ_OQ ), y.value, x.value );
+#elif BLAZE_AVX_MODE
+   return _mm256_blendv_pd( y.value, x.value, _mm256_cmp_pd( a.value, b.value, _CMP_EQ_OQ ) );
+#else
+   const __m128d mask( _mm_cmpeq_pd( a.value, b.value ) );
+   return _mm_or_pd( _mm_and_pd( mask, x.value ), _mm_andnot_pd( mask, y.value ) );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Lane-wise selection based on the sign bit of \a s for double precision values.
+// \ingroup simd
+//
+// \param s The vector whose sign bits control the selection.
+// \param x The values selected for lanes with a set sign bit.
+// \param y The values selected for lanes with a cleared sign bit.
+// \return The resulting vector.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble
+   nativeSelectNegative( const SIMDdouble& s, const SIMDdouble& x, const SIMDdouble& y ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   const __mmask8 mask( _mm512_cmplt_epi64_mask( _mm512_castpd_si512( s.value ), _mm512_setzero_si512() ) );
+   return _mm512_mask_blend_pd( mask, y.value, x.value );
+#elif BLAZE_AVX_MODE
+   return _mm256_blendv_pd( y.value, x.value, s.value );
+#else
+   const __m128d mask( _mm_castsi128_pd( _mm_shuffle_epi32( _mm_srai_epi32( _mm_castpd_si128( s.value ), 31 ),
+                                                            _MM_SHUFFLE( 3, 3, 1, 1 ) ) ) );
+   return _mm_or_pd( _mm_and_pd( mask, x.value ), _mm_andnot_pd( mask, y.value ) );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the absolute values of a vector of double precision values.
+// \ingroup simd
+//
+// \param a The vector of double precision values.
+// \return The resulting vector.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble nativeAbs( const SIMDdouble& a ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   return _mm512_castsi512_pd( _mm512_and_epi64( _mm512_castpd_si512( a.value ),
+                                                 _mm512_set1_epi64( 0x7FFFFFFFFFFFFFFFLL ) ) );
+#elif BLAZE_AVX_MODE
+   return _mm256_andnot_pd( _mm256_set1_pd( -0.0 ), a.value );
+#else
+   return _mm_andnot_pd( _mm_set1_pd( -0.0 ), a.value );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Flips the sign of all values in \a x whose corresponding value in \a s is negative.
+// \ingroup simd
+//
+// \param x The vector of double precision values.
+// \param s The vector providing the sign bits.
+// \return The resulting vector.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble nativeFlipSign( const SIMDdouble& x, const SIMDdouble& s ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   const __m512i sign( _mm512_castpd_si512( _mm512_set1_pd( -0.0 ) ) );
+   return _mm512_castsi512_pd( _mm512_xor_epi64( _mm512_castpd_si512( x.value ),
+                                                 _mm512_and_epi64( _mm512_castpd_si512( s.value ), sign ) ) );
+#elif BLAZE_AVX_MODE
+   return _mm256_xor_pd( x.value, _mm256_and_pd( s.value, _mm256_set1_pd( -0.0 ) ) );
+#else
+   return _mm_xor_pd( x.value, _mm_and_pd( s.value, _mm_set1_pd( -0.0 ) ) );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Rounds a vector of double precision values to the nearest integers (ties to even).
+// \ingroup simd
+//
+// \param a The vector of double precision values.
+// \return The resulting vector.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble nativeRound( const SIMDdouble& a ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   return _mm512_roundscale_pd( a.value, ( _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC ) );
+#elif BLAZE_AVX_MODE
+   return _mm256_round_pd( a.value, ( _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC ) );
+#elif BLAZE_SSE4_MODE
+   return _mm_round_pd( a.value, ( _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC ) );
+#else
+   const __m128d sign ( _mm_set1_pd( -0.0 ) );
+   const __m128d magic( _mm_set1_pd( 4503599627370496.0 ) );  // 2^52
+   const __m128d abs  ( _mm_andnot_pd( sign, a.value ) );
+   const __m128d tmp  ( _mm_or_pd( _mm_sub_pd( _mm_add_pd( abs, magic ), magic ),
+                                   _mm_and_pd( sign, a.value ) ) );
+   const __m128d mask ( _mm_cmplt_pd( abs, magic ) );
+   return _mm_or_pd( _mm_and_pd( mask, tmp ), _mm_andnot_pd( mask, a.value ) );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes \f$ 2^n \f$ for a vector of integral double precision values in \f$ [-1022..1023] \f$.
+// \ingroup simd
+//
+// \param n The vector of integral exponents.
+// \return The resulting vector.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble nativePow2( const SIMDdouble& n ) noexcept
+{
+   // Adding 1.5*2^52 + 1023 moves the biased exponent into the low bits of the mantissa
+#if BLAZE_AVX512F_MODE
+   const __m512d biased( _mm512_add_pd( n.value, _mm512_set1_pd( 6755399441056767.0 ) ) );
+   return _mm512_castsi512_pd( _mm512_slli_epi64( _mm512_castpd_si512( biased ), 52 ) );
+#elif BLAZE_AVX2_MODE
+   const __m256d biased( _mm256_add_pd( n.value, _mm256_set1_pd( 6755399441056767.0 ) ) );
+   return _mm256_castsi256_pd( _mm256_slli_epi64( _mm256_castpd_si256( biased ), 52 ) );
+#elif BLAZE_AVX_MODE
+   const __m256i biased( _mm256_castpd_si256( _mm256_add_pd( n.value, _mm256_set1_pd( 6755399441056767.0 ) ) ) );
+   const __m128i lo( _mm_slli_epi64( _mm256_castsi256_si128( biased ), 52 ) );
+   const __m128i hi( _mm_slli_epi64( _mm256_extractf128_si256( biased, 1 ), 52 ) );
+   return _mm256_castsi256_pd( _mm256_insertf128_si256( _mm256_castsi128_si256( lo ), hi, 1 ) );
+#else
+   const __m128d biased( _mm_add_pd( n.value, _mm_set1_pd( 6755399441056767.0 ) ) );
+   return _mm_castsi128_pd( _mm_slli_epi64( _mm_castpd_si128( biased ), 52 ) );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes \f$ p \cdot 2^n \f$ for a vector of integral double precision values in
+//        \f$ [-2044..2046] \f$.
+// \ingroup simd
+//
+// \param p The vector of double precision values.
+// \param n The vector of integral exponents.
+// \return The resulting vector.
+//
+// The scaling is performed in two steps to provide gradual underflow and a correct overflow
+// to infinity.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble nativeScale( const SIMDdouble& p, const SIMDdouble& n ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   return _mm512_scalef_pd( p.value, n.value );
+#else
+   const SIMDdouble n1( nativeRound( n * set( 0.5 ) ) );
+   const SIMDdouble n2( n - n1 );
+   const SIMDdouble tmp( p * nativePow2( n1 ) );
+   return tmp * nativePow2( n2 );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Extracts the binary exponent \f$ e \f$ of positive, normalized double precision values
+//        such that \f$ a = m \cdot 2^e \f$ with \f$ m \in [0.5..1) \f$.
+// \ingroup simd
+//
+// \param a The vector of positive, normalized double precision values.
+// \return The resulting vector of integral exponents.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble nativeExponent( const SIMDdouble& a ) noexcept
+{
+   // Or-ing the biased exponent into the mantissa of 2^52 results in 2^52 + biased exponent
+#if BLAZE_AVX512F_MODE
+   return _mm512_add_pd( _mm512_getexp_pd( a.value ), _mm512_set1_pd( 1.0 ) );
+#elif BLAZE_AVX2_MODE
+   const __m256d tmp( _mm256_or_pd( _mm256_castsi256_pd( _mm256_srli_epi64( _mm256_castpd_si256( a.value ), 52 ) ),
+                                    _mm256_set1_pd( 4503599627370496.0 ) ) );
+   return _mm256_sub_pd( tmp, _mm256_set1_pd( 4503599627371518.0 ) );
+#elif BLAZE_AVX_MODE
+   const __m256i bits( _mm256_castpd_si256( a.value ) );
+   const __m128i lo( _mm_srli_epi64( _mm256_castsi256_si128( bits ), 52 ) );
+   const __m128i hi( _mm_srli_epi64( _mm256_extractf128_si256( bits, 1 ), 52 ) );
+   const __m256d tmp( _mm256_or_pd( _mm256_castsi256_pd( _mm256_insertf128_si256( _mm256_castsi128_si256( lo ), hi, 1 ) ),
+                                    _mm256_set1_pd( 4503599627370496.0 ) ) );
+   return _mm256_sub_pd( tmp, _mm256_set1_pd( 4503599627371518.0 ) );
+#else
+   const __m128d tmp( _mm_or_pd( _mm_castsi128_pd( _mm_srli_epi64( _mm_castpd_si128( a.value ), 52 ) ),
+                                 _mm_set1_pd( 4503599627370496.0 ) ) );
+   return _mm_sub_pd( tmp, _mm_set1_pd( 4503599627371518.0 ) );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Extracts the mantissa \f$ m \in [0.5..1) \f$ of positive, normalized double precision
+//        values such that \f$ a = m \cdot 2^e \f$.
+// \ingroup simd
+//
+// \param a The vector of positive, normalized double precision values.
+// \return The resulting vector of mantissas.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble nativeMantissa( const SIMDdouble& a ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   return _mm512_getmant_pd( a.value, _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_zero );
+#elif BLAZE_AVX_MODE
+   return _mm256_or_pd( _mm256_and_pd( a.value, _mm256_castsi256_pd( _mm256_set1_epi64x( 0x000FFFFFFFFFFFFFLL ) ) ),
+                        _mm256_set1_pd( 0.5 ) );
+#else
+   return _mm_or_pd( _mm_and_pd( a.value, _mm_castsi128_pd( _mm_set1_epi64x( 0x000FFFFFFFFFFFFFLL ) ) ),
+                     _mm_set1_pd( 0.5 ) );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether any absolute value of \a a is greater than \a limit or NaN.
+// \ingroup simd
+//
+// \param a The vector of double precision values.
+// \param limit The vector of (broadcast) limits.
+// \return \a true in case any value exceeds the limit, \a false if not.
+*/
+BLAZE_ALWAYS_INLINE bool nativeAnyAbsGreater( const SIMDdouble& a, const SIMDdouble& limit ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   return _mm512_cmp_pd_mask( nativeAbs( a ).value, limit.value, _CMP_LE_OQ ) != 0xFF;
+#elif BLAZE_AVX_MODE
+   return _mm256_movemask_pd( _mm256_cmp_pd( nativeAbs( a ).value, limit.value, _CMP_LE_OQ ) ) != 0xF;
+#else
+   return _mm_movemask_pd( _mm_cmple_pd( nativeAbs( a ).value, limit.value ) ) != 0x3;
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GENERIC UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Clamps the values of \a a to the range \f$ [lo..hi] \f$ (NaN values are preserved).
+// \ingroup simd
+//
+// \param a The vector of floating point values.
+// \param lo The lower bound.
+// \param hi The upper bound.
+// \return The resulting vector.
+*/
+template< typename T >  // Type of the operand
+BLAZE_ALWAYS_INLINE const T nativeClamp( const T& a, const T& lo, const T& hi ) noexcept
+{
+   return nativeSelectLess( a, lo, lo, nativeSelectLess( hi, a, hi, a ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Negates all values of the given vector.
+// \ingroup simd
+//
+// \param a The vector of floating point values.
+// \return The resulting vector.
+*/
+template< typename T >  // Type of the operand
+BLAZE_ALWAYS_INLINE const T nativeNegate( const T& a ) noexcept
+{
+   return nativeFlipSign( a, set( typename T::ValueType( -1 ) ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Applies the given scalar operation to each value of the given vector.
+// \ingroup simd
+//
+// \param a The vector of floating point values.
+// \param op The scalar operation.
+// \return The resulting vector.
+//
+// This function is used as fallback for arguments beyond the range of the vectorized argument
+// reduction.
+*/
+template< typename T     // Type of the operand
+        , typename OP >  // Type of the scalar operation
+inline const T nativeScalar( const T& a, OP op ) noexcept
+{
+   using ET = typename T::ValueType;
+
+   ET values[T::size];
+   storeu( values, a );
+   for( size_t i=0UL; i<T::size; ++i ) {
+      values[i] = op( values[i] );
+   }
+   return loadu( values );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reduces double precision values to \f$ [-\pi/4..\pi/4] \f$ for the computation of
+//        single precision trigonometric functions.
+// \ingroup simd
+//
+// \param a The vector of double precision values (\f$ |a| \leq 2^{20} \f$).
+// \param r The resulting vector of reduced arguments.
+// \param k The resulting vector of quadrants \f$ [0..3] \f$.
+// \return void
+*/
+BLAZE_ALWAYS_INLINE void nativeReduceHalfPi( const SIMDdouble& a, SIMDdouble& r, SIMDdouble& k ) noexcept
+{
+   const SIMDdouble q( nativeRound( a * set( 0.63661977236758134308 ) ) );
+
+   r = a - q * set( 1.57079632673412561417E0 );
+   r = r - q * set( 6.07710050650619224932E-11 );
+   k = q - set( 4.0 ) * nativeRound( q * set( 0.25 ) - set( 0.375 ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  32-BIT FLOATING POINT KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native computation of \f$ e^x \f$ for a vector of single precision values.
+// \ingroup simd
+//
+// \param a The vector of single precision values.
+// \return The resulting vector.
+*/
+inline const SIMDfloat nativeExp( const SIMDfloat& a ) noexcept
+{
+   const SIMDfloat x( nativeClamp( a, set( -104.0F ), set( 89.0F ) ) );
+   const SIMDfloat n( nativeRound( x * set( 1.44269504088896341F ) ) );
+
+   SIMDfloat r( x - n * set( 0.693359375F ) );
+   r = r + n * set( 2.12194440E-4F );
+
+   const SIMDfloat r2( r * r );
+
+   SIMDfloat p( set( 1.9875691500E-4F ) );
+   p = p * r + set( 1.3981999507E-3F );
+   p = p * r + set( 8.3334519073E-3F );
+   p = p * r + set( 4.1665795894E-2F );
+   p = p * r + set( 1.6666665459E-1F );
+   p = p * r + set( 5.0000001201E-1F );
+   p = p * r2 + r;
+   p = p + set( 1.0F );
+
+   return nativeScale( p, n );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native computation of \f$ 2^x \f$ for a vector of single precision values.
+// \ingroup simd
+//
+// \param a The vector of single precision values.
+// \return The resulting vector.
+*/
+inline const SIMDfloat nativeExp2( const SIMDfloat& a ) noexcept
+{
+   const SIMDfloat x( nativeClamp( a, set( -151.0F ), set( 129.0F ) ) );
+   const SIMDfloat n( nativeRound( x ) );
+   const SIMDfloat r( x - n );
+
+   SIMDfloat p( set( 1.535336188319500E-4F ) );
+   p = p * r + set( 1.339887440266574E-3F );
+   p = p * r + set( 9.618437357674640E-3F );
+   p = p * r + set( 5.550332471162809E-2F );
+   p = p * r + set( 2.402264791363012E-1F );
+   p = p * r + set( 6.931472028550421E-1F );
+   p = p * r + set( 1.0F );
+
+   return nativeScale( p, n );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native computation of \f$ 10^x \f$ for a vector of single precision values.
+// \ingroup simd
+//
+// \param a The vector of single precision values.
+// \return The resulting vector.
+*/
+inline const SIMDfloat nativeExp10( const SIMDfloat& a ) noexcept
+{
+   const SIMDfloat x( nativeClamp( a, set( -46.0F ), set( 39.0F ) ) );
+   const SIMDfloat n( nativeRound( x * set( 3.32192809488736234787F ) ) );
+
+   SIMDfloat r( x - n * set( 3.00781250000000000000E-1F ) );
+   r = r - n * set( 2.48745663981195213739E-4F );
+
+   SIMDfloat p( set( 2.063216740311022E-1F ) );
+   p = p * r + set( 5.420251702225484E-1F );
+   p = p * r + set( 1.171292686296281E+0F );
+   p = p * r + set( 2.034649854009453E+0F );
+   p = p * r + set( 2.650948748208892E+0F );
+   p = p * r + set( 2.302585167056758E+0F );
+   p = p * r + set( 1.0F );
+
+   return nativeScale( p, n );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Splits positive single precision values into \f$ a = (1+f) \cdot 2^e \f$ with
+//        \f$ 1+f \in [\sqrt{0.5}..\sqrt{2}) \f$.
+// \ingroup simd
+//
+// \param a The vector of single precision values.
+// \param f The resulting vector of fractions.
+// \param e The resulting vector of integral exponents.
+// \return void
+*/
+BLAZE_ALWAYS_INLINE void nativeLogReduce( const SIMDfloat& a, SIMDfloat& f, SIMDfloat& e ) noexcept
+{
+   const SIMDfloat tiny( set( std::numeric_limits<float>::min() ) );
+   const SIMDfloat one ( set( 1.0F ) );
+
+   // Subnormal values are scaled by 2^25 into the normalized range
+   const SIMDfloat x( nativeSelectLess( a, tiny, a * set( 33554432.0F ), a ) );
+   const SIMDfloat m( nativeMantissa( x ) );
+   const SIMDfloat c( set( 0.707106781186547524F ) );
+
+   e = nativeExponent( x ) - nativeSelectLess( a, tiny, set( 25.0F ), set( 0.0F ) );
+   e = nativeSelectLess( m, c, e - one, e );
+   f = nativeSelectLess( m, c, ( m + m ) - one, m - one );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes \f$ \ln(1+f) - f + f^2/2 \f$ for a vector of reduced single precision values.
+// \ingroup simd
+//
+// \param f The vector of fractions.
+// \param z The vector of squared fractions.
+// \return The resulting vector.
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat nativeLogPoly( const SIMDfloat& f, const SIMDfloat& z ) noexcept
+{
+   SIMDfloat p( set( 7.0376836292E-2F ) );
+   p = p * f + set( -1.1514610310E-1F );
+   p = p * f + set( 1.1676998740E-1F );
+   p = p * f + set( -1.2420140846E-1F );
+   p = p * f + set( 1.4249322787E-1F );
+   p = p * f + set( -1.6668057665E-1F );
+   p = p * f + set( 2.0000714765E-1F );
+   p = p * f + set( -2.4999993993E-1F );
+   p = p * f + set( 3.3333331174E-1F );
+   p = p * f;
+   return p * z;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Handles the special arguments of the logarithm functions for single precision values.
+// \ingroup simd
+//
+// \param a The vector of arguments.
+// \param r The vector of results for positive, finite arguments.
+// \return The resulting vector.
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat nativeLogFinish( const SIMDfloat& a, const SIMDfloat& r ) noexcept
+{
+   const SIMDfloat zero( set( 0.0F ) );
+   const SIMDfloat infinity( set( std::numeric_limits<float>::infinity() ) );
+
+   SIMDfloat tmp( nativeSelectLess( a, infinity, r, a ) );
+   tmp = nativeSelectLess( a, zero, set( std::numeric_limits<float>::quiet_NaN() ), tmp );
+   return nativeSelectEqual( a, zero, set( -std::numeric_limits<float>::infinity() ), tmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native computation of the natural logarithm for a vector of single precision values.
+// \ingroup simd
+//
+// \param a The vector of single precision values.
+// \return The resulting vector.
+*/
+inline const SIMDfloat nativeLog( const SIMDfloat& a ) noexcept
+{
+   SIMDfloat f, e;
+   nativeLogReduce( a, f, e );
+
+   const SIMDfloat z( f * f );
+
+   SIMDfloat y( nativeLogPoly( f, z ) );
+   y = y + e * set( -2.12194440E-4F );
+   y = y + z * set( -0.5F );
+
+   SIMDfloat r( f + y );
+   r = r + e * set( 0.693359375F );
+
+   return nativeLogFinish( a, r );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native computation of the binary logarithm for a vector of single precision values.
+// \ingroup simd
+//
+// \param a The vector of single precision values.
+// \return The resulting vector.
+*/
+inline const SIMDfloat nativeLog2( const SIMDfloat& a ) noexcept
+{
+   SIMDfloat f, e;
+   nativeLogReduce( a, f, e );
+
+   const SIMDfloat z( f * f );
+   const SIMDfloat c( set( 0.44269504088896340736F ) );  // log2(e) - 1
+
+   SIMDfloat y( nativeLogPoly( f, z ) );
+   y = y + z * set( -0.5F );
+
+   SIMDfloat r( y * c );
+   r = r + f * c;
+   r = r + y;
+   r = r + f;
+   r = r + e;
+
+   return nativeLogFinish( a, r );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native computation of the common logarithm for a vector of single precision values.
+// \ingroup simd
+//
+// \param a The vector of single precision values.
+// \return The resulting vector.
+*/
+inline const SIMDfloat nativeLog10( const SIMDfloat& a ) noexcept
+{
+   SIMDfloat f, e;
+   nativeLogReduce( a, f, e );
+
+   const SIMDfloat z( f * f );
+   const SIMDfloat c( set( 4.3359375E-1F ) );  // log10(e), leading part
+
+   SIMDfloat y( nativeLogPoly( f, z ) );
+   y = y + z * set( -0.5F );
+
+   SIMDfloat r( ( f + y ) * set( 7.00731903251827651129E-4F ) );
+   r = r + y * c;
+   r = r + f * c;
+   r = r + e * set( 2.48745663981195213739E-4F );
+   r = r + e * set( 3.00781250000000000000E-1F );
+
+   return nativeLogFinish( a, r );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the sine and cosine of the reduced arguments of single precision values.
+// \ingroup simd
+//
+// \param a The vector of single precision values (\f$ |a| \leq 65536 \f$).
+// \param s The resulting vector of sines of the reduced arguments.
+// \param c The resulting vector of cosines of the reduced arguments.
+// \param k The resulting vector of quadrants \f$ [0..3] \f$.
+// \return void
+//
+// The argument reduction is performed in double precision to avoid the cancellation close
+// to multiples of \f$ \pi/2 \f$.
+*/
+BLAZE_ALWAYS_INLINE void
+   nativeSinCos( const SIMDfloat& a, SIMDfloat& s, SIMDfloat& c, SIMDfloat& k ) noexcept
+{
+   SIMDdouble rlo, klo, rhi, khi;
+   nativeReduceHalfPi( nativeLowToDouble( a ), rlo, klo );
+   nativeReduceHalfPi( nativeHighToDouble( a ), rhi, khi );
+
+   const SIMDfloat r( nativeToFloat( rlo, rhi ) );
+   const SIMDfloat z( r * r );
+
+   s = set( -1.9515295891E-4F );
+   s = s * z + set( 8.3321608736E-3F );
+   s = s * z + set( -1.6666654611E-1F );
+   s = s * z;
+   s = s * r + r;
+
+   c = set( 2.443315711809948E-5F );
+   c = c * z + set( -1.388731625493765E-3F );
+   c = c * z + set( 4.166664568298827E-2F );
+   c = c * z;
+   c = c * z + set( 1.0F );
+   c = c - z * set( 0.5F );
+
+   k = nativeToFloat( klo, khi );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native computation of the sine for a vector of single precision values.
+// \ingroup simd
+//
+// \param a The vector of single precision values.
+// \return The resulting vector.
+*/
+inline const SIMDfloat nativeSin( const SIMDfloat& a ) noexcept
+{
+   if( nativeAnyAbsGreater( a, set( 65536.0F ) ) ) {
+      return nativeScalar( a, []( float x ){ return std::sin( x ); } );
+   }
+
+   SIMDfloat s, c, k;
+   nativeSinCos( a, s, c, k );
+
+   return nativeSelectEqual( k, set( 0.0F ), s,
+          nativeSelectEqual( k, set( 1.0F ), c,
+          nativeSelectEqual( k, set( 2.0F ), nativeNegate( s ), nativeNegate( c ) ) ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native computation of the cosine for a vector of single precision values.
+// \ingroup simd
+//
+// \param a The vector of single precision values.
+// \return The resulting vector.
+*/
+inline const SIMDfloat nativeCos( const SIMDfloat& a ) noexcept
+{
+   if( nativeAnyAbsGreater( a, set( 65536.0F ) ) ) {
+      return nativeScalar( a, []( float x ){ return std::cos( x ); } );
+   }
+
+   SIMDfloat s, c, k;
+   nativeSinCos( a, s, c, k );
+
+   return nativeSelectEqual( k, set( 0.0F ), c,
+          nativeSelectEqual( k, set( 1.0F ), nativeNegate( s ),
+          nativeSelectEqual( k, set( 2.0F ), nativeNegate( c ), s ) ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native computation of the tangent for a vector of single precision values.
+// \ingroup simd
+//
+// \param a The vector of single precision values.
+// \return The resulting vector.
+*/
+inline const SIMDfloat nativeTan( const SIMDfloat& a ) noexcept
+{
+   if( nativeAnyAbsGreater( a, set( 65536.0F ) ) ) {
+      return nativeScalar( a, []( float x ){ return std::tan( x ); } );
+   }
+
+   SIMDfloat s, c, k;
+   nativeSinCos( a, s, c, k );
+
+   const SIMDfloat odd( k - set( 2.0F ) * nativeRound( k * set( 0.5F ) - set( 0.25F ) ) );
+
+   return nativeSelectEqual( odd, set( 0.0F ), s / c, nativeNegate( c / s ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native computation of the hyperbolic tangent for a vector of single precision values.
+// \ingroup simd
+//
+// \param a The vector of single precision values.
+// \return The resulting vector.
+*/
+inline const SIMDfloat nativeTanh( const SIMDfloat& a ) noexcept
+{
+   const SIMDfloat one( set( 1.0F ) );
+   const SIMDfloat abs( nativeAbs( a ) );
+   const SIMDfloat z  ( a * a );
+
+   SIMDfloat p( set( -5.70498872745E-3F ) );
+   p = p * z + set( 2.06390887954E-2F );
+   p = p * z + set( -5.37397155531E-2F );
+   p = p * z + set( 1.33314422036E-1F );
+   p = p * z + set( -3.33332819422E-1F );
+   p = p * z;
+   p = p * a + a;
+
+   const SIMDfloat e( nativeExp( abs + abs ) );
+   const SIMDfloat q( nativeFlipSign( one - set( 2.0F ) / ( e + one ), a ) );
+
+   return nativeSelectLess( abs, set( 0.625F ), p, q );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  64-BIT FLOATING POINT KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes \f$ e^r \f$ for a vector of reduced double precision values.
+// \ingroup simd
+//
+// \param r The vector of reduced arguments (\f$ |r| \leq \ln(2)/2 \f$).
+// \return The resulting vector.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble nativeExpPoly( const SIMDdouble& r ) noexcept
+{
+   const SIMDdouble r2( r * r );
+
+   SIMDdouble p( set( 1.26177193074810590878E-4 ) );
+   p = p * r2 + set( 3.02994407707441961300E-2 );
+   p = p * r2 + set( 9.99999999999999999910E-1 );
+   p = p * r;
+
+   SIMDdouble q( set( 3.00198505138664455042E-6 ) );
+   q = q * r2 + set( 2.52448340349684104192E-3 );
+   q = q * r2 + set( 2.27265548208155028766E-1 );
+   q = q * r2 + set( 2.00000000000000000009E0 );
+
+   p = p / ( q - p );
+   return p * set( 2.0 ) + set( 1.0 );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native computation of \f$ e^{hi+lo} \f$ for a vector of double precision values.
+// \ingroup simd
+//
+// \param hi The vector of double precision values.
+// \param lo The vector of (small) corrections to \a hi.
+// \return The resulting vector.
+*/
+inline const SIMDdouble nativeExp( const SIMDdouble& hi, const SIMDdouble& lo ) noexcept
+{
+   const SIMDdouble x( nativeClamp( hi, set( -746.0 ), set( 710.0 ) ) );
+   const SIMDdouble n( nativeRound( x * set( 1.4426950408889634073599 ) ) );
+
+   SIMDdouble r( x - n * set( 6.93145751953125E-1 ) );
+   r = r - n * set( 1.42860682030941723212E-6 );
+   r = r + lo;
+
+   return nativeScale( nativeExpPoly( r ), n );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native computation of \f$ e^x \f$ for a vector of double precision values.
+// \ingroup simd
+//
+// \param a The vector of double precision values.
+// \return The resulting vector.
+*/
+inline const SIMDdouble nativeExp( const SIMDdouble& a ) noexcept
+{
+   const SIMDdouble x( nativeClamp( a, set( -746.0 ), set( 710.0 ) ) );
+   const SIMDdouble n( nativeRound( x * set( 1.4426950408889634073599 ) ) );
+
+   SIMDdouble r( x - n * set( 6.93145751953125E-1 ) );
+   r = r - n * set( 1.42860682030941723212E-6 );
+
+   return nativeScale( nativeExpPoly( r ), n );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native computation of \f$ 2^x \f$ for a vector of double precision values.
+// \ingroup simd
+//
+// \param a The vector of double precision values.
+// \return The resulting vector.
+*/
+inline const SIMDdouble nativeExp2( const SIMDdouble& a ) noexcept
+{
+   const SIMDdouble x( nativeClamp( a, set( -1076.0 ), set( 1025.0 ) ) );
+   const SIMDdouble n( nativeRound( x ) );
+   const SIMDdouble r( x - n );
+   const SIMDdouble r2( r * r );
+
+   SIMDdouble p( set( 2.30933477057345225087E-2 ) );
+   p = p * r2 + set( 2.02020656693165307700E1 );
+   p = p * r2 + set( 1.51390680115615096133E3 );
+   p = p * r;
+
+   SIMDdouble q( r2 + set( 2.33184211722314911771E2 ) );
+   q = q * r2 + set( 4.36821166879210612817E3 );
+
+   p = p / ( q - p );
+   p = p * set( 2.0 ) + set( 1.0 );
+
+   return nativeScale( p, n );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native computation of \f$ 10^x \f$ for a vector of double precision values.
+// \ingroup simd
+//
+// \param a The vector of double precision values.
+// \return The resulting vector.
+*/
+inline const SIMDdouble nativeExp10( const SIMDdouble& a ) noexcept
+{
+   const SIMDdouble x( nativeClamp( a, set( -324.0 ), set( 309.0 ) ) );
+   const SIMDdouble n( nativeRound( x * set( 3.32192809488736234787 ) ) );
+
+   SIMDdouble r( x - n * set( 3.01025390625000000000E-1 ) );
+   r = r - n * set( 4.60503898119521373889E-6 );
+
+   const SIMDdouble r2( r * r );
+
+   SIMDdouble p( set( 4.09962519798587023075E-2 ) );
+   p = p * r2 + set( 1.17452732554344059015E1 );
+   p = p * r2 + set( 4.06717289936872725516E2 );
+   p = p * r2 + set( 2.39423741207388267439E3 );
+   p = p * r;
+
+   SIMDdouble q( r2 + set( 8.50936160849306532625E1 ) );
+   q = q * r2 + set( 1.27209271178345121210E3 );
+   q = q * r2 + set( 2.07960819286001865907E3 );
+
+   p = p / ( q - p );
+   p = p * set( 2.0 ) + set( 1.0 );
+
+   return nativeScale( p, n );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Splits positive double precision values into \f$ a = (1+f) \cdot 2^e \f$ with
+//        \f$ 1+f \in [\sqrt{0.5}..\sqrt{2}) \f$.
+// \ingroup simd
+//
+// \param a The vector of double precision values.
+// \param f The resulting vector of fractions.
+// \param e The resulting vector of integral exponents.
+// \return void
+*/
+BLAZE_ALWAYS_INLINE void nativeLogReduce( const SIMDdouble& a, SIMDdouble& f, SIMDdouble& e ) noexcept
+{
+   const SIMDdouble tiny( set( std::numeric_limits<double>::min() ) );
+   const SIMDdouble one ( set( 1.0 ) );
+
+   // Subnormal values are scaled by 2^54 into the normalized range
+   const SIMDdouble x( nativeSelectLess( a, tiny, a * set( 18014398509481984.0 ), a ) );
+   const SIMDdouble m( nativeMantissa( x ) );
+   const SIMDdouble c( set( 0.70710678118654752440 ) );
+
+   e = nativeExponent( x ) - nativeSelectLess( a, tiny, set( 54.0 ), set( 0.0 ) );
+   e = nativeSelectLess( m, c, e - one, e );
+   f = nativeSelectLess( m, c, ( m + m ) - one, m - one );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes \f$ \ln(1+f) - f + f^2/2 \f$ for a vector of reduced double precision values.
+// \ingroup simd
+//
+// \param f The vector of fractions.
+// \param z The vector of squared fractions.
+// \return The resulting vector.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble nativeLogPoly( const SIMDdouble& f, const SIMDdouble& z ) noexcept
+{
+   SIMDdouble p( set( 1.01875663804580931796E-4 ) );
+   p = p * f + set( 4.97494994976747001425E-1 );
+   p = p * f + set( 4.70579119878881725854E0 );
+   p = p * f + set( 1.44989225341610930846E1 );
+   p = p * f + set( 1.79368678507819816313E1 );
+   p = p * f + set( 7.70838733755885391666E0 );
+
+   SIMDdouble q( f + set( 1.12873587189167450590E1 ) );
+   q = q * f + set( 4.52279145837532221105E1 );
+   q = q * f + set( 8.29875266912776603211E1 );
+   q = q * f + set( 7.11544750618563894466E1 );
+   q = q * f + set( 2.31251620126765340583E1 );
+
+   p = p * z;
+   p = p / q;
+   return p * f;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Handles the special arguments of the logarithm functions for double precision values.
+// \ingroup simd
+//
+// \param a The vector of arguments.
+// \param r The vector of results for positive, finite arguments.
+// \return The resulting vector.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble nativeLogFinish( const SIMDdouble& a, const SIMDdouble& r ) noexcept
+{
+   const SIMDdouble zero( set( 0.0 ) );
+   const SIMDdouble infinity( set( std::numeric_limits<double>::infinity() ) );
+
+   SIMDdouble tmp( nativeSelectLess( a, infinity, r, a ) );
+   tmp = nativeSelectLess( a, zero, set( std::numeric_limits<double>::quiet_NaN() ), tmp );
+   return nativeSelectEqual( a, zero, set( -std::numeric_limits<double>::infinity() ), tmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native computation of the natural logarithm for a vector of double precision values.
+// \ingroup simd
+//
+// \param a The vector of double precision values.
+// \return The resulting vector.
+*/
+inline const SIMDdouble nativeLog( const SIMDdouble& a ) noexcept
+{
+   SIMDdouble f, e;
+   nativeLogReduce( a, f, e );
+
+   const SIMDdouble z( f * f );
+
+   SIMDdouble y( nativeLogPoly( f, z ) );
+   y = y + e * set( -2.121944400546905827679E-4 );
+   y = y + z * set( -0.5 );
+
+   SIMDdouble r( f + y );
+   r = r + e * set( 0.693359375 );
+
+   return nativeLogFinish( a, r );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native computation of the binary logarithm for a vector of double precision values.
+// \ingroup simd
+//
+// \param a The vector of double precision values.
+// \return The resulting vector.
+*/
+inline const SIMDdouble nativeLog2( const SIMDdouble& a ) noexcept
+{
+   SIMDdouble f, e;
+   nativeLogReduce( a, f, e );
+
+   const SIMDdouble z( f * f );
+   const SIMDdouble c( set( 4.4269504088896340735992E-1 ) );  // log2(e) - 1
+
+   SIMDdouble y( nativeLogPoly( f, z ) );
+   y = y + z * set( -0.5 );
+
+   SIMDdouble r( y * c );
+   r = r + f * c;
+   r = r + y;
+   r = r + f;
+   r = r + e;
+
+   return nativeLogFinish( a, r );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native computation of the common logarithm for a vector of double precision values.
+// \ingroup simd
+//
+// \param a The vector of double precision values.
+// \return The resulting vector.
+*/
+inline const SIMDdouble nativeLog10( const SIMDdouble& a ) noexcept
+{
+   SIMDdouble f, e;
+   nativeLogReduce( a, f, e );
+
+   const SIMDdouble z( f * f );
+   const SIMDdouble c( set( 4.3359375E-1 ) );  // log10(e), leading part
+
+   SIMDdouble y( nativeLogPoly( f, z ) );
+   y = y + z * set( -0.5 );
+
+   SIMDdouble r( ( f + y ) * set( 7.00731903251827651129E-4 ) );
+   r = r + y * c;
+   r = r + f * c;
+   r = r + e * set( 2.48745663981195213739E-4 );
+   r = r + e * set( 3.00781250000000000000E-1 );
+
+   return nativeLogFinish( a, r );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the sine and cosine of the reduced arguments of double precision values.
+// \ingroup simd
+//
+// \param a The vector of double precision values (\f$ |a| \leq 2^{20} \f$).
+// \param s The resulting vector of sines of the reduced arguments.
+// \param c The resulting vector of cosines of the reduced arguments.
+// \param k The resulting vector of quadrants \f$ [0..3] \f$.
+// \return void
+*/
+BLAZE_ALWAYS_INLINE void
+   nativeSinCos( const SIMDdouble& a, SIMDdouble& s, SIMDdouble& c, SIMDdouble& k ) noexcept
+{
+   const SIMDdouble q( nativeRound( a * set( 0.63661977236758134308 ) ) );
+
+   SIMDdouble r( a - q * set( 1.57079625129699707031E0 ) );
+   r = r - q * set( 7.54978941586159635335E-8 );
+   r = r - q * set( 5.39030285815811905290E-15 );
+
+   const SIMDdouble z( r * r );
+
+   s = set( 1.58962301576546568060E-10 );
+   s = s * z + set( -2.50507477628578072866E-8 );
+   s = s * z + set( 2.75573136213857245213E-6 );
+   s = s * z + set( -1.98412698295895385996E-4 );
+   s = s * z + set( 8.33333333332211858878E-3 );
+   s = s * z + set( -1.66666666666666307295E-1 );
+   s = s * z;
+   s = s * r + r;
+
+   c = set( -1.13585365213876817300E-11 );
+   c = c * z + set( 2.08757008419747316778E-9 );
+   c = c * z + set( -2.75573141792967388112E-7 );
+   c = c * z + set( 2.48015872888517045348E-5 );
+   c = c * z + set( -1.38888888888730564116E-3 );
+   c = c * z + set( 4.16666666666665929218E-2 );
+   c = c * z;
+   c = c * z + set( 1.0 );
+   c = c - z * set( 0.5 );
+
+   k = q - set( 4.0 ) * nativeRound( q * set( 0.25 ) - set( 0.375 ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native computation of the sine for a vector of double precision values.
+// \ingroup simd
+//
+// \param a The vector of double precision values.
+// \return The resulting vector.
+*/
+inline const SIMDdouble nativeSin( const SIMDdouble& a ) noexcept
+{
+   if( nativeAnyAbsGreater( a, set( 1048576.0 ) ) ) {
+      return nativeScalar( a, []( double x ){ return std::sin( x ); } );
+   }
+
+   SIMDdouble s, c, k;
+   nativeSinCos( a, s, c, k );
+
+   return nativeSelectEqual( k, set( 0.0 ), s,
+          nativeSelectEqual( k, set( 1.0 ), c,
+          nativeSelectEqual( k, set( 2.0 ), nativeNegate( s ), nativeNegate( c ) ) ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native computation of the cosine for a vector of double precision values.
+// \ingroup simd
+//
+// \param a The vector of double precision values.
+// \return The resulting vector.
+*/
+inline const SIMDdouble nativeCos( const SIMDdouble& a ) noexcept
+{
+   if( nativeAnyAbsGreater( a, set( 1048576.0 ) ) ) {
+      return nativeScalar( a, []( double x ){ return std::cos( x ); } );
+   }
+
+   SIMDdouble s, c, k;
+   nativeSinCos( a, s, c, k );
+
+   return nativeSelectEqual( k, set( 0.0 ), c,
+          nativeSelectEqual( k, set( 1.0 ), nativeNegate( s ),
+          nativeSelectEqual( k, set( 2.0 ), nativeNegate( c ), s ) ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native computation of the tangent for a vector of double precision values.
+// \ingroup simd
+//
+// \param a The vector of double precision values.
+// \return The resulting vector.
+*/
+inline const SIMDdouble nativeTan( const SIMDdouble& a ) noexcept
+{
+   if( nativeAnyAbsGreater( a, set( 1048576.0 ) ) ) {
+      return nativeScalar( a, []( double x ){ return std::tan( x ); } );
+   }
+
+   SIMDdouble s, c, k;
+   nativeSinCos( a, s, c, k );
+
+   const SIMDdouble odd( k - set( 2.0 ) * nativeRound( k * set( 0.5 ) - set( 0.25 ) ) );
+
+   return nativeSelectEqual( odd, set( 0.0 ), s / c, nativeNegate( c / s ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native computation of the hyperbolic tangent for a vector of double precision values.
+// \ingroup simd
+//
+// \param a The vector of double precision values.
+// \return The resulting vector.
+*/
+inline const SIMDdouble nativeTanh( const SIMDdouble& a ) noexcept
+{
+   const SIMDdouble one( set( 1.0 ) );
+   const SIMDdouble abs( nativeAbs( a ) );
+   const SIMDdouble z  ( a * a );
+
+   SIMDdouble p( set( -9.64399179425052238628E-1 ) );
+   p = p * z + set( -9.92877231001918586564E1 );
+   p = p * z + set( -1.61468768441708447952E3 );
+
+   SIMDdouble q( z + set( 1.12811678491632931402E2 ) );
+   q = q * z + set( 2.23548839060100448583E3 );
+   q = q * z + set( 4.84406305325125486048E3 );
+
+   p = p * z;
+   p = p / q;
+   p = p * a + a;
+
+   const SIMDdouble e( nativeExp( abs + abs ) );
+   const SIMDdouble t( nativeFlipSign( one - set( 2.0 ) / ( e + one ), a ) );
+
+   return nativeSelectLess( abs, set( 0.625 ), p, t );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Handles the special arguments of the power function for double precision values.
+// \ingroup simd
+//
+// \param x The vector of base values.
+// \param y The vector of exponents.
+// \param r The vector of results \f$ |x|^y \f$.
+// \return The resulting vector.
+//
+// This function applies the sign for negative bases, returns NaN for negative, finite bases
+// with non-integral exponents and handles the special cases \f$ x^0 = 1 \f$, \f$ 1^y = 1 \f$,
+// \f$ (-1)^{\pm\infty} = 1 \f$, and \f$ x^{\pm\infty} \f$ according to the C99 standard.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble
+   nativePowFinish( const SIMDdouble& x, const SIMDdouble& y, const SIMDdouble& r ) noexcept
+{
+   const SIMDdouble zero    ( set( 0.0 ) );
+   const SIMDdouble one     ( set( 1.0 ) );
+   const SIMDdouble infinity( set( std::numeric_limits<double>::infinity() ) );
+   const SIMDdouble half    ( y * set( 0.5 ) );
+   const SIMDdouble abs     ( nativeAbs( x ) );
+
+   // Negative bases: sign for odd integral exponents, NaN for non-integral exponents
+   const SIMDdouble odd( nativeSelectEqual( nativeRound( half ), half, r,
+                         nativeSelectEqual( nativeRound( y ), y, nativeNegate( r ), r ) ) );
+   const SIMDdouble neg( nativeSelectNegative( x, odd, r ) );
+   const SIMDdouble nan( nativeSelectLess( x, zero,
+                         nativeSelectLess( nativeNegate( infinity ), x,
+                                           set( std::numeric_limits<double>::quiet_NaN() ), neg ), neg ) );
+
+   // Infinite exponents: overflow or underflow depending on |x| (non-NaN bases only)
+   const SIMDdouble huge( nativeSelectLess( zero, y, nativeSelectLess( one, abs, infinity, zero ),
+                                                     nativeSelectLess( abs, one, infinity, zero ) ) );
+
+   SIMDdouble tmp( nativeSelectEqual( nativeRound( y ), y, neg, nan ) );
+   tmp = nativeSelectEqual( nativeAbs( y ), infinity, nativeSelectEqual( x, x, huge, tmp ), tmp );
+   tmp = nativeSelectEqual( abs, one, nativeSelectEqual( nativeAbs( y ), infinity, one, tmp ), tmp );
+   tmp = nativeSelectEqual( y, zero, one, tmp );
+   return nativeSelectEqual( x, one, one, tmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the sum \f$ a+b \f$ and its rounding error for vectors of double precision
+//        values (Knuth's TwoSum).
+// \ingroup simd
+//
+// \param a The first summand.
+// \param b The second summand.
+// \param s The resulting rounded sum.
+// \param e The resulting rounding error.
+// \return void
+*/
+BLAZE_ALWAYS_INLINE void nativeTwoSum( const SIMDdouble& a, const SIMDdouble& b,
+                                       SIMDdouble& s, SIMDdouble& e ) noexcept
+{
+   s = a + b;
+   const SIMDdouble bb( s - a );
+   const SIMDdouble aa( s - bb );
+   e = ( a - aa ) + ( b - bb );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Splits a vector of double precision values into two halves with 26 significant bits
+//        each (Dekker's split).
+// \ingroup simd
+//
+// \param a The vector of double precision values (\f$ |a| < 2^{995} \f$).
+// \param hi The resulting upper halves.
+// \param lo The resulting lower halves.
+// \return void
+*/
+BLAZE_ALWAYS_INLINE void nativeSplit( const SIMDdouble& a, SIMDdouble& hi, SIMDdouble& lo ) noexcept
+{
+   const SIMDdouble c( a * set( 134217729.0 ) );  // 2^27 + 1
+   hi = c - ( c - a );
+   lo = a - hi;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the product \f$ a \cdot b \f$ and its rounding error for vectors of double
+//        precision values.
+// \ingroup simd
+//
+// \param a The left-hand side factor.
+// \param b The right-hand side factor.
+// \param p The resulting rounded product.
+// \param e The resulting rounding error.
+// \return void
+*/
+BLAZE_ALWAYS_INLINE void nativeTwoProd( const SIMDdouble& a, const SIMDdouble& b,
+                                        SIMDdouble& p, SIMDdouble& e ) noexcept
+{
+   p = a * b;
+#if BLAZE_AVX512F_MODE
+   e = _mm512_fmsub_pd( a.value, b.value, p.value );
+#elif BLAZE_FMA_MODE
+   e = a * b - p;
+#else
+   SIMDdouble ah, al, bh, bl;
+   nativeSplit( a, ah, al );
+   nativeSplit( b, bh, bl );
+   e = ah * bh - p;
+   e = e + ah * bl;
+   e = e + al * bh;
+   e = e + al * bl;
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the natural logarithm of positive, finite double precision values with
+//        extended precision.
+// \ingroup simd
+//
+// \param a The vector of positive, finite double precision values.
+// \param hi The resulting leading parts of the logarithms.
+// \param lo The resulting trailing parts of the logarithms.
+// \return void
+//
+// The logarithm is computed as \f$ e \ln(2) + \ln(c) + \ln(1+g) \f$, where \f$ c \f$ is one
+// of nine table points in \f$ [\sqrt{0.5}..\sqrt{2}) \f$ and \f$ |g| < 0.046 \f$. The sum of
+// \a hi and \a lo has a relative error of approximately \f$ 2^{-64} \f$, which is required
+// for an accurate power function.
+*/
+inline void nativeLogExt( const SIMDdouble& a, SIMDdouble& hi, SIMDdouble& lo ) noexcept
+{
+   // Table points c = 1/inv with 2^((k-0.5)/8) <= m < 2^((k+0.5)/8), k = -4..4
+   static constexpr double bounds[8] = {
+      0.7384130729697497, 0.8052451659746271, 0.8781260801866497, 0.9576032806985737,
+      1.0442737824274138, 1.1387886347566916, 1.241857812073484, 1.3542555469368927 };
+   static constexpr double inv[9] = {
+      1.4140625, 1.296875, 1.1875, 1.08984375, 1.0, 0.91796875, 0.83984375, 0.76953125, 0.70703125 };
+   static constexpr double logHi[9] = {
+      -0.34646676734620857, -0.25995752443692605, -0.17185025692665923, -0.08603433734180316, 0.0,
+      0.08559193033540351, 0.17453941635189968, 0.26197371574157396, 0.3466804132137367 };
+   static constexpr double logLo[9] = {
+      -1.028583585496265E-17, -2.069806938978935E-17, 6.0224538210113705E-18, 4.235394883227454E-18, 0.0,
+      6.769872319991152E-18, -1.5833038914101321E-18, 3.769957084925505E-18, 1.2904632283500345E-17 };
+
+   const SIMDdouble one( set( 1.0 ) );
+
+   SIMDdouble f, e;
+   nativeLogReduce( a, f, e );
+
+   const SIMDdouble m( f + one );
+
+   SIMDdouble ci( set( inv[0] ) ), ch( set( logHi[0] ) ), cl( set( logLo[0] ) );
+   for( size_t k=0UL; k<8UL; ++k ) {
+      const SIMDdouble b( set( bounds[k] ) );
+      ci = nativeSelectLess( m, b, ci, set( inv[k+1UL]   ) );
+      ch = nativeSelectLess( m, b, ch, set( logHi[k+1UL] ) );
+      cl = nativeSelectLess( m, b, cl, set( logLo[k+1UL] ) );
+   }
+
+   // g = m/c - 1 = gh + gl (exact, since m/c is close to 1)
+   SIMDdouble p, pe, gh, gl;
+   nativeTwoProd( m, ci, p, pe );
+   nativeTwoSum( p - one, pe, gh, gl );
+
+   // ln(1+g) = g - g^2/2 + g^3*t(g)
+   SIMDdouble sh, sl;
+   nativeTwoProd( gh, gh, sh, sl );
+
+   SIMDdouble t( set( 1.0/15.0 ) );
+   t = t * gh + set( -1.0/14.0 );
+   t = t * gh + set(  1.0/13.0 );
+   t = t * gh + set( -1.0/12.0 );
+   t = t * gh + set(  1.0/11.0 );
+   t = t * gh + set( -1.0/10.0 );
+   t = t * gh + set(  1.0/9.0  );
+   t = t * gh + set( -1.0/8.0  );
+   t = t * gh + set(  1.0/7.0  );
+   t = t * gh + set( -1.0/6.0  );
+   t = t * gh + set(  1.0/5.0  );
+   t = t * gh + set( -1.0/4.0  );
+   t = t * gh + set(  1.0/3.0  );
+   t = t * ( sh * gh );
+
+   // Summation of the leading terms with error compensation
+   SIMDdouble s1, e1, s2, e2, s3, e3;
+   nativeTwoSum( e * set( 6.93147180369123816490E-1 ), ch, s1, e1 );
+   nativeTwoSum( s1, gh, s2, e2 );
+   nativeTwoSum( s2, sh * set( -0.5 ), s3, e3 );
+
+   SIMDdouble r( e * set( 1.90821492927058770002E-10 ) + cl );
+   r = r + gl;
+   r = r - gh * gl;
+   r = r + sl * set( -0.5 );
+   r = r + t;
+   r = r + e1;
+   r = r + e2;
+   r = r + e3;
+
+   hi = s3 + r;
+   lo = r - ( hi - s3 );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native computation of \f$ x^y \f$ for vectors of double precision values.
+// \ingroup simd
+//
+// \param x The vector of double precision base values.
+// \param y The vector of double precision exponents.
+// \return The resulting vector.
+//
+// The product \f$ y \cdot \ln|x| \f$ is computed in double-double arithmetic in order to
+// avoid the amplification of the error of the logarithm by large exponents.
+*/
+inline const SIMDdouble nativePow( const SIMDdouble& x, const SIMDdouble& y ) noexcept
+{
+   const SIMDdouble zero( set( 0.0 ) );
+   const SIMDdouble abs ( nativeAbs( x ) );
+
+   // Zero, infinite and NaN bases are handled via the regular logarithm
+   const SIMDdouble special( nativeLogFinish( abs, zero ) );
+
+   SIMDdouble lh, ll;
+   nativeLogExt( nativeSelectEqual( special, zero, abs, set( 1.0 ) ), lh, ll );
+
+   // Exponents beyond 2^64 overflow or underflow for any base except 1
+   const SIMDdouble yc( nativeClamp( y, set( -1.8446744073709552E19 ), set( 1.8446744073709552E19 ) ) );
+
+   SIMDdouble ph, pl;
+   nativeTwoProd( yc, lh, ph, pl );
+   pl = pl + yc * ll;
+
+   SIMDdouble zh( ph + pl );
+   SIMDdouble zl( pl - ( zh - ph ) );
+   zh = nativeSelectEqual( special, zero, zh, y * special );
+   zl = nativeSelectEqual( special, zero, zl, zero );
+
+   return nativePowFinish( x, y, nativeExp( zh, zl ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  32-BIT FLOATING POINT POWER FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native computation of \f$ x^y \f$ for vectors of single precision values.
+// \ingroup simd
+//
+// \param x The vector of single precision base values.
+// \param y The vector of single precision exponents.
+// \return The resulting vector.
+//
+// The computation is performed in double precision, which guarantees a correct rounding of
+// the single precision result in almost all cases.
+*/
+inline const SIMDfloat nativePow( const SIMDfloat& x, const SIMDfloat& y ) noexcept
+{
+   const SIMDdouble xlo( nativeLowToDouble( x ) );
+   const SIMDdouble ylo( nativeLowToDouble( y ) );
+   const SIMDdouble xhi( nativeHighToDouble( x ) );
+   const SIMDdouble yhi( nativeHighToDouble( y ) );
+
+   const SIMDdouble rlo( nativeExp( ylo * nativeLog( nativeAbs( xlo ) ) ) );
+   const SIMDdouble rhi( nativeExp( yhi * nativeLog( nativeAbs( xhi ) ) ) );
+
+   return nativeToFloat( nativePowFinish( xlo, ylo, rlo ), nativePowFinish( xhi, yhi, rhi ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
+
+#endif
@@ -0,0 +1,218 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/FirstTouch.h
+//  \brief Header file for the NUMA-aware SMP first-touch initialization
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_FIRSTTOUCH_H_
+#define _BLAZE_MATH_SMP_FIRSTTOUCH_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/UniformMatrix.h>
+#include <blaze/math/dense/UniformVector.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/smp/DenseMatrix.h>
+#include <blaze/math/smp/DenseVector.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/Numa.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsVectorizable.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  FIRST-TOUCH INITIALIZATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether a freshly allocated dense operand of the given size should be
+//        initialized in parallel.
+// \ingroup smp
+//
+// \param size The total number of elements of the operand.
+// \param threshold The SMP assignment threshold of the operand.
+// \return \a true in case the operand should be initialized in parallel, \a false if not.
+*/
+inline bool isFirstTouchRequired( size_t size, size_t threshold )
+{
+   return getNumaPolicy() == NumaPolicy::firstTouch &&
+          getNumThreads() > 1UL &&
+          size >= threshold &&
+          !isSerialSectionActive() &&
+          !isParallelSectionActive();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief NUMA-aware first-touch initialization of a freshly allocated dense matrix.
+// \ingroup smp
+//
+// \param dm The dense matrix to be initialized.
+// \param value The initial value of all matrix elements.
+// \return \a true in case the matrix has been initialized, \a false if not.
+//
+// On NUMA systems the operating system places every memory page on the NUMA node of the thread
+// that first writes to it. This function initializes the given dense matrix by means of a
+// parallel assignment, which uses the same partitioning of the matrix into blocks as all other
+// SMP assignments. Therefore the blocks of the matrix are placed close to the threads that will
+// later work on them. The matrix is only initialized in case the \c firstTouch NUMA policy is
+// selected (see setNumaPolicy()), more than one thread is available, the size of the matrix
+// exceeds the SMP dense matrix assignment threshold, and no serial or parallel section is
+// active. Also, only matrices with vectorizable element types are initialized. Otherwise the
+// function returns \a false and the matrix remains untouched.\n
+// This function must \b NOT be called explicitly! It is used internally by the dense matrix
+// classes. Calling this function explicitly might result in erroneous results and/or in
+// compilation errors.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline auto smpFirstTouch( DenseMatrix<MT,SO>& dm, const ElementType_t<MT>& value )
+   -> EnableIf_t< IsVectorizable_v< ElementType_t<MT> >, bool >
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( !isFirstTouchRequired( (~dm).rows() * (~dm).columns(), SMP_DMATASSIGN_THRESHOLD ) )
+      return false;
+
+   smpAssign( ~dm, UniformMatrix<ElementType_t<MT>,SO>( (~dm).rows(), (~dm).columns(), value ) );
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief First-touch initialization of a dense matrix with non-vectorizable element type.
+// \ingroup smp
+//
+// \param dm The dense matrix to be initialized.
+// \param value The initial value of all matrix elements.
+// \return \a false.
+//
+// Dense matrices with non-vectorizable element types are never initialized in parallel.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline auto smpFirstTouch( DenseMatrix<MT,SO>& dm, const ElementType_t<MT>& value )
+   -> EnableIf_t< !IsVectorizable_v< ElementType_t<MT> >, bool >
+{
+   MAYBE_UNUSED( dm, value );
+
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief NUMA-aware first-touch initialization of a freshly allocated dense vector.
+// \ingroup smp
+//
+// \param dv The dense vector to be initialized.
+// \param value The initial value of all vector elements.
+// \return \a true in case the vector has been initialized, \a false if not.
+//
+// This function initializes the given dense vector by means of a parallel assignment, which
+// places the memory pages of the vector close to the threads that will later work on them (see
+// the dense matrix overload for details). The vector is only initialized in case the \c firstTouch
+// NUMA policy is selected, more than one thread is available, the size of the vector exceeds the
+// SMP dense vector assignment threshold, no serial or parallel section is active, and the element
+// type is vectorizable. Otherwise the function returns \a false and the vector remains untouched.\n
+// This function must \b NOT be called explicitly! It is used internally by the dense vector
+// classes. Calling this function explicitly might result in erroneous results and/or in
+// compilation errors.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag of the dense vector
+inline auto smpFirstTouch( DenseVector<VT,TF>& dv, const ElementType_t<VT>& value )
+   -> EnableIf_t< IsVectorizable_v< ElementType_t<VT> >, bool >
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( !isFirstTouchRequired( (~dv).size(), SMP_DVECASSIGN_THRESHOLD ) )
+      return false;
+
+   smpAssign( ~dv, UniformVector<ElementType_t<VT>,TF>( (~dv).size(), value ) );
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief First-touch initialization of a dense vector with non-vectorizable element type.
+// \ingroup smp
+//
+// \param dv The dense vector to be initialized.
+// \param value The initial value of all vector elements.
+// \return \a false.
+//
+// Dense vectors with non-vectorizable element types are never initialized in parallel.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag of the dense vector
+inline auto smpFirstTouch( DenseVector<VT,TF>& dv, const ElementType_t<VT>& value )
+   -> EnableIf_t< !IsVectorizable_v< ElementType_t<VT> >, bool >
+{
+   MAYBE_UNUSED( dv, value );
+
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,703 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/Fused.h
+//  \brief Header file for the fused evaluation of several dense vector statements
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_FUSED_H_
+#define _BLAZE_MATH_SMP_FUSED_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/DenseVector.h>
+#include <blaze/math/constraints/RequiresEvaluation.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/DVecReduceExpr.h>
+#include <blaze/math/functors/Add.h>
+#include <blaze/math/functors/AddAssign.h>
+#include <blaze/math/functors/Assign.h>
+#include <blaze/math/functors/DivAssign.h>
+#include <blaze/math/functors/MultAssign.h>
+#include <blaze/math/functors/SubAssign.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/smp/ParallelReduce.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/mpl/Bools.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsBaseOf.h>
+#include <blaze/util/typetraits/IsSame.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS FUSEDSTATEMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Base class for all statements of a fused evaluation.
+// \ingroup smp
+//
+// The FusedStatement class is the base class of all statements that can be passed to the
+// fused() function. Each statement provides the following interface, which is used to evaluate
+// the statement block by block:
+//
+//  - \c size(): returns the number of elements of the operands of the statement
+//  - \c canSMPAssign(): returns whether the statement may be evaluated in parallel
+//  - \c prepare(blocks): prepares the statement for the evaluation of the given number of blocks
+//  - \c apply(block,begin,end): evaluates the statement for the index range \f$ [begin..end) \f$
+//  - \c finalize(): completes the evaluation after all blocks have been processed
+*/
+struct FusedStatement
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS FUSEDASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Deferred (compound) assignment to a dense vector within a fused evaluation.
+// \ingroup smp
+//
+// The FusedAssignment class represents a single (compound) assignment to a dense vector that
+// is not evaluated immediately, but as part of a fused evaluation (see the fused() function).
+// Instances of this class are created via the deferred() function:
+
+   \code
+   blaze::DynamicVector<double> x, p;
+   // ... Resizing and initialization
+
+   auto s = ( blaze::deferred( x ) += 2.0 * p );  // Not yet evaluated
+   blaze::fused( s );                            // Evaluation of the statement
+   \endcode
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename VT2   // Type of the right-hand side dense vector
+        , typename OP >  // Type of the assignment operation
+class FusedAssignment
+   : public FusedStatement
+{
+ private:
+   //**Type definitions****************************************************************************
+   //! Composite type of the right-hand side dense vector.
+   using RightOperand = If_t< IsExpression_v<VT2>, const VT2, const VT2& >;
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the FusedAssignment class.
+   //
+   // \param lhs The target dense vector.
+   // \param rhs The right-hand side dense vector.
+   // \exception std::invalid_argument Vector sizes do not match.
+   */
+   inline FusedAssignment( VT1& lhs, const VT2& rhs )
+      : lhs_( lhs )  // The target dense vector
+      , rhs_( rhs )  // The right-hand side dense vector
+   {
+      if( lhs_.size() != rhs_.size() ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+      }
+   }
+   //**********************************************************************************************
+
+   //**Size function*******************************************************************************
+   /*!\brief Returns the number of elements of the operands of the statement.
+   //
+   // \return The size of the target dense vector.
+   */
+   inline size_t size() const noexcept {
+      return lhs_.size();
+   }
+   //**********************************************************************************************
+
+   //**CanSMPAssign function***********************************************************************
+   /*!\brief Returns whether the statement can be evaluated in parallel.
+   //
+   // \return \a true in case the statement can be evaluated in parallel, \a false if not.
+   */
+   inline bool canSMPAssign() const noexcept {
+      return canSMPReduce( lhs_ ) && canSMPReduce( rhs_ );
+   }
+   //**********************************************************************************************
+
+   //**Prepare function****************************************************************************
+   /*!\brief Prepares the statement for the evaluation of the given number of blocks.
+   //
+   // \param blocks The total number of blocks.
+   // \return void
+   */
+   inline void prepare( size_t blocks ) {
+      MAYBE_UNUSED( blocks );
+   }
+   //**********************************************************************************************
+
+   //**Apply function******************************************************************************
+   /*!\brief Evaluates the statement for the given index range.
+   //
+   // \param block The index of the block.
+   // \param begin The first index of the block.
+   // \param end The index one past the last index of the block.
+   // \return void
+   */
+   inline void apply( size_t block, size_t begin, size_t end ) {
+      MAYBE_UNUSED( block );
+      BLAZE_INTERNAL_ASSERT( begin < end && end <= size(), "Invalid index range" );
+      auto target( subvector( lhs_, begin, end-begin, unchecked ) );
+      apply( target, subvector( rhs_, begin, end-begin, unchecked ), OP() );
+   }
+   //**********************************************************************************************
+
+   //**Finalize function***************************************************************************
+   /*!\brief Completes the evaluation of the statement.
+   //
+   // \return void
+   */
+   inline void finalize() {}
+   //**********************************************************************************************
+
+ private:
+   //**Apply functions*****************************************************************************
+   /*!\name Apply functions */
+   //@{
+   template< typename VT3, typename VT4 >
+   static inline void apply( VT3& lhs, const VT4& rhs, Assign ) { assign( lhs, rhs ); }
+
+   template< typename VT3, typename VT4 >
+   static inline void apply( VT3& lhs, const VT4& rhs, AddAssign ) { addAssign( lhs, rhs ); }
+
+   template< typename VT3, typename VT4 >
+   static inline void apply( VT3& lhs, const VT4& rhs, SubAssign ) { subAssign( lhs, rhs ); }
+
+   template< typename VT3, typename VT4 >
+   static inline void apply( VT3& lhs, const VT4& rhs, MultAssign ) { multAssign( lhs, rhs ); }
+
+   template< typename VT3, typename VT4 >
+   static inline void apply( VT3& lhs, const VT4& rhs, DivAssign ) { divAssign( lhs, rhs ); }
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   VT1&         lhs_;  //!< The target dense vector.
+   RightOperand rhs_;  //!< The right-hand side dense vector.
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( VT1 );
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( VT2 );
+   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( VT2 );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS FUSEDREDUCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Deferred total reduction of a dense vector within a fused evaluation.
+// \ingroup smp
+//
+// The FusedReduction class represents the total reduction of a dense vector into a scalar
+// that is not evaluated immediately, but as part of a fused evaluation (see the fused()
+// function). Instances of this class are created via the reduceTo() function. The partial
+// results of all blocks are combined in a pairwise tree (see smpReduce()), i.e. the result
+// does not depend on the number of threads.
+*/
+template< typename T     // Type of the target scalar
+        , typename VT    // Type of the reduced dense vector
+        , typename OP >  // Type of the reduction operation
+class FusedReduction
+   : public FusedStatement
+{
+ private:
+   //**Type definitions****************************************************************************
+   using ET = ElementType_t<VT>;  //!< Element type of the reduced dense vector.
+
+   //! Composite type of the reduced dense vector.
+   using Operand = If_t< IsExpression_v<VT>, const VT, const VT& >;
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the FusedReduction class.
+   //
+   // \param result The target scalar.
+   // \param dv The dense vector to be reduced.
+   // \param op The reduction operation.
+   */
+   inline FusedReduction( T& result, const VT& dv, OP op )
+      : result_  ( result )  // The target scalar
+      , dv_      ( dv )      // The dense vector to be reduced
+      , op_      ( op )      // The reduction operation
+      , partials_()          // The partial results of all blocks
+   {}
+   //**********************************************************************************************
+
+   //**Size function*******************************************************************************
+   /*!\brief Returns the number of elements of the operands of the statement.
+   //
+   // \return The size of the reduced dense vector.
+   */
+   inline size_t size() const noexcept {
+      return dv_.size();
+   }
+   //**********************************************************************************************
+
+   //**CanSMPAssign function***********************************************************************
+   /*!\brief Returns whether the statement can be evaluated in parallel.
+   //
+   // \return \a true in case the statement can be evaluated in parallel, \a false if not.
+   */
+   inline bool canSMPAssign() const noexcept {
+      return canSMPReduce( dv_ );
+   }
+   //**********************************************************************************************
+
+   //**Prepare function****************************************************************************
+   /*!\brief Prepares the statement for the evaluation of the given number of blocks.
+   //
+   // \param blocks The total number of blocks.
+   // \return void
+   */
+   inline void prepare( size_t blocks ) {
+      partials_.resize( blocks );
+   }
+   //**********************************************************************************************
+
+   //**Apply function******************************************************************************
+   /*!\brief Evaluates the statement for the given index range.
+   //
+   // \param block The index of the block.
+   // \param begin The first index of the block.
+   // \param end The index one past the last index of the block.
+   // \return void
+   */
+   inline void apply( size_t block, size_t begin, size_t end ) {
+      BLAZE_INTERNAL_ASSERT( block < partials_.size(), "Invalid block index" );
+      BLAZE_INTERNAL_ASSERT( begin < end && end <= size(), "Invalid index range" );
+      partials_[block] = dvecreduce( dv_, begin, end, op_ );
+   }
+   //**********************************************************************************************
+
+   //**Finalize function***************************************************************************
+   /*!\brief Combines the partial results of all blocks and stores the result in the target.
+   //
+   // \return void
+   */
+   inline void finalize() {
+      const size_t blocks( partials_.size() );
+
+      if( blocks == 0UL ) {
+         result_ = ET{};
+         return;
+      }
+
+      for( size_t stride=1UL; stride<blocks; stride*=2UL ) {
+         for( size_t b=0UL; b+stride<blocks; b+=2UL*stride ) {
+            partials_[b] = op_( partials_[b], partials_[b+stride] );
+         }
+      }
+
+      result_ = partials_[0UL];
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   T&              result_;    //!< The target scalar.
+   Operand         dv_;        //!< The dense vector to be reduced.
+   OP              op_;        //!< The reduction operation.
+   std::vector<ET> partials_;  //!< The partial results of all blocks.
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( VT );
+   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( VT );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS FUSEDTARGET
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Proxy for the creation of deferred assignments to a dense vector.
+// \ingroup smp
+//
+// The FusedTarget class is returned by the deferred() function. Its (compound) assignment
+// operators do not modify the target vector, but create a FusedAssignment, which is evaluated
+// as part of a fused evaluation (see the fused() function).
+*/
+template< typename VT  // Type of the target dense vector
+        , bool TF >    // Transpose flag
+class FusedTarget
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the FusedTarget class.
+   //
+   // \param dv The target dense vector.
+   */
+   explicit inline FusedTarget( VT& dv ) noexcept
+      : dv_( dv )  // The target dense vector
+   {}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   template< typename VT2 >
+   inline FusedAssignment<VT,VT2,Assign> operator=( const DenseVector<VT2,TF>& rhs ) const {
+      return FusedAssignment<VT,VT2,Assign>( dv_, ~rhs );
+   }
+
+   template< typename VT2 >
+   inline FusedAssignment<VT,VT2,AddAssign> operator+=( const DenseVector<VT2,TF>& rhs ) const {
+      return FusedAssignment<VT,VT2,AddAssign>( dv_, ~rhs );
+   }
+
+   template< typename VT2 >
+   inline FusedAssignment<VT,VT2,SubAssign> operator-=( const DenseVector<VT2,TF>& rhs ) const {
+      return FusedAssignment<VT,VT2,SubAssign>( dv_, ~rhs );
+   }
+
+   template< typename VT2 >
+   inline FusedAssignment<VT,VT2,MultAssign> operator*=( const DenseVector<VT2,TF>& rhs ) const {
+      return FusedAssignment<VT,VT2,MultAssign>( dv_, ~rhs );
+   }
+
+   template< typename VT2 >
+   inline FusedAssignment<VT,VT2,DivAssign> operator/=( const DenseVector<VT2,TF>& rhs ) const {
+      return FusedAssignment<VT,VT2,DivAssign>( dv_, ~rhs );
+   }
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   VT& dv_;  //!< The target dense vector.
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Fused evaluation functions */
+//@{
+template< typename VT, bool TF >
+FusedTarget<VT,TF> deferred( DenseVector<VT,TF>& dv ) noexcept;
+
+template< typename T, typename VT, bool TF >
+FusedReduction<T,VT,Add> reduceTo( T& result, const DenseVector<VT,TF>& dv );
+
+template< typename T, typename VT, bool TF, typename OP >
+FusedReduction<T,VT,OP> reduceTo( T& result, const DenseVector<VT,TF>& dv, OP op );
+
+template< typename ST, typename... STs >
+void fused( ST statement, STs... statements );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Marks the given dense vector as the target of a deferred (compound) assignment.
+// \ingroup smp
+//
+// \param dv The target dense vector.
+// \return Proxy for the creation of deferred assignments to the given vector.
+//
+// This function returns a proxy for the given dense vector, whose assignment, addition
+// assignment, subtraction assignment, multiplication assignment and division assignment
+// operators do not modify the vector, but return a statement for a fused evaluation (see
+// the fused() function). Note that the statement does not resize the target vector, i.e. the
+// target and the right-hand side vector are required to have the same size. Otherwise a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename VT  // Type of the target dense vector
+        , bool TF >    // Transpose flag
+inline FusedTarget<VT,TF> deferred( DenseVector<VT,TF>& dv ) noexcept
+{
+   return FusedTarget<VT,TF>( ~dv );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a deferred summation of the elements of the given dense vector.
+// \ingroup smp
+//
+// \param result The target scalar for the sum of all elements.
+// \param dv The dense vector to be reduced.
+// \return Statement for a fused evaluation.
+//
+// This function returns a statement that computes the sum of all elements of the given dense
+// vector as part of a fused evaluation (see the fused() function) and stores it in \a result.
+// As for instance the following example demonstrates, the function can be combined with an
+// elementwise multiplication to compute the inner product of two vectors:
+
+   \code
+   blaze::DynamicVector<double> r;
+   double rr{};
+   // ... Resizing and initialization
+
+   blaze::fused( blaze::reduceTo( rr, r * r ) );  // Equivalent to rr = sum( r * r );
+   \endcode
+*/
+template< typename T   // Type of the target scalar
+        , typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline FusedReduction<T,VT,Add> reduceTo( T& result, const DenseVector<VT,TF>& dv )
+{
+   return FusedReduction<T,VT,Add>( result, ~dv, Add() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a deferred reduction of the elements of the given dense vector.
+// \ingroup smp
+//
+// \param result The target scalar for the result of the reduction.
+// \param dv The dense vector to be reduced.
+// \param op The reduction operation.
+// \return Statement for a fused evaluation.
+//
+// This function returns a statement that reduces the elements of the given dense vector by
+// means of the given reduction operation as part of a fused evaluation (see the fused()
+// function) and stores the result in \a result. Since the reduction is performed block by
+// block, the reduction operation is required to be associative (see the reduce() function).
+// In case the vector is empty, \a result is set to the default value of the element type.
+*/
+template< typename T     // Type of the target scalar
+        , typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the reduction operation
+inline FusedReduction<T,VT,OP> reduceTo( T& result, const DenseVector<VT,TF>& dv, OP op )
+{
+   return FusedReduction<T,VT,OP>( result, ~dv, op );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Terminating auxiliary function for the fused evaluation of a single block.
+// \ingroup smp
+//
+// \param block The index of the block.
+// \param begin The first index of the block.
+// \param end The index one past the last index of the block.
+// \return void
+*/
+inline void fusedApply( size_t block, size_t begin, size_t end )
+{
+   MAYBE_UNUSED( block, begin, end );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary function for the fused evaluation of a single block.
+// \ingroup smp
+//
+// \param block The index of the block.
+// \param begin The first index of the block.
+// \param end The index one past the last index of the block.
+// \param statement The first statement to be evaluated.
+// \param statements The remaining statements to be evaluated.
+// \return void
+//
+// This function evaluates all given statements for the index range \f$ [begin..end) \f$ in
+// the given order.
+*/
+template< typename ST         // Type of the first statement
+        , typename... STs >   // Types of the remaining statements
+inline void fusedApply( size_t block, size_t begin, size_t end, ST& statement, STs&... statements )
+{
+   statement.apply( block, begin, end );
+   fusedApply( block, begin, end, statements... );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Fused evaluation of several dense vector statements.
+// \ingroup smp
+//
+// \param statement The first statement to be evaluated.
+// \param statements The remaining statements to be evaluated.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function evaluates the given deferred assignments (see deferred()) and reductions (see
+// reduceTo()) in a single pass over the operands. For that purpose the index range of the
+// vectors is split into blocks of fixed size (see REDUCTION_BLOCK_SIZE) and all statements are
+// evaluated for one block before the next block is processed. Thus the operands of a block are
+// still in cache when the next statement accesses them. In case shared memory parallelization
+// is active and all operands are sufficiently large, the blocks are distributed among the
+// threads by a single parallel loop, i.e. all statements are evaluated with a single barrier.
+// Within each block the statements are evaluated by the usual (vectorized) kernels.
+//
+// The following example demonstrates the fused evaluation of the updates of a conjugate
+// gradient iteration:
+
+   \code
+   blaze::DynamicVector<double> x, r, p, q;
+   double alpha{}, rr{};
+   // ... Resizing and initialization
+
+   // Equivalent to x += alpha*p; r -= alpha*q; rr = sum( r*r );
+   blaze::fused( blaze::deferred( x ) += alpha * p,
+                 blaze::deferred( r ) -= alpha * q,
+                 blaze::reduceTo( rr, r * r ) );
+   \endcode
+
+// The operands of all statements are required to have the same size. Otherwise a
+// \a std::invalid_argument exception is thrown and none of the statements is evaluated. Since
+// every statement is evaluated for one block at a time, a statement must only access the
+// elements of the targets of previous statements (and its own target) at the same index, as
+// for instance \c r*r accesses \c r in the example above. Operations that require an evaluation
+// of the entire operand (as for instance matrix/vector multiplications) are rejected at compile
+// time, operations that access elements at different indices (as for instance reversed or
+// shifted views of a target) result in undefined behavior. Note that results of reductions do
+// not depend on the number of threads.
+*/
+template< typename ST         // Type of the first statement
+        , typename... STs >   // Types of the remaining statements
+void fused( ST statement, STs... statements )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_STATIC_ASSERT_MSG( ( IsSame_v< Bools< true, IsBaseOf_v<FusedStatement,ST>, IsBaseOf_v<FusedStatement,STs>... >
+                                      , Bools< IsBaseOf_v<FusedStatement,ST>, IsBaseOf_v<FusedStatement,STs>..., true > > )
+                          , "Invalid fused statement detected" );
+
+   const size_t N( statement.size() );
+
+   const size_t sizes[] = { N, statements.size()... };
+
+   for( size_t size : sizes ) {
+      if( size != N ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+      }
+   }
+
+   const size_t blocks( ( N + REDUCTION_BLOCK_SIZE - 1UL ) / REDUCTION_BLOCK_SIZE );
+
+   const bool parallel[] = { statement.canSMPAssign(), statements.canSMPAssign()... };
+
+   bool smp( blocks > 1UL && !isParallelSectionActive() );
+
+   for( bool flag : parallel ) {
+      smp = smp && flag;
+   }
+
+   statement.prepare( blocks );
+   const int prepared[] = { ( statements.prepare( blocks ), 0 )... , 0 };
+   MAYBE_UNUSED( prepared );
+
+   const auto kernel = [N,&statement,&statements...]( size_t begin, size_t end )
+   {
+      for( size_t b=begin; b<end; ++b ) {
+         const size_t ibegin( b*REDUCTION_BLOCK_SIZE );
+         const size_t iend  ( min( ibegin+REDUCTION_BLOCK_SIZE, N ) );
+         fusedApply( b, ibegin, iend, statement, statements... );
+      }
+   };
+
+   if( smp ) {
+      smpFor( blocks, kernel );
+   }
+   else {
+      kernel( 0UL, blocks );
+   }
+
+   statement.finalize();
+   const int finalized[] = { ( statements.finalize(), 0 )... , 0 };
+   MAYBE_UNUSED( finalized );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,160 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/ParallelReduce.h
+//  \brief Header file for the deterministic SMP reduction functionality
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_PARALLELREDUCE_H_
+#define _BLAZE_MATH_SMP_PARALLELREDUCE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  PARALLEL REDUCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the given SMP assignable operand can be reduced in parallel.
+// \ingroup smp
+//
+// \param operand The operand of the reduction.
+// \return \a true in case the operand can be reduced in parallel, \a false if not.
+*/
+template< typename T >  // Type of the operand
+inline auto canSMPReduce( const T& operand ) noexcept
+   -> EnableIf_t< IsSMPAssignable_v<T>, bool >
+{
+   return operand.canSMPAssign();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the given non-SMP assignable operand can be reduced in parallel.
+// \ingroup smp
+//
+// \param operand The operand of the reduction.
+// \return \a false.
+*/
+template< typename T >  // Type of the operand
+inline auto canSMPReduce( const T& operand ) noexcept
+   -> DisableIf_t< IsSMPAssignable_v<T>, bool >
+{
+   MAYBE_UNUSED( operand );
+
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Deterministic SMP reduction of a sequence of blocks.
+// \ingroup smp
+//
+// \param blocks The total number of blocks \f$[1..\infty)\f$.
+// \param parallel \a true in case the blocks may be reduced in parallel, \a false if not.
+// \param op The operation computing the partial result of a single block.
+// \param combine The operation combining two partial results.
+// \return The combined result of all blocks.
+//
+// This function computes the partial results of the blocks \f$ [0..blocks) \f$ by means of the
+// given operation \a op and combines them by means of the given operation \a combine. In case
+// \a parallel is \a true, the blocks are distributed among the threads of the active SMP backend
+// (see smpFor()). The partial results are combined in a pairwise tree that only depends on the
+// number of blocks, i.e. the result is the same for any number of threads and even for a serial
+// execution. Inside of parallel sections the blocks are processed by the calling thread.\n
+// Since the blocks may be processed within an OpenMP parallel region or by the threads of the
+// thread backend, the given operations must not throw any exception.\n
+// This function must \b NOT be called explicitly! It is used internally for the parallel
+// execution of total reductions.
+*/
+template< typename T     // Type of the partial results
+        , typename OP    // Type of the block operation
+        , typename CO >  // Type of the combine operation
+T smpReduce( size_t blocks, bool parallel, OP op, CO combine )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( blocks > 0UL, "Invalid number of blocks" );
+
+   std::vector<T> partials( blocks );
+
+   const auto kernel = [&partials,&op]( size_t begin, size_t end )
+   {
+      for( size_t b=begin; b<end; ++b ) {
+         partials[b] = op( b );
+      }
+   };
+
+   if( parallel && blocks > 1UL && !isParallelSectionActive() ) {
+      smpFor( blocks, kernel );
+   }
+   else {
+      kernel( 0UL, blocks );
+   }
+
+   for( size_t stride=1UL; stride<blocks; stride*=2UL ) {
+      for( size_t b=0UL; b+stride<blocks; b+=2UL*stride ) {
+         partials[b] = combine( partials[b], partials[b+stride] );
+      }
+   }
+
+   return partials[0UL];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
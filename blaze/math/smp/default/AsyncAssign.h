@@ -0,0 +1,295 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/default/AsyncAssign.h
+//  \brief Header file with the default implementation of the asynchronous assignment
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_DEFAULT_ASYNCASSIGN_H_
+#define _BLAZE_MATH_SMP_DEFAULT_ASYNCASSIGN_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/util/FunctionTrace.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Handle for an asynchronous SMP assignment.
+// \ingroup smp
+//
+// The AsyncAssignment class represents the result of an asynchronous assignment (see for
+// instance the asyncAssign() function). In case neither the C++11 nor the Boost thread-based
+// parallelization is active, all asynchronous assignments are executed immediately and the
+// handle represents an already completed assignment.
+*/
+class AsyncAssignment
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   AsyncAssignment() = default;
+   AsyncAssignment( AsyncAssignment&& ) = default;
+   AsyncAssignment( const AsyncAssignment& ) = delete;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~AsyncAssignment() {}
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   AsyncAssignment& operator=( AsyncAssignment&& ) = default;
+   AsyncAssignment& operator=( const AsyncAssignment& ) = delete;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline constexpr bool ready() const noexcept { return true; }
+   inline void wait() const noexcept {}
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASYNCHRONOUS ASSIGNMENT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Asynchronous assignment functions */
+//@{
+template< typename VT1, bool TF, typename VT2 >
+AsyncAssignment asyncAssign( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs );
+
+template< typename VT1, bool TF, typename VT2 >
+AsyncAssignment asyncAddAssign( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs );
+
+template< typename VT1, bool TF, typename VT2 >
+AsyncAssignment asyncSubAssign( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2 >
+AsyncAssignment asyncAssign( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2 >
+AsyncAssignment asyncAddAssign( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2 >
+AsyncAssignment asyncSubAssign( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the asynchronous assignment of a dense vector to a dense
+//        vector (\f$ \vec{a}=\vec{b} \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side dense vector to be assigned.
+// \return A handle for the already completed assignment.
+// \exception std::invalid_argument Vector cannot be resized.
+//
+// This function implements the default asynchronous assignment, which performs the assignment
+// immediately.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , bool TF         // Transpose flag of both dense vectors
+        , typename VT2 >  // Type of the right-hand side dense vector
+inline AsyncAssignment asyncAssign( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   (~lhs) = ~rhs;
+   return AsyncAssignment();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the asynchronous addition assignment of a dense vector to
+//        a dense vector (\f$ \vec{a}+=\vec{b} \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side dense vector to be added.
+// \return A handle for the already completed assignment.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function implements the default asynchronous addition assignment, which performs the
+// addition assignment immediately.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , bool TF         // Transpose flag of both dense vectors
+        , typename VT2 >  // Type of the right-hand side dense vector
+inline AsyncAssignment asyncAddAssign( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   (~lhs) += ~rhs;
+   return AsyncAssignment();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the asynchronous subtraction assignment of a dense vector
+//        to a dense vector (\f$ \vec{a}-=\vec{b} \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side dense vector to be subtracted.
+// \return A handle for the already completed assignment.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function implements the default asynchronous subtraction assignment, which performs
+// the subtraction assignment immediately.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , bool TF         // Transpose flag of both dense vectors
+        , typename VT2 >  // Type of the right-hand side dense vector
+inline AsyncAssignment asyncSubAssign( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   (~lhs) -= ~rhs;
+   return AsyncAssignment();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the asynchronous assignment of a dense matrix to a dense
+//        matrix (\f$ A=B \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense matrix.
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return A handle for the already completed assignment.
+// \exception std::invalid_argument Matrix cannot be resized.
+//
+// This function implements the default asynchronous assignment, which performs the assignment
+// immediately.
+*/
+template< typename MT1  // Type of the left-hand side dense matrix
+        , bool SO1      // Storage order of the left-hand side dense matrix
+        , typename MT2  // Type of the right-hand side dense matrix
+        , bool SO2 >    // Storage order of the right-hand side dense matrix
+inline AsyncAssignment asyncAssign( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   (~lhs) = ~rhs;
+   return AsyncAssignment();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the asynchronous addition assignment of a dense matrix to
+//        a dense matrix (\f$ A+=B \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense matrix.
+// \param rhs The right-hand side dense matrix to be added.
+// \return A handle for the already completed assignment.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function implements the default asynchronous addition assignment, which performs the
+// addition assignment immediately.
+*/
+template< typename MT1  // Type of the left-hand side dense matrix
+        , bool SO1      // Storage order of the left-hand side dense matrix
+        , typename MT2  // Type of the right-hand side dense matrix
+        , bool SO2 >    // Storage order of the right-hand side dense matrix
+inline AsyncAssignment asyncAddAssign( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   (~lhs) += ~rhs;
+   return AsyncAssignment();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the asynchronous subtraction assignment of a dense matrix
+//        to a dense matrix (\f$ A-=B \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense matrix.
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return A handle for the already completed assignment.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function implements the default asynchronous subtraction assignment, which performs
+// the subtraction assignment immediately.
+*/
+template< typename MT1  // Type of the left-hand side dense matrix
+        , bool SO1      // Storage order of the left-hand side dense matrix
+        , typename MT2  // Type of the right-hand side dense matrix
+        , bool SO2 >    // Storage order of the right-hand side dense matrix
+inline AsyncAssignment asyncSubAssign( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   (~lhs) -= ~rhs;
+   return AsyncAssignment();
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -44,6 +44,7 @@
 #include <blaze/system/SMP.h>
 #include <blaze/util/MaybeUnused.h>
 #include <blaze/util/StaticAssert.h>
+#include <blaze/util/ThreadAffinity.h>
 #include <blaze/util/Types.h>
 
 
@@ -58,9 +59,11 @@ namespace blaze {
 //*************************************************************************************************
 /*!\name SMP utility functions */
 //@{
-BLAZE_ALWAYS_INLINE size_t getNumThreads  ();
-BLAZE_ALWAYS_INLINE void   setNumThreads  ( size_t number );
-BLAZE_ALWAYS_INLINE void   shutDownThreads();
+BLAZE_ALWAYS_INLINE size_t         getNumThreads    ();
+BLAZE_ALWAYS_INLINE void           setNumThreads    ( size_t number );
+BLAZE_ALWAYS_INLINE ThreadAffinity getThreadAffinity();
+BLAZE_ALWAYS_INLINE void           setThreadAffinity( const ThreadAffinity& affinity );
+BLAZE_ALWAYS_INLINE void           shutDownThreads  ();
 //@}
 //*************************************************************************************************
 
@@ -101,6 +104,39 @@ BLAZE_ALWAYS_INLINE void setNumThreads( size_t number )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Returns the thread affinity used for thread parallel operations.
+// \ingroup smp
+//
+// \return The thread affinity used for thread parallel operations.
+//
+// Note that in case no parallelization is active the function will always return an affinity
+// that doesn't pin any thread.
+*/
+BLAZE_ALWAYS_INLINE ThreadAffinity getThreadAffinity()
+{
+   return ThreadAffinity();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Sets the thread affinity to be used for thread parallel operations.
+// \ingroup smp
+//
+// \param affinity The new thread affinity.
+// \return void
+//
+// Via this function the threads used for thread parallel operations can be pinned to specific
+// CPUs. Note that in case no parallelization is active, the function has no effect.
+*/
+BLAZE_ALWAYS_INLINE void setThreadAffinity( const ThreadAffinity& affinity )
+{
+   MAYBE_UNUSED( affinity );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Provides a reliable shutdown of C++11 threads for Visual Studio compilers.
 // \ingroup smp
@@ -40,15 +40,168 @@
 // Includes
 //*************************************************************************************************
 
+#include <vector>
 #include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/sparse/Forward.h>
 #include <blaze/math/typetraits/IsSparseMatrix.h>
+#include <blaze/math/views/Check.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Min.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Types.h>
 
 
 namespace blaze {
 
+//=================================================================================================
+//
+//  BLOCK-WISE ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Serial fallback of the block-wise assignment of a matrix to a sparse matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side matrix to be assigned.
+// \return void
+//
+// This function implements the assignment to all sparse matrices for which no block-wise
+// parallel assignment is available.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , bool SO1      // Storage order of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline void blockAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   assign( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Block-wise parallel assignment of a sparse matrix to a compressed matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side compressed matrix.
+// \param rhs The right-hand side sparse matrix to be assigned.
+// \return void
+//
+// This function implements the parallel assignment of a sparse matrix or sparse matrix expression
+// to a compressed matrix. The rows (in case of a row-major target) or columns (in case of a
+// column-major target) are split into one contiguous block per thread and the corresponding
+// submatrix of the right-hand side operand is evaluated into a thread-local compressed matrix.
+// Based on the resulting exact number of non-zero elements per row/column the storage of the
+// target matrix is allocated at once, after which all blocks are copied concurrently into
+// their disjoint ranges of the target matrix. In case a serial or parallel section is active,
+// in case only a single thread is available, or in case the right-hand side operand contains
+// less non-zero elements than specified by the SMP_SMATASSIGN_THRESHOLD, the assignment is
+// performed single-threaded.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the left-hand side compressed matrix
+        , bool SO1       // Storage order of the left-hand side compressed matrix
+        , typename MT2   // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline auto blockAssign( CompressedMatrix<Type,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+   -> EnableIf_t< IsSparseMatrix_v<MT2> >
+{
+   BLAZE_FUNCTION_TRACE;
+
+   const size_t m( (~rhs).rows()    );
+   const size_t n( (~rhs).columns() );
+
+   // Number of rows (row-major target) or columns (column-major target) to be distributed
+   const size_t size( SO1 ? n : m );
+
+   const size_t threads( min( getNumThreads(), size ) );
+
+   if( isSerialSectionActive() || isParallelSectionActive() || threads < 2UL ||
+       (~rhs).nonZeros() < SMP_SMATASSIGN_THRESHOLD ) {
+      assign( lhs, ~rhs );
+      return;
+   }
+
+   const size_t addon       ( ( ( size % threads ) != 0UL )? 1UL : 0UL );
+   const size_t sizePerBlock( size / threads + addon );
+   const size_t blocks      ( ( size + sizePerBlock - 1UL ) / sizePerBlock );
+
+   std::vector< CompressedMatrix<Type,SO1> > parts( blocks );
+   std::vector<size_t> nonzeros( size );
+
+   // Evaluating the blocks of the right-hand side operand into thread-local matrices
+   smpFor( blocks, [&]( size_t begin, size_t end )
+   {
+      for( size_t b=begin; b<end; ++b )
+      {
+         const size_t first( b*sizePerBlock );
+         const size_t last ( min( first+sizePerBlock, size ) );
+
+         const size_t row   ( SO1 ? 0UL : first );
+         const size_t column( SO1 ? first : 0UL );
+
+         const auto block( submatrix( ~rhs, row, column, ( SO1 ? m : last-first ),
+                                      ( SO1 ? last-first : n ), unchecked ) );
+
+         CompressedMatrix<Type,SO1>& part( parts[b] );
+         part.resize( block.rows(), block.columns(), false );
+         part.reserve( block.nonZeros() );
+         assign( part, block );
+
+         for( size_t k=first; k<last; ++k ) {
+            nonzeros[k] = part.nonZeros( k-first );
+         }
+      }
+   } );
+
+   // Allocating the exact storage and copying the blocks into their disjoint ranges
+   CompressedMatrix<Type,SO1> tmp( m, n, nonzeros );
+
+   smpFor( blocks, [&]( size_t begin, size_t end )
+   {
+      for( size_t b=begin; b<end; ++b )
+      {
+         const size_t first( b*sizePerBlock );
+         const CompressedMatrix<Type,SO1>& part( parts[b] );
+
+         for( size_t k=0UL; k<( SO1 ? part.columns() : part.rows() ); ++k ) {
+            for( auto element=part.begin(k); element!=part.end(k); ++element ) {
+               if( SO1 ) tmp.append( element->index(), first+k, element->value() );
+               else      tmp.append( first+k, element->index(), element->value() );
+            }
+         }
+      }
+   } );
+
+   lhs.swap( tmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  GLOBAL FUNCTIONS
@@ -85,7 +238,10 @@ auto smpSchurAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
 // \param rhs The right-hand side matrix to be assigned.
 // \return void
 //
-// This function implements the default SMP assignment of a matrix to a sparse matrix.\n
+// This function implements the default SMP assignment of a matrix to a sparse matrix. In case
+// the target is a compressed matrix and the right-hand side operand is a sparse matrix, the
+// assignment is performed block-wise by all threads of the active shared memory parallelization
+// (see the BLAZE_SMP_SMATASSIGN_THRESHOLD configuration).\n
 // This function must \b NOT be called explicitly! It is used internally for the performance
 // optimized evaluation of expression templates. Calling this function explicitly might result
 // in erroneous results and/or in compilation errors. Instead of using this function use the
@@ -103,7 +259,7 @@ inline auto smpAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
    BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
 
-   assign( ~lhs, ~rhs );
+   blockAssign( ~lhs, ~rhs );
 }
 //*************************************************************************************************
 
@@ -45,7 +45,9 @@
 #include <blaze/math/Exception.h>
 #include <blaze/system/Inline.h>
 #include <blaze/system/SMP.h>
+#include <blaze/util/MaybeUnused.h>
 #include <blaze/util/StaticAssert.h>
+#include <blaze/util/ThreadAffinity.h>
 #include <blaze/util/Types.h>
 
 
@@ -76,6 +78,43 @@ BLAZE_ALWAYS_INLINE size_t getNumThreads()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the thread affinity used for HPX parallel operations.
+// \ingroup smp
+//
+// \return An affinity that doesn't pin any thread.
+//
+// The binding of the HPX worker threads is controlled by the HPX runtime (see the \c --hpx:bind
+// command line option). Therefore this function always returns an affinity without pinning.
+*/
+BLAZE_ALWAYS_INLINE ThreadAffinity getThreadAffinity()
+{
+   return ThreadAffinity();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Sets the thread affinity to be used for HPX parallel operations.
+// \ingroup smp
+//
+// \param affinity The new thread affinity.
+// \return void
+//
+// The binding of the HPX worker threads is controlled by the HPX runtime (see the \c --hpx:bind
+// command line option). Therefore this function has no effect.
+*/
+BLAZE_ALWAYS_INLINE void setThreadAffinity( const ThreadAffinity& affinity )
+{
+   MAYBE_UNUSED( affinity );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Provides a reliable shutdown of C++11 threads for Visual Studio compilers.
@@ -60,6 +60,7 @@
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
+#include <blaze/util/KernelProfile.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Types.h>
 
@@ -83,7 +84,9 @@ namespace blaze {
 // \return void
 //
 // This function is the backend implementation of the OpenMP-based SMP assignment of a dense
-// matrix to a dense matrix.\n
+// matrix to a dense matrix. The \f$ i \f$-th block of the target matrix is always assigned by the
+// \f$ i \f$-th thread of the team, such that the partitioning matches the NUMA-aware
+// first-touch initialization of the target (see smpFirstTouch()).\n
 // This function must \b NOT be called explicitly! It is used internally for the performance
 // optimized evaluation of expression templates. Calling this function explicitly might result
 // in erroneous results and/or in compilation errors. Instead of using this function use the
@@ -122,7 +125,7 @@ void openmpAssign( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs, O
    const size_t rest2      ( equalShare2 & ( SIMDSIZE - 1UL ) );
    const size_t colsPerThread( ( simdEnabled && rest2 )?( equalShare2 - rest2 + SIMDSIZE ):( equalShare2 ) );
 
-#pragma omp for schedule(dynamic,1) nowait
+#pragma omp for schedule(static,1) nowait
    for( int i=0; i<threads; ++i )
    {
       const size_t row   ( ( i / threadmap.second ) * rowsPerThread );
@@ -171,7 +174,9 @@ void openmpAssign( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs, O
 // \return void
 //
 // This function is the backend implementation of the OpenMP-based SMP assignment of a sparse
-// matrix to a dense matrix.\n
+// matrix to a dense matrix. The \f$ i \f$-th block of the target matrix is always assigned by the
+// \f$ i \f$-th thread of the team, such that the partitioning matches the NUMA-aware
+// first-touch initialization of the target (see smpFirstTouch()).\n
 // This function must \b NOT be called explicitly! It is used internally for the performance
 // optimized evaluation of expression templates. Calling this function explicitly might result
 // in erroneous results and/or in compilation errors. Instead of using this function use the
@@ -197,7 +202,7 @@ void openmpAssign( DenseMatrix<MT1,SO1>& lhs, const SparseMatrix<MT2,SO2>& rhs,
    const size_t addon2       ( ( ( (~rhs).columns() % threadmap.second ) != 0UL )? 1UL : 0UL );
    const size_t colsPerThread( (~rhs).columns() / threadmap.second + addon2 );
 
-#pragma omp for schedule(dynamic,1) nowait
+#pragma omp for schedule(static,1) nowait
    for( size_t i=0; i<threads; ++i )
    {
       const size_t row   ( ( i / threadmap.second ) * rowsPerThread );
@@ -301,6 +306,8 @@ inline auto smpAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
          assign( ~lhs, ~rhs );
       }
       else {
+         BLAZE_KERNEL_PROFILE( "smp.dmat.assign", omp_get_max_threads(), (~lhs).rows(), (~lhs).columns(), 1UL,
+                               0.0, sizeof(ElementType_t<MT1>)*(~lhs).rows()*(~lhs).columns() );
 #pragma omp parallel shared( lhs, rhs )
          openmpAssign( ~lhs, ~rhs, []( auto& a, const auto& b ){ assign( a, b ); } );
       }
@@ -393,6 +400,8 @@ inline auto smpAddAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
          addAssign( ~lhs, ~rhs );
       }
       else {
+         BLAZE_KERNEL_PROFILE( "smp.dmat.addassign", omp_get_max_threads(), (~lhs).rows(), (~lhs).columns(), 1UL,
+                               0.0, sizeof(ElementType_t<MT1>)*(~lhs).rows()*(~lhs).columns() );
 #pragma omp parallel shared( lhs, rhs )
          openmpAssign( ~lhs, ~rhs, []( auto& a, const auto& b ){ addAssign( a, b ); } );
       }
@@ -485,6 +494,8 @@ inline auto smpSubAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
          subAssign( ~lhs, ~rhs );
       }
       else {
+         BLAZE_KERNEL_PROFILE( "smp.dmat.subassign", omp_get_max_threads(), (~lhs).rows(), (~lhs).columns(), 1UL,
+                               0.0, sizeof(ElementType_t<MT1>)*(~lhs).rows()*(~lhs).columns() );
 #pragma omp parallel shared( lhs, rhs )
          openmpAssign( ~lhs, ~rhs, []( auto& a, const auto& b ){ subAssign( a, b ); } );
       }
@@ -577,6 +588,8 @@ inline auto smpSchurAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
          schurAssign( ~lhs, ~rhs );
       }
       else {
+         BLAZE_KERNEL_PROFILE( "smp.dmat.schurassign", omp_get_max_threads(), (~lhs).rows(), (~lhs).columns(), 1UL,
+                               0.0, sizeof(ElementType_t<MT1>)*(~lhs).rows()*(~lhs).columns() );
 #pragma omp parallel shared( lhs, rhs )
          openmpAssign( ~lhs, ~rhs, []( auto& a, const auto& b ){ schurAssign( a, b ); } );
       }
@@ -58,6 +58,7 @@
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
+#include <blaze/util/KernelProfile.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Types.h>
 
@@ -81,7 +82,9 @@ namespace blaze {
 // \return void
 //
 // This function is the backend implementation of the OpenMP-based SMP assignment of a dense
-// vector to a dense vector.\n
+// vector to a dense vector. The \f$ i \f$-th block of the target vector is always assigned by the
+// \f$ i \f$-th thread of the team, such that the partitioning matches the NUMA-aware
+// first-touch initialization of the target (see smpFirstTouch()).\n
 // This function must \b NOT be called explicitly! It is used internally for the performance
 // optimized evaluation of expression templates. Calling this function explicitly might result
 // in erroneous results and/or in compilation errors. Instead of using this function use the
@@ -113,7 +116,7 @@ void openmpAssign( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& rhs, O
    const size_t rest         ( equalShare & ( SIMDSIZE - 1UL ) );
    const size_t sizePerThread( ( simdEnabled && rest )?( equalShare - rest + SIMDSIZE ):( equalShare ) );
 
-#pragma omp for schedule(dynamic,1) nowait
+#pragma omp for schedule(static,1) nowait
    for( int i=0UL; i<threads; ++i )
    {
       const size_t index( i*sizePerThread );
@@ -160,7 +163,9 @@ void openmpAssign( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& rhs, O
 // \return void
 //
 // This function is the backend implementation of the OpenMP-based SMP assignment of a sparse
-// vector to a dense vector.\n
+// vector to a dense vector. The \f$ i \f$-th block of the target vector is always assigned by the
+// \f$ i \f$-th thread of the team, such that the partitioning matches the NUMA-aware
+// first-touch initialization of the target (see smpFirstTouch()).\n
 // This function must \b NOT be called explicitly! It is used internally for the performance
 // optimized evaluation of expression templates. Calling this function explicitly might result
 // in erroneous results and/or in compilation errors. Instead of using this function use the
@@ -181,7 +186,7 @@ void openmpAssign( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2>& rhs,
    const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
    const size_t sizePerThread( (~lhs).size() / threads + addon );
 
-#pragma omp for schedule(dynamic,1) nowait
+#pragma omp for schedule(static,1) nowait
    for( int i=0UL; i<threads; ++i )
    {
       const size_t index( i*sizePerThread );
@@ -280,6 +285,8 @@ inline auto smpAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
          assign( ~lhs, ~rhs );
       }
       else {
+         BLAZE_KERNEL_PROFILE( "smp.dvec.assign", omp_get_max_threads(), (~lhs).size(), 1UL, 1UL,
+                               0.0, sizeof(ElementType_t<VT1>)*(~lhs).size() );
 #pragma omp parallel shared( lhs, rhs )
          openmpAssign( ~lhs, ~rhs, []( auto& a, const auto& b ){ assign( a, b ); } );
       }
@@ -370,6 +377,8 @@ inline auto smpAddAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
          addAssign( ~lhs, ~rhs );
       }
       else {
+         BLAZE_KERNEL_PROFILE( "smp.dvec.addassign", omp_get_max_threads(), (~lhs).size(), 1UL, 1UL,
+                               0.0, sizeof(ElementType_t<VT1>)*(~lhs).size() );
 #pragma omp parallel shared( lhs, rhs )
          openmpAssign( ~lhs, ~rhs, []( auto& a, const auto& b ){ addAssign( a, b ); } );
       }
@@ -460,6 +469,8 @@ inline auto smpSubAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
          subAssign( ~lhs, ~rhs );
       }
       else {
+         BLAZE_KERNEL_PROFILE( "smp.dvec.subassign", omp_get_max_threads(), (~lhs).size(), 1UL, 1UL,
+                               0.0, sizeof(ElementType_t<VT1>)*(~lhs).size() );
 #pragma omp parallel shared( lhs, rhs )
          openmpAssign( ~lhs, ~rhs, []( auto& a, const auto& b ){ subAssign( a, b ); } );
       }
@@ -550,6 +561,8 @@ inline auto smpMultAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
          multAssign( ~lhs, ~rhs );
       }
       else {
+         BLAZE_KERNEL_PROFILE( "smp.dvec.multassign", omp_get_max_threads(), (~lhs).size(), 1UL, 1UL,
+                               0.0, sizeof(ElementType_t<VT1>)*(~lhs).size() );
 #pragma omp parallel shared( lhs, rhs )
          openmpAssign( ~lhs, ~rhs, []( auto& a, const auto& b ){ multAssign( a, b ); } );
       }
@@ -640,6 +653,8 @@ inline auto smpDivAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
          divAssign( ~lhs, ~rhs );
       }
       else {
+         BLAZE_KERNEL_PROFILE( "smp.dvec.divassign", omp_get_max_threads(), (~lhs).size(), 1UL, 1UL,
+                               0.0, sizeof(ElementType_t<VT1>)*(~lhs).size() );
 #pragma omp parallel shared( lhs, rhs )
          openmpAssign( ~lhs, ~rhs, []( auto& a, const auto& b ){ divAssign( a, b ); } );
       }
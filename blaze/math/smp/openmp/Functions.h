@@ -45,6 +45,7 @@
 #include <blaze/system/Inline.h>
 #include <blaze/system/SMP.h>
 #include <blaze/util/StaticAssert.h>
+#include <blaze/util/ThreadAffinity.h>
 #include <blaze/util/Types.h>
 
 
@@ -100,6 +101,65 @@ BLAZE_ALWAYS_INLINE void setNumThreads( size_t number )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns a reference to the thread affinity of the OpenMP parallelization.
+// \ingroup smp
+//
+// \return Reference to the thread affinity.
+*/
+inline ThreadAffinity& threadAffinityStorage()
+{
+   static ThreadAffinity affinity;
+   return affinity;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the thread affinity used for OpenMP parallel operations.
+// \ingroup smp
+//
+// \return The thread affinity set via the blaze::setThreadAffinity() function.
+*/
+BLAZE_ALWAYS_INLINE ThreadAffinity getThreadAffinity()
+{
+   return threadAffinityStorage();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Sets the thread affinity to be used for OpenMP parallel operations.
+// \ingroup smp
+//
+// \param affinity The new thread affinity.
+// \return void
+//
+// Via this function the threads of the OpenMP thread team can be pinned to specific CPUs (see
+// ThreadAffinity). The \f$ i \f$-th thread of the team is pinned within an OpenMP parallel
+// region to the CPU associated with the thread number \f$ i \f$. Note that this relies on the
+// OpenMP runtime reusing its threads for subsequent parallel regions. Therefore the standard
+// \c OMP_PLACES and \c OMP_PROC_BIND environment variables should be preferred whenever the
+// affinity is known at program startup.
+*/
+BLAZE_ALWAYS_INLINE void setThreadAffinity( const ThreadAffinity& affinity )
+{
+   threadAffinityStorage() = affinity;
+
+#pragma omp parallel shared( affinity )
+   {
+      affinity.apply( static_cast<size_t>( omp_get_thread_num() ) );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Provides a reliable shutdown of C++11 threads for Visual Studio compilers.
@@ -0,0 +1,705 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/threads/AsyncAssign.h
+//  \brief Header file for the C++11/Boost thread-based asynchronous assignment
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_THREADS_ASYNCASSIGN_H_
+#define _BLAZE_MATH_SMP_THREADS_ASYNCASSIGN_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <memory>
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/SMPAssignable.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/threads/DenseMatrix.h>
+#include <blaze/math/smp/threads/DenseVector.h>
+#include <blaze/math/smp/threads/ThreadBackend.h>
+#include <blaze/math/typetraits/IsRestricted.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/threadpool/TaskGroup.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Handle for an asynchronous SMP assignment.
+// \ingroup smp
+//
+// The AsyncAssignment class represents the result of an asynchronous assignment (see for
+// instance the asyncAssign() function). It provides the functionality to query whether the
+// assignment has been completed and to wait for its completion:
+
+   \code
+   blaze::AsyncAssignment h1( blaze::asyncAssign( y1, A*x1 ) );
+   blaze::AsyncAssignment h2( blaze::asyncAssign( y2, B*x2 ) );
+
+   // ... Independent work
+
+   h1.wait();  // Blocks until y1 has been computed
+   h2.wait();  // Blocks until y2 has been computed
+   \endcode
+
+// The handle can only be moved, not copied. In case the handle is destroyed before the wait()
+// function has been called, the destructor blocks until the assignment has been completed.
+*/
+class AsyncAssignment
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline AsyncAssignment();
+   explicit inline AsyncAssignment( threadpool::TaskGroup* group );
+   inline AsyncAssignment( AsyncAssignment&& handle ) noexcept;
+   AsyncAssignment( const AsyncAssignment& ) = delete;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~AsyncAssignment();
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline AsyncAssignment& operator=( AsyncAssignment&& handle );
+   AsyncAssignment& operator=( const AsyncAssignment& ) = delete;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline bool ready() const noexcept;
+   inline void wait();
+   //@}
+   //**********************************************************************************************
+
+   //**Internal functions**************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   inline threadpool::TaskGroup* group() const noexcept;
+   /*! \endcond */
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::unique_ptr<threadpool::TaskGroup> group_;  //!< The task group of the assignment.
+                                                   /*!< In case the assignment has already
+                                                        been completed, the pointer is empty. */
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Default constructor for an already completed assignment.
+*/
+inline AsyncAssignment::AsyncAssignment()
+   : group_()  // The task group of the assignment
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for an assignment represented by the given task group.
+//
+// \param group The task group of the assignment (taking ownership).
+*/
+inline AsyncAssignment::AsyncAssignment( threadpool::TaskGroup* group )
+   : group_( group )  // The task group of the assignment
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for AsyncAssignment.
+//
+// \param handle The handle to be moved into this instance.
+*/
+inline AsyncAssignment::AsyncAssignment( AsyncAssignment&& handle ) noexcept
+   : group_( std::move( handle.group_ ) )  // The task group of the assignment
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for AsyncAssignment.
+//
+// The destructor blocks until the assignment has been completed.
+*/
+inline AsyncAssignment::~AsyncAssignment()
+{
+   wait();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for AsyncAssignment.
+//
+// \param handle The handle to be moved into this instance.
+// \return Reference to the assigned handle.
+//
+// Before the given handle is moved into this instance, the function waits for the completion
+// of the assignment currently represented by this handle.
+*/
+inline AsyncAssignment& AsyncAssignment::operator=( AsyncAssignment&& handle )
+{
+   if( &handle != this ) {
+      wait();
+      group_ = std::move( handle.group_ );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the assignment has been completed.
+//
+// \return \a true in case the assignment has been completed, \a false if not.
+*/
+inline bool AsyncAssignment::ready() const noexcept
+{
+   return !group_ || group_->ready();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Waiting for the completion of the assignment.
+//
+// \return void
+*/
+inline void AsyncAssignment::wait()
+{
+   if( group_ ) {
+      TheThreadBackend::wait( *group_ );
+      group_.reset();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the task group of the assignment.
+//
+// \return Pointer to the task group or \c nullptr in case the assignment has been completed.
+*/
+inline threadpool::TaskGroup* AsyncAssignment::group() const noexcept
+{
+   return group_.get();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASYNCHRONOUS ASSIGNMENT BACKENDS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default backend of an asynchronous (compound) assignment of a dense vector or matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector or matrix.
+// \param rhs The right-hand side dense vector or matrix to be assigned.
+// \param op The parallel (compound) assignment operation (not used).
+// \param fallback The blocking (compound) assignment operation.
+// \return A handle for the already completed assignment.
+//
+// This function performs a blocking assignment in case the target is not SMP-assignable or
+// in case the target is a restricted type (as for instance a symmetric matrix adaptor).
+*/
+template< typename T1    // Type of the left-hand side operand
+        , typename T2    // Type of the right-hand side operand
+        , typename OP    // Type of the parallel assignment operation
+        , typename FB >  // Type of the blocking assignment operation
+inline auto asyncAssign_backend( T1& lhs, const T2& rhs, OP op, FB fallback )
+   -> EnableIf_t< !IsSMPAssignable_v<T1> || IsRestricted_v<T1>, AsyncAssignment >
+{
+   MAYBE_UNUSED( op );
+
+   fallback( lhs, rhs );
+
+   return AsyncAssignment();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of an asynchronous (compound) assignment of an expression with computed operands.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector or matrix.
+// \param rhs The right-hand side expression to be assigned.
+// \param op The parallel (compound) assignment operation (not used).
+// \param fallback The blocking (compound) assignment operation.
+// \return A handle for the already completed assignment.
+//
+// This function handles right-hand side expressions that are not SMP-assignable since they
+// require the evaluation of computed operands (as for instance \c B*x in \c A*(B*x)). Since
+// every partial assignment would evaluate these operands again, the expression is not split
+// into partial assignments. Instead, it is assigned via the blocking assignment operation,
+// which selects the SMP assignment overload of the expression. This overload evaluates the
+// computed operands exactly once and performs the remaining assignment in parallel.
+*/
+template< typename T1    // Type of the left-hand side operand
+        , typename T2    // Type of the right-hand side operand
+        , typename OP    // Type of the parallel assignment operation
+        , typename FB >  // Type of the blocking assignment operation
+inline auto asyncAssign_backend( T1& lhs, const T2& rhs, OP op, FB fallback )
+   -> EnableIf_t< IsSMPAssignable_v<T1> && !IsSMPAssignable_v<T2> && !IsRestricted_v<T1>
+                , AsyncAssignment >
+{
+   MAYBE_UNUSED( op );
+
+   fallback( lhs, rhs );
+
+   return AsyncAssignment();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of an asynchronous (compound) assignment of a dense vector or matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector or matrix.
+// \param rhs The right-hand side dense vector or matrix to be assigned.
+// \param op The parallel (compound) assignment operation.
+// \param fallback The blocking (compound) assignment operation.
+// \return A handle for the asynchronous assignment.
+//
+// This function partitions the assignment exactly as the blocking SMP assignment and schedules
+// all partial assignments for execution. In contrast to the blocking SMP assignment it does not
+// wait for the completion of the partial assignments, but returns a handle for the assignment.
+// Since the right-hand side operand is SMP-assignable, none of its operands requires an
+// evaluation and no work is duplicated by the partial assignments. In case a serial section
+// is active or the right-hand side operand cannot be assigned in parallel, the blocking
+// fallback is used instead.
+*/
+template< typename T1    // Type of the left-hand side operand
+        , typename T2    // Type of the right-hand side operand
+        , typename OP    // Type of the parallel assignment operation
+        , typename FB >  // Type of the blocking assignment operation
+inline auto asyncAssign_backend( T1& lhs, const T2& rhs, OP op, FB fallback )
+   -> EnableIf_t< IsSMPAssignable_v<T1> && IsSMPAssignable_v<T2> && !IsRestricted_v<T1>
+                , AsyncAssignment >
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<T1> );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<T2> );
+
+   if( isSerialSectionActive() || !rhs.canSMPAssign() ) {
+      fallback( lhs, rhs );
+      return AsyncAssignment();
+   }
+
+   AsyncAssignment handle( new threadpool::TaskGroup() );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      threadAssign( lhs, rhs, op, handle.group() );
+   }
+
+   return handle;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASYNCHRONOUS ASSIGNMENT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Asynchronous assignment functions */
+//@{
+template< typename VT1, bool TF, typename VT2 >
+AsyncAssignment asyncAssign( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs );
+
+template< typename VT1, bool TF, typename VT2 >
+AsyncAssignment asyncAddAssign( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs );
+
+template< typename VT1, bool TF, typename VT2 >
+AsyncAssignment asyncSubAssign( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2 >
+AsyncAssignment asyncAssign( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2 >
+AsyncAssignment asyncAddAssign( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2 >
+AsyncAssignment asyncSubAssign( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Asynchronous assignment of a dense vector to a dense vector (\f$ \vec{a}=\vec{b} \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side dense vector to be assigned.
+// \return A handle for the asynchronous assignment.
+// \exception std::invalid_argument Vector cannot be resized.
+//
+// This function assigns the given dense vector (expression) to the given target dense vector.
+// In contrast to the assignment operator the function does not block until the assignment has
+// been completed, but schedules all partial assignments to the thread pool and immediately
+// returns a handle, which can be used to wait for the completion of the assignment. Therefore
+// several independent assignments can be executed concurrently without intermediate barriers:
+
+   \code
+   blaze::DynamicMatrix<double> A, B;
+   blaze::DynamicVector<double> x1, x2, y1, y2;
+   // ... Resizing and initialization
+
+   auto h1 = blaze::asyncAssign( y1, A*x1 );
+   auto h2 = blaze::asyncAssign( y2, B*x2 );
+
+   h1.wait();
+   h2.wait();
+   \endcode
+
+// The partitioning of the assignment is identical to the blocking SMP assignment. In case the
+// assignment would not be executed in parallel (e.g. due to the size of the operands, since
+// the operands alias, since the target is a restricted adaptor, or since a serial section is
+// active), the assignment is performed immediately and the returned handle is already ready.
+//
+// In case the right-hand side expression requires the evaluation of computed operands (as
+// for instance \c B*x in \c A*(B*x)), these operands are evaluated exactly once by a blocking
+// SMP assignment instead of being evaluated by every partial assignment. In order to overlap
+// such an assignment with other work, the operands should be evaluated explicitly beforehand.
+//
+// \note The target vector and all operands of the right-hand side expression must not be
+// modified or destroyed before the assignment has been completed.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , bool TF         // Transpose flag of both dense vectors
+        , typename VT2 >  // Type of the right-hand side dense vector
+inline AsyncAssignment asyncAssign( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( IsRestricted_v<VT1> || (~rhs).canAlias( &~lhs ) ) {
+      (~lhs) = ~rhs;
+      return AsyncAssignment();
+   }
+
+   resize( ~lhs, (~rhs).size(), false );
+
+   return asyncAssign_backend( ~lhs, ~rhs,
+                               []( auto& a, const auto& b ){ assign( a, b ); },
+                               []( auto& a, const auto& b ){ a = b; } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Asynchronous addition assignment of a dense vector to a dense vector
+//        (\f$ \vec{a}+=\vec{b} \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side dense vector to be added.
+// \return A handle for the asynchronous assignment.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function adds the given dense vector (expression) to the given target dense vector
+// without blocking until the operation has been completed. For more details see the
+// asyncAssign() function.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , bool TF         // Transpose flag of both dense vectors
+        , typename VT2 >  // Type of the right-hand side dense vector
+inline AsyncAssignment asyncAddAssign( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~lhs).size() != (~rhs).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   if( IsRestricted_v<VT1> || (~rhs).canAlias( &~lhs ) ) {
+      (~lhs) += ~rhs;
+      return AsyncAssignment();
+   }
+
+   return asyncAssign_backend( ~lhs, ~rhs,
+                               []( auto& a, const auto& b ){ addAssign( a, b ); },
+                               []( auto& a, const auto& b ){ a += b; } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Asynchronous subtraction assignment of a dense vector to a dense vector
+//        (\f$ \vec{a}-=\vec{b} \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side dense vector to be subtracted.
+// \return A handle for the asynchronous assignment.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function subtracts the given dense vector (expression) from the given target dense
+// vector without blocking until the operation has been completed. For more details see the
+// asyncAssign() function.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , bool TF         // Transpose flag of both dense vectors
+        , typename VT2 >  // Type of the right-hand side dense vector
+inline AsyncAssignment asyncSubAssign( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~lhs).size() != (~rhs).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   if( IsRestricted_v<VT1> || (~rhs).canAlias( &~lhs ) ) {
+      (~lhs) -= ~rhs;
+      return AsyncAssignment();
+   }
+
+   return asyncAssign_backend( ~lhs, ~rhs,
+                               []( auto& a, const auto& b ){ subAssign( a, b ); },
+                               []( auto& a, const auto& b ){ a -= b; } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Asynchronous assignment of a dense matrix to a dense matrix (\f$ A=B \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense matrix.
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return A handle for the asynchronous assignment.
+// \exception std::invalid_argument Matrix cannot be resized.
+//
+// This function assigns the given dense matrix (expression) to the given target dense matrix
+// without blocking until the assignment has been completed. For more details see the
+// asyncAssign() function for dense vectors.
+*/
+template< typename MT1  // Type of the left-hand side dense matrix
+        , bool SO1      // Storage order of the left-hand side dense matrix
+        , typename MT2  // Type of the right-hand side dense matrix
+        , bool SO2 >    // Storage order of the right-hand side dense matrix
+inline AsyncAssignment asyncAssign( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( IsRestricted_v<MT1> || (~rhs).canAlias( &~lhs ) ) {
+      (~lhs) = ~rhs;
+      return AsyncAssignment();
+   }
+
+   resize( ~lhs, (~rhs).rows(), (~rhs).columns(), false );
+
+   return asyncAssign_backend( ~lhs, ~rhs,
+                               []( auto& a, const auto& b ){ assign( a, b ); },
+                               []( auto& a, const auto& b ){ a = b; } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Asynchronous addition assignment of a dense matrix to a dense matrix (\f$ A+=B \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense matrix.
+// \param rhs The right-hand side dense matrix to be added.
+// \return A handle for the asynchronous assignment.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function adds the given dense matrix (expression) to the given target dense matrix
+// without blocking until the operation has been completed. For more details see the
+// asyncAssign() function for dense vectors.
+*/
+template< typename MT1  // Type of the left-hand side dense matrix
+        , bool SO1      // Storage order of the left-hand side dense matrix
+        , typename MT2  // Type of the right-hand side dense matrix
+        , bool SO2 >    // Storage order of the right-hand side dense matrix
+inline AsyncAssignment asyncAddAssign( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~lhs).rows() != (~rhs).rows() || (~lhs).columns() != (~rhs).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( IsRestricted_v<MT1> || (~rhs).canAlias( &~lhs ) ) {
+      (~lhs) += ~rhs;
+      return AsyncAssignment();
+   }
+
+   return asyncAssign_backend( ~lhs, ~rhs,
+                               []( auto& a, const auto& b ){ addAssign( a, b ); },
+                               []( auto& a, const auto& b ){ a += b; } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Asynchronous subtraction assignment of a dense matrix to a dense matrix (\f$ A-=B \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense matrix.
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return A handle for the asynchronous assignment.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function subtracts the given dense matrix (expression) from the given target dense
+// matrix without blocking until the operation has been completed. For more details see the
+// asyncAssign() function for dense vectors.
+*/
+template< typename MT1  // Type of the left-hand side dense matrix
+        , bool SO1      // Storage order of the left-hand side dense matrix
+        , typename MT2  // Type of the right-hand side dense matrix
+        , bool SO2 >    // Storage order of the right-hand side dense matrix
+inline AsyncAssignment asyncSubAssign( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~lhs).rows() != (~rhs).rows() || (~lhs).columns() != (~rhs).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( IsRestricted_v<MT1> || (~rhs).canAlias( &~lhs ) ) {
+      (~lhs) -= ~rhs;
+      return AsyncAssignment();
+   }
+
+   return asyncAssign_backend( ~lhs, ~rhs,
+                               []( auto& a, const auto& b ){ subAssign( a, b ); },
+                               []( auto& a, const auto& b ){ a -= b; } );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPILE TIME CONSTRAINTS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+BLAZE_STATIC_ASSERT( BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -59,7 +59,9 @@
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
+#include <blaze/util/KernelProfile.h>
 #include <blaze/util/StaticAssert.h>
+#include <blaze/util/threadpool/TaskGroup.h>
 #include <blaze/util/Types.h>
 
 
@@ -79,6 +81,7 @@ namespace blaze {
 // \param lhs The target left-hand side dense matrix.
 // \param rhs The right-hand side dense matrix to be assigned.
 // \param op The (compound) assignment operation.
+// \param group The task group of the assignment (\c nullptr in case of a blocking assignment).
 // \return void
 //
 // This function is the backend implementation of the C++11/Boost thread-based SMP assignment
@@ -93,7 +96,8 @@ template< typename MT1   // Type of the left-hand side dense matrix
         , typename MT2   // Type of the right-hand side dense matrix
         , bool SO2       // Storage order of the right-hand side dense matrix
         , typename OP >  // Type of the assignment operation
-void threadAssign( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs, OP op )
+void threadAssign( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs, OP op,
+                   threadpool::TaskGroup* group=nullptr )
 {
    BLAZE_FUNCTION_TRACE;
 
@@ -140,27 +144,29 @@ void threadAssign( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs, O
          if( simdEnabled && lhsAligned && rhsAligned ) {
             auto       target( submatrix<aligned>( ~lhs, row, column, m, n, unchecked ) );
             const auto source( submatrix<aligned>( ~rhs, row, column, m, n, unchecked ) );
-            TheThreadBackend::schedule( target, source, op );
+            TheThreadBackend::schedule( target, source, op, group );
          }
          else if( simdEnabled && lhsAligned ) {
             auto       target( submatrix<aligned>( ~lhs, row, column, m, n, unchecked ) );
             const auto source( submatrix<unaligned>( ~rhs, row, column, m, n, unchecked ) );
-            TheThreadBackend::schedule( target, source, op );
+            TheThreadBackend::schedule( target, source, op, group );
          }
          else if( simdEnabled && rhsAligned ) {
             auto       target( submatrix<unaligned>( ~lhs, row, column, m, n, unchecked ) );
             const auto source( submatrix<aligned>( ~rhs, row, column, m, n, unchecked ) );
-            TheThreadBackend::schedule( target, source, op );
+            TheThreadBackend::schedule( target, source, op, group );
          }
          else {
             auto       target( submatrix<unaligned>( ~lhs, row, column, m, n, unchecked ) );
             const auto source( submatrix<unaligned>( ~rhs, row, column, m, n, unchecked ) );
-            TheThreadBackend::schedule( target, source, op );
+            TheThreadBackend::schedule( target, source, op, group );
          }
       }
    }
 
-   TheThreadBackend::wait();
+   if( group == nullptr ) {
+      TheThreadBackend::wait();
+   }
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -175,6 +181,7 @@ void threadAssign( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs, O
 // \param lhs The target left-hand side dense matrix.
 // \param rhs The right-hand side sparse matrix to be assigned.
 // \param op The (compound) assignment operation.
+// \param group The task group of the assignment (\c nullptr in case of a blocking assignment).
 // \return void
 //
 // This function is the backend implementation of the C++11/Boost thread-based SMP assignment
@@ -189,7 +196,8 @@ template< typename MT1   // Type of the left-hand side dense matrix
         , typename MT2   // Type of the right-hand side sparse matrix
         , bool SO2       // Storage order of the right-hand side sparse matrix
         , typename OP >  // Type of the assignment operation
-void threadAssign( DenseMatrix<MT1,SO1>& lhs, const SparseMatrix<MT2,SO2>& rhs, OP op )
+void threadAssign( DenseMatrix<MT1,SO1>& lhs, const SparseMatrix<MT2,SO2>& rhs, OP op,
+                   threadpool::TaskGroup* group=nullptr )
 {
    BLAZE_FUNCTION_TRACE;
 
@@ -222,11 +230,13 @@ void threadAssign( DenseMatrix<MT1,SO1>& lhs, const SparseMatrix<MT2,SO2>& rhs,
 
          auto       target( submatrix<unaligned>( ~lhs, row, column, m, n, unchecked ) );
          const auto source( submatrix<unaligned>( ~rhs, row, column, m, n, unchecked ) );
-         TheThreadBackend::schedule( target, source, op );
+         TheThreadBackend::schedule( target, source, op, group );
       }
    }
 
-   TheThreadBackend::wait();
+   if( group == nullptr ) {
+      TheThreadBackend::wait();
+   }
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -315,6 +325,8 @@ inline auto smpAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
          assign( ~lhs, ~rhs );
       }
       else {
+         BLAZE_KERNEL_PROFILE( "smp.dmat.assign", TheThreadBackend::size(), (~lhs).rows(), (~lhs).columns(), 1UL,
+                               0.0, sizeof(ElementType_t<MT1>)*(~lhs).rows()*(~lhs).columns() );
          threadAssign( ~lhs, ~rhs, []( auto& a, const auto& b ){ assign( a, b ); } );
       }
    }
@@ -407,6 +419,8 @@ inline auto smpAddAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
          addAssign( ~lhs, ~rhs );
       }
       else {
+         BLAZE_KERNEL_PROFILE( "smp.dmat.addassign", TheThreadBackend::size(), (~lhs).rows(), (~lhs).columns(), 1UL,
+                               0.0, sizeof(ElementType_t<MT1>)*(~lhs).rows()*(~lhs).columns() );
          threadAssign( ~lhs, ~rhs, []( auto& a, const auto& b ){ addAssign( a, b ); } );
       }
    }
@@ -500,6 +514,8 @@ inline auto smpSubAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
          subAssign( ~lhs, ~rhs );
       }
       else {
+         BLAZE_KERNEL_PROFILE( "smp.dmat.subassign", TheThreadBackend::size(), (~lhs).rows(), (~lhs).columns(), 1UL,
+                               0.0, sizeof(ElementType_t<MT1>)*(~lhs).rows()*(~lhs).columns() );
          threadAssign( ~lhs, ~rhs, []( auto& a, const auto& b ){ subAssign( a, b ); } );
       }
    }
@@ -593,6 +609,8 @@ inline auto smpSchurAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
          schurAssign( ~lhs, ~rhs );
       }
       else {
+         BLAZE_KERNEL_PROFILE( "smp.dmat.schurassign", TheThreadBackend::size(), (~lhs).rows(), (~lhs).columns(), 1UL,
+                               0.0, sizeof(ElementType_t<MT1>)*(~lhs).rows()*(~lhs).columns() );
          threadAssign( ~lhs, ~rhs, []( auto& a, const auto& b ){ schurAssign( a, b ); } );
       }
    }
@@ -58,7 +58,9 @@
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
+#include <blaze/util/KernelProfile.h>
 #include <blaze/util/StaticAssert.h>
+#include <blaze/util/threadpool/TaskGroup.h>
 #include <blaze/util/Types.h>
 
 
@@ -79,6 +81,7 @@ namespace blaze {
 // \param lhs The target left-hand side dense vector.
 // \param rhs The right-hand side dense vector to be assigned.
 // \param op The (compound) assignment operation.
+// \param group The task group of the assignment (\c nullptr in case of a blocking assignment).
 // \return void
 //
 // This function is the backend implementation of the C++11/Boost thread-based SMP assignment
@@ -93,7 +96,8 @@ template< typename VT1   // Type of the left-hand side dense vector
         , typename VT2   // Type of the right-hand side dense vector
         , bool TF2       // Transpose flag of the right-hand side dense vector
         , typename OP >  // Type of the assignment operation
-void threadAssign( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& rhs, OP op )
+void threadAssign( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& rhs, OP op,
+                   threadpool::TaskGroup* group=nullptr )
 {
    BLAZE_FUNCTION_TRACE;
 
@@ -126,26 +130,28 @@ void threadAssign( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& rhs, O
       if( simdEnabled && lhsAligned && rhsAligned ) {
          auto       target( subvector<aligned>( ~lhs, index, size, unchecked ) );
          const auto source( subvector<aligned>( ~rhs, index, size, unchecked ) );
-         TheThreadBackend::schedule( target, source, op );
+         TheThreadBackend::schedule( target, source, op, group );
       }
       else if( simdEnabled && lhsAligned ) {
          auto       target( subvector<aligned>( ~lhs, index, size, unchecked ) );
          const auto source( subvector<unaligned>( ~rhs, index, size, unchecked ) );
-         TheThreadBackend::schedule( target, source, op );
+         TheThreadBackend::schedule( target, source, op, group );
       }
       else if( simdEnabled && rhsAligned ) {
          auto       target( subvector<unaligned>( ~lhs, index, size, unchecked ) );
          const auto source( subvector<aligned>( ~rhs, index, size, unchecked ) );
-         TheThreadBackend::schedule( target, source, op );
+         TheThreadBackend::schedule( target, source, op, group );
       }
       else {
          auto       target( subvector<unaligned>( ~lhs, index, size, unchecked ) );
          const auto source( subvector<unaligned>( ~rhs, index, size, unchecked ) );
-         TheThreadBackend::schedule( target, source, op );
+         TheThreadBackend::schedule( target, source, op, group );
       }
    }
 
-   TheThreadBackend::wait();
+   if( group == nullptr ) {
+      TheThreadBackend::wait();
+   }
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -160,6 +166,7 @@ void threadAssign( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& rhs, O
 // \param lhs The target left-hand side dense vector.
 // \param rhs The right-hand side sparse vector to be assigned.
 // \param op The (compound) assignment operation.
+// \param group The task group of the assignment (\c nullptr in case of a blocking assignment).
 // \return void
 //
 // This function is the backend implementation of the C++11/Boost thread-based SMP assignment
@@ -174,7 +181,8 @@ template< typename VT1   // Type of the left-hand side dense vector
         , typename VT2   // Type of the right-hand side sparse vector
         , bool TF2       // Transpose flag of the right-hand side sparse vector
         , typename OP >  // Type of the assignment operation
-void threadAssign( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2>& rhs, OP op )
+void threadAssign( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2>& rhs, OP op,
+                   threadpool::TaskGroup* group=nullptr )
 {
    BLAZE_FUNCTION_TRACE;
 
@@ -194,10 +202,12 @@ void threadAssign( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2>& rhs,
       const size_t size( min( sizePerThread, (~lhs).size() - index ) );
       auto       target( subvector<unaligned>( ~lhs, index, size, unchecked ) );
       const auto source( subvector<unaligned>( ~rhs, index, size, unchecked ) );
-      TheThreadBackend::schedule( target, source, op );
+      TheThreadBackend::schedule( target, source, op, group );
    }
 
-   TheThreadBackend::wait();
+   if( group == nullptr ) {
+      TheThreadBackend::wait();
+   }
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -284,6 +294,8 @@ inline auto smpAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
          assign( ~lhs, ~rhs );
       }
       else {
+         BLAZE_KERNEL_PROFILE( "smp.dvec.assign", TheThreadBackend::size(), (~lhs).size(), 1UL, 1UL,
+                               0.0, sizeof(ElementType_t<VT1>)*(~lhs).size() );
          threadAssign( ~lhs, ~rhs, []( auto& a, const auto& b ){ assign( a, b ); } );
       }
    }
@@ -374,6 +386,8 @@ inline auto smpAddAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
          addAssign( ~lhs, ~rhs );
       }
       else {
+         BLAZE_KERNEL_PROFILE( "smp.dvec.addassign", TheThreadBackend::size(), (~lhs).size(), 1UL, 1UL,
+                               0.0, sizeof(ElementType_t<VT1>)*(~lhs).size() );
          threadAssign( ~lhs, ~rhs, []( auto& a, const auto& b ){ addAssign( a, b ); } );
       }
    }
@@ -465,6 +479,8 @@ inline auto smpSubAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
          subAssign( ~lhs, ~rhs );
       }
       else {
+         BLAZE_KERNEL_PROFILE( "smp.dvec.subassign", TheThreadBackend::size(), (~lhs).size(), 1UL, 1UL,
+                               0.0, sizeof(ElementType_t<VT1>)*(~lhs).size() );
          threadAssign( ~lhs, ~rhs, []( auto& a, const auto& b ){ subAssign( a, b ); } );
       }
    }
@@ -556,6 +572,8 @@ inline auto smpMultAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
          multAssign( ~lhs, ~rhs );
       }
       else {
+         BLAZE_KERNEL_PROFILE( "smp.dvec.multassign", TheThreadBackend::size(), (~lhs).size(), 1UL, 1UL,
+                               0.0, sizeof(ElementType_t<VT1>)*(~lhs).size() );
          threadAssign( ~lhs, ~rhs, []( auto& a, const auto& b ){ multAssign( a, b ); } );
       }
    }
@@ -646,6 +664,8 @@ inline auto smpDivAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
          divAssign( ~lhs, ~rhs );
       }
       else {
+         BLAZE_KERNEL_PROFILE( "smp.dvec.divassign", TheThreadBackend::size(), (~lhs).size(), 1UL, 1UL,
+                               0.0, sizeof(ElementType_t<VT1>)*(~lhs).size() );
          threadAssign( ~lhs, ~rhs, []( auto& a, const auto& b ){ divAssign( a, b ); } );
       }
    }
@@ -45,6 +45,7 @@
 #include <blaze/system/Inline.h>
 #include <blaze/system/SMP.h>
 #include <blaze/util/StaticAssert.h>
+#include <blaze/util/ThreadAffinity.h>
 #include <blaze/util/Types.h>
 
 
@@ -98,6 +99,42 @@ BLAZE_ALWAYS_INLINE void setNumThreads( size_t number )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the thread affinity used for thread parallel operations.
+// \ingroup smp
+//
+// \return The current thread affinity.
+*/
+BLAZE_ALWAYS_INLINE ThreadAffinity getThreadAffinity()
+{
+   return TheThreadBackend::getAffinity();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Sets the thread affinity to be used for thread parallel operations.
+// \ingroup smp
+//
+// \param affinity The new thread affinity.
+// \return void
+//
+// Via this function the threads used for thread parallel operations can be pinned to specific
+// CPUs (see ThreadAffinity). The function blocks until all scheduled tasks have been completed
+// and restarts all threads such that the new affinity is applied to all of them. The initial
+// affinity can be specified via the \c BLAZE_THREAD_AFFINITY environment variable.
+*/
+BLAZE_ALWAYS_INLINE void setThreadAffinity( const ThreadAffinity& affinity )
+{
+   TheThreadBackend::setAffinity( affinity );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Provides a reliable shutdown of C++11 threads for Visual Studio compilers.
@@ -0,0 +1,119 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/threads/ParallelFor.h
+//  \brief Header file for the C++11/Boost thread-based SMP parallel loop implementation
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_THREADS_PARALLELFOR_H_
+#define _BLAZE_MATH_SMP_THREADS_PARALLELFOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/threads/ThreadBackend.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/threadpool/TaskGroup.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  PARALLEL LOOP
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief C++11/Boost thread-based implementation of the SMP parallel loop.
+// \ingroup smp
+//
+// \param n The total number of loop iterations.
+// \param op The operation to be executed for a range of iterations.
+// \return void
+//
+// This function executes the given operation for the index range \f$ [0..n) \f$. The range
+// is split into one contiguous chunk per thread of the thread backend and the operation is
+// called with the first and the one-past-the-last index of each chunk. The function blocks
+// until all chunks have been processed. Since the chunks are executed by the threads of the
+// thread backend, the operation must not throw any exception. In case a serial section is
+// active, the entire range is processed by the calling thread.\n
+// This function must \b NOT be called explicitly! It is used internally for the parallel
+// execution of independent operations.
+*/
+template< typename OP >  // Type of the range operation
+void smpFor( size_t n, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( n == 0UL )
+      return;
+
+   BLAZE_PARALLEL_SECTION
+   {
+      const size_t threads( min( TheThreadBackend::size(), n ) );
+
+      if( isSerialSectionActive() || threads < 2UL ) {
+         op( 0UL, n );
+         return;
+      }
+
+      const size_t addon       ( ( ( n % threads ) != 0UL )? 1UL : 0UL );
+      const size_t sizePerChunk( n / threads + addon );
+
+      threadpool::TaskGroup group;
+
+      for( size_t i=0UL; i<threads; ++i )
+      {
+         const size_t begin( i*sizePerChunk );
+
+         if( begin >= n )
+            continue;
+
+         const size_t end( min( begin+sizePerChunk, n ) );
+         TheThreadBackend::schedule( [op,begin,end]() mutable { op( begin, end ); }, &group );
+      }
+
+      TheThreadBackend::wait( group );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -56,8 +56,11 @@
 #include <blaze/util/algorithms/Max.h>
 #include <blaze/util/constraints/Const.h>
 #include <blaze/util/StaticAssert.h>
+#include <blaze/util/threadpool/TaskGroup.h>
+#include <blaze/util/ThreadAffinity.h>
 #include <blaze/util/ThreadPool.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/WorkStealingPool.h>
 
 
 namespace blaze {
@@ -75,7 +78,9 @@ namespace blaze {
 //
 // The ThreadBackend class template represents the backend system for the C++11 and Boost
 // thread-based parallelization. It provides the functionality to manage a pool of active
-// threads and to schedule (compound) assignment tasks for execution.\n
+// threads and to schedule (compound) assignment tasks for execution. In case the work-stealing
+// scheduler is enabled (see the \c BLAZE_USE_WORK_STEALING_THREADS command line argument), the
+// tasks are executed by a WorkStealingPool, otherwise by a classic ThreadPool.\n
 // This class must \b NOT be used explicitly! It is reserved for internal use only. Using
 // this class explicitly might result in erroneous results and/or in undefined behavior.
 */
@@ -85,6 +90,15 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 class ThreadBackend
 {
+ private:
+   //**Type definitions****************************************************************************
+#if BLAZE_WORK_STEALING_PARALLEL_MODE
+   using Pool = WorkStealingPool<TT,MT,LT,CT>;  //!< Type of the thread pool.
+#else
+   using Pool = ThreadPool<TT,MT,LT,CT>;        //!< Type of the thread pool.
+#endif
+   //**********************************************************************************************
+
  public:
    //**Utility functions***************************************************************************
    /*!\name Utility functions */
@@ -92,6 +106,10 @@ class ThreadBackend
    static inline size_t size  ();
    static inline void   resize( size_t n, bool block=false );
    static inline void   wait  ();
+   static inline void   wait  ( const threadpool::TaskGroup& group );
+
+   static inline const ThreadAffinity& getAffinity();
+   static inline void                  setAffinity( const ThreadAffinity& affinity );
    //@}
    //**********************************************************************************************
 
@@ -99,7 +117,11 @@ class ThreadBackend
    /*!\name Thread execution functions */
    //@{
    template< typename Target, typename Source, typename OP >
-   static inline void schedule( Target& target, const Source& source, OP op );
+   static inline void schedule( Target& target, const Source& source, OP op,
+                                threadpool::TaskGroup* group=nullptr );
+
+   template< typename OP >
+   static inline void schedule( OP op, threadpool::TaskGroup* group=nullptr );
    //@}
    //**********************************************************************************************
 
@@ -118,11 +140,13 @@ class ThreadBackend
       // \param target The target operand to be assigned to.
       // \param source The source operand to be assigned to the target.
       // \param op The (compound) assignment operation.
+      // \param group The task group of the assignment (may be \c nullptr).
       */
-      inline Assigner( Target& target, const Source& source, OP op )
+      inline Assigner( Target& target, const Source& source, OP op, threadpool::TaskGroup* group )
          : target_( target )  // The target operand
          , source_( source )  // The source operand
          , op_    ( op     )  // The (compound) assignment operation
+         , group_ ( group  )  // The task group of the assignment
       {}
       //*******************************************************************************************
 
@@ -133,13 +157,15 @@ class ThreadBackend
       */
       inline void operator()() {
          op_( target_, source_ );
+         if( group_ != nullptr ) group_->done();
       }
       //*******************************************************************************************
 
       //**Member variables*************************************************************************
-      Target       target_;  //!< The target operand.
-      const Source source_;  //!< The source operand.
-      OP           op_;      //!< The (compound) assignment operation.
+      Target                 target_;  //!< The target operand.
+      const Source           source_;  //!< The source operand.
+      OP                     op_;      //!< The (compound) assignment operation.
+      threadpool::TaskGroup* group_;   //!< The task group of the assignment.
       //*******************************************************************************************
 
       //**Member variables*************************************************************************
@@ -149,22 +175,58 @@ class ThreadBackend
    };
    //**********************************************************************************************
 
+   //**Private class Executor**********************************************************************
+   /*!\brief Auxiliary functor for the threaded execution of a general operation.
+   */
+   template< typename OP >  // Type of the operation
+   struct Executor
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the Executor class template.
+      //
+      // \param op The operation to be executed.
+      // \param group The task group of the operation (may be \c nullptr).
+      */
+      inline Executor( OP op, threadpool::TaskGroup* group )
+         : op_   ( op    )  // The operation to be executed
+         , group_( group )  // The task group of the operation
+      {}
+      //*******************************************************************************************
+
+      //**Function call operator*******************************************************************
+      /*!\brief Executes the operation.
+      //
+      // \return void
+      */
+      inline void operator()() {
+         op_();
+         if( group_ != nullptr ) group_->done();
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      OP                     op_;     //!< The operation to be executed.
+      threadpool::TaskGroup* group_;  //!< The task group of the operation.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
    //**Initialization functions********************************************************************
    /*!\name Initialization functions */
    //@{
-   static inline size_t initPool();
+   static inline size_t          initPool();
+   static inline void            initThread( size_t id );
+   static inline ThreadAffinity& affinity();
    //@}
    //**********************************************************************************************
 
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   static ThreadPool<TT,MT,LT,CT> threadpool_;  //!< The pool of active threads of the backend system.
-                                                /*!< It is initialized with the number of threads
-                                                     specified via the environment variable
-                                                     \c BLAZE_NUM_THREADS. However, it can be
-                                                     explicitly resized to arbitrary numbers of
-                                                     threads. */
+   static Pool threadpool_;  //!< The pool of active threads of the backend system.
+                             /*!< It is initialized with the number of threads specified via
+                                  the environment variable \c BLAZE_NUM_THREADS. However, it
+                                  can be explicitly resized to arbitrary numbers of threads. */
    //@}
    //**********************************************************************************************
 };
@@ -183,7 +245,7 @@ class ThreadBackend
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 template< typename TT, typename MT, typename LT, typename CT >
-ThreadPool<TT,MT,LT,CT> ThreadBackend<TT,MT,LT,CT>::threadpool_( initPool() );
+typename ThreadBackend<TT,MT,LT,CT>::Pool ThreadBackend<TT,MT,LT,CT>::threadpool_( initPool(), &initThread );
 /*! \endcond */
 //*************************************************************************************************
 
@@ -262,6 +324,70 @@ inline void ThreadBackend<TT,MT,LT,CT>::wait()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Waiting for all tasks of the given task group to be completed.
+//
+// \param group The task group to wait for.
+// \return void
+//
+// This function blocks until all tasks of the given task group have been completed.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void ThreadBackend<TT,MT,LT,CT>::wait( const threadpool::TaskGroup& group )
+{
+   threadpool_.wait( group );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the current thread affinity of the thread backend system.
+//
+// \return The current thread affinity.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline const ThreadAffinity& ThreadBackend<TT,MT,LT,CT>::getAffinity()
+{
+   return affinity();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Changes the thread affinity of the thread backend system.
+//
+// \param affinity The new thread affinity.
+// \return void
+//
+// This function changes the thread affinity of the thread backend system. All threads of the
+// thread pool are restarted such that the new affinity is applied to all of them. Therefore
+// this function blocks until all scheduled tasks have been completed.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void ThreadBackend<TT,MT,LT,CT>::setAffinity( const ThreadAffinity& affinity )
+{
+   threadpool_.wait();
+   ThreadBackend::affinity() = affinity;
+   threadpool_.restart();
+}
+/*! \endcond */
+//*************************************************************************************************
+
 
 
 //=================================================================================================
@@ -277,9 +403,11 @@ inline void ThreadBackend<TT,MT,LT,CT>::wait()
 // \param target The target operand to be assigned to.
 // \param source The source operand to be assigned to the target.
 // \param op The (compound) assignment operation.
+// \param group The task group of the assignment (may be \c nullptr).
 // \return void
 //
-// This function schedules a (compound) assignment of the two given operands for execution.
+// This function schedules a (compound) assignment of the two given operands for execution. In
+// case a task group is specified, the assignment is registered with the given group.
 */
 template< typename TT      // Type of the encapsulated thread
         , typename MT      // Type of the synchronization mutex
@@ -288,10 +416,43 @@ template< typename TT      // Type of the encapsulated thread
 template< typename Target  // Type of the target operand
         , typename Source  // Type of the source operand
         , typename OP >    // Type of the assignment operation
-inline void ThreadBackend<TT,MT,LT,CT>::schedule( Target& target, const Source& source, OP op )
+inline void ThreadBackend<TT,MT,LT,CT>::schedule( Target& target, const Source& source, OP op,
+                                                  threadpool::TaskGroup* group )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
-   threadpool_.schedule( Assigner<Target,Source,OP>( target, source, op ) );
+
+   if( group != nullptr ) {
+      group->add();
+   }
+
+   threadpool_.schedule( Assigner<Target,Source,OP>( target, source, op, group ) );
+}
+/*! \endcond */
+
+
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scheduling a general operation for execution.
+//
+// \param op The operation to be executed.
+// \param group The task group of the operation (may be \c nullptr).
+// \return void
+//
+// This function schedules the given operation for execution. The operation is required to be
+// callable without arguments and must not throw any exception. In case a task group is
+// specified, the operation is registered with the given group.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+template< typename OP >  // Type of the operation
+inline void ThreadBackend<TT,MT,LT,CT>::schedule( OP op, threadpool::TaskGroup* group )
+{
+   if( group != nullptr ) {
+      group->add();
+   }
+
+   threadpool_.schedule( Executor<OP>( op, group ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -338,6 +499,50 @@ inline size_t ThreadBackend<TT,MT,LT,CT>::initPool()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Initialization of a newly created thread of the thread pool.
+//
+// \param id The index of the thread within the thread pool.
+// \return void
+//
+// This function is called by every newly created thread of the thread pool before it executes
+// any task. It pins the thread according to the current thread affinity of the backend system.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void ThreadBackend<TT,MT,LT,CT>::initThread( size_t id )
+{
+   affinity().apply( id );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns a reference to the thread affinity of the thread backend system.
+//
+// \return Reference to the thread affinity.
+//
+// The thread affinity is initialized based on the \c BLAZE_THREAD_AFFINITY environment variable
+// (see the initialThreadAffinity() function).
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline ThreadAffinity& ThreadBackend<TT,MT,LT,CT>::affinity()
+{
+   static ThreadAffinity affinity( initialThreadAffinity() );
+   return affinity;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
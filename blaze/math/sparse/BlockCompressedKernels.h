@@ -0,0 +1,313 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/BlockCompressedKernels.h
+//  \brief Header file for the block compressed matrix multiplication kernels
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_BLOCKCOMPRESSEDKERNELS_H_
+#define _BLAZE_MATH_SPARSE_BLOCKCOMPRESSEDKERNELS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/StaticMatrix.h>
+#include <blaze/math/dense/StaticVector.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/smp/ParallelReduce.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/sparse/Forward.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/IsContiguous.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  BLOCK COMPRESSED MATRIX/DENSE VECTOR MULTIPLICATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Kernel for the multiplication of a block compressed matrix and a dense vector
+//        (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup block_compressed_matrix
+//
+// \param y The target dense vector.
+// \param A The left-hand side block compressed matrix.
+// \param x The right-hand side dense vector.
+// \param begin The index of the first block row to be processed.
+// \param end The index one past the last block row to be processed.
+// \return void
+//
+// This function implements the kernel for the multiplication of the block rows
+// \f$ [begin..end) \f$ of a block compressed matrix and a dense vector. For each stored block
+// the according part of \a x is loaded into a StaticVector and multiplied by means of the
+// (vectorized) StaticMatrix/StaticVector kernel. The result of each block row is accumulated
+// in a StaticVector and written to \a y once.
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename Type  // Element type of the block compressed matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , typename IT    // Type of the stored indices
+        , typename VT2 > // Type of the right-hand side dense vector
+inline void bsrmatdvecmultKernel( VT1& y, const BlockCompressedMatrix<Type,B,IT>& A, const VT2& x,
+                                  size_t begin, size_t end )
+{
+   using ET1 = ElementType_t<VT1>;
+   using ET2 = ElementType_t<VT2>;
+
+   StaticVector<ET1,B,columnVector> sum;
+   StaticVector<ET2,B,columnVector> xb;
+
+   for( size_t I=begin; I<end; ++I )
+   {
+      const auto* const blocks ( A.blocks( I ) );
+      const IT*   const indices( A.blockIndices( I ) );
+      const size_t      nonzeros( A.nonZeroBlocks( I ) );
+
+      reset( sum );
+
+      for( size_t k=0UL; k<nonzeros; ++k )
+      {
+         const size_t jbegin( indices[k]*B );
+
+         for( size_t c=0UL; c<B; ++c ) {
+            xb[c] = x[jbegin+c];
+         }
+
+         sum += blocks[k] * xb;
+      }
+
+      for( size_t r=0UL; r<B; ++r ) {
+         y[I*B+r] = sum[r];
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication of a block compressed matrix and a dense vector (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup block_compressed_matrix
+//
+// \param A The left-hand side block compressed matrix.
+// \param x The right-hand side dense vector.
+// \return The resulting vector of type \a RT.
+//
+// This function computes the product of a block compressed matrix and a dense vector. The
+// right-hand side vector is evaluated in case it is not contiguous in memory. In case the number
+// of rows is larger or equal to the SMP sparse matrix/dense vector multiplication threshold and
+// the matrix can be used in SMP assignments, the block rows are distributed among the available
+// threads (see smpFor()).
+*/
+template< typename RT    // Type of the resulting dense vector
+        , typename Type  // Element type of the block compressed matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , typename IT    // Type of the stored indices
+        , typename VT >  // Type of the right-hand side dense vector
+inline RT bsrmatdvecmult( const BlockCompressedMatrix<Type,B,IT>& A, const DenseVector<VT,false>& x )
+{
+   using XT = If_t< IsContiguous_v<VT> && HasConstDataAccess_v<VT>, const VT&, const ResultType_t<VT> >;
+
+   BLAZE_INTERNAL_ASSERT( A.columns() == (~x).size(), "Invalid vector size" );
+
+   XT x2( ~x );
+
+   RT y;
+   resize( y, A.rows(), false );
+
+   const auto kernel = [&y,&A,&x2]( size_t begin, size_t end )
+   {
+      bsrmatdvecmultKernel( y, A, x2, begin, end );
+   };
+
+   if( canSMPReduce( A ) && A.rows() >= SMP_SMATDVECMULT_THRESHOLD && !isParallelSectionActive() ) {
+      smpFor( A.blockRows(), kernel );
+   }
+   else {
+      kernel( 0UL, A.blockRows() );
+   }
+
+   return y;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BLOCK COMPRESSED MATRIX/DENSE MATRIX MULTIPLICATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Kernel for the multiplication of a block compressed matrix and a dense matrix
+//        (\f$ C=A*B \f$).
+// \ingroup block_compressed_matrix
+//
+// \param C The target dense matrix.
+// \param A The left-hand side block compressed matrix.
+// \param B The right-hand side dense matrix.
+// \param begin The index of the first block row to be processed.
+// \param end The index one past the last block row to be processed.
+// \return void
+//
+// This function implements the kernel for the multiplication of the block rows
+// \f$ [begin..end) \f$ of a block compressed matrix and a dense matrix. The columns of \a B are
+// processed in panels of \a NB columns. For each stored block the according panel of \a B is
+// loaded into a StaticMatrix and multiplied by means of the (vectorized) StaticMatrix kernel.
+// The result panel of each block row is accumulated in a StaticMatrix and written to \a C once.
+*/
+template< typename MT1   // Type of the target dense matrix
+        , typename Type  // Element type of the block compressed matrix
+        , size_t BS      // Number of rows and columns of the blocks
+        , typename IT    // Type of the stored indices
+        , typename MT2 > // Type of the right-hand side dense matrix
+inline void bsrmatdmatmultKernel( MT1& C, const BlockCompressedMatrix<Type,BS,IT>& A, const MT2& B,
+                                  size_t begin, size_t end )
+{
+   using ET1 = ElementType_t<MT1>;
+   using ET2 = ElementType_t<MT2>;
+
+   constexpr size_t NB( 2UL * SIMDTrait<ET1>::size );
+
+   const size_t N( B.columns() );
+
+   StaticMatrix<ET1,BS,NB,rowMajor> acc;
+   StaticMatrix<ET2,BS,NB,rowMajor> panel;
+
+   for( size_t I=begin; I<end; ++I )
+   {
+      const auto* const blocks ( A.blocks( I ) );
+      const IT*   const indices( A.blockIndices( I ) );
+      const size_t      nonzeros( A.nonZeroBlocks( I ) );
+
+      for( size_t jj=0UL; jj<N; jj+=NB )
+      {
+         const size_t jend( min( N-jj, NB ) );
+
+         reset( acc );
+
+         for( size_t k=0UL; k<nonzeros; ++k )
+         {
+            const size_t ibegin( indices[k]*BS );
+
+            for( size_t c=0UL; c<BS; ++c ) {
+               for( size_t l=0UL; l<jend; ++l ) {
+                  panel(c,l) = B(ibegin+c,jj+l);
+               }
+            }
+
+            acc += blocks[k] * panel;
+         }
+
+         for( size_t r=0UL; r<BS; ++r ) {
+            for( size_t l=0UL; l<jend; ++l ) {
+               C(I*BS+r,jj+l) = acc(r,l);
+            }
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication of a block compressed matrix and a dense matrix (\f$ C=A*B \f$).
+// \ingroup block_compressed_matrix
+//
+// \param A The left-hand side block compressed matrix.
+// \param B The right-hand side dense matrix.
+// \return The resulting matrix of type \a RT.
+//
+// This function computes the product of a block compressed matrix and a dense matrix. In case
+// the number of rows is larger or equal to the SMP sparse matrix/dense matrix multiplication
+// threshold and the matrix can be used in SMP assignments, the block rows are distributed among
+// the available threads (see smpFor()). Since every block row of the result is computed by
+// exactly one thread, the threads write to disjoint rows of the result matrix.
+*/
+template< typename RT    // Type of the resulting dense matrix
+        , typename Type  // Element type of the block compressed matrix
+        , size_t BS      // Number of rows and columns of the blocks
+        , typename IT    // Type of the stored indices
+        , typename MT    // Type of the right-hand side dense matrix
+        , bool SO >      // Storage order of the right-hand side dense matrix
+inline RT bsrmatdmatmult( const BlockCompressedMatrix<Type,BS,IT>& A, const DenseMatrix<MT,SO>& B )
+{
+   using BT = If_t< HasConstDataAccess_v<MT>, const MT&, const ResultType_t<MT> >;
+
+   BLAZE_INTERNAL_ASSERT( A.columns() == (~B).rows(), "Invalid matrix sizes" );
+
+   BT B2( ~B );
+
+   RT C;
+   resize( C, A.rows(), B2.columns(), false );
+
+   const auto kernel = [&C,&A,&B2]( size_t begin, size_t end )
+   {
+      bsrmatdmatmultKernel( C, A, B2, begin, end );
+   };
+
+   if( canSMPReduce( A ) && A.rows() >= SMP_SMATDMATMULT_THRESHOLD && !isParallelSectionActive() ) {
+      smpFor( A.blockRows(), kernel );
+   }
+   else {
+      kernel( 0UL, A.blockRows() );
+   }
+
+   return C;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,1622 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/BlockCompressedMatrix.h
+//  \brief Implementation of a block compressed sparse row (BSR) matrix
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_BLOCKCOMPRESSEDMATRIX_H_
+#define _BLAZE_MATH_SPARSE_BLOCKCOMPRESSEDMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <utility>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/StaticMatrix.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/RelaxationFlag.h>
+#include <blaze/math/sparse/BlockCompressedKernels.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/Forward.h>
+#include <blaze/math/sparse/ValueIndexPair.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/math/typetraits/IsSparseMatrix.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Integral.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Unsigned.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup block_compressed_matrix BlockCompressedMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Block compressed sparse row (BSR) representation of a row-major \f$ M \times N \f$ matrix.
+// \ingroup block_compressed_matrix
+//
+// The BlockCompressedMatrix class template is an immutable, row-major sparse matrix in the block
+// compressed sparse row format (BSR). The matrix is partitioned into dense blocks of \a B rows
+// and \a B columns. Only the non-zero blocks are stored, each one as a
+// \c StaticMatrix<Type,B,B,rowMajor>, and only a single column index is stored per block. The
+// type of the elements, the size of the blocks, and the type of the stored block column indices
+// are specified via the three template parameters:
+
+   \code
+   template< typename Type, size_t B, typename IT >
+   class BlockCompressedMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. BlockCompressedMatrix can be used with any
+//          non-cv-qualified, non-reference, non-pointer element type.
+//  - B   : specifies the number of rows and columns of the blocks.
+//  - IT  : specifies the unsigned integral type of the stored block column indices. The default
+//          type is \c size_t.
+//
+// A BlockCompressedMatrix is created from any other matrix, in particular from a CompressedMatrix.
+// The number of rows and columns of the matrix have to be multiples of the block size. All blocks
+// that contain at least one element of the given matrix are stored. It is not possible to insert,
+// erase or modify the elements of the matrix, but all read operations of a sparse matrix are
+// supported. Note that all elements of the stored blocks are treated as non-zero elements, i.e.
+// the iterators also visit zero elements within a stored block. Therefore a BlockCompressedMatrix
+// can be converted back into a CompressedMatrix by means of a simple assignment:
+
+   \code
+   blaze::CompressedMatrix<double,blaze::rowMajor> A( 3000UL, 3000UL );
+   // ... Initialization of A with 3x3 blocks
+
+   blaze::BlockCompressedMatrix<double,3UL,uint32_t> B( A );  // Conversion to the BSR format
+
+   blaze::DynamicVector<double> x( 3000UL ), y;
+   blaze::DynamicMatrix<double> X( 3000UL, 16UL ), Y;
+   // ... Initialization of x and X
+
+   y = B * x;  // Block sparse matrix/dense vector multiplication
+   Y = B * X;  // Block sparse matrix/dense matrix multiplication
+
+   blaze::CompressedMatrix<double,blaze::rowMajor> C( B );  // Conversion to the CSR format
+   \endcode
+
+// The multiplications with a dense vector and a dense matrix operate on entire blocks by means
+// of the StaticMatrix kernels. In case the number of rows exceeds the according SMP threshold,
+// the block rows are distributed among the available threads. Note that the number of block
+// columns is restricted by the range of the index type. In case a larger matrix is converted,
+// a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , typename IT >  // Type of the stored indices
+class BlockCompressedMatrix
+   : public SparseMatrix< BlockCompressedMatrix<Type,B,IT>, rowMajor >
+{
+ public:
+   //**Type definitions****************************************************************************
+   using This           = BlockCompressedMatrix<Type,B,IT>;        //!< Type of this BlockCompressedMatrix instance.
+   using BaseType       = SparseMatrix<This,rowMajor>;             //!< Base type of this BlockCompressedMatrix instance.
+   using ResultType     = This;                                    //!< Result type for expression template evaluations.
+   using OppositeType   = CompressedMatrix<Type,columnMajor>;      //!< Result type with opposite storage order for expression template evaluations.
+   using TransposeType  = CompressedMatrix<Type,columnMajor>;      //!< Transpose type for expression template evaluations.
+   using ElementType    = Type;                                    //!< Type of the matrix elements.
+   using ReturnType     = const Type&;                             //!< Return type for expression template evaluations.
+   using CompositeType  = const This&;                             //!< Data type for composite expression templates.
+   using Reference      = const Type&;                             //!< Reference to a matrix element.
+   using ConstReference = const Type&;                             //!< Reference to a constant matrix element.
+   using BlockType      = StaticMatrix<Type,B,B,rowMajor>;         //!< Type of the stored blocks.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a BlockCompressedMatrix with different data/element type.
+   */
+   template< typename NewType >  // Data type of the other matrix
+   struct Rebind {
+      using Other = BlockCompressedMatrix<NewType,B,IT>;  //!< The type of the other BlockCompressedMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Resize struct definition********************************************************************
+   /*!\brief Resize mechanism to obtain a BlockCompressedMatrix with different fixed dimensions.
+   */
+   template< size_t NewM    // Number of rows of the other matrix
+           , size_t NewN >  // Number of columns of the other matrix
+   struct Resize {
+      using Other = BlockCompressedMatrix<Type,B,IT>;  //!< The type of the other BlockCompressedMatrix.
+   };
+   //**********************************************************************************************
+
+   //**ConstIterator class definition**************************************************************
+   /*!\brief Iterator over the elements of a single row of the block compressed matrix.
+   //
+   // The iterator traverses the stored blocks of the according block row and visits all \a B
+   // elements of the row within each block.
+   */
+   class ConstIterator
+   {
+    public:
+      //**Type definitions*************************************************************************
+      //! Element type of the block compressed matrix.
+      using Element = ValueIndexPair<Type>;
+
+      using IteratorCategory = std::forward_iterator_tag;  //!< The iterator category.
+      using ValueType        = Element;                    //!< Type of the underlying elements.
+      using PointerType      = const ConstIterator*;       //!< Pointer return type.
+      using ReferenceType    = const Element;              //!< Reference return type.
+      using DifferenceType   = ptrdiff_t;                  //!< Difference between two iterators.
+
+      // STL iterator requirements
+      using iterator_category = IteratorCategory;  //!< The iterator category.
+      using value_type        = ValueType;         //!< Type of the underlying elements.
+      using pointer           = PointerType;       //!< Pointer return type.
+      using reference         = ReferenceType;     //!< Reference return type.
+      using difference_type   = DifferenceType;    //!< Difference between two iterators.
+      //*******************************************************************************************
+
+      //**Default constructor**********************************************************************
+      /*!\brief Default constructor for the ConstIterator class.
+      */
+      inline ConstIterator() noexcept
+         : block_ ( nullptr )  // Pointer to the current block
+         , index_ ( nullptr )  // Pointer to the current block column index
+         , row_   ( 0UL )      // The row within the current block
+         , column_( 0UL )      // The column within the current block
+      {}
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the ConstIterator class.
+      //
+      // \param block Pointer to the initial block.
+      // \param index Pointer to the initial block column index.
+      // \param row The row within the blocks.
+      // \param column The initial column within the block.
+      */
+      inline ConstIterator( const BlockType* block, const IT* index, size_t row, size_t column ) noexcept
+         : block_ ( block  )  // Pointer to the current block
+         , index_ ( index  )  // Pointer to the current block column index
+         , row_   ( row    )  // The row within the current block
+         , column_( column )  // The column within the current block
+      {}
+      //*******************************************************************************************
+
+      //**Prefix increment operator****************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented iterator.
+      */
+      inline ConstIterator& operator++() noexcept {
+         if( ++column_ == B ) {
+            column_ = 0UL;
+            ++block_;
+            ++index_;
+         }
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix increment operator***************************************************************
+      /*!\brief Post-increment operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const ConstIterator operator++( int ) noexcept {
+         const ConstIterator tmp( *this );
+         ++(*this);
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the sparse matrix element at the current iterator position.
+      //
+      // \return The current sparse element.
+      */
+      inline ReferenceType operator*() const {
+         return Element( value(), index() );
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the sparse matrix element at the current iterator position.
+      //
+      // \return Pointer to the iterator, which provides the value() and index() functions.
+      */
+      inline PointerType operator->() const noexcept {
+         return this;
+      }
+      //*******************************************************************************************
+
+      //**Value function***************************************************************************
+      /*!\brief Access to the current value of the sparse element.
+      //
+      // \return The current value of the sparse element.
+      */
+      inline const Type& value() const noexcept {
+         return (*block_)(row_,column_);
+      }
+      //*******************************************************************************************
+
+      //**Index function***************************************************************************
+      /*!\brief Access to the current index of the sparse element.
+      //
+      // \return The current index of the sparse element.
+      */
+      inline size_t index() const noexcept {
+         return (*index_)*B + column_;
+      }
+      //*******************************************************************************************
+
+      //**Equality operator************************************************************************
+      /*!\brief Equality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side ConstIterator object.
+      // \return \a true if the iterators refer to the same element, \a false if not.
+      */
+      inline bool operator==( const ConstIterator& rhs ) const noexcept {
+         return index_ == rhs.index_ && column_ == rhs.column_;
+      }
+      //*******************************************************************************************
+
+      //**Inequality operator**********************************************************************
+      /*!\brief Inequality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side ConstIterator object.
+      // \return \a true if the iterators don't refer to the same element, \a false if they do.
+      */
+      inline bool operator!=( const ConstIterator& rhs ) const noexcept {
+         return !( *this == rhs );
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Calculating the number of elements between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side ConstIterator object.
+      // \return The number of elements between the two ConstIterator objects.
+      */
+      inline DifferenceType operator-( const ConstIterator& rhs ) const noexcept {
+         return ( index_ - rhs.index_ ) * DifferenceType( B ) +
+                ( DifferenceType( column_ ) - DifferenceType( rhs.column_ ) );
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      const BlockType* block_;   //!< Pointer to the current block.
+      const IT*        index_;   //!< Pointer to the current block column index.
+      size_t           row_;     //!< The row within the current block.
+      size_t           column_;  //!< The column within the current block.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   using Iterator = ConstIterator;  //!< Iterator over non-constant elements.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   static constexpr bool smpAssignable = !IsSMPAssignable_v<Type>;
+   //**********************************************************************************************
+
+   //**Block size**********************************************************************************
+   //! The number of rows and columns of the blocks.
+   static constexpr size_t blockSize = B;
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline BlockCompressedMatrix() noexcept;
+
+   template< typename MT, bool SO >
+   inline BlockCompressedMatrix( const Matrix<MT,SO>& m );
+
+   inline BlockCompressedMatrix( const BlockCompressedMatrix& sm );
+   inline BlockCompressedMatrix( BlockCompressedMatrix&& sm ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~BlockCompressedMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline ConstReference operator()( size_t i, size_t j ) const noexcept;
+   inline ConstReference at( size_t i, size_t j ) const;
+   inline ConstIterator  begin ( size_t i ) const noexcept;
+   inline ConstIterator  cbegin( size_t i ) const noexcept;
+   inline ConstIterator  end   ( size_t i ) const noexcept;
+   inline ConstIterator  cend  ( size_t i ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline BlockCompressedMatrix& operator=( const BlockCompressedMatrix& rhs );
+   inline BlockCompressedMatrix& operator=( BlockCompressedMatrix&& rhs ) noexcept;
+
+   template< typename MT, bool SO >
+   inline BlockCompressedMatrix& operator=( const Matrix<MT,SO>& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const noexcept;
+   inline size_t columns() const noexcept;
+   inline size_t capacity() const noexcept;
+   inline size_t capacity( size_t i ) const noexcept;
+   inline size_t nonZeros() const noexcept;
+   inline size_t nonZeros( size_t i ) const noexcept;
+   inline void   clear();
+   inline void   swap( BlockCompressedMatrix& sm ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Block access functions**********************************************************************
+   /*!\name Block access functions */
+   //@{
+   inline size_t           blockRows() const noexcept;
+   inline size_t           blockColumns() const noexcept;
+   inline size_t           nonZeroBlocks() const noexcept;
+   inline size_t           nonZeroBlocks( size_t I ) const noexcept;
+   inline const BlockType* blocks( size_t I ) const noexcept;
+   inline const IT*        blockIndices( size_t I ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline ConstIterator find      ( size_t i, size_t j ) const;
+   inline ConstIterator lowerBound( size_t i, size_t j ) const;
+   inline ConstIterator upperBound( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Debugging functions*************************************************************************
+   /*!\name Debugging functions */
+   //@{
+   inline bool isIntact() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   inline bool canSMPAssign() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT >
+   void build( const MT& sm );
+
+   inline size_t lowerBlock( size_t I, size_t J ) const noexcept;
+
+   static inline size_t checkIndexRange( size_t n );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t     m_;        //!< The current number of rows of the matrix.
+   size_t     n_;        //!< The current number of columns of the matrix.
+   size_t*    begin_;    //!< Offsets of the first block of each block row.
+   IT*        indices_;  //!< The block column indices of the stored blocks.
+   BlockType* blocks_;   //!< The stored blocks.
+
+   static const Type zero_;  //!< Neutral element for accesses to zero elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_CONSTRAINT_MUST_BE_INTEGRAL_TYPE     ( IT );
+   BLAZE_CONSTRAINT_MUST_BE_UNSIGNED_TYPE     ( IT );
+   BLAZE_STATIC_ASSERT( B > 0UL );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+template< typename Type, size_t B, typename IT >
+const Type BlockCompressedMatrix<Type,B,IT>::zero_{};
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for BlockCompressedMatrix.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , typename IT >  // Type of the stored indices
+inline BlockCompressedMatrix<Type,B,IT>::BlockCompressedMatrix() noexcept
+   : m_      ( 0UL )      // The current number of rows of the matrix
+   , n_      ( 0UL )      // The current number of columns of the matrix
+   , begin_  ( nullptr )  // Offsets of the first block of each block row
+   , indices_( nullptr )  // The block column indices of the stored blocks
+   , blocks_ ( nullptr )  // The stored blocks
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different matrices.
+//
+// \param m Matrix to be converted.
+// \exception std::invalid_argument Matrix dimensions are not a multiple of the block size.
+// \exception std::invalid_argument Number of block columns exceeds the range of the index type.
+//
+// This constructor converts the given matrix into the block compressed sparse row format. All
+// blocks containing at least one element of the given matrix are stored. Row-major sparse
+// matrices are converted directly, all other matrices are converted via a temporary row-major
+// CompressedMatrix.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , typename IT >  // Type of the stored indices
+template< typename MT    // Type of the foreign matrix
+        , bool SO >      // Storage order of the foreign matrix
+inline BlockCompressedMatrix<Type,B,IT>::BlockCompressedMatrix( const Matrix<MT,SO>& m )
+   : BlockCompressedMatrix()
+{
+   using TmpType = If_t< IsSparseMatrix_v<MT> && IsRowMajorMatrix_v<MT>
+                       , CompositeType_t<MT>
+                       , const CompressedMatrix<Type,rowMajor> >;
+
+   TmpType tmp( ~m );
+
+   build( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for BlockCompressedMatrix.
+//
+// \param sm Block compressed matrix to be copied.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , typename IT >  // Type of the stored indices
+inline BlockCompressedMatrix<Type,B,IT>::BlockCompressedMatrix( const BlockCompressedMatrix& sm )
+   : BlockCompressedMatrix()
+{
+   if( sm.begin_ == nullptr ) {
+      n_ = sm.n_;
+      return;
+   }
+
+   const size_t M( sm.blockRows() );
+   const size_t nonzeros( sm.nonZeroBlocks() );
+
+   begin_   = new size_t[M+1UL];
+   indices_ = allocate<IT>( nonzeros );
+   blocks_  = allocate<BlockType>( nonzeros );
+
+   m_ = sm.m_;
+   n_ = sm.n_;
+
+   std::copy( sm.begin_, sm.begin_+M+1UL, begin_ );
+   std::copy( sm.indices_, sm.indices_+nonzeros, indices_ );
+   std::copy( sm.blocks_, sm.blocks_+nonzeros, blocks_ );
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for BlockCompressedMatrix.
+//
+// \param sm The block compressed matrix to be moved into this instance.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , typename IT >  // Type of the stored indices
+inline BlockCompressedMatrix<Type,B,IT>::BlockCompressedMatrix( BlockCompressedMatrix&& sm ) noexcept
+   : BlockCompressedMatrix()
+{
+   swap( sm );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for BlockCompressedMatrix.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , typename IT >  // Type of the stored indices
+inline BlockCompressedMatrix<Type,B,IT>::~BlockCompressedMatrix()
+{
+   delete[] begin_;
+   deallocate( indices_ );
+   deallocate( blocks_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the block compressed matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , typename IT >  // Type of the stored indices
+inline typename BlockCompressedMatrix<Type,B,IT>::ConstReference
+   BlockCompressedMatrix<Type,B,IT>::operator()( size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < n_, "Invalid column access index" );
+
+   const size_t I( i/B );
+   const size_t J( j/B );
+   const size_t k( lowerBlock( I, J ) );
+
+   if( k == begin_[I+1UL] || indices_[k] != J )
+      return zero_;
+   else
+      return blocks_[k](i%B,j%B);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the block compressed matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// In contrast to the function call operator this function always performs a check of the
+// given access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , typename IT >  // Type of the stored indices
+inline typename BlockCompressedMatrix<Type,B,IT>::ConstReference
+   BlockCompressedMatrix<Type,B,IT>::at( size_t i, size_t j ) const
+{
+   if( i >= m_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first element of row \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , typename IT >  // Type of the stored indices
+inline typename BlockCompressedMatrix<Type,B,IT>::ConstIterator
+   BlockCompressedMatrix<Type,B,IT>::begin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid block compressed matrix access index" );
+
+   const size_t k( begin_[i/B] );
+
+   return ConstIterator( blocks_+k, indices_+k, i%B, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first element of row \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , typename IT >  // Type of the stored indices
+inline typename BlockCompressedMatrix<Type,B,IT>::ConstIterator
+   BlockCompressedMatrix<Type,B,IT>::cbegin( size_t i ) const noexcept
+{
+   return begin( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last element of row \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , typename IT >  // Type of the stored indices
+inline typename BlockCompressedMatrix<Type,B,IT>::ConstIterator
+   BlockCompressedMatrix<Type,B,IT>::end( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid block compressed matrix access index" );
+
+   const size_t k( begin_[i/B+1UL] );
+
+   return ConstIterator( blocks_+k, indices_+k, i%B, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last element of row \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , typename IT >  // Type of the stored indices
+inline typename BlockCompressedMatrix<Type,B,IT>::ConstIterator
+   BlockCompressedMatrix<Type,B,IT>::cend( size_t i ) const noexcept
+{
+   return end( i );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for BlockCompressedMatrix.
+//
+// \param rhs Block compressed matrix to be copied.
+// \return Reference to the assigned matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , typename IT >  // Type of the stored indices
+inline BlockCompressedMatrix<Type,B,IT>&
+   BlockCompressedMatrix<Type,B,IT>::operator=( const BlockCompressedMatrix& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   BlockCompressedMatrix tmp( rhs );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for BlockCompressedMatrix.
+//
+// \param rhs The block compressed matrix to be moved into this instance.
+// \return Reference to the assigned matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , typename IT >  // Type of the stored indices
+inline BlockCompressedMatrix<Type,B,IT>&
+   BlockCompressedMatrix<Type,B,IT>::operator=( BlockCompressedMatrix&& rhs ) noexcept
+{
+   swap( rhs );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different matrices.
+//
+// \param rhs Matrix to be converted.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Matrix dimensions are not a multiple of the block size.
+// \exception std::invalid_argument Number of block columns exceeds the range of the index type.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , typename IT >  // Type of the stored indices
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO >      // Storage order of the right-hand side matrix
+inline BlockCompressedMatrix<Type,B,IT>&
+   BlockCompressedMatrix<Type,B,IT>::operator=( const Matrix<MT,SO>& rhs )
+{
+   BlockCompressedMatrix tmp( ~rhs );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the block compressed matrix.
+//
+// \return The number of rows of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , typename IT >  // Type of the stored indices
+inline size_t BlockCompressedMatrix<Type,B,IT>::rows() const noexcept
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the block compressed matrix.
+//
+// \return The number of columns of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , typename IT >  // Type of the stored indices
+inline size_t BlockCompressedMatrix<Type,B,IT>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of stored elements.
+//
+// \return The capacity of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , typename IT >  // Type of the stored indices
+inline size_t BlockCompressedMatrix<Type,B,IT>::capacity() const noexcept
+{
+   return nonZeroBlocks() * B * B;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of stored elements of row \a i.
+//
+// \param i The row index.
+// \return The number of stored elements of row \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , typename IT >  // Type of the stored indices
+inline size_t BlockCompressedMatrix<Type,B,IT>::capacity( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row access index" );
+   return nonZeroBlocks( i/B ) * B;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of non-zero elements in the block compressed matrix.
+//
+// \return The number of non-zero elements in the matrix.
+//
+// Note that all elements of the stored blocks are counted, including zero elements.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , typename IT >  // Type of the stored indices
+inline size_t BlockCompressedMatrix<Type,B,IT>::nonZeros() const noexcept
+{
+   return nonZeroBlocks() * B * B;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in row \a i.
+//
+// \param i The row index.
+// \return The number of non-zero elements of row \a i.
+//
+// Note that all elements of the stored blocks are counted, including zero elements.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , typename IT >  // Type of the stored indices
+inline size_t BlockCompressedMatrix<Type,B,IT>::nonZeros( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row access index" );
+   return nonZeroBlocks( i/B ) * B;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the block compressed matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the matrix is 0.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , typename IT >  // Type of the stored indices
+inline void BlockCompressedMatrix<Type,B,IT>::clear()
+{
+   BlockCompressedMatrix tmp;
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two block compressed matrices.
+//
+// \param sm The matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , typename IT >  // Type of the stored indices
+inline void BlockCompressedMatrix<Type,B,IT>::swap( BlockCompressedMatrix& sm ) noexcept
+{
+   std::swap( m_, sm.m_ );
+   std::swap( n_, sm.n_ );
+   std::swap( begin_, sm.begin_ );
+   std::swap( indices_, sm.indices_ );
+   std::swap( blocks_, sm.blocks_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Converting the given row-major sparse matrix into the block compressed format.
+//
+// \param sm The row-major sparse matrix to be converted.
+// \return void
+// \exception std::invalid_argument Matrix dimensions are not a multiple of the block size.
+// \exception std::invalid_argument Number of block columns exceeds the range of the index type.
+//
+// This function must only be called on a matrix in default state. In a first pass, the number
+// of distinct block columns of each block row is determined. In a second pass, the block column
+// indices are collected and sorted and the elements are copied into the according blocks.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , typename IT >  // Type of the stored indices
+template< typename MT >  // Type of the row-major sparse matrix
+void BlockCompressedMatrix<Type,B,IT>::build( const MT& sm )
+{
+   BLAZE_INTERNAL_ASSERT( begin_ == nullptr, "Invalid block compressed matrix detected" );
+
+   if( sm.rows() % B != 0UL || sm.columns() % B != 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix dimensions are not a multiple of the block size" );
+   }
+
+   const size_t M( sm.rows() / B );
+   const size_t N( checkIndexRange( sm.columns() / B ) );
+
+   if( M == 0UL ) {
+      n_ = sm.columns();
+      return;
+   }
+
+   begin_ = new size_t[M+1UL];
+
+   // Counting the non-zero blocks of each block row
+   std::vector<size_t> marker( N, M );
+
+   begin_[0UL] = 0UL;
+   for( size_t I=0UL; I<M; ++I )
+   {
+      size_t count( 0UL );
+
+      for( size_t i=I*B; i<(I+1UL)*B; ++i ) {
+         for( auto element=sm.begin(i); element!=sm.end(i); ++element ) {
+            const size_t J( element->index() / B );
+            if( marker[J] != I ) {
+               marker[J] = I;
+               ++count;
+            }
+         }
+      }
+
+      begin_[I+1UL] = begin_[I] + count;
+   }
+
+   const size_t nonzeros( begin_[M] );
+
+   indices_ = allocate<IT>( nonzeros );
+   blocks_  = allocate<BlockType>( nonzeros );
+
+   m_ = sm.rows();
+   n_ = sm.columns();
+
+   // Collecting the block column indices and transferring the elements
+   std::fill( marker.begin(), marker.end(), M );
+
+   for( size_t I=0UL; I<M; ++I )
+   {
+      size_t k( begin_[I] );
+
+      for( size_t i=I*B; i<(I+1UL)*B; ++i ) {
+         for( auto element=sm.begin(i); element!=sm.end(i); ++element ) {
+            const size_t J( element->index() / B );
+            if( marker[J] != I ) {
+               marker[J] = I;
+               indices_[k++] = static_cast<IT>( J );
+            }
+         }
+      }
+
+      BLAZE_INTERNAL_ASSERT( k == begin_[I+1UL], "Invalid number of blocks detected" );
+
+      std::sort( indices_+begin_[I], indices_+k );
+
+      for( size_t l=begin_[I]; l<k; ++l ) {
+         marker[indices_[l]] = l;
+      }
+
+      for( size_t i=I*B; i<(I+1UL)*B; ++i ) {
+         for( auto element=sm.begin(i); element!=sm.end(i); ++element ) {
+            const size_t j( element->index() );
+            blocks_[marker[j/B]](i%B,j%B) = element->value();
+         }
+      }
+
+      for( size_t l=begin_[I]; l<k; ++l ) {
+         marker[indices_[l]] = I;
+      }
+   }
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the position of the first block of block row \a I not left of block column \a J.
+//
+// \param I The block row index.
+// \param J The block column index.
+// \return The position of the first block with a block column index not less than \a J.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , typename IT >  // Type of the stored indices
+inline size_t BlockCompressedMatrix<Type,B,IT>::lowerBlock( size_t I, size_t J ) const noexcept
+{
+   const IT* const first( indices_+begin_[I] );
+   const IT* const last ( indices_+begin_[I+1UL] );
+
+   return begin_[I] + size_t( std::lower_bound( first, last, J,
+      []( const IT& index, size_t value ) { return index < value; } ) - first );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checks whether the given number of block columns can be represented by the index type.
+//
+// \param n The number of block columns of the matrix.
+// \return The given number of block columns.
+// \exception std::invalid_argument Number of block columns exceeds the range of the index type.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , typename IT >  // Type of the stored indices
+inline size_t BlockCompressedMatrix<Type,B,IT>::checkIndexRange( size_t n )
+{
+   if( n > 0UL && n-1UL > static_cast<size_t>( std::numeric_limits<IT>::max() ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Number of block columns exceeds the range of the index type" );
+   }
+
+   return n;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BLOCK ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of block rows.
+//
+// \return The number of block rows of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , typename IT >  // Type of the stored indices
+inline size_t BlockCompressedMatrix<Type,B,IT>::blockRows() const noexcept
+{
+   return m_ / B;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of block columns.
+//
+// \return The number of block columns of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , typename IT >  // Type of the stored indices
+inline size_t BlockCompressedMatrix<Type,B,IT>::blockColumns() const noexcept
+{
+   return n_ / B;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of stored blocks.
+//
+// \return The number of non-zero blocks of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , typename IT >  // Type of the stored indices
+inline size_t BlockCompressedMatrix<Type,B,IT>::nonZeroBlocks() const noexcept
+{
+   return ( begin_ != nullptr )?( begin_[m_/B] ):( 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of stored blocks of block row \a I.
+//
+// \param I The block row index.
+// \return The number of non-zero blocks of block row \a I.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , typename IT >  // Type of the stored indices
+inline size_t BlockCompressedMatrix<Type,B,IT>::nonZeroBlocks( size_t I ) const noexcept
+{
+   BLAZE_USER_ASSERT( I < blockRows(), "Invalid block row access index" );
+   return begin_[I+1UL] - begin_[I];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a pointer to the first block of block row \a I.
+//
+// \param I The block row index.
+// \return Pointer to the first block of the block row.
+//
+// The blocks of a block row are stored in the order of increasing block column indices.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , typename IT >  // Type of the stored indices
+inline const typename BlockCompressedMatrix<Type,B,IT>::BlockType*
+   BlockCompressedMatrix<Type,B,IT>::blocks( size_t I ) const noexcept
+{
+   BLAZE_USER_ASSERT( I < blockRows(), "Invalid block row access index" );
+   return blocks_ + begin_[I];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a pointer to the block column indices of block row \a I.
+//
+// \param I The block row index.
+// \return Pointer to the first block column index of the block row.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , typename IT >  // Type of the stored indices
+inline const IT* BlockCompressedMatrix<Type,B,IT>::blockIndices( size_t I ) const noexcept
+{
+   BLAZE_USER_ASSERT( I < blockRows(), "Invalid block row access index" );
+   return indices_ + begin_[I];
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , typename IT >  // Type of the stored indices
+inline typename BlockCompressedMatrix<Type,B,IT>::ConstIterator
+   BlockCompressedMatrix<Type,B,IT>::find( size_t i, size_t j ) const
+{
+   const ConstIterator pos( lowerBound( i, j ) );
+   if( pos != end( i ) && pos->index() == j )
+      return pos;
+   else return end( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less than the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less than the given index, end() iterator otherwise.
+//
+// The binary search is performed on the block column indices of the according block row.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , typename IT >  // Type of the stored indices
+inline typename BlockCompressedMatrix<Type,B,IT>::ConstIterator
+   BlockCompressedMatrix<Type,B,IT>::lowerBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row access index" );
+
+   const size_t I( i/B );
+   const size_t J( j/B );
+   const size_t k( lowerBlock( I, J ) );
+
+   if( k != begin_[I+1UL] && indices_[k] == J )
+      return ConstIterator( blocks_+k, indices_+k, i%B, j%B );
+   else
+      return ConstIterator( blocks_+k, indices_+k, i%B, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater than the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater than the given index, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , typename IT >  // Type of the stored indices
+inline typename BlockCompressedMatrix<Type,B,IT>::ConstIterator
+   BlockCompressedMatrix<Type,B,IT>::upperBound( size_t i, size_t j ) const
+{
+   ConstIterator pos( lowerBound( i, j ) );
+   if( pos != end( i ) && pos->index() == j )
+      ++pos;
+   return pos;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEBUGGING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the block compressed matrix are intact.
+//
+// \return \a true in case the block compressed matrix's invariants are intact, \a false otherwise.
+//
+// This function checks whether the invariants of the block compressed matrix are intact, i.e. if
+// the dimensions are multiples of the block size and if the block column indices of each block
+// row are strictly increasing and within the range of block columns.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , typename IT >  // Type of the stored indices
+inline bool BlockCompressedMatrix<Type,B,IT>::isIntact() const noexcept
+{
+   if( m_ % B != 0UL || n_ % B != 0UL )
+      return false;
+
+   if( m_ == 0UL )
+      return ( begin_ == nullptr );
+
+   if( begin_[0UL] != 0UL )
+      return false;
+
+   for( size_t I=0UL; I<blockRows(); ++I ) {
+      if( begin_[I+1UL] < begin_[I] )
+         return false;
+      for( size_t k=begin_[I]; k<begin_[I+1UL]; ++k ) {
+         if( indices_[k] >= blockColumns() || ( k > begin_[I] && indices_[k-1UL] >= indices_[k] ) )
+            return false;
+      }
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t B          // Number of rows and columns of the blocks
+        , typename IT >     // Type of the stored indices
+template< typename Other >  // Data type of the foreign expression
+inline bool BlockCompressedMatrix<Type,B,IT>::canAlias( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t B          // Number of rows and columns of the blocks
+        , typename IT >     // Type of the stored indices
+template< typename Other >  // Data type of the foreign expression
+inline bool BlockCompressedMatrix<Type,B,IT>::isAliased( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+//
+// This function returns whether the matrix can be used in SMP assignments. In contrast to the
+// \a smpAssignable member enumeration, which is based solely on compile time information, this
+// function additionally provides runtime information (as for instance the current number of
+// rows and/or columns of the matrix).
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , typename IT >  // Type of the stored indices
+inline bool BlockCompressedMatrix<Type,B,IT>::canSMPAssign() const noexcept
+{
+   return true;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BLOCKCOMPRESSEDMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name BlockCompressedMatrix operators */
+//@{
+template< typename Type, size_t B, typename IT >
+void clear( BlockCompressedMatrix<Type,B,IT>& m );
+
+template< RelaxationFlag RF, typename Type, size_t B, typename IT >
+bool isDefault( const BlockCompressedMatrix<Type,B,IT>& m );
+
+template< typename Type, size_t B, typename IT >
+bool isIntact( const BlockCompressedMatrix<Type,B,IT>& m ) noexcept;
+
+template< typename Type, size_t B, typename IT >
+void swap( BlockCompressedMatrix<Type,B,IT>& a, BlockCompressedMatrix<Type,B,IT>& b ) noexcept;
+
+template< typename Type, size_t B, typename IT, typename VT >
+const MultTrait_t< BlockCompressedMatrix<Type,B,IT>, VT >
+   operator*( const BlockCompressedMatrix<Type,B,IT>& mat, const DenseVector<VT,false>& vec );
+
+template< typename Type, size_t B, typename IT, typename MT, bool SO >
+const MultTrait_t< BlockCompressedMatrix<Type,B,IT>, MT >
+   operator*( const BlockCompressedMatrix<Type,B,IT>& lhs, const DenseMatrix<MT,SO>& rhs );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given block compressed matrix.
+// \ingroup block_compressed_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , typename IT >  // Type of the stored indices
+inline void clear( BlockCompressedMatrix<Type,B,IT>& m )
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given block compressed matrix is in default state.
+// \ingroup block_compressed_matrix
+//
+// \param m The matrix to be tested for its default state.
+// \return \a true in case the given matrix's rows and columns are zero, \a false otherwise.
+*/
+template< RelaxationFlag RF  // Relaxation flag
+        , typename Type      // Data type of the matrix
+        , size_t B           // Number of rows and columns of the blocks
+        , typename IT >      // Type of the stored indices
+inline bool isDefault( const BlockCompressedMatrix<Type,B,IT>& m )
+{
+   return ( m.rows() == 0UL && m.columns() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the given block compressed matrix are intact.
+// \ingroup block_compressed_matrix
+//
+// \param m The block compressed matrix to be tested.
+// \return \a true in case the given matrix's invariants are intact, \a false otherwise.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , typename IT >  // Type of the stored indices
+inline bool isIntact( const BlockCompressedMatrix<Type,B,IT>& m ) noexcept
+{
+   return m.isIntact();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two block compressed matrices.
+// \ingroup block_compressed_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , typename IT >  // Type of the stored indices
+inline void swap( BlockCompressedMatrix<Type,B,IT>& a, BlockCompressedMatrix<Type,B,IT>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a block compressed matrix and a dense
+//        vector (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup block_compressed_matrix
+//
+// \param mat The left-hand side block compressed matrix for the multiplication.
+// \param vec The right-hand side dense vector for the multiplication.
+// \return The resulting vector.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This operator computes the product of a block compressed matrix and a dense vector by means
+// of a dedicated kernel that operates on entire blocks (see bsrmatdvecmult()). In contrast to
+// the general multiplication operator, the product is evaluated immediately.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , typename IT    // Type of the stored indices
+        , typename VT >  // Type of the right-hand side dense vector
+inline const MultTrait_t< BlockCompressedMatrix<Type,B,IT>, VT >
+   operator*( const BlockCompressedMatrix<Type,B,IT>& mat, const DenseVector<VT,false>& vec )
+{
+   using RT = MultTrait_t< BlockCompressedMatrix<Type,B,IT>, VT >;
+
+   BLAZE_FUNCTION_TRACE;
+
+   if( mat.columns() != (~vec).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix and vector sizes do not match" );
+   }
+
+   return bsrmatdvecmult<RT>( mat, ~vec );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a block compressed matrix and a dense
+//        matrix (\f$ C=A*B \f$).
+// \ingroup block_compressed_matrix
+//
+// \param lhs The left-hand side block compressed matrix for the multiplication.
+// \param rhs The right-hand side dense matrix for the multiplication.
+// \return The resulting matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This operator computes the product of a block compressed matrix and a dense matrix by means
+// of a dedicated kernel that operates on entire blocks (see bsrmatdmatmult()). In contrast to
+// the general multiplication operator, the product is evaluated immediately.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , typename IT    // Type of the stored indices
+        , typename MT    // Type of the right-hand side dense matrix
+        , bool SO >      // Storage order of the right-hand side dense matrix
+inline const MultTrait_t< BlockCompressedMatrix<Type,B,IT>, MT >
+   operator*( const BlockCompressedMatrix<Type,B,IT>& lhs, const DenseMatrix<MT,SO>& rhs )
+{
+   using RT = MultTrait_t< BlockCompressedMatrix<Type,B,IT>, MT >;
+
+   BLAZE_FUNCTION_TRACE;
+
+   if( lhs.columns() != (~rhs).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   return bsrmatdmatmult<RT>( lhs, ~rhs );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -779,9 +779,7 @@ template< typename MT    // Type of the foreign compressed matrix
 inline CompressedMatrix<Type,SO>::CompressedMatrix( const SparseMatrix<MT,SO2>& sm )
    : CompressedMatrix( (~sm).rows(), (~sm).columns(), (~sm).nonZeros() )
 {
-   using blaze::assign;
-
-   assign( *this, ~sm );
+   smpAssign( *this, ~sm );
 }
 //*************************************************************************************************
 
@@ -1276,8 +1274,6 @@ template< typename MT    // Type of the right-hand side compressed matrix
 inline CompressedMatrix<Type,SO>&
    CompressedMatrix<Type,SO>::operator=( const SparseMatrix<MT,SO2>& rhs )
 {
-   using blaze::assign;
-
    if( (~rhs).canAlias( this ) ||
        (~rhs).rows()     > capacity_ ||
        (~rhs).nonZeros() > capacity() ) {
@@ -1289,7 +1285,7 @@ inline CompressedMatrix<Type,SO>&
       reset();
 
       if( !IsZero_v<MT> ) {
-         assign( *this, ~rhs );
+         smpAssign( *this, ~rhs );
       }
    }
 
@@ -3561,9 +3557,7 @@ template< typename MT      // Type of the foreign compressed matrix
 inline CompressedMatrix<Type,true>::CompressedMatrix( const SparseMatrix<MT,SO>& sm )
    : CompressedMatrix( (~sm).rows(), (~sm).columns(), (~sm).nonZeros() )
 {
-   using blaze::assign;
-
-   assign( *this, ~sm );
+   smpAssign( *this, ~sm );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -4050,8 +4044,6 @@ template< typename MT      // Type of the right-hand side compressed matrix
 inline CompressedMatrix<Type,true>&
    CompressedMatrix<Type,true>::operator=( const SparseMatrix<MT,SO>& rhs )
 {
-   using blaze::assign;
-
    if( (~rhs).canAlias( this ) ||
        (~rhs).columns()  > capacity_ ||
        (~rhs).nonZeros() > capacity() ) {
@@ -4063,7 +4055,7 @@ inline CompressedMatrix<Type,true>&
       reset();
 
       if( !IsZero_v<MT> ) {
-         assign( *this, ~rhs );
+         smpAssign( *this, ~rhs );
       }
    }
 
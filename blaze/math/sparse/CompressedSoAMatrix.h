@@ -0,0 +1,5826 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/CompressedSoAMatrix.h
+//  \brief Implementation of a compressed MxN matrix with separate value and index arrays
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_COMPRESSEDSOAMATRIX_H_
+#define _BLAZE_MATH_SPARSE_COMPRESSEDSOAMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/RequiresEvaluation.h>
+#include <blaze/math/constraints/Symmetric.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/InitializerList.h>
+#include <blaze/math/RelaxationFlag.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/Forward.h>
+#include <blaze/math/sparse/MatrixAccessProxy.h>
+#include <blaze/math/sparse/SoAIterator.h>
+#include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/math/typetraits/IsShrinkable.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/math/typetraits/IsStrictlyLower.h>
+#include <blaze/math/typetraits/IsStrictlyUpper.h>
+#include <blaze/math/typetraits/IsUpper.h>
+#include <blaze/math/typetraits/IsZero.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Transfer.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Integral.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Unsigned.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup compressed_soa_matrix CompressedSoAMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Compressed \f$ M \times N \f$ matrix with separate value and index arrays.
+// \ingroup compressed_soa_matrix
+//
+// The CompressedSoAMatrix class template is a sibling of the CompressedMatrix class template.
+// Whereas CompressedMatrix stores its non-zero elements as an array of value-index-pairs, the
+// CompressedSoAMatrix stores the values and the indices of the non-zero elements in two separate,
+// contiguous arrays (structure of arrays). The type of the elements, the storage order, and the
+// type of the stored indices can be specified via the three template parameters:
+
+   \code
+   template< typename Type, bool SO, typename IT >
+   class CompressedSoAMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. CompressedSoAMatrix can be used with
+//          any non-cv-qualified, non-reference, non-pointer element type.
+//  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//          The default value is blaze::rowMajor.
+//  - IT  : specifies the unsigned integral type of the stored indices. The default type is
+//          \c size_t. With a smaller index type (as for instance \c uint32_t) the size of the
+//          index array is reduced accordingly.
+//
+// The split storage reduces the memory traffic of kernels that only touch either the values or
+// the indices and enables the use of SIMD gather instructions in the sparse matrix/dense vector
+// multiplication. Apart from that, CompressedSoAMatrix provides the same interface as the
+// CompressedMatrix class template:
+
+   \code
+   using blaze::rowMajor;
+
+   blaze::CompressedSoAMatrix<double,rowMajor,uint32_t> A( 4, 3 );
+
+   A(1,2) = 2.0;            // Access via the function call operator
+   A.set( 2, 0, -1.2 );     // Setting an element
+   A.insert( 2, 1, 3.7 );   // Inserting a new element
+   A.reserve( 3, 2 );       // Reserving space for 2 non-zero elements in row 3
+   A.append( 3, 1, -2.1 );  // Appending the value -2.1 at column index 1 in row 3
+   A.append( 3, 2,  1.4 );  // Appending the value 1.4 at column index 2 in row 3
+
+   for( auto it=A.begin(1); it!=A.end(1); ++it ) {
+      ... = it->value();  // Access to the value of the non-zero element
+      ... = it->index();  // Access to the index of the non-zero element
+   }
+   \endcode
+
+// Note that the number of columns of a row-major matrix and the number of rows of a column-major
+// matrix are restricted by the range of the index type. In case a matrix is created or resized
+// beyond this range, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+class CompressedSoAMatrix
+   : public SparseMatrix< CompressedSoAMatrix<Type,SO,IT>, SO >
+{
+ private:
+   //**Private class Uninitialized*****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Auxiliary helper class for the construction of compressed matrices.
+   */
+   struct Uninitialized {};
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   using This           = CompressedSoAMatrix<Type,SO,IT>;   //!< Type of this CompressedSoAMatrix instance.
+   using BaseType       = SparseMatrix<This,SO>;             //!< Base type of this CompressedSoAMatrix instance.
+   using ResultType     = This;                              //!< Result type for expression template evaluations.
+   using OppositeType   = CompressedSoAMatrix<Type,!SO,IT>;  //!< Result type with opposite storage order for expression template evaluations.
+   using TransposeType  = CompressedSoAMatrix<Type,!SO,IT>;  //!< Transpose type for expression template evaluations.
+   using ElementType    = Type;                              //!< Type of the compressed matrix elements.
+   using IndexType      = IT;                                //!< Type of the stored indices.
+   using ReturnType     = const Type&;                       //!< Return type for expression template evaluations.
+   using CompositeType  = const This&;                       //!< Data type for composite expression templates.
+   using Reference      = MatrixAccessProxy<This>;           //!< Reference to a compressed matrix value.
+   using ConstReference = const Type&;                       //!< Reference to a constant compressed matrix value.
+   using Iterator       = SoAIterator<Type,IT>;              //!< Iterator over non-constant elements.
+   using ConstIterator  = SoAIterator<const Type,IT>;        //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a CompressedSoAMatrix with different data/element type.
+   */
+   template< typename NewType >  // Data type of the other matrix
+   struct Rebind {
+      using Other = CompressedSoAMatrix<NewType,SO,IT>;  //!< The type of the other CompressedSoAMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Resize struct definition********************************************************************
+   /*!\brief Resize mechanism to obtain a CompressedSoAMatrix with different fixed dimensions.
+   */
+   template< size_t NewM    // Number of rows of the other matrix
+           , size_t NewN >  // Number of columns of the other matrix
+   struct Resize {
+      using Other = CompressedSoAMatrix<Type,SO,IT>;  //!< The type of the other CompressedSoAMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   static constexpr bool smpAssignable = !IsSMPAssignable_v<Type>;
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline CompressedSoAMatrix();
+   inline CompressedSoAMatrix( size_t m, size_t n );
+   inline CompressedSoAMatrix( size_t m, size_t n, size_t nonzeros );
+          CompressedSoAMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros );
+   inline CompressedSoAMatrix( initializer_list< initializer_list<Type> > list );
+
+   inline CompressedSoAMatrix( const CompressedSoAMatrix& sm );
+   inline CompressedSoAMatrix( CompressedSoAMatrix&& sm ) noexcept;
+
+   template< typename MT, bool SO2 > inline CompressedSoAMatrix( const DenseMatrix<MT,SO2>&  dm );
+   template< typename MT, bool SO2 > inline CompressedSoAMatrix( const SparseMatrix<MT,SO2>& sm );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~CompressedSoAMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator()( size_t i, size_t j ) noexcept;
+   inline ConstReference operator()( size_t i, size_t j ) const noexcept;
+   inline Reference      at( size_t i, size_t j );
+   inline ConstReference at( size_t i, size_t j ) const;
+   inline Iterator       begin ( size_t i ) noexcept;
+   inline ConstIterator  begin ( size_t i ) const noexcept;
+   inline ConstIterator  cbegin( size_t i ) const noexcept;
+   inline Iterator       end   ( size_t i ) noexcept;
+   inline ConstIterator  end   ( size_t i ) const noexcept;
+   inline ConstIterator  cend  ( size_t i ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline CompressedSoAMatrix& operator=( initializer_list< initializer_list<Type> > list );
+   inline CompressedSoAMatrix& operator=( const CompressedSoAMatrix& rhs );
+   inline CompressedSoAMatrix& operator=( CompressedSoAMatrix&& rhs ) noexcept;
+
+   template< typename MT, bool SO2 > inline CompressedSoAMatrix& operator= ( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT, bool SO2 > inline CompressedSoAMatrix& operator= ( const SparseMatrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline CompressedSoAMatrix& operator+=( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline CompressedSoAMatrix& operator-=( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline CompressedSoAMatrix& operator%=( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT, bool SO2 > inline CompressedSoAMatrix& operator%=( const SparseMatrix<MT,SO2>& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const noexcept;
+   inline size_t columns() const noexcept;
+   inline size_t capacity() const noexcept;
+   inline size_t capacity( size_t i ) const noexcept;
+   inline size_t nonZeros() const;
+   inline size_t nonZeros( size_t i ) const;
+   inline void   reset();
+   inline void   reset( size_t i );
+   inline void   clear();
+          void   resize ( size_t m, size_t n, bool preserve=true );
+   inline void   reserve( size_t nonzeros );
+          void   reserve( size_t i, size_t nonzeros );
+   inline void   trim   ();
+   inline void   trim   ( size_t i );
+   inline void   shrinkToFit();
+   inline void   swap( CompressedSoAMatrix& sm ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Insertion functions*************************************************************************
+   /*!\name Insertion functions */
+   //@{
+   inline Iterator set     ( size_t i, size_t j, const Type& value );
+   inline Iterator insert  ( size_t i, size_t j, const Type& value );
+   inline void     append  ( size_t i, size_t j, const Type& value, bool check=false );
+   inline void     finalize( size_t i );
+   //@}
+   //**********************************************************************************************
+
+   //**Erase functions*****************************************************************************
+   /*!\name Erase functions */
+   //@{
+   inline void     erase( size_t i, size_t j );
+   inline Iterator erase( size_t i, Iterator pos );
+   inline Iterator erase( size_t i, Iterator first, Iterator last );
+
+   template< typename Pred >
+   inline void erase( Pred predicate );
+
+   template< typename Pred >
+   inline void erase( size_t i, Iterator first, Iterator last, Pred predicate );
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline Iterator      find      ( size_t i, size_t j );
+   inline ConstIterator find      ( size_t i, size_t j ) const;
+   inline Iterator      lowerBound( size_t i, size_t j );
+   inline ConstIterator lowerBound( size_t i, size_t j ) const;
+   inline Iterator      upperBound( size_t i, size_t j );
+   inline ConstIterator upperBound( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Numeric functions***************************************************************************
+   /*!\name Numeric functions */
+   //@{
+   inline CompressedSoAMatrix& transpose();
+   inline CompressedSoAMatrix& ctranspose();
+
+   template< typename Other > inline CompressedSoAMatrix& scale( const Other& scalar );
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   inline bool canSMPAssign() const noexcept;
+
+   template< typename MT, bool SO2 > inline void assign     ( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT >           inline void assign     ( const SparseMatrix<MT,SO>&  rhs );
+   template< typename MT >           inline void assign     ( const SparseMatrix<MT,!SO>& rhs );
+   template< typename MT, bool SO2 > inline void addAssign  ( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT, bool SO2 > inline void addAssign  ( const SparseMatrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline void subAssign  ( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT, bool SO2 > inline void subAssign  ( const SparseMatrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline void schurAssign( const DenseMatrix<MT,SO2>&  rhs );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline CompressedSoAMatrix( size_t m, size_t n, Uninitialized );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline size_t checkIndexRange( size_t n );
+
+   inline size_t extendCapacity() const noexcept;
+          void   reserveElements( size_t nonzeros );
+
+   inline size_t offset( ConstIterator it ) const noexcept;
+   inline void   moveElements        ( size_t first, size_t last, size_t dest );
+   inline void   moveElementsBackward( size_t first, size_t last, size_t destLast );
+   //@}
+   //**********************************************************************************************
+
+   //**Insertion functions*************************************************************************
+   /*!\name Insertion functions */
+   //@{
+   Iterator insert( size_t pos, size_t i, size_t j, const Type& value );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t  m_;         //!< The current number of rows of the compressed matrix.
+   size_t  n_;         //!< The current number of columns of the compressed matrix.
+   size_t  capacity_;  //!< The current capacity of the offset array.
+   size_t* begin_;     //!< Offsets of the first non-zero element of each row.
+   size_t* end_;       //!< Offsets one past the last non-zero element of each row.
+   Type*   values_;    //!< The values of the non-zero elements.
+   IT*     indices_;   //!< The column indices of the non-zero elements.
+
+   static const Type zero_;  //!< Neutral element for accesses to zero elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_CONSTRAINT_MUST_BE_INTEGRAL_TYPE     ( IT );
+   BLAZE_CONSTRAINT_MUST_BE_UNSIGNED_TYPE     ( IT );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+template< typename Type, bool SO, typename IT >
+const Type CompressedSoAMatrix<Type,SO,IT>::zero_{};
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for CompressedSoAMatrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline CompressedSoAMatrix<Type,SO,IT>::CompressedSoAMatrix()
+   : m_       ( 0UL )      // The current number of rows of the compressed matrix
+   , n_       ( 0UL )      // The current number of columns of the compressed matrix
+   , capacity_( 0UL )      // The current capacity of the offset array
+   , begin_   ( nullptr )  // Offsets of the first non-zero element of each row
+   , end_     ( nullptr )  // Offsets one past the last non-zero element of each row
+   , values_  ( nullptr )  // The values of the non-zero elements
+   , indices_ ( nullptr )  // The column indices of the non-zero elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ M \times N \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \exception std::invalid_argument Number of columns exceeds the range of the index type.
+//
+// The matrix is initialized to the zero matrix and has no free capacity.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline CompressedSoAMatrix<Type,SO,IT>::CompressedSoAMatrix( size_t m, size_t n )
+   : CompressedSoAMatrix( m, n, Uninitialized() )
+{
+   for( size_t i=1UL; i<2UL*m_+2UL; ++i )
+      begin_[i] = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ M \times N \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param nonzeros The number of expected non-zero elements.
+// \exception std::invalid_argument Number of columns exceeds the range of the index type.
+//
+// The matrix is initialized to the zero matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline CompressedSoAMatrix<Type,SO,IT>::CompressedSoAMatrix( size_t m, size_t n, size_t nonzeros )
+   : CompressedSoAMatrix( m, n, Uninitialized() )
+{
+   values_  = allocate<Type>( nonzeros );
+   indices_ = allocate<IT>( nonzeros );
+
+   for( size_t i=1UL; i<(2UL*m_+1UL); ++i )
+      begin_[i] = 0UL;
+   end_[m_] = nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ M \times N \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param nonzeros The expected number of non-zero elements in each row.
+// \exception std::invalid_argument Number of columns exceeds the range of the index type.
+//
+// The matrix is initialized to the zero matrix and will have the specified capacity in each
+// row. Note that the given vector must have at least \a m elements.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+CompressedSoAMatrix<Type,SO,IT>::CompressedSoAMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros )
+   : CompressedSoAMatrix( m, n, Uninitialized() )
+{
+   BLAZE_USER_ASSERT( nonzeros.size() == m, "Size of capacity vector and number of rows don't match" );
+
+   size_t newCapacity( 0UL );
+   for( auto it=nonzeros.begin(); it!=nonzeros.end(); ++it )
+      newCapacity += *it;
+
+   values_  = allocate<Type>( newCapacity );
+   indices_ = allocate<IT>( newCapacity );
+
+   end_[0UL] = 0UL;
+   for( size_t i=0UL; i<m_; ++i ) {
+      begin_[i+1UL] = end_[i+1UL] = begin_[i] + nonzeros[i];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief List initialization of all matrix elements.
+//
+// \param list The initializer list.
+// \exception std::invalid_argument Number of columns exceeds the range of the index type.
+//
+// This constructor provides the option to explicitly initialize the elements of the matrix by
+// means of an initializer list:
+
+   \code
+   using blaze::rowMajor;
+
+   blaze::CompressedSoAMatrix<int,rowMajor> A{ { 1, 2, 3 },
+                                               { 4, 5 },
+                                               { 7, 8, 9 } };
+   \endcode
+
+// The matrix is sized according to the size of the initializer list and all its elements are
+// initialized by the values of the given initializer list. Missing values are considered to
+// be default values.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline CompressedSoAMatrix<Type,SO,IT>::CompressedSoAMatrix( initializer_list< initializer_list<Type> > list )
+   : CompressedSoAMatrix( list.size(), determineColumns( list ), blaze::nonZeros( list ) )
+{
+   size_t i( 0UL );
+
+   for( const auto& rowList : list )
+   {
+      size_t j( 0UL );
+
+      for( const Type& element : rowList ) {
+         if( !isDefault<strict>( element ) )
+            append( i, j, element );
+         ++j;
+      }
+
+      finalize( i );
+      ++i;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for CompressedSoAMatrix.
+//
+// \param sm Sparse matrix to be copied.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline CompressedSoAMatrix<Type,SO,IT>::CompressedSoAMatrix( const CompressedSoAMatrix& sm )
+   : CompressedSoAMatrix( sm.m_, sm.n_, Uninitialized() )
+{
+   const size_t nonzeros( sm.nonZeros() );
+
+   values_  = allocate<Type>( nonzeros );
+   indices_ = allocate<IT>( nonzeros );
+
+   for( size_t i=0UL; i<m_; ++i ) {
+      std::copy( sm.values_+sm.begin_[i], sm.values_+sm.end_[i], values_+begin_[i] );
+      std::copy( sm.indices_+sm.begin_[i], sm.indices_+sm.end_[i], indices_+begin_[i] );
+      end_[i] = begin_[i] + sm.nonZeros( i );
+      begin_[i+1UL] = end_[i];
+   }
+   end_[m_] = nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for CompressedSoAMatrix.
+//
+// \param sm The compressed matrix to be moved into this instance.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline CompressedSoAMatrix<Type,SO,IT>::CompressedSoAMatrix( CompressedSoAMatrix&& sm ) noexcept
+   : m_       ( sm.m_ )         // The current number of rows of the compressed matrix
+   , n_       ( sm.n_ )         // The current number of columns of the compressed matrix
+   , capacity_( sm.capacity_ )  // The current capacity of the offset array
+   , begin_   ( sm.begin_ )     // Offsets of the first non-zero element of each row
+   , end_     ( sm.end_ )       // Offsets one past the last non-zero element of each row
+   , values_  ( sm.values_ )    // The values of the non-zero elements
+   , indices_ ( sm.indices_ )   // The column indices of the non-zero elements
+{
+   sm.m_        = 0UL;
+   sm.n_        = 0UL;
+   sm.capacity_ = 0UL;
+   sm.begin_    = nullptr;
+   sm.end_      = nullptr;
+   sm.values_   = nullptr;
+   sm.indices_  = nullptr;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from dense matrices.
+//
+// \param dm Dense matrix to be copied.
+// \exception std::invalid_argument Number of columns exceeds the range of the index type.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+template< typename MT    // Type of the foreign dense matrix
+        , bool SO2 >     // Storage order of the foreign dense matrix
+inline CompressedSoAMatrix<Type,SO,IT>::CompressedSoAMatrix( const DenseMatrix<MT,SO2>& dm )
+   : CompressedSoAMatrix( (~dm).rows(), (~dm).columns() )
+{
+   using blaze::assign;
+
+   assign( *this, ~dm );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different sparse matrices.
+//
+// \param sm Sparse matrix to be copied.
+// \exception std::invalid_argument Number of columns exceeds the range of the index type.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+template< typename MT    // Type of the foreign compressed matrix
+        , bool SO2 >     // Storage order of the foreign compressed matrix
+inline CompressedSoAMatrix<Type,SO,IT>::CompressedSoAMatrix( const SparseMatrix<MT,SO2>& sm )
+   : CompressedSoAMatrix( (~sm).rows(), (~sm).columns(), (~sm).nonZeros() )
+{
+   using blaze::assign;
+
+   assign( *this, ~sm );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for an uninitialized matrix of size \f$ M \times N \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \exception std::invalid_argument Number of columns exceeds the range of the index type.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline CompressedSoAMatrix<Type,SO,IT>::CompressedSoAMatrix( size_t m, size_t n, Uninitialized )
+   : m_       ( m )                       // The current number of rows of the compressed matrix
+   , n_       ( checkIndexRange( n ) )    // The current number of columns of the compressed matrix
+   , capacity_( m )                       // The current capacity of the offset array
+   , begin_   ( new size_t[2UL*m+2UL] )   // Offsets of the first non-zero element of each row
+   , end_     ( begin_+(m+1UL) )          // Offsets one past the last non-zero element of each row
+   , values_  ( nullptr )                 // The values of the non-zero elements
+   , indices_ ( nullptr )                 // The column indices of the non-zero elements
+{
+   begin_[0] = 0UL;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for CompressedSoAMatrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline CompressedSoAMatrix<Type,SO,IT>::~CompressedSoAMatrix()
+{
+   deallocate( values_ );
+   deallocate( indices_ );
+   delete[] begin_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the compressed matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function returns a reference to the accessed value at position (\a i,\a j). In case the
+// compressed matrix does not yet store an element at position (\a i,\a j) , a new element is
+// inserted into the compressed matrix. Note that this function only performs an index check in
+// case BLAZE_USER_ASSERT() is active. In contrast, the at() function is guaranteed to perform a
+// check of the given access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline typename CompressedSoAMatrix<Type,SO,IT>::Reference
+   CompressedSoAMatrix<Type,SO,IT>::operator()( size_t i, size_t j ) noexcept
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   return Reference( *this, i, j );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief 2D-access to the compressed matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline typename CompressedSoAMatrix<Type,SO,IT>::ConstReference
+   CompressedSoAMatrix<Type,SO,IT>::operator()( size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const ConstIterator pos( lowerBound( i, j ) );
+
+   if( pos == end( i ) || pos->index() != j )
+      return zero_;
+   else
+      return pos->value();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// This function returns a reference to the accessed value at position (\a i,\a j). In case the
+// compressed matrix does not yet store an element at position (\a i,\a j) , a new element is
+// inserted into the compressed matrix. In contrast to the function call operator this function
+// always performs a check of the given access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline typename CompressedSoAMatrix<Type,SO,IT>::Reference
+   CompressedSoAMatrix<Type,SO,IT>::at( size_t i, size_t j )
+{
+   if( i >= m_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// In contrast to the function call operator this function always performs a check of the given
+// access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline typename CompressedSoAMatrix<Type,SO,IT>::ConstReference
+   CompressedSoAMatrix<Type,SO,IT>::at( size_t i, size_t j ) const
+{
+   if( i >= m_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first non-zero element of row \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline typename CompressedSoAMatrix<Type,SO,IT>::Iterator
+   CompressedSoAMatrix<Type,SO,IT>::begin( size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid compressed matrix row access index" );
+   return Iterator( values_+begin_[i], indices_+begin_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first non-zero element of row \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline typename CompressedSoAMatrix<Type,SO,IT>::ConstIterator
+   CompressedSoAMatrix<Type,SO,IT>::begin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid compressed matrix row access index" );
+   return ConstIterator( values_+begin_[i], indices_+begin_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first non-zero element of row \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline typename CompressedSoAMatrix<Type,SO,IT>::ConstIterator
+   CompressedSoAMatrix<Type,SO,IT>::cbegin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid compressed matrix row access index" );
+   return ConstIterator( values_+begin_[i], indices_+begin_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last non-zero element of row \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline typename CompressedSoAMatrix<Type,SO,IT>::Iterator
+   CompressedSoAMatrix<Type,SO,IT>::end( size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid compressed matrix row access index" );
+   return Iterator( values_+end_[i], indices_+end_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last non-zero element of row \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline typename CompressedSoAMatrix<Type,SO,IT>::ConstIterator
+   CompressedSoAMatrix<Type,SO,IT>::end( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid compressed matrix row access index" );
+   return ConstIterator( values_+end_[i], indices_+end_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last non-zero element of row \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline typename CompressedSoAMatrix<Type,SO,IT>::ConstIterator
+   CompressedSoAMatrix<Type,SO,IT>::cend( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid compressed matrix row access index" );
+   return ConstIterator( values_+end_[i], indices_+end_[i] );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief List assignment to all matrix elements.
+//
+// \param list The initializer list.
+// \exception std::invalid_argument Number of columns exceeds the range of the index type.
+//
+// This assignment operator offers the option to directly assign to all elements of the matrix
+// by means of an initializer list. The matrix is resized according to the given initializer
+// list and all its elements are assigned the values from the given initializer list. Missing
+// values are initialized as default (as e.g. the value 6 in the example).
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline CompressedSoAMatrix<Type,SO,IT>&
+   CompressedSoAMatrix<Type,SO,IT>::operator=( initializer_list< initializer_list<Type> > list )
+{
+   using blaze::nonZeros;
+
+   resize( list.size(), determineColumns( list ), false );
+   reserve( nonZeros( list ) );
+
+   size_t i( 0UL );
+
+   for( const auto& rowList : list )
+   {
+      size_t j( 0UL );
+
+      for( const Type& element : rowList ) {
+         if( !isDefault<strict>( element ) )
+            append( i, j, element );
+         ++j;
+      }
+
+      finalize( i );
+      ++i;
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for CompressedSoAMatrix.
+//
+// \param rhs Compressed matrix to be copied.
+// \return Reference to the assigned compressed matrix.
+//
+// The compressed matrix is resized according to the given compressed matrix and initialized
+// as a copy of this matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline CompressedSoAMatrix<Type,SO,IT>&
+   CompressedSoAMatrix<Type,SO,IT>::operator=( const CompressedSoAMatrix& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   if( begin_ == nullptr || rhs.m_ > capacity_ || rhs.nonZeros() > capacity() )
+   {
+      CompressedSoAMatrix tmp( rhs );
+      swap( tmp );
+   }
+   else
+   {
+      const size_t cap( capacity() );
+
+      for( size_t i=0UL; i<rhs.m_; ++i ) {
+         std::copy( rhs.values_+rhs.begin_[i], rhs.values_+rhs.end_[i], values_+begin_[i] );
+         std::copy( rhs.indices_+rhs.begin_[i], rhs.indices_+rhs.end_[i], indices_+begin_[i] );
+         end_[i] = begin_[i] + rhs.nonZeros( i );
+         begin_[i+1UL] = end_[i];
+      }
+      end_[rhs.m_] = cap;
+
+      m_ = rhs.m_;
+      n_ = rhs.n_;
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for CompressedSoAMatrix.
+//
+// \param rhs The compressed matrix to be moved into this instance.
+// \return Reference to the assigned compressed matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline CompressedSoAMatrix<Type,SO,IT>&
+   CompressedSoAMatrix<Type,SO,IT>::operator=( CompressedSoAMatrix&& rhs ) noexcept
+{
+   deallocate( values_ );
+   deallocate( indices_ );
+   delete[] begin_;
+
+   m_        = rhs.m_;
+   n_        = rhs.n_;
+   capacity_ = rhs.capacity_;
+   begin_    = rhs.begin_;
+   end_      = rhs.end_;
+   values_   = rhs.values_;
+   indices_  = rhs.indices_;
+
+   rhs.m_        = 0UL;
+   rhs.n_        = 0UL;
+   rhs.capacity_ = 0UL;
+   rhs.begin_    = nullptr;
+   rhs.end_      = nullptr;
+   rhs.values_   = nullptr;
+   rhs.indices_  = nullptr;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for dense matrices.
+//
+// \param rhs Dense matrix to be assigned.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Number of columns exceeds the range of the index type.
+//
+// The matrix is resized according to the given \f$ M \times N \f$ matrix and initialized as a
+// copy of this matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline CompressedSoAMatrix<Type,SO,IT>&
+   CompressedSoAMatrix<Type,SO,IT>::operator=( const DenseMatrix<MT,SO2>& rhs )
+{
+   using blaze::assign;
+
+   if( (~rhs).canAlias( this ) ) {
+      CompressedSoAMatrix tmp( ~rhs );
+      swap( tmp );
+   }
+   else {
+      resize( (~rhs).rows(), (~rhs).columns(), false );
+      assign( *this, ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different sparse matrices.
+//
+// \param rhs Sparse matrix to be assigned.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Number of columns exceeds the range of the index type.
+//
+// The matrix is resized according to the given \f$ M \times N \f$ matrix and initialized as a
+// copy of this matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+template< typename MT    // Type of the right-hand side sparse matrix
+        , bool SO2 >     // Storage order of the right-hand side sparse matrix
+inline CompressedSoAMatrix<Type,SO,IT>&
+   CompressedSoAMatrix<Type,SO,IT>::operator=( const SparseMatrix<MT,SO2>& rhs )
+{
+   using blaze::assign;
+
+   if( (~rhs).canAlias( this ) ||
+       (~rhs).rows()     > capacity_ ||
+       (~rhs).nonZeros() > capacity() ) {
+      CompressedSoAMatrix tmp( ~rhs );
+      swap( tmp );
+   }
+   else {
+      resize( (~rhs).rows(), (~rhs).columns(), false );
+      reset();
+
+      if( !IsZero_v<MT> ) {
+         assign( *this, ~rhs );
+      }
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator for the addition of a matrix (\f$ A+=B \f$).
+//
+// \param rhs The right-hand side matrix to be added to the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline CompressedSoAMatrix<Type,SO,IT>&
+   CompressedSoAMatrix<Type,SO,IT>::operator+=( const Matrix<MT,SO2>& rhs )
+{
+   using blaze::addAssign;
+
+   if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( !IsZero_v<MT> ) {
+      addAssign( *this, ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator for the subtraction of a matrix (\f$ A-=B \f$).
+//
+// \param rhs The right-hand side matrix to be subtracted from the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline CompressedSoAMatrix<Type,SO,IT>&
+   CompressedSoAMatrix<Type,SO,IT>::operator-=( const Matrix<MT,SO2>& rhs )
+{
+   using blaze::subAssign;
+
+   if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( !IsZero_v<MT> ) {
+      subAssign( *this, ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Schur product assignment operator for the multiplication of a dense matrix
+//        (\f$ A\circ=B \f$).
+//
+// \param rhs The right-hand side dense matrix for the Schur product.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline CompressedSoAMatrix<Type,SO,IT>&
+   CompressedSoAMatrix<Type,SO,IT>::operator%=( const DenseMatrix<MT,SO2>& rhs )
+{
+   using blaze::schurAssign;
+
+   if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( (~rhs).canAlias( this ) ) {
+      CompressedSoAMatrix tmp( *this % (~rhs) );
+      swap( tmp );
+   }
+   else {
+      CompositeType_t<MT> tmp( ~rhs );
+      schurAssign( *this, tmp );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Schur product assignment operator for the multiplication of a sparse matrix
+//        (\f$ A\circ=B \f$).
+//
+// \param rhs The right-hand side sparse matrix for the Schur product.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+template< typename MT    // Type of the right-hand side sparse matrix
+        , bool SO2 >     // Storage order of the right-hand side sparse matrix
+inline CompressedSoAMatrix<Type,SO,IT>&
+   CompressedSoAMatrix<Type,SO,IT>::operator%=( const SparseMatrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( !IsZero_v<MT> ) {
+      CompressedSoAMatrix tmp( *this % (~rhs) );
+      swap( tmp );
+   }
+   else {
+      reset();
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the compressed matrix.
+//
+// \return The number of rows of the compressed matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline size_t CompressedSoAMatrix<Type,SO,IT>::rows() const noexcept
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the compressed matrix.
+//
+// \return The number of columns of the compressed matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline size_t CompressedSoAMatrix<Type,SO,IT>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the compressed matrix.
+//
+// \return The capacity of the compressed matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline size_t CompressedSoAMatrix<Type,SO,IT>::capacity() const noexcept
+{
+   if( begin_ != nullptr )
+      return end_[m_];
+   else return 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current capacity of the specified row.
+//
+// \param i The index of the row.
+// \return The current capacity of row \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline size_t CompressedSoAMatrix<Type,SO,IT>::capacity( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+   return begin_[i+1UL] - begin_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the compressed matrix
+//
+// \return The number of non-zero elements in the compressed matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline size_t CompressedSoAMatrix<Type,SO,IT>::nonZeros() const
+{
+   size_t nonzeros( 0UL );
+
+   for( size_t i=0UL; i<m_; ++i )
+      nonzeros += nonZeros( i );
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row.
+//
+// \param i The index of the row.
+// \return The number of non-zero elements of row \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline size_t CompressedSoAMatrix<Type,SO,IT>::nonZeros( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+   return end_[i] - begin_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline void CompressedSoAMatrix<Type,SO,IT>::reset()
+{
+   for( size_t i=0UL; i<m_; ++i )
+      end_[i] = begin_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row to the default initial values.
+//
+// \param i The index of the row.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline void CompressedSoAMatrix<Type,SO,IT>::reset( size_t i )
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+   end_[i] = begin_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the compressed matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the compressed matrix is 0.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline void CompressedSoAMatrix<Type,SO,IT>::clear()
+{
+   if( end_ != nullptr )
+      end_[0UL] = end_[m_];
+   m_ = 0UL;
+   n_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the size of the compressed matrix.
+//
+// \param m The new number of rows of the compressed matrix.
+// \param n The new number of columns of the compressed matrix.
+// \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
+// \return void
+// \exception std::invalid_argument Number of columns exceeds the range of the index type.
+//
+// This function resizes the matrix using the given size to \f$ m \times n \f$. During this
+// operation, new dynamic memory may be allocated in case the capacity of the matrix is too
+// small. Note that this function may invalidate all existing views (submatrices, rows, columns,
+// ...) on the matrix if it is used to shrink the matrix. Additionally, the resize operation
+// potentially changes all matrix elements. In order to preserve the old matrix values, the
+// \a preserve flag can be set to \a true.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+void CompressedSoAMatrix<Type,SO,IT>::resize( size_t m, size_t n, bool preserve )
+{
+   using std::swap;
+
+   BLAZE_INTERNAL_ASSERT( end_ >= begin_, "Invalid internal storage detected" );
+   BLAZE_INTERNAL_ASSERT( begin_ == nullptr || size_t( end_ - begin_ ) == capacity_ + 1UL, "Invalid storage setting detected" );
+
+   if( m == m_ && n == n_ ) return;
+
+   checkIndexRange( n );
+
+   if( begin_ == nullptr )
+   {
+      begin_ = new size_t[2UL*m+2UL];
+      end_   = begin_+m+1UL;
+
+      for( size_t i=0UL; i<2UL*m+2UL; ++i ) {
+         begin_[i] = 0UL;
+      }
+
+      capacity_ = m;
+   }
+   else if( m > capacity_ )
+   {
+      size_t* newBegin( new size_t[2UL*m+2UL] );
+      size_t* newEnd  ( newBegin+m+1UL );
+
+      newBegin[0UL] = begin_[0UL];
+
+      if( preserve ) {
+         for( size_t i=0UL; i<m_; ++i ) {
+            newEnd  [i]     = ( n < n_ )?( offset( lowerBound( i, n ) ) ):( end_[i] );
+            newBegin[i+1UL] = begin_[i+1UL];
+         }
+         for( size_t i=m_; i<m; ++i ) {
+            newBegin[i+1UL] = newEnd[i] = begin_[m_];
+         }
+      }
+      else {
+         for( size_t i=0UL; i<m; ++i ) {
+            newBegin[i+1UL] = newEnd[i] = begin_[0UL];
+         }
+      }
+
+      newEnd[m] = end_[m_];
+
+      swap( newBegin, begin_ );
+      delete[] newBegin;
+      end_ = newEnd;
+      capacity_ = m;
+   }
+   else if( m > m_ )
+   {
+      end_[m] = end_[m_];
+
+      if( !preserve ) {
+         for( size_t i=0UL; i<m_; ++i )
+            end_[i] = begin_[i];
+      }
+      else if( n < n_ ) {
+         for( size_t i=0UL; i<m_; ++i )
+            end_[i] = offset( lowerBound( i, n ) );
+      }
+
+      for( size_t i=m_; i<m; ++i ) {
+         begin_[i+1UL] = end_[i] = begin_[m_];
+      }
+   }
+   else
+   {
+      if( preserve ) {
+         for( size_t i=0UL; i<m; ++i )
+            end_[i] = offset( lowerBound( i, n ) );
+      }
+      else {
+         for( size_t i=0UL; i<m; ++i )
+            end_[i] = begin_[i];
+      }
+
+      end_[m] = end_[m_];
+   }
+
+   m_ = m;
+   n_ = n;
+
+   BLAZE_INTERNAL_ASSERT( end_ >= begin_, "Invalid internal storage detected" );
+   BLAZE_INTERNAL_ASSERT( size_t( end_ - begin_ ) == capacity_ + 1UL, "Invalid storage setting detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of the compressed matrix.
+//
+// \param nonzeros The new minimum capacity of the compressed matrix.
+// \return void
+//
+// This function increases the capacity of the compressed matrix to at least \a nonzeros
+// elements. The current values of the matrix elements and the individual capacities of the
+// matrix rows are preserved.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline void CompressedSoAMatrix<Type,SO,IT>::reserve( size_t nonzeros )
+{
+   if( nonzeros > capacity() )
+      reserveElements( nonzeros );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of a specific row of the compressed matrix.
+//
+// \param i The row index \f$[0..M-1]\f$.
+// \param nonzeros The new minimum capacity of the specified row.
+// \return void
+//
+// This function increases the capacity of row \a i of the compressed matrix to at least
+// \a nonzeros elements. The current values of the compressed matrix and all other individual
+// row capacities are preserved.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+void CompressedSoAMatrix<Type,SO,IT>::reserve( size_t i, size_t nonzeros )
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+
+   const size_t current( capacity(i) );
+
+   if( current >= nonzeros ) return;
+
+   const size_t additional( nonzeros - current );
+
+   if( end_[m_] - begin_[m_] < additional )
+   {
+      const size_t newCapacity( begin_[m_] + additional );
+      BLAZE_INTERNAL_ASSERT( newCapacity > capacity(), "Invalid capacity value" );
+
+      Type* newValues ( allocate<Type>( newCapacity ) );
+      IT*   newIndices( allocate<IT>( newCapacity ) );
+
+      size_t pos( 0UL );
+
+      for( size_t k=0UL; k<m_; ++k ) {
+         const size_t first( begin_[k] );
+         const size_t last ( end_[k] );
+         const size_t total( k == i ? nonzeros : begin_[k+1UL] - first );
+         transfer( values_+first, values_+last, newValues+pos );
+         std::copy( indices_+first, indices_+last, newIndices+pos );
+         begin_[k] = pos;
+         end_  [k] = pos + ( last - first );
+         pos += total;
+      }
+
+      BLAZE_INTERNAL_ASSERT( pos == newCapacity, "Invalid offset calculations" );
+
+      begin_[m_] = end_[m_] = newCapacity;
+
+      std::swap( newValues , values_  );
+      std::swap( newIndices, indices_ );
+      deallocate( newValues );
+      deallocate( newIndices );
+   }
+   else
+   {
+      begin_[m_] += additional;
+      for( size_t j=m_-1UL; j>i; --j ) {
+         moveElementsBackward( begin_[j], end_[j], end_[j]+additional );
+         begin_[j] += additional;
+         end_  [j] += additional;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing all excessive capacity from all rows.
+//
+// \return void
+//
+// The trim() function can be used to reverse the effect of all row-specific reserve() calls.
+// The function removes all excessive capacity from all rows. Note that this function does not
+// remove the overall capacity but only reduces the capacity per row.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline void CompressedSoAMatrix<Type,SO,IT>::trim()
+{
+   for( size_t i=0UL; i<m_; ++i )
+      trim( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing all excessive capacity of a specific row of the compressed matrix.
+//
+// \param i The index of the row to be trimmed \f$[0..M-1]\f$.
+// \return void
+//
+// This function can be used to reverse the effect of a row-specific reserve() call. It removes
+// all excessive capacity from the specified row. The excessive capacity is assigned to the
+// subsequent row.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline void CompressedSoAMatrix<Type,SO,IT>::trim( size_t i )
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+
+   if( i < ( m_ - 1UL ) ) {
+      const size_t nonzeros( end_[i+1UL] - begin_[i+1UL] );
+      moveElements( begin_[i+1UL], end_[i+1UL], end_[i] );
+      end_[i+1UL] = end_[i] + nonzeros;
+   }
+   begin_[i+1UL] = end_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Requesting the removal of unused capacity.
+//
+// \return void
+//
+// This function minimizes the capacity of the matrix by removing unused capacity. Please note
+// that in case a reallocation occurs, all iterators (including end() iterators), all pointers
+// and references to elements of this matrix are invalidated.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline void CompressedSoAMatrix<Type,SO,IT>::shrinkToFit()
+{
+   if( nonZeros() < capacity() ) {
+      CompressedSoAMatrix( *this ).swap( *this );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two sparse matrices.
+//
+// \param sm The compressed matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline void CompressedSoAMatrix<Type,SO,IT>::swap( CompressedSoAMatrix& sm ) noexcept
+{
+   using std::swap;
+
+   swap( m_, sm.m_ );
+   swap( n_, sm.n_ );
+   swap( capacity_, sm.capacity_ );
+   swap( begin_, sm.begin_ );
+   swap( end_  , sm.end_   );
+   swap( values_ , sm.values_  );
+   swap( indices_, sm.indices_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checks whether the given number of columns can be represented by the index type.
+//
+// \param n The number of columns of the matrix.
+// \return The given number of columns.
+// \exception std::invalid_argument Number of columns exceeds the range of the index type.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline size_t CompressedSoAMatrix<Type,SO,IT>::checkIndexRange( size_t n )
+{
+   if( n > 0UL && n-1UL > static_cast<size_t>( std::numeric_limits<IT>::max() ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Number of columns exceeds the range of the index type" );
+   }
+
+   return n;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calculating a new matrix capacity.
+//
+// \return The new compressed matrix capacity.
+//
+// This function calculates a new matrix capacity based on the current capacity of the sparse
+// matrix. Note that the new capacity is restricted to the interval \f$[7..M \cdot N]\f$.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline size_t CompressedSoAMatrix<Type,SO,IT>::extendCapacity() const noexcept
+{
+   size_t nonzeros( 2UL*capacity()+1UL );
+   nonzeros = blaze::max( nonzeros, 7UL );
+
+   BLAZE_INTERNAL_ASSERT( nonzeros > capacity(), "Invalid capacity value" );
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reserving the specified number of compressed matrix elements.
+//
+// \param nonzeros The number of matrix elements to be reserved.
+// \return void
+//
+// Since the layout of the rows is described by offsets into the value and index arrays, the
+// reallocation of the two arrays does not affect the offsets of the rows.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+void CompressedSoAMatrix<Type,SO,IT>::reserveElements( size_t nonzeros )
+{
+   if( begin_ == nullptr ) {
+      begin_ = new size_t[2UL*capacity_+2UL];
+      end_   = begin_+capacity_+1UL;
+      for( size_t i=0UL; i<2UL*capacity_+2UL; ++i )
+         begin_[i] = 0UL;
+   }
+
+   BLAZE_INTERNAL_ASSERT( nonzeros >= begin_[m_], "Invalid capacity value" );
+
+   Type* newValues ( allocate<Type>( nonzeros ) );
+   IT*   newIndices( allocate<IT>( nonzeros ) );
+
+   for( size_t k=0UL; k<m_; ++k ) {
+      BLAZE_INTERNAL_ASSERT( begin_[k] <= end_[k], "Invalid row offsets" );
+      transfer( values_+begin_[k], values_+end_[k], newValues+begin_[k] );
+      std::copy( indices_+begin_[k], indices_+end_[k], newIndices+begin_[k] );
+   }
+
+   end_[m_] = nonzeros;
+
+   std::swap( newValues , values_  );
+   std::swap( newIndices, indices_ );
+   deallocate( newValues );
+   deallocate( newIndices );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the offset of the given iterator within the value and index arrays.
+//
+// \param it Iterator to an element of the compressed matrix.
+// \return The offset of the element.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline size_t CompressedSoAMatrix<Type,SO,IT>::offset( ConstIterator it ) const noexcept
+{
+   return it.indexBase() - indices_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Moves the elements in the range \f$[first..last)\f$ to the front, starting at \a dest.
+//
+// \param first The offset of the first element to be moved.
+// \param last The offset one past the last element to be moved.
+// \param dest The offset of the first destination element (\f$ dest \le first \f$).
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline void CompressedSoAMatrix<Type,SO,IT>::moveElements( size_t first, size_t last, size_t dest )
+{
+   BLAZE_INTERNAL_ASSERT( dest <= first, "Invalid destination offset" );
+
+   std::move( values_+first, values_+last, values_+dest );
+   std::copy( indices_+first, indices_+last, indices_+dest );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Moves the elements in the range \f$[first..last)\f$ to the back, ending at \a destLast.
+//
+// \param first The offset of the first element to be moved.
+// \param last The offset one past the last element to be moved.
+// \param destLast The offset one past the last destination element (\f$ destLast \ge last \f$).
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline void CompressedSoAMatrix<Type,SO,IT>::moveElementsBackward( size_t first, size_t last, size_t destLast )
+{
+   BLAZE_INTERNAL_ASSERT( destLast >= last, "Invalid destination offset" );
+
+   std::move_backward( values_+first, values_+last, values_+destLast );
+   std::copy_backward( indices_+first, indices_+last, indices_+destLast );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INSERTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Setting an element of the compressed matrix.
+//
+// \param i The row index of the new element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be set.
+// \return Iterator to the set element.
+//
+// This function sets the value of an element of the compressed matrix. In case the compressed
+// matrix already contains an element with row index \a i and column index \a j its value is
+// modified, else a new element with the given \a value is inserted.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline typename CompressedSoAMatrix<Type,SO,IT>::Iterator
+   CompressedSoAMatrix<Type,SO,IT>::set( size_t i, size_t j, const Type& value )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const Iterator pos( lowerBound( i, j ) );
+
+   if( pos != end( i ) && pos->index() == j ) {
+       pos->value() = value;
+       return pos;
+   }
+   else return insert( offset( pos ), i, j, value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inserting an element into the compressed matrix.
+//
+// \param i The row index of the new element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be inserted.
+// \return Iterator to the newly inserted element.
+// \exception std::invalid_argument Invalid compressed matrix access index.
+//
+// This function inserts a new element into the compressed matrix. However, duplicate elements
+// are not allowed. In case the compressed matrix already contains an element with row index \a i
+// and column index \a j, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline typename CompressedSoAMatrix<Type,SO,IT>::Iterator
+   CompressedSoAMatrix<Type,SO,IT>::insert( size_t i, size_t j, const Type& value )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const Iterator pos( lowerBound( i, j ) );
+
+   if( pos != end( i ) && pos->index() == j ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Bad access index" );
+   }
+
+   return insert( offset( pos ), i, j, value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inserting an element into the compressed matrix.
+//
+// \param pos The offset of the new element.
+// \param i The row index of the new element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be inserted.
+// \return Iterator to the newly inserted element.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+typename CompressedSoAMatrix<Type,SO,IT>::Iterator
+   CompressedSoAMatrix<Type,SO,IT>::insert( size_t pos, size_t i, size_t j, const Type& value )
+{
+   if( begin_[i+1UL] != end_[i] ) {
+      moveElementsBackward( pos, end_[i], end_[i]+1UL );
+      ++end_[i];
+   }
+   else if( end_[m_] != begin_[m_] ) {
+      moveElementsBackward( pos, end_[m_-1UL], end_[m_-1UL]+1UL );
+
+      for( size_t k=i+1UL; k<m_+1UL; ++k ) {
+         ++begin_[k];
+         ++end_[k-1UL];
+      }
+   }
+   else {
+      const size_t newCapacity( extendCapacity() );
+
+      Type* newValues ( allocate<Type>( newCapacity ) );
+      IT*   newIndices( allocate<IT>( newCapacity ) );
+
+      transfer( values_, values_+pos, newValues );
+      transfer( values_+pos, values_+end_[m_-1UL], newValues+pos+1UL );
+      std::copy( indices_, indices_+pos, newIndices );
+      std::copy( indices_+pos, indices_+end_[m_-1UL], newIndices+pos+1UL );
+
+      for( size_t k=i+1UL; k<m_+1UL; ++k ) {
+         ++begin_[k];
+         ++end_[k-1UL];
+      }
+      end_[m_] = newCapacity;
+
+      std::swap( newValues , values_  );
+      std::swap( newIndices, indices_ );
+      deallocate( newValues );
+      deallocate( newIndices );
+   }
+
+   values_ [pos] = value;
+   indices_[pos] = static_cast<IT>( j );
+
+   return Iterator( values_+pos, indices_+pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Appending an element to the specified row of the compressed matrix.
+//
+// \param i The row index of the new element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be appended.
+// \param check \a true if the new value should be checked for default values, \a false if not.
+// \return void
+//
+// This function provides a very efficient way to fill a compressed matrix with elements. It
+// appends a new element to the end of the specified row without any additional memory
+// allocation. Therefore it is strictly necessary to keep the following preconditions in mind:
+//
+//  - the index of the new element must be strictly larger than the largest index of non-zero
+//    elements in the specified row of the compressed matrix
+//  - the current number of non-zero elements in the matrix must be smaller than the capacity
+//    of the matrix
+//
+// Ignoring these preconditions might result in undefined behavior! The optional \a check
+// parameter specifies whether the new value should be tested for a default value. If the new
+// value is a default value (for instance 0 in case of an integral element type) the value is
+// not appended. Per default the values are not tested.
+//
+// \note Although append() does not allocate new memory, it still invalidates all iterators
+// returned by the end() functions!
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline void CompressedSoAMatrix<Type,SO,IT>::append( size_t i, size_t j, const Type& value, bool check )
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < n_, "Invalid column access index" );
+   BLAZE_USER_ASSERT( end_[i] < end_[m_], "Not enough reserved capacity left" );
+   BLAZE_USER_ASSERT( begin_[i] == end_[i] || j > indices_[end_[i]-1UL], "Index is not strictly increasing" );
+
+   values_[end_[i]] = value;
+
+   if( !check || !isDefault<strict>( values_[end_[i]] ) ) {
+      indices_[end_[i]] = static_cast<IT>( j );
+      ++end_[i];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Finalizing the element insertion of a row.
+//
+// \param i The index of the row to be finalized \f$[0..M-1]\f$.
+// \return void
+//
+// This function is part of the low-level interface to efficiently fill a matrix with elements.
+// After completion of row \a i via the append() function, this function can be called to
+// finalize row \a i and prepare the next row for insertion process via append().
+//
+// \note Although finalize() does not allocate new memory, it still invalidates all iterators
+// returned by the end() functions!
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline void CompressedSoAMatrix<Type,SO,IT>::finalize( size_t i )
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row access index" );
+
+   begin_[i+1UL] = end_[i];
+   if( i != m_-1UL )
+      end_[i+1UL] = end_[i];
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ERASE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Erasing an element from the compressed matrix.
+//
+// \param i The row index of the element to be erased. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the element to be erased. The index has to be in the range \f$[0..N-1]\f$.
+// \return void
+//
+// This function erases an element from the compressed matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline void CompressedSoAMatrix<Type,SO,IT>::erase( size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const Iterator pos( find( i, j ) );
+   if( pos != end( i ) ) {
+      const size_t k( offset( pos ) );
+      moveElements( k+1UL, end_[i], k );
+      --end_[i];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing an element from the compressed matrix.
+//
+// \param i The row index of the element to be erased. The index has to be in the range \f$[0..M-1]\f$.
+// \param pos Iterator to the element to be erased.
+// \return Iterator to the element after the erased element.
+//
+// This function erases an element from the compressed matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline typename CompressedSoAMatrix<Type,SO,IT>::Iterator
+   CompressedSoAMatrix<Type,SO,IT>::erase( size_t i, Iterator pos )
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+   BLAZE_USER_ASSERT( pos >= begin( i ) && pos <= end( i ), "Invalid compressed matrix iterator" );
+
+   if( pos != end( i ) ) {
+      const size_t k( offset( pos ) );
+      moveElements( k+1UL, end_[i], k );
+      --end_[i];
+   }
+
+   return pos;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing a range of elements from the compressed matrix.
+//
+// \param i The row index of the element to be erased. The index has to be in the range \f$[0..M-1]\f$.
+// \param first Iterator to first element to be erased.
+// \param last Iterator just past the last element to be erased.
+// \return Iterator to the element after the erased element.
+//
+// This function erases a range of elements from the compressed matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline typename CompressedSoAMatrix<Type,SO,IT>::Iterator
+   CompressedSoAMatrix<Type,SO,IT>::erase( size_t i, Iterator first, Iterator last )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index" );
+   BLAZE_USER_ASSERT( first <= last, "Invalid iterator range"   );
+   BLAZE_USER_ASSERT( first >= begin( i ) && first <= end( i ), "Invalid compressed matrix iterator" );
+   BLAZE_USER_ASSERT( last  >= begin( i ) && last  <= end( i ), "Invalid compressed matrix iterator" );
+
+   if( first != last ) {
+      const size_t f( offset( first ) );
+      const size_t l( offset( last  ) );
+      moveElements( l, end_[i], f );
+      end_[i] -= l - f;
+   }
+
+   return first;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing specific elements from the compressed matrix.
+//
+// \param predicate The unary predicate for the element selection.
+// \return void.
+//
+// This function erases specific elements from the compressed matrix. The elements are selected
+// by the given unary predicate \a predicate, which is expected to accept a single argument of
+// the type of the elements and to be pure.
+*/
+template< typename Type    // Data type of the matrix
+        , bool SO          // Storage order
+        , typename IT >    // Type of the stored indices
+template< typename Pred >  // Type of the unary predicate
+inline void CompressedSoAMatrix<Type,SO,IT>::erase( Pred predicate )
+{
+   for( size_t i=0UL; i<m_; ++i ) {
+      erase( i, begin( i ), end( i ), predicate );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing specific elements from a range of the compressed matrix.
+//
+// \param i The row index of the elements to be erased. The index has to be in the range \f$[0..M-1]\f$.
+// \param first Iterator to first element of the range.
+// \param last Iterator just past the last element of the range.
+// \param predicate The unary predicate for the element selection.
+// \return void
+//
+// This function erases specific elements from a range of elements of the compressed matrix.
+// The elements are selected by the given unary predicate \a predicate, which is expected to
+// accept a single argument of the type of the elements and to be pure.
+*/
+template< typename Type    // Data type of the matrix
+        , bool SO          // Storage order
+        , typename IT >    // Type of the stored indices
+template< typename Pred >  // Type of the unary predicate
+inline void CompressedSoAMatrix<Type,SO,IT>::erase( size_t i, Iterator first, Iterator last, Pred predicate )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index" );
+   BLAZE_USER_ASSERT( first <= last, "Invalid iterator range"   );
+   BLAZE_USER_ASSERT( first >= begin( i ) && first <= end( i ), "Invalid compressed matrix iterator" );
+   BLAZE_USER_ASSERT( last  >= begin( i ) && last  <= end( i ), "Invalid compressed matrix iterator" );
+
+   const size_t l( offset( last ) );
+   size_t pos( offset( first ) );
+
+   for( size_t k=pos; k<l; ++k ) {
+      if( !predicate( values_[k] ) ) {
+         if( pos != k ) {
+            values_ [pos] = std::move( values_[k] );
+            indices_[pos] = indices_[k];
+         }
+         ++pos;
+      }
+   }
+
+   moveElements( l, end_[i], pos );
+   end_[i] -= l - pos;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+//
+// This function can be used to check whether a specific element is contained in the compressed
+// matrix. It specifically searches for the element with row index \a i and column index \a j.
+// In case the element is found, the function returns an iterator to the element. Otherwise an
+// iterator just past the last non-zero element of row \a i (the end() iterator) is returned.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline typename CompressedSoAMatrix<Type,SO,IT>::Iterator
+   CompressedSoAMatrix<Type,SO,IT>::find( size_t i, size_t j )
+{
+   const size_t k( offset( const_cast<const This&>( *this ).find( i, j ) ) );
+   return Iterator( values_+k, indices_+k );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+//
+// This function can be used to check whether a specific element is contained in the compressed
+// matrix. It specifically searches for the element with row index \a i and column index \a j.
+// In case the element is found, the function returns an iterator to the element. Otherwise an
+// iterator just past the last non-zero element of row \a i (the end() iterator) is returned.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline typename CompressedSoAMatrix<Type,SO,IT>::ConstIterator
+   CompressedSoAMatrix<Type,SO,IT>::find( size_t i, size_t j ) const
+{
+   const ConstIterator pos( lowerBound( i, j ) );
+   if( pos != end( i ) && pos->index() == j )
+      return pos;
+   else return end( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less than the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less than the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index not less than the given column index. The binary search is performed directly on the
+// contiguous array of column indices.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline typename CompressedSoAMatrix<Type,SO,IT>::Iterator
+   CompressedSoAMatrix<Type,SO,IT>::lowerBound( size_t i, size_t j )
+{
+   const size_t k( offset( const_cast<const This&>( *this ).lowerBound( i, j ) ) );
+   return Iterator( values_+k, indices_+k );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less than the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less than the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index not less than the given column index. The binary search is performed directly on the
+// contiguous array of column indices.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline typename CompressedSoAMatrix<Type,SO,IT>::ConstIterator
+   CompressedSoAMatrix<Type,SO,IT>::lowerBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+
+   const IT* const pos( std::lower_bound( indices_+begin_[i], indices_+end_[i], j,
+                                          []( const IT& index, size_t value )
+                                          {
+                                             return static_cast<size_t>( index ) < value;
+                                          } ) );
+
+   return ConstIterator( values_+( pos - indices_ ), pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater than the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater than the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index greater than the given column index. The binary search is performed directly on the
+// contiguous array of column indices.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline typename CompressedSoAMatrix<Type,SO,IT>::Iterator
+   CompressedSoAMatrix<Type,SO,IT>::upperBound( size_t i, size_t j )
+{
+   const size_t k( offset( const_cast<const This&>( *this ).upperBound( i, j ) ) );
+   return Iterator( values_+k, indices_+k );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater than the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater than the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index greater than the given column index. The binary search is performed directly on the
+// contiguous array of column indices.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline typename CompressedSoAMatrix<Type,SO,IT>::ConstIterator
+   CompressedSoAMatrix<Type,SO,IT>::upperBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+
+   const IT* const pos( std::upper_bound( indices_+begin_[i], indices_+end_[i], j,
+                                          []( size_t value, const IT& index )
+                                          {
+                                             return value < static_cast<size_t>( index );
+                                          } ) );
+
+   return ConstIterator( values_+( pos - indices_ ), pos );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NUMERIC FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief In-place transpose of the matrix.
+//
+// \return Reference to the transposed matrix.
+// \exception std::invalid_argument Number of columns exceeds the range of the index type.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline CompressedSoAMatrix<Type,SO,IT>& CompressedSoAMatrix<Type,SO,IT>::transpose()
+{
+   CompressedSoAMatrix tmp( trans( *this ) );
+   swap( tmp );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place conjugate transpose of the matrix.
+//
+// \return Reference to the transposed matrix.
+// \exception std::invalid_argument Number of columns exceeds the range of the index type.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline CompressedSoAMatrix<Type,SO,IT>& CompressedSoAMatrix<Type,SO,IT>::ctranspose()
+{
+   CompressedSoAMatrix tmp( ctrans( *this ) );
+   swap( tmp );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scaling of the compressed matrix by the scalar value \a scalar (\f$ A=B*s \f$).
+//
+// \param scalar The scalar value for the matrix scaling.
+// \return Reference to the compressed matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename IT >     // Type of the stored indices
+template< typename Other >  // Data type of the scalar value
+inline CompressedSoAMatrix<Type,SO,IT>& CompressedSoAMatrix<Type,SO,IT>::scale( const Other& scalar )
+{
+   for( size_t i=0UL; i<m_; ++i )
+      for( size_t k=begin_[i]; k<end_[i]; ++k )
+         values_[k] *= scalar;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename IT >     // Type of the stored indices
+template< typename Other >  // Data type of the foreign expression
+inline bool CompressedSoAMatrix<Type,SO,IT>::canAlias( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename IT >     // Type of the stored indices
+template< typename Other >  // Data type of the foreign expression
+inline bool CompressedSoAMatrix<Type,SO,IT>::isAliased( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline bool CompressedSoAMatrix<Type,SO,IT>::canSMPAssign() const noexcept
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline void CompressedSoAMatrix<Type,SO,IT>::assign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   if( m_ == 0UL || n_ == 0UL )
+      return;
+
+   size_t nonzeros( 0UL );
+
+   for( size_t i=1UL; i<=m_; ++i )
+      begin_[i] = end_[i] = end_[m_];
+
+   for( size_t i=0UL; i<m_; ++i )
+   {
+      begin_[i] = end_[i] = nonzeros;
+
+      const size_t jbegin( ( IsUpper_v<MT> )
+                           ?( IsStrictlyUpper_v<MT> ? i+1UL : i )
+                           :( 0UL ) );
+      const size_t jend  ( ( IsLower_v<MT> )
+                           ?( IsStrictlyLower_v<MT> ? i : i+1UL )
+                           :( n_ ) );
+
+      for( size_t j=jbegin; j<jend; ++j )
+      {
+         if( nonzeros == capacity() ) {
+            reserveElements( extendCapacity() );
+            for( size_t k=i+1UL; k<=m_; ++k )
+               begin_[k] = end_[k] = end_[m_];
+         }
+
+         values_[end_[i]] = (~rhs)(i,j);
+
+         if( !isDefault<strict>( values_[end_[i]] ) ) {
+            indices_[end_[i]] = static_cast<IT>( j );
+            ++end_[i];
+            ++nonzeros;
+         }
+      }
+   }
+
+   begin_[m_] = nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a row-major sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+template< typename MT >  // Type of the right-hand side sparse matrix
+inline void CompressedSoAMatrix<Type,SO,IT>::assign( const SparseMatrix<MT,SO>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( nonZeros() == 0UL, "Invalid non-zero elements detected" );
+   BLAZE_INTERNAL_ASSERT( capacity() >= (~rhs).nonZeros(), "Invalid capacity detected" );
+
+   if( m_ == 0UL || values_ == nullptr )
+      return;
+
+   for( size_t i=0UL; i<m_; ++i ) {
+      size_t k( begin_[i] );
+      for( auto element=(~rhs).begin(i); element!=(~rhs).end(i); ++element, ++k ) {
+         values_ [k] = element->value();
+         indices_[k] = static_cast<IT>( element->index() );
+      }
+      end_[i] = k;
+      begin_[i+1UL] = end_[i];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a column-major sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+template< typename MT >  // Type of the right-hand side sparse matrix
+inline void CompressedSoAMatrix<Type,SO,IT>::assign( const SparseMatrix<MT,!SO>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( nonZeros() == 0UL, "Invalid non-zero elements detected" );
+   BLAZE_INTERNAL_ASSERT( capacity() >= (~rhs).nonZeros(), "Invalid capacity detected" );
+
+   // Counting the number of elements per row
+   std::vector<size_t> rowLengths( m_, 0UL );
+   for( size_t j=0UL; j<n_; ++j ) {
+      for( auto element=(~rhs).begin(j); element!=(~rhs).end(j); ++element )
+         ++rowLengths[element->index()];
+   }
+
+   // Resizing the compressed matrix
+   for( size_t i=0UL; i<m_; ++i ) {
+      end_[i] = begin_[i];
+      begin_[i+1UL] = begin_[i] + rowLengths[i];
+   }
+
+   // Appending the elements to the rows of the compressed matrix
+   for( size_t j=0UL; j<n_; ++j ) {
+      for( auto element=(~rhs).begin(j); element!=(~rhs).end(j); ++element )
+         append( element->index(), j, element->value() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline void CompressedSoAMatrix<Type,SO,IT>::addAssign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   CompressedSoAMatrix tmp( serial( *this + (~rhs) ) );
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+template< typename MT    // Type of the right-hand side sparse matrix
+        , bool SO2 >     // Storage order of the right-hand side sparse matrix
+inline void CompressedSoAMatrix<Type,SO,IT>::addAssign( const SparseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   CompressedSoAMatrix tmp( serial( *this + (~rhs) ) );
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline void CompressedSoAMatrix<Type,SO,IT>::subAssign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   CompressedSoAMatrix tmp( serial( *this - (~rhs) ) );
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+template< typename MT    // Type of the right-hand side sparse matrix
+        , bool SO2 >     // Storage order of the right-hand side sparse matrix
+inline void CompressedSoAMatrix<Type,SO,IT>::subAssign( const SparseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   CompressedSoAMatrix tmp( serial( *this - (~rhs) ) );
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the Schur product assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix for the Schur product.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline void CompressedSoAMatrix<Type,SO,IT>::schurAssign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( MT );
+
+   for( size_t i=0UL; i<m_; ++i ) {
+      for( size_t k=begin_[i]; k<end_[i]; ++k )
+         values_[k] *= (~rhs)(i,indices_[k]);
+   }
+}
+//*************************************************************************************************
+
+
+
+
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of CompressedSoAMatrix for column-major matrices.
+// \ingroup compressed_soa_matrix
+//
+// This specialization of CompressedSoAMatrix adapts the class template to the requirements of
+// column-major matrices.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+class CompressedSoAMatrix<Type,true,IT>
+   : public SparseMatrix< CompressedSoAMatrix<Type,true,IT>, true >
+{
+ private:
+   //**Private class Uninitialized*****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Auxiliary helper class for the construction of compressed matrices.
+   */
+   struct Uninitialized {};
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   using This           = CompressedSoAMatrix<Type,true,IT>;  //!< Type of this CompressedSoAMatrix instance.
+   using BaseType       = SparseMatrix<This,true>;            //!< Base type of this CompressedSoAMatrix instance.
+   using ResultType     = This;                               //!< Result type for expression template evaluations.
+   using OppositeType   = CompressedSoAMatrix<Type,false,IT>; //!< Result type with opposite storage order for expression template evaluations.
+   using TransposeType  = CompressedSoAMatrix<Type,false,IT>; //!< Transpose type for expression template evaluations.
+   using ElementType    = Type;                               //!< Type of the compressed matrix elements.
+   using IndexType      = IT;                                 //!< Type of the stored indices.
+   using ReturnType     = const Type&;                        //!< Return type for expression template evaluations.
+   using CompositeType  = const This&;                        //!< Data type for composite expression templates.
+   using Reference      = MatrixAccessProxy<This>;            //!< Reference to a compressed matrix value.
+   using ConstReference = const Type&;                        //!< Reference to a constant compressed matrix value.
+   using Iterator       = SoAIterator<Type,IT>;               //!< Iterator over non-constant elements.
+   using ConstIterator  = SoAIterator<const Type,IT>;         //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a CompressedSoAMatrix with different data/element type.
+   */
+   template< typename NewType >  // Data type of the other matrix
+   struct Rebind {
+      using Other = CompressedSoAMatrix<NewType,true,IT>;  //!< The type of the other CompressedSoAMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Resize struct definition********************************************************************
+   /*!\brief Resize mechanism to obtain a CompressedSoAMatrix with different fixed dimensions.
+   */
+   template< size_t NewM    // Number of rows of the other matrix
+           , size_t NewN >  // Number of columns of the other matrix
+   struct Resize {
+      using Other = CompressedSoAMatrix<Type,true,IT>;  //!< The type of the other CompressedSoAMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   static constexpr bool smpAssignable = !IsSMPAssignable_v<Type>;
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline CompressedSoAMatrix();
+   inline CompressedSoAMatrix( size_t m, size_t n );
+   inline CompressedSoAMatrix( size_t m, size_t n, size_t nonzeros );
+          CompressedSoAMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros );
+   inline CompressedSoAMatrix( initializer_list< initializer_list<Type> > list );
+
+   inline CompressedSoAMatrix( const CompressedSoAMatrix& sm );
+   inline CompressedSoAMatrix( CompressedSoAMatrix&& sm ) noexcept;
+
+   template< typename MT, bool SO2 > inline CompressedSoAMatrix( const DenseMatrix<MT,SO2>&  dm );
+   template< typename MT, bool SO2 > inline CompressedSoAMatrix( const SparseMatrix<MT,SO2>& sm );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~CompressedSoAMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator()( size_t i, size_t j ) noexcept;
+   inline ConstReference operator()( size_t i, size_t j ) const noexcept;
+   inline Reference      at( size_t i, size_t j );
+   inline ConstReference at( size_t i, size_t j ) const;
+   inline Iterator       begin ( size_t j ) noexcept;
+   inline ConstIterator  begin ( size_t j ) const noexcept;
+   inline ConstIterator  cbegin( size_t j ) const noexcept;
+   inline Iterator       end   ( size_t j ) noexcept;
+   inline ConstIterator  end   ( size_t j ) const noexcept;
+   inline ConstIterator  cend  ( size_t j ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline CompressedSoAMatrix& operator=( initializer_list< initializer_list<Type> > list );
+   inline CompressedSoAMatrix& operator=( const CompressedSoAMatrix& rhs );
+   inline CompressedSoAMatrix& operator=( CompressedSoAMatrix&& rhs ) noexcept;
+
+   template< typename MT, bool SO2 > inline CompressedSoAMatrix& operator= ( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT, bool SO2 > inline CompressedSoAMatrix& operator= ( const SparseMatrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline CompressedSoAMatrix& operator+=( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline CompressedSoAMatrix& operator-=( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline CompressedSoAMatrix& operator%=( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT, bool SO2 > inline CompressedSoAMatrix& operator%=( const SparseMatrix<MT,SO2>& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const noexcept;
+   inline size_t columns() const noexcept;
+   inline size_t capacity() const noexcept;
+   inline size_t capacity( size_t j ) const noexcept;
+   inline size_t nonZeros() const;
+   inline size_t nonZeros( size_t j ) const;
+   inline void   reset();
+   inline void   reset( size_t j );
+   inline void   clear();
+          void   resize ( size_t m, size_t n, bool preserve=true );
+   inline void   reserve( size_t nonzeros );
+          void   reserve( size_t j, size_t nonzeros );
+   inline void   trim   ();
+   inline void   trim   ( size_t j );
+   inline void   shrinkToFit();
+   inline void   swap( CompressedSoAMatrix& sm ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Insertion functions*************************************************************************
+   /*!\name Insertion functions */
+   //@{
+   inline Iterator set     ( size_t i, size_t j, const Type& value );
+   inline Iterator insert  ( size_t i, size_t j, const Type& value );
+   inline void     append  ( size_t i, size_t j, const Type& value, bool check=false );
+   inline void     finalize( size_t j );
+   //@}
+   //**********************************************************************************************
+
+   //**Erase functions*****************************************************************************
+   /*!\name Erase functions */
+   //@{
+   inline void     erase( size_t i, size_t j );
+   inline Iterator erase( size_t j, Iterator pos );
+   inline Iterator erase( size_t j, Iterator first, Iterator last );
+
+   template< typename Pred >
+   inline void erase( Pred predicate );
+
+   template< typename Pred >
+   inline void erase( size_t j, Iterator first, Iterator last, Pred predicate );
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline Iterator      find      ( size_t i, size_t j );
+   inline ConstIterator find      ( size_t i, size_t j ) const;
+   inline Iterator      lowerBound( size_t i, size_t j );
+   inline ConstIterator lowerBound( size_t i, size_t j ) const;
+   inline Iterator      upperBound( size_t i, size_t j );
+   inline ConstIterator upperBound( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Numeric functions***************************************************************************
+   /*!\name Numeric functions */
+   //@{
+   inline CompressedSoAMatrix& transpose();
+   inline CompressedSoAMatrix& ctranspose();
+
+   template< typename Other > inline CompressedSoAMatrix& scale( const Other& scalar );
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   inline bool canSMPAssign() const noexcept;
+
+   template< typename MT, bool SO2 > inline void assign     ( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT >           inline void assign     ( const SparseMatrix<MT,true>&  rhs );
+   template< typename MT >           inline void assign     ( const SparseMatrix<MT,false>& rhs );
+   template< typename MT, bool SO2 > inline void addAssign  ( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT, bool SO2 > inline void addAssign  ( const SparseMatrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline void subAssign  ( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT, bool SO2 > inline void subAssign  ( const SparseMatrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline void schurAssign( const DenseMatrix<MT,SO2>&  rhs );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline CompressedSoAMatrix( size_t m, size_t n, Uninitialized );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline size_t checkIndexRange( size_t m );
+
+   inline size_t extendCapacity() const noexcept;
+          void   reserveElements( size_t nonzeros );
+
+   inline size_t offset( ConstIterator it ) const noexcept;
+   inline void   moveElements        ( size_t first, size_t last, size_t dest );
+   inline void   moveElementsBackward( size_t first, size_t last, size_t destLast );
+   //@}
+   //**********************************************************************************************
+
+   //**Insertion functions*************************************************************************
+   /*!\name Insertion functions */
+   //@{
+   Iterator insert( size_t pos, size_t i, size_t j, const Type& value );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t  m_;         //!< The current number of rows of the compressed matrix.
+   size_t  n_;         //!< The current number of columns of the compressed matrix.
+   size_t  capacity_;  //!< The current capacity of the offset array.
+   size_t* begin_;     //!< Offsets of the first non-zero element of each column.
+   size_t* end_;       //!< Offsets one past the last non-zero element of each column.
+   Type*   values_;    //!< The values of the non-zero elements.
+   IT*     indices_;   //!< The row indices of the non-zero elements.
+
+   static const Type zero_;  //!< Neutral element for accesses to zero elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_CONSTRAINT_MUST_BE_INTEGRAL_TYPE     ( IT );
+   BLAZE_CONSTRAINT_MUST_BE_UNSIGNED_TYPE     ( IT );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+template< typename Type, typename IT >
+const Type CompressedSoAMatrix<Type,true,IT>::zero_{};
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The default constructor for CompressedSoAMatrix.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline CompressedSoAMatrix<Type,true,IT>::CompressedSoAMatrix()
+   : m_       ( 0UL )      // The current number of rows of the compressed matrix
+   , n_       ( 0UL )      // The current number of columns of the compressed matrix
+   , capacity_( 0UL )      // The current capacity of the offset array
+   , begin_   ( nullptr )  // Offsets of the first non-zero element of each column
+   , end_     ( nullptr )  // Offsets one past the last non-zero element of each column
+   , values_  ( nullptr )  // The values of the non-zero elements
+   , indices_ ( nullptr )  // The row indices of the non-zero elements
+{}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Constructor for a matrix of size \f$ M \times N \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \exception std::invalid_argument Number of rows exceeds the range of the index type.
+//
+// The matrix is initialized to the zero matrix and has no free capacity.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline CompressedSoAMatrix<Type,true,IT>::CompressedSoAMatrix( size_t m, size_t n )
+   : CompressedSoAMatrix( m, n, Uninitialized() )
+{
+   for( size_t j=1UL; j<2UL*n_+2UL; ++j )
+      begin_[j] = 0UL;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Constructor for a matrix of size \f$ M \times N \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param nonzeros The number of expected non-zero elements.
+// \exception std::invalid_argument Number of rows exceeds the range of the index type.
+//
+// The matrix is initialized to the zero matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline CompressedSoAMatrix<Type,true,IT>::CompressedSoAMatrix( size_t m, size_t n, size_t nonzeros )
+   : CompressedSoAMatrix( m, n, Uninitialized() )
+{
+   values_  = allocate<Type>( nonzeros );
+   indices_ = allocate<IT>( nonzeros );
+
+   for( size_t j=1UL; j<(2UL*n_+1UL); ++j )
+      begin_[j] = 0UL;
+   end_[n_] = nonzeros;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Constructor for a matrix of size \f$ M \times N \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param nonzeros The expected number of non-zero elements in each column.
+// \exception std::invalid_argument Number of rows exceeds the range of the index type.
+//
+// The matrix is initialized to the zero matrix and will have the specified capacity in each
+// column. Note that the given vector must have at least \a n elements.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+CompressedSoAMatrix<Type,true,IT>::CompressedSoAMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros )
+   : CompressedSoAMatrix( m, n, Uninitialized() )
+{
+   BLAZE_USER_ASSERT( nonzeros.size() == n, "Size of capacity vector and number of columns don't match" );
+
+   size_t newCapacity( 0UL );
+   for( auto it=nonzeros.begin(); it!=nonzeros.end(); ++it )
+      newCapacity += *it;
+
+   values_  = allocate<Type>( newCapacity );
+   indices_ = allocate<IT>( newCapacity );
+
+   end_[0UL] = 0UL;
+   for( size_t j=0UL; j<n_; ++j ) {
+      begin_[j+1UL] = end_[j+1UL] = begin_[j] + nonzeros[j];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief List initialization of all matrix elements.
+//
+// \param list The initializer list.
+// \exception std::invalid_argument Number of rows exceeds the range of the index type.
+//
+// This constructor provides the option to explicitly initialize the elements of the matrix by
+// means of an initializer list:
+
+   \code
+   using blaze::rowMajor;
+
+   blaze::CompressedSoAMatrix<int,rowMajor> A{ { 1, 2, 3 },
+                                               { 4, 5 },
+                                               { 7, 8, 9 } };
+   \endcode
+
+// The matrix is sized according to the size of the initializer list and all its elements are
+// initialized by the values of the given initializer list. Missing values are considered to
+// be default values.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline CompressedSoAMatrix<Type,true,IT>::CompressedSoAMatrix( initializer_list< initializer_list<Type> > list )
+   : CompressedSoAMatrix( list.size(), determineColumns( list ), blaze::nonZeros( list ) )
+{
+   for( size_t j=0UL; j<n_; ++j )
+   {
+      size_t i( 0UL );
+
+      for( const auto& rowList : list )
+      {
+         if( rowList.size() <= j ) {
+            ++i;
+            continue;
+         }
+
+         auto pos( rowList.begin() );
+         std::advance( pos, j );
+         if( !isDefault<strict>( *pos ) )
+            append( i, j, *pos );
+         ++i;
+      }
+
+      finalize( j );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The copy constructor for CompressedSoAMatrix.
+//
+// \param sm Sparse matrix to be copied.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline CompressedSoAMatrix<Type,true,IT>::CompressedSoAMatrix( const CompressedSoAMatrix& sm )
+   : CompressedSoAMatrix( sm.m_, sm.n_, Uninitialized() )
+{
+   const size_t nonzeros( sm.nonZeros() );
+
+   values_  = allocate<Type>( nonzeros );
+   indices_ = allocate<IT>( nonzeros );
+
+   for( size_t j=0UL; j<n_; ++j ) {
+      std::copy( sm.values_+sm.begin_[j], sm.values_+sm.end_[j], values_+begin_[j] );
+      std::copy( sm.indices_+sm.begin_[j], sm.indices_+sm.end_[j], indices_+begin_[j] );
+      end_[j] = begin_[j] + sm.nonZeros( j );
+      begin_[j+1UL] = end_[j];
+   }
+   end_[n_] = nonzeros;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The move constructor for CompressedSoAMatrix.
+//
+// \param sm The compressed matrix to be moved into this instance.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline CompressedSoAMatrix<Type,true,IT>::CompressedSoAMatrix( CompressedSoAMatrix&& sm ) noexcept
+   : m_       ( sm.m_ )         // The current number of rows of the compressed matrix
+   , n_       ( sm.n_ )         // The current number of columns of the compressed matrix
+   , capacity_( sm.capacity_ )  // The current capacity of the offset array
+   , begin_   ( sm.begin_ )     // Offsets of the first non-zero element of each column
+   , end_     ( sm.end_ )       // Offsets one past the last non-zero element of each column
+   , values_  ( sm.values_ )    // The values of the non-zero elements
+   , indices_ ( sm.indices_ )   // The row indices of the non-zero elements
+{
+   sm.m_        = 0UL;
+   sm.n_        = 0UL;
+   sm.capacity_ = 0UL;
+   sm.begin_    = nullptr;
+   sm.end_      = nullptr;
+   sm.values_   = nullptr;
+   sm.indices_  = nullptr;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Conversion constructor from dense matrices.
+//
+// \param dm Dense matrix to be copied.
+// \exception std::invalid_argument Number of rows exceeds the range of the index type.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+template< typename MT    // Type of the foreign dense matrix
+        , bool SO2 >     // Storage order of the foreign dense matrix
+inline CompressedSoAMatrix<Type,true,IT>::CompressedSoAMatrix( const DenseMatrix<MT,SO2>& dm )
+   : CompressedSoAMatrix( (~dm).rows(), (~dm).columns() )
+{
+   using blaze::assign;
+
+   assign( *this, ~dm );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Conversion constructor from different sparse matrices.
+//
+// \param sm Sparse matrix to be copied.
+// \exception std::invalid_argument Number of rows exceeds the range of the index type.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+template< typename MT    // Type of the foreign compressed matrix
+        , bool SO2 >     // Storage order of the foreign compressed matrix
+inline CompressedSoAMatrix<Type,true,IT>::CompressedSoAMatrix( const SparseMatrix<MT,SO2>& sm )
+   : CompressedSoAMatrix( (~sm).rows(), (~sm).columns(), (~sm).nonZeros() )
+{
+   using blaze::assign;
+
+   assign( *this, ~sm );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Constructor for an uninitialized matrix of size \f$ M \times N \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \exception std::invalid_argument Number of rows exceeds the range of the index type.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline CompressedSoAMatrix<Type,true,IT>::CompressedSoAMatrix( size_t m, size_t n, Uninitialized )
+   : m_       ( checkIndexRange( m ) )    // The current number of rows of the compressed matrix
+   , n_       ( n )                       // The current number of columns of the compressed matrix
+   , capacity_( n )                       // The current capacity of the offset array
+   , begin_   ( new size_t[2UL*n+2UL] )   // Offsets of the first non-zero element of each column
+   , end_     ( begin_+(n+1UL) )          // Offsets one past the last non-zero element of each column
+   , values_  ( nullptr )                 // The values of the non-zero elements
+   , indices_ ( nullptr )                 // The row indices of the non-zero elements
+{
+   begin_[0] = 0UL;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The destructor for CompressedSoAMatrix.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline CompressedSoAMatrix<Type,true,IT>::~CompressedSoAMatrix()
+{
+   deallocate( values_ );
+   deallocate( indices_ );
+   delete[] begin_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief 2D-access to the compressed matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function returns a reference to the accessed value at position (\a i,\a j). In case the
+// compressed matrix does not yet store an element at position (\a i,\a j) , a new element is
+// inserted into the compressed matrix. Note that this function only performs an index check in
+// case BLAZE_USER_ASSERT() is active. In contrast, the at() function is guaranteed to perform a
+// check of the given access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline typename CompressedSoAMatrix<Type,true,IT>::Reference
+   CompressedSoAMatrix<Type,true,IT>::operator()( size_t i, size_t j ) noexcept
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   return Reference( *this, i, j );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief 2D-access to the compressed matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline typename CompressedSoAMatrix<Type,true,IT>::ConstReference
+   CompressedSoAMatrix<Type,true,IT>::operator()( size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const ConstIterator pos( lowerBound( i, j ) );
+
+   if( pos == end( j ) || pos->index() != i )
+      return zero_;
+   else
+      return pos->value();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checked access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// This function returns a reference to the accessed value at position (\a i,\a j). In case the
+// compressed matrix does not yet store an element at position (\a i,\a j) , a new element is
+// inserted into the compressed matrix. In contrast to the function call operator this function
+// always performs a check of the given access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline typename CompressedSoAMatrix<Type,true,IT>::Reference
+   CompressedSoAMatrix<Type,true,IT>::at( size_t i, size_t j )
+{
+   if( i >= m_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checked access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// In contrast to the function call operator this function always performs a check of the given
+// access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline typename CompressedSoAMatrix<Type,true,IT>::ConstReference
+   CompressedSoAMatrix<Type,true,IT>::at( size_t i, size_t j ) const
+{
+   if( i >= m_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator to the first non-zero element of column \a j.
+//
+// \param j The column index.
+// \return Iterator to the first non-zero element of column \a j.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline typename CompressedSoAMatrix<Type,true,IT>::Iterator
+   CompressedSoAMatrix<Type,true,IT>::begin( size_t j ) noexcept
+{
+   BLAZE_USER_ASSERT( j < n_, "Invalid compressed matrix column access index" );
+   return Iterator( values_+begin_[j], indices_+begin_[j] );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator to the first non-zero element of column \a j.
+//
+// \param j The column index.
+// \return Iterator to the first non-zero element of column \a j.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline typename CompressedSoAMatrix<Type,true,IT>::ConstIterator
+   CompressedSoAMatrix<Type,true,IT>::begin( size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( j < n_, "Invalid compressed matrix column access index" );
+   return ConstIterator( values_+begin_[j], indices_+begin_[j] );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator to the first non-zero element of column \a j.
+//
+// \param j The column index.
+// \return Iterator to the first non-zero element of column \a j.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline typename CompressedSoAMatrix<Type,true,IT>::ConstIterator
+   CompressedSoAMatrix<Type,true,IT>::cbegin( size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( j < n_, "Invalid compressed matrix column access index" );
+   return ConstIterator( values_+begin_[j], indices_+begin_[j] );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator just past the last non-zero element of column \a j.
+//
+// \param j The column index.
+// \return Iterator just past the last non-zero element of column \a j.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline typename CompressedSoAMatrix<Type,true,IT>::Iterator
+   CompressedSoAMatrix<Type,true,IT>::end( size_t j ) noexcept
+{
+   BLAZE_USER_ASSERT( j < n_, "Invalid compressed matrix column access index" );
+   return Iterator( values_+end_[j], indices_+end_[j] );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator just past the last non-zero element of column \a j.
+//
+// \param j The column index.
+// \return Iterator just past the last non-zero element of column \a j.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline typename CompressedSoAMatrix<Type,true,IT>::ConstIterator
+   CompressedSoAMatrix<Type,true,IT>::end( size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( j < n_, "Invalid compressed matrix column access index" );
+   return ConstIterator( values_+end_[j], indices_+end_[j] );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator just past the last non-zero element of column \a j.
+//
+// \param j The column index.
+// \return Iterator just past the last non-zero element of column \a j.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline typename CompressedSoAMatrix<Type,true,IT>::ConstIterator
+   CompressedSoAMatrix<Type,true,IT>::cend( size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( j < n_, "Invalid compressed matrix column access index" );
+   return ConstIterator( values_+end_[j], indices_+end_[j] );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief List assignment to all matrix elements.
+//
+// \param list The initializer list.
+// \exception std::invalid_argument Number of rows exceeds the range of the index type.
+//
+// This assignment operator offers the option to directly assign to all elements of the matrix
+// by means of an initializer list. The matrix is resized according to the given initializer
+// list and all its elements are assigned the values from the given initializer list. Missing
+// values are initialized as default (as e.g. the value 6 in the example).
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline CompressedSoAMatrix<Type,true,IT>&
+   CompressedSoAMatrix<Type,true,IT>::operator=( initializer_list< initializer_list<Type> > list )
+{
+   using blaze::nonZeros;
+
+   resize( list.size(), determineColumns( list ), false );
+   reserve( nonZeros( list ) );
+
+   for( size_t j=0UL; j<n_; ++j )
+   {
+      size_t i( 0UL );
+
+      for( const auto& rowList : list )
+      {
+         if( rowList.size() <= j ) {
+            ++i;
+            continue;
+         }
+
+         auto pos( rowList.begin() );
+         std::advance( pos, j );
+         if( !isDefault<strict>( *pos ) )
+            append( i, j, *pos );
+         ++i;
+      }
+
+      finalize( j );
+   }
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Copy assignment operator for CompressedSoAMatrix.
+//
+// \param rhs Compressed matrix to be copied.
+// \return Reference to the assigned compressed matrix.
+//
+// The compressed matrix is resized according to the given compressed matrix and initialized
+// as a copy of this matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline CompressedSoAMatrix<Type,true,IT>&
+   CompressedSoAMatrix<Type,true,IT>::operator=( const CompressedSoAMatrix& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   if( begin_ == nullptr || rhs.n_ > capacity_ || rhs.nonZeros() > capacity() )
+   {
+      CompressedSoAMatrix tmp( rhs );
+      swap( tmp );
+   }
+   else
+   {
+      const size_t cap( capacity() );
+
+      for( size_t j=0UL; j<rhs.n_; ++j ) {
+         std::copy( rhs.values_+rhs.begin_[j], rhs.values_+rhs.end_[j], values_+begin_[j] );
+         std::copy( rhs.indices_+rhs.begin_[j], rhs.indices_+rhs.end_[j], indices_+begin_[j] );
+         end_[j] = begin_[j] + rhs.nonZeros( j );
+         begin_[j+1UL] = end_[j];
+      }
+      end_[rhs.n_] = cap;
+
+      m_ = rhs.m_;
+      n_ = rhs.n_;
+   }
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Move assignment operator for CompressedSoAMatrix.
+//
+// \param rhs The compressed matrix to be moved into this instance.
+// \return Reference to the assigned compressed matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline CompressedSoAMatrix<Type,true,IT>&
+   CompressedSoAMatrix<Type,true,IT>::operator=( CompressedSoAMatrix&& rhs ) noexcept
+{
+   deallocate( values_ );
+   deallocate( indices_ );
+   delete[] begin_;
+
+   m_        = rhs.m_;
+   n_        = rhs.n_;
+   capacity_ = rhs.capacity_;
+   begin_    = rhs.begin_;
+   end_      = rhs.end_;
+   values_   = rhs.values_;
+   indices_  = rhs.indices_;
+
+   rhs.m_        = 0UL;
+   rhs.n_        = 0UL;
+   rhs.capacity_ = 0UL;
+   rhs.begin_    = nullptr;
+   rhs.end_      = nullptr;
+   rhs.values_   = nullptr;
+   rhs.indices_  = nullptr;
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Assignment operator for dense matrices.
+//
+// \param rhs Dense matrix to be assigned.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Number of rows exceeds the range of the index type.
+//
+// The matrix is resized according to the given \f$ M \times N \f$ matrix and initialized as a
+// copy of this matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline CompressedSoAMatrix<Type,true,IT>&
+   CompressedSoAMatrix<Type,true,IT>::operator=( const DenseMatrix<MT,SO2>& rhs )
+{
+   using blaze::assign;
+
+   if( (~rhs).canAlias( this ) ) {
+      CompressedSoAMatrix tmp( ~rhs );
+      swap( tmp );
+   }
+   else {
+      resize( (~rhs).rows(), (~rhs).columns(), false );
+      assign( *this, ~rhs );
+   }
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Assignment operator for different sparse matrices.
+//
+// \param rhs Sparse matrix to be assigned.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Number of rows exceeds the range of the index type.
+//
+// The matrix is resized according to the given \f$ M \times N \f$ matrix and initialized as a
+// copy of this matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+template< typename MT    // Type of the right-hand side sparse matrix
+        , bool SO2 >     // Storage order of the right-hand side sparse matrix
+inline CompressedSoAMatrix<Type,true,IT>&
+   CompressedSoAMatrix<Type,true,IT>::operator=( const SparseMatrix<MT,SO2>& rhs )
+{
+   using blaze::assign;
+
+   if( (~rhs).canAlias( this ) ||
+       (~rhs).columns()     > capacity_ ||
+       (~rhs).nonZeros() > capacity() ) {
+      CompressedSoAMatrix tmp( ~rhs );
+      swap( tmp );
+   }
+   else {
+      resize( (~rhs).rows(), (~rhs).columns(), false );
+      reset();
+
+      if( !IsZero_v<MT> ) {
+         assign( *this, ~rhs );
+      }
+   }
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Addition assignment operator for the addition of a matrix (\f$ A+=B \f$).
+//
+// \param rhs The right-hand side matrix to be added to the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline CompressedSoAMatrix<Type,true,IT>&
+   CompressedSoAMatrix<Type,true,IT>::operator+=( const Matrix<MT,SO2>& rhs )
+{
+   using blaze::addAssign;
+
+   if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( !IsZero_v<MT> ) {
+      addAssign( *this, ~rhs );
+   }
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Subtraction assignment operator for the subtraction of a matrix (\f$ A-=B \f$).
+//
+// \param rhs The right-hand side matrix to be subtracted from the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline CompressedSoAMatrix<Type,true,IT>&
+   CompressedSoAMatrix<Type,true,IT>::operator-=( const Matrix<MT,SO2>& rhs )
+{
+   using blaze::subAssign;
+
+   if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( !IsZero_v<MT> ) {
+      subAssign( *this, ~rhs );
+   }
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Schur product assignment operator for the multiplication of a dense matrix
+//        (\f$ A\circ=B \f$).
+//
+// \param rhs The right-hand side dense matrix for the Schur product.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline CompressedSoAMatrix<Type,true,IT>&
+   CompressedSoAMatrix<Type,true,IT>::operator%=( const DenseMatrix<MT,SO2>& rhs )
+{
+   using blaze::schurAssign;
+
+   if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( (~rhs).canAlias( this ) ) {
+      CompressedSoAMatrix tmp( *this % (~rhs) );
+      swap( tmp );
+   }
+   else {
+      CompositeType_t<MT> tmp( ~rhs );
+      schurAssign( *this, tmp );
+   }
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Schur product assignment operator for the multiplication of a sparse matrix
+//        (\f$ A\circ=B \f$).
+//
+// \param rhs The right-hand side sparse matrix for the Schur product.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+template< typename MT    // Type of the right-hand side sparse matrix
+        , bool SO2 >     // Storage order of the right-hand side sparse matrix
+inline CompressedSoAMatrix<Type,true,IT>&
+   CompressedSoAMatrix<Type,true,IT>::operator%=( const SparseMatrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( !IsZero_v<MT> ) {
+      CompressedSoAMatrix tmp( *this % (~rhs) );
+      swap( tmp );
+   }
+   else {
+      reset();
+   }
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the current number of rows of the compressed matrix.
+//
+// \return The number of rows of the compressed matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline size_t CompressedSoAMatrix<Type,true,IT>::rows() const noexcept
+{
+   return m_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the current number of columns of the compressed matrix.
+//
+// \return The number of columns of the compressed matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline size_t CompressedSoAMatrix<Type,true,IT>::columns() const noexcept
+{
+   return n_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the maximum capacity of the compressed matrix.
+//
+// \return The capacity of the compressed matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline size_t CompressedSoAMatrix<Type,true,IT>::capacity() const noexcept
+{
+   if( begin_ != nullptr )
+      return end_[n_];
+   else return 0UL;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the current capacity of the specified column.
+//
+// \param j The index of the column.
+// \return The current capacity of column \a j.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline size_t CompressedSoAMatrix<Type,true,IT>::capacity( size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+   return begin_[j+1UL] - begin_[j];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of non-zero elements in the compressed matrix
+//
+// \return The number of non-zero elements in the compressed matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline size_t CompressedSoAMatrix<Type,true,IT>::nonZeros() const
+{
+   size_t nonzeros( 0UL );
+
+   for( size_t j=0UL; j<n_; ++j )
+      nonzeros += nonZeros( j );
+
+   return nonzeros;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of non-zero elements in the specified column.
+//
+// \param j The index of the column.
+// \return The number of non-zero elements of column \a j.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline size_t CompressedSoAMatrix<Type,true,IT>::nonZeros( size_t j ) const
+{
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+   return end_[j] - begin_[j];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline void CompressedSoAMatrix<Type,true,IT>::reset()
+{
+   for( size_t j=0UL; j<n_; ++j )
+      end_[j] = begin_[j];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reset the specified column to the default initial values.
+//
+// \param j The index of the column.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline void CompressedSoAMatrix<Type,true,IT>::reset( size_t j )
+{
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+   end_[j] = begin_[j];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Clearing the compressed matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the compressed matrix is 0.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline void CompressedSoAMatrix<Type,true,IT>::clear()
+{
+   if( end_ != nullptr )
+      end_[0UL] = end_[n_];
+   m_ = 0UL;
+   n_ = 0UL;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Changing the size of the compressed matrix.
+//
+// \param m The new number of rows of the compressed matrix.
+// \param n The new number of columns of the compressed matrix.
+// \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
+// \return void
+// \exception std::invalid_argument Number of rows exceeds the range of the index type.
+//
+// This function resizes the matrix using the given size to \f$ m \times n \f$. During this
+// operation, new dynamic memory may be allocated in case the capacity of the matrix is too
+// small. Note that this function may invalidate all existing views (submatrices, rows, columns,
+// ...) on the matrix if it is used to shrink the matrix. Additionally, the resize operation
+// potentially changes all matrix elements. In order to preserve the old matrix values, the
+// \a preserve flag can be set to \a true.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+void CompressedSoAMatrix<Type,true,IT>::resize( size_t m, size_t n, bool preserve )
+{
+   using std::swap;
+
+   BLAZE_INTERNAL_ASSERT( end_ >= begin_, "Invalid internal storage detected" );
+   BLAZE_INTERNAL_ASSERT( begin_ == nullptr || size_t( end_ - begin_ ) == capacity_ + 1UL, "Invalid storage setting detected" );
+
+   if( m == m_ && n == n_ ) return;
+
+   checkIndexRange( m );
+
+   if( begin_ == nullptr )
+   {
+      begin_ = new size_t[2UL*n+2UL];
+      end_   = begin_+n+1UL;
+
+      for( size_t j=0UL; j<2UL*n+2UL; ++j ) {
+         begin_[j] = 0UL;
+      }
+
+      capacity_ = n;
+   }
+   else if( n > capacity_ )
+   {
+      size_t* newBegin( new size_t[2UL*n+2UL] );
+      size_t* newEnd  ( newBegin+n+1UL );
+
+      newBegin[0UL] = begin_[0UL];
+
+      if( preserve ) {
+         for( size_t j=0UL; j<n_; ++j ) {
+            newEnd  [j]     = ( m < m_ )?( offset( lowerBound( m, j ) ) ):( end_[j] );
+            newBegin[j+1UL] = begin_[j+1UL];
+         }
+         for( size_t j=n_; j<n; ++j ) {
+            newBegin[j+1UL] = newEnd[j] = begin_[n_];
+         }
+      }
+      else {
+         for( size_t j=0UL; j<n; ++j ) {
+            newBegin[j+1UL] = newEnd[j] = begin_[0UL];
+         }
+      }
+
+      newEnd[n] = end_[n_];
+
+      swap( newBegin, begin_ );
+      delete[] newBegin;
+      end_ = newEnd;
+      capacity_ = n;
+   }
+   else if( n > n_ )
+   {
+      end_[n] = end_[n_];
+
+      if( !preserve ) {
+         for( size_t j=0UL; j<n_; ++j )
+            end_[j] = begin_[j];
+      }
+      else if( m < m_ ) {
+         for( size_t j=0UL; j<n_; ++j )
+            end_[j] = offset( lowerBound( m, j ) );
+      }
+
+      for( size_t j=n_; j<n; ++j ) {
+         begin_[j+1UL] = end_[j] = begin_[n_];
+      }
+   }
+   else
+   {
+      if( preserve ) {
+         for( size_t j=0UL; j<n; ++j )
+            end_[j] = offset( lowerBound( m, j ) );
+      }
+      else {
+         for( size_t j=0UL; j<n; ++j )
+            end_[j] = begin_[j];
+      }
+
+      end_[n] = end_[n_];
+   }
+
+   m_ = m;
+   n_ = n;
+
+   BLAZE_INTERNAL_ASSERT( end_ >= begin_, "Invalid internal storage detected" );
+   BLAZE_INTERNAL_ASSERT( size_t( end_ - begin_ ) == capacity_ + 1UL, "Invalid storage setting detected" );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Setting the minimum capacity of the compressed matrix.
+//
+// \param nonzeros The new minimum capacity of the compressed matrix.
+// \return void
+//
+// This function increases the capacity of the compressed matrix to at least \a nonzeros
+// elements. The current values of the matrix elements and the individual capacities of the
+// matrix columns are preserved.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline void CompressedSoAMatrix<Type,true,IT>::reserve( size_t nonzeros )
+{
+   if( nonzeros > capacity() )
+      reserveElements( nonzeros );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Setting the minimum capacity of a specific column of the compressed matrix.
+//
+// \param j The column index \f$[0..N-1]\f$.
+// \param nonzeros The new minimum capacity of the specified column.
+// \return void
+//
+// This function increases the capacity of column \a j of the compressed matrix to at least
+// \a nonzeros elements. The current values of the compressed matrix and all other individual
+// column capacities are preserved.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+void CompressedSoAMatrix<Type,true,IT>::reserve( size_t j, size_t nonzeros )
+{
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const size_t current( capacity(j) );
+
+   if( current >= nonzeros ) return;
+
+   const size_t additional( nonzeros - current );
+
+   if( end_[n_] - begin_[n_] < additional )
+   {
+      const size_t newCapacity( begin_[n_] + additional );
+      BLAZE_INTERNAL_ASSERT( newCapacity > capacity(), "Invalid capacity value" );
+
+      Type* newValues ( allocate<Type>( newCapacity ) );
+      IT*   newIndices( allocate<IT>( newCapacity ) );
+
+      size_t pos( 0UL );
+
+      for( size_t k=0UL; k<n_; ++k ) {
+         const size_t first( begin_[k] );
+         const size_t last ( end_[k] );
+         const size_t total( k == j ? nonzeros : begin_[k+1UL] - first );
+         transfer( values_+first, values_+last, newValues+pos );
+         std::copy( indices_+first, indices_+last, newIndices+pos );
+         begin_[k] = pos;
+         end_  [k] = pos + ( last - first );
+         pos += total;
+      }
+
+      BLAZE_INTERNAL_ASSERT( pos == newCapacity, "Invalid offset calculations" );
+
+      begin_[n_] = end_[n_] = newCapacity;
+
+      std::swap( newValues , values_  );
+      std::swap( newIndices, indices_ );
+      deallocate( newValues );
+      deallocate( newIndices );
+   }
+   else
+   {
+      begin_[n_] += additional;
+      for( size_t i=n_-1UL; i>j; --i ) {
+         moveElementsBackward( begin_[i], end_[i], end_[i]+additional );
+         begin_[i] += additional;
+         end_  [i] += additional;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Removing all excessive capacity from all columns.
+//
+// \return void
+//
+// The trim() function can be used to reverse the effect of all column-specific reserve() calls.
+// The function removes all excessive capacity from all columns. Note that this function does not
+// remove the overall capacity but only reduces the capacity per column.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline void CompressedSoAMatrix<Type,true,IT>::trim()
+{
+   for( size_t j=0UL; j<n_; ++j )
+      trim( j );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Removing all excessive capacity of a specific column of the compressed matrix.
+//
+// \param j The index of the column to be trimmed \f$[0..N-1]\f$.
+// \return void
+//
+// This function can be used to reverse the effect of a column-specific reserve() call. It removes
+// all excessive capacity from the specified column. The excessive capacity is assigned to the
+// subsequent column.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline void CompressedSoAMatrix<Type,true,IT>::trim( size_t j )
+{
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   if( j < ( n_ - 1UL ) ) {
+      const size_t nonzeros( end_[j+1UL] - begin_[j+1UL] );
+      moveElements( begin_[j+1UL], end_[j+1UL], end_[j] );
+      end_[j+1UL] = end_[j] + nonzeros;
+   }
+   begin_[j+1UL] = end_[j];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Requesting the removal of unused capacity.
+//
+// \return void
+//
+// This function minimizes the capacity of the matrix by removing unused capacity. Please note
+// that in case a reallocation occurs, all iterators (including end() iterators), all pointers
+// and references to elements of this matrix are invalidated.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline void CompressedSoAMatrix<Type,true,IT>::shrinkToFit()
+{
+   if( nonZeros() < capacity() ) {
+      CompressedSoAMatrix( *this ).swap( *this );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Swapping the contents of two sparse matrices.
+//
+// \param sm The compressed matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline void CompressedSoAMatrix<Type,true,IT>::swap( CompressedSoAMatrix& sm ) noexcept
+{
+   using std::swap;
+
+   swap( m_, sm.m_ );
+   swap( n_, sm.n_ );
+   swap( capacity_, sm.capacity_ );
+   swap( begin_, sm.begin_ );
+   swap( end_  , sm.end_   );
+   swap( values_ , sm.values_  );
+   swap( indices_, sm.indices_ );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checks whether the given number of rows can be represented by the index type.
+//
+// \param m The number of rows of the matrix.
+// \return The given number of rows.
+// \exception std::invalid_argument Number of rows exceeds the range of the index type.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline size_t CompressedSoAMatrix<Type,true,IT>::checkIndexRange( size_t m )
+{
+   if( m > 0UL && m-1UL > static_cast<size_t>( std::numeric_limits<IT>::max() ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Number of rows exceeds the range of the index type" );
+   }
+
+   return m;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Calculating a new matrix capacity.
+//
+// \return The new compressed matrix capacity.
+//
+// This function calculates a new matrix capacity based on the current capacity of the sparse
+// matrix. Note that the new capacity is restricted to the interval \f$[7..M \cdot N]\f$.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline size_t CompressedSoAMatrix<Type,true,IT>::extendCapacity() const noexcept
+{
+   size_t nonzeros( 2UL*capacity()+1UL );
+   nonzeros = blaze::max( nonzeros, 7UL );
+
+   BLAZE_INTERNAL_ASSERT( nonzeros > capacity(), "Invalid capacity value" );
+
+   return nonzeros;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reserving the specified number of compressed matrix elements.
+//
+// \param nonzeros The number of matrix elements to be reserved.
+// \return void
+//
+// Since the layout of the columns is described by offsets into the value and index arrays, the
+// reallocation of the two arrays does not affect the offsets of the columns.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+void CompressedSoAMatrix<Type,true,IT>::reserveElements( size_t nonzeros )
+{
+   if( begin_ == nullptr ) {
+      begin_ = new size_t[2UL*capacity_+2UL];
+      end_   = begin_+capacity_+1UL;
+      for( size_t j=0UL; j<2UL*capacity_+2UL; ++j )
+         begin_[j] = 0UL;
+   }
+
+   BLAZE_INTERNAL_ASSERT( nonzeros >= begin_[n_], "Invalid capacity value" );
+
+   Type* newValues ( allocate<Type>( nonzeros ) );
+   IT*   newIndices( allocate<IT>( nonzeros ) );
+
+   for( size_t k=0UL; k<n_; ++k ) {
+      BLAZE_INTERNAL_ASSERT( begin_[k] <= end_[k], "Invalid column offsets" );
+      transfer( values_+begin_[k], values_+end_[k], newValues+begin_[k] );
+      std::copy( indices_+begin_[k], indices_+end_[k], newIndices+begin_[k] );
+   }
+
+   end_[n_] = nonzeros;
+
+   std::swap( newValues , values_  );
+   std::swap( newIndices, indices_ );
+   deallocate( newValues );
+   deallocate( newIndices );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the offset of the given iterator within the value and index arrays.
+//
+// \param it Iterator to an element of the compressed matrix.
+// \return The offset of the element.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline size_t CompressedSoAMatrix<Type,true,IT>::offset( ConstIterator it ) const noexcept
+{
+   return it.indexBase() - indices_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Moves the elements in the range \f$[first..last)\f$ to the front, starting at \a dest.
+//
+// \param first The offset of the first element to be moved.
+// \param last The offset one past the last element to be moved.
+// \param dest The offset of the first destination element (\f$ dest \le first \f$).
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline void CompressedSoAMatrix<Type,true,IT>::moveElements( size_t first, size_t last, size_t dest )
+{
+   BLAZE_INTERNAL_ASSERT( dest <= first, "Invalid destination offset" );
+
+   std::move( values_+first, values_+last, values_+dest );
+   std::copy( indices_+first, indices_+last, indices_+dest );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Moves the elements in the range \f$[first..last)\f$ to the back, ending at \a destLast.
+//
+// \param first The offset of the first element to be moved.
+// \param last The offset one past the last element to be moved.
+// \param destLast The offset one past the last destination element (\f$ destLast \ge last \f$).
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline void CompressedSoAMatrix<Type,true,IT>::moveElementsBackward( size_t first, size_t last, size_t destLast )
+{
+   BLAZE_INTERNAL_ASSERT( destLast >= last, "Invalid destination offset" );
+
+   std::move_backward( values_+first, values_+last, values_+destLast );
+   std::copy_backward( indices_+first, indices_+last, indices_+destLast );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INSERTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Setting an element of the compressed matrix.
+//
+// \param i The row index of the new element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be set.
+// \return Iterator to the set element.
+//
+// This function sets the value of an element of the compressed matrix. In case the compressed
+// matrix already contains an element with column index \a j and row index \a i its value is
+// modified, else a new element with the given \a value is inserted.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline typename CompressedSoAMatrix<Type,true,IT>::Iterator
+   CompressedSoAMatrix<Type,true,IT>::set( size_t i, size_t j, const Type& value )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const Iterator pos( lowerBound( i, j ) );
+
+   if( pos != end( j ) && pos->index() == i ) {
+       pos->value() = value;
+       return pos;
+   }
+   else return insert( offset( pos ), i, j, value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Inserting an element into the compressed matrix.
+//
+// \param i The row index of the new element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be inserted.
+// \return Iterator to the newly inserted element.
+// \exception std::invalid_argument Invalid compressed matrix access index.
+//
+// This function inserts a new element into the compressed matrix. However, duplicate elements
+// are not allowed. In case the compressed matrix already contains an element with column index \a j
+// and row index \a i, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline typename CompressedSoAMatrix<Type,true,IT>::Iterator
+   CompressedSoAMatrix<Type,true,IT>::insert( size_t i, size_t j, const Type& value )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const Iterator pos( lowerBound( i, j ) );
+
+   if( pos != end( j ) && pos->index() == i ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Bad access index" );
+   }
+
+   return insert( offset( pos ), i, j, value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Inserting an element into the compressed matrix.
+//
+// \param pos The offset of the new element.
+// \param i The row index of the new element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be inserted.
+// \return Iterator to the newly inserted element.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+typename CompressedSoAMatrix<Type,true,IT>::Iterator
+   CompressedSoAMatrix<Type,true,IT>::insert( size_t pos, size_t i, size_t j, const Type& value )
+{
+   if( begin_[j+1UL] != end_[j] ) {
+      moveElementsBackward( pos, end_[j], end_[j]+1UL );
+      ++end_[j];
+   }
+   else if( end_[n_] != begin_[n_] ) {
+      moveElementsBackward( pos, end_[n_-1UL], end_[n_-1UL]+1UL );
+
+      for( size_t k=j+1UL; k<n_+1UL; ++k ) {
+         ++begin_[k];
+         ++end_[k-1UL];
+      }
+   }
+   else {
+      const size_t newCapacity( extendCapacity() );
+
+      Type* newValues ( allocate<Type>( newCapacity ) );
+      IT*   newIndices( allocate<IT>( newCapacity ) );
+
+      transfer( values_, values_+pos, newValues );
+      transfer( values_+pos, values_+end_[n_-1UL], newValues+pos+1UL );
+      std::copy( indices_, indices_+pos, newIndices );
+      std::copy( indices_+pos, indices_+end_[n_-1UL], newIndices+pos+1UL );
+
+      for( size_t k=j+1UL; k<n_+1UL; ++k ) {
+         ++begin_[k];
+         ++end_[k-1UL];
+      }
+      end_[n_] = newCapacity;
+
+      std::swap( newValues , values_  );
+      std::swap( newIndices, indices_ );
+      deallocate( newValues );
+      deallocate( newIndices );
+   }
+
+   values_ [pos] = value;
+   indices_[pos] = static_cast<IT>( i );
+
+   return Iterator( values_+pos, indices_+pos );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Appending an element to the specified column of the compressed matrix.
+//
+// \param i The row index of the new element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be appended.
+// \param check \a true if the new value should be checked for default values, \a false if not.
+// \return void
+//
+// This function provides a very efficient way to fill a compressed matrix with elements. It
+// appends a new element to the end of the specified column without any additional memory
+// allocation. Therefore it is strictly necessary to keep the following preconditions in mind:
+//
+//  - the index of the new element must be strictly larger than the largest index of non-zero
+//    elements in the specified column of the compressed matrix
+//  - the current number of non-zero elements in the matrix must be smaller than the capacity
+//    of the matrix
+//
+// Ignoring these preconditions might result in undefined behavior! The optional \a check
+// parameter specifies whether the new value should be tested for a default value. If the new
+// value is a default value (for instance 0 in case of an integral element type) the value is
+// not appended. Per default the values are not tested.
+//
+// \note Although append() does not allocate new memory, it still invalidates all iterators
+// returned by the end() functions!
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline void CompressedSoAMatrix<Type,true,IT>::append( size_t i, size_t j, const Type& value, bool check )
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < n_, "Invalid column access index" );
+   BLAZE_USER_ASSERT( end_[j] < end_[n_], "Not enough reserved capacity left" );
+   BLAZE_USER_ASSERT( begin_[j] == end_[j] || i > indices_[end_[j]-1UL], "Index is not strictly increasing" );
+
+   values_[end_[j]] = value;
+
+   if( !check || !isDefault<strict>( values_[end_[j]] ) ) {
+      indices_[end_[j]] = static_cast<IT>( i );
+      ++end_[j];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Finalizing the element insertion of a column.
+//
+// \param j The index of the column to be finalized \f$[0..N-1]\f$.
+// \return void
+//
+// This function is part of the low-level interface to efficiently fill a matrix with elements.
+// After completion of column \a j via the append() function, this function can be called to
+// finalize column \a j and prepare the next column for insertion process via append().
+//
+// \note Although finalize() does not allocate new memory, it still invalidates all iterators
+// returned by the end() functions!
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline void CompressedSoAMatrix<Type,true,IT>::finalize( size_t j )
+{
+   BLAZE_USER_ASSERT( j < n_, "Invalid column access index" );
+
+   begin_[j+1UL] = end_[j];
+   if( j != n_-1UL )
+      end_[j+1UL] = end_[j];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ERASE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Erasing an element from the compressed matrix.
+//
+// \param i The row index of the element to be erased. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the element to be erased. The index has to be in the range \f$[0..N-1]\f$.
+// \return void
+//
+// This function erases an element from the compressed matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline void CompressedSoAMatrix<Type,true,IT>::erase( size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const Iterator pos( find( i, j ) );
+   if( pos != end( j ) ) {
+      const size_t k( offset( pos ) );
+      moveElements( k+1UL, end_[j], k );
+      --end_[j];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Erasing an element from the compressed matrix.
+//
+// \param j The column index of the element to be erased. The index has to be in the range \f$[0..N-1]\f$.
+// \param pos Iterator to the element to be erased.
+// \return Iterator to the element after the erased element.
+//
+// This function erases an element from the compressed matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline typename CompressedSoAMatrix<Type,true,IT>::Iterator
+   CompressedSoAMatrix<Type,true,IT>::erase( size_t j, Iterator pos )
+{
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+   BLAZE_USER_ASSERT( pos >= begin( j ) && pos <= end( j ), "Invalid compressed matrix iterator" );
+
+   if( pos != end( j ) ) {
+      const size_t k( offset( pos ) );
+      moveElements( k+1UL, end_[j], k );
+      --end_[j];
+   }
+
+   return pos;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Erasing a range of elements from the compressed matrix.
+//
+// \param j The column index of the element to be erased. The index has to be in the range \f$[0..N-1]\f$.
+// \param first Iterator to first element to be erased.
+// \param last Iterator just past the last element to be erased.
+// \return Iterator to the element after the erased element.
+//
+// This function erases a range of elements from the compressed matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline typename CompressedSoAMatrix<Type,true,IT>::Iterator
+   CompressedSoAMatrix<Type,true,IT>::erase( size_t j, Iterator first, Iterator last )
+{
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+   BLAZE_USER_ASSERT( first <= last, "Invalid iterator range" );
+   BLAZE_USER_ASSERT( first >= begin( j ) && first <= end( j ), "Invalid compressed matrix iterator" );
+   BLAZE_USER_ASSERT( last  >= begin( j ) && last  <= end( j ), "Invalid compressed matrix iterator" );
+
+   if( first != last ) {
+      const size_t f( offset( first ) );
+      const size_t l( offset( last  ) );
+      moveElements( l, end_[j], f );
+      end_[j] -= l - f;
+   }
+
+   return first;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Erasing specific elements from the compressed matrix.
+//
+// \param predicate The unary predicate for the element selection.
+// \return void.
+//
+// This function erases specific elements from the compressed matrix. The elements are selected
+// by the given unary predicate \a predicate, which is expected to accept a single argument of
+// the type of the elements and to be pure.
+*/
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Type of the stored indices
+template< typename Pred >  // Type of the unary predicate
+inline void CompressedSoAMatrix<Type,true,IT>::erase( Pred predicate )
+{
+   for( size_t j=0UL; j<n_; ++j ) {
+      erase( j, begin( j ), end( j ), predicate );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Erasing specific elements from a range of the compressed matrix.
+//
+// \param j The column index of the elements to be erased. The index has to be in the range \f$[0..N-1]\f$.
+// \param first Iterator to first element of the range.
+// \param last Iterator just past the last element of the range.
+// \param predicate The unary predicate for the element selection.
+// \return void
+//
+// This function erases specific elements from a range of elements of the compressed matrix.
+// The elements are selected by the given unary predicate \a predicate, which is expected to
+// accept a single argument of the type of the elements and to be pure.
+*/
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Type of the stored indices
+template< typename Pred >  // Type of the unary predicate
+inline void CompressedSoAMatrix<Type,true,IT>::erase( size_t j, Iterator first, Iterator last, Pred predicate )
+{
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+   BLAZE_USER_ASSERT( first <= last, "Invalid iterator range" );
+   BLAZE_USER_ASSERT( first >= begin( j ) && first <= end( j ), "Invalid compressed matrix iterator" );
+   BLAZE_USER_ASSERT( last  >= begin( j ) && last  <= end( j ), "Invalid compressed matrix iterator" );
+
+   const size_t l( offset( last ) );
+   size_t pos( offset( first ) );
+
+   for( size_t k=pos; k<l; ++k ) {
+      if( !predicate( values_[k] ) ) {
+         if( pos != k ) {
+            values_ [pos] = std::move( values_[k] );
+            indices_[pos] = indices_[k];
+         }
+         ++pos;
+      }
+   }
+
+   moveElements( l, end_[j], pos );
+   end_[j] -= l - pos;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+//
+// This function can be used to check whether a specific element is contained in the compressed
+// matrix. It specifically searches for the element with column index \a j and row index \a i.
+// In case the element is found, the function returns an iterator to the element. Otherwise an
+// iterator just past the last non-zero element of column \a j (the end() iterator) is returned.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline typename CompressedSoAMatrix<Type,true,IT>::Iterator
+   CompressedSoAMatrix<Type,true,IT>::find( size_t i, size_t j )
+{
+   const size_t k( offset( const_cast<const This&>( *this ).find( i, j ) ) );
+   return Iterator( values_+k, indices_+k );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+//
+// This function can be used to check whether a specific element is contained in the compressed
+// matrix. It specifically searches for the element with column index \a j and row index \a i.
+// In case the element is found, the function returns an iterator to the element. Otherwise an
+// iterator just past the last non-zero element of column \a j (the end() iterator) is returned.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline typename CompressedSoAMatrix<Type,true,IT>::ConstIterator
+   CompressedSoAMatrix<Type,true,IT>::find( size_t i, size_t j ) const
+{
+   const ConstIterator pos( lowerBound( i, j ) );
+   if( pos != end( j ) && pos->index() == i )
+      return pos;
+   else return end( j );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator to the first index not less than the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less than the given index, end() iterator otherwise.
+//
+// In case of a column-major matrix, this function returns a column iterator to the first element with
+// an index not less than the given row index. The binary search is performed directly on the
+// contiguous array of row indices.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline typename CompressedSoAMatrix<Type,true,IT>::Iterator
+   CompressedSoAMatrix<Type,true,IT>::lowerBound( size_t i, size_t j )
+{
+   const size_t k( offset( const_cast<const This&>( *this ).lowerBound( i, j ) ) );
+   return Iterator( values_+k, indices_+k );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator to the first index not less than the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less than the given index, end() iterator otherwise.
+//
+// In case of a column-major matrix, this function returns a column iterator to the first element with
+// an index not less than the given row index. The binary search is performed directly on the
+// contiguous array of row indices.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline typename CompressedSoAMatrix<Type,true,IT>::ConstIterator
+   CompressedSoAMatrix<Type,true,IT>::lowerBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const IT* const pos( std::lower_bound( indices_+begin_[j], indices_+end_[j], i,
+                                          []( const IT& index, size_t value )
+                                          {
+                                             return static_cast<size_t>( index ) < value;
+                                          } ) );
+
+   return ConstIterator( values_+( pos - indices_ ), pos );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator to the first index greater than the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater than the given index, end() iterator otherwise.
+//
+// In case of a column-major matrix, this function returns a column iterator to the first element with
+// an index greater than the given row index. The binary search is performed directly on the
+// contiguous array of row indices.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline typename CompressedSoAMatrix<Type,true,IT>::Iterator
+   CompressedSoAMatrix<Type,true,IT>::upperBound( size_t i, size_t j )
+{
+   const size_t k( offset( const_cast<const This&>( *this ).upperBound( i, j ) ) );
+   return Iterator( values_+k, indices_+k );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator to the first index greater than the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater than the given index, end() iterator otherwise.
+//
+// In case of a column-major matrix, this function returns a column iterator to the first element with
+// an index greater than the given row index. The binary search is performed directly on the
+// contiguous array of row indices.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline typename CompressedSoAMatrix<Type,true,IT>::ConstIterator
+   CompressedSoAMatrix<Type,true,IT>::upperBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const IT* const pos( std::upper_bound( indices_+begin_[j], indices_+end_[j], i,
+                                          []( size_t value, const IT& index )
+                                          {
+                                             return value < static_cast<size_t>( index );
+                                          } ) );
+
+   return ConstIterator( values_+( pos - indices_ ), pos );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NUMERIC FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place transpose of the matrix.
+//
+// \return Reference to the transposed matrix.
+// \exception std::invalid_argument Number of rows exceeds the range of the index type.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline CompressedSoAMatrix<Type,true,IT>& CompressedSoAMatrix<Type,true,IT>::transpose()
+{
+   CompressedSoAMatrix tmp( trans( *this ) );
+   swap( tmp );
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place conjugate transpose of the matrix.
+//
+// \return Reference to the transposed matrix.
+// \exception std::invalid_argument Number of rows exceeds the range of the index type.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline CompressedSoAMatrix<Type,true,IT>& CompressedSoAMatrix<Type,true,IT>::ctranspose()
+{
+   CompressedSoAMatrix tmp( ctrans( *this ) );
+   swap( tmp );
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scaling of the compressed matrix by the scalar value \a scalar (\f$ A=B*s \f$).
+//
+// \param scalar The scalar value for the matrix scaling.
+// \return Reference to the compressed matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , typename IT >     // Type of the stored indices
+template< typename Other >  // Data type of the scalar value
+inline CompressedSoAMatrix<Type,true,IT>& CompressedSoAMatrix<Type,true,IT>::scale( const Other& scalar )
+{
+   for( size_t j=0UL; j<n_; ++j )
+      for( size_t k=begin_[j]; k<end_[j]; ++k )
+         values_[k] *= scalar;
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+*/
+template< typename Type     // Data type of the matrix
+        , typename IT >     // Type of the stored indices
+template< typename Other >  // Data type of the foreign expression
+inline bool CompressedSoAMatrix<Type,true,IT>::canAlias( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+*/
+template< typename Type     // Data type of the matrix
+        , typename IT >     // Type of the stored indices
+template< typename Other >  // Data type of the foreign expression
+inline bool CompressedSoAMatrix<Type,true,IT>::isAliased( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline bool CompressedSoAMatrix<Type,true,IT>::canSMPAssign() const noexcept
+{
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline void CompressedSoAMatrix<Type,true,IT>::assign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   if( m_ == 0UL || n_ == 0UL )
+      return;
+
+   size_t nonzeros( 0UL );
+
+   for( size_t j=1UL; j<=n_; ++j )
+      begin_[j] = end_[j] = end_[n_];
+
+   for( size_t j=0UL; j<n_; ++j )
+   {
+      begin_[j] = end_[j] = nonzeros;
+
+      const size_t ibegin( ( IsLower_v<MT> )
+                           ?( IsStrictlyLower_v<MT> ? j+1UL : j )
+                           :( 0UL ) );
+      const size_t iend  ( ( IsUpper_v<MT> )
+                           ?( IsStrictlyUpper_v<MT> ? j : j+1UL )
+                           :( m_ ) );
+
+      for( size_t i=ibegin; i<iend; ++i )
+      {
+         if( nonzeros == capacity() ) {
+            reserveElements( extendCapacity() );
+            for( size_t k=j+1UL; k<=n_; ++k )
+               begin_[k] = end_[k] = end_[n_];
+         }
+
+         values_[end_[j]] = (~rhs)(i,j);
+
+         if( !isDefault<strict>( values_[end_[j]] ) ) {
+            indices_[end_[j]] = static_cast<IT>( i );
+            ++end_[j];
+            ++nonzeros;
+         }
+      }
+   }
+
+   begin_[n_] = nonzeros;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the assignment of a column-major sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+template< typename MT >  // Type of the right-hand side sparse matrix
+inline void CompressedSoAMatrix<Type,true,IT>::assign( const SparseMatrix<MT,true>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( nonZeros() == 0UL, "Invalid non-zero elements detected" );
+   BLAZE_INTERNAL_ASSERT( capacity() >= (~rhs).nonZeros(), "Invalid capacity detected" );
+
+   if( n_ == 0UL || values_ == nullptr )
+      return;
+
+   for( size_t j=0UL; j<n_; ++j ) {
+      size_t k( begin_[j] );
+      for( auto element=(~rhs).begin(j); element!=(~rhs).end(j); ++element, ++k ) {
+         values_ [k] = element->value();
+         indices_[k] = static_cast<IT>( element->index() );
+      }
+      end_[j] = k;
+      begin_[j+1UL] = end_[j];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the assignment of a row-major sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+template< typename MT >  // Type of the right-hand side sparse matrix
+inline void CompressedSoAMatrix<Type,true,IT>::assign( const SparseMatrix<MT,false>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( nonZeros() == 0UL, "Invalid non-zero elements detected" );
+   BLAZE_INTERNAL_ASSERT( capacity() >= (~rhs).nonZeros(), "Invalid capacity detected" );
+
+   // Counting the number of elements per column
+   std::vector<size_t> columnLengths( n_, 0UL );
+   for( size_t i=0UL; i<m_; ++i ) {
+      for( auto element=(~rhs).begin(i); element!=(~rhs).end(i); ++element )
+         ++columnLengths[element->index()];
+   }
+
+   // Resizing the compressed matrix
+   for( size_t j=0UL; j<n_; ++j ) {
+      end_[j] = begin_[j];
+      begin_[j+1UL] = begin_[j] + columnLengths[j];
+   }
+
+   // Appending the elements to the columns of the compressed matrix
+   for( size_t i=0UL; i<m_; ++i ) {
+      for( auto element=(~rhs).begin(i); element!=(~rhs).end(i); ++element )
+         append( i, element->index(), element->value() );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the addition assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline void CompressedSoAMatrix<Type,true,IT>::addAssign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   CompressedSoAMatrix tmp( serial( *this + (~rhs) ) );
+   swap( tmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the addition assignment of a sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+template< typename MT    // Type of the right-hand side sparse matrix
+        , bool SO2 >     // Storage order of the right-hand side sparse matrix
+inline void CompressedSoAMatrix<Type,true,IT>::addAssign( const SparseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   CompressedSoAMatrix tmp( serial( *this + (~rhs) ) );
+   swap( tmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the subtraction assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline void CompressedSoAMatrix<Type,true,IT>::subAssign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   CompressedSoAMatrix tmp( serial( *this - (~rhs) ) );
+   swap( tmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the subtraction assignment of a sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+template< typename MT    // Type of the right-hand side sparse matrix
+        , bool SO2 >     // Storage order of the right-hand side sparse matrix
+inline void CompressedSoAMatrix<Type,true,IT>::subAssign( const SparseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   CompressedSoAMatrix tmp( serial( *this - (~rhs) ) );
+   swap( tmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the Schur product assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix for the Schur product.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline void CompressedSoAMatrix<Type,true,IT>::schurAssign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( MT );
+
+   for( size_t j=0UL; j<n_; ++j ) {
+      for( size_t k=begin_[j]; k<end_[j]; ++k )
+         values_[k] *= (~rhs)(indices_[k],j);
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+
+//=================================================================================================
+//
+//  COMPRESSEDSOAMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name CompressedSoAMatrix operators */
+//@{
+template< typename Type, bool SO, typename IT >
+void reset( CompressedSoAMatrix<Type,SO,IT>& m );
+
+template< typename Type, bool SO, typename IT >
+void reset( CompressedSoAMatrix<Type,SO,IT>& m, size_t i );
+
+template< typename Type, bool SO, typename IT >
+void clear( CompressedSoAMatrix<Type,SO,IT>& m );
+
+template< RelaxationFlag RF, typename Type, bool SO, typename IT >
+bool isDefault( const CompressedSoAMatrix<Type,SO,IT>& m );
+
+template< typename Type, bool SO, typename IT >
+bool isIntact( const CompressedSoAMatrix<Type,SO,IT>& m );
+
+template< typename Type, bool SO, typename IT >
+void swap( CompressedSoAMatrix<Type,SO,IT>& a, CompressedSoAMatrix<Type,SO,IT>& b ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given compressed matrix.
+// \ingroup compressed_soa_matrix
+//
+// \param m The matrix to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline void reset( CompressedSoAMatrix<Type,SO,IT>& m )
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row/column of the given compressed matrix.
+// \ingroup compressed_soa_matrix
+//
+// \param m The matrix to be resetted.
+// \param i The index of the row/column to be resetted.
+// \return void
+//
+// This function resets the values in the specified row/column of the given compressed matrix to
+// their default value. In case the given matrix is a \a rowMajor matrix the function resets the
+// values in row \a i, if it is a \a columnMajor matrix the function resets the values in column
+// \a i. Note that the capacity of the row/column remains unchanged.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline void reset( CompressedSoAMatrix<Type,SO,IT>& m, size_t i )
+{
+   m.reset( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given compressed matrix.
+// \ingroup compressed_soa_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline void clear( CompressedSoAMatrix<Type,SO,IT>& m )
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given compressed matrix is in default state.
+// \ingroup compressed_soa_matrix
+//
+// \param m The matrix to be tested for its default state.
+// \return \a true in case the given matrix's rows and columns are zero, \a false otherwise.
+//
+// This function checks whether the compressed matrix is in default (constructed) state, i.e. if
+// it's number of rows and columns is 0. In case it is in default state, the function returns
+// \a true, else it will return \a false. The following example demonstrates the use of the
+// \a isDefault() function:
+
+   \code
+   blaze::CompressedSoAMatrix<int> A;
+   // ... Resizing and initialization
+   if( isDefault( A ) ) { ... }
+   \endcode
+
+// Optionally, it is possible to switch between strict semantics (blaze::strict) and relaxed
+// semantics (blaze::relaxed):
+
+   \code
+   if( isDefault<relaxed>( A ) ) { ... }
+   \endcode
+*/
+template< RelaxationFlag RF  // Relaxation flag
+        , typename Type      // Data type of the matrix
+        , bool SO            // Storage order
+        , typename IT >      // Type of the stored indices
+inline bool isDefault( const CompressedSoAMatrix<Type,SO,IT>& m )
+{
+   return ( m.rows() == 0UL && m.columns() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the given compressed matrix are intact.
+// \ingroup compressed_soa_matrix
+//
+// \param m The compressed matrix to be tested.
+// \return \a true in case the given matrix's invariants are intact, \a false otherwise.
+//
+// This function checks whether the invariants of the compressed matrix are intact, i.e. if
+// its state is valid. In case the invariants are intact, the function returns \a true, else
+// it will return \a false. The following example demonstrates the use of the \a isIntact()
+// function:
+
+   \code
+   blaze::CompressedSoAMatrix<int> A;
+   // ... Resizing and initialization
+   if( isIntact( A ) ) { ... }
+   \endcode
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline bool isIntact( const CompressedSoAMatrix<Type,SO,IT>& m )
+{
+   return ( m.nonZeros() <= m.capacity() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two compressed matrices.
+// \ingroup compressed_soa_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline void swap( CompressedSoAMatrix<Type,SO,IT>& a, CompressedSoAMatrix<Type,SO,IT>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISRESIZABLE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO, typename IT >
+struct IsResizable< CompressedSoAMatrix<T,SO,IT> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISSHRINKABLE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO, typename IT >
+struct IsShrinkable< CompressedSoAMatrix<T,SO,IT> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
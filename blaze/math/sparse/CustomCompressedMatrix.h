@@ -0,0 +1,816 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/CustomCompressedMatrix.h
+//  \brief Header file for the implementation of a read-only view on compressed sparse arrays
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_CUSTOMCOMPRESSEDMATRIX_H_
+#define _BLAZE_MATH_SPARSE_CUSTOMCOMPRESSEDMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/sparse/Forward.h>
+#include <blaze/math/sparse/SoAIterator.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Integral.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Unsigned.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup custom_compressed_matrix CustomCompressedMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Read-only sparse matrix view on externally allocated compressed arrays.
+// \ingroup custom_compressed_matrix
+//
+// The CustomCompressedMatrix class template represents a read-only sparse matrix on top of
+// three externally allocated arrays in the compressed row (CSR) or compressed column (CSC)
+// format: an array of \f$ K+1 \f$ offsets (where \f$ K \f$ is the number of rows of a
+// row-major matrix or the number of columns of a column-major matrix), an array of indices,
+// and an array of values. The non-zero elements of row/column \a k are stored at the positions
+// \f$ [offsets[k]..offsets[k+1]) \f$ of the index and value arrays. The indices within each
+// row/column have to be strictly increasing. The type of the elements, the storage order, and
+// the type of the stored indices can be specified via the three template parameters:
+
+   \code
+   template< typename Type, bool SO, typename IT >
+   class CustomCompressedMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. CustomCompressedMatrix can be used with
+//          any non-cv-qualified, non-reference, non-pointer element type.
+//  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//          The default value is blaze::rowMajor.
+//  - IT  : specifies the unsigned integral type of the stored indices. The default type is
+//          \c size_t.
+//
+// In contrast to CompressedMatrix, a CustomCompressedMatrix does not own its elements, does not
+// copy them, and cannot be modified. It is primarily used to provide zero-copy access to sparse
+// matrices in memory mapped files (see the MatrixMapping class), but can be used with any
+// existing CSR/CSC arrays:
+
+   \code
+   using blaze::CustomCompressedMatrix;
+   using blaze::rowMajor;
+
+   const size_t offsets[] = { 0, 2, 2, 3 };
+   const size_t indices[] = { 0, 2, 1 };
+   const double values [] = { 1.0, 2.0, 3.0 };
+
+   // Creating a read-only 3x3 view on the given CSR arrays
+   CustomCompressedMatrix<double,rowMajor> A( 3UL, 3UL, offsets, indices, values );
+
+   blaze::DynamicVector<double> x( 3UL, 1.0 ), y;
+   y = A * x;
+   \endcode
+
+// Since the arrays are neither copied nor released, they have to outlive the view.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+class CustomCompressedMatrix
+   : public SparseMatrix< CustomCompressedMatrix<Type,SO,IT>, SO >
+{
+ public:
+   //**Type definitions****************************************************************************
+   using This           = CustomCompressedMatrix<Type,SO,IT>;  //!< Type of this CustomCompressedMatrix instance.
+   using BaseType       = SparseMatrix<This,SO>;               //!< Base type of this CustomCompressedMatrix instance.
+   using ResultType     = CompressedMatrix<Type,SO>;           //!< Result type for expression template evaluations.
+   using OppositeType   = CompressedMatrix<Type,!SO>;          //!< Result type with opposite storage order for expression template evaluations.
+   using TransposeType  = CompressedMatrix<Type,!SO>;          //!< Transpose type for expression template evaluations.
+   using ElementType    = Type;                                //!< Type of the matrix elements.
+   using IndexType      = IT;                                  //!< Type of the stored indices.
+   using ReturnType     = const Type&;                         //!< Return type for expression template evaluations.
+   using CompositeType  = const This&;                         //!< Data type for composite expression templates.
+   using Reference      = const Type&;                         //!< Reference to a matrix value.
+   using ConstReference = const Type&;                         //!< Reference to a constant matrix value.
+   using Iterator       = SoAIterator<const Type,IT>;          //!< Iterator over the elements.
+   using ConstIterator  = SoAIterator<const Type,IT>;          //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a compressed matrix with different data/element type.
+   */
+   template< typename NewType >  // Data type of the other matrix
+   struct Rebind {
+      using Other = CompressedMatrix<NewType,SO>;  //!< The type of the other compressed matrix.
+   };
+   //**********************************************************************************************
+
+   //**Resize struct definition********************************************************************
+   /*!\brief Resize mechanism to obtain a compressed matrix with different fixed dimensions.
+   */
+   template< size_t NewM    // Number of rows of the other matrix
+           , size_t NewN >  // Number of columns of the other matrix
+   struct Resize {
+      using Other = CompressedMatrix<Type,SO>;  //!< The type of the other compressed matrix.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   static constexpr bool smpAssignable = false;
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline CustomCompressedMatrix() noexcept;
+   inline CustomCompressedMatrix( size_t m, size_t n, const size_t* offsets,
+                                  const IT* indices, const Type* values );
+
+   CustomCompressedMatrix( const CustomCompressedMatrix& ) = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   CustomCompressedMatrix& operator=( const CustomCompressedMatrix& ) = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline ConstReference operator()( size_t i, size_t j ) const noexcept;
+   inline ConstReference at( size_t i, size_t j ) const;
+   inline ConstIterator  begin ( size_t k ) const noexcept;
+   inline ConstIterator  cbegin( size_t k ) const noexcept;
+   inline ConstIterator  end   ( size_t k ) const noexcept;
+   inline ConstIterator  cend  ( size_t k ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const noexcept;
+   inline size_t columns() const noexcept;
+   inline size_t capacity() const noexcept;
+   inline size_t capacity( size_t k ) const noexcept;
+   inline size_t nonZeros() const noexcept;
+   inline size_t nonZeros( size_t k ) const noexcept;
+   inline void   swap( CustomCompressedMatrix& sm ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline ConstIterator find      ( size_t i, size_t j ) const;
+   inline ConstIterator lowerBound( size_t i, size_t j ) const;
+   inline ConstIterator upperBound( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   inline bool canSMPAssign() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t        m_;        //!< The number of rows of the matrix.
+   size_t        n_;        //!< The number of columns of the matrix.
+   const size_t* offsets_;  //!< The offsets of the first non-zero element of each row/column.
+   const IT*     indices_;  //!< The indices of the non-zero elements.
+   const Type*   values_;   //!< The values of the non-zero elements.
+
+   static const size_t empty_;  //!< Offset array of an empty matrix.
+   static const Type   zero_;   //!< Neutral element for accesses to zero elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_CONSTRAINT_MUST_BE_INTEGRAL_TYPE     ( IT );
+   BLAZE_CONSTRAINT_MUST_BE_UNSIGNED_TYPE     ( IT );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+template< typename Type, bool SO, typename IT >
+const size_t CustomCompressedMatrix<Type,SO,IT>::empty_ = 0UL;
+
+template< typename Type, bool SO, typename IT >
+const Type CustomCompressedMatrix<Type,SO,IT>::zero_{};
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for CustomCompressedMatrix.
+//
+// The default constructor creates an empty \f$ 0 \times 0 \f$ matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline CustomCompressedMatrix<Type,SO,IT>::CustomCompressedMatrix() noexcept
+   : m_      ( 0UL )      // The number of rows of the matrix
+   , n_      ( 0UL )      // The number of columns of the matrix
+   , offsets_( &empty_ )  // The offsets of the first non-zero element of each row/column
+   , indices_( nullptr )  // The indices of the non-zero elements
+   , values_ ( nullptr )  // The values of the non-zero elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a read-only \f$ M \times N \f$ view on the given compressed arrays.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param offsets The array of \f$ M+1 \f$ (row-major) or \f$ N+1 \f$ (column-major) offsets.
+// \param indices The array of column (row-major) or row (column-major) indices.
+// \param values The array of values of the non-zero elements.
+// \exception std::invalid_argument Invalid setup of custom compressed matrix.
+//
+// This constructor creates a read-only view on the given compressed arrays. The construction
+// fails if the given array of offsets is \c nullptr, if the first offset is not 0, or if the
+// index or value array is \c nullptr although the matrix contains non-zero elements. In all
+// failure cases a \a std::invalid_argument exception is thrown. Note that for performance
+// reasons the structure of the arrays (i.e. monotonically increasing offsets and strictly
+// increasing indices within each row/column) is only checked in case BLAZE_USER_ASSERT()
+// is active.
+//
+// \note The custom compressed matrix does \b NOT take responsibility for the given arrays!
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline CustomCompressedMatrix<Type,SO,IT>::CustomCompressedMatrix( size_t m, size_t n, const size_t* offsets,
+                                                           const IT* indices, const Type* values )
+   : m_      ( m )        // The number of rows of the matrix
+   , n_      ( n )        // The number of columns of the matrix
+   , offsets_( offsets )  // The offsets of the first non-zero element of each row/column
+   , indices_( indices )  // The indices of the non-zero elements
+   , values_ ( values )   // The values of the non-zero elements
+{
+   if( offsets == nullptr ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid array of offsets" );
+   }
+
+   if( offsets[0] != 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid first offset" );
+   }
+
+   if( nonZeros() > 0UL && ( indices == nullptr || values == nullptr ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid array of non-zero elements" );
+   }
+
+#if BLAZE_USER_ASSERTION
+   for( size_t k=0UL; k<( SO ? n_ : m_ ); ++k ) {
+      BLAZE_USER_ASSERT( offsets_[k] <= offsets_[k+1UL], "Invalid offsets detected" );
+      for( size_t l=offsets_[k]; l<offsets_[k+1UL]; ++l ) {
+         BLAZE_USER_ASSERT( indices_[l] < ( SO ? m_ : n_ ), "Invalid index detected" );
+         BLAZE_USER_ASSERT( l == offsets_[k] || indices_[l-1UL] < indices_[l], "Invalid index order detected" );
+      }
+   }
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline typename CustomCompressedMatrix<Type,SO,IT>::ConstReference
+   CustomCompressedMatrix<Type,SO,IT>::operator()( size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const ConstIterator pos( find( i, j ) );
+
+   if( pos == end( SO ? j : i ) )
+      return zero_;
+   else
+      return pos->value();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// In contrast to the function call operator this function always performs a check of the given
+// access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline typename CustomCompressedMatrix<Type,SO,IT>::ConstReference
+   CustomCompressedMatrix<Type,SO,IT>::at( size_t i, size_t j ) const
+{
+   if( i >= m_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a k.
+//
+// \param k The row index (in case of a row-major matrix) or column index (in case of a
+//           column-major matrix).
+// \return Iterator to the first non-zero element of row/column \a k.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline typename CustomCompressedMatrix<Type,SO,IT>::ConstIterator
+   CustomCompressedMatrix<Type,SO,IT>::begin( size_t k ) const noexcept
+{
+   BLAZE_USER_ASSERT( k < ( SO ? n_ : m_ ), "Invalid compressed matrix row/column access index" );
+   return ConstIterator( values_+offsets_[k], indices_+offsets_[k] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a k.
+//
+// \param k The row index (in case of a row-major matrix) or column index (in case of a
+//           column-major matrix).
+// \return Iterator to the first non-zero element of row/column \a k.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline typename CustomCompressedMatrix<Type,SO,IT>::ConstIterator
+   CustomCompressedMatrix<Type,SO,IT>::cbegin( size_t k ) const noexcept
+{
+   return begin( k );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a k.
+//
+// \param k The row index (in case of a row-major matrix) or column index (in case of a
+//           column-major matrix).
+// \return Iterator just past the last non-zero element of row/column \a k.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline typename CustomCompressedMatrix<Type,SO,IT>::ConstIterator
+   CustomCompressedMatrix<Type,SO,IT>::end( size_t k ) const noexcept
+{
+   BLAZE_USER_ASSERT( k < ( SO ? n_ : m_ ), "Invalid compressed matrix row/column access index" );
+   return ConstIterator( values_+offsets_[k+1UL], indices_+offsets_[k+1UL] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a k.
+//
+// \param k The row index (in case of a row-major matrix) or column index (in case of a
+//           column-major matrix).
+// \return Iterator just past the last non-zero element of row/column \a k.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline typename CustomCompressedMatrix<Type,SO,IT>::ConstIterator
+   CustomCompressedMatrix<Type,SO,IT>::cend( size_t k ) const noexcept
+{
+   return end( k );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the matrix.
+//
+// \return The number of rows of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline size_t CustomCompressedMatrix<Type,SO,IT>::rows() const noexcept
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the matrix.
+//
+// \return The number of columns of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline size_t CustomCompressedMatrix<Type,SO,IT>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the matrix.
+//
+// \return The capacity of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline size_t CustomCompressedMatrix<Type,SO,IT>::capacity() const noexcept
+{
+   return nonZeros();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current capacity of the specified row/column.
+//
+// \param k The index of the row/column.
+// \return The current capacity of row/column \a k.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline size_t CustomCompressedMatrix<Type,SO,IT>::capacity( size_t k ) const noexcept
+{
+   return nonZeros( k );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the matrix.
+//
+// \return The number of non-zero elements in the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline size_t CustomCompressedMatrix<Type,SO,IT>::nonZeros() const noexcept
+{
+   return offsets_[ SO ? n_ : m_ ];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row/column.
+//
+// \param k The index of the row/column.
+// \return The number of non-zero elements of row/column \a k.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline size_t CustomCompressedMatrix<Type,SO,IT>::nonZeros( size_t k ) const noexcept
+{
+   BLAZE_USER_ASSERT( k < ( SO ? n_ : m_ ), "Invalid row/column access index" );
+   return offsets_[k+1UL] - offsets_[k];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two custom compressed matrices.
+//
+// \param sm The matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline void CustomCompressedMatrix<Type,SO,IT>::swap( CustomCompressedMatrix& sm ) noexcept
+{
+   std::swap( m_, sm.m_ );
+   std::swap( n_, sm.n_ );
+   std::swap( offsets_, sm.offsets_ );
+   std::swap( indices_, sm.indices_ );
+   std::swap( values_, sm.values_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+//
+// This function can be used to check whether a specific element is contained in the matrix.
+// In case the element is found, the function returns an iterator to the element. Otherwise an
+// iterator just past the last non-zero element of row \a i (row-major) or column \a j
+// (column-major) is returned.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline typename CustomCompressedMatrix<Type,SO,IT>::ConstIterator
+   CustomCompressedMatrix<Type,SO,IT>::find( size_t i, size_t j ) const
+{
+   const ConstIterator pos( lowerBound( i, j ) );
+   if( pos != end( SO ? j : i ) && pos->index() == ( SO ? i : j ) )
+      return pos;
+   else return end( SO ? j : i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less than the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less than the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index not less than the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index not less than the given row
+// index. The binary search is performed directly on the contiguous array of indices.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline typename CustomCompressedMatrix<Type,SO,IT>::ConstIterator
+   CustomCompressedMatrix<Type,SO,IT>::lowerBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const size_t k    ( SO ? j : i );
+   const size_t index( SO ? i : j );
+
+   const IT* const pos( std::lower_bound( indices_+offsets_[k], indices_+offsets_[k+1UL], index,
+                                          []( const IT& idx, size_t value )
+                                          {
+                                             return static_cast<size_t>( idx ) < value;
+                                          } ) );
+
+   return ConstIterator( values_+( pos - indices_ ), pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater than the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater than the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index greater than the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index greater than the given row
+// index. The binary search is performed directly on the contiguous array of indices.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline typename CustomCompressedMatrix<Type,SO,IT>::ConstIterator
+   CustomCompressedMatrix<Type,SO,IT>::upperBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const size_t k    ( SO ? j : i );
+   const size_t index( SO ? i : j );
+
+   const IT* const pos( std::upper_bound( indices_+offsets_[k], indices_+offsets_[k+1UL], index,
+                                          []( size_t value, const IT& idx )
+                                          {
+                                             return value < static_cast<size_t>( idx );
+                                          } ) );
+
+   return ConstIterator( values_+( pos - indices_ ), pos );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename IT >     // Type of the stored indices
+template< typename Other >  // Data type of the foreign expression
+inline bool CustomCompressedMatrix<Type,SO,IT>::canAlias( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename IT >     // Type of the stored indices
+template< typename Other >  // Data type of the foreign expression
+inline bool CustomCompressedMatrix<Type,SO,IT>::isAliased( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline bool CustomCompressedMatrix<Type,SO,IT>::canSMPAssign() const noexcept
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CUSTOMCOMPRESSEDMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name CustomCompressedMatrix operators */
+//@{
+template< typename Type, bool SO, typename IT >
+void swap( CustomCompressedMatrix<Type,SO,IT>& a, CustomCompressedMatrix<Type,SO,IT>& b ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two custom compressed matrices.
+// \ingroup custom_compressed_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the stored indices
+inline void swap( CustomCompressedMatrix<Type,SO,IT>& a, CustomCompressedMatrix<Type,SO,IT>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -42,6 +42,7 @@
 
 #include <blaze/system/StorageOrder.h>
 #include <blaze/system/TransposeFlag.h>
+#include <blaze/util/Types.h>
 
 
 namespace blaze {
@@ -60,6 +61,25 @@ template< typename Type                    // Data type of the matrix
         , bool SO = defaultStorageOrder >  // Storage order
 class CompressedMatrix;
 
+template< typename Type                     // Data type of the matrix
+        , bool SO = defaultStorageOrder     // Storage order
+        , typename IT = size_t >            // Type of the stored indices
+class CompressedSoAMatrix;
+
+template< typename Type                     // Data type of the matrix
+        , bool SO = defaultStorageOrder     // Storage order
+        , typename IT = size_t >            // Type of the stored indices
+class CustomCompressedMatrix;
+
+template< typename Type           // Data type of the matrix
+        , size_t B                // Number of rows and columns of the blocks
+        , typename IT = size_t >  // Type of the stored indices
+class BlockCompressedMatrix;
+
+template< typename Type           // Data type of the matrix
+        , typename IT = size_t >  // Type of the stored indices
+class SlicedEllpackMatrix;
+
 template< typename Type                    // Data type of the matrix
         , bool SO = defaultStorageOrder >  // Storage order
 class IdentityMatrix;
@@ -0,0 +1,304 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SlicedEllpackKernels.h
+//  \brief Header file for the sliced ELLPACK matrix multiplication kernels
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_SLICEDELLPACKKERNELS_H_
+#define _BLAZE_MATH_SPARSE_SLICEDELLPACKKERNELS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/shims/PrevMultiple.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/smp/ParallelReduce.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/sparse/Forward.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasSIMDAdd.h>
+#include <blaze/math/typetraits/HasSIMDGather.h>
+#include <blaze/math/typetraits/HasSIMDMult.h>
+#include <blaze/math/typetraits/IsContiguous.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsSame.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the sliced ELLPACK matrix multiplication kernels.
+// \ingroup sliced_ellpack_matrix
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename Type  // Element type of the sliced ELLPACK matrix
+        , typename IT    // Type of the stored indices
+        , typename VT2 > // Type of the right-hand side dense vector
+struct SELLMatDVecMultHelper
+{
+   //**********************************************************************************************
+   //! Compilation switch for the SIMD optimized sliced ELLPACK matrix/dense vector kernel.
+   static constexpr bool value =
+      ( useOptimizedKernels &&
+        IsContiguous_v<VT2> && HasConstDataAccess_v<VT2> &&
+        IsSame_v< ElementType_t<VT1>, Type > && IsSame_v< ElementType_t<VT2>, Type > &&
+        HasSIMDGather_v<Type,IT> &&
+        HasSIMDAdd_v<Type,Type> && HasSIMDMult_v<Type,Type> );
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SLICED ELLPACK MATRIX/DENSE VECTOR MULTIPLICATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default kernel for the multiplication of a sliced ELLPACK matrix and a dense vector
+//        (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup sliced_ellpack_matrix
+//
+// \param y The target dense vector.
+// \param A The left-hand side sliced ELLPACK matrix.
+// \param x The right-hand side dense vector.
+// \param begin The index of the first slice to be processed.
+// \param end The index one past the last slice to be processed.
+// \return void
+//
+// This function implements the default kernel for the multiplication of the slices
+// \f$ [begin..end) \f$ of a sliced ELLPACK matrix and a dense vector. The k-th elements of all
+// rows of a slice are processed together, which allows the compiler to vectorize the inner loop.
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename Type  // Element type of the sliced ELLPACK matrix
+        , typename IT    // Type of the stored indices
+        , typename VT2 > // Type of the right-hand side dense vector
+inline auto sellmatdvecmultKernel( VT1& y, const SlicedEllpackMatrix<Type,IT>& A, const VT2& x,
+                                   size_t begin, size_t end )
+   -> DisableIf_t< SELLMatDVecMultHelper<VT1,Type,IT,VT2>::value >
+{
+   using ET = ElementType_t<VT1>;
+
+   const size_t C( A.sliceHeight() );
+
+   for( size_t s=begin; s<end; ++s )
+   {
+      const size_t rows ( A.sliceRows(s)    );
+      const size_t width( A.sliceWidth(s)   );
+      const Type*  v    ( A.sliceValues(s)  );
+      const IT*    idx  ( A.sliceIndices(s) );
+
+      for( size_t r=0UL; r<rows; ++r )
+      {
+         ET sum{};
+
+         for( size_t k=0UL; k<width; ++k ) {
+            sum += v[k*C+r] * x[idx[k*C+r]];
+         }
+
+         y[A.sliceRow(s,r)] = sum;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized kernel for the multiplication of a sliced ELLPACK matrix and a dense
+//        vector (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup sliced_ellpack_matrix
+//
+// \param y The target dense vector.
+// \param A The left-hand side sliced ELLPACK matrix.
+// \param x The right-hand side dense vector.
+// \param begin The index of the first slice to be processed.
+// \param end The index one past the last slice to be processed.
+// \return void
+//
+// This function implements the SIMD optimized kernel for the multiplication of the slices
+// \f$ [begin..end) \f$ of a sliced ELLPACK matrix and a dense vector. Each SIMD lane handles
+// one row of the slice: the k-th elements of SIMDSIZE consecutive rows are loaded with a single
+// SIMD load, the according elements of \a x are loaded via a SIMD gather. The padding elements
+// of the slices are zero and refer to the column 0, i.e. they do not contribute to the result.
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename Type  // Element type of the sliced ELLPACK matrix
+        , typename IT    // Type of the stored indices
+        , typename VT2 > // Type of the right-hand side dense vector
+inline auto sellmatdvecmultKernel( VT1& y, const SlicedEllpackMatrix<Type,IT>& A, const VT2& x,
+                                   size_t begin, size_t end )
+   -> EnableIf_t< SELLMatDVecMultHelper<VT1,Type,IT,VT2>::value >
+{
+   using SIMDType = SIMDTrait_t<Type>;
+
+   constexpr size_t SIMDSIZE( SIMDType::size );
+
+   const size_t C( A.sliceHeight() );
+   const size_t cpos( prevMultiple( C, SIMDSIZE ) );
+
+   const Type* const xp( x.data() );
+
+   alignas( AlignmentOf_v<Type> ) Type tmp[2UL*SIMDSIZE];
+
+   for( size_t s=begin; s<end; ++s )
+   {
+      const size_t rows ( A.sliceRows(s)    );
+      const size_t width( A.sliceWidth(s)   );
+      const Type*  v    ( A.sliceValues(s)  );
+      const IT*    idx  ( A.sliceIndices(s) );
+
+      size_t r( 0UL );
+
+      for( ; r<rows && (r+SIMDSIZE) < cpos; r+=SIMDSIZE*2UL )
+      {
+         SIMDType xmm1, xmm2;
+
+         for( size_t k=0UL; k<width; ++k ) {
+            const size_t kk( k*C+r );
+            xmm1 += loadu( v+kk          ) * gather( xp, idx+kk          );
+            xmm2 += loadu( v+kk+SIMDSIZE ) * gather( xp, idx+kk+SIMDSIZE );
+         }
+
+         storeu( tmp         , xmm1 );
+         storeu( tmp+SIMDSIZE, xmm2 );
+
+         for( size_t l=0UL; l<2UL*SIMDSIZE && r+l<rows; ++l ) {
+            y[A.sliceRow(s,r+l)] = tmp[l];
+         }
+      }
+
+      for( ; r<rows && r<cpos; r+=SIMDSIZE )
+      {
+         SIMDType xmm1;
+
+         for( size_t k=0UL; k<width; ++k ) {
+            xmm1 += loadu( v+k*C+r ) * gather( xp, idx+k*C+r );
+         }
+
+         storeu( tmp, xmm1 );
+
+         for( size_t l=0UL; l<SIMDSIZE && r+l<rows; ++l ) {
+            y[A.sliceRow(s,r+l)] = tmp[l];
+         }
+      }
+
+      for( ; r<rows; ++r )
+      {
+         Type sum{};
+
+         for( size_t k=0UL; k<width; ++k ) {
+            sum += v[k*C+r] * xp[idx[k*C+r]];
+         }
+
+         y[A.sliceRow(s,r)] = sum;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication of a sliced ELLPACK matrix and a dense vector (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup sliced_ellpack_matrix
+//
+// \param A The left-hand side sliced ELLPACK matrix.
+// \param x The right-hand side dense vector.
+// \return The resulting vector of type \a RT.
+//
+// This function computes the product of a sliced ELLPACK matrix and a dense vector. The
+// right-hand side vector is evaluated in case it is not contiguous in memory. In case the number
+// of rows is larger or equal to the SMP sparse matrix/dense vector multiplication threshold and
+// the matrix can be used in SMP assignments, the slices are distributed among the available
+// threads (see smpFor()). Since every row belongs to exactly one slice, the threads write to
+// disjoint elements of the result vector.
+*/
+template< typename RT    // Type of the resulting dense vector
+        , typename Type  // Element type of the sliced ELLPACK matrix
+        , typename IT    // Type of the stored indices
+        , typename VT >  // Type of the right-hand side dense vector
+inline RT sellmatdvecmult( const SlicedEllpackMatrix<Type,IT>& A, const DenseVector<VT,false>& x )
+{
+   using XT = If_t< IsContiguous_v<VT> && HasConstDataAccess_v<VT>, const VT&, const ResultType_t<VT> >;
+
+   BLAZE_INTERNAL_ASSERT( A.columns() == (~x).size(), "Invalid vector size" );
+
+   XT x2( ~x );
+
+   RT y;
+   resize( y, A.rows(), false );
+
+   const auto kernel = [&y,&A,&x2]( size_t begin, size_t end )
+   {
+      sellmatdvecmultKernel( y, A, x2, begin, end );
+   };
+
+   if( canSMPReduce( A ) && A.rows() >= SMP_SMATDVECMULT_THRESHOLD && !isParallelSectionActive() ) {
+      smpFor( A.slices(), kernel );
+   }
+   else {
+      kernel( 0UL, A.slices() );
+   }
+
+   return y;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
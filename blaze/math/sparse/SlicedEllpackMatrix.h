@@ -0,0 +1,1598 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SlicedEllpackMatrix.h
+//  \brief Implementation of a sliced ELLPACK (SELL-C-sigma) sparse matrix
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_SLICEDELLPACKMATRIX_H_
+#define _BLAZE_MATH_SPARSE_SLICEDELLPACKMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/RelaxationFlag.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/Forward.h>
+#include <blaze/math/sparse/SlicedEllpackKernels.h>
+#include <blaze/math/sparse/ValueIndexPair.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/math/typetraits/IsSparseMatrix.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Integral.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Unsigned.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup sliced_ellpack_matrix SlicedEllpackMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Sliced ELLPACK (SELL-C-sigma) representation of a row-major \f$ M \times N \f$ matrix.
+// \ingroup sliced_ellpack_matrix
+//
+// The SlicedEllpackMatrix class template is an immutable, row-major sparse matrix in the sliced
+// ELLPACK format (SELL-C-sigma). The rows of the matrix are grouped into slices of \a C rows.
+// Within each slice, all rows are padded to the length of the longest row of the slice and the
+// elements are stored column by column, i.e. the k-th non-zero elements of the \a C rows of a
+// slice are adjacent in memory. In order to reduce the amount of padding, the rows can be sorted
+// by their number of non-zero elements within windows of \a sigma consecutive rows before they
+// are grouped into slices. The type of the elements and the type of the stored column indices
+// can be specified via the two template parameters:
+
+   \code
+   template< typename Type, typename IT >
+   class SlicedEllpackMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. SlicedEllpackMatrix can be used with any
+//          non-cv-qualified, non-reference, non-pointer element type.
+//  - IT  : specifies the unsigned integral type of the stored column indices. The default type
+//          is \c size_t.
+//
+// A SlicedEllpackMatrix is created from any other matrix, in particular from a CompressedMatrix.
+// The slice height \a C and the sorting scope \a sigma are passed as optional arguments. It is
+// not possible to insert, erase or modify the elements of the matrix, but all read operations
+// of a sparse matrix are supported:
+
+   \code
+   blaze::CompressedMatrix<double,blaze::rowMajor> A( 1000UL, 1000UL );
+   // ... Initialization of A
+
+   // Creating a SELL-C-sigma matrix with a slice height of 8 and sigma=64
+   blaze::SlicedEllpackMatrix<double,uint32_t> B( A, 8UL, 64UL );
+
+   blaze::DynamicVector<double> x( 1000UL ), y;
+   // ... Initialization of x
+
+   y = B * x;  // Vectorized sparse matrix/dense vector multiplication
+
+   for( auto it=B.begin(1); it!=B.end(1); ++it ) {
+      ... = it->value();  // Access to the value of the non-zero element
+      ... = it->index();  // Access to the index of the non-zero element
+   }
+   \endcode
+
+// The multiplication with a dense vector processes all rows of a slice simultaneously. For
+// \c float and \c double elements with a 4-byte or 8-byte index type, the elements of a slice
+// are processed by means of SIMD loads and gathers in case AVX2 or AVX-512 is available. In case
+// the number of rows exceeds the SMP sparse matrix/dense vector multiplication threshold, the
+// slices are distributed among the available threads. Note that the number of columns of the
+// matrix is restricted by the range of the index type. In case a larger matrix is converted,
+// a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+class SlicedEllpackMatrix
+   : public SparseMatrix< SlicedEllpackMatrix<Type,IT>, rowMajor >
+{
+ public:
+   //**Type definitions****************************************************************************
+   using This           = SlicedEllpackMatrix<Type,IT>;            //!< Type of this SlicedEllpackMatrix instance.
+   using BaseType       = SparseMatrix<This,rowMajor>;             //!< Base type of this SlicedEllpackMatrix instance.
+   using ResultType     = This;                                    //!< Result type for expression template evaluations.
+   using OppositeType   = CompressedMatrix<Type,columnMajor>;      //!< Result type with opposite storage order for expression template evaluations.
+   using TransposeType  = CompressedMatrix<Type,columnMajor>;      //!< Transpose type for expression template evaluations.
+   using ElementType    = Type;                                    //!< Type of the matrix elements.
+   using ReturnType     = const Type&;                             //!< Return type for expression template evaluations.
+   using CompositeType  = const This&;                             //!< Data type for composite expression templates.
+   using Reference      = const Type&;                             //!< Reference to a matrix element.
+   using ConstReference = const Type&;                             //!< Reference to a constant matrix element.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a SlicedEllpackMatrix with different data/element type.
+   */
+   template< typename NewType >  // Data type of the other matrix
+   struct Rebind {
+      using Other = SlicedEllpackMatrix<NewType,IT>;  //!< The type of the other SlicedEllpackMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Resize struct definition********************************************************************
+   /*!\brief Resize mechanism to obtain a SlicedEllpackMatrix with different fixed dimensions.
+   */
+   template< size_t NewM    // Number of rows of the other matrix
+           , size_t NewN >  // Number of columns of the other matrix
+   struct Resize {
+      using Other = SlicedEllpackMatrix<Type,IT>;  //!< The type of the other SlicedEllpackMatrix.
+   };
+   //**********************************************************************************************
+
+   //**ConstIterator class definition**************************************************************
+   /*!\brief Iterator over the non-zero elements of a single row of the sliced ELLPACK matrix.
+   */
+   class ConstIterator
+   {
+    public:
+      //**Type definitions*************************************************************************
+      //! Element type of the sliced ELLPACK matrix.
+      using Element = ValueIndexPair<Type>;
+
+      using IteratorCategory = std::forward_iterator_tag;  //!< The iterator category.
+      using ValueType        = Element;                    //!< Type of the underlying elements.
+      using PointerType      = const ConstIterator*;       //!< Pointer return type.
+      using ReferenceType    = const Element;              //!< Reference return type.
+      using DifferenceType   = ptrdiff_t;                  //!< Difference between two iterators.
+
+      // STL iterator requirements
+      using iterator_category = IteratorCategory;  //!< The iterator category.
+      using value_type        = ValueType;         //!< Type of the underlying elements.
+      using pointer           = PointerType;       //!< Pointer return type.
+      using reference         = ReferenceType;     //!< Reference return type.
+      using difference_type   = DifferenceType;    //!< Difference between two iterators.
+      //*******************************************************************************************
+
+      //**Default constructor**********************************************************************
+      /*!\brief Default constructor for the ConstIterator class.
+      */
+      inline ConstIterator() noexcept
+         : value_ ( nullptr )  // Pointer to the current value
+         , index_ ( nullptr )  // Pointer to the current index
+         , stride_( 0UL )      // Distance between two elements of the row
+      {}
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the ConstIterator class.
+      //
+      // \param value Pointer to the initial value.
+      // \param index Pointer to the initial index.
+      // \param stride The distance between two elements of the row.
+      */
+      inline ConstIterator( const Type* value, const IT* index, size_t stride ) noexcept
+         : value_ ( value  )  // Pointer to the current value
+         , index_ ( index  )  // Pointer to the current index
+         , stride_( stride )  // Distance between two elements of the row
+      {}
+      //*******************************************************************************************
+
+      //**Prefix increment operator****************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented iterator.
+      */
+      inline ConstIterator& operator++() noexcept {
+         value_ += stride_;
+         index_ += stride_;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix increment operator***************************************************************
+      /*!\brief Post-increment operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const ConstIterator operator++( int ) noexcept {
+         const ConstIterator tmp( *this );
+         ++(*this);
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the sparse matrix element at the current iterator position.
+      //
+      // \return The current sparse element.
+      */
+      inline ReferenceType operator*() const {
+         return Element( *value_, *index_ );
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the sparse matrix element at the current iterator position.
+      //
+      // \return Pointer to the iterator, which provides the value() and index() functions.
+      */
+      inline PointerType operator->() const noexcept {
+         return this;
+      }
+      //*******************************************************************************************
+
+      //**Value function***************************************************************************
+      /*!\brief Access to the current value of the sparse element.
+      //
+      // \return The current value of the sparse element.
+      */
+      inline const Type& value() const noexcept {
+         return *value_;
+      }
+      //*******************************************************************************************
+
+      //**Index function***************************************************************************
+      /*!\brief Access to the current index of the sparse element.
+      //
+      // \return The current index of the sparse element.
+      */
+      inline size_t index() const noexcept {
+         return *index_;
+      }
+      //*******************************************************************************************
+
+      //**Equality operator************************************************************************
+      /*!\brief Equality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side ConstIterator object.
+      // \return \a true if the iterators refer to the same element, \a false if not.
+      */
+      inline bool operator==( const ConstIterator& rhs ) const noexcept {
+         return index_ == rhs.index_;
+      }
+      //*******************************************************************************************
+
+      //**Inequality operator**********************************************************************
+      /*!\brief Inequality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side ConstIterator object.
+      // \return \a true if the iterators don't refer to the same element, \a false if they do.
+      */
+      inline bool operator!=( const ConstIterator& rhs ) const noexcept {
+         return index_ != rhs.index_;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Calculating the number of elements between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side ConstIterator object.
+      // \return The number of elements between the two ConstIterator objects.
+      */
+      inline DifferenceType operator-( const ConstIterator& rhs ) const noexcept {
+         return ( stride_ == 0UL )?( 0 ):( ( index_ - rhs.index_ ) / DifferenceType( stride_ ) );
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      const Type* value_;   //!< Pointer to the current value.
+      const IT*   index_;   //!< Pointer to the current index.
+      size_t      stride_;  //!< Distance between two elements of the row.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   using Iterator = ConstIterator;  //!< Iterator over non-constant elements.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   static constexpr bool smpAssignable = !IsSMPAssignable_v<Type>;
+   //**********************************************************************************************
+
+   //**Slice height********************************************************************************
+   //! The default number of rows per slice.
+   /*! The default slice height corresponds to two SIMD vectors of the element type. Thus the
+       multiplication kernels can keep two independent accumulators per slice. */
+   static constexpr size_t defaultSliceHeight = 2UL * SIMDTrait<Type>::size;
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline SlicedEllpackMatrix() noexcept;
+
+   template< typename MT, bool SO >
+   inline SlicedEllpackMatrix( const Matrix<MT,SO>& m,
+                               size_t sliceHeight=defaultSliceHeight, size_t sigma=1UL );
+
+   inline SlicedEllpackMatrix( const SlicedEllpackMatrix& sm );
+   inline SlicedEllpackMatrix( SlicedEllpackMatrix&& sm ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~SlicedEllpackMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline ConstReference operator()( size_t i, size_t j ) const noexcept;
+   inline ConstReference at( size_t i, size_t j ) const;
+   inline ConstIterator  begin ( size_t i ) const noexcept;
+   inline ConstIterator  cbegin( size_t i ) const noexcept;
+   inline ConstIterator  end   ( size_t i ) const noexcept;
+   inline ConstIterator  cend  ( size_t i ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline SlicedEllpackMatrix& operator=( const SlicedEllpackMatrix& rhs );
+   inline SlicedEllpackMatrix& operator=( SlicedEllpackMatrix&& rhs ) noexcept;
+
+   template< typename MT, bool SO >
+   inline SlicedEllpackMatrix& operator=( const Matrix<MT,SO>& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const noexcept;
+   inline size_t columns() const noexcept;
+   inline size_t capacity() const noexcept;
+   inline size_t capacity( size_t i ) const noexcept;
+   inline size_t nonZeros() const noexcept;
+   inline size_t nonZeros( size_t i ) const noexcept;
+   inline void   clear();
+   inline void   swap( SlicedEllpackMatrix& sm ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Slice access functions**********************************************************************
+   /*!\name Slice access functions */
+   //@{
+   inline size_t      sliceHeight() const noexcept;
+   inline size_t      sortingScope() const noexcept;
+   inline size_t      slices() const noexcept;
+   inline size_t      sliceRows( size_t s ) const noexcept;
+   inline size_t      sliceWidth( size_t s ) const noexcept;
+   inline size_t      sliceRow( size_t s, size_t r ) const noexcept;
+   inline const Type* sliceValues( size_t s ) const noexcept;
+   inline const IT*   sliceIndices( size_t s ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline ConstIterator find      ( size_t i, size_t j ) const;
+   inline ConstIterator lowerBound( size_t i, size_t j ) const;
+   inline ConstIterator upperBound( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Debugging functions*************************************************************************
+   /*!\name Debugging functions */
+   //@{
+   inline bool isIntact() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   inline bool canSMPAssign() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT >
+   void build( const MT& sm, size_t sliceHeight, size_t sigma );
+
+   static inline size_t checkIndexRange( size_t n );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t  m_;            //!< The current number of rows of the matrix.
+   size_t  n_;            //!< The current number of columns of the matrix.
+   size_t  sliceHeight_;  //!< The number of rows per slice.
+   size_t  sigma_;        //!< The number of consecutive rows that are sorted by their length.
+   size_t  slices_;       //!< The number of slices.
+   size_t  nonZeros_;     //!< The total number of non-zero elements.
+   size_t* offset_;       //!< Offsets of the first element of each slice.
+   size_t* length_;       //!< The number of non-zero elements of each stored row.
+   size_t* perm_;         //!< The original row index of each stored row.
+   size_t* iperm_;        //!< The stored position of each original row.
+   Type*   values_;       //!< The values of the stored elements.
+   IT*     indices_;      //!< The column indices of the stored elements.
+
+   static const Type zero_;  //!< Neutral element for accesses to zero elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_CONSTRAINT_MUST_BE_INTEGRAL_TYPE     ( IT );
+   BLAZE_CONSTRAINT_MUST_BE_UNSIGNED_TYPE     ( IT );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+template< typename Type, typename IT >
+const Type SlicedEllpackMatrix<Type,IT>::zero_{};
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for SlicedEllpackMatrix.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline SlicedEllpackMatrix<Type,IT>::SlicedEllpackMatrix() noexcept
+   : m_          ( 0UL )                 // The current number of rows of the matrix
+   , n_          ( 0UL )                 // The current number of columns of the matrix
+   , sliceHeight_( defaultSliceHeight )  // The number of rows per slice
+   , sigma_      ( 1UL )                 // The number of consecutive rows that are sorted by their length
+   , slices_     ( 0UL )                 // The number of slices
+   , nonZeros_   ( 0UL )                 // The total number of non-zero elements
+   , offset_     ( nullptr )             // Offsets of the first element of each slice
+   , length_     ( nullptr )             // The number of non-zero elements of each stored row
+   , perm_       ( nullptr )             // The original row index of each stored row
+   , iperm_      ( nullptr )             // The stored position of each original row
+   , values_     ( nullptr )             // The values of the stored elements
+   , indices_    ( nullptr )             // The column indices of the stored elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different matrices.
+//
+// \param m Matrix to be converted.
+// \param sliceHeight The number of rows per slice \f$[1..\infty)\f$.
+// \param sigma The number of consecutive rows that are sorted by their length \f$[1..\infty)\f$.
+// \exception std::invalid_argument Invalid slice height.
+// \exception std::invalid_argument Invalid sorting scope.
+// \exception std::invalid_argument Number of columns exceeds the range of the index type.
+//
+// This constructor converts the given matrix into the sliced ELLPACK format. Within each window
+// of \a sigma consecutive rows, the rows are sorted by decreasing number of non-zero elements.
+// Afterwards, the rows are grouped into slices of \a sliceHeight rows. A \a sigma of 1 preserves
+// the original order of the rows. Row-major sparse matrices are converted directly, all other
+// matrices are converted via a temporary row-major CompressedMatrix.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+template< typename MT    // Type of the foreign matrix
+        , bool SO >      // Storage order of the foreign matrix
+inline SlicedEllpackMatrix<Type,IT>::SlicedEllpackMatrix( const Matrix<MT,SO>& m,
+                                                          size_t sliceHeight, size_t sigma )
+   : SlicedEllpackMatrix()
+{
+   using TmpType = If_t< IsSparseMatrix_v<MT> && IsRowMajorMatrix_v<MT>
+                       , CompositeType_t<MT>
+                       , const CompressedMatrix<Type,rowMajor> >;
+
+   TmpType tmp( ~m );
+
+   build( tmp, sliceHeight, sigma );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for SlicedEllpackMatrix.
+//
+// \param sm Sliced ELLPACK matrix to be copied.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline SlicedEllpackMatrix<Type,IT>::SlicedEllpackMatrix( const SlicedEllpackMatrix& sm )
+   : SlicedEllpackMatrix()
+{
+   if( sm.offset_ == nullptr ) {
+      sliceHeight_ = sm.sliceHeight_;
+      sigma_       = sm.sigma_;
+      return;
+   }
+
+   const size_t capacity( sm.capacity() );
+
+   offset_  = new size_t[sm.slices_+1UL+3UL*sm.m_];
+   values_  = allocate<Type>( capacity );
+   indices_ = allocate<IT>( capacity );
+
+   m_           = sm.m_;
+   n_           = sm.n_;
+   sliceHeight_ = sm.sliceHeight_;
+   sigma_       = sm.sigma_;
+   slices_      = sm.slices_;
+   nonZeros_    = sm.nonZeros_;
+   length_      = offset_ + slices_ + 1UL;
+   perm_        = length_ + m_;
+   iperm_       = perm_   + m_;
+
+   std::copy( sm.offset_, sm.offset_+slices_+1UL+3UL*m_, offset_ );
+   std::copy( sm.values_, sm.values_+capacity, values_ );
+   std::copy( sm.indices_, sm.indices_+capacity, indices_ );
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for SlicedEllpackMatrix.
+//
+// \param sm The sliced ELLPACK matrix to be moved into this instance.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline SlicedEllpackMatrix<Type,IT>::SlicedEllpackMatrix( SlicedEllpackMatrix&& sm ) noexcept
+   : SlicedEllpackMatrix()
+{
+   swap( sm );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for SlicedEllpackMatrix.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline SlicedEllpackMatrix<Type,IT>::~SlicedEllpackMatrix()
+{
+   delete[] offset_;
+   deallocate( values_ );
+   deallocate( indices_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the sliced ELLPACK matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline typename SlicedEllpackMatrix<Type,IT>::ConstReference
+   SlicedEllpackMatrix<Type,IT>::operator()( size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < n_, "Invalid column access index" );
+
+   const ConstIterator pos( find( i, j ) );
+
+   if( pos == end( i ) )
+      return zero_;
+   else
+      return pos->value();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the sliced ELLPACK matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// In contrast to the function call operator this function always performs a check of the
+// given access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline typename SlicedEllpackMatrix<Type,IT>::ConstReference
+   SlicedEllpackMatrix<Type,IT>::at( size_t i, size_t j ) const
+{
+   if( i >= m_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first non-zero element of row \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline typename SlicedEllpackMatrix<Type,IT>::ConstIterator
+   SlicedEllpackMatrix<Type,IT>::begin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sliced ELLPACK matrix access index" );
+
+   const size_t p( iperm_[i] );
+   const size_t k( offset_[p/sliceHeight_] + p%sliceHeight_ );
+
+   return ConstIterator( values_+k, indices_+k, sliceHeight_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first non-zero element of row \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline typename SlicedEllpackMatrix<Type,IT>::ConstIterator
+   SlicedEllpackMatrix<Type,IT>::cbegin( size_t i ) const noexcept
+{
+   return begin( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last non-zero element of row \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline typename SlicedEllpackMatrix<Type,IT>::ConstIterator
+   SlicedEllpackMatrix<Type,IT>::end( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sliced ELLPACK matrix access index" );
+
+   const size_t p( iperm_[i] );
+   const size_t k( offset_[p/sliceHeight_] + p%sliceHeight_ + length_[p]*sliceHeight_ );
+
+   return ConstIterator( values_+k, indices_+k, sliceHeight_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last non-zero element of row \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline typename SlicedEllpackMatrix<Type,IT>::ConstIterator
+   SlicedEllpackMatrix<Type,IT>::cend( size_t i ) const noexcept
+{
+   return end( i );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for SlicedEllpackMatrix.
+//
+// \param rhs Sliced ELLPACK matrix to be copied.
+// \return Reference to the assigned matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline SlicedEllpackMatrix<Type,IT>&
+   SlicedEllpackMatrix<Type,IT>::operator=( const SlicedEllpackMatrix& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   SlicedEllpackMatrix tmp( rhs );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for SlicedEllpackMatrix.
+//
+// \param rhs The sliced ELLPACK matrix to be moved into this instance.
+// \return Reference to the assigned matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline SlicedEllpackMatrix<Type,IT>&
+   SlicedEllpackMatrix<Type,IT>::operator=( SlicedEllpackMatrix&& rhs ) noexcept
+{
+   swap( rhs );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different matrices.
+//
+// \param rhs Matrix to be converted.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Number of columns exceeds the range of the index type.
+//
+// The matrix is converted into the sliced ELLPACK format with the current slice height and
+// sorting scope.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO >      // Storage order of the right-hand side matrix
+inline SlicedEllpackMatrix<Type,IT>&
+   SlicedEllpackMatrix<Type,IT>::operator=( const Matrix<MT,SO>& rhs )
+{
+   SlicedEllpackMatrix tmp( ~rhs, sliceHeight_, sigma_ );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the sliced ELLPACK matrix.
+//
+// \return The number of rows of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline size_t SlicedEllpackMatrix<Type,IT>::rows() const noexcept
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the sliced ELLPACK matrix.
+//
+// \return The number of columns of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline size_t SlicedEllpackMatrix<Type,IT>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of stored elements including the padding elements.
+//
+// \return The capacity of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline size_t SlicedEllpackMatrix<Type,IT>::capacity() const noexcept
+{
+   return ( offset_ != nullptr )?( offset_[slices_] ):( 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of stored elements of row \a i including the padding elements.
+//
+// \param i The row index.
+// \return The width of the slice containing row \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline size_t SlicedEllpackMatrix<Type,IT>::capacity( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row access index" );
+   return sliceWidth( iperm_[i] / sliceHeight_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of non-zero elements in the sliced ELLPACK matrix.
+//
+// \return The number of non-zero elements in the matrix.
+//
+// Note that the padding elements of the slices are not counted.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline size_t SlicedEllpackMatrix<Type,IT>::nonZeros() const noexcept
+{
+   return nonZeros_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in row \a i.
+//
+// \param i The row index.
+// \return The number of non-zero elements of row \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline size_t SlicedEllpackMatrix<Type,IT>::nonZeros( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row access index" );
+   return length_[iperm_[i]];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the sliced ELLPACK matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the matrix is 0. The slice height and the sorting
+// scope are preserved.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline void SlicedEllpackMatrix<Type,IT>::clear()
+{
+   SlicedEllpackMatrix tmp;
+   tmp.sliceHeight_ = sliceHeight_;
+   tmp.sigma_       = sigma_;
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two sliced ELLPACK matrices.
+//
+// \param sm The matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline void SlicedEllpackMatrix<Type,IT>::swap( SlicedEllpackMatrix& sm ) noexcept
+{
+   std::swap( m_, sm.m_ );
+   std::swap( n_, sm.n_ );
+   std::swap( sliceHeight_, sm.sliceHeight_ );
+   std::swap( sigma_, sm.sigma_ );
+   std::swap( slices_, sm.slices_ );
+   std::swap( nonZeros_, sm.nonZeros_ );
+   std::swap( offset_, sm.offset_ );
+   std::swap( length_, sm.length_ );
+   std::swap( perm_, sm.perm_ );
+   std::swap( iperm_, sm.iperm_ );
+   std::swap( values_, sm.values_ );
+   std::swap( indices_, sm.indices_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Converting the given row-major sparse matrix into the sliced ELLPACK format.
+//
+// \param sm The row-major sparse matrix to be converted.
+// \param sliceHeight The number of rows per slice \f$[1..\infty)\f$.
+// \param sigma The number of consecutive rows that are sorted by their length \f$[1..\infty)\f$.
+// \return void
+// \exception std::invalid_argument Invalid slice height.
+// \exception std::invalid_argument Invalid sorting scope.
+// \exception std::invalid_argument Number of columns exceeds the range of the index type.
+//
+// This function must only be called on a matrix in default state. The padding elements of each
+// slice are initialized with a zero value and the column index 0, which allows the multiplication
+// kernels to process all rows of a slice uniformly.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+template< typename MT >  // Type of the row-major sparse matrix
+void SlicedEllpackMatrix<Type,IT>::build( const MT& sm, size_t sliceHeight, size_t sigma )
+{
+   BLAZE_INTERNAL_ASSERT( offset_ == nullptr, "Invalid sliced ELLPACK matrix detected" );
+
+   if( sliceHeight == 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid slice height" );
+   }
+   if( sigma == 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid sorting scope" );
+   }
+
+   const size_t m( sm.rows() );
+   const size_t n( checkIndexRange( sm.columns() ) );
+   const size_t slices( ( m + sliceHeight - 1UL ) / sliceHeight );
+
+   sliceHeight_ = sliceHeight;
+   sigma_       = sigma;
+
+   if( m == 0UL ) {
+      n_ = n;
+      return;
+   }
+
+   offset_ = new size_t[slices+1UL+3UL*m];
+   length_ = offset_ + slices + 1UL;
+   perm_   = length_ + m;
+   iperm_  = perm_   + m;
+
+   // Counting the non-zero elements of each row (temporarily stored in iperm_)
+   for( size_t i=0UL; i<m; ++i ) {
+      size_t count( 0UL );
+      for( auto element=sm.begin(i); element!=sm.end(i); ++element ) {
+         ++count;
+      }
+      perm_[i]  = i;
+      iperm_[i] = count;
+   }
+
+   // Sorting the rows by decreasing length within each window of sigma rows
+   if( sigma > 1UL ) {
+      const size_t* const counts( iperm_ );
+      for( size_t w=0UL; w<m; w+=sigma ) {
+         std::stable_sort( perm_+w, perm_+min( m, w+sigma ),
+                           [counts]( size_t a, size_t b ) { return counts[a] > counts[b]; } );
+      }
+   }
+
+   nonZeros_ = 0UL;
+   for( size_t p=0UL; p<m; ++p ) {
+      length_[p] = iperm_[perm_[p]];
+      nonZeros_ += length_[p];
+   }
+   for( size_t p=0UL; p<m; ++p ) {
+      iperm_[perm_[p]] = p;
+   }
+
+   // Computing the offsets of the slices
+   offset_[0UL] = 0UL;
+   for( size_t s=0UL; s<slices; ++s ) {
+      size_t width( 0UL );
+      for( size_t p=s*sliceHeight; p<min( m, (s+1UL)*sliceHeight ); ++p ) {
+         width = max( width, length_[p] );
+      }
+      offset_[s+1UL] = offset_[s] + width*sliceHeight;
+   }
+
+   const size_t capacity( offset_[slices] );
+
+   values_  = allocate<Type>( capacity );
+   indices_ = allocate<IT>( capacity );
+
+   std::fill( values_, values_+capacity, Type() );
+   std::fill( indices_, indices_+capacity, IT(0) );
+
+   m_      = m;
+   n_      = n;
+   slices_ = slices;
+
+   // Transferring the non-zero elements
+   for( size_t p=0UL; p<m; ++p )
+   {
+      size_t k( offset_[p/sliceHeight] + p%sliceHeight );
+
+      for( auto element=sm.begin(perm_[p]); element!=sm.end(perm_[p]); ++element ) {
+         values_[k]  = element->value();
+         indices_[k] = static_cast<IT>( element->index() );
+         k += sliceHeight;
+      }
+   }
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checks whether the given number of columns can be represented by the index type.
+//
+// \param n The number of columns of the matrix.
+// \return The given number of columns.
+// \exception std::invalid_argument Number of columns exceeds the range of the index type.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline size_t SlicedEllpackMatrix<Type,IT>::checkIndexRange( size_t n )
+{
+   if( n > 0UL && n-1UL > static_cast<size_t>( std::numeric_limits<IT>::max() ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Number of columns exceeds the range of the index type" );
+   }
+
+   return n;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SLICE ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows per slice.
+//
+// \return The slice height \a C.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline size_t SlicedEllpackMatrix<Type,IT>::sliceHeight() const noexcept
+{
+   return sliceHeight_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of consecutive rows that are sorted by their length.
+//
+// \return The sorting scope \a sigma.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline size_t SlicedEllpackMatrix<Type,IT>::sortingScope() const noexcept
+{
+   return sigma_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of slices.
+//
+// \return The number of slices of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline size_t SlicedEllpackMatrix<Type,IT>::slices() const noexcept
+{
+   return slices_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows of slice \a s.
+//
+// \param s The index of the slice.
+// \return The number of rows of the slice.
+//
+// All slices except for the last one contain sliceHeight() rows. The remaining rows of the last
+// slice are padding rows, which are not part of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline size_t SlicedEllpackMatrix<Type,IT>::sliceRows( size_t s ) const noexcept
+{
+   BLAZE_USER_ASSERT( s < slices_, "Invalid slice access index" );
+   return min( sliceHeight_, m_ - s*sliceHeight_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of stored elements per row of slice \a s.
+//
+// \param s The index of the slice.
+// \return The length of the longest row of the slice.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline size_t SlicedEllpackMatrix<Type,IT>::sliceWidth( size_t s ) const noexcept
+{
+   BLAZE_USER_ASSERT( s < slices_, "Invalid slice access index" );
+   return ( offset_[s+1UL] - offset_[s] ) / sliceHeight_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the original index of row \a r of slice \a s.
+//
+// \param s The index of the slice.
+// \param r The index of the row within the slice \f$[0..sliceRows(s)-1]\f$.
+// \return The row index of the row within the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline size_t SlicedEllpackMatrix<Type,IT>::sliceRow( size_t s, size_t r ) const noexcept
+{
+   BLAZE_USER_ASSERT( s < slices_, "Invalid slice access index" );
+   BLAZE_USER_ASSERT( r < sliceRows( s ), "Invalid row access index" );
+   return perm_[s*sliceHeight_+r];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a pointer to the values of slice \a s.
+//
+// \param s The index of the slice.
+// \return Pointer to the first value of the slice.
+//
+// The k-th element of row \a r of the slice is stored at position \f$ k \cdot C + r \f$, where
+// \a C is the slice height.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline const Type* SlicedEllpackMatrix<Type,IT>::sliceValues( size_t s ) const noexcept
+{
+   BLAZE_USER_ASSERT( s < slices_, "Invalid slice access index" );
+   return values_ + offset_[s];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a pointer to the column indices of slice \a s.
+//
+// \param s The index of the slice.
+// \return Pointer to the first column index of the slice.
+//
+// The column indices are stored in the same order as the values (see sliceValues()).
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline const IT* SlicedEllpackMatrix<Type,IT>::sliceIndices( size_t s ) const noexcept
+{
+   BLAZE_USER_ASSERT( s < slices_, "Invalid slice access index" );
+   return indices_ + offset_[s];
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline typename SlicedEllpackMatrix<Type,IT>::ConstIterator
+   SlicedEllpackMatrix<Type,IT>::find( size_t i, size_t j ) const
+{
+   const ConstIterator pos( lowerBound( i, j ) );
+   if( pos != end( i ) && pos->index() == j )
+      return pos;
+   else return end( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less than the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less than the given index, end() iterator otherwise.
+//
+// The binary search is performed directly on the strided column indices of the row.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline typename SlicedEllpackMatrix<Type,IT>::ConstIterator
+   SlicedEllpackMatrix<Type,IT>::lowerBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row access index" );
+
+   const size_t p( iperm_[i] );
+   const size_t k( offset_[p/sliceHeight_] + p%sliceHeight_ );
+
+   size_t first( 0UL ), count( length_[p] );
+
+   while( count > 0UL ) {
+      const size_t step( count / 2UL );
+      if( indices_[k+(first+step)*sliceHeight_] < j ) {
+         first += step + 1UL;
+         count -= step + 1UL;
+      }
+      else count = step;
+   }
+
+   return ConstIterator( values_+k+first*sliceHeight_, indices_+k+first*sliceHeight_, sliceHeight_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater than the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater than the given index, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline typename SlicedEllpackMatrix<Type,IT>::ConstIterator
+   SlicedEllpackMatrix<Type,IT>::upperBound( size_t i, size_t j ) const
+{
+   ConstIterator pos( lowerBound( i, j ) );
+   if( pos != end( i ) && pos->index() == j )
+      ++pos;
+   return pos;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEBUGGING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the sliced ELLPACK matrix are intact.
+//
+// \return \a true in case the sliced ELLPACK matrix's invariants are intact, \a false otherwise.
+//
+// This function checks whether the invariants of the sliced ELLPACK matrix are intact, i.e. if
+// the row permutation is consistent and if each row fits into its slice.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline bool SlicedEllpackMatrix<Type,IT>::isIntact() const noexcept
+{
+   if( sliceHeight_ == 0UL || sigma_ == 0UL )
+      return false;
+
+   if( m_ == 0UL )
+      return ( offset_ == nullptr && nonZeros_ == 0UL );
+
+   size_t nonzeros( 0UL );
+
+   for( size_t p=0UL; p<m_; ++p ) {
+      if( perm_[p] >= m_ || iperm_[perm_[p]] != p ||
+          length_[p] > sliceWidth( p / sliceHeight_ ) )
+         return false;
+      nonzeros += length_[p];
+   }
+
+   return ( nonzeros == nonZeros_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the matrix
+        , typename IT >     // Type of the stored indices
+template< typename Other >  // Data type of the foreign expression
+inline bool SlicedEllpackMatrix<Type,IT>::canAlias( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the matrix
+        , typename IT >     // Type of the stored indices
+template< typename Other >  // Data type of the foreign expression
+inline bool SlicedEllpackMatrix<Type,IT>::isAliased( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+//
+// This function returns whether the matrix can be used in SMP assignments. In contrast to the
+// \a smpAssignable member enumeration, which is based solely on compile time information, this
+// function additionally provides runtime information (as for instance the current number of
+// rows and/or columns of the matrix).
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline bool SlicedEllpackMatrix<Type,IT>::canSMPAssign() const noexcept
+{
+   return true;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SLICEDELLPACKMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name SlicedEllpackMatrix operators */
+//@{
+template< typename Type, typename IT >
+void clear( SlicedEllpackMatrix<Type,IT>& m );
+
+template< RelaxationFlag RF, typename Type, typename IT >
+bool isDefault( const SlicedEllpackMatrix<Type,IT>& m );
+
+template< typename Type, typename IT >
+bool isIntact( const SlicedEllpackMatrix<Type,IT>& m ) noexcept;
+
+template< typename Type, typename IT >
+void swap( SlicedEllpackMatrix<Type,IT>& a, SlicedEllpackMatrix<Type,IT>& b ) noexcept;
+
+template< typename Type, typename IT, typename VT >
+const MultTrait_t< SlicedEllpackMatrix<Type,IT>, VT >
+   operator*( const SlicedEllpackMatrix<Type,IT>& mat, const DenseVector<VT,false>& vec );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given sliced ELLPACK matrix.
+// \ingroup sliced_ellpack_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline void clear( SlicedEllpackMatrix<Type,IT>& m )
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given sliced ELLPACK matrix is in default state.
+// \ingroup sliced_ellpack_matrix
+//
+// \param m The matrix to be tested for its default state.
+// \return \a true in case the given matrix's rows and columns are zero, \a false otherwise.
+*/
+template< RelaxationFlag RF  // Relaxation flag
+        , typename Type      // Data type of the matrix
+        , typename IT >      // Type of the stored indices
+inline bool isDefault( const SlicedEllpackMatrix<Type,IT>& m )
+{
+   return ( m.rows() == 0UL && m.columns() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the given sliced ELLPACK matrix are intact.
+// \ingroup sliced_ellpack_matrix
+//
+// \param m The sliced ELLPACK matrix to be tested.
+// \return \a true in case the given matrix's invariants are intact, \a false otherwise.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline bool isIntact( const SlicedEllpackMatrix<Type,IT>& m ) noexcept
+{
+   return m.isIntact();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two sliced ELLPACK matrices.
+// \ingroup sliced_ellpack_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the stored indices
+inline void swap( SlicedEllpackMatrix<Type,IT>& a, SlicedEllpackMatrix<Type,IT>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a sliced ELLPACK matrix and a dense
+//        vector (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup sliced_ellpack_matrix
+//
+// \param mat The left-hand side sliced ELLPACK matrix for the multiplication.
+// \param vec The right-hand side dense vector for the multiplication.
+// \return The resulting vector.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This operator computes the product of a sliced ELLPACK matrix and a dense vector by means of
+// a dedicated kernel that processes all rows of a slice simultaneously (see sellmatdvecmult()).
+// In contrast to the general multiplication operator, the product is evaluated immediately.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT    // Type of the stored indices
+        , typename VT >  // Type of the right-hand side dense vector
+inline const MultTrait_t< SlicedEllpackMatrix<Type,IT>, VT >
+   operator*( const SlicedEllpackMatrix<Type,IT>& mat, const DenseVector<VT,false>& vec )
+{
+   using RT = MultTrait_t< SlicedEllpackMatrix<Type,IT>, VT >;
+
+   BLAZE_FUNCTION_TRACE;
+
+   if( mat.columns() != (~vec).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix and vector sizes do not match" );
+   }
+
+   return sellmatdvecmult<RT>( mat, ~vec );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,358 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SoAElement.h
+//  \brief Header file for the SoAElement class template
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_SOAELEMENT_H_
+#define _BLAZE_MATH_SPARSE_SOAELEMENT_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/sparse/SparseElement.h>
+#include <blaze/math/typetraits/IsSparseElement.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/RemoveConst.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Proxy for a single element of a sparse vector or matrix with split storage.
+// \ingroup math
+//
+// The SoAElement class represents a single value-index-pair of a sparse vector or sparse matrix
+// that stores its values and indices in two separate arrays (structure of arrays). In contrast
+// to the ValueIndexPair class, the SoAElement does not own the value and the index, but refers
+// to the according entries of the two arrays. The \a Type template parameter specifies the type
+// of the values (which may be \a const qualified), the \a IT template parameter specifies the
+// type of the stored indices.
+*/
+template< typename Type  // Type of the value element
+        , typename IT >  // Type of the index element
+class SoAElement
+   : private SparseElement
+{
+ public:
+   //**Type definitions****************************************************************************
+   using ValueType      = RemoveConst_t<Type>;  //!< The value type of the value-index-pair.
+   using IndexType      = size_t;               //!< The index type of the value-index-pair.
+   using Reference      = Type&;                //!< Reference return type.
+   using ConstReference = const Type&;          //!< Reference-to-const return type.
+   using Pointer        = SoAElement*;          //!< Pointer return type.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline SoAElement( Type* value, const IT* index ) noexcept;
+   SoAElement( const SoAElement& ) = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline SoAElement& operator=( const SoAElement& rhs );
+
+   template< typename Other >
+   inline auto operator=( const Other& rhs )
+      -> EnableIf_t< IsSparseElement_v<Other>, SoAElement& >;
+
+   template< typename Other >
+   inline auto operator=( const Other& v )
+      -> EnableIf_t< !IsSparseElement_v<Other>, SoAElement& >;
+
+   template< typename Other > inline SoAElement& operator+=( const Other& v );
+   template< typename Other > inline SoAElement& operator-=( const Other& v );
+   template< typename Other > inline SoAElement& operator*=( const Other& v );
+   template< typename Other > inline SoAElement& operator/=( const Other& v );
+   //@}
+   //**********************************************************************************************
+
+   //**Access operators****************************************************************************
+   /*!\name Access operators */
+   //@{
+   inline Pointer operator->() noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Access functions****************************************************************************
+   /*!\name Access functions */
+   //@{
+   inline Reference value() const noexcept;
+   inline IndexType index() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   Type*     value_;  //!< Pointer to the value of the value-index-pair.
+   const IT* index_;  //!< Pointer to the index of the value-index-pair.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the SoAElement class template.
+//
+// \param value Pointer to the value of the element.
+// \param index Pointer to the index of the element.
+*/
+template< typename Type  // Type of the value element
+        , typename IT >  // Type of the index element
+inline SoAElement<Type,IT>::SoAElement( Type* value, const IT* index ) noexcept
+   : value_( value )  // Pointer to the value of the value-index-pair
+   , index_( index )  // Pointer to the index of the value-index-pair
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for SoAElement.
+//
+// \param rhs The right-hand side element.
+// \return Reference to the assigned element.
+//
+// In contrast to a value-index-pair, the copy assignment only copies the value of the given
+// element. The index of the element remains unchanged.
+*/
+template< typename Type  // Type of the value element
+        , typename IT >  // Type of the index element
+inline SoAElement<Type,IT>& SoAElement<Type,IT>::operator=( const SoAElement& rhs )
+{
+   *value_ = rhs.value();
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for value-index-pair types.
+//
+// \param rhs The right-hand side value-index-pair.
+// \return Reference to the assigned element.
+//
+// This assignment operator enables the assignment of other value-index-pair types. Since the
+// element is part of a sorted sparse vector or matrix, only the value of the given element is
+// copied. The index of the element remains unchanged.
+*/
+template< typename Type     // Type of the value element
+        , typename IT >     // Type of the index element
+template< typename Other >  // Data type of the right-hand side value-index-pair
+inline auto SoAElement<Type,IT>::operator=( const Other& rhs )
+   -> EnableIf_t< IsSparseElement_v<Other>, SoAElement& >
+{
+   *value_ = rhs.value();
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment to the value of the element.
+//
+// \param v The new value of the element.
+// \return Reference to the assigned element.
+*/
+template< typename Type     // Type of the value element
+        , typename IT >     // Type of the index element
+template< typename Other >  // Data type of the right-hand side value
+inline auto SoAElement<Type,IT>::operator=( const Other& v )
+   -> EnableIf_t< !IsSparseElement_v<Other>, SoAElement& >
+{
+   *value_ = v;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment to the value of the element.
+//
+// \param v The right-hand side value to be added to the element value.
+// \return Reference to the assigned element.
+*/
+template< typename Type     // Type of the value element
+        , typename IT >     // Type of the index element
+template< typename Other >  // Data type of the right-hand side value
+inline SoAElement<Type,IT>& SoAElement<Type,IT>::operator+=( const Other& v )
+{
+   *value_ += v;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment to the value of the element.
+//
+// \param v The right-hand side value to be subtracted from the element value.
+// \return Reference to the assigned element.
+*/
+template< typename Type     // Type of the value element
+        , typename IT >     // Type of the index element
+template< typename Other >  // Data type of the right-hand side value
+inline SoAElement<Type,IT>& SoAElement<Type,IT>::operator-=( const Other& v )
+{
+   *value_ -= v;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment to the value of the element.
+//
+// \param v The right-hand side value for the multiplication.
+// \return Reference to the assigned element.
+*/
+template< typename Type     // Type of the value element
+        , typename IT >     // Type of the index element
+template< typename Other >  // Data type of the right-hand side value
+inline SoAElement<Type,IT>& SoAElement<Type,IT>::operator*=( const Other& v )
+{
+   *value_ *= v;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment to the value of the element.
+//
+// \param v The right-hand side value for the division.
+// \return Reference to the assigned element.
+*/
+template< typename Type     // Type of the value element
+        , typename IT >     // Type of the index element
+template< typename Other >  // Data type of the right-hand side value
+inline SoAElement<Type,IT>& SoAElement<Type,IT>::operator/=( const Other& v )
+{
+   *value_ /= v;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Direct access to the element.
+//
+// \return Pointer to the element.
+*/
+template< typename Type  // Type of the value element
+        , typename IT >  // Type of the index element
+inline typename SoAElement<Type,IT>::Pointer SoAElement<Type,IT>::operator->() noexcept
+{
+   return this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Access to the current value of the element.
+//
+// \return The current value of the element.
+*/
+template< typename Type  // Type of the value element
+        , typename IT >  // Type of the index element
+inline typename SoAElement<Type,IT>::Reference SoAElement<Type,IT>::value() const noexcept
+{
+   return *value_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Access to the current index of the element.
+//
+// \return The current index of the element.
+*/
+template< typename Type  // Type of the value element
+        , typename IT >  // Type of the index element
+inline typename SoAElement<Type,IT>::IndexType SoAElement<Type,IT>::index() const noexcept
+{
+   return static_cast<IndexType>( *index_ );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,401 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SoAIterator.h
+//  \brief Header file for the SoAIterator class template
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_SOAITERATOR_H_
+#define _BLAZE_MATH_SPARSE_SOAITERATOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <iterator>
+#include <blaze/math/sparse/SoAElement.h>
+#include <blaze/math/typetraits/IsSoAIterator.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsConst.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/RemoveConst.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Iterator over the elements of a sparse vector or matrix with split storage.
+// \ingroup math
+//
+// The SoAIterator class template represents a random access iterator over the non-zero elements
+// of a sparse vector or a single row/column of a sparse matrix that stores its values and indices
+// in two separate, contiguous arrays (structure of arrays). Dereferencing the iterator results
+// in a SoAElement proxy, which provides the same \c value() and \c index() interface as the
+// ValueIndexPair elements of CompressedVector and CompressedMatrix. Additionally, the valueBase()
+// and indexBase() functions provide direct access to the two underlying arrays, which enables
+// compute kernels to stream the values and indices separately (e.g. by means of SIMD gathers).
+*/
+template< typename Type  // Type of the value elements
+        , typename IT >  // Type of the index elements
+class SoAIterator
+{
+ public:
+   //**Type definitions****************************************************************************
+   using IteratorCategory = std::random_access_iterator_tag;  //!< The iterator category.
+   using ValueType        = SoAElement<Type,IT>;              //!< Type of the underlying elements.
+   using PointerType      = ValueType;                        //!< Pointer return type.
+   using ReferenceType    = ValueType;                        //!< Reference return type.
+   using DifferenceType   = ptrdiff_t;                        //!< Difference between two iterators.
+   using IndexType        = IT;                               //!< Type of the stored indices.
+
+   // STL iterator requirements
+   using iterator_category = IteratorCategory;  //!< The iterator category.
+   using value_type        = ValueType;         //!< Type of the underlying elements.
+   using pointer           = PointerType;       //!< Pointer return type.
+   using reference         = ReferenceType;     //!< Reference return type.
+   using difference_type   = DifferenceType;    //!< Difference between two iterators.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\brief Default constructor for the SoAIterator class template.
+   */
+   inline SoAIterator() noexcept
+      : value_( nullptr )  // Pointer to the current value
+      , index_( nullptr )  // Pointer to the current index
+   {}
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\brief Constructor for the SoAIterator class template.
+   //
+   // \param value Pointer to the initial value.
+   // \param index Pointer to the initial index.
+   */
+   inline SoAIterator( Type* value, const IT* index ) noexcept
+      : value_( value )  // Pointer to the current value
+      , index_( index )  // Pointer to the current index
+   {}
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\brief Conversion constructor from different SoAIterator instances.
+   //
+   // \param it The iterator to be copied.
+   */
+   template< typename Other
+           , typename = EnableIf_t< IsConst_v<Type> &&
+                                    IsSame_v< RemoveConst_t<Type>, RemoveConst_t<Other> > > >
+   inline SoAIterator( const SoAIterator<Other,IT>& it ) noexcept
+      : value_( it.valueBase() )  // Pointer to the current value
+      , index_( it.indexBase() )  // Pointer to the current index
+   {}
+   //**********************************************************************************************
+
+   //**Addition assignment operator****************************************************************
+   /*!\brief Addition assignment operator.
+   //
+   // \param inc The increment of the iterator.
+   // \return Reference to the incremented iterator.
+   */
+   inline SoAIterator& operator+=( size_t inc ) noexcept {
+      value_ += inc;
+      index_ += inc;
+      return *this;
+   }
+   //**********************************************************************************************
+
+   //**Subtraction assignment operator*************************************************************
+   /*!\brief Subtraction assignment operator.
+   //
+   // \param dec The decrement of the iterator.
+   // \return Reference to the decremented iterator.
+   */
+   inline SoAIterator& operator-=( size_t dec ) noexcept {
+      value_ -= dec;
+      index_ -= dec;
+      return *this;
+   }
+   //**********************************************************************************************
+
+   //**Prefix increment operator*******************************************************************
+   /*!\brief Pre-increment operator.
+   //
+   // \return Reference to the incremented iterator.
+   */
+   inline SoAIterator& operator++() noexcept {
+      ++value_;
+      ++index_;
+      return *this;
+   }
+   //**********************************************************************************************
+
+   //**Postfix increment operator******************************************************************
+   /*!\brief Post-increment operator.
+   //
+   // \return The previous position of the iterator.
+   */
+   inline const SoAIterator operator++( int ) noexcept {
+      const SoAIterator tmp( *this );
+      ++(*this);
+      return tmp;
+   }
+   //**********************************************************************************************
+
+   //**Prefix decrement operator*******************************************************************
+   /*!\brief Pre-decrement operator.
+   //
+   // \return Reference to the decremented iterator.
+   */
+   inline SoAIterator& operator--() noexcept {
+      --value_;
+      --index_;
+      return *this;
+   }
+   //**********************************************************************************************
+
+   //**Postfix decrement operator******************************************************************
+   /*!\brief Post-decrement operator.
+   //
+   // \return The previous position of the iterator.
+   */
+   inline const SoAIterator operator--( int ) noexcept {
+      const SoAIterator tmp( *this );
+      --(*this);
+      return tmp;
+   }
+   //**********************************************************************************************
+
+   //**Element access operator*********************************************************************
+   /*!\brief Direct access to the element at the current iterator position.
+   //
+   // \return Proxy for the current element.
+   */
+   inline ReferenceType operator*() const noexcept {
+      return ReferenceType( value_, index_ );
+   }
+   //**********************************************************************************************
+
+   //**Element access operator*********************************************************************
+   /*!\brief Direct access to the element at the current iterator position.
+   //
+   // \return Proxy for the current element.
+   */
+   inline PointerType operator->() const noexcept {
+      return PointerType( value_, index_ );
+   }
+   //**********************************************************************************************
+
+   //**Subscript operator**************************************************************************
+   /*!\brief Direct access to the element at the given distance from the current position.
+   //
+   // \param n The distance to the accessed element.
+   // \return Proxy for the accessed element.
+   */
+   inline ReferenceType operator[]( size_t n ) const noexcept {
+      return ReferenceType( value_+n, index_+n );
+   }
+   //**********************************************************************************************
+
+   //**Value base function*************************************************************************
+   /*!\brief Access to the value array at the current iterator position.
+   //
+   // \return Pointer to the current value.
+   */
+   inline Type* valueBase() const noexcept {
+      return value_;
+   }
+   //**********************************************************************************************
+
+   //**Index base function*************************************************************************
+   /*!\brief Access to the index array at the current iterator position.
+   //
+   // \return Pointer to the current index.
+   */
+   inline const IT* indexBase() const noexcept {
+      return index_;
+   }
+   //**********************************************************************************************
+
+   //**Equality operator***************************************************************************
+   /*!\brief Equality comparison between two SoAIterator objects.
+   //
+   // \param lhs The left-hand side iterator.
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the iterators refer to the same element, \a false if not.
+   */
+   friend inline bool operator==( const SoAIterator& lhs, const SoAIterator& rhs ) noexcept {
+      return lhs.index_ == rhs.index_;
+   }
+   //**********************************************************************************************
+
+   //**Inequality operator*************************************************************************
+   /*!\brief Inequality comparison between two SoAIterator objects.
+   //
+   // \param lhs The left-hand side iterator.
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the iterators don't refer to the same element, \a false if they do.
+   */
+   friend inline bool operator!=( const SoAIterator& lhs, const SoAIterator& rhs ) noexcept {
+      return lhs.index_ != rhs.index_;
+   }
+   //**********************************************************************************************
+
+   //**Less-than operator**************************************************************************
+   /*!\brief Less-than comparison between two SoAIterator objects.
+   //
+   // \param lhs The left-hand side iterator.
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the left-hand side iterator is smaller, \a false if not.
+   */
+   friend inline bool operator<( const SoAIterator& lhs, const SoAIterator& rhs ) noexcept {
+      return lhs.index_ < rhs.index_;
+   }
+   //**********************************************************************************************
+
+   //**Greater-than operator***********************************************************************
+   /*!\brief Greater-than comparison between two SoAIterator objects.
+   //
+   // \param lhs The left-hand side iterator.
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the left-hand side iterator is greater, \a false if not.
+   */
+   friend inline bool operator>( const SoAIterator& lhs, const SoAIterator& rhs ) noexcept {
+      return lhs.index_ > rhs.index_;
+   }
+   //**********************************************************************************************
+
+   //**Less-or-equal-than operator*****************************************************************
+   /*!\brief Less-than comparison between two SoAIterator objects.
+   //
+   // \param lhs The left-hand side iterator.
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the left-hand side iterator is smaller or equal, \a false if not.
+   */
+   friend inline bool operator<=( const SoAIterator& lhs, const SoAIterator& rhs ) noexcept {
+      return lhs.index_ <= rhs.index_;
+   }
+   //**********************************************************************************************
+
+   //**Greater-or-equal-than operator**************************************************************
+   /*!\brief Greater-than comparison between two SoAIterator objects.
+   //
+   // \param lhs The left-hand side iterator.
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the left-hand side iterator is greater or equal, \a false if not.
+   */
+   friend inline bool operator>=( const SoAIterator& lhs, const SoAIterator& rhs ) noexcept {
+      return lhs.index_ >= rhs.index_;
+   }
+   //**********************************************************************************************
+
+   //**Subtraction operator************************************************************************
+   /*!\brief Calculating the number of elements between two iterators.
+   //
+   // \param rhs The right-hand side iterator.
+   // \return The number of elements between the two iterators.
+   */
+   inline DifferenceType operator-( const SoAIterator& rhs ) const noexcept {
+      return index_ - rhs.index_;
+   }
+   //**********************************************************************************************
+
+   //**Addition operator***************************************************************************
+   /*!\brief Addition between a SoAIterator and an integral value.
+   //
+   // \param it The iterator to be incremented.
+   // \param inc The number of elements the iterator is incremented.
+   // \return The incremented iterator.
+   */
+   friend inline const SoAIterator operator+( const SoAIterator& it, size_t inc ) noexcept {
+      return SoAIterator( it.value_ + inc, it.index_ + inc );
+   }
+   //**********************************************************************************************
+
+   //**Addition operator***************************************************************************
+   /*!\brief Addition between an integral value and a SoAIterator.
+   //
+   // \param inc The number of elements the iterator is incremented.
+   // \param it The iterator to be incremented.
+   // \return The incremented iterator.
+   */
+   friend inline const SoAIterator operator+( size_t inc, const SoAIterator& it ) noexcept {
+      return SoAIterator( it.value_ + inc, it.index_ + inc );
+   }
+   //**********************************************************************************************
+
+   //**Subtraction operator************************************************************************
+   /*!\brief Subtraction between a SoAIterator and an integral value.
+   //
+   // \param it The iterator to be decremented.
+   // \param dec The number of elements the iterator is decremented.
+   // \return The decremented iterator.
+   */
+   friend inline const SoAIterator operator-( const SoAIterator& it, size_t dec ) noexcept {
+      return SoAIterator( it.value_ - dec, it.index_ - dec );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   Type*     value_;  //!< Pointer to the current value.
+   const IT* index_;  //!< Pointer to the current index.
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISSOAITERATOR SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename Type, typename IT >
+struct IsSoAIterator< SoAIterator<Type,IT> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -63,11 +63,12 @@ namespace blaze {
 template< typename T >  // Type of the operand
 using HasSIMDExpHelper =
    BoolConstant< ( IsFloat_v<T> || IsDouble_v<T> ) &&
-                 bool( BLAZE_SVML_MODE ) &&
-                 ( bool( BLAZE_SSE_MODE     ) ||
-                   bool( BLAZE_AVX_MODE     ) ||
-                   bool( BLAZE_MIC_MODE     ) ||
-                   bool( BLAZE_AVX512F_MODE ) ) >;
+                 ( ( bool( BLAZE_SVML_MODE ) &&
+                     ( bool( BLAZE_SSE_MODE     ) ||
+                       bool( BLAZE_AVX_MODE     ) ||
+                       bool( BLAZE_MIC_MODE     ) ||
+                       bool( BLAZE_AVX512F_MODE ) ) ) ||
+                   bool( BLAZE_SIMD_MATH_MODE ) ) >;
 /*! \endcond */
 //*************************************************************************************************
 
@@ -0,0 +1,124 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/typetraits/HasSIMDGather.h
+//  \brief Header file for the HasSIMDGather type trait
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_TYPETRAITS_HASSIMDGATHER_H_
+#define _BLAZE_MATH_TYPETRAITS_HASSIMDGATHER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/typetraits/HasSize.h>
+#include <blaze/util/typetraits/IsDouble.h>
+#include <blaze/util/typetraits/IsFloat.h>
+#include <blaze/util/typetraits/IsIntegral.h>
+#include <blaze/util/typetraits/RemoveCVRef.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary alias declaration for the HasSIMDGather type trait.
+// \ingroup math_type_traits
+*/
+template< typename T     // Type of the gathered values
+        , typename IT >  // Type of the indices
+using HasSIMDGatherHelper =
+   BoolConstant< ( IsFloat_v<T> || IsDouble_v<T> ) &&
+                 IsIntegral_v<IT> && ( HasSize_v<IT,4UL> || HasSize_v<IT,8UL> ) &&
+                 ( bool( BLAZE_AVX2_MODE ) || bool( BLAZE_AVX512F_MODE ) ) >;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Availability of a SIMD gather operation for the given data and index type.
+// \ingroup math_type_traits
+//
+// Depending on the available instruction set (SSE, SSE2, SSE3, SSE4, AVX, AVX2, MIC, ...) and
+// the used compiler, this type trait provides the information whether a SIMD gather operation
+// exists for values of type \a T (ignoring the cv-qualifiers) that are addressed via indices
+// of type \a IT. In case the SIMD operation is available, the \a value member constant is set
+// to \a true, the nested type definition \a Type is \a TrueType, and the class derives from
+// \a TrueType. Otherwise \a value is set to \a false, \a Type is \a FalseType, and the class
+// derives from \a FalseType. The following example assumes that AVX2 is available:
+
+   \code
+   blaze::HasSIMDGather< float, uint32_t >::value   // Evaluates to 1
+   blaze::HasSIMDGather< double, size_t >::Type     // Results in TrueType
+   blaze::HasSIMDGather< const double, uint32_t >   // Is derived from TrueType
+   blaze::HasSIMDGather< int, size_t >::value       // Evaluates to 0
+   blaze::HasSIMDGather< double, uint16_t >::Type   // Results in FalseType
+   blaze::HasSIMDGather< complex<double>, size_t >  // Is derived from FalseType
+   \endcode
+*/
+template< typename T     // Type of the gathered values
+        , typename IT >  // Type of the indices
+struct HasSIMDGather
+   : public BoolConstant< HasSIMDGatherHelper< RemoveCVRef_t<T>, RemoveCVRef_t<IT> >::value >
+{};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Auxiliary variable template for the HasSIMDGather type trait.
+// \ingroup math_type_traits
+//
+// The HasSIMDGather_v variable template provides a convenient shortcut to access the nested
+// \a value of the HasSIMDGather class template. For instance, given the types \a T and \a IT
+// the following two statements are identical:
+
+   \code
+   constexpr bool value1 = blaze::HasSIMDGather<T,IT>::value;
+   constexpr bool value2 = blaze::HasSIMDGather_v<T,IT>;
+   \endcode
+*/
+template< typename T     // Type of the gathered values
+        , typename IT >  // Type of the indices
+constexpr bool HasSIMDGather_v = HasSIMDGather<T,IT>::value;
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
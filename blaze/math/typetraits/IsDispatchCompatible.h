@@ -0,0 +1,102 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/typetraits/IsDispatchCompatible.h
+//  \brief Header file for the IsDispatchCompatible type trait
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_TYPETRAITS_ISDISPATCHCOMPATIBLE_H_
+#define _BLAZE_MATH_TYPETRAITS_ISDISPATCHCOMPATIBLE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/typetraits/IsDouble.h>
+#include <blaze/util/typetraits/IsFloat.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compile time check for data types.
+// \ingroup math_type_traits
+//
+// This type trait tests whether or not the given template parameter is a data type supported
+// by the runtime instruction set dispatch (see the BLAZE_USE_RUNTIME_DISPATCH switch). The
+// dispatched kernels are available for \c float and \c double values. If the type is supported,
+// the \a value member constant is set to \a true, the nested type definition \a Type is
+// \a TrueType, and the class derives from \a TrueType. Otherwise \a value is set to \a false,
+// \a Type is \a FalseType, and the class derives from \a FalseType.
+
+   \code
+   blaze::IsDispatchCompatible< float >::value         // Evaluates to 1
+   blaze::IsDispatchCompatible< double >::Type         // Results in TrueType
+   blaze::IsDispatchCompatible< const double >         // Is derived from TrueType
+   blaze::IsDispatchCompatible< int >::value           // Evaluates to 0
+   blaze::IsDispatchCompatible< complex<float> >::Type // Results in FalseType
+   blaze::IsDispatchCompatible< long double >          // Is derived from FalseType
+   \endcode
+*/
+template< typename T >
+struct IsDispatchCompatible
+   : public BoolConstant< IsFloat_v<T> || IsDouble_v<T> >
+{};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Auxiliary variable template for the IsDispatchCompatible type trait.
+// \ingroup math_type_traits
+//
+// The IsDispatchCompatible_v variable template provides a convenient shortcut to access the
+// nested \a value of the IsDispatchCompatible class template. For instance, given the type \a T
+// the following two statements are identical:
+
+   \code
+   constexpr bool value1 = blaze::IsDispatchCompatible<T>::value;
+   constexpr bool value2 = blaze::IsDispatchCompatible_v<T>;
+   \endcode
+*/
+template< typename T >
+constexpr bool IsDispatchCompatible_v = IsDispatchCompatible<T>::value;
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
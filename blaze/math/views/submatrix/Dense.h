@@ -114,6 +114,68 @@
 
 namespace blaze {
 
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checks the SIMD alignment of a dense submatrix of a contiguous dense matrix.
+// \ingroup submatrix
+//
+// \param matrix The dense matrix containing the submatrix.
+// \param row The index of the first row of the submatrix.
+// \param column The index of the first column of the submatrix.
+// \param n The number of rows (row-major) or columns (column-major) of the submatrix.
+// \return \a true in case the submatrix is properly aligned, \a false if not.
+*/
+template< bool SO         // Storage order of the submatrix
+        , typename MT >   // Type of the dense matrix
+inline EnableIf_t< IsContiguous_v<MT>, bool >
+   checkSubmatrixAlignment( const MT& matrix, size_t row, size_t column, size_t n ) noexcept
+{
+   constexpr size_t SIMDSIZE( SIMDTrait< ElementType_t<MT> >::size );
+
+   const auto* ptr( SO ? matrix.data() + row + column*matrix.spacing()
+                       : matrix.data() + row*matrix.spacing() + column );
+
+   return checkAlignment( ptr ) && ( n < 2UL || ( matrix.spacing() % SIMDSIZE ) == 0UL );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checks the SIMD alignment of a dense submatrix of a non-contiguous dense matrix.
+// \ingroup submatrix
+//
+// \param matrix The dense matrix containing the submatrix.
+// \param row The index of the first row of the submatrix.
+// \param column The index of the first column of the submatrix.
+// \param n The number of rows (row-major) or columns (column-major) of the submatrix.
+// \return \a false.
+//
+// Dense matrices without contiguous rows/columns (as for instance packed matrices) do not
+// provide a spacing and are never accessed via SIMD operations.
+*/
+template< bool SO         // Storage order of the submatrix
+        , typename MT >   // Type of the dense matrix
+inline DisableIf_t< IsContiguous_v<MT>, bool >
+   checkSubmatrixAlignment( const MT& matrix, size_t row, size_t column, size_t n ) noexcept
+{
+   MAYBE_UNUSED( matrix, row, column, n );
+
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  CLASS TEMPLATE SPECIALIZATION FOR UNALIGNED ROW-MAJOR DENSE SUBMATRICES
@@ -884,9 +946,8 @@ template< typename... RSAs >  // Runtime submatrix arguments
 inline Submatrix<MT,unaligned,false,true,CSAs...>::Submatrix( MT& matrix, RSAs... args )
    : DataType  ( args... )  // Base class initialization
    , matrix_   ( matrix  )  // The matrix containing the submatrix
-   , isAligned_( simdEnabled && IsContiguous_v<MT> &&
-                 matrix.data() != nullptr && checkAlignment( data() ) &&
-                 ( rows() < 2UL || ( matrix.spacing() % SIMDSIZE ) == 0UL ) )
+   , isAligned_( simdEnabled && IsContiguous_v<MT> && matrix.data() != nullptr &&
+                 checkSubmatrixAlignment<false>( matrix, row(), column(), rows() ) )
 {
    if( !Contains_v< TypeList<RSAs...>, Unchecked > ) {
       if( ( row() + rows() > matrix_.rows() ) || ( column() + columns() > matrix_.columns() ) ) {
@@ -4158,9 +4219,8 @@ template< typename... RSAs >  // Runtime submatrix arguments
 inline Submatrix<MT,unaligned,true,true,CSAs...>::Submatrix( MT& matrix, RSAs... args )
    : DataType  ( args... )  // Base class initialization
    , matrix_   ( matrix  )  // The matrix containing the submatrix
-   , isAligned_( simdEnabled && IsContiguous_v<MT> &&
-                 matrix.data() != nullptr && checkAlignment( data() ) &&
-                 ( columns() < 2UL || ( matrix.spacing() % SIMDSIZE ) == 0UL ) )
+   , isAligned_( simdEnabled && IsContiguous_v<MT> && matrix.data() != nullptr &&
+                 checkSubmatrixAlignment<true>( matrix, row(), column(), columns() ) )
 {
    if( !Contains_v< TypeList<RSAs...>, Unchecked > ) {
       if( ( row() + rows() > matrix_.rows() ) || ( column() + columns() > matrix_.columns() ) ) {
@@ -6978,8 +7038,7 @@ inline Submatrix<MT,aligned,false,true,CSAs...>::Submatrix( MT& matrix, RSAs...
       }
 
       if( simdEnabled && IsContiguous_v<MT> &&
-          ( !checkAlignment( data() ) ||
-            ( rows() > 1UL && matrix_.spacing() % SIMDSIZE != 0UL ) ) ) {
+          !checkSubmatrixAlignment<false>( matrix_, row(), column(), rows() ) ) {
          BLAZE_THROW_INVALID_ARGUMENT( "Invalid submatrix alignment" );
       }
    }
@@ -6988,8 +7047,7 @@ inline Submatrix<MT,aligned,false,true,CSAs...>::Submatrix( MT& matrix, RSAs...
       BLAZE_USER_ASSERT( row()    + rows()    <= matrix_.rows()   , "Invalid submatrix specification" );
       BLAZE_USER_ASSERT( column() + columns() <= matrix_.columns(), "Invalid submatrix specification" );
 
-      BLAZE_USER_ASSERT( !simdEnabled || !IsContiguous_v<MT> || checkAlignment( data() ), "Invalid submatrix alignment" );
-      BLAZE_USER_ASSERT( !simdEnabled || !IsContiguous_v<MT> || rows() <= 1UL || matrix_.spacing() % SIMDSIZE == 0UL, "Invalid submatrix alignment" );
+      BLAZE_USER_ASSERT( !simdEnabled || !IsContiguous_v<MT> || checkSubmatrixAlignment<false>( matrix_, row(), column(), rows() ), "Invalid submatrix alignment" );
    }
 }
 /*! \endcond */
@@ -9833,8 +9891,7 @@ inline Submatrix<MT,aligned,true,true,CSAs...>::Submatrix( MT& matrix, RSAs... a
       }
 
       if( simdEnabled && IsContiguous_v<MT> &&
-          ( !checkAlignment( data() ) ||
-            ( columns() > 1UL && matrix_.spacing() % SIMDSIZE != 0UL ) ) ) {
+          !checkSubmatrixAlignment<true>( matrix_, row(), column(), columns() ) ) {
          BLAZE_THROW_INVALID_ARGUMENT( "Invalid submatrix alignment" );
       }
    }
@@ -9843,8 +9900,7 @@ inline Submatrix<MT,aligned,true,true,CSAs...>::Submatrix( MT& matrix, RSAs... a
       BLAZE_USER_ASSERT( row()    + rows()    <= matrix_.rows()   , "Invalid submatrix specification" );
       BLAZE_USER_ASSERT( column() + columns() <= matrix_.columns(), "Invalid submatrix specification" );
 
-      BLAZE_USER_ASSERT( !simdEnabled || !IsContiguous_v<MT> || checkAlignment( data() ), "Invalid submatrix alignment" );
-      BLAZE_USER_ASSERT( !simdEnabled || !IsContiguous_v<MT> || columns() <= 1UL || matrix_.spacing() % SIMDSIZE == 0UL, "Invalid submatrix alignment" );
+      BLAZE_USER_ASSERT( !simdEnabled || !IsContiguous_v<MT> || checkSubmatrixAlignment<true>( matrix_, row(), column(), columns() ), "Invalid submatrix alignment" );
    }
 }
 /*! \endcond */
@@ -59,6 +59,8 @@ constexpr size_t DEFAULT_BLOCK_SIZE = 256UL;
 
 constexpr size_t MMM_DEFAULT_OUTER_BLOCK_SIZE = 112UL;
 constexpr size_t MMM_DEFAULT_INNER_BLOCK_SIZE =  96UL;
+
+constexpr size_t REDUCTION_DEFAULT_BLOCK_SIZE = 8192UL;
 /*! \endcond */
 //*************************************************************************************************
 
@@ -69,6 +71,8 @@ constexpr size_t DEBUG_BLOCK_SIZE = 8UL;
 
 constexpr size_t MMM_DEBUG_OUTER_BLOCK_SIZE = 16UL;
 constexpr size_t MMM_DEBUG_INNER_BLOCK_SIZE = 16UL;
+
+constexpr size_t REDUCTION_DEBUG_BLOCK_SIZE = 64UL;
 /*! \endcond */
 //*************************************************************************************************
 
@@ -79,6 +83,8 @@ constexpr size_t BLOCK_SIZE = ( BLAZE_DEBUG_MODE ? DEBUG_BLOCK_SIZE : DEFAULT_BL
 
 constexpr size_t MMM_OUTER_BLOCK_SIZE = ( BLAZE_DEBUG_MODE ? MMM_DEBUG_OUTER_BLOCK_SIZE : MMM_DEFAULT_OUTER_BLOCK_SIZE );
 constexpr size_t MMM_INNER_BLOCK_SIZE = ( BLAZE_DEBUG_MODE ? MMM_DEBUG_INNER_BLOCK_SIZE : MMM_DEFAULT_INNER_BLOCK_SIZE );
+
+constexpr size_t REDUCTION_BLOCK_SIZE = ( BLAZE_DEBUG_MODE ? REDUCTION_DEBUG_BLOCK_SIZE : REDUCTION_DEFAULT_BLOCK_SIZE );
 /*! \endcond */
 //*************************************************************************************************
 
@@ -102,6 +108,8 @@ BLAZE_STATIC_ASSERT( blaze::BLOCK_SIZE >= 4UL );
 BLAZE_STATIC_ASSERT( blaze::MMM_OUTER_BLOCK_SIZE >= 16UL && blaze::MMM_OUTER_BLOCK_SIZE % 16UL == 0UL );
 BLAZE_STATIC_ASSERT( blaze::MMM_INNER_BLOCK_SIZE >= 16UL && blaze::MMM_INNER_BLOCK_SIZE % 16UL == 0UL );
 
+BLAZE_STATIC_ASSERT( blaze::REDUCTION_BLOCK_SIZE >= 64UL && blaze::REDUCTION_BLOCK_SIZE % 64UL == 0UL );
+
 }
 /*! \endcond */
 //*************************************************************************************************
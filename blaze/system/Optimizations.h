@@ -53,9 +53,11 @@ namespace blaze {
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-constexpr bool useStreaming             = BLAZE_USE_STREAMING;
-constexpr bool useOptimizedKernels      = BLAZE_USE_OPTIMIZED_KERNELS;
-constexpr bool useDefaultInitialization = BLAZE_USE_DEFAULT_INITIALIZATION;
+constexpr bool useStreaming                  = BLAZE_USE_STREAMING;
+constexpr bool useOptimizedKernels           = BLAZE_USE_OPTIMIZED_KERNELS;
+constexpr bool usePackedMatrixMultiplication = BLAZE_USE_PACKED_MATRIX_MULTIPLICATION;
+constexpr bool useMatrixChainReordering      = BLAZE_USE_MATRIX_CHAIN_REORDERING;
+constexpr bool useDefaultInitialization      = BLAZE_USE_DEFAULT_INITIALIZATION;
 /*! \endcond */
 //*************************************************************************************************
 
@@ -95,6 +95,17 @@
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+#if defined(__linux__)
+#  define BLAZE_LINUX_PLATFORM 1
+#else
+#  define BLAZE_LINUX_PLATFORM 0
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -0,0 +1,775 @@
+//=================================================================================================
+/*!
+//  \file blaze/system/RuntimeThresholds.h
+//  \brief Header file for the runtime threshold table
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_SYSTEM_RUNTIMETHRESHOLDS_H_
+#define _BLAZE_SYSTEM_RUNTIMETHRESHOLDS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/config/Thresholds.h>
+#include <blaze/util/Types.h>
+
+#if BLAZE_USE_RUNTIME_THRESHOLDS
+#  include <algorithm>
+#  include <atomic>
+#  include <cstdlib>
+#  include <cstring>
+#  include <fstream>
+#  include <limits>
+#  include <sstream>
+#  include <string>
+#  include <blaze/util/Exception.h>
+#  include <blaze/util/NonCopyable.h>
+#endif
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  THRESHOLD IDENTIFIERS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Identifiers of all thresholds of the Blaze library.
+// \ingroup system
+//
+// Every threshold of the Blaze library (see <tt><blaze/config/Thresholds.h></tt>) is uniquely
+// identified by one of these identifiers. In case the runtime thresholds are enabled via the
+// BLAZE_USE_RUNTIME_THRESHOLDS switch, the identifier is used to look up the current value of
+// the threshold in the runtime threshold table.
+*/
+enum class ThresholdID : size_t
+{
+   DMATDVECMULT = 0,
+   TDMATDVECMULT,
+   TDVECDMATMULT,
+   TDVECTDMATMULT,
+   DMATDMATMULT,
+   DMATTDMATMULT,
+   TDMATDMATMULT,
+   TDMATTDMATMULT,
+   DMATSMATMULT,
+   TDMATSMATMULT,
+   TSMATDMATMULT,
+   TSMATTDMATMULT,
+   SMP_DVECASSIGN,
+   SMP_DVECSCALARMULT,
+   SMP_DVECDVECADD,
+   SMP_DVECDVECSUB,
+   SMP_DVECDVECMULT,
+   SMP_DVECDVECDIV,
+   SMP_DVECDVECOUTER,
+   SMP_DMATDVECMULT,
+   SMP_TDMATDVECMULT,
+   SMP_TDVECDMATMULT,
+   SMP_TDVECTDMATMULT,
+   SMP_DMATSVECMULT,
+   SMP_TDMATSVECMULT,
+   SMP_TSVECDMATMULT,
+   SMP_TSVECTDMATMULT,
+   SMP_SMATDVECMULT,
+   SMP_TSMATDVECMULT,
+   SMP_TDVECSMATMULT,
+   SMP_TDVECTSMATMULT,
+   SMP_SMATSVECMULT,
+   SMP_TSMATSVECMULT,
+   SMP_TSVECSMATMULT,
+   SMP_TSVECTSMATMULT,
+   SMP_DMATASSIGN,
+   SMP_DMATSCALARMULT,
+   SMP_DMATDMATADD,
+   SMP_DMATTDMATADD,
+   SMP_DMATDMATSUB,
+   SMP_DMATTDMATSUB,
+   SMP_DMATDMATSCHUR,
+   SMP_DMATTDMATSCHUR,
+   SMP_DMATDMATMULT,
+   SMP_DMATTDMATMULT,
+   SMP_TDMATDMATMULT,
+   SMP_TDMATTDMATMULT,
+   SMP_DMATSMATMULT,
+   SMP_DMATTSMATMULT,
+   SMP_TDMATSMATMULT,
+   SMP_TDMATTSMATMULT,
+   SMP_SMATDMATMULT,
+   SMP_SMATTDMATMULT,
+   SMP_TSMATDMATMULT,
+   SMP_TSMATTDMATMULT,
+   SMP_SMATSMATMULT,
+   SMP_SMATTSMATMULT,
+   SMP_TSMATSMATMULT,
+   SMP_TSMATTSMATMULT,
+   SMP_DMATREDUCE,
+   SMP_SMATREDUCE,
+   SMP_DMATBATCH,
+   SMP_SMATASSIGN,
+   SMP_DVECREDUCE,
+   SMP_DVECDVECINNER,
+   SMP_DMATTOTALREDUCE
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The total number of thresholds of the Blaze library.
+// \ingroup system
+*/
+constexpr size_t thresholdCount = static_cast<size_t>( ThresholdID::SMP_DMATTOTALREDUCE ) + 1UL;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the name of the given threshold.
+// \ingroup system
+//
+// \param id The identifier of the threshold.
+// \return The name of the threshold (as for instance "SMP_DVECASSIGN_THRESHOLD").
+*/
+inline const char* thresholdName( ThresholdID id ) noexcept
+{
+   static constexpr const char* names[thresholdCount] = {
+   "DMATDVECMULT_THRESHOLD",
+   "TDMATDVECMULT_THRESHOLD",
+   "TDVECDMATMULT_THRESHOLD",
+   "TDVECTDMATMULT_THRESHOLD",
+   "DMATDMATMULT_THRESHOLD",
+   "DMATTDMATMULT_THRESHOLD",
+   "TDMATDMATMULT_THRESHOLD",
+   "TDMATTDMATMULT_THRESHOLD",
+   "DMATSMATMULT_THRESHOLD",
+   "TDMATSMATMULT_THRESHOLD",
+   "TSMATDMATMULT_THRESHOLD",
+   "TSMATTDMATMULT_THRESHOLD",
+   "SMP_DVECASSIGN_THRESHOLD",
+   "SMP_DVECSCALARMULT_THRESHOLD",
+   "SMP_DVECDVECADD_THRESHOLD",
+   "SMP_DVECDVECSUB_THRESHOLD",
+   "SMP_DVECDVECMULT_THRESHOLD",
+   "SMP_DVECDVECDIV_THRESHOLD",
+   "SMP_DVECDVECOUTER_THRESHOLD",
+   "SMP_DMATDVECMULT_THRESHOLD",
+   "SMP_TDMATDVECMULT_THRESHOLD",
+   "SMP_TDVECDMATMULT_THRESHOLD",
+   "SMP_TDVECTDMATMULT_THRESHOLD",
+   "SMP_DMATSVECMULT_THRESHOLD",
+   "SMP_TDMATSVECMULT_THRESHOLD",
+   "SMP_TSVECDMATMULT_THRESHOLD",
+   "SMP_TSVECTDMATMULT_THRESHOLD",
+   "SMP_SMATDVECMULT_THRESHOLD",
+   "SMP_TSMATDVECMULT_THRESHOLD",
+   "SMP_TDVECSMATMULT_THRESHOLD",
+   "SMP_TDVECTSMATMULT_THRESHOLD",
+   "SMP_SMATSVECMULT_THRESHOLD",
+   "SMP_TSMATSVECMULT_THRESHOLD",
+   "SMP_TSVECSMATMULT_THRESHOLD",
+   "SMP_TSVECTSMATMULT_THRESHOLD",
+   "SMP_DMATASSIGN_THRESHOLD",
+   "SMP_DMATSCALARMULT_THRESHOLD",
+   "SMP_DMATDMATADD_THRESHOLD",
+   "SMP_DMATTDMATADD_THRESHOLD",
+   "SMP_DMATDMATSUB_THRESHOLD",
+   "SMP_DMATTDMATSUB_THRESHOLD",
+   "SMP_DMATDMATSCHUR_THRESHOLD",
+   "SMP_DMATTDMATSCHUR_THRESHOLD",
+   "SMP_DMATDMATMULT_THRESHOLD",
+   "SMP_DMATTDMATMULT_THRESHOLD",
+   "SMP_TDMATDMATMULT_THRESHOLD",
+   "SMP_TDMATTDMATMULT_THRESHOLD",
+   "SMP_DMATSMATMULT_THRESHOLD",
+   "SMP_DMATTSMATMULT_THRESHOLD",
+   "SMP_TDMATSMATMULT_THRESHOLD",
+   "SMP_TDMATTSMATMULT_THRESHOLD",
+   "SMP_SMATDMATMULT_THRESHOLD",
+   "SMP_SMATTDMATMULT_THRESHOLD",
+   "SMP_TSMATDMATMULT_THRESHOLD",
+   "SMP_TSMATTDMATMULT_THRESHOLD",
+   "SMP_SMATSMATMULT_THRESHOLD",
+   "SMP_SMATTSMATMULT_THRESHOLD",
+   "SMP_TSMATSMATMULT_THRESHOLD",
+   "SMP_TSMATTSMATMULT_THRESHOLD",
+   "SMP_DMATREDUCE_THRESHOLD",
+   "SMP_SMATREDUCE_THRESHOLD",
+   "SMP_DMATBATCH_THRESHOLD",
+   "SMP_SMATASSIGN_THRESHOLD",
+   "SMP_DVECREDUCE_THRESHOLD",
+   "SMP_DVECDVECINNER_THRESHOLD",
+   "SMP_DMATTOTALREDUCE_THRESHOLD"
+   };
+
+   return names[ static_cast<size_t>( id ) ];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+#if BLAZE_USE_RUNTIME_THRESHOLDS
+//=================================================================================================
+//
+//  CLASS THRESHOLDTABLE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Table of all runtime thresholds.
+// \ingroup system
+//
+// The ThresholdTable class stores the values of all thresholds that have been set at runtime.
+// Thresholds that have not been set explicitly are represented by the \c unset value, in which
+// case the compile time default of the threshold is used. All accesses to the table are atomic
+// and can therefore be performed concurrently.
+//
+// On first use the table is initialized from the threshold file specified via the
+// \c BLAZE_THRESHOLDS_FILE environment variable (if any, see the loadThresholds() function).
+*/
+class ThresholdTable
+   : private NonCopyable
+{
+ public:
+   //**Constants***********************************************************************************
+   static constexpr size_t unset = ~size_t(0);  //!< Value of a threshold that has not been set.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline ThresholdTable();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t get  ( ThresholdID id ) const noexcept;
+   inline void   set  ( ThresholdID id, size_t value ) noexcept;
+   inline void   reset() noexcept;
+   inline void   load ( const std::string& file );
+   inline void   save ( const std::string& file ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::atomic<size_t> values_[thresholdCount];  //!< The runtime values of all thresholds.
+   //@}
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The constructor of the ThresholdTable class.
+//
+// The constructor initializes the table from the threshold file specified via the
+// \c BLAZE_THRESHOLDS_FILE environment variable. In case the environment variable is not
+// defined, in case the file cannot be opened or in case the file is malformed, all thresholds
+// keep their compile time defaults.
+*/
+#if (defined _MSC_VER)
+#  pragma warning(push)
+#  pragma warning(disable:4996)
+#endif
+inline ThresholdTable::ThresholdTable()
+{
+   reset();
+
+   const char* env = std::getenv( "BLAZE_THRESHOLDS_FILE" );
+
+   if( env != nullptr && std::strlen( env ) > 0UL && std::ifstream( env ).good() ) {
+      try {
+         load( env );
+      }
+      catch( std::exception& ) {
+         reset();
+      }
+   }
+}
+#if (defined _MSC_VER)
+#  pragma warning(pop)
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the runtime value of the given threshold.
+//
+// \param id The identifier of the threshold.
+// \return The runtime value of the threshold or \c unset in case the threshold has not been set.
+*/
+inline size_t ThresholdTable::get( ThresholdID id ) const noexcept
+{
+   return values_[ static_cast<size_t>( id ) ].load( std::memory_order_relaxed );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the runtime value of the given threshold.
+//
+// \param id The identifier of the threshold.
+// \param value The new value of the threshold (\c unset to restore the compile time default).
+// \return void
+*/
+inline void ThresholdTable::set( ThresholdID id, size_t value ) noexcept
+{
+   values_[ static_cast<size_t>( id ) ].store( value, std::memory_order_relaxed );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Restoring the compile time defaults of all thresholds.
+//
+// \return void
+*/
+inline void ThresholdTable::reset() noexcept
+{
+   for( std::atomic<size_t>& value : values_ ) {
+      value.store( unset, std::memory_order_relaxed );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Loading threshold values from the given file.
+//
+// \param file The name of the threshold file.
+// \return void
+// \exception std::runtime_error Threshold file could not be opened or read.
+// \exception std::invalid_argument Invalid threshold file.
+//
+// This function reads all thresholds from the given file, which contains one threshold per
+// line in the form \c NAME \c VALUE. Empty lines and lines starting with \c # are ignored.
+// Thresholds that are not contained in the file are not modified. The file is completely
+// parsed and validated before any threshold is modified, i.e. in case the file contains an
+// unknown threshold name or an invalid value, an exception is thrown and the table remains
+// unchanged.
+*/
+inline void ThresholdTable::load( const std::string& file )
+{
+   std::ifstream in( file.c_str() );
+
+   if( !in ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Threshold file could not be opened" );
+   }
+
+   size_t values[thresholdCount];
+   std::fill( values, values+thresholdCount, unset );
+
+   std::string line;
+
+   while( std::getline( in, line ) )
+   {
+      std::istringstream iss( line );
+      std::string name, token, rest;
+
+      if( !( iss >> name ) || name[0] == '#' )
+         continue;
+
+      if( !( iss >> token ) || ( iss >> rest ) ||
+          token.find_first_not_of( "0123456789" ) != std::string::npos ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid threshold file" );
+      }
+
+      std::istringstream tss( token );
+      size_t value( 0UL );
+
+      if( !( tss >> value ) || value == unset ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid threshold value" );
+      }
+
+      size_t i( 0UL );
+      while( i < thresholdCount && name != thresholdName( static_cast<ThresholdID>( i ) ) ) {
+         ++i;
+      }
+
+      if( i == thresholdCount ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Unknown threshold name" );
+      }
+
+      values[i] = value;
+   }
+
+   if( in.bad() ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Threshold file could not be read" );
+   }
+
+   for( size_t i=0UL; i<thresholdCount; ++i ) {
+      if( values[i] != unset ) {
+         set( static_cast<ThresholdID>( i ), values[i] );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writing all thresholds that have been set at runtime to the given file.
+//
+// \param file The name of the threshold file.
+// \return void
+// \exception std::runtime_error Threshold file could not be written.
+*/
+inline void ThresholdTable::save( const std::string& file ) const
+{
+   std::ofstream out( file.c_str() );
+
+   out << "# Blaze runtime thresholds\n";
+
+   for( size_t i=0UL; i<thresholdCount; ++i ) {
+      const size_t value( get( static_cast<ThresholdID>( i ) ) );
+      if( value != unset ) {
+         out << thresholdName( static_cast<ThresholdID>( i ) ) << " " << value << "\n";
+      }
+   }
+
+   if( !out ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Threshold file could not be written" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the runtime threshold table.
+// \ingroup system
+//
+// \return Reference to the runtime threshold table.
+*/
+inline ThresholdTable& theThresholdTable()
+{
+   static ThresholdTable table;
+   return table;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS RUNTIMETHRESHOLD
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Threshold that can be adapted at runtime.
+// \ingroup system
+//
+// In case the runtime thresholds are enabled via the BLAZE_USE_RUNTIME_THRESHOLDS switch, all
+// thresholds of the Blaze library (as for instance blaze::SMP_DVECASSIGN_THRESHOLD) are
+// represented by a RuntimeThreshold. The conversion to \c size_t returns the current runtime
+// value of the threshold or, if the threshold has not been set at runtime, the compile time
+// default. Therefore all thresholds can be used exactly as their compile time counterparts.
+*/
+class RuntimeThreshold
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   /*!\brief Constructor for a threshold with the given identifier and default value.
+   //
+   // \param id The identifier of the threshold.
+   // \param value The compile time default of the threshold.
+   */
+   constexpr RuntimeThreshold( ThresholdID id, size_t value ) noexcept
+      : id_     ( id    )  // The identifier of the threshold
+      , default_( value )  // The compile time default of the threshold
+   {}
+   //@}
+   //**********************************************************************************************
+
+   //**Conversion operator*************************************************************************
+   /*!\name Conversion operator */
+   //@{
+   /*!\brief Conversion to the current value of the threshold.
+   //
+   // \return The current value of the threshold.
+   */
+   inline operator size_t() const noexcept {
+      return value();
+   }
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   /*!\brief Returns the current value of the threshold.
+   //
+   // \return The current value of the threshold.
+   */
+   inline size_t value() const noexcept {
+      const size_t value( theThresholdTable().get( id_ ) );
+      return ( value != ThresholdTable::unset ? value : default_ );
+   }
+
+   /*!\brief Returns the identifier of the threshold.
+   //
+   // \return The identifier of the threshold.
+   */
+   constexpr ThresholdID id() const noexcept {
+      return id_;
+   }
+
+   /*!\brief Returns the compile time default of the threshold.
+   //
+   // \return The compile time default of the threshold.
+   */
+   constexpr size_t defaultValue() const noexcept {
+      return default_;
+   }
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   ThresholdID id_;  //!< The identifier of the threshold.
+   size_t default_;  //!< The compile time default of the threshold.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Runtime threshold functions */
+//@{
+inline void setThreshold( const RuntimeThreshold& threshold, size_t value );
+inline void resetThreshold( const RuntimeThreshold& threshold ) noexcept;
+inline void resetThresholds() noexcept;
+inline void loadThresholds( const std::string& file );
+inline void saveThresholds( const std::string& file );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the runtime value of the given threshold.
+// \ingroup system
+//
+// \param threshold The threshold to be set.
+// \param value The new value of the threshold.
+// \return void
+// \exception std::invalid_argument Invalid threshold value.
+//
+// This function sets the value of the given threshold for all subsequent operations:
+
+   \code
+   blaze::setThreshold( blaze::SMP_DVECASSIGN_THRESHOLD, 100000UL );
+   \endcode
+
+// In case the given value is not a valid threshold value, a \a std::invalid_argument exception
+// is thrown.
+*/
+inline void setThreshold( const RuntimeThreshold& threshold, size_t value )
+{
+   if( value == ThresholdTable::unset ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid threshold value" );
+   }
+
+   theThresholdTable().set( threshold.id(), value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Restoring the compile time default of the given threshold.
+// \ingroup system
+//
+// \param threshold The threshold to be reset.
+// \return void
+*/
+inline void resetThreshold( const RuntimeThreshold& threshold ) noexcept
+{
+   theThresholdTable().set( threshold.id(), ThresholdTable::unset );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Restoring the compile time defaults of all thresholds.
+// \ingroup system
+//
+// \return void
+*/
+inline void resetThresholds() noexcept
+{
+   theThresholdTable().reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Loading threshold values from the given file.
+// \ingroup system
+//
+// \param file The name of the threshold file.
+// \return void
+// \exception std::runtime_error Threshold file could not be opened or read.
+// \exception std::invalid_argument Invalid threshold file.
+//
+// This function reads threshold values from the given file (as for instance written by the
+// saveThresholds() or the calibrateThresholds() function). The file contains one threshold per
+// line in the form \c NAME \c VALUE:
+
+   \code
+   # Blaze runtime thresholds
+   SMP_DVECASSIGN_THRESHOLD 52000
+   SMP_DMATDVECMULT_THRESHOLD 1100
+   \endcode
+
+// Empty lines and comments are ignored. Thresholds that are not listed in the file keep their
+// current value. In case the file contains an unknown threshold name or an invalid threshold
+// value, a \a std::invalid_argument exception is thrown and none of the thresholds is modified.
+*/
+inline void loadThresholds( const std::string& file )
+{
+   theThresholdTable().load( file );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writing all thresholds that have been set at runtime to the given file.
+// \ingroup system
+//
+// \param file The name of the threshold file.
+// \return void
+// \exception std::runtime_error Threshold file could not be written.
+//
+// This function writes all thresholds that have been set at runtime (for instance via the
+// setThreshold() or calibrateThresholds() function) to the given file. Thresholds that still
+// use their compile time default are not written.
+*/
+inline void saveThresholds( const std::string& file )
+{
+   theThresholdTable().save( file );
+}
+//*************************************************************************************************
+#endif
+
+
+
+
+//=================================================================================================
+//
+//  THRESHOLD TYPE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The type of all thresholds of the Blaze library.
+// \ingroup system
+*/
+#if BLAZE_USE_RUNTIME_THRESHOLDS
+using ThresholdType = RuntimeThreshold;
+#else
+using ThresholdType = size_t;
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates the threshold with the given identifier and default value.
+// \ingroup system
+//
+// \param id The identifier of the threshold.
+// \param value The compile time default of the threshold.
+// \return The threshold.
+*/
+constexpr ThresholdType makeThreshold( ThresholdID id, size_t value ) noexcept
+{
+#if BLAZE_USE_RUNTIME_THRESHOLDS
+   return RuntimeThreshold( id, value );
+#else
+   return ( static_cast<void>( id ), value );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the compile time default of the given threshold.
+// \ingroup system
+//
+// \param threshold The given threshold.
+// \return The compile time default of the threshold.
+*/
+constexpr size_t defaultThreshold( const ThresholdType& threshold ) noexcept
+{
+#if BLAZE_USE_RUNTIME_THRESHOLDS
+   return threshold.defaultValue();
+#else
+   return threshold;
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -118,7 +118,7 @@
 // parallelization has priority over the Boost thread and OpenMP-based parallelization. In case
 // no parallelization is enabled, all computations are performed on a single compute core.
 */
-#if BLAZE_USE_SHARED_MEMORY_PARALLELIZATION && defined(BLAZE_USE_CPP_THREADS)
+#if BLAZE_USE_SHARED_MEMORY_PARALLELIZATION && ( defined(BLAZE_USE_CPP_THREADS) || defined(BLAZE_USE_WORK_STEALING_THREADS) )
 #define BLAZE_CPP_THREADS_PARALLEL_MODE 1
 #else
 #define BLAZE_CPP_THREADS_PARALLEL_MODE 0
@@ -128,6 +128,35 @@
 
 
 
+//=================================================================================================
+//
+//  WORK-STEALING THREAD PARALLEL MODE CONFIGURATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the work-stealing scheduler of the C++11 parallelization.
+// \ingroup system
+//
+// This compilation switch enables/disables the work-stealing scheduler for the parallelization
+// based on C++11 threads. In case the \c BLAZE_USE_WORK_STEALING_THREADS command line argument
+// is specified during compilation the Blaze library attempts to parallelize all matrix and vector
+// computations by means of C++11 threads (i.e. the \c BLAZE_CPP_THREADS_PARALLEL_MODE is enabled
+// as well), but schedules all tasks via a work-stealing thread pool with per-thread lock-free
+// task deques instead of a single, mutex-protected task queue. Note that the HPX-based
+// parallelization has priority over the work-stealing parallelization and will be preferred
+// in case both parallelizations are activated.
+*/
+#if BLAZE_CPP_THREADS_PARALLEL_MODE && defined(BLAZE_USE_WORK_STEALING_THREADS)
+#define BLAZE_WORK_STEALING_PARALLEL_MODE 1
+#else
+#define BLAZE_WORK_STEALING_PARALLEL_MODE 0
+#endif
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  BOOST THREAD PARALLEL MODE CONFIGURATION
@@ -41,6 +41,7 @@
 //*************************************************************************************************
 
 #include <blaze/system/Debugging.h>
+#include <blaze/system/RuntimeThresholds.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Types.h>
 
@@ -248,18 +249,18 @@ constexpr size_t TSMATTDMATMULT_DEBUG_THRESHOLD = 256UL;
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-constexpr size_t DMATDVECMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? DMATDVECMULT_DEBUG_THRESHOLD   : BLAZE_DMATDVECMULT_THRESHOLD   );
-constexpr size_t TDMATDVECMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? TDMATDVECMULT_DEBUG_THRESHOLD  : BLAZE_TDMATDVECMULT_THRESHOLD  );
-constexpr size_t TDVECDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? TDVECDMATMULT_DEBUG_THRESHOLD  : BLAZE_TDVECDMATMULT_THRESHOLD  );
-constexpr size_t TDVECTDMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? TDVECTDMATMULT_DEBUG_THRESHOLD : BLAZE_TDVECTDMATMULT_THRESHOLD );
-constexpr size_t DMATDMATMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? DMATDMATMULT_DEBUG_THRESHOLD   : BLAZE_DMATDMATMULT_THRESHOLD   );
-constexpr size_t DMATTDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? DMATTDMATMULT_DEBUG_THRESHOLD  : BLAZE_DMATTDMATMULT_THRESHOLD  );
-constexpr size_t TDMATDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? TDMATDMATMULT_DEBUG_THRESHOLD  : BLAZE_TDMATDMATMULT_THRESHOLD  );
-constexpr size_t TDMATTDMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? TDMATTDMATMULT_DEBUG_THRESHOLD : BLAZE_TDMATTDMATMULT_THRESHOLD );
-constexpr size_t DMATSMATMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? DMATSMATMULT_DEBUG_THRESHOLD   : BLAZE_DMATSMATMULT_THRESHOLD   );
-constexpr size_t TDMATSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? TDMATSMATMULT_DEBUG_THRESHOLD  : BLAZE_TDMATSMATMULT_THRESHOLD  );
-constexpr size_t TSMATDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? TSMATDMATMULT_DEBUG_THRESHOLD  : BLAZE_TSMATDMATMULT_THRESHOLD  );
-constexpr size_t TSMATTDMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? TSMATTDMATMULT_DEBUG_THRESHOLD : BLAZE_TSMATTDMATMULT_THRESHOLD );
+constexpr ThresholdType DMATDVECMULT_THRESHOLD   = makeThreshold( ThresholdID::DMATDVECMULT,   ( BLAZE_DEBUG_MODE ? DMATDVECMULT_DEBUG_THRESHOLD   : BLAZE_DMATDVECMULT_THRESHOLD   ) );
+constexpr ThresholdType TDMATDVECMULT_THRESHOLD  = makeThreshold( ThresholdID::TDMATDVECMULT,  ( BLAZE_DEBUG_MODE ? TDMATDVECMULT_DEBUG_THRESHOLD  : BLAZE_TDMATDVECMULT_THRESHOLD  ) );
+constexpr ThresholdType TDVECDMATMULT_THRESHOLD  = makeThreshold( ThresholdID::TDVECDMATMULT,  ( BLAZE_DEBUG_MODE ? TDVECDMATMULT_DEBUG_THRESHOLD  : BLAZE_TDVECDMATMULT_THRESHOLD  ) );
+constexpr ThresholdType TDVECTDMATMULT_THRESHOLD = makeThreshold( ThresholdID::TDVECTDMATMULT, ( BLAZE_DEBUG_MODE ? TDVECTDMATMULT_DEBUG_THRESHOLD : BLAZE_TDVECTDMATMULT_THRESHOLD ) );
+constexpr ThresholdType DMATDMATMULT_THRESHOLD   = makeThreshold( ThresholdID::DMATDMATMULT,   ( BLAZE_DEBUG_MODE ? DMATDMATMULT_DEBUG_THRESHOLD   : BLAZE_DMATDMATMULT_THRESHOLD   ) );
+constexpr ThresholdType DMATTDMATMULT_THRESHOLD  = makeThreshold( ThresholdID::DMATTDMATMULT,  ( BLAZE_DEBUG_MODE ? DMATTDMATMULT_DEBUG_THRESHOLD  : BLAZE_DMATTDMATMULT_THRESHOLD  ) );
+constexpr ThresholdType TDMATDMATMULT_THRESHOLD  = makeThreshold( ThresholdID::TDMATDMATMULT,  ( BLAZE_DEBUG_MODE ? TDMATDMATMULT_DEBUG_THRESHOLD  : BLAZE_TDMATDMATMULT_THRESHOLD  ) );
+constexpr ThresholdType TDMATTDMATMULT_THRESHOLD = makeThreshold( ThresholdID::TDMATTDMATMULT, ( BLAZE_DEBUG_MODE ? TDMATTDMATMULT_DEBUG_THRESHOLD : BLAZE_TDMATTDMATMULT_THRESHOLD ) );
+constexpr ThresholdType DMATSMATMULT_THRESHOLD   = makeThreshold( ThresholdID::DMATSMATMULT,   ( BLAZE_DEBUG_MODE ? DMATSMATMULT_DEBUG_THRESHOLD   : BLAZE_DMATSMATMULT_THRESHOLD   ) );
+constexpr ThresholdType TDMATSMATMULT_THRESHOLD  = makeThreshold( ThresholdID::TDMATSMATMULT,  ( BLAZE_DEBUG_MODE ? TDMATSMATMULT_DEBUG_THRESHOLD  : BLAZE_TDMATSMATMULT_THRESHOLD  ) );
+constexpr ThresholdType TSMATDMATMULT_THRESHOLD  = makeThreshold( ThresholdID::TSMATDMATMULT,  ( BLAZE_DEBUG_MODE ? TSMATDMATMULT_DEBUG_THRESHOLD  : BLAZE_TSMATDMATMULT_THRESHOLD  ) );
+constexpr ThresholdType TSMATTDMATMULT_THRESHOLD = makeThreshold( ThresholdID::TSMATTDMATMULT, ( BLAZE_DEBUG_MODE ? TSMATTDMATMULT_DEBUG_THRESHOLD : BLAZE_TSMATTDMATMULT_THRESHOLD ) );
 /*! \endcond */
 //*************************************************************************************************
 
@@ -967,57 +968,132 @@ constexpr size_t SMP_SMATREDUCE_DEBUG_THRESHOLD = 16UL;
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief SMP batched dense matrix operation threshold.
+// \ingroup config
+//
+// This debug value is used instead of the BLAZE_SMP_DMATBATCH_THRESHOLD while the Blaze debug
+// mode is active. It specifies when a batched operation on small dense matrices can be executed
+// in parallel. In case the number of matrices in the batch is larger or equal to this threshold,
+// the operation is executed in parallel. If the number of matrices is below this threshold the
+// operation is executed single-threaded.
+*/
+constexpr size_t SMP_DMATBATCH_DEBUG_THRESHOLD = 16UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP sparse matrix assignment threshold.
+// \ingroup config
+//
+// This debug value is used instead of the BLAZE_SMP_SMATASSIGN_THRESHOLD while the Blaze debug
+// mode is active. It specifies when an assignment to a compressed matrix can be executed in
+// parallel. In case the number of non-zero elements of the right-hand side operand is larger
+// or equal to this threshold, the operation is executed in parallel. If the number of non-zero
+// elements is below this threshold the operation is executed single-threaded.
+*/
+constexpr size_t SMP_SMATASSIGN_DEBUG_THRESHOLD = 256UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP dense vector reduction threshold.
+// \ingroup config
+//
+// This debug value is used instead of the BLAZE_SMP_DVECREDUCE_THRESHOLD while the Blaze debug
+// mode is active. It specifies when a total reduction of a dense vector can be executed in
+// parallel. In case the number of elements of the dense vector is larger or equal to this
+// threshold, the operation is executed in parallel. If the number of elements is below this
+// threshold the operation is executed single-threaded.
+*/
+constexpr size_t SMP_DVECREDUCE_DEBUG_THRESHOLD = 256UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP dense vector/dense vector inner product threshold.
+// \ingroup config
+//
+// This debug value is used instead of the BLAZE_SMP_DVECDVECINNER_THRESHOLD while the Blaze
+// debug mode is active. It specifies when a dense vector/dense vector inner product can be
+// executed in parallel. In case the number of elements of the dense vectors is larger or equal
+// to this threshold, the operation is executed in parallel. If the number of elements is below
+// this threshold the operation is executed single-threaded.
+*/
+constexpr size_t SMP_DVECDVECINNER_DEBUG_THRESHOLD = 256UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP dense matrix total reduction threshold.
+// \ingroup config
+//
+// This debug value is used instead of the BLAZE_SMP_DMATTOTALREDUCE_THRESHOLD while the Blaze
+// debug mode is active. It specifies when a total reduction of a dense matrix can be executed
+// in parallel. In case the number of elements of the dense matrix is larger or equal to this
+// threshold, the operation is executed in parallel. If the number of elements is below this
+// threshold the operation is executed single-threaded.
+*/
+constexpr size_t SMP_DMATTOTALREDUCE_DEBUG_THRESHOLD = 256UL;
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-constexpr size_t SMP_DVECASSIGN_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_DVECASSIGN_DEBUG_THRESHOLD     : BLAZE_SMP_DVECASSIGN_THRESHOLD     );
-constexpr size_t SMP_DVECSCALARMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_DVECSCALARMULT_DEBUG_THRESHOLD : BLAZE_SMP_DVECSCALARMULT_THRESHOLD );
-constexpr size_t SMP_DVECDVECADD_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DVECDVECADD_DEBUG_THRESHOLD    : BLAZE_SMP_DVECDVECADD_THRESHOLD    );
-constexpr size_t SMP_DVECDVECSUB_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DVECDVECSUB_DEBUG_THRESHOLD    : BLAZE_SMP_DVECDVECSUB_THRESHOLD    );
-constexpr size_t SMP_DVECDVECMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DVECDVECMULT_DEBUG_THRESHOLD   : BLAZE_SMP_DVECDVECMULT_THRESHOLD   );
-constexpr size_t SMP_DVECDVECDIV_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DVECDVECDIV_DEBUG_THRESHOLD    : BLAZE_SMP_DVECDVECDIV_THRESHOLD    );
-constexpr size_t SMP_DVECDVECOUTER_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_DVECDVECOUTER_DEBUG_THRESHOLD  : BLAZE_SMP_DVECDVECOUTER_THRESHOLD  );
-constexpr size_t SMP_DMATDVECMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATDVECMULT_DEBUG_THRESHOLD   : BLAZE_SMP_DMATDVECMULT_THRESHOLD   );
-constexpr size_t SMP_TDMATDVECMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TDMATDVECMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TDMATDVECMULT_THRESHOLD  );
-constexpr size_t SMP_TDVECDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TDVECDMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TDVECDMATMULT_THRESHOLD  );
-constexpr size_t SMP_TDVECTDMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TDVECTDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TDVECTDMATMULT_THRESHOLD );
-constexpr size_t SMP_DMATSVECMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATSVECMULT_DEBUG_THRESHOLD   : BLAZE_SMP_DMATSVECMULT_THRESHOLD   );
-constexpr size_t SMP_TDMATSVECMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TDMATSVECMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TDMATSVECMULT_THRESHOLD  );
-constexpr size_t SMP_TSVECDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSVECDMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TSVECDMATMULT_THRESHOLD  );
-constexpr size_t SMP_TSVECTDMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TSVECTDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSVECTDMATMULT_THRESHOLD );
-constexpr size_t SMP_SMATDVECMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_SMATDVECMULT_DEBUG_THRESHOLD   : BLAZE_SMP_SMATDVECMULT_THRESHOLD   );
-constexpr size_t SMP_TSMATDVECMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSMATDVECMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TSMATDVECMULT_THRESHOLD  );
-constexpr size_t SMP_TDVECSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TDVECSMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TDVECSMATMULT_THRESHOLD  );
-constexpr size_t SMP_TDVECTSMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TDVECTSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TDVECTSMATMULT_THRESHOLD );
-constexpr size_t SMP_SMATSVECMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_SMATSVECMULT_DEBUG_THRESHOLD   : BLAZE_SMP_SMATSVECMULT_THRESHOLD   );
-constexpr size_t SMP_TSMATSVECMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSMATSVECMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TSMATSVECMULT_THRESHOLD  );
-constexpr size_t SMP_TSVECSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSVECSMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TSVECSMATMULT_THRESHOLD  );
-constexpr size_t SMP_TSVECTSMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TSVECTSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSVECTSMATMULT_THRESHOLD );
-constexpr size_t SMP_DMATASSIGN_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_DMATASSIGN_DEBUG_THRESHOLD     : BLAZE_SMP_DMATASSIGN_THRESHOLD     );
-constexpr size_t SMP_DMATSCALARMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_DMATSCALARMULT_DEBUG_THRESHOLD : BLAZE_SMP_DMATSCALARMULT_THRESHOLD );
-constexpr size_t SMP_DMATDMATADD_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DMATDMATADD_DEBUG_THRESHOLD    : BLAZE_SMP_DMATDMATADD_THRESHOLD    );
-constexpr size_t SMP_DMATTDMATADD_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATADD_DEBUG_THRESHOLD   : BLAZE_SMP_DMATTDMATADD_THRESHOLD   );
-constexpr size_t SMP_DMATDMATSUB_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DMATDMATSUB_DEBUG_THRESHOLD    : BLAZE_SMP_DMATDMATSUB_THRESHOLD    );
-constexpr size_t SMP_DMATTDMATSUB_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATSUB_DEBUG_THRESHOLD   : BLAZE_SMP_DMATTDMATSUB_THRESHOLD   );
-constexpr size_t SMP_DMATDMATSCHUR_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_DMATDMATSCHUR_DEBUG_THRESHOLD  : BLAZE_SMP_DMATDMATSCHUR_THRESHOLD  );
-constexpr size_t SMP_DMATTDMATSCHUR_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATSCHUR_DEBUG_THRESHOLD : BLAZE_SMP_DMATTDMATSCHUR_THRESHOLD );
-constexpr size_t SMP_DMATDMATMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATDMATMULT_DEBUG_THRESHOLD   : BLAZE_SMP_DMATDMATMULT_THRESHOLD   );
-constexpr size_t SMP_DMATTDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_DMATTDMATMULT_THRESHOLD  );
-constexpr size_t SMP_TDMATDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TDMATDMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TDMATDMATMULT_THRESHOLD  );
-constexpr size_t SMP_TDMATTDMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TDMATTDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TDMATTDMATMULT_THRESHOLD );
-constexpr size_t SMP_DMATSMATMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATSMATMULT_DEBUG_THRESHOLD   : BLAZE_SMP_DMATSMATMULT_THRESHOLD   );
-constexpr size_t SMP_DMATTSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_DMATTSMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_DMATTSMATMULT_THRESHOLD  );
-constexpr size_t SMP_TDMATSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TDMATSMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TDMATSMATMULT_THRESHOLD  );
-constexpr size_t SMP_TDMATTSMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TDMATTSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TDMATTSMATMULT_THRESHOLD );
-constexpr size_t SMP_SMATDMATMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_SMATDMATMULT_DEBUG_THRESHOLD   : BLAZE_SMP_SMATDMATMULT_THRESHOLD   );
-constexpr size_t SMP_SMATTDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_SMATTDMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_SMATTDMATMULT_THRESHOLD  );
-constexpr size_t SMP_TSMATDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSMATDMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TSMATDMATMULT_THRESHOLD  );
-constexpr size_t SMP_TSMATTDMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TSMATTDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSMATTDMATMULT_THRESHOLD );
-constexpr size_t SMP_SMATSMATMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_SMATSMATMULT_DEBUG_THRESHOLD   : BLAZE_SMP_SMATSMATMULT_THRESHOLD   );
-constexpr size_t SMP_SMATTSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_SMATTSMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_SMATTSMATMULT_THRESHOLD  );
-constexpr size_t SMP_TSMATSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSMATSMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TSMATSMATMULT_THRESHOLD  );
-constexpr size_t SMP_TSMATTSMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TSMATTSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSMATTSMATMULT_THRESHOLD );
-constexpr size_t SMP_DMATREDUCE_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_DMATREDUCE_DEBUG_THRESHOLD     : BLAZE_SMP_DMATREDUCE_THRESHOLD     );
-constexpr size_t SMP_SMATREDUCE_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_SMATREDUCE_DEBUG_THRESHOLD     : BLAZE_SMP_SMATREDUCE_THRESHOLD     );
+constexpr ThresholdType SMP_DVECASSIGN_THRESHOLD     = makeThreshold( ThresholdID::SMP_DVECASSIGN,     ( BLAZE_DEBUG_MODE ? SMP_DVECASSIGN_DEBUG_THRESHOLD     : BLAZE_SMP_DVECASSIGN_THRESHOLD     ) );
+constexpr ThresholdType SMP_DVECSCALARMULT_THRESHOLD = makeThreshold( ThresholdID::SMP_DVECSCALARMULT, ( BLAZE_DEBUG_MODE ? SMP_DVECSCALARMULT_DEBUG_THRESHOLD : BLAZE_SMP_DVECSCALARMULT_THRESHOLD ) );
+constexpr ThresholdType SMP_DVECDVECADD_THRESHOLD    = makeThreshold( ThresholdID::SMP_DVECDVECADD,    ( BLAZE_DEBUG_MODE ? SMP_DVECDVECADD_DEBUG_THRESHOLD    : BLAZE_SMP_DVECDVECADD_THRESHOLD    ) );
+constexpr ThresholdType SMP_DVECDVECSUB_THRESHOLD    = makeThreshold( ThresholdID::SMP_DVECDVECSUB,    ( BLAZE_DEBUG_MODE ? SMP_DVECDVECSUB_DEBUG_THRESHOLD    : BLAZE_SMP_DVECDVECSUB_THRESHOLD    ) );
+constexpr ThresholdType SMP_DVECDVECMULT_THRESHOLD   = makeThreshold( ThresholdID::SMP_DVECDVECMULT,   ( BLAZE_DEBUG_MODE ? SMP_DVECDVECMULT_DEBUG_THRESHOLD   : BLAZE_SMP_DVECDVECMULT_THRESHOLD   ) );
+constexpr ThresholdType SMP_DVECDVECDIV_THRESHOLD    = makeThreshold( ThresholdID::SMP_DVECDVECDIV,    ( BLAZE_DEBUG_MODE ? SMP_DVECDVECDIV_DEBUG_THRESHOLD    : BLAZE_SMP_DVECDVECDIV_THRESHOLD    ) );
+constexpr ThresholdType SMP_DVECDVECOUTER_THRESHOLD  = makeThreshold( ThresholdID::SMP_DVECDVECOUTER,  ( BLAZE_DEBUG_MODE ? SMP_DVECDVECOUTER_DEBUG_THRESHOLD  : BLAZE_SMP_DVECDVECOUTER_THRESHOLD  ) );
+constexpr ThresholdType SMP_DMATDVECMULT_THRESHOLD   = makeThreshold( ThresholdID::SMP_DMATDVECMULT,   ( BLAZE_DEBUG_MODE ? SMP_DMATDVECMULT_DEBUG_THRESHOLD   : BLAZE_SMP_DMATDVECMULT_THRESHOLD   ) );
+constexpr ThresholdType SMP_TDMATDVECMULT_THRESHOLD  = makeThreshold( ThresholdID::SMP_TDMATDVECMULT,  ( BLAZE_DEBUG_MODE ? SMP_TDMATDVECMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TDMATDVECMULT_THRESHOLD  ) );
+constexpr ThresholdType SMP_TDVECDMATMULT_THRESHOLD  = makeThreshold( ThresholdID::SMP_TDVECDMATMULT,  ( BLAZE_DEBUG_MODE ? SMP_TDVECDMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TDVECDMATMULT_THRESHOLD  ) );
+constexpr ThresholdType SMP_TDVECTDMATMULT_THRESHOLD = makeThreshold( ThresholdID::SMP_TDVECTDMATMULT, ( BLAZE_DEBUG_MODE ? SMP_TDVECTDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TDVECTDMATMULT_THRESHOLD ) );
+constexpr ThresholdType SMP_DMATSVECMULT_THRESHOLD   = makeThreshold( ThresholdID::SMP_DMATSVECMULT,   ( BLAZE_DEBUG_MODE ? SMP_DMATSVECMULT_DEBUG_THRESHOLD   : BLAZE_SMP_DMATSVECMULT_THRESHOLD   ) );
+constexpr ThresholdType SMP_TDMATSVECMULT_THRESHOLD  = makeThreshold( ThresholdID::SMP_TDMATSVECMULT,  ( BLAZE_DEBUG_MODE ? SMP_TDMATSVECMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TDMATSVECMULT_THRESHOLD  ) );
+constexpr ThresholdType SMP_TSVECDMATMULT_THRESHOLD  = makeThreshold( ThresholdID::SMP_TSVECDMATMULT,  ( BLAZE_DEBUG_MODE ? SMP_TSVECDMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TSVECDMATMULT_THRESHOLD  ) );
+constexpr ThresholdType SMP_TSVECTDMATMULT_THRESHOLD = makeThreshold( ThresholdID::SMP_TSVECTDMATMULT, ( BLAZE_DEBUG_MODE ? SMP_TSVECTDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSVECTDMATMULT_THRESHOLD ) );
+constexpr ThresholdType SMP_SMATDVECMULT_THRESHOLD   = makeThreshold( ThresholdID::SMP_SMATDVECMULT,   ( BLAZE_DEBUG_MODE ? SMP_SMATDVECMULT_DEBUG_THRESHOLD   : BLAZE_SMP_SMATDVECMULT_THRESHOLD   ) );
+constexpr ThresholdType SMP_TSMATDVECMULT_THRESHOLD  = makeThreshold( ThresholdID::SMP_TSMATDVECMULT,  ( BLAZE_DEBUG_MODE ? SMP_TSMATDVECMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TSMATDVECMULT_THRESHOLD  ) );
+constexpr ThresholdType SMP_TDVECSMATMULT_THRESHOLD  = makeThreshold( ThresholdID::SMP_TDVECSMATMULT,  ( BLAZE_DEBUG_MODE ? SMP_TDVECSMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TDVECSMATMULT_THRESHOLD  ) );
+constexpr ThresholdType SMP_TDVECTSMATMULT_THRESHOLD = makeThreshold( ThresholdID::SMP_TDVECTSMATMULT, ( BLAZE_DEBUG_MODE ? SMP_TDVECTSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TDVECTSMATMULT_THRESHOLD ) );
+constexpr ThresholdType SMP_SMATSVECMULT_THRESHOLD   = makeThreshold( ThresholdID::SMP_SMATSVECMULT,   ( BLAZE_DEBUG_MODE ? SMP_SMATSVECMULT_DEBUG_THRESHOLD   : BLAZE_SMP_SMATSVECMULT_THRESHOLD   ) );
+constexpr ThresholdType SMP_TSMATSVECMULT_THRESHOLD  = makeThreshold( ThresholdID::SMP_TSMATSVECMULT,  ( BLAZE_DEBUG_MODE ? SMP_TSMATSVECMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TSMATSVECMULT_THRESHOLD  ) );
+constexpr ThresholdType SMP_TSVECSMATMULT_THRESHOLD  = makeThreshold( ThresholdID::SMP_TSVECSMATMULT,  ( BLAZE_DEBUG_MODE ? SMP_TSVECSMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TSVECSMATMULT_THRESHOLD  ) );
+constexpr ThresholdType SMP_TSVECTSMATMULT_THRESHOLD = makeThreshold( ThresholdID::SMP_TSVECTSMATMULT, ( BLAZE_DEBUG_MODE ? SMP_TSVECTSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSVECTSMATMULT_THRESHOLD ) );
+constexpr ThresholdType SMP_DMATASSIGN_THRESHOLD     = makeThreshold( ThresholdID::SMP_DMATASSIGN,     ( BLAZE_DEBUG_MODE ? SMP_DMATASSIGN_DEBUG_THRESHOLD     : BLAZE_SMP_DMATASSIGN_THRESHOLD     ) );
+constexpr ThresholdType SMP_DMATSCALARMULT_THRESHOLD = makeThreshold( ThresholdID::SMP_DMATSCALARMULT, ( BLAZE_DEBUG_MODE ? SMP_DMATSCALARMULT_DEBUG_THRESHOLD : BLAZE_SMP_DMATSCALARMULT_THRESHOLD ) );
+constexpr ThresholdType SMP_DMATDMATADD_THRESHOLD    = makeThreshold( ThresholdID::SMP_DMATDMATADD,    ( BLAZE_DEBUG_MODE ? SMP_DMATDMATADD_DEBUG_THRESHOLD    : BLAZE_SMP_DMATDMATADD_THRESHOLD    ) );
+constexpr ThresholdType SMP_DMATTDMATADD_THRESHOLD   = makeThreshold( ThresholdID::SMP_DMATTDMATADD,   ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATADD_DEBUG_THRESHOLD   : BLAZE_SMP_DMATTDMATADD_THRESHOLD   ) );
+constexpr ThresholdType SMP_DMATDMATSUB_THRESHOLD    = makeThreshold( ThresholdID::SMP_DMATDMATSUB,    ( BLAZE_DEBUG_MODE ? SMP_DMATDMATSUB_DEBUG_THRESHOLD    : BLAZE_SMP_DMATDMATSUB_THRESHOLD    ) );
+constexpr ThresholdType SMP_DMATTDMATSUB_THRESHOLD   = makeThreshold( ThresholdID::SMP_DMATTDMATSUB,   ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATSUB_DEBUG_THRESHOLD   : BLAZE_SMP_DMATTDMATSUB_THRESHOLD   ) );
+constexpr ThresholdType SMP_DMATDMATSCHUR_THRESHOLD  = makeThreshold( ThresholdID::SMP_DMATDMATSCHUR,  ( BLAZE_DEBUG_MODE ? SMP_DMATDMATSCHUR_DEBUG_THRESHOLD  : BLAZE_SMP_DMATDMATSCHUR_THRESHOLD  ) );
+constexpr ThresholdType SMP_DMATTDMATSCHUR_THRESHOLD = makeThreshold( ThresholdID::SMP_DMATTDMATSCHUR, ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATSCHUR_DEBUG_THRESHOLD : BLAZE_SMP_DMATTDMATSCHUR_THRESHOLD ) );
+constexpr ThresholdType SMP_DMATDMATMULT_THRESHOLD   = makeThreshold( ThresholdID::SMP_DMATDMATMULT,   ( BLAZE_DEBUG_MODE ? SMP_DMATDMATMULT_DEBUG_THRESHOLD   : BLAZE_SMP_DMATDMATMULT_THRESHOLD   ) );
+constexpr ThresholdType SMP_DMATTDMATMULT_THRESHOLD  = makeThreshold( ThresholdID::SMP_DMATTDMATMULT,  ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_DMATTDMATMULT_THRESHOLD  ) );
+constexpr ThresholdType SMP_TDMATDMATMULT_THRESHOLD  = makeThreshold( ThresholdID::SMP_TDMATDMATMULT,  ( BLAZE_DEBUG_MODE ? SMP_TDMATDMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TDMATDMATMULT_THRESHOLD  ) );
+constexpr ThresholdType SMP_TDMATTDMATMULT_THRESHOLD = makeThreshold( ThresholdID::SMP_TDMATTDMATMULT, ( BLAZE_DEBUG_MODE ? SMP_TDMATTDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TDMATTDMATMULT_THRESHOLD ) );
+constexpr ThresholdType SMP_DMATSMATMULT_THRESHOLD   = makeThreshold( ThresholdID::SMP_DMATSMATMULT,   ( BLAZE_DEBUG_MODE ? SMP_DMATSMATMULT_DEBUG_THRESHOLD   : BLAZE_SMP_DMATSMATMULT_THRESHOLD   ) );
+constexpr ThresholdType SMP_DMATTSMATMULT_THRESHOLD  = makeThreshold( ThresholdID::SMP_DMATTSMATMULT,  ( BLAZE_DEBUG_MODE ? SMP_DMATTSMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_DMATTSMATMULT_THRESHOLD  ) );
+constexpr ThresholdType SMP_TDMATSMATMULT_THRESHOLD  = makeThreshold( ThresholdID::SMP_TDMATSMATMULT,  ( BLAZE_DEBUG_MODE ? SMP_TDMATSMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TDMATSMATMULT_THRESHOLD  ) );
+constexpr ThresholdType SMP_TDMATTSMATMULT_THRESHOLD = makeThreshold( ThresholdID::SMP_TDMATTSMATMULT, ( BLAZE_DEBUG_MODE ? SMP_TDMATTSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TDMATTSMATMULT_THRESHOLD ) );
+constexpr ThresholdType SMP_SMATDMATMULT_THRESHOLD   = makeThreshold( ThresholdID::SMP_SMATDMATMULT,   ( BLAZE_DEBUG_MODE ? SMP_SMATDMATMULT_DEBUG_THRESHOLD   : BLAZE_SMP_SMATDMATMULT_THRESHOLD   ) );
+constexpr ThresholdType SMP_SMATTDMATMULT_THRESHOLD  = makeThreshold( ThresholdID::SMP_SMATTDMATMULT,  ( BLAZE_DEBUG_MODE ? SMP_SMATTDMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_SMATTDMATMULT_THRESHOLD  ) );
+constexpr ThresholdType SMP_TSMATDMATMULT_THRESHOLD  = makeThreshold( ThresholdID::SMP_TSMATDMATMULT,  ( BLAZE_DEBUG_MODE ? SMP_TSMATDMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TSMATDMATMULT_THRESHOLD  ) );
+constexpr ThresholdType SMP_TSMATTDMATMULT_THRESHOLD = makeThreshold( ThresholdID::SMP_TSMATTDMATMULT, ( BLAZE_DEBUG_MODE ? SMP_TSMATTDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSMATTDMATMULT_THRESHOLD ) );
+constexpr ThresholdType SMP_SMATSMATMULT_THRESHOLD   = makeThreshold( ThresholdID::SMP_SMATSMATMULT,   ( BLAZE_DEBUG_MODE ? SMP_SMATSMATMULT_DEBUG_THRESHOLD   : BLAZE_SMP_SMATSMATMULT_THRESHOLD   ) );
+constexpr ThresholdType SMP_SMATTSMATMULT_THRESHOLD  = makeThreshold( ThresholdID::SMP_SMATTSMATMULT,  ( BLAZE_DEBUG_MODE ? SMP_SMATTSMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_SMATTSMATMULT_THRESHOLD  ) );
+constexpr ThresholdType SMP_TSMATSMATMULT_THRESHOLD  = makeThreshold( ThresholdID::SMP_TSMATSMATMULT,  ( BLAZE_DEBUG_MODE ? SMP_TSMATSMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TSMATSMATMULT_THRESHOLD  ) );
+constexpr ThresholdType SMP_TSMATTSMATMULT_THRESHOLD = makeThreshold( ThresholdID::SMP_TSMATTSMATMULT, ( BLAZE_DEBUG_MODE ? SMP_TSMATTSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSMATTSMATMULT_THRESHOLD ) );
+constexpr ThresholdType SMP_DMATREDUCE_THRESHOLD     = makeThreshold( ThresholdID::SMP_DMATREDUCE,     ( BLAZE_DEBUG_MODE ? SMP_DMATREDUCE_DEBUG_THRESHOLD     : BLAZE_SMP_DMATREDUCE_THRESHOLD     ) );
+constexpr ThresholdType SMP_SMATREDUCE_THRESHOLD     = makeThreshold( ThresholdID::SMP_SMATREDUCE,     ( BLAZE_DEBUG_MODE ? SMP_SMATREDUCE_DEBUG_THRESHOLD     : BLAZE_SMP_SMATREDUCE_THRESHOLD     ) );
+constexpr ThresholdType SMP_DMATBATCH_THRESHOLD      = makeThreshold( ThresholdID::SMP_DMATBATCH,      ( BLAZE_DEBUG_MODE ? SMP_DMATBATCH_DEBUG_THRESHOLD      : BLAZE_SMP_DMATBATCH_THRESHOLD      ) );
+constexpr ThresholdType SMP_SMATASSIGN_THRESHOLD     = makeThreshold( ThresholdID::SMP_SMATASSIGN,     ( BLAZE_DEBUG_MODE ? SMP_SMATASSIGN_DEBUG_THRESHOLD     : BLAZE_SMP_SMATASSIGN_THRESHOLD     ) );
+constexpr ThresholdType SMP_DVECREDUCE_THRESHOLD     = makeThreshold( ThresholdID::SMP_DVECREDUCE,     ( BLAZE_DEBUG_MODE ? SMP_DVECREDUCE_DEBUG_THRESHOLD     : BLAZE_SMP_DVECREDUCE_THRESHOLD     ) );
+constexpr ThresholdType SMP_DVECDVECINNER_THRESHOLD  = makeThreshold( ThresholdID::SMP_DVECDVECINNER,  ( BLAZE_DEBUG_MODE ? SMP_DVECDVECINNER_DEBUG_THRESHOLD  : BLAZE_SMP_DVECDVECINNER_THRESHOLD  ) );
+constexpr ThresholdType SMP_DMATTOTALREDUCE_THRESHOLD = makeThreshold( ThresholdID::SMP_DMATTOTALREDUCE, ( BLAZE_DEBUG_MODE ? SMP_DMATTOTALREDUCE_DEBUG_THRESHOLD : BLAZE_SMP_DMATTOTALREDUCE_THRESHOLD ) );
 /*! \endcond */
 //*************************************************************************************************
 
@@ -1036,64 +1112,69 @@ constexpr size_t SMP_SMATREDUCE_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_SMATRED
 /*! \cond BLAZE_INTERNAL */
 namespace {
 
-BLAZE_STATIC_ASSERT( blaze::DMATDVECMULT_THRESHOLD   > 0UL );
-BLAZE_STATIC_ASSERT( blaze::TDMATDVECMULT_THRESHOLD  > 0UL );
-BLAZE_STATIC_ASSERT( blaze::TDVECDMATMULT_THRESHOLD  > 0UL );
-BLAZE_STATIC_ASSERT( blaze::TDVECTDMATMULT_THRESHOLD > 0UL );
-BLAZE_STATIC_ASSERT( blaze::DMATDMATMULT_THRESHOLD   > 0UL );
-BLAZE_STATIC_ASSERT( blaze::DMATTDMATMULT_THRESHOLD  > 0UL );
-BLAZE_STATIC_ASSERT( blaze::TDMATDMATMULT_THRESHOLD  > 0UL );
-BLAZE_STATIC_ASSERT( blaze::TDMATTDMATMULT_THRESHOLD > 0UL );
-
-BLAZE_STATIC_ASSERT( blaze::SMP_DVECASSIGN_THRESHOLD     >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DVECSCALARMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECADD_THRESHOLD    >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECSUB_THRESHOLD    >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECDIV_THRESHOLD    >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECOUTER_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATDVECMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDMATDVECMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDVECDMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDVECTDMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATSVECMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDMATSVECMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSVECDMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSVECTDMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_SMATDVECMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSMATDVECMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDVECSMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDVECTSMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_SMATSVECMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSMATSVECMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSVECSMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSVECTSMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATASSIGN_THRESHOLD     >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATSCALARMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATDMATADD_THRESHOLD    >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATTDMATADD_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATDMATSUB_THRESHOLD    >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATTDMATSUB_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATDMATSCHUR_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATTDMATSCHUR_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATDMATMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATTDMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDMATDMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDMATTDMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATSMATMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATTSMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDMATSMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDMATTSMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_SMATDMATMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_SMATTDMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSMATDMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSMATTDMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_SMATSMATMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_SMATTSMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSMATSMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSMATTSMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATREDUCE_THRESHOLD     >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_SMATREDUCE_THRESHOLD     >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::defaultThreshold( blaze::DMATDVECMULT_THRESHOLD   ) > 0UL );
+BLAZE_STATIC_ASSERT( blaze::defaultThreshold( blaze::TDMATDVECMULT_THRESHOLD  ) > 0UL );
+BLAZE_STATIC_ASSERT( blaze::defaultThreshold( blaze::TDVECDMATMULT_THRESHOLD  ) > 0UL );
+BLAZE_STATIC_ASSERT( blaze::defaultThreshold( blaze::TDVECTDMATMULT_THRESHOLD ) > 0UL );
+BLAZE_STATIC_ASSERT( blaze::defaultThreshold( blaze::DMATDMATMULT_THRESHOLD   ) > 0UL );
+BLAZE_STATIC_ASSERT( blaze::defaultThreshold( blaze::DMATTDMATMULT_THRESHOLD  ) > 0UL );
+BLAZE_STATIC_ASSERT( blaze::defaultThreshold( blaze::TDMATDMATMULT_THRESHOLD  ) > 0UL );
+BLAZE_STATIC_ASSERT( blaze::defaultThreshold( blaze::TDMATTDMATMULT_THRESHOLD ) > 0UL );
+
+BLAZE_STATIC_ASSERT( blaze::defaultThreshold( blaze::SMP_DVECASSIGN_THRESHOLD     ) >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::defaultThreshold( blaze::SMP_DVECSCALARMULT_THRESHOLD ) >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::defaultThreshold( blaze::SMP_DVECDVECADD_THRESHOLD    ) >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::defaultThreshold( blaze::SMP_DVECDVECSUB_THRESHOLD    ) >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::defaultThreshold( blaze::SMP_DVECDVECMULT_THRESHOLD   ) >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::defaultThreshold( blaze::SMP_DVECDVECDIV_THRESHOLD    ) >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::defaultThreshold( blaze::SMP_DVECDVECOUTER_THRESHOLD  ) >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::defaultThreshold( blaze::SMP_DMATDVECMULT_THRESHOLD   ) >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::defaultThreshold( blaze::SMP_TDMATDVECMULT_THRESHOLD  ) >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::defaultThreshold( blaze::SMP_TDVECDMATMULT_THRESHOLD  ) >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::defaultThreshold( blaze::SMP_TDVECTDMATMULT_THRESHOLD ) >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::defaultThreshold( blaze::SMP_DMATSVECMULT_THRESHOLD   ) >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::defaultThreshold( blaze::SMP_TDMATSVECMULT_THRESHOLD  ) >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::defaultThreshold( blaze::SMP_TSVECDMATMULT_THRESHOLD  ) >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::defaultThreshold( blaze::SMP_TSVECTDMATMULT_THRESHOLD ) >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::defaultThreshold( blaze::SMP_SMATDVECMULT_THRESHOLD   ) >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::defaultThreshold( blaze::SMP_TSMATDVECMULT_THRESHOLD  ) >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::defaultThreshold( blaze::SMP_TDVECSMATMULT_THRESHOLD  ) >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::defaultThreshold( blaze::SMP_TDVECTSMATMULT_THRESHOLD ) >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::defaultThreshold( blaze::SMP_SMATSVECMULT_THRESHOLD   ) >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::defaultThreshold( blaze::SMP_TSMATSVECMULT_THRESHOLD  ) >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::defaultThreshold( blaze::SMP_TSVECSMATMULT_THRESHOLD  ) >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::defaultThreshold( blaze::SMP_TSVECTSMATMULT_THRESHOLD ) >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::defaultThreshold( blaze::SMP_DMATASSIGN_THRESHOLD     ) >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::defaultThreshold( blaze::SMP_DMATSCALARMULT_THRESHOLD ) >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::defaultThreshold( blaze::SMP_DMATDMATADD_THRESHOLD    ) >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::defaultThreshold( blaze::SMP_DMATTDMATADD_THRESHOLD   ) >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::defaultThreshold( blaze::SMP_DMATDMATSUB_THRESHOLD    ) >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::defaultThreshold( blaze::SMP_DMATTDMATSUB_THRESHOLD   ) >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::defaultThreshold( blaze::SMP_DMATDMATSCHUR_THRESHOLD  ) >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::defaultThreshold( blaze::SMP_DMATTDMATSCHUR_THRESHOLD ) >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::defaultThreshold( blaze::SMP_DMATDMATMULT_THRESHOLD   ) >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::defaultThreshold( blaze::SMP_DMATTDMATMULT_THRESHOLD  ) >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::defaultThreshold( blaze::SMP_TDMATDMATMULT_THRESHOLD  ) >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::defaultThreshold( blaze::SMP_TDMATTDMATMULT_THRESHOLD ) >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::defaultThreshold( blaze::SMP_DMATSMATMULT_THRESHOLD   ) >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::defaultThreshold( blaze::SMP_DMATTSMATMULT_THRESHOLD  ) >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::defaultThreshold( blaze::SMP_TDMATSMATMULT_THRESHOLD  ) >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::defaultThreshold( blaze::SMP_TDMATTSMATMULT_THRESHOLD ) >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::defaultThreshold( blaze::SMP_SMATDMATMULT_THRESHOLD   ) >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::defaultThreshold( blaze::SMP_SMATTDMATMULT_THRESHOLD  ) >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::defaultThreshold( blaze::SMP_TSMATDMATMULT_THRESHOLD  ) >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::defaultThreshold( blaze::SMP_TSMATTDMATMULT_THRESHOLD ) >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::defaultThreshold( blaze::SMP_SMATSMATMULT_THRESHOLD   ) >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::defaultThreshold( blaze::SMP_SMATTSMATMULT_THRESHOLD  ) >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::defaultThreshold( blaze::SMP_TSMATSMATMULT_THRESHOLD  ) >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::defaultThreshold( blaze::SMP_TSMATTSMATMULT_THRESHOLD ) >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::defaultThreshold( blaze::SMP_DMATREDUCE_THRESHOLD     ) >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::defaultThreshold( blaze::SMP_SMATREDUCE_THRESHOLD     ) >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::defaultThreshold( blaze::SMP_DMATBATCH_THRESHOLD      ) >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::defaultThreshold( blaze::SMP_SMATASSIGN_THRESHOLD     ) >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::defaultThreshold( blaze::SMP_DVECREDUCE_THRESHOLD     ) >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::defaultThreshold( blaze::SMP_DVECDVECINNER_THRESHOLD  ) >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::defaultThreshold( blaze::SMP_DMATTOTALREDUCE_THRESHOLD ) >= 0UL );
 
 }
 /*! \endcond */
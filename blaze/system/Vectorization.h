@@ -353,6 +353,62 @@
 
 
 
+//=================================================================================================
+//
+//  SIMD MATH MODE CONFIGURATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the native SIMD math mode.
+// \ingroup system
+//
+// This compilation switch enables/disables the native SIMD math mode. In case the native SIMD
+// math mode is enabled (i.e. in case the SVML is not available, at least SSE2 is available,
+// and the BLAZE_USE_SIMD_MATH switch is set) the Blaze library vectorizes the exponential,
+// logarithmic, trigonometric and power functions by means of its own polynomial kernels
+// (see <tt>blaze/math/simd/NativeMath.h</tt>). In case the native SIMD math mode is disabled,
+// the Blaze library chooses default, non-vectorized functionality for these operations.
+*/
+#if BLAZE_USE_SIMD_MATH && BLAZE_SSE2_MODE && !BLAZE_MIC_MODE && !BLAZE_SVML_MODE
+#  define BLAZE_SIMD_MATH_MODE 1
+#else
+#  define BLAZE_SIMD_MATH_MODE 0
+#endif
+//*************************************************************************************************
+
+
+
+//=================================================================================================
+//
+//  RUNTIME DISPATCH MODE CONFIGURATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the runtime dispatch mode.
+// \ingroup system
+//
+// This compilation switch enables/disables the runtime dispatch mode. In case the runtime
+// dispatch mode is enabled (i.e. in case the BLAZE_USE_RUNTIME_DISPATCH switch is set, the
+// target is x86-64, the GNU or Clang compiler is used, and the compile time instruction set
+// does not include AVX-512) the Blaze library compiles the performance critical kernels for
+// several instruction sets and selects the according variant at runtime (see
+// <tt>blaze/math/dispatch/InstructionSet.h</tt>). In case the runtime dispatch mode is disabled,
+// all kernels use the instruction set selected at compile time.
+*/
+#if BLAZE_USE_RUNTIME_DISPATCH && BLAZE_USE_VECTORIZATION && BLAZE_SSE2_MODE && \
+    !BLAZE_AVX512F_MODE && !BLAZE_MIC_MODE && defined(__x86_64__) && \
+    ( defined(__GNUC__) || defined(__clang__) ) && !defined(__INTEL_COMPILER)
+#  define BLAZE_RUNTIME_DISPATCH_MODE 1
+#else
+#  define BLAZE_RUNTIME_DISPATCH_MODE 0
+#endif
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  COMPILE TIME CONSTRAINTS
@@ -0,0 +1,452 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/Arena.h
+//  \brief Header file for the Arena class and the arena section
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_UTIL_ARENA_H_
+#define _BLAZE_UTIL_ARENA_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Exception.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/MemoryResource.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Suffix.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Bump allocator for short-lived vectors, matrices, and expression temporaries.
+// \ingroup util
+//
+// The Arena class represents a memory resource that hands out memory by bumping a pointer
+// through a list of large memory chunks. Within an arena section (see BLAZE_ARENA_SECTION) all
+// aligned allocations of the calling thread, including the memory of all dynamic and sparse
+// vectors and matrices and of all temporaries created during the evaluation of expressions, are
+// drawn from the arena. Individual deallocations are ignored, instead the memory is released in
+// bulk via reset() or release():
+
+   \code
+   blaze::Arena arena;
+
+   for( const Request& request : requests )
+   {
+      BLAZE_ARENA_SECTION( arena )
+      {
+         blaze::DynamicMatrix<double> A( request.matrix() );
+         blaze::DynamicVector<double> x( request.vector() );
+         blaze::DynamicVector<double> y( A * x + x );
+
+         respond( request, y );
+      }
+
+      arena.reset();  // All memory of the request is reused for the next request
+   }
+   \endcode
+
+// Since the memory of the arena is not released on deallocation, arenas are best suited for
+// request-scoped computations with many short-lived objects. The chunks of the arena are kept
+// on reset(), i.e. in the steady state no heap allocation takes place at all. In comparison to
+// the global allocation, an arena neither requires any synchronization between threads nor
+// suffers from allocator contention.
+//
+// Please note the following restrictions:
+//
+//  - All vectors and matrices that have allocated memory from an arena must be destroyed before
+//    the arena is reset or released. They may be resized or destroyed outside of the section,
+//    since the chunks of the arena are registered as memory ranges (see MemoryResource), but
+//    their memory is not returned to the arena before the next reset.
+//  - An arena is not thread-safe. The arena section only affects the calling thread, i.e. the
+//    threads of the SMP backends always use the default allocation.
+//  - reset() and release() may only be called outside of any arena section of the arena.
+*/
+class Arena
+   : public MemoryResource
+   , private NonCopyable
+{
+ private:
+   //**struct Chunk********************************************************************************
+   /*!\brief A single memory chunk of the arena.
+   */
+   struct Chunk
+   {
+      byte_t* begin;  //!< The first byte of the chunk.
+      byte_t* end;    //!< One past the last byte of the chunk.
+   };
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline Arena( size_t chunkSize = 1048576UL );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~Arena();
+   //@}
+   //**********************************************************************************************
+
+   //**Memory management functions*****************************************************************
+   /*!\name Memory management functions */
+   //@{
+   byte_t* allocate( size_t size, size_t alignment ) override;
+   bool    owns( const void* address ) const noexcept override;
+
+   inline void reset() noexcept;
+   inline void release() noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t used() const noexcept;
+   inline size_t capacity() const noexcept;
+   inline size_t chunks() const noexcept;
+   inline size_t chunkSize() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t chunkSize_;           //!< The minimum size of a memory chunk.
+   std::vector<Chunk> chunks_;  //!< The memory chunks of the arena.
+   size_t current_;             //!< The index of the current memory chunk.
+   byte_t* pos_;                //!< The first free byte of the current memory chunk.
+   size_t used_;                //!< The number of bytes handed out since the last reset.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The constructor for the Arena class.
+//
+// \param chunkSize The minimum size of a memory chunk (in bytes).
+// \exception std::invalid_argument Invalid chunk size.
+//
+// The arena doesn't allocate any memory on construction. The first chunk is allocated on the
+// first allocation. In case the given chunk size is zero, a \a std::invalid_argument exception
+// is thrown.
+*/
+inline Arena::Arena( size_t chunkSize )
+   : chunkSize_( chunkSize )  // The minimum size of a memory chunk
+   , chunks_   ()             // The memory chunks of the arena
+   , current_  ( 0UL )        // The index of the current memory chunk
+   , pos_      ( nullptr )    // The first free byte of the current memory chunk
+   , used_     ( 0UL )        // The number of bytes handed out since the last reset
+{
+   if( chunkSize_ == 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid chunk size" );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for the Arena class.
+*/
+inline Arena::~Arena()
+{
+   release();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MEMORY MANAGEMENT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Allocates aligned memory from the arena.
+//
+// \param size The number of bytes to be allocated.
+// \param alignment The required minimum alignment (has to be a power of two).
+// \return Byte pointer to the allocated memory.
+// \exception std::bad_alloc Allocation failed.
+//
+// This function hands out memory from the current chunk. In case the current chunk cannot hold
+// the requested memory, the allocation continues in the next chunk that is large enough. In
+// case no such chunk exists, a new chunk of at least chunkSize() bytes is allocated and registered
+// as memory range (see MemoryResource).
+*/
+inline byte_t* Arena::allocate( size_t size, size_t alignment )
+{
+   BLAZE_INTERNAL_ASSERT( alignment != 0UL && ( alignment & ( alignment - 1UL ) ) == 0UL,
+                          "Invalid alignment detected" );
+
+   const auto align = [alignment]( byte_t* ptr ) {
+      const size_t misalignment( reinterpret_cast<size_t>( ptr ) & ( alignment - 1UL ) );
+      return ( misalignment != 0UL ? ptr + ( alignment - misalignment ) : ptr );
+   };
+
+   for( ; current_ < chunks_.size(); ++current_ )
+   {
+      const Chunk& chunk( chunks_[current_] );
+
+      if( pos_ == nullptr ) {
+         pos_ = chunk.begin;
+      }
+
+      byte_t* const address( align( pos_ ) );
+
+      if( address <= chunk.end && size <= size_t( chunk.end - address ) ) {
+         used_ += size_t( address - pos_ ) + size;
+         pos_ = address + size;
+         return address;
+      }
+
+      pos_ = nullptr;
+   }
+
+   const size_t bytes( max( chunkSize_, size + alignment ) );
+   byte_t* const begin( system_allocate_backend( bytes, alignment ) );
+
+   try {
+      chunks_.reserve( chunks_.size() + 1UL );
+      registerMemory( begin, begin + bytes );
+   }
+   catch( ... ) {
+      system_deallocate_backend( begin );
+      throw;
+   }
+
+   chunks_.push_back( Chunk{ begin, begin + bytes } );
+   current_ = chunks_.size() - 1UL;
+
+   used_ += size;
+   pos_ = begin + size;
+   return begin;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given memory has been allocated from the arena.
+//
+// \param address The address of the memory.
+// \return \a true in case the memory belongs to the arena, \a false if not.
+*/
+inline bool Arena::owns( const void* address ) const noexcept
+{
+   const byte_t* const ptr( static_cast<const byte_t*>( address ) );
+
+   for( const Chunk& chunk : chunks_ ) {
+      if( ptr >= chunk.begin && ptr < chunk.end )
+         return true;
+   }
+
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Releases all memory handed out by the arena for reuse.
+//
+// \return void
+//
+// This function makes all memory of the arena available for subsequent allocations without
+// returning the chunks to the system. All memory previously handed out by the arena becomes
+// invalid.
+*/
+inline void Arena::reset() noexcept
+{
+   current_ = 0UL;
+   pos_     = nullptr;
+   used_    = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns all memory chunks of the arena to the system.
+//
+// \return void
+//
+// All memory previously handed out by the arena becomes invalid.
+*/
+inline void Arena::release() noexcept
+{
+   for( const Chunk& chunk : chunks_ ) {
+      unregisterMemory( chunk.begin );
+      system_deallocate_backend( chunk.begin );
+   }
+
+   chunks_.clear();
+   reset();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of bytes handed out since the last reset (including alignment).
+//
+// \return The number of bytes handed out since the last reset.
+*/
+inline size_t Arena::used() const noexcept
+{
+   return used_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of bytes of all memory chunks of the arena.
+//
+// \return The total size of all memory chunks.
+*/
+inline size_t Arena::capacity() const noexcept
+{
+   size_t bytes( 0UL );
+
+   for( const Chunk& chunk : chunks_ ) {
+      bytes += size_t( chunk.end - chunk.begin );
+   }
+
+   return bytes;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of memory chunks of the arena.
+//
+// \return The number of memory chunks.
+*/
+inline size_t Arena::chunks() const noexcept
+{
+   return chunks_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the minimum size of a memory chunk.
+//
+// \return The minimum size of a memory chunk (in bytes).
+*/
+inline size_t Arena::chunkSize() const noexcept
+{
+   return chunkSize_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ARENA SECTION MACRO
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Section to draw all aligned allocations of the calling thread from the given arena.
+// \ingroup util
+//
+// This macro provides the option to start an arena section, within which all aligned
+// allocations of the calling thread are drawn from the given arena (see Arena). The following
+// example demonstrates how an arena section is used:
+
+   \code
+   blaze::Arena arena;
+
+   BLAZE_ARENA_SECTION( arena )
+   {
+      blaze::DynamicVector<double> x( 1000UL, 1.0 );  // Memory drawn from the arena
+      blaze::DynamicVector<double> y( 2.0 * x );      // Memory drawn from the arena
+   }
+
+   arena.reset();
+   \endcode
+
+// Arena sections can be nested, in which case the innermost arena is used for all allocations.
+*/
+#define BLAZE_ARENA_SECTION( ARENA ) \
+   if( blaze::MemoryResourceSection BLAZE_JOIN( arenaSection, __LINE__ ){ ARENA } )
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
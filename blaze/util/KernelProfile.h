@@ -0,0 +1,93 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/KernelProfile.h
+//  \brief Header file for the kernel profiling functionality
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_UTIL_KERNELPROFILE_H_
+#define _BLAZE_UTIL_KERNELPROFILE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/system/Debugging.h>
+#include <blaze/util/kernelprofile/KernelRegistry.h>
+#if BLAZE_USE_KERNEL_PROFILING
+#  include <blaze/util/kernelprofile/KernelProfile.h>
+#endif
+
+
+
+
+//=================================================================================================
+//
+//  BLAZE_KERNEL_PROFILE MACRO
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Kernel profiling macro.
+// \ingroup util
+//
+// This macro can be used to profile the call of a computational kernel. In case kernel profiling
+// is activated, the ID of the kernel, the given dimensions, the given number of threads, the
+// elapsed time until the end of the enclosing scope, and the given estimates of the number of
+// floating point operations and bytes are recorded in the global kernel registry (see
+// kernelRegistry()). The following example demonstrates how the macro is used:
+
+   \code
+   template< typename MT1, typename MT2, typename MT3 >
+   void multiply( MT1& C, const MT2& A, const MT3& B )
+   {
+      BLAZE_KERNEL_PROFILE( "multiply", 1UL, A.rows(), B.columns(), A.columns(),
+                            2.0*A.rows()*B.columns()*A.columns(),
+                            8.0*( A.rows()*A.columns() + B.rows()*B.columns() + C.rows()*C.columns() ) );
+
+      // ...
+   }
+   \endcode
+
+// Kernel profiling can be enabled or disabled via the BLAZE_USE_KERNEL_PROFILING macro. In case
+// kernel profiling is deactivated, the macro is completely removed from the code, i.e. none of
+// its arguments is evaluated and no overhead results from the BLAZE_KERNEL_PROFILE macro.
+*/
+#if BLAZE_USE_KERNEL_PROFILING
+#  define BLAZE_KERNEL_PROFILE( KERNEL, THREADS, M, N, K, FLOPS, BYTES ) \
+   blaze::KernelProfile BLAZE_KERNEL_PROFILE_OBJECT( KERNEL, THREADS, M, N, K, FLOPS, BYTES )
+#else
+#  define BLAZE_KERNEL_PROFILE( KERNEL, THREADS, M, N, K, FLOPS, BYTES )
+#endif
+//*************************************************************************************************
+
+#endif
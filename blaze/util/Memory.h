@@ -48,6 +48,7 @@
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/Exception.h>
+#include <blaze/util/MemoryResource.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/AlignmentOf.h>
 #include <blaze/util/typetraits/IsBuiltin.h>
@@ -63,7 +64,7 @@ namespace blaze {
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Backend implementation for aligned array allocation.
+/*!\brief System-specific aligned array allocation.
 // \ingroup util
 //
 // \param size The number of bytes to be allocated.
@@ -73,9 +74,9 @@ namespace blaze {
 //
 // This function provides the functionality to allocate memory based on the given alignment
 // restrictions. For that purpose it uses the according system-specific memory allocation
-// functions.
+// functions, independent of any active memory resource.
 */
-inline byte_t* allocate_backend( size_t size, size_t alignment )
+inline byte_t* system_allocate_backend( size_t size, size_t alignment )
 {
    void* raw( nullptr );
 
@@ -100,16 +101,17 @@ inline byte_t* allocate_backend( size_t size, size_t alignment )
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Backend implementation for the deallocation of aligned memory.
+/*!\brief System-specific deallocation of aligned memory.
 // \ingroup util
 //
 // \param address The address of the first element of the array to be deallocated.
 // \return void
 //
-// This function deallocates the given memory that was previously allocated via the allocate()
-// function. For that purpose it uses the according system-specific memory deallocation functions.
+// This function deallocates the given memory that was previously allocated via the
+// system_allocate_backend() function. For that purpose it uses the according system-specific
+// memory deallocation functions.
 */
-inline void deallocate_backend( const void* address ) noexcept
+inline void system_deallocate_backend( const void* address ) noexcept
 {
 #if BLAZE_WIN32_PLATFORM || BLAZE_WIN64_PLATFORM || BLAZE_MINGW64_PLATFORM
    _aligned_free( const_cast<void*>( address ) );
@@ -123,6 +125,60 @@ inline void deallocate_backend( const void* address ) noexcept
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation for aligned array allocation.
+// \ingroup util
+//
+// \param size The number of bytes to be allocated.
+// \param alignment The required minimum alignment.
+// \return Byte pointer to the first element of the aligned array.
+// \exception std::bad_alloc Allocation failed.
+//
+// This function provides the functionality to allocate memory based on the given alignment
+// restrictions. In case a memory resource is active for the calling thread (see
+// MemoryResourceSection), the memory is drawn from this memory resource. Otherwise the
+// according system-specific memory allocation functions are used.
+*/
+inline byte_t* allocate_backend( size_t size, size_t alignment )
+{
+   if( MemoryResource* const resource = MemoryResourceSection::active() ) {
+      return resource->allocate( size, alignment );
+   }
+
+   return system_allocate_backend( size, alignment );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation for the deallocation of aligned memory.
+// \ingroup util
+//
+// \param address The address of the first element of the array to be deallocated.
+// \return void
+//
+// This function deallocates the given memory that was previously allocated via the allocate()
+// function. Memory owned by an active memory resource of the calling thread or belonging to a
+// registered memory range of any memory resource (see MemoryResource::registered()) is released
+// in bulk by the memory resource and is therefore ignored. All other memory is deallocated via
+// the according system-specific memory deallocation functions. Note that both checks are free
+// of locks, i.e. concurrent deallocations of different threads do not contend with each other.
+*/
+inline void deallocate_backend( const void* address ) noexcept
+{
+   if( MemoryResourceSection::owns( address ) || MemoryResource::registered( address ) ) {
+      return;
+   }
+
+   system_deallocate_backend( address );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
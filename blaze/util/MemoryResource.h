@@ -0,0 +1,483 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/MemoryResource.h
+//  \brief Header file for the MemoryResource interface and the MemoryResourceSection class
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_UTIL_MEMORYRESOURCE_H_
+#define _BLAZE_UTIL_MEMORYRESOURCE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS MEMORYRESOURCE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Interface for memory resources that replace the default aligned heap allocation.
+// \ingroup util
+//
+// A MemoryResource provides the memory for all aligned allocations of the calling thread while
+// it is active (see MemoryResourceSection). This includes the memory of all dynamic vectors and
+// matrices, of all sparse vectors and matrices, and of all temporaries created during the
+// evaluation of expressions. Memory handed out by a memory resource is never returned to it
+// individually: Deallocations of memory for which owns() returns \a true are ignored, i.e. the
+// memory resource is responsible to release its memory in bulk (see for instance Arena).
+//
+// Memory resources should additionally register their memory ranges via registerMemory(). The
+// deallocation of registered memory is ignored in any thread and independent of the currently
+// active sections, e.g. in case a vector that has been allocated within an arena section is
+// resized or destroyed after the section has been left.
+*/
+class MemoryResource
+{
+ public:
+   //**Memory management functions*****************************************************************
+   /*!\name Memory management functions */
+   //@{
+   virtual byte_t* allocate( size_t size, size_t alignment ) = 0;
+   virtual bool    owns( const void* address ) const noexcept = 0;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline bool registered( const void* address ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+ protected:
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   ~MemoryResource() = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Registration functions**********************************************************************
+   /*!\name Registration functions */
+   //@{
+   static inline void registerMemory( const byte_t* begin, const byte_t* end );
+   static inline void unregisterMemory( const byte_t* begin ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**struct Range********************************************************************************
+   /*!\brief A slot for a registered memory range.
+   //
+   // Slots are never destroyed. In case a memory range is unregistered, the slot is marked as
+   // free and is reused by the next registration.
+   */
+   struct Range
+   {
+      std::atomic<const byte_t*> begin{ nullptr };  //!< The first byte of the memory range.
+                                                    /*!< \c nullptr in case the slot is free. */
+      std::atomic<const byte_t*> end{ nullptr };    //!< One past the last byte of the memory range.
+      Range* next{ nullptr };                       //!< The next slot of the registry.
+   };
+   //**********************************************************************************************
+
+   //**struct Registry*****************************************************************************
+   /*!\brief The global registry of the memory ranges of all memory resources.
+   //
+   // The registry is a singly linked list of range slots. Slots are only added at the head and
+   // are never removed, which enables the lookup of memory ranges without any synchronization.
+   // The mutex only serializes the registration and unregistration of memory ranges.
+   */
+   struct Registry
+   {
+      std::mutex mutex;                     //!< Synchronization of the registrations.
+      std::atomic<Range*> head{ nullptr };  //!< The first slot of the registry.
+      std::atomic<size_t> size{ 0UL };      //!< The number of registered memory ranges.
+   };
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline Registry& registry() noexcept;
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MEMORYRESOURCE UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the given memory belongs to a registered memory range.
+//
+// \param address The address of the memory.
+// \return \a true in case the memory belongs to a registered memory range, \a false if not.
+//
+// This function does not acquire any lock and can therefore be called concurrently by any number
+// of threads without contention. In case no memory range is registered, it returns immediately.
+*/
+inline bool MemoryResource::registered( const void* address ) noexcept
+{
+   Registry& reg( registry() );
+
+   if( reg.size.load( std::memory_order_acquire ) == 0UL )
+      return false;
+
+   const byte_t* const ptr( static_cast<const byte_t*>( address ) );
+
+   for( const Range* range=reg.head.load( std::memory_order_acquire ); range!=nullptr; range=range->next )
+   {
+      const byte_t* const begin( range->begin.load( std::memory_order_acquire ) );
+
+      if( begin != nullptr && begin <= ptr && ptr < range->end.load( std::memory_order_relaxed ) )
+         return true;
+   }
+
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Registers the given memory range.
+//
+// \param begin The first byte of the memory range.
+// \param end One past the last byte of the memory range.
+// \return void
+// \exception std::bad_alloc Registration failed.
+//
+// The memory range is stored in a free slot of the registry. Only in case no free slot is
+// available, a new slot is allocated and published at the head of the registry.
+*/
+inline void MemoryResource::registerMemory( const byte_t* begin, const byte_t* end )
+{
+   Registry& reg( registry() );
+
+   std::lock_guard<std::mutex> lock( reg.mutex );
+
+   Range* range( reg.head.load( std::memory_order_relaxed ) );
+
+   while( range != nullptr && range->begin.load( std::memory_order_relaxed ) != nullptr ) {
+      range = range->next;
+   }
+
+   if( range == nullptr ) {
+      range = new Range();
+      range->next = reg.head.load( std::memory_order_relaxed );
+      range->end.store( end, std::memory_order_relaxed );
+      range->begin.store( begin, std::memory_order_relaxed );
+      reg.head.store( range, std::memory_order_release );
+   }
+   else {
+      range->end.store( end, std::memory_order_relaxed );
+      range->begin.store( begin, std::memory_order_release );
+   }
+
+   reg.size.store( reg.size.load( std::memory_order_relaxed ) + 1UL, std::memory_order_release );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Unregisters the memory range starting at the given address.
+//
+// \param begin The first byte of the memory range.
+// \return void
+//
+// The slot of the memory range is marked as free, but is not destroyed.
+*/
+inline void MemoryResource::unregisterMemory( const byte_t* begin ) noexcept
+{
+   Registry& reg( registry() );
+
+   std::lock_guard<std::mutex> lock( reg.mutex );
+
+   for( Range* range=reg.head.load( std::memory_order_relaxed ); range!=nullptr; range=range->next )
+   {
+      if( range->begin.load( std::memory_order_relaxed ) == begin ) {
+         range->begin.store( nullptr, std::memory_order_release );
+         reg.size.store( reg.size.load( std::memory_order_relaxed ) - 1UL, std::memory_order_release );
+         return;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the global registry of the memory ranges.
+//
+// \return Reference to the global registry.
+//
+// The registry and its range slots are intentionally never destroyed, such that memory resources
+// with static storage duration can safely unregister their memory on destruction and such that
+// concurrent lookups never access destroyed slots.
+*/
+inline MemoryResource::Registry& MemoryResource::registry() noexcept
+{
+   static Registry* const reg( new Registry() );
+   return *reg;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS MEMORYRESOURCESECTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Section to activate a memory resource for the calling thread.
+// \ingroup util
+//
+// The MemoryResourceSection class activates the given memory resource for the calling thread
+// for its lifetime. Sections can be nested, in which case the innermost section determines the
+// memory resource for all allocations. On deallocation, the memory resources of all active
+// sections of the calling thread are queried whether they own the given memory, and memory in
+// registered memory ranges is recognized independent of any section (see MemoryResource). A section
+// created for \c nullptr temporarily restores the default heap allocation, e.g. for objects
+// that outlive the active memory resource. Note that memory resources are only active within
+// the calling thread, i.e. the threads of the SMP backends always use the default allocation.
+*/
+class MemoryResourceSection
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline MemoryResourceSection( MemoryResource& resource ) noexcept;
+   explicit inline MemoryResourceSection( std::nullptr_t ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~MemoryResourceSection();
+   //@}
+   //**********************************************************************************************
+
+   //**Forbidden operations************************************************************************
+   /*!\name Forbidden operations */
+   //@{
+   MemoryResourceSection( const MemoryResourceSection& ) = delete;
+   MemoryResourceSection( MemoryResourceSection&& ) = delete;
+
+   MemoryResourceSection& operator=( const MemoryResourceSection& ) = delete;
+   MemoryResourceSection& operator=( MemoryResourceSection&& ) = delete;
+   //@}
+   //**********************************************************************************************
+
+   //**Conversion operator*************************************************************************
+   /*!\name Conversion operator */
+   //@{
+   explicit inline operator bool() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline MemoryResource* active() noexcept;
+   static inline bool            owns( const void* address ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline MemoryResourceSection*& top() noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   MemoryResource*        resource_;  //!< The memory resource of the section.
+   MemoryResourceSection* previous_;  //!< The enclosing section of the calling thread.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Activates the given memory resource for the calling thread.
+//
+// \param resource The memory resource to be activated.
+*/
+inline MemoryResourceSection::MemoryResourceSection( MemoryResource& resource ) noexcept
+   : resource_( &resource )  // The memory resource of the section
+   , previous_( top()     )  // The enclosing section of the calling thread
+{
+   top() = this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Restores the default heap allocation for the calling thread.
+*/
+inline MemoryResourceSection::MemoryResourceSection( std::nullptr_t ) noexcept
+   : resource_( nullptr )  // The memory resource of the section
+   , previous_( top()   )  // The enclosing section of the calling thread
+{
+   top() = this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Destructor of the MemoryResourceSection class.
+//
+// The destructor reactivates the memory resource of the enclosing section.
+*/
+inline MemoryResourceSection::~MemoryResourceSection()
+{
+   top() = previous_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONVERSION OPERATOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Conversion operator to \a bool.
+//
+// The conversion operator always returns \a true. It enables the use of the section within
+// the condition of an if statement (see BLAZE_ARENA_SECTION).
+*/
+inline MemoryResourceSection::operator bool() const noexcept
+{
+   return true;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the active memory resource of the calling thread.
+//
+// \return Pointer to the active memory resource, \c nullptr in case of the default allocation.
+*/
+inline MemoryResource* MemoryResourceSection::active() noexcept
+{
+   MemoryResourceSection* const section( top() );
+   return ( section != nullptr ? section->resource_ : nullptr );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given memory is owned by an active memory resource.
+//
+// \param address The address of the memory.
+// \return \a true in case the memory is owned by an active memory resource, \a false if not.
+*/
+inline bool MemoryResourceSection::owns( const void* address ) noexcept
+{
+   for( const MemoryResourceSection* section=top(); section!=nullptr; section=section->previous_ ) {
+      if( section->resource_ != nullptr && section->resource_->owns( address ) )
+         return true;
+   }
+
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the innermost section of the calling thread.
+//
+// \return Reference to the pointer to the innermost section of the calling thread.
+*/
+inline MemoryResourceSection*& MemoryResourceSection::top() noexcept
+{
+   thread_local MemoryResourceSection* section( nullptr );
+   return section;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,479 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/Numa.h
+//  \brief Header file for the NUMA topology, thread pinning, and memory placement functionality
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_NUMA_H_
+#define _BLAZE_UTIL_NUMA_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/system/Platform.h>
+
+#if BLAZE_LINUX_PLATFORM
+#  include <sched.h>
+#  include <sys/syscall.h>
+#  include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <blaze/util/Exception.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  NUMA POLICY
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Memory placement policies for the dynamic dense vectors and matrices.
+// \ingroup util
+//
+// The NUMA policy determines how the memory of large DynamicVector and DynamicMatrix instances
+// is distributed among the NUMA nodes of the system (see setNumaPolicy()):
+//
+//  - \c none: The memory is placed by the operating system, i.e. typically on the NUMA node of
+//    the thread that touches a memory page first.
+//  - \c firstTouch: The memory of large vectors and matrices is initialized in parallel, using
+//    the same partitioning as the SMP assignment, such that each memory page is placed on the
+//    NUMA node of the thread that subsequently works on it (default on NUMA systems).
+//  - \c interleave: The memory pages of large vectors and matrices are distributed round-robin
+//    among all NUMA nodes. This policy is only available on Linux systems.
+*/
+enum class NumaPolicy : int
+{
+   none       = 0,  //!< No NUMA-specific memory placement.
+   firstTouch = 1,  //!< Parallel first-touch initialization of large vectors and matrices.
+   interleave = 2   //!< Page-wise interleaving of large vectors and matrices across NUMA nodes.
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NUMA TOPOLOGY
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Parsing a list of CPUs or NUMA nodes.
+// \ingroup util
+//
+// \param list The list in the Linux cpulist format (e.g. "0-3,8,10-11").
+// \return The list of indices in the given order.
+// \exception std::invalid_argument Invalid list.
+//
+// This function parses the given comma-separated list of indices and index ranges. Leading and
+// trailing whitespace is ignored. In case the list is empty or cannot be parsed, a
+// \a std::invalid_argument exception is thrown.
+*/
+inline std::vector<size_t> parseCpuList( const std::string& list )
+{
+   const char* const whitespace( " \t\r\n" );
+
+   const size_t listBegin( list.find_first_not_of( whitespace ) );
+
+   if( listBegin == std::string::npos ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid CPU list" );
+   }
+
+   const size_t listEnd( list.find_last_not_of( whitespace ) + 1UL );
+
+   std::vector<size_t> cpus;
+
+   for( size_t pos=listBegin; pos<=listEnd; )
+   {
+      const size_t next( std::min( list.find( ',', pos ), listEnd ) );
+      const std::string item( list.substr( pos, next-pos ) );
+      const size_t dash( item.find( '-' ) );
+
+      const std::string first( item.substr( 0UL, dash ) );
+      const std::string last ( dash == std::string::npos ? first : item.substr( dash+1UL ) );
+
+      if( first.empty() || last.empty() ||
+          first.find_first_not_of( "0123456789" ) != std::string::npos ||
+          last.find_first_not_of( "0123456789" ) != std::string::npos ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid CPU list" );
+      }
+
+      const size_t begin( std::stoul( first ) );
+      const size_t end  ( std::stoul( last  ) );
+
+      if( begin > end ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid CPU list" );
+      }
+
+      for( size_t cpu=begin; cpu<=end; ++cpu ) {
+         cpus.push_back( cpu );
+      }
+
+      pos = next + 1UL;
+   }
+
+   return cpus;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Detects the NUMA topology of the system.
+// \ingroup util
+//
+// \return The CPUs of all NUMA nodes of the system.
+//
+// On Linux systems the topology is read from \c /sys/devices/system/node. NUMA nodes without
+// CPUs are ignored. On all other systems, or in case the topology cannot be determined, the
+// system is treated as a single NUMA node containing all hardware threads.
+*/
+inline std::vector< std::vector<size_t> > detectNumaTopology()
+{
+   std::vector< std::vector<size_t> > nodes;
+
+#if BLAZE_LINUX_PLATFORM
+   try {
+      std::ifstream online( "/sys/devices/system/node/online" );
+      std::string list;
+
+      if( online && std::getline( online, list ) )
+      {
+         for( size_t node : parseCpuList( list ) )
+         {
+            const std::string path( "/sys/devices/system/node/node" + std::to_string( node ) );
+            std::ifstream file( path + "/cpulist" );
+            std::string cpus;
+
+            if( file && std::getline( file, cpus ) && cpus.find_first_of( "0123456789" ) != std::string::npos ) {
+               nodes.push_back( parseCpuList( cpus ) );
+            }
+         }
+      }
+   }
+   catch( ... ) {
+      nodes.clear();
+   }
+#endif
+
+   if( nodes.empty() )
+   {
+      const size_t threads( std::max( 1U, std::thread::hardware_concurrency() ) );
+
+      nodes.emplace_back();
+      for( size_t cpu=0UL; cpu<threads; ++cpu ) {
+         nodes.back().push_back( cpu );
+      }
+   }
+
+   return nodes;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the NUMA topology of the system.
+// \ingroup util
+//
+// \return The CPUs of all NUMA nodes of the system.
+//
+// This function returns the CPUs of all NUMA nodes of the system, where the \f$ i \f$-th entry
+// contains the CPUs of the \f$ i \f$-th NUMA node. The topology is detected once, on the first
+// call of the function.
+*/
+inline const std::vector< std::vector<size_t> >& numaTopology()
+{
+   static const std::vector< std::vector<size_t> > topology( detectNumaTopology() );
+   return topology;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of NUMA nodes of the system.
+// \ingroup util
+//
+// \return The number of NUMA nodes (at least 1).
+*/
+inline size_t numaNodes()
+{
+   return numaTopology().size();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  THREAD PINNING
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Pins the calling thread to the given CPU.
+// \ingroup util
+//
+// \param cpu The index of the CPU.
+// \return \a true in case the thread was pinned, \a false if not.
+//
+// This function restricts the execution of the calling thread to the given CPU. Thread pinning
+// is only supported on Linux systems. On all other systems the function has no effect and
+// returns \a false.
+*/
+inline bool pinThread( size_t cpu ) noexcept
+{
+#if BLAZE_LINUX_PLATFORM
+   if( cpu >= CPU_SETSIZE )
+      return false;
+
+   cpu_set_t set;
+   CPU_ZERO( &set );
+   CPU_SET( cpu, &set );
+
+   return sched_setaffinity( 0, sizeof( set ), &set ) == 0;
+#else
+   MAYBE_UNUSED( cpu );
+   return false;
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MEMORY PLACEMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Distributes the memory pages of the given memory range among all NUMA nodes.
+// \ingroup util
+//
+// \param address The first byte of the memory range.
+// \param bytes The size of the memory range in bytes.
+// \return \a true in case the memory policy was changed, \a false if not.
+//
+// This function sets an interleaved memory policy for all memory pages that are completely
+// contained in the given memory range, i.e. the pages are distributed round-robin among all
+// NUMA nodes of the system. Pages that have already been touched are migrated accordingly.
+// The function is only supported on Linux systems with more than one NUMA node. Otherwise it
+// has no effect and returns \a false.
+*/
+inline bool interleaveMemory( void* address, size_t bytes ) noexcept
+{
+#if BLAZE_LINUX_PLATFORM && defined(SYS_mbind)
+   constexpr int mpolInterleave( 3 );      // MPOL_INTERLEAVE
+   constexpr unsigned mpolMoveFlag( 2U );  // MPOL_MF_MOVE
+   constexpr size_t bits( 8UL*sizeof(unsigned long) );
+
+   if( address == nullptr || numaNodes() < 2UL )
+      return false;
+
+   const size_t page ( static_cast<size_t>( sysconf( _SC_PAGESIZE ) ) );
+   const size_t first( ( reinterpret_cast<size_t>( address ) + page - 1UL ) & ~( page - 1UL ) );
+   const size_t last ( ( reinterpret_cast<size_t>( address ) + bytes ) & ~( page - 1UL ) );
+
+   if( first >= last )
+      return false;
+
+   std::vector<unsigned long> mask;
+
+   try {
+      std::ifstream online( "/sys/devices/system/node/online" );
+      std::string list;
+
+      if( !online || !std::getline( online, list ) )
+         return false;
+
+      for( size_t node : parseCpuList( list ) ) {
+         if( mask.size() <= node/bits ) mask.resize( node/bits+1UL, 0UL );
+         mask[node/bits] |= ( 1UL << ( node%bits ) );
+      }
+   }
+   catch( ... ) {
+      return false;
+   }
+
+   return syscall( SYS_mbind, first, last-first, mpolInterleave, mask.data(),
+                   mask.size()*bits+1UL, mpolMoveFlag ) == 0;
+#else
+   MAYBE_UNUSED( address, bytes );
+   return false;
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the NUMA policy selected at program startup.
+// \ingroup util
+//
+// \return The NUMA policy selected at program startup.
+//
+// The initial NUMA policy can be specified via the \c BLAZE_NUMA_POLICY environment variable,
+// which may be set to \c none, \c firsttouch, or \c interleave. In case the environment
+// variable is not set or cannot be parsed, the first-touch policy is selected on systems with
+// more than one NUMA node and no NUMA-specific placement is performed on all other systems.
+*/
+#if (defined _MSC_VER)
+#  pragma warning(push)
+#  pragma warning(disable:4996)
+#endif
+inline NumaPolicy initialNumaPolicy()
+{
+   const char* env = std::getenv( "BLAZE_NUMA_POLICY" );
+
+   if( env != nullptr ) {
+      if     ( std::strcmp( env, "none"       ) == 0 ) return NumaPolicy::none;
+      else if( std::strcmp( env, "firsttouch" ) == 0 ) return NumaPolicy::firstTouch;
+      else if( std::strcmp( env, "interleave" ) == 0 ) return NumaPolicy::interleave;
+   }
+
+   return ( numaNodes() > 1UL ) ? NumaPolicy::firstTouch : NumaPolicy::none;
+}
+#if (defined _MSC_VER)
+#  pragma warning(pop)
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the storage of the currently selected NUMA policy.
+// \ingroup util
+//
+// \return Reference to the atomic storage of the currently selected NUMA policy.
+*/
+inline std::atomic<NumaPolicy>& numaPolicyStorage()
+{
+   static std::atomic<NumaPolicy> policy( initialNumaPolicy() );
+   return policy;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the NUMA policy for the memory of large dynamic vectors and matrices.
+// \ingroup util
+//
+// \return The currently selected NUMA policy.
+*/
+inline NumaPolicy getNumaPolicy()
+{
+   return numaPolicyStorage().load( std::memory_order_relaxed );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Selects the NUMA policy for the memory of large dynamic vectors and matrices.
+// \ingroup util
+//
+// \param policy The NUMA policy to be used for all subsequent allocations.
+// \return void
+//
+// This function selects the policy for the placement of the memory of all subsequently created
+// or resized DynamicVector and DynamicMatrix instances (see the NumaPolicy description). The
+// policy can also be specified via the \c BLAZE_NUMA_POLICY environment variable:
+
+   \code
+   blaze::setNumaPolicy( blaze::NumaPolicy::interleave );
+
+   blaze::DynamicMatrix<double> A( 20000UL, 20000UL );  // Pages distributed among all nodes
+   \endcode
+*/
+inline void setNumaPolicy( NumaPolicy policy )
+{
+   numaPolicyStorage().store( policy, std::memory_order_relaxed );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Aligned array allocation according to the active NUMA policy.
+// \ingroup util
+//
+// \param size The number of elements of the given type to allocate.
+// \return Pointer to the first element of the aligned array.
+// \exception std::bad_alloc Allocation failed.
+//
+// This function allocates an aligned array via the allocate() function. In case the interleaved
+// NUMA policy is active and the array spans at least one memory page per NUMA node, the memory
+// pages of the array are distributed among all NUMA nodes (see interleaveMemory()). Memory drawn
+// from an active memory resource (see MemoryResourceSection) is never interleaved. The array
+// has to be deallocated via the deallocate() function.
+*/
+template< typename T >
+T* numaAllocate( size_t size )
+{
+   T* const address( allocate<T>( size ) );
+
+#if BLAZE_LINUX_PLATFORM
+   if( MemoryResourceSection::active() == nullptr &&
+       getNumaPolicy() == NumaPolicy::interleave &&
+       size*sizeof(T) >= numaNodes() * static_cast<size_t>( sysconf( _SC_PAGESIZE ) ) ) {
+      interleaveMemory( address, size*sizeof(T) );
+   }
+#endif
+
+   return address;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
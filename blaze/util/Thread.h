@@ -260,7 +260,7 @@ class Thread
    //**Constructors********************************************************************************
    /*!\name Constructors */
    //@{
-   explicit Thread( ThreadPoolType* pool );
+   explicit Thread( ThreadPoolType* pool, size_t id );
    //@}
    //**********************************************************************************************
 
@@ -311,6 +311,7 @@ class Thread
                                       pool to learn whether the thread has terminated
                                       its execution. */
    ThreadPoolType* pool_;        //!< Handle to the managing thread pool.
+   size_t          id_;          //!< Index of the thread within the managing thread pool.
    ThreadHandle    thread_;      //!< Handle to the thread of execution.
    //@}
    //**********************************************************************************************
@@ -336,6 +337,7 @@ class Thread
 /*!\brief Starting a thread in a thread pool.
 //
 // \param pool Handle to the managing thread pool.
+// \param id Index of the thread within the managing thread pool.
 //
 // This function creates a new thread in the given thread pool. The thread is kept alive until
 // explicitly killed by the managing thread pool.
@@ -344,9 +346,10 @@ template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
         , typename LT    // Type of the mutex lock
         , typename CT >  // Type of the condition variable
-Thread<TT,MT,LT,CT>::Thread( ThreadPoolType* pool )
+Thread<TT,MT,LT,CT>::Thread( ThreadPoolType* pool, size_t id )
    : terminated_( false   )  // Thread termination flag
    , pool_      ( pool    )  // Handle to the managing thread pool
+   , id_        ( id      )  // Index of the thread within the managing thread pool
    , thread_    ( nullptr )  // Handle to the thread of execution
 {
    thread_.reset( new ThreadType( std::bind( &Thread::run, this ) ) );
@@ -371,6 +374,7 @@ template< typename Callable   // Type of the function/functor
         , typename... Args >  // Types of the function/functor arguments
 inline Thread<TT,MT,LT,CT>::Thread( Callable func, Args&&... args )
    : pool_  ( nullptr )  // Handle to the managing thread pool
+   , id_    ( 0UL     )  // Index of the thread within the managing thread pool
    , thread_( nullptr )  // Handle to the thread of execution
 {
    thread_.reset( new ThreadType( func, std::forward<Args>( args )... ) );
@@ -486,8 +490,11 @@ void Thread<TT,MT,LT,CT>::run()
    // Checking the thread pool handle
    BLAZE_INTERNAL_ASSERT( pool_, "Uninitialized pool handle detected" );
 
+   // Initializing the thread
+   pool_->initThread( id_ );
+
    // Executing scheduled tasks
-   while( pool_->executeTask() ) {}
+   while( pool_->executeTask( id_ ) ) {}
 
    // Setting the termination flag
    terminated_ = true;
@@ -0,0 +1,406 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/ThreadAffinity.h
+//  \brief Header file for the ThreadAffinity class
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_THREADAFFINITY_H_
+#define _BLAZE_UTIL_THREADAFFINITY_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <string>
+#include <utility>
+#include <vector>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Exception.h>
+#include <blaze/util/Numa.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Thread affinity policies.
+// \ingroup util
+*/
+enum class AffinityPolicy : int
+{
+   none    = 0,  //!< The threads are not pinned.
+   compact = 1,  //!< The threads are pinned to consecutive CPUs, filling one NUMA node at a time.
+   scatter = 2,  //!< The threads are pinned round-robin to the CPUs of all NUMA nodes.
+   list    = 3   //!< The threads are pinned to an explicitly given list of CPUs.
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Mapping of threads to CPUs.
+// \ingroup util
+//
+// The ThreadAffinity class represents the mapping of the threads of a thread pool to the CPUs
+// of the system. The mapping is determined by an affinity policy (see AffinityPolicy): The
+// \c compact policy fills the CPUs of one NUMA node before moving on to the next node, the
+// \c scatter policy distributes consecutive threads round-robin among all NUMA nodes, and the
+// \c list policy uses an explicitly given list of CPUs. In all cases the \f$ i \f$-th thread
+// is pinned to the \f$ i \f$-th CPU of the resulting list (modulo the length of the list):
+
+   \code
+   using blaze::ThreadAffinity;
+   using blaze::AffinityPolicy;
+
+   ThreadAffinity a1( AffinityPolicy::scatter );  // Spreading the threads among all sockets
+   ThreadAffinity a2( "0-7,16-23" );              // Explicit list of CPUs
+   ThreadAffinity a3( "compact" );                // Filling one socket after another
+
+   blaze::setThreadAffinity( a1 );
+   \endcode
+
+// Note that the NUMA topology can only be detected and threads can only be pinned on Linux
+// systems. On all other systems the affinity has no effect.
+*/
+class ThreadAffinity
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline ThreadAffinity() noexcept;
+   explicit inline ThreadAffinity( AffinityPolicy policy );
+   explicit inline ThreadAffinity( std::vector<size_t> cpus );
+   explicit inline ThreadAffinity( const std::string& spec );
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Get functions*******************************************************************************
+   /*!\name Get functions */
+   //@{
+   inline AffinityPolicy             policy() const noexcept;
+   inline const std::vector<size_t>& cpus  () const noexcept;
+   inline size_t                     cpu   ( size_t index ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline bool apply( size_t index ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline std::vector<size_t> resolve( AffinityPolicy policy );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   AffinityPolicy      policy_;  //!< The affinity policy.
+   std::vector<size_t> cpus_;    //!< The CPUs in the order of the thread indices.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for ThreadAffinity.
+//
+// The default affinity doesn't pin any thread.
+*/
+inline ThreadAffinity::ThreadAffinity() noexcept
+   : policy_( AffinityPolicy::none )  // The affinity policy
+   , cpus_  ()                        // The CPUs in the order of the thread indices
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a policy-based thread affinity.
+//
+// \param policy The affinity policy (\c none, \c compact, or \c scatter).
+// \exception std::invalid_argument Invalid affinity policy.
+//
+// In case the \c list policy is specified, a \a std::invalid_argument exception is thrown.
+*/
+inline ThreadAffinity::ThreadAffinity( AffinityPolicy policy )
+   : policy_( policy )            // The affinity policy
+   , cpus_  ( resolve( policy ) ) // The CPUs in the order of the thread indices
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for an explicit list of CPUs.
+//
+// \param cpus The list of CPUs in the order of the thread indices.
+// \exception std::invalid_argument Invalid list of CPUs.
+//
+// In case the given list is empty, a \a std::invalid_argument exception is thrown.
+*/
+inline ThreadAffinity::ThreadAffinity( std::vector<size_t> cpus )
+   : policy_( AffinityPolicy::list )  // The affinity policy
+   , cpus_  ( std::move( cpus ) )     // The CPUs in the order of the thread indices
+{
+   if( cpus_.empty() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid list of CPUs" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a textual specification of the thread affinity.
+//
+// \param spec The specification (\c none, \c compact, \c scatter, or a list of CPUs).
+// \exception std::invalid_argument Invalid thread affinity.
+//
+// The list of CPUs is given in the Linux cpulist format (e.g. "0-3,8,10-11"). In case the
+// specification cannot be parsed, a \a std::invalid_argument exception is thrown.
+*/
+inline ThreadAffinity::ThreadAffinity( const std::string& spec )
+   : ThreadAffinity()
+{
+   if( spec == "none" ) {
+      return;
+   }
+   else if( spec == "compact" ) {
+      policy_ = AffinityPolicy::compact;
+   }
+   else if( spec == "scatter" ) {
+      policy_ = AffinityPolicy::scatter;
+   }
+   else {
+      *this = ThreadAffinity( parseCpuList( spec ) );
+      return;
+   }
+
+   cpus_ = resolve( policy_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the affinity policy.
+//
+// \return The affinity policy.
+*/
+inline AffinityPolicy ThreadAffinity::policy() const noexcept
+{
+   return policy_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the CPUs in the order of the thread indices.
+//
+// \return The list of CPUs (empty in case of the \c none policy).
+*/
+inline const std::vector<size_t>& ThreadAffinity::cpus() const noexcept
+{
+   return cpus_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the CPU of the thread with the given index.
+//
+// \param index The index of the thread.
+// \return The CPU of the thread.
+//
+// This function must not be called in case of the \c none policy.
+*/
+inline size_t ThreadAffinity::cpu( size_t index ) const
+{
+   BLAZE_USER_ASSERT( !cpus_.empty(), "Invalid access to an empty thread affinity" );
+
+   return cpus_[index % cpus_.size()];
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Pins the calling thread according to its index.
+//
+// \param index The index of the calling thread.
+// \return \a true in case the thread was pinned, \a false if not.
+//
+// This function pins the calling thread to the CPU associated with the given index (see
+// pinThread()). In case of the \c none policy the function has no effect.
+*/
+inline bool ThreadAffinity::apply( size_t index ) const
+{
+   if( cpus_.empty() )
+      return false;
+
+   return pinThread( cpu( index ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the list of CPUs for the given affinity policy.
+//
+// \param policy The affinity policy.
+// \return The CPUs in the order of the thread indices.
+// \exception std::invalid_argument Invalid affinity policy.
+*/
+inline std::vector<size_t> ThreadAffinity::resolve( AffinityPolicy policy )
+{
+   const std::vector< std::vector<size_t> >& nodes( numaTopology() );
+
+   std::vector<size_t> cpus;
+
+   switch( policy )
+   {
+      case AffinityPolicy::none:
+         break;
+
+      case AffinityPolicy::compact:
+         for( const auto& node : nodes ) {
+            cpus.insert( cpus.end(), node.begin(), node.end() );
+         }
+         break;
+
+      case AffinityPolicy::scatter:
+         for( size_t i=0UL, size=0UL; i==0UL || cpus.size() != size; ++i )
+         {
+            size = cpus.size();
+
+            for( const auto& node : nodes ) {
+               if( i < node.size() ) {
+                  cpus.push_back( node[i] );
+               }
+            }
+         }
+         break;
+
+      default:
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid affinity policy" );
+   }
+
+   return cpus;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the thread affinity selected at program startup.
+// \ingroup util
+//
+// \return The thread affinity selected at program startup.
+//
+// The initial thread affinity can be specified via the \c BLAZE_THREAD_AFFINITY environment
+// variable, which may be set to \c none, \c compact, \c scatter, or a list of CPUs (e.g.
+// "0-7,16-23"). In case the environment variable is not set or cannot be parsed, no thread
+// is pinned.
+*/
+#if (defined _MSC_VER)
+#  pragma warning(push)
+#  pragma warning(disable:4996)
+#endif
+inline ThreadAffinity initialThreadAffinity()
+{
+   const char* env = std::getenv( "BLAZE_THREAD_AFFINITY" );
+
+   if( env == nullptr )
+      return ThreadAffinity();
+
+   try {
+      return ThreadAffinity( std::string( env ) );
+   }
+   catch( ... ) {
+      return ThreadAffinity();
+   }
+}
+#if (defined _MSC_VER)
+#  pragma warning(pop)
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
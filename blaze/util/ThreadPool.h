@@ -40,15 +40,19 @@
 // Includes
 //*************************************************************************************************
 
+#include <algorithm>
 #include <functional>
 #include <memory>
+#include <utility>
 #include <vector>
+#include <blaze/util/algorithms/Min.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/Exception.h>
 #include <blaze/util/NonCopyable.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Thread.h>
 #include <blaze/util/threadpool/Task.h>
+#include <blaze/util/threadpool/TaskGroup.h>
 #include <blaze/util/threadpool/TaskQueue.h>
 #include <blaze/util/Types.h>
 
@@ -326,10 +330,15 @@ class ThreadPool
    //**********************************************************************************************
 
  public:
+   //**Type definitions****************************************************************************
+   //! Type of the thread initialization function.
+   using Initializer = std::function<void(size_t)>;
+   //**********************************************************************************************
+
    //**Constructor*********************************************************************************
    /*!\name Constructor */
    //@{
-   explicit ThreadPool( size_t n );
+   explicit ThreadPool( size_t n, Initializer init = Initializer() );
    //@}
    //**********************************************************************************************
 
@@ -362,7 +371,9 @@ class ThreadPool
    /*!\name Utility functions */
    //@{
    void resize( size_t n, bool block=false );
+   void restart();
    void wait();
+   void wait( const threadpool::TaskGroup& group );
    void clear();
    //@}
    //**********************************************************************************************
@@ -372,7 +383,8 @@ class ThreadPool
    /*!\name Thread functions */
    //@{
    void createThread();
-   bool executeTask();
+   void initThread( size_t id );
+   bool executeTask( size_t id );
    //@}
    //**********************************************************************************************
 
@@ -389,6 +401,8 @@ class ThreadPool
    mutable Mutex mutex_;       //!< Synchronization mutex.
    Condition waitForTask_;     //!< Wait condition for idle threads.
    Condition waitForThread_;   //!< Wait condition for the thread management.
+   Initializer init_;          //!< Initialization function for newly created threads.
+   std::vector<bool> ids_;     //!< Flags for the indices currently assigned to threads.
    //@}
    //**********************************************************************************************
 
@@ -413,15 +427,18 @@ class ThreadPool
 /*!\brief Constructor for the ThreadPool class.
 //
 // \param n Initial number of threads \f$[1..\infty)\f$.
+// \param init Optional initialization function for the threads of the pool.
 //
 // This constructor creates a thread pool with initially \a n new threads. All threads are
-// initially idle until a task is scheduled.
+// initially idle until a task is scheduled. In case an initialization function \a init is
+// given, every newly created thread calls it with its index within the thread pool before
+// executing any task (for instance to pin the thread to a specific core).
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
         , typename LT    // Type of the mutex lock
         , typename CT >  // Type of the condition variable
-ThreadPool<TT,MT,LT,CT>::ThreadPool( size_t n )
+ThreadPool<TT,MT,LT,CT>::ThreadPool( size_t n, Initializer init )
    : total_   ( 0UL )  // Total number of threads in the thread pool
    , expected_( 0UL )  // Expected number of threads in the thread pool
    , active_  ( 0UL )  // Number of currently active/busy threads
@@ -430,6 +447,8 @@ ThreadPool<TT,MT,LT,CT>::ThreadPool( size_t n )
    , mutex_        ()  // Synchronization mutex
    , waitForTask_  ()  // Wait condition for idle threads
    , waitForThread_()  // Wait condition for the thread management
+   , init_         ( std::move( init ) )  // Initialization function for newly created threads
+   , ids_          ()  // Flags for the indices currently assigned to threads
 {
    resize( n );
 }
@@ -660,6 +679,11 @@ void ThreadPool<TT,MT,LT,CT>::resize( size_t n, bool block )
 
       // Adding new threads to the thread pool
       if( n > expected_ ) {
+         // Reusing threads that have not yet terminated after a previous shrinking
+         if( total_ > expected_ ) {
+            expected_ = min( n, static_cast<size_t>( total_ ) );
+         }
+
          for( size_t i=expected_; i<n; ++i )
             createThread();
       }
@@ -687,6 +711,49 @@ void ThreadPool<TT,MT,LT,CT>::resize( size_t n, bool block )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Restarting all threads of the thread pool.
+//
+// \return void
+//
+// This function waits for all scheduled tasks to be completed, terminates all threads of the
+// thread pool and replaces them by the same number of new threads. Since every new thread calls
+// the initialization function of the thread pool, this function can be used to reapply a changed
+// thread configuration (as for instance a new thread affinity).
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void ThreadPool<TT,MT,LT,CT>::restart()
+{
+   wait();
+
+   Lock lock( mutex_ );
+
+   const size_t n( expected_ );
+
+   // Terminating all threads
+   expected_ = 0UL;
+   waitForTask_.notify_all();
+
+   while( total_ != 0UL ) {
+      waitForThread_.wait( lock );
+   }
+
+   for( auto const& thread : threads_ ) {
+      thread->join();
+   }
+   threads_.clear();
+
+   // Creating the new threads
+   for( size_t i=0UL; i<n; ++i ) {
+      createThread();
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Waiting for all scheduled tasks to be completed.
 //
@@ -709,6 +776,31 @@ void ThreadPool<TT,MT,LT,CT>::wait()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Waiting for all tasks of the given task group to be completed.
+//
+// \param group The task group to wait for.
+// \return void
+//
+// This function blocks until all tasks of the given task group have been completed. Since the
+// worker threads only signal their state in case they run out of tasks, the function may wait
+// longer than strictly necessary, but never longer than the wait() function.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void ThreadPool<TT,MT,LT,CT>::wait( const threadpool::TaskGroup& group )
+{
+   Lock lock( mutex_ );
+
+   while( !group.ready() && ( !taskqueue_.isEmpty() || active_ > 0UL ) ) {
+      waitForThread_.wait( lock );
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Removing all scheduled tasks from the thread pool.
 //
@@ -741,6 +833,10 @@ void ThreadPool<TT,MT,LT,CT>::clear()
 /*!\brief Adding a new thread to the thread pool.
 //
 // \return void
+//
+// The new thread is assigned the smallest index that is currently not used by any other thread
+// of the thread pool. Thus the indices of all threads remain unique after any sequence of resize
+// operations and indices of terminated threads are reused.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
@@ -748,7 +844,14 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 void ThreadPool<TT,MT,LT,CT>::createThread()
 {
-   threads_.push_back( std::unique_ptr<ManagedThread>( new ManagedThread( this ) ) );
+   const size_t id( std::find( ids_.begin(), ids_.end(), false ) - ids_.begin() );
+
+   if( id == ids_.size() )
+      ids_.push_back( true );
+   else
+      ids_[id] = true;
+
+   threads_.push_back( std::unique_ptr<ManagedThread>( new ManagedThread( this, id ) ) );
    ++total_;
    ++expected_;
    ++active_;
@@ -756,9 +859,32 @@ void ThreadPool<TT,MT,LT,CT>::createThread()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Initializing a newly created thread.
+//
+// \param id The index of the thread within the thread pool.
+// \return void
+//
+// This function is called once by every newly created thread before it starts to execute
+// scheduled tasks. It calls the initialization function of the thread pool (if any).
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void ThreadPool<TT,MT,LT,CT>::initThread( size_t id )
+{
+   if( init_ ) {
+      init_( id );
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Executing a scheduled task.
 //
+// \param id The index of the executing thread within the thread pool.
 // \return \a true in case a task was successfully finished, \a false if not.
 //
 // This function is repeatedly called by every thread to execute one of the scheduled tasks.
@@ -769,7 +895,7 @@ template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
         , typename LT    // Type of the mutex lock
         , typename CT >  // Type of the condition variable
-bool ThreadPool<TT,MT,LT,CT>::executeTask()
+bool ThreadPool<TT,MT,LT,CT>::executeTask( size_t id )
 {
    threadpool::Task task;
 
@@ -783,6 +909,7 @@ bool ThreadPool<TT,MT,LT,CT>::executeTask()
          waitForThread_.notify_all();
 
          if( total_ > expected_ ) {
+            ids_[id] = false;
             --total_;
             return false;
          }
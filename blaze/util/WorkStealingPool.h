@@ -0,0 +1,768 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/WorkStealingPool.h
+//  \brief Header file of the work-stealing thread pool
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_WORKSTEALINGPOOL_H_
+#define _BLAZE_UTIL_WORKSTEALINGPOOL_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Exception.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/threadpool/Task.h>
+#include <blaze/util/threadpool/TaskGroup.h>
+#include <blaze/util/threadpool/WorkStealingDeque.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Implementation of a work-stealing thread pool.
+// \ingroup threads
+//
+// \section workstealingpool_general General
+//
+// The WorkStealingPool class template represents a thread pool with the same interface as the
+// ThreadPool class template, but with a different scheduling strategy that is tailored to a
+// large number of short tasks. Instead of a single, mutex-protected task queue, every worker
+// thread owns a lock-free work-stealing deque (see the threadpool::WorkStealingDeque class
+// template). A worker executes the tasks in its own deque and, in case its own deque runs
+// empty, steals tasks from the deques of the other workers. Tasks that are scheduled by a
+// thread outside the pool are placed in a dedicated submission deque, from which all workers
+// steal. Idle workers first spin for a short time and only then park on a condition variable,
+// which avoids the latency of a wake-up in case of back-to-back tasks.\n
+// In contrast to the ThreadPool class template, the thread calling the wait() function does
+// not block idly, but actively participates in the execution of the scheduled tasks. For that
+// reason, a work-stealing thread pool of size \f$ n \f$ only spawns \f$ n-1 \f$ worker threads.
+// The same four template parameters as for the ThreadPool class template are required:
+
+   \code
+   template< typename TT, typename MT, typename LT, typename CT >
+   class WorkStealingPool;
+   \endcode
+
+//  - TT: specifies the type of the encapsulated thread. This can for instance be \c std::thread
+//        or \c boost::thread.
+//  - MT: specifies the type of the used synchronization mutex.
+//  - LT: specifies the type of lock used in combination with the given mutex type.
+//  - CT: specifies the type of the used condition variable.
+//
+// \section workstealingpool_usage Usage
+//
+// The usage of the work-stealing thread pool is identical to the usage of the ThreadPool class
+// template:
+
+   \code
+   using StdWorkStealingPool = blaze::WorkStealingPool< std::thread
+                                                      , std::mutex
+                                                      , std::unique_lock<std::mutex>
+                                                      , std::condition_variable >;
+
+   StdWorkStealingPool pool( 4 );
+
+   for( size_t i=0UL; i<4UL; ++i ) {
+      pool.schedule( []( size_t i ){ ... }, i );
+   }
+
+   // Participating in the execution of the scheduled tasks until all tasks have been completed
+   pool.wait();
+   \endcode
+
+// \section workstealingpool_restrictions Restrictions
+//
+// The wait() function must not be called from within a scheduled task. Also, the resize()
+// function must not be called while tasks are being executed. As for the ThreadPool class
+// template, exceptions thrown during the execution of a task cannot be propagated to the
+// calling thread and therefore result in a call to \c std::terminate().
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+class WorkStealingPool
+   : private NonCopyable
+{
+ private:
+   //**Type definitions****************************************************************************
+   using Task      = threadpool::Task;                            //!< Type of a single task.
+   using Deque     = threadpool::WorkStealingDeque<Task*>;       //!< Type of the task deques.
+   using Deques    = std::vector< std::unique_ptr<Deque> >;       //!< Type of the deque container.
+   using Threads   = std::vector< std::unique_ptr<TT> >;          //!< Type of the thread container.
+   using Mutex     = MT;                                          //!< Type of the mutex.
+   using Lock      = LT;                                          //!< Type of a locking object.
+   using Condition = CT;                                          //!< Condition variable type.
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   //! Type of the thread initialization function.
+   using Initializer = std::function<void(size_t)>;
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit WorkStealingPool( size_t n, Initializer init = Initializer() );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   ~WorkStealingPool();
+   //@}
+   //**********************************************************************************************
+
+   //**Get functions*******************************************************************************
+   /*!\name Get functions */
+   //@{
+   inline bool   isEmpty() const;
+   inline size_t size()    const;
+   inline size_t pending() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Task scheduling*****************************************************************************
+   /*!\name Task scheduling */
+   //@{
+   template< typename Callable, typename... Args >
+   void schedule( Callable func, Args&&... args );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   void resize( size_t n, bool block=false );
+   void restart();
+   void wait();
+   void wait( const threadpool::TaskGroup& group );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Thread functions****************************************************************************
+   /*!\name Thread functions */
+   //@{
+   void  start  ( size_t n );
+   void  stop   ();
+   void  run    ( size_t id );
+   Task* acquire( size_t id );
+   void  execute( Task* task );
+   void  notify ();
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t size_;                    //!< Total number of threads participating in the execution.
+   Deques deques_;                  //!< The task deques (index 0 is the submission deque).
+   Threads threads_;                //!< The worker threads of the pool.
+   std::atomic<size_t> pending_;    //!< Number of scheduled, but not yet completed tasks.
+   std::atomic<size_t> queued_;     //!< Number of tasks currently stored in the deques.
+   std::atomic<size_t> sleeping_;   //!< Number of currently parked worker threads.
+   std::atomic<bool>   shutdown_;   //!< Termination flag for the worker threads.
+   Mutex submitMutex_;              //!< Synchronization mutex for the submission deque.
+   Mutex parkMutex_;                //!< Synchronization mutex for parked worker threads.
+   Condition waitForTask_;          //!< Wait condition for parked worker threads.
+   Initializer init_;               //!< Initialization function for newly created worker threads.
+
+   static thread_local const WorkStealingPool* pool_;  //!< The pool of the calling worker thread.
+   static thread_local size_t id_;                     //!< The index of the calling worker thread.
+   //@}
+   //**********************************************************************************************
+
+   //**Thread configuration************************************************************************
+   /*!\name Thread configuration */
+   //@{
+   static constexpr size_t spinCount_  = 256UL;   //!< Number of steal attempts before yielding.
+   static constexpr size_t yieldCount_ = 4096UL;  //!< Number of steal attempts before parking.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename TT, typename MT, typename LT, typename CT >
+thread_local const WorkStealingPool<TT,MT,LT,CT>* WorkStealingPool<TT,MT,LT,CT>::pool_ = nullptr;
+
+template< typename TT, typename MT, typename LT, typename CT >
+thread_local size_t WorkStealingPool<TT,MT,LT,CT>::id_ = 0UL;
+
+template< typename TT, typename MT, typename LT, typename CT >
+constexpr size_t WorkStealingPool<TT,MT,LT,CT>::spinCount_;
+
+template< typename TT, typename MT, typename LT, typename CT >
+constexpr size_t WorkStealingPool<TT,MT,LT,CT>::yieldCount_;
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the WorkStealingPool class.
+//
+// \param n Initial number of threads \f$[1..\infty)\f$.
+// \param init Optional initialization function for the worker threads of the pool.
+// \exception std::invalid_argument Invalid number of threads.
+//
+// This constructor creates a work-stealing thread pool with initially \a n participating
+// threads, i.e. \f$ n-1 \f$ worker threads plus the thread calling the wait() function. In
+// case an initialization function \a init is given, every newly created worker thread calls
+// it with its index \f$[1..n)\f$ before executing any task.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+WorkStealingPool<TT,MT,LT,CT>::WorkStealingPool( size_t n, Initializer init )
+   : size_       ( 0UL )    // Total number of threads participating in the execution
+   , deques_     ()         // The task deques
+   , threads_    ()         // The worker threads of the pool
+   , pending_    ( 0UL )    // Number of scheduled, but not yet completed tasks
+   , queued_     ( 0UL )    // Number of tasks currently stored in the deques
+   , sleeping_   ( 0UL )    // Number of currently parked worker threads
+   , shutdown_   ( false )  // Termination flag for the worker threads
+   , submitMutex_()         // Synchronization mutex for the submission deque
+   , parkMutex_  ()         // Synchronization mutex for parked worker threads
+   , waitForTask_()         // Wait condition for parked worker threads
+   , init_       ( std::move( init ) )  // Initialization function for newly created worker threads
+{
+   if( n == 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of threads" );
+   }
+
+   start( n );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Destructor for the WorkStealingPool class.
+//
+// The destructor completes all remaining scheduled tasks and terminates all worker threads.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+WorkStealingPool<TT,MT,LT,CT>::~WorkStealingPool()
+{
+   wait();
+   stop();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether any tasks are scheduled for execution.
+//
+// \return \a true in case no tasks are scheduled, \a false otherwise.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline bool WorkStealingPool<TT,MT,LT,CT>::isEmpty() const
+{
+   return queued_.load( std::memory_order_acquire ) == 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current size of the work-stealing thread pool.
+//
+// \return The total number of threads participating in the execution of tasks.
+//
+// The returned number includes the thread calling the wait() function.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline size_t WorkStealingPool<TT,MT,LT,CT>::size() const
+{
+   return size_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of scheduled, but not yet completed tasks.
+//
+// \return The number of pending tasks.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline size_t WorkStealingPool<TT,MT,LT,CT>::pending() const
+{
+   return pending_.load( std::memory_order_acquire );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TASK SCHEDULING
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Scheduling the given function/functor for execution.
+//
+// \param func The given function/functor.
+// \param args The arguments for the function/functor.
+// \return void
+//
+// This function schedules the given function/functor for execution. In case the function is
+// called by a worker thread of the pool, the task is pushed to the deque of the worker thread
+// without acquiring any lock. Otherwise the task is pushed to the submission deque.
+*/
+template< typename TT         // Type of the encapsulated thread
+        , typename MT         // Type of the synchronization mutex
+        , typename LT         // Type of the mutex lock
+        , typename CT >       // Type of the condition variable
+template< typename Callable   // Type of the function/functor
+        , typename... Args >  // Types of the function/functor arguments
+void WorkStealingPool<TT,MT,LT,CT>::schedule( Callable func, Args&&... args )
+{
+   Task* task( new Task( std::bind<void>( func, std::forward<Args>( args )... ) ) );
+
+   pending_.fetch_add( 1UL, std::memory_order_relaxed );
+
+   if( pool_ == this ) {
+      deques_[id_]->push( task );
+   }
+   else {
+      Lock lock( submitMutex_ );
+      deques_[0UL]->push( task );
+   }
+
+   queued_.fetch_add( 1UL, std::memory_order_seq_cst );
+   notify();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Changes the total number of threads in the work-stealing thread pool.
+//
+// \param n The new number of threads \f$[1..\infty)\f$.
+// \param block \a true if the function shall block, \a false if not.
+// \return void
+// \exception std::invalid_argument Invalid number of threads.
+//
+// This function changes the number of threads participating in the execution of tasks. All
+// currently scheduled tasks are completed before the worker threads are replaced. Since the
+// new worker threads are always available when the function returns, the \a block flag has
+// no effect and is only provided for interface compatibility with the ThreadPool class.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void WorkStealingPool<TT,MT,LT,CT>::resize( size_t n, bool block )
+{
+   MAYBE_UNUSED( block );
+
+   if( n == 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of threads" );
+   }
+
+   if( n == size_ )
+      return;
+
+   wait();
+   stop();
+   start( n );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Restarting all worker threads of the thread pool.
+//
+// \return void
+//
+// This function waits for all scheduled tasks to be completed, terminates all worker threads
+// and replaces them by the same number of new worker threads. Since every new worker thread
+// calls the initialization function of the thread pool, this function can be used to reapply
+// a changed thread configuration (as for instance a new thread affinity).
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void WorkStealingPool<TT,MT,LT,CT>::restart()
+{
+   wait();
+   stop();
+   start( size_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Waiting for all scheduled tasks to be completed.
+//
+// \return void
+//
+// This function blocks until all scheduled tasks have been completed. While waiting, the
+// calling thread participates in the execution of the scheduled tasks.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void WorkStealingPool<TT,MT,LT,CT>::wait()
+{
+   BLAZE_USER_ASSERT( pool_ != this, "Invalid call to wait() from within a task" );
+
+   while( pending_.load( std::memory_order_acquire ) != 0UL )
+   {
+      if( Task* task = acquire( 0UL ) ) {
+         execute( task );
+      }
+      else {
+         std::this_thread::yield();
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Waiting for all tasks of the given task group to be completed.
+//
+// \param group The task group to wait for.
+// \return void
+//
+// This function blocks until all tasks of the given task group have been completed. While
+// waiting, the calling thread participates in the execution of the scheduled tasks. Note that
+// therefore also tasks of other groups may be executed by the calling thread.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void WorkStealingPool<TT,MT,LT,CT>::wait( const threadpool::TaskGroup& group )
+{
+   BLAZE_USER_ASSERT( pool_ != this, "Invalid call to wait() from within a task" );
+
+   while( !group.ready() )
+   {
+      if( Task* task = acquire( 0UL ) ) {
+         execute( task );
+      }
+      else {
+         std::this_thread::yield();
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  THREAD FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creating the task deques and the worker threads.
+//
+// \param n The total number of participating threads.
+// \return void
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void WorkStealingPool<TT,MT,LT,CT>::start( size_t n )
+{
+   BLAZE_INTERNAL_ASSERT( threads_.empty(), "Active worker threads detected" );
+
+   size_ = n;
+   shutdown_.store( false, std::memory_order_relaxed );
+
+   deques_.clear();
+   for( size_t i=0UL; i<n; ++i ) {
+      deques_.emplace_back( new Deque() );
+   }
+
+   for( size_t i=1UL; i<n; ++i ) {
+      threads_.emplace_back( new TT( [this,i]() { run( i ); } ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Terminating all worker threads.
+//
+// \return void
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void WorkStealingPool<TT,MT,LT,CT>::stop()
+{
+   {
+      Lock lock( parkMutex_ );
+      shutdown_.store( true, std::memory_order_seq_cst );
+      waitForTask_.notify_all();
+   }
+
+   for( auto const& thread : threads_ ) {
+      thread->join();
+   }
+
+   threads_.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Execution loop of a single worker thread.
+//
+// \param id The index of the worker thread.
+// \return void
+//
+// The worker thread repeatedly acquires tasks from its own deque or steals tasks from other
+// deques. In case no task is available, the thread spins for a short time, then yields and
+// finally parks until new tasks are scheduled or the pool is shut down.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void WorkStealingPool<TT,MT,LT,CT>::run( size_t id )
+{
+   pool_ = this;
+   id_   = id;
+
+   if( init_ ) {
+      init_( id );
+   }
+
+   size_t attempts( 0UL );
+
+   while( true )
+   {
+      if( Task* task = acquire( id ) ) {
+         execute( task );
+         attempts = 0UL;
+         continue;
+      }
+
+      if( shutdown_.load( std::memory_order_acquire ) )
+         break;
+
+      ++attempts;
+
+      if( attempts < spinCount_ ) {
+         continue;
+      }
+      else if( attempts < yieldCount_ ) {
+         std::this_thread::yield();
+         continue;
+      }
+
+      Lock lock( parkMutex_ );
+      sleeping_.fetch_add( 1UL, std::memory_order_seq_cst );
+      while( queued_.load( std::memory_order_seq_cst ) == 0UL &&
+             !shutdown_.load( std::memory_order_seq_cst ) ) {
+         waitForTask_.wait( lock );
+      }
+      sleeping_.fetch_sub( 1UL, std::memory_order_seq_cst );
+      attempts = 0UL;
+   }
+
+   pool_ = nullptr;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Acquiring a task for the given thread.
+//
+// \param id The index of the calling thread (0 for threads outside the pool).
+// \return Pointer to the acquired task or \a nullptr in case no task is available.
+//
+// This function first tries to acquire a task from the deque of the calling thread. In case
+// this deque is empty, the function attempts to steal a task from the other deques, starting
+// with the right neighbor of the calling thread.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+typename WorkStealingPool<TT,MT,LT,CT>::Task* WorkStealingPool<TT,MT,LT,CT>::acquire( size_t id )
+{
+   if( queued_.load( std::memory_order_acquire ) == 0UL )
+      return nullptr;
+
+   Task* task( nullptr );
+
+   if( id == 0UL ) {
+      Lock lock( submitMutex_ );
+      task = deques_[0UL]->pop();
+   }
+   else {
+      task = deques_[id]->pop();
+   }
+
+   for( size_t i=1UL; task == nullptr && i<size_; ++i ) {
+      task = deques_[(id+i)%size_]->steal();
+   }
+
+   if( task != nullptr ) {
+      queued_.fetch_sub( 1UL, std::memory_order_seq_cst );
+   }
+
+   return task;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Executing the given task.
+//
+// \param task The task to be executed.
+// \return void
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void WorkStealingPool<TT,MT,LT,CT>::execute( Task* task )
+{
+   const std::unique_ptr<Task> ptr( task );
+   (*ptr)();
+   pending_.fetch_sub( 1UL, std::memory_order_acq_rel );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Waking up a parked worker thread.
+//
+// \return void
+//
+// This function wakes up a single parked worker thread in case there are any. In case no worker
+// thread is parked, no lock is acquired.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void WorkStealingPool<TT,MT,LT,CT>::notify()
+{
+   if( sleeping_.load( std::memory_order_seq_cst ) != 0UL ) {
+      Lock lock( parkMutex_ );
+      waitForTask_.notify_one();
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,173 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/kernelprofile/KernelProfile.h
+//  \brief Header file for the KernelProfile class
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_UTIL_KERNELPROFILE_KERNELPROFILE_H_
+#define _BLAZE_UTIL_KERNELPROFILE_KERNELPROFILE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <new>
+#include <blaze/util/kernelprofile/KernelRegistry.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief RAII object for the profiling of a single kernel call.
+// \ingroup util
+//
+// The KernelProfile class is an auxiliary helper class for the profiling of computational
+// kernels. On construction it takes the start time of the kernel call, on destruction it adds
+// the according KernelRecord to the global kernel registry (see kernelRegistry()). In case the
+// recording is disabled at runtime (see KernelRegistry::setEnabled()), no time is taken and no
+// record is added.
+*/
+class KernelProfile
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline KernelProfile( const char* kernel, size_t threads, size_t m, size_t n, size_t k,
+                         double flops, double bytes );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~KernelProfile();
+   //@}
+   //**********************************************************************************************
+
+   //**Forbidden operations************************************************************************
+   /*!\name Forbidden operations */
+   //@{
+   KernelProfile( const KernelProfile& ) = delete;
+   KernelProfile( KernelProfile&& ) = delete;
+
+   KernelProfile& operator=( const KernelProfile& ) = delete;
+   KernelProfile& operator=( KernelProfile&& ) = delete;
+
+   void* operator new  ( std::size_t ) = delete;
+   void* operator new[]( std::size_t ) = delete;
+   void* operator new  ( std::size_t, const std::nothrow_t& ) noexcept = delete;
+   void* operator new[]( std::size_t, const std::nothrow_t& ) noexcept = delete;
+
+   void operator delete  ( void* ) noexcept = delete;
+   void operator delete[]( void* ) noexcept = delete;
+   void operator delete  ( void*, const std::nothrow_t& ) noexcept = delete;
+   void operator delete[]( void*, const std::nothrow_t& ) noexcept = delete;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   bool active_;          //!< Activation flag for the profiling of the kernel call.
+   KernelRecord record_;  //!< The record of the kernel call.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the KernelProfile class.
+//
+// \param kernel The ID of the kernel (has to refer to a string literal).
+// \param threads The number of threads working on the operation.
+// \param m The first dimension of the operation.
+// \param n The second dimension of the operation.
+// \param k The third (inner) dimension of the operation.
+// \param flops The estimated number of floating point operations.
+// \param bytes The estimated number of bytes moved by the kernel.
+*/
+inline KernelProfile::KernelProfile( const char* kernel, size_t threads, size_t m, size_t n,
+                                     size_t k, double flops, double bytes )
+   : active_( kernelRegistry().isEnabled() )                          // Activation flag
+   , record_{ kernel, threads, 0UL, m, n, k, flops, bytes, 0.0, 0.0 }  // The record of the kernel call
+{
+   if( active_ ) {
+      record_.thread = KernelRegistry::threadIndex();
+      record_.start  = kernelRegistry().now();
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Destructor for the KernelProfile class.
+*/
+inline KernelProfile::~KernelProfile()
+{
+   if( active_ ) {
+      KernelRegistry& registry( kernelRegistry() );
+      record_.time = registry.now() - record_.start;
+      registry.record( record_ );
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
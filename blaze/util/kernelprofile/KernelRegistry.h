@@ -0,0 +1,547 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/kernelprofile/KernelRegistry.h
+//  \brief Header file for the KernelRegistry class
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_UTIL_KERNELPROFILE_KERNELREGISTRY_H_
+#define _BLAZE_UTIL_KERNELPROFILE_KERNELREGISTRY_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Record of a single profiled kernel call.
+// \ingroup util
+//
+// The KernelRecord represents a single call of a profiled computational kernel. It contains the
+// ID of the selected kernel, the dimensions of the operation, the number of threads working on
+// the operation, the index of the calling thread, the start time and the duration of the call,
+// and the estimated number of floating point operations and bytes moved by the kernel.
+*/
+struct KernelRecord
+{
+   const char* kernel;  //!< The ID of the kernel (e.g. "dmatdmatmult.assign.large").
+   size_t threads;      //!< The number of threads working on the operation.
+   size_t thread;       //!< The index of the calling thread.
+   size_t m;            //!< The first dimension of the operation.
+   size_t n;            //!< The second dimension of the operation.
+   size_t k;            //!< The third (inner) dimension of the operation.
+   double flops;        //!< The estimated number of floating point operations.
+   double bytes;        //!< The estimated number of bytes moved by the kernel.
+   double start;        //!< The start time (in seconds since the creation of the registry).
+   double time;         //!< The elapsed time (in seconds).
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Accumulated statistics of all calls of a profiled kernel.
+// \ingroup util
+*/
+struct KernelStatistics
+{
+   size_t calls{ 0UL };  //!< The total number of calls.
+   double flops{ 0.0 };  //!< The total estimated number of floating point operations.
+   double bytes{ 0.0 };  //!< The total estimated number of bytes moved by the kernel.
+   double time { 0.0 };  //!< The total elapsed time (in seconds).
+   double min  { 0.0 };  //!< The minimum elapsed time of a single call (in seconds).
+   double max  { 0.0 };  //!< The maximum elapsed time of a single call (in seconds).
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Registry for the profiling information of computational kernels.
+// \ingroup util
+//
+// The KernelRegistry collects the information about all profiled kernel calls (see the
+// BLAZE_KERNEL_PROFILE macro). For every kernel the registry accumulates the number of calls,
+// the elapsed time and the estimated number of floating point operations and bytes. Additionally
+// it stores the individual records of up to capacity() calls, which can be exported as a Chrome
+// trace (see writeChromeTrace()). The registry is thread-safe and can be accessed via the
+// kernelRegistry() function:
+
+   \code
+   // ... Profiled computations
+
+   std::ofstream json( "profile.json" );
+   blaze::kernelRegistry().writeJSON( json );
+
+   std::ofstream trace( "trace.json" );  // To be loaded via chrome://tracing or Perfetto
+   blaze::kernelRegistry().writeChromeTrace( trace );
+   \endcode
+
+// Note that the registry only contains information in case kernel profiling is activated via
+// the BLAZE_USE_KERNEL_PROFILING switch.
+*/
+class KernelRegistry
+{
+ public:
+   //**Type definitions****************************************************************************
+   using Clock = std::chrono::steady_clock;  //!< Type of the clock used for all time measurements.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline KernelRegistry();
+   //@}
+   //**********************************************************************************************
+
+   //**Forbidden operations************************************************************************
+   /*!\name Forbidden operations */
+   //@{
+   KernelRegistry( const KernelRegistry& ) = delete;
+   KernelRegistry( KernelRegistry&& ) = delete;
+
+   KernelRegistry& operator=( const KernelRegistry& ) = delete;
+   KernelRegistry& operator=( KernelRegistry&& ) = delete;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline bool   isEnabled() const noexcept;
+   inline void   setEnabled( bool enabled ) noexcept;
+   inline size_t capacity() const;
+   inline void   setCapacity( size_t capacity );
+   inline double now() const noexcept;
+   inline void   record( const KernelRecord& record );
+   inline void   clear();
+   inline void   writeJSON( std::ostream& os ) const;
+   inline void   writeChromeTrace( std::ostream& os ) const;
+
+   inline std::vector<KernelRecord>              records() const;
+   inline std::map<std::string,KernelStatistics> statistics() const;
+
+   static inline size_t threadIndex();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline void writeString( std::ostream& os, const char* str );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::atomic<bool>                      enabled_;     //!< Activation flag for the recording of kernel calls.
+   const Clock::time_point                epoch_;       //!< The point in time of the creation of the registry.
+   size_t                                 capacity_;    //!< The maximum number of stored individual records.
+   size_t                                 dropped_;     //!< The number of records exceeding the capacity.
+   std::vector<KernelRecord>              records_;     //!< The individual kernel records.
+   std::map<std::string,KernelStatistics> statistics_;  //!< The accumulated kernel statistics.
+   mutable std::mutex                     mutex_;       //!< Synchronization mutex for the registry.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for the KernelRegistry class.
+//
+// The registry is created with recording enabled and a capacity of 100000 individual records.
+*/
+inline KernelRegistry::KernelRegistry()
+   : enabled_   ( true         )  // Activation flag for the recording of kernel calls
+   , epoch_     ( Clock::now() )  // The point in time of the creation of the registry
+   , capacity_  ( 100000UL     )  // The maximum number of stored individual records
+   , dropped_   ( 0UL          )  // The number of records exceeding the capacity
+   , records_   ()                // The individual kernel records
+   , statistics_()                // The accumulated kernel statistics
+   , mutex_     ()                // Synchronization mutex for the registry
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the recording of kernel calls is enabled.
+//
+// \return \a true in case kernel calls are recorded, \a false if not.
+*/
+inline bool KernelRegistry::isEnabled() const noexcept
+{
+   return enabled_.load( std::memory_order_relaxed );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Enables or disables the recording of kernel calls at runtime.
+//
+// \param enabled \a true to enable the recording, \a false to disable it.
+// \return void
+*/
+inline void KernelRegistry::setEnabled( bool enabled ) noexcept
+{
+   enabled_.store( enabled, std::memory_order_relaxed );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum number of stored individual records.
+//
+// \return The maximum number of stored individual records.
+*/
+inline size_t KernelRegistry::capacity() const
+{
+   std::lock_guard<std::mutex> lock( mutex_ );
+   return capacity_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the maximum number of stored individual records.
+//
+// \param capacity The new maximum number of stored individual records.
+// \return void
+//
+// Kernel calls beyond the capacity still contribute to the accumulated statistics, but are not
+// stored as individual records. Already stored records exceeding the new capacity are discarded.
+*/
+inline void KernelRegistry::setCapacity( size_t capacity )
+{
+   std::lock_guard<std::mutex> lock( mutex_ );
+
+   capacity_ = capacity;
+
+   if( records_.size() > capacity_ ) {
+      dropped_ += records_.size() - capacity_;
+      records_.resize( capacity_ );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current time relative to the creation of the registry.
+//
+// \return The elapsed time since the creation of the registry (in seconds).
+*/
+inline double KernelRegistry::now() const noexcept
+{
+   return std::chrono::duration<double>( Clock::now() - epoch_ ).count();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Adding the record of a kernel call to the registry.
+//
+// \param record The record of the kernel call.
+// \return void
+*/
+inline void KernelRegistry::record( const KernelRecord& record )
+{
+   std::lock_guard<std::mutex> lock( mutex_ );
+
+   KernelStatistics& stats( statistics_[record.kernel] );
+
+   if( stats.calls == 0UL || record.time < stats.min ) stats.min = record.time;
+   if( stats.calls == 0UL || record.time > stats.max ) stats.max = record.time;
+
+   ++stats.calls;
+   stats.flops += record.flops;
+   stats.bytes += record.bytes;
+   stats.time  += record.time;
+
+   if( records_.size() < capacity_ ) {
+      records_.push_back( record );
+   }
+   else {
+      ++dropped_;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removes all records and statistics from the registry.
+//
+// \return void
+*/
+inline void KernelRegistry::clear()
+{
+   std::lock_guard<std::mutex> lock( mutex_ );
+
+   records_.clear();
+   statistics_.clear();
+   dropped_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a copy of all stored individual records.
+//
+// \return The stored individual records in the order of completion of the kernel calls.
+*/
+inline std::vector<KernelRecord> KernelRegistry::records() const
+{
+   std::lock_guard<std::mutex> lock( mutex_ );
+   return records_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a copy of the accumulated statistics of all kernels.
+//
+// \return The accumulated statistics, sorted by kernel ID.
+*/
+inline std::map<std::string,KernelStatistics> KernelRegistry::statistics() const
+{
+   std::lock_guard<std::mutex> lock( mutex_ );
+   return statistics_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the accumulated statistics and the individual records in JSON format.
+//
+// \param os Reference to the output stream.
+// \return void
+//
+// This function writes a JSON object of the following form to the given output stream:
+
+   \code
+   {
+     "kernels": {
+       "dmatdmatmult.assign.large": { "calls": 2, "time": 0.0123, "min": 0.006, "max": 0.0063,
+                                      "flops": 4.0e+09, "bytes": 2.4e+07, "gflops": 325.2 }
+     },
+     "records": [
+       { "kernel": "dmatdmatmult.assign.large", "threads": 1, "thread": 0, "m": 1000,
+         "n": 1000, "k": 1000, "flops": 2.0e+09, "bytes": 1.2e+07, "start": 0.21, "time": 0.006 }
+     ],
+     "dropped": 0
+   }
+   \endcode
+
+// All times are given in seconds.
+*/
+inline void KernelRegistry::writeJSON( std::ostream& os ) const
+{
+   std::lock_guard<std::mutex> lock( mutex_ );
+
+   os << "{\n  \"kernels\": {";
+
+   bool first( true );
+   for( const auto& entry : statistics_ )
+   {
+      const KernelStatistics& stats( entry.second );
+
+      os << ( first ? "\n" : ",\n" ) << "    ";
+      writeString( os, entry.first.c_str() );
+      os << ": { \"calls\": " << stats.calls
+         << ", \"time\": " << stats.time
+         << ", \"min\": " << stats.min
+         << ", \"max\": " << stats.max
+         << ", \"flops\": " << stats.flops
+         << ", \"bytes\": " << stats.bytes
+         << ", \"gflops\": " << ( stats.time > 0.0 ? stats.flops / stats.time * 1E-9 : 0.0 )
+         << " }";
+      first = false;
+   }
+
+   os << "\n  },\n  \"records\": [";
+
+   first = true;
+   for( const KernelRecord& r : records_ )
+   {
+      os << ( first ? "\n" : ",\n" ) << "    { \"kernel\": ";
+      writeString( os, r.kernel );
+      os << ", \"threads\": " << r.threads
+         << ", \"thread\": " << r.thread
+         << ", \"m\": " << r.m
+         << ", \"n\": " << r.n
+         << ", \"k\": " << r.k
+         << ", \"flops\": " << r.flops
+         << ", \"bytes\": " << r.bytes
+         << ", \"start\": " << r.start
+         << ", \"time\": " << r.time
+         << " }";
+      first = false;
+   }
+
+   os << "\n  ],\n  \"dropped\": " << dropped_ << "\n}\n";
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the individual records in the Chrome trace event format.
+//
+// \param os Reference to the output stream.
+// \return void
+//
+// This function writes all stored individual records as complete events ("ph": "X") of the
+// Chrome trace event format to the given output stream. The resulting file can be visualized
+// via \c chrome://tracing or Perfetto. Every calling thread is represented by a separate track,
+// nested kernel calls (as for instance the kernels executed by the threads of an SMP assignment)
+// are displayed as nested events.
+*/
+inline void KernelRegistry::writeChromeTrace( std::ostream& os ) const
+{
+   std::lock_guard<std::mutex> lock( mutex_ );
+
+   os << "{\"traceEvents\":[";
+
+   bool first( true );
+   for( const KernelRecord& r : records_ )
+   {
+      os << ( first ? "\n" : ",\n" ) << "{\"name\":";
+      writeString( os, r.kernel );
+      os << ",\"cat\":\"blaze\",\"ph\":\"X\""
+         << ",\"ts\":" << r.start * 1E6
+         << ",\"dur\":" << r.time * 1E6
+         << ",\"pid\":0,\"tid\":" << r.thread
+         << ",\"args\":{\"threads\":" << r.threads
+         << ",\"m\":" << r.m
+         << ",\"n\":" << r.n
+         << ",\"k\":" << r.k
+         << ",\"flops\":" << r.flops
+         << ",\"bytes\":" << r.bytes
+         << "}}";
+      first = false;
+   }
+
+   os << "\n],\"displayTimeUnit\":\"ms\"}\n";
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the index of the calling thread.
+//
+// \return The index of the calling thread.
+//
+// This function assigns consecutive indices to all threads in the order of their first call.
+*/
+inline size_t KernelRegistry::threadIndex()
+{
+   static std::atomic<size_t> counter( 0UL );
+   thread_local const size_t index( counter++ );
+   return index;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the given string as JSON string to the given output stream.
+//
+// \param os Reference to the output stream.
+// \param str The string to be written.
+// \return void
+*/
+inline void KernelRegistry::writeString( std::ostream& os, const char* str )
+{
+   os << '"';
+   for( ; *str != '\0'; ++str ) {
+      if( *str == '"' || *str == '\\' ) os << '\\';
+      os << *str;
+   }
+   os << '"';
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the global kernel registry.
+// \ingroup util
+//
+// \return Reference to the global kernel registry.
+*/
+inline KernelRegistry& kernelRegistry()
+{
+   static KernelRegistry registry;
+   return registry;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
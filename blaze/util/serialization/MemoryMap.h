@@ -0,0 +1,266 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/serialization/MemoryMap.h
+//  \brief Header file for the MemoryMap class
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_SERIALIZATION_MEMORYMAP_H_
+#define _BLAZE_UTIL_SERIALIZATION_MEMORYMAP_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/system/Platform.h>
+
+#if BLAZE_WIN32_PLATFORM || BLAZE_WIN64_PLATFORM || BLAZE_MINGW64_PLATFORM || BLAZE_MINGW32_PLATFORM
+#  include <fstream>
+#  include <blaze/util/Memory.h>
+#else
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+#include <string>
+#include <blaze/util/Exception.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Read-only memory mapping of a file.
+// \ingroup serialization
+//
+// The MemoryMap class maps the entire content of a file read-only into the address space of
+// the process. The mapped bytes are accessible via the data() function for the lifetime of the
+// MemoryMap object:
+
+   \code
+   blaze::MemoryMap map( "matrix.blaze" );
+
+   const blaze::byte_t* bytes = map.data();  // Pointer to the first byte of the file
+   const size_t size = map.size();           // Total number of bytes of the file
+   \endcode
+
+// On POSIX systems the file is mapped via \c mmap(), i.e. the content is loaded lazily by the
+// operating system on first access and no copy of the file is created. The beginning of the
+// mapping is aligned to a page boundary. On all other platforms the content of the file is
+// read into a 64-byte aligned memory block, which provides the same interface and alignment
+// guarantees at the cost of an initial copy.
+//
+// In case the file cannot be opened or mapped, a \a std::runtime_error exception is thrown.
+*/
+class MemoryMap
+   : private NonCopyable
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline MemoryMap( const std::string& file );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~MemoryMap();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline const byte_t* data() const noexcept;
+   inline size_t        size() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   byte_t* data_;  //!< Pointer to the first byte of the mapping.
+   size_t  size_;  //!< The total number of mapped bytes.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creating a read-only mapping of the given file.
+//
+// \param file The name of the file to be mapped.
+// \exception std::runtime_error File could not be mapped.
+*/
+#if BLAZE_WIN32_PLATFORM || BLAZE_WIN64_PLATFORM || BLAZE_MINGW64_PLATFORM || BLAZE_MINGW32_PLATFORM
+inline MemoryMap::MemoryMap( const std::string& file )
+   : data_( nullptr )  // Pointer to the first byte of the mapping
+   , size_( 0UL )      // The total number of mapped bytes
+{
+   std::ifstream in( file, std::ifstream::binary | std::ifstream::ate );
+
+   if( !in ) {
+      BLAZE_THROW_RUNTIME_ERROR( "File could not be opened" );
+   }
+
+   size_ = static_cast<size_t>( in.tellg() );
+
+   if( size_ == 0UL )
+      return;
+
+   data_ = allocate_backend( size_, 64UL );
+   in.seekg( 0 );
+
+   if( !in.read( reinterpret_cast<char*>( data_ ), size_ ) ) {
+      deallocate_backend( data_ );
+      BLAZE_THROW_RUNTIME_ERROR( "File could not be read" );
+   }
+}
+#else
+inline MemoryMap::MemoryMap( const std::string& file )
+   : data_( nullptr )  // Pointer to the first byte of the mapping
+   , size_( 0UL )      // The total number of mapped bytes
+{
+   const int fd( ::open( file.c_str(), O_RDONLY ) );
+
+   if( fd < 0 ) {
+      BLAZE_THROW_RUNTIME_ERROR( "File could not be opened" );
+   }
+
+   struct stat status;
+
+   if( ::fstat( fd, &status ) != 0 ) {
+      ::close( fd );
+      BLAZE_THROW_RUNTIME_ERROR( "File size could not be determined" );
+   }
+
+   size_ = static_cast<size_t>( status.st_size );
+
+   if( size_ > 0UL )
+   {
+      void* ptr( ::mmap( nullptr, size_, PROT_READ, MAP_SHARED, fd, 0 ) );
+
+      if( ptr == MAP_FAILED ) {
+         ::close( fd );
+         BLAZE_THROW_RUNTIME_ERROR( "File could not be mapped" );
+      }
+
+      data_ = static_cast<byte_t*>( ptr );
+   }
+
+   ::close( fd );
+}
+#endif
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor of the MemoryMap class.
+//
+// The destructor releases the mapping of the file. Note that all pointers to the mapped bytes
+// are invalidated!
+*/
+inline MemoryMap::~MemoryMap()
+{
+   if( data_ == nullptr )
+      return;
+
+#if BLAZE_WIN32_PLATFORM || BLAZE_WIN64_PLATFORM || BLAZE_MINGW64_PLATFORM || BLAZE_MINGW32_PLATFORM
+   deallocate_backend( data_ );
+#else
+   ::munmap( data_, size_ );
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns a pointer to the first byte of the mapping.
+//
+// \return Pointer to the first mapped byte (\c nullptr in case the file is empty).
+*/
+inline const byte_t* MemoryMap::data() const noexcept
+{
+   return data_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of mapped bytes.
+//
+// \return The size of the mapped file in bytes.
+*/
+inline size_t MemoryMap::size() const noexcept
+{
+   return size_;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,200 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/threadpool/TaskGroup.h
+//  \brief Task group for the thread pools
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_THREADPOOL_TASKGROUP_H_
+#define _BLAZE_UTIL_THREADPOOL_TASKGROUP_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+#include <blaze/util/Assert.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+namespace threadpool {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Completion counter for a group of tasks.
+// \ingroup threads
+//
+// The TaskGroup class represents a group of tasks scheduled to a thread pool, which can be
+// waited for independently of all other scheduled tasks. Every task of the group is registered
+// via the add() function before it is scheduled and signals its completion via the done()
+// function. The group is ready as soon as all registered tasks have been completed. Note that
+// a task group must not be moved or destroyed as long as any of its tasks is pending.
+*/
+class TaskGroup
+   : private NonCopyable
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   inline TaskGroup() noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Get functions*******************************************************************************
+   /*!\name Get functions */
+   //@{
+   inline size_t pending() const noexcept;
+   inline bool   ready  () const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void add ( size_t n=1UL ) noexcept;
+   inline void done() noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::atomic<size_t> pending_;  //!< Number of registered, but not yet completed tasks.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Default constructor for TaskGroup.
+*/
+inline TaskGroup::TaskGroup() noexcept
+   : pending_( 0UL )  // Number of registered, but not yet completed tasks
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of registered, but not yet completed tasks.
+//
+// \return The number of pending tasks.
+*/
+inline size_t TaskGroup::pending() const noexcept
+{
+   return pending_.load( std::memory_order_acquire );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether all registered tasks have been completed.
+//
+// \return \a true in case all tasks have been completed, \a false if not.
+*/
+inline bool TaskGroup::ready() const noexcept
+{
+   return pending() == 0UL;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Registering the given number of tasks with the task group.
+//
+// \param n The number of tasks to be registered.
+// \return void
+*/
+inline void TaskGroup::add( size_t n ) noexcept
+{
+   pending_.fetch_add( n, std::memory_order_relaxed );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Signaling the completion of a single task of the task group.
+//
+// \return void
+//
+// This function must be the last access of a task to the task group, since the task group may
+// be destroyed as soon as all registered tasks have been completed.
+*/
+inline void TaskGroup::done() noexcept
+{
+   BLAZE_INTERNAL_ASSERT( pending() > 0UL, "Invalid completion of an unregistered task" );
+   pending_.fetch_sub( 1UL, std::memory_order_acq_rel );
+}
+//*************************************************************************************************
+
+} // namespace threadpool
+
+} // namespace blaze
+
+#endif
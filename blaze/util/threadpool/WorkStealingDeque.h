@@ -0,0 +1,420 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/threadpool/WorkStealingDeque.h
+//  \brief Lock-free work-stealing deque for the work-stealing thread pool
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_THREADPOOL_WORKSTEALINGDEQUE_H_
+#define _BLAZE_UTIL_THREADPOOL_WORKSTEALINGDEQUE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+#include <blaze/util/Assert.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+namespace threadpool {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Lock-free work-stealing deque for the work-stealing thread pool.
+// \ingroup threads
+//
+// The WorkStealingDeque class template implements the dynamic circular work-stealing deque by
+// Chase and Lev (SPAA 2005) with the memory orderings proposed by Le, Pop, Cohen and Nardelli
+// (PPoPP 2013). The deque is owned by exactly one thread, which is allowed to push() and pop()
+// elements at the bottom end in LIFO order. All other threads are allowed to steal() elements
+// from the top end in FIFO order. None of the operations acquires a lock. In case the deque runs
+// full, the owner thread transparently doubles its capacity. Replaced buffers are kept alive
+// until the destruction of the deque since concurrent thieves might still access them.\n
+// The element type \a T must be a trivially copyable type that is atomically accessible (as
+// for instance a pointer type) and that can represent an empty state by its default value.
+*/
+template< typename T >  // Type of the contained elements
+class WorkStealingDeque
+   : private NonCopyable
+{
+ private:
+   //**Type definitions****************************************************************************
+   using Index = std::int64_t;  //!< Signed index type for the top and bottom counters.
+   //**********************************************************************************************
+
+   //**Private class Buffer************************************************************************
+   /*!\brief Circular buffer of atomically accessible elements.
+   */
+   struct Buffer
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the Buffer class.
+      //
+      // \param n The capacity of the buffer (must be a power of two).
+      */
+      explicit Buffer( Index n )
+         : capacity_( n )                                   // The capacity of the buffer
+         , mask_    ( n-1 )                                 // Bit mask for the index wrap-around
+         , elements_( new std::atomic<T>[ size_t( n ) ] )  // The buffer elements
+      {}
+      //*******************************************************************************************
+
+      //**Access functions*************************************************************************
+      /*!\brief Returns the element at the given (unwrapped) index.
+      //
+      // \param i The unwrapped index of the element.
+      // \return The element at the given index.
+      */
+      T get( Index i ) const noexcept {
+         return elements_[ i & mask_ ].load( std::memory_order_relaxed );
+      }
+
+      /*!\brief Stores the given element at the given (unwrapped) index.
+      //
+      // \param i The unwrapped index of the element.
+      // \param value The element to be stored.
+      // \return void
+      */
+      void put( Index i, T value ) noexcept {
+         elements_[ i & mask_ ].store( value, std::memory_order_relaxed );
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      const Index capacity_;                        //!< The capacity of the buffer.
+      const Index mask_;                            //!< Bit mask for the index wrap-around.
+      std::unique_ptr< std::atomic<T>[] > elements_;  //!< The buffer elements.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline WorkStealingDeque( size_t capacity = 64UL );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Get functions*******************************************************************************
+   /*!\name Get functions */
+   //@{
+   inline size_t size    () const noexcept;
+   inline size_t capacity() const noexcept;
+   inline bool   isEmpty () const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Element functions***************************************************************************
+   /*!\name Element functions */
+   //@{
+   inline void push ( T value );
+   inline T    pop  () noexcept;
+   inline T    steal() noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline Buffer* grow( Buffer* buffer, Index top, Index bottom );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::atomic<Index> top_;     //!< Index of the top element (the stealing end).
+   char padding1_[64UL - sizeof( std::atomic<Index> )];  //!< Padding to avoid false sharing.
+   std::atomic<Index> bottom_;  //!< Index one past the bottom element (the owner end).
+   char padding2_[64UL - sizeof( std::atomic<Index> )];  //!< Padding to avoid false sharing.
+   std::atomic<Buffer*> buffer_;                     //!< The currently active circular buffer.
+   std::vector< std::unique_ptr<Buffer> > buffers_;  //!< All buffers allocated by the owner thread.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_STATIC_ASSERT( std::is_trivially_copyable<T>::value );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the WorkStealingDeque class template.
+//
+// \param capacity The initial capacity of the deque.
+//
+// The initial capacity is rounded up to the next power of two.
+*/
+template< typename T >  // Type of the contained elements
+inline WorkStealingDeque<T>::WorkStealingDeque( size_t capacity )
+   : top_      ( 0 )        // Index of the top element
+   , padding1_ ()           // Padding to avoid false sharing
+   , bottom_   ( 0 )        // Index one past the bottom element
+   , padding2_ ()           // Padding to avoid false sharing
+   , buffer_   ( nullptr )  // The currently active circular buffer
+   , buffers_  ()           // All buffers allocated by the owner thread
+{
+   Index n( 2 );
+   while( n < Index( capacity ) ) n <<= 1;
+
+   buffers_.emplace_back( new Buffer( n ) );
+   buffer_.store( buffers_.back().get(), std::memory_order_relaxed );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of elements in the deque.
+//
+// \return The current number of elements.
+//
+// Note that in case of concurrent access the returned value is only a snapshot.
+*/
+template< typename T >  // Type of the contained elements
+inline size_t WorkStealingDeque<T>::size() const noexcept
+{
+   const Index bottom( bottom_.load( std::memory_order_relaxed ) );
+   const Index top   ( top_.load( std::memory_order_relaxed ) );
+   return ( bottom > top )?( size_t( bottom - top ) ):( 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current capacity of the deque.
+//
+// \return The current capacity.
+*/
+template< typename T >  // Type of the contained elements
+inline size_t WorkStealingDeque<T>::capacity() const noexcept
+{
+   return size_t( buffer_.load( std::memory_order_relaxed )->capacity_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the deque is empty.
+//
+// \return \a true if the deque is empty, \a false if it is not.
+//
+// Note that in case of concurrent access the returned value is only a snapshot.
+*/
+template< typename T >  // Type of the contained elements
+inline bool WorkStealingDeque<T>::isEmpty() const noexcept
+{
+   return size() == 0UL;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ELEMENT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Adding an element to the bottom end of the deque.
+//
+// \param value The element to be added.
+// \return void
+//
+// This function must only be called by the owner thread of the deque. In case the deque is
+// full, its capacity is doubled.
+*/
+template< typename T >  // Type of the contained elements
+inline void WorkStealingDeque<T>::push( T value )
+{
+   const Index bottom( bottom_.load( std::memory_order_relaxed ) );
+   const Index top   ( top_.load( std::memory_order_acquire ) );
+   Buffer* buffer( buffer_.load( std::memory_order_relaxed ) );
+
+   if( bottom - top > buffer->capacity_ - 1 ) {
+      buffer = grow( buffer, top, bottom );
+   }
+
+   buffer->put( bottom, value );
+   std::atomic_thread_fence( std::memory_order_release );
+   bottom_.store( bottom+1, std::memory_order_relaxed );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing an element from the bottom end of the deque.
+//
+// \return The removed element or a default constructed \a T in case the deque is empty.
+//
+// This function must only be called by the owner thread of the deque.
+*/
+template< typename T >  // Type of the contained elements
+inline T WorkStealingDeque<T>::pop() noexcept
+{
+   const Index bottom( bottom_.load( std::memory_order_relaxed ) - 1 );
+   Buffer* buffer( buffer_.load( std::memory_order_relaxed ) );
+   bottom_.store( bottom, std::memory_order_relaxed );
+   std::atomic_thread_fence( std::memory_order_seq_cst );
+   Index top( top_.load( std::memory_order_relaxed ) );
+
+   T value{};
+
+   if( top <= bottom )
+   {
+      value = buffer->get( bottom );
+
+      if( top == bottom ) {
+         if( !top_.compare_exchange_strong( top, top+1, std::memory_order_seq_cst,
+                                            std::memory_order_relaxed ) ) {
+            value = T{};
+         }
+         bottom_.store( bottom+1, std::memory_order_relaxed );
+      }
+   }
+   else {
+      bottom_.store( bottom+1, std::memory_order_relaxed );
+   }
+
+   return value;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Stealing an element from the top end of the deque.
+//
+// \return The stolen element or a default constructed \a T in case of failure.
+//
+// This function can be called by any thread. It fails in case the deque is empty or in case
+// another thread succeeded to remove the top element concurrently.
+*/
+template< typename T >  // Type of the contained elements
+inline T WorkStealingDeque<T>::steal() noexcept
+{
+   Index top( top_.load( std::memory_order_acquire ) );
+   std::atomic_thread_fence( std::memory_order_seq_cst );
+   const Index bottom( bottom_.load( std::memory_order_acquire ) );
+
+   if( top < bottom )
+   {
+      Buffer* buffer( buffer_.load( std::memory_order_acquire ) );
+      T value( buffer->get( top ) );
+
+      if( top_.compare_exchange_strong( top, top+1, std::memory_order_seq_cst,
+                                        std::memory_order_relaxed ) ) {
+         return value;
+      }
+   }
+
+   return T{};
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Doubling the capacity of the deque.
+//
+// \param buffer The currently active buffer.
+// \param top The current top index.
+// \param bottom The current bottom index.
+// \return Pointer to the new active buffer.
+*/
+template< typename T >  // Type of the contained elements
+inline typename WorkStealingDeque<T>::Buffer*
+   WorkStealingDeque<T>::grow( Buffer* buffer, Index top, Index bottom )
+{
+   buffers_.emplace_back( new Buffer( 2*buffer->capacity_ ) );
+   Buffer* tmp( buffers_.back().get() );
+
+   for( Index i=top; i<bottom; ++i ) {
+      tmp->put( i, buffer->get( i ) );
+   }
+
+   buffer_.store( tmp, std::memory_order_release );
+
+   return tmp;
+}
+//*************************************************************************************************
+
+} // namespace threadpool
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,190 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/arena/ClassTest.h
+//  \brief Header file for the arena memory resource test
+//
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_ARENA_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_ARENA_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/util/Arena.h>
+#include <blaze/util/MemoryResource.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace arena {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the Arena memory resource.
+//
+// This class represents a test suite for the Arena class and the arena section. It tests the
+// bump allocation of the arena, the allocation of dynamic vectors and matrices, of compressed
+// matrices, and of expression temporaries within arena sections, the interaction with memory
+// allocated outside of arena sections, nested arena sections, and the packing buffers of the
+// dense matrix multiplication.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testArena();
+   void testVector();
+   void testMatrix();
+   void testCompressedMatrix();
+   void testNesting();
+   void testMultiplication();
+   void testDeallocation();
+
+   void checkOwned( const blaze::Arena& arena, const void* address, bool expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking whether the given memory belongs to the given arena.
+//
+// \param arena The arena to be checked.
+// \param address The address of the memory.
+// \param expected \a true if the memory is expected to belong to the arena, \a false if not.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+inline void ClassTest::checkOwned( const blaze::Arena& arena, const void* address, bool expected ) const
+{
+   if( arena.owns( address ) != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: " << ( expected ? "Memory not drawn from the arena\n"
+                                      : "Memory unexpectedly drawn from the arena\n" )
+          << " Details:\n"
+          << "   Address : " << address << "\n"
+          << "   Chunks  : " << arena.chunks() << "\n"
+          << "   Capacity: " << arena.capacity() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the Arena memory resource.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the Arena memory resource test.
+*/
+#define RUN_ARENA_CLASS_TEST \
+   blazetest::mathtest::arena::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace arena
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,329 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/asyncassign/DenseTest.h
+//  \brief Header file for the asynchronous dense assignment test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_ASYNCASSIGN_DENSETEST_H_
+#define _BLAZETEST_MATHTEST_ASYNCASSIGN_DENSETEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/DenseMatrix.h>
+#include <blaze/math/DenseVector.h>
+#include <blaze/math/SMP.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/IsEqual.h>
+#include <blazetest/system/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace asyncassign {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all asynchronous dense assignment tests.
+//
+// This class represents a test suite for the asynchronous assignment functionality. It performs
+// a series of asynchronous (compound) assignments of dense vectors and dense matrices and
+// compares the results to the results of the according blocking assignments.
+*/
+class DenseTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit DenseTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testHandle();
+   void testAliasing();
+   void testSizeMismatch();
+   void testComputedOperands();
+
+   template< typename VT, typename MT >
+   void testVector( size_t N );
+
+   template< typename MT1, typename MT2 >
+   void testMatrix( size_t M, size_t N );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename T1, typename T2 >
+   void checkResult( const T1& result, const T2& expected, const char* error ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the asynchronous assignment of random dense vectors.
+//
+// \param N The size of the vectors.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the asynchronous assignment, addition assignment and subtraction
+// assignment of random dense vectors and dense matrix/dense vector multiplications. All
+// assignments are started before the first handle is waited for. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename VT    // Type of the dense vector
+        , typename MT >  // Type of the dense matrix
+void DenseTest::testVector( size_t N )
+{
+   using blaze::asyncAssign;
+   using blaze::asyncAddAssign;
+   using blaze::asyncSubAssign;
+
+   test_ = "Asynchronous dense vector assignment";
+
+   MT A;
+   resize( A, N, N );
+   randomize( A );
+
+   VT x, b;
+   resize( x, N );
+   resize( b, N );
+   randomize( x );
+   randomize( b );
+
+   const VT ref1( A * x );
+   const VT ref2( b + x );
+   const VT ref3( b - A * x );
+
+   VT y1, y2( b ), y3( b );
+
+   {
+      auto h1 = asyncAssign   ( y1, A * x );
+      auto h2 = asyncAddAssign( y2, x );
+      auto h3 = asyncSubAssign( y3, A * x );
+
+      h1.wait();
+      h2.wait();
+      h3.wait();
+
+      if( !h1.ready() || !h2.ready() || !h3.ready() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Completed assignment is not ready\n"
+             << " Details:\n"
+             << "   Vector type:\n"
+             << "     " << typeid( VT ).name() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   checkResult( y1, ref1, "Asynchronous assignment failed" );
+   checkResult( y2, ref2, "Asynchronous addition assignment failed" );
+   checkResult( y3, ref3, "Asynchronous subtraction assignment failed" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the asynchronous assignment of random dense matrices.
+//
+// \param M The number of rows of the matrices.
+// \param N The number of columns of the matrices.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the asynchronous assignment, addition assignment and subtraction
+// assignment of random dense matrices. The handles are not waited for explicitly, but the
+// assignments are completed by the destructors of the handles. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+template< typename MT1    // Type of the left-hand side dense matrix
+        , typename MT2 >  // Type of the right-hand side dense matrix
+void DenseTest::testMatrix( size_t M, size_t N )
+{
+   using blaze::asyncAssign;
+   using blaze::asyncAddAssign;
+   using blaze::asyncSubAssign;
+
+   test_ = "Asynchronous dense matrix assignment";
+
+   MT2 A, B;
+   resize( A, M, N );
+   resize( B, M, N );
+   randomize( A );
+   randomize( B );
+
+   MT1 C;
+   resize( C, M, N );
+   randomize( C );
+
+   const MT1 ref1( A + B );
+   const MT1 ref2( C + A );
+   const MT1 ref3( C - trans( trans( B ) ) );
+
+   MT1 D1, D2( C ), D3( C );
+
+   {
+      auto h1 = asyncAssign   ( D1, A + B );
+      auto h2 = asyncAddAssign( D2, A );
+      auto h3 = asyncSubAssign( D3, trans( trans( B ) ) );
+   }
+
+   checkResult( D1, ref1, "Asynchronous assignment failed" );
+   checkResult( D2, ref2, "Asynchronous addition assignment failed" );
+   checkResult( D3, ref3, "Asynchronous subtraction assignment failed" );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the result of an asynchronous assignment.
+//
+// \param result The result of the asynchronous assignment.
+// \param expected The result of the according blocking assignment.
+// \param error The error message in case the results differ.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename T1    // Type of the result
+        , typename T2 >  // Type of the expected result
+void DenseTest::checkResult( const T1& result, const T2& expected, const char* error ) const
+{
+   if( !isEqual( result, expected ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: " << error << "\n"
+          << " Details:\n"
+          << "   Type:\n"
+          << "     " << typeid( T1 ).name() << "\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the asynchronous dense assignment.
+//
+// \return void
+*/
+void runTest()
+{
+   DenseTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the asynchronous dense assignment test.
+*/
+#define RUN_ASYNCASSIGN_DENSE_TEST \
+   blazetest::mathtest::asyncassign::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace asyncassign
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
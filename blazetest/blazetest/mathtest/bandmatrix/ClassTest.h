@@ -0,0 +1,276 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/bandmatrix/ClassTest.h
+//  \brief Header file for the BandMatrix class test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_BANDMATRIX_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_BANDMATRIX_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/BandMatrix.h>
+#include <blazetest/mathtest/IsEqual.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace bandmatrix {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the BandMatrix class template.
+//
+// This class represents a test suite for the BandMatrix class template. It performs a series
+// of both compile time as well as runtime tests. The results of the matrix operations are
+// compared with the results of the according operations on a DynamicMatrix.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testConstructors();
+   void testAssignment();
+   void testMultiplication();
+   void testSolve();
+
+   template< typename MT >
+   void testMultiplication( size_t m, size_t n, size_t kl, size_t ku );
+
+   template< typename Type1, typename Type2 >
+   void checkEqual( const Type1& matrix, const Type2& ref ) const;
+
+   template< typename Type >
+   void checkRows( const Type& matrix, size_t expectedRows ) const;
+
+   template< typename Type >
+   void checkColumns( const Type& matrix, size_t expectedColumns ) const;
+
+   template< typename Type >
+   void checkNonZeros( const Type& matrix, size_t expectedNonZeros ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the number of rows of the given matrix.
+//
+// \param matrix The matrix to be checked.
+// \param expectedRows The expected number of rows of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename Type >  // Type of the matrix
+void ClassTest::checkRows( const Type& matrix, size_t expectedRows ) const
+{
+   if( matrix.rows() != expectedRows ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of rows detected\n"
+          << " Details:\n"
+          << "   Number of rows         : " << matrix.rows() << "\n"
+          << "   Expected number of rows: " << expectedRows << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of columns of the given matrix.
+//
+// \param matrix The matrix to be checked.
+// \param expectedColumns The expected number of columns of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename Type >  // Type of the matrix
+void ClassTest::checkColumns( const Type& matrix, size_t expectedColumns ) const
+{
+   if( matrix.columns() != expectedColumns ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of columns detected\n"
+          << " Details:\n"
+          << "   Number of columns         : " << matrix.columns() << "\n"
+          << "   Expected number of columns: " << expectedColumns << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of non-zero elements of the given matrix.
+//
+// \param matrix The matrix to be checked.
+// \param expectedNonZeros The expected number of non-zero elements of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename Type >  // Type of the matrix
+void ClassTest::checkNonZeros( const Type& matrix, size_t expectedNonZeros ) const
+{
+   if( nonZeros( matrix ) != expectedNonZeros ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of non-zero elements\n"
+          << " Details:\n"
+          << "   Number of non-zeros         : " << nonZeros( matrix ) << "\n"
+          << "   Expected number of non-zeros: " << expectedNonZeros << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Comparing the given matrix to a reference matrix.
+//
+// \param matrix The matrix to be checked.
+// \param ref The reference matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename Type1    // Type of the matrix
+        , typename Type2 >  // Type of the reference matrix
+void ClassTest::checkEqual( const Type1& matrix, const Type2& ref ) const
+{
+   bool equal( matrix.rows() == ref.rows() && matrix.columns() == ref.columns() );
+
+   for( size_t i=0UL; equal && i<ref.rows(); ++i ) {
+      for( size_t j=0UL; equal && j<ref.columns(); ++j ) {
+         equal = isEqual( matrix(i,j), ref(i,j) );
+      }
+   }
+
+   if( !equal ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid matrix elements detected\n"
+          << " Details:\n"
+          << "   Result:\n" << matrix << "\n"
+          << "   Expected result:\n" << ref << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the BandMatrix class template.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the BandMatrix class test.
+*/
+#define RUN_BANDMATRIX_CLASS_TEST \
+   blazetest::mathtest::bandmatrix::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace bandmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,307 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/compressedmatrix/ParallelTest.h
+//  \brief Header file for the CompressedMatrix parallel assignment test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_COMPRESSEDMATRIX_PARALLELTEST_H_
+#define _BLAZETEST_MATHTEST_COMPRESSEDMATRIX_PARALLELTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace compressedmatrix {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the parallel assignment to a CompressedMatrix.
+//
+// This class represents a test suite for the block-wise parallel assignment of sparse matrices
+// and sparse matrix expressions to row-major and column-major compressed matrices. It performs
+// a series of runtime tests with operands that contain enough non-zero elements to be assigned
+// in parallel.
+*/
+class ParallelTest
+{
+ private:
+   //**Type definitions****************************************************************************
+   using SMat  = blaze::CompressedMatrix<int,blaze::rowMajor>;     //!< Row-major sparse matrix type.
+   using TSMat = blaze::CompressedMatrix<int,blaze::columnMajor>;  //!< Column-major sparse matrix type.
+   using RMat  = blaze::DynamicMatrix<int,blaze::rowMajor>;        //!< Reference matrix type.
+   //**********************************************************************************************
+
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ParallelTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename MT > void testAssignment();
+   template< typename MT > void testAliasing  ();
+
+   template< typename T1, typename T2 >
+   void checkResult( const T1& computedResult, const T2& expectedResult );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the parallel assignment of sparse matrix expressions to a compressed matrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the parallel assignment of several sparse matrix expressions to a
+// compressed matrix of the given type. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename MT >  // Type of the target compressed matrix
+void ParallelTest::testAssignment()
+{
+   SMat  A( 600UL, 500UL );
+   SMat  B( 600UL, 500UL );
+   TSMat T( 600UL, 500UL );
+
+   blaze::randomize( A, 90000UL, -5, 5 );
+   blaze::randomize( B, 80000UL, -5, 5 );
+   blaze::randomize( T, 85000UL, -5, 5 );
+
+   {
+      test_ = "Copy construction";
+
+      const MT C( A );
+
+      checkResult( C, A );
+   }
+
+   {
+      test_ = "Addition assignment (C = A + B)";
+
+      MT C;
+      C = A + B;
+
+      checkResult( C, RMat( A ) + RMat( B ) );
+      checkResult( C, blaze::serial( A + B ) );
+   }
+
+   {
+      test_ = "Subtraction with opposite storage order (C = A - T)";
+
+      MT C;
+      C = A - T;
+
+      checkResult( C, RMat( A ) - RMat( T ) );
+   }
+
+   {
+      test_ = "Schur product assignment (C = A % B)";
+
+      MT C;
+      C = A % B;
+
+      checkResult( C, RMat( A ) % RMat( B ) );
+   }
+
+   {
+      test_ = "Scaling construction (C = 3 * A)";
+
+      const MT C( 3 * A );
+
+      checkResult( C, 3 * RMat( A ) );
+   }
+
+   {
+      test_ = "Transpose assignment (C = trans(T))";
+
+      MT C( 500UL, 600UL );
+      C = trans( T );
+
+      checkResult( C, trans( RMat( T ) ) );
+   }
+
+   {
+      test_ = "Cancellation (C = A - A)";
+
+      MT C( A );
+      C = A - A;
+
+      checkResult( C, RMat( 600UL, 500UL, 0 ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the parallel assignment of an aliased expression to a compressed matrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the parallel assignment of a sparse matrix expression that refers to
+// the target matrix itself. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+template< typename MT >  // Type of the target compressed matrix
+void ParallelTest::testAliasing()
+{
+   test_ = "Aliased assignment (C = C + trans(C))";
+
+   MT C( 400UL, 400UL );
+   blaze::randomize( C, 100000UL, -5, 5 );
+
+   const RMat ref( RMat( C ) + trans( RMat( C ) ) );
+
+   C = C + trans( C );
+
+   checkResult( C, ref );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking and comparing the computed result.
+//
+// \param computedResult The computed result.
+// \param expectedResult The expected result.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+//
+// This function is called after each test case to check and compare the computed result.
+// In case the computed and the expected result differ in any way, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename T1    // Type of the computed result
+        , typename T2 >  // Type of the expected result
+void ParallelTest::checkResult( const T1& computedResult, const T2& expectedResult )
+{
+   if( computedResult != expectedResult ) {
+      std::ostringstream oss;
+      oss << " Test : " << test_ << "\n"
+          << " Error: Incorrect result detected\n"
+          << " Details:\n"
+          << "   Computed result:\n" << computedResult << "\n"
+          << "   Expected result:\n" << expectedResult << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the parallel assignment to a CompressedMatrix.
+//
+// \return void
+*/
+void runTest()
+{
+   ParallelTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the CompressedMatrix parallel assignment test.
+*/
+#define RUN_COMPRESSEDMATRIX_PARALLEL_TEST \
+   blazetest::mathtest::compressedmatrix::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace compressedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,260 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/dispatch/ClassTest.h
+//  \brief Header file for the runtime dispatch test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_DISPATCH_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_DISPATCH_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blazetest/mathtest/IsEqual.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace dispatch {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the runtime instruction set dispatch.
+//
+// This class represents a test suite for the runtime instruction set dispatch. For every
+// instruction set supported by the executing CPU it selects the according kernels and compares
+// the results of the dispatched dense matrix multiplication, dense matrix/dense vector
+// multiplication, reduction, inner product, and vector assignment kernels with the results of
+// plain reference loops.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testInstructionSet();
+
+   template< typename T >
+   void testMultiplication();
+
+   template< typename T >
+   void testGemv();
+
+   template< typename T >
+   void testReduction();
+
+   template< typename T >
+   void testAssignment();
+
+   template< typename MT, bool SO >
+   void initialize( blaze::DenseMatrix<MT,SO>& m );
+
+   template< typename VT, bool TF >
+   void initialize( blaze::DenseVector<VT,TF>& v );
+
+   template< typename Type1, typename Type2 >
+   void checkMatrix( const Type1& matrix, const Type2& ref ) const;
+
+   template< typename Type1, typename Type2 >
+   void checkVector( const Type1& vector, const Type2& ref ) const;
+
+   template< typename Type1, typename Type2 >
+   void checkScalar( const Type1& value, const Type2& ref ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   std::string isa_;   //!< Label of the currently selected instruction set.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Comparing the given matrix to a reference matrix.
+//
+// \param matrix The matrix to be checked.
+// \param ref The reference matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename Type1    // Type of the matrix
+        , typename Type2 >  // Type of the reference matrix
+void ClassTest::checkMatrix( const Type1& matrix, const Type2& ref ) const
+{
+   if( !isEqual( matrix, ref ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid matrix elements detected\n"
+          << " Details:\n"
+          << "   Instruction set: " << isa_ << "\n"
+          << "   Size: " << matrix.rows() << "x" << matrix.columns() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Comparing the given vector to a reference vector.
+//
+// \param vector The vector to be checked.
+// \param ref The reference vector.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename Type1    // Type of the vector
+        , typename Type2 >  // Type of the reference vector
+void ClassTest::checkVector( const Type1& vector, const Type2& ref ) const
+{
+   if( !isEqual( vector, ref ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid vector elements detected\n"
+          << " Details:\n"
+          << "   Instruction set: " << isa_ << "\n"
+          << "   Size: " << vector.size() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Comparing the given scalar to a reference value.
+//
+// \param value The scalar to be checked.
+// \param ref The reference value.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename Type1    // Type of the scalar
+        , typename Type2 >  // Type of the reference value
+void ClassTest::checkScalar( const Type1& value, const Type2& ref ) const
+{
+   if( !isEqual( value, ref ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid result detected\n"
+          << " Details:\n"
+          << "   Instruction set: " << isa_ << "\n"
+          << "   Result         : " << value << "\n"
+          << "   Expected result: " << ref << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the runtime instruction set dispatch.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the runtime dispatch test.
+*/
+#define RUN_DISPATCH_CLASS_TEST \
+   blazetest::mathtest::dispatch::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace dispatch
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,423 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/dmatdmatkron/MultTest.h
+//  \brief Header file for the Kronecker product multiplication test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZETEST_MATHTEST_DMATDMATKRON_MULTTEST_H_
+#define _BLAZETEST_MATHTEST_DMATDMATKRON_MULTTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/CompressedVector.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace dmatdmatkron {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the Kronecker product multiplication test.
+//
+// This class represents a test suite for the multiplication of Kronecker products with dense
+// vectors and dense matrices (as for instance \f$ (A \otimes B)*\vec{x} \f$), which is computed
+// without forming the Kronecker product. It performs a series of runtime tests to assure that
+// the results are identical to the multiplication with the explicitly formed Kronecker product.
+// Since all tests are performed with integral element types, the results are required to be
+// identical.
+*/
+class MultTest
+{
+ private:
+   //**Type definitions****************************************************************************
+   using DVec  = blaze::DynamicVector<int,blaze::columnVector>;     //!< Dense column vector type.
+   using SVec  = blaze::CompressedVector<int,blaze::columnVector>;  //!< Sparse column vector type.
+   using DMat  = blaze::DynamicMatrix<int,blaze::rowMajor>;         //!< Row-major dense matrix type.
+   using TDMat = blaze::DynamicMatrix<int,blaze::columnMajor>;      //!< Column-major dense matrix type.
+   using SMat  = blaze::CompressedMatrix<int,blaze::rowMajor>;      //!< Row-major sparse matrix type.
+   using TSMat = blaze::CompressedMatrix<int,blaze::columnMajor>;   //!< Column-major sparse matrix type.
+   //**********************************************************************************************
+
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit MultTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testExpressionType();
+   void testVectorMult    ();
+   void testMatrixMult    ();
+   void testChain         ();
+   void testElementAccess ();
+   void testViews         ();
+   void testAliasing      ();
+   void testSizeMismatch  ();
+
+   template< typename MT1, typename MT2 >
+   void testVector( const MT1& A, const MT2& B );
+
+   template< typename MT1, typename MT2, typename MT3 >
+   void testMatrix( const MT1& A, const MT2& B, const MT3& C );
+
+   template< typename T1, typename T2 >
+   void checkResult( const T1& computedResult, const T2& expectedResult );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT >
+   void initialize( MT& mat, size_t m, size_t n, int seed );
+
+   void initialize( DVec& vec, size_t n, int seed );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of all assignment operations of the multiplication \f$ (A \otimes B)*\vec{x} \f$.
+//
+// \param A The left-hand side factor of the Kronecker product.
+// \param B The right-hand side factor of the Kronecker product.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the multiplication of the Kronecker product of \a A and \a B with a
+// dense vector with the multiplication of the explicitly formed Kronecker product for the
+// assignment to dense and sparse vectors, addition assignment, subtraction assignment,
+// multiplication assignment and scaled assignment. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename MT1    // Type of the left-hand side factor
+        , typename MT2 >  // Type of the right-hand side factor
+void MultTest::testVector( const MT1& A, const MT2& B )
+{
+   const DMat K( kron( A, B ) );
+
+   DVec x;
+   initialize( x, K.columns(), 1 );
+
+   const DVec ref( K * x );
+
+   {
+      DVec res( kron( A, B ) * x );
+      checkResult( res, ref );
+   }
+
+   {
+      SVec res( kron( A, B ) * x );
+      checkResult( res, ref );
+   }
+
+   {
+      DVec res( ref );
+      res += kron( A, B ) * x;
+      checkResult( res, 2 * ref );
+   }
+
+   {
+      DVec res( ref );
+      res -= kron( A, B ) * x;
+      checkResult( res, 0 * ref );
+   }
+
+   {
+      DVec res( ref );
+      res *= kron( A, B ) * x;
+      checkResult( res, ref * ref );
+   }
+
+   {
+      DVec res( kron( A, B ) * ( x * 3 ) );
+      checkResult( res, 3 * ref );
+   }
+
+   {
+      DVec res( ref );
+      res += 2 * ( kron( A, B ) * x ) - ref;
+      checkResult( res, 2 * ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of all assignment operations of the multiplication \f$ (A \otimes B)*C \f$.
+//
+// \param A The left-hand side factor of the Kronecker product.
+// \param B The right-hand side factor of the Kronecker product.
+// \param C The right-hand side dense matrix of the multiplication.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the multiplication of the Kronecker product of \a A and \a B with a
+// dense matrix with the multiplication of the explicitly formed Kronecker product for the
+// assignment to dense and sparse matrices of both storage orders, addition assignment,
+// subtraction assignment, Schur product assignment and scaled assignment. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT1    // Type of the left-hand side factor
+        , typename MT2    // Type of the right-hand side factor
+        , typename MT3 >  // Type of the right-hand side dense matrix
+void MultTest::testMatrix( const MT1& A, const MT2& B, const MT3& C )
+{
+   const DMat K( kron( A, B ) );
+   const DMat ref( K * C );
+
+   {
+      DMat res( kron( A, B ) * C );
+      checkResult( res, ref );
+   }
+
+   {
+      TDMat res( kron( A, B ) * C );
+      checkResult( res, ref );
+   }
+
+   {
+      SMat res( kron( A, B ) * C );
+      checkResult( res, ref );
+   }
+
+   {
+      TSMat res( kron( A, B ) * C );
+      checkResult( res, ref );
+   }
+
+   {
+      DMat res( ref );
+      res += kron( A, B ) * C;
+      checkResult( res, 2 * ref );
+   }
+
+   {
+      TDMat res( ref );
+      res -= kron( A, B ) * C;
+      checkResult( res, 0 * ref );
+   }
+
+   {
+      DMat res( ref );
+      res %= kron( A, B ) * C;
+      checkResult( res, ref % ref );
+   }
+
+   {
+      TDMat res( kron( A, B ) * ( C * 2 ) );
+      checkResult( res, 2 * ref );
+   }
+
+   {
+      DMat res( 3 * ( kron( A, B ) * trans( trans( C ) ) ) );
+      checkResult( res, 3 * ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking and comparing the computed result.
+//
+// \param computedResult The computed result.
+// \param expectedResult The expected result.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+//
+// This function is called after each test case to check and compare the computed result.
+// In case the computed and the expected result differ in any way, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename T1    // Type of the computed result
+        , typename T2 >  // Type of the expected result
+void MultTest::checkResult( const T1& computedResult, const T2& expectedResult )
+{
+   if( computedResult != expectedResult ) {
+      std::ostringstream oss;
+      oss << " Test : " << test_ << "\n"
+          << " Error: Incorrect result detected\n"
+          << " Details:\n"
+          << "   Computed result:\n" << computedResult << "\n"
+          << "   Expected result:\n" << expectedResult << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization of a dense or sparse matrix with deterministic values.
+//
+// \param mat The matrix to be initialized.
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param seed The seed for the values of the matrix.
+// \return void
+//
+// This function resizes the given matrix and initializes it with small integral values. In
+// case of a sparse matrix only every third element is set.
+*/
+template< typename MT >  // Type of the matrix
+void MultTest::initialize( MT& mat, size_t m, size_t n, int seed )
+{
+   mat.resize( m, n, false );
+   reset( mat );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         if( blaze::IsDenseMatrix_v<MT> || ( i + 2UL*j + size_t( seed ) ) % 3UL == 0UL ) {
+            mat(i,j) = static_cast<int>( ( i*7UL + j*3UL + size_t( seed ) ) % 7UL ) - 3;
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of a dense vector with deterministic values.
+//
+// \param vec The vector to be initialized.
+// \param n The size of the vector.
+// \param seed The seed for the values of the vector.
+// \return void
+//
+// This function resizes the given vector and initializes it with small integral values.
+*/
+inline void MultTest::initialize( DVec& vec, size_t n, int seed )
+{
+   vec.resize( n, false );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      vec[i] = static_cast<int>( ( i*5UL + size_t( seed ) ) % 9UL ) - 4;
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the multiplication of Kronecker products with vectors and matrices.
+//
+// \return void
+*/
+void runTest()
+{
+   MultTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the Kronecker product multiplication test.
+*/
+#define RUN_DMATDMATKRON_MULT_TEST \
+   blazetest::mathtest::dmatdmatkron::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace dmatdmatkron
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,306 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/dmatdmatmult/ChainTest.h
+//  \brief Header file for the dense matrix/dense matrix multiplication chain test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_DMATDMATMULT_CHAINTEST_H_
+#define _BLAZETEST_MATHTEST_DMATDMATMULT_CHAINTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/expressions/MatMatMultChain.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace dmatdmatmult {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the dense matrix/dense matrix multiplication chain test.
+//
+// This class represents a test suite for the reordering of chains of matrix multiplications
+// (as for instance \f$ A*B*C \f$). It performs a series of runtime tests to assure that the
+// selected evaluation order is the cheapest one and that reordered chains produce the same
+// result as the left-to-right evaluation. Since all tests are performed with integral element
+// types, the results of all evaluation orders are required to be identical.
+*/
+class ChainTest
+{
+ private:
+   //**Type definitions****************************************************************************
+   using DMat  = blaze::DynamicMatrix<int,blaze::rowMajor>;         //!< Row-major dense matrix type.
+   using TDMat = blaze::DynamicMatrix<int,blaze::columnMajor>;      //!< Column-major dense matrix type.
+   using SMat  = blaze::CompressedMatrix<int,blaze::rowMajor>;      //!< Row-major sparse matrix type.
+   using TSMat = blaze::CompressedMatrix<int,blaze::columnMajor>;   //!< Column-major sparse matrix type.
+   //**********************************************************************************************
+
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ChainTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testSelection ();
+   void testDenseChain();
+   void testMixedChain();
+   void testLongChain ();
+   void testAliasing  ();
+
+   template< typename MT1, typename MT2, typename MT3 >
+   void testChain( const MT1& A, const MT2& B, const MT3& C );
+
+   template< typename T1, typename T2 >
+   void checkResult( const T1& computedResult, const T2& expectedResult );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT >
+   void initialize( MT& mat, size_t m, size_t n, int seed );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of all assignment operations of the chain \f$ A*B*C \f$.
+//
+// \param A The first factor of the chain.
+// \param B The second factor of the chain.
+// \param C The third factor of the chain.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the (possibly reordered) chains \f$ A*B*C \f$ and \f$ A*(B*C) \f$
+// with the explicit left-to-right evaluation for assignment, addition assignment, subtraction
+// assignment and scaled assignment. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename MT1    // Type of the first factor
+        , typename MT2    // Type of the second factor
+        , typename MT3 >  // Type of the third factor
+void ChainTest::testChain( const MT1& A, const MT2& B, const MT3& C )
+{
+   const DMat AB( A * B );
+   const DMat ref( AB * C );
+
+   {
+      DMat res( A * B * C );
+      checkResult( res, ref );
+   }
+
+   {
+      TDMat res( A * ( B * C ) );
+      checkResult( res, ref );
+   }
+
+   {
+      DMat res( ref );
+      res += A * B * C;
+      checkResult( res, 2 * ref );
+   }
+
+   {
+      TDMat res( ref );
+      res -= A * B * C;
+      checkResult( res, 0 * ref );
+   }
+
+   {
+      DMat res( 3 * A * B * C );
+      checkResult( res, 3 * ref );
+   }
+
+   {
+      TDMat res( ref );
+      res += A * ( B * C ) * 2;
+      checkResult( res, 3 * ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking and comparing the computed result.
+//
+// \param computedResult The computed result.
+// \param expectedResult The expected result.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+//
+// This function is called after each test case to check and compare the computed result.
+// In case the computed and the expected result differ in any way, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename T1    // Matrix type of the computed result
+        , typename T2 >  // Matrix type of the expected result
+void ChainTest::checkResult( const T1& computedResult, const T2& expectedResult )
+{
+   if( computedResult != expectedResult ) {
+      std::ostringstream oss;
+      oss << " Test : " << test_ << "\n"
+          << " Error: Incorrect result detected\n"
+          << " Details:\n"
+          << "   Computed result:\n" << computedResult << "\n"
+          << "   Expected result:\n" << expectedResult << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization of a dense or sparse matrix with deterministic values.
+//
+// \param mat The matrix to be initialized.
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param seed The seed for the values of the matrix.
+// \return void
+//
+// This function resizes the given matrix and initializes it with small integral values. In
+// case of a sparse matrix only every third element is set.
+*/
+template< typename MT >  // Type of the matrix
+void ChainTest::initialize( MT& mat, size_t m, size_t n, int seed )
+{
+   mat.resize( m, n, false );
+   reset( mat );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         if( blaze::IsDenseMatrix_v<MT> || ( i + 2UL*j + size_t( seed ) ) % 3UL == 0UL ) {
+            mat(i,j) = static_cast<int>( ( i*7UL + j*3UL + size_t( seed ) ) % 7UL ) - 3;
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the reordering of matrix multiplication chains.
+//
+// \return void
+*/
+void runTest()
+{
+   ChainTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the matrix multiplication chain test.
+*/
+#define RUN_DMATDMATMULT_CHAIN_TEST \
+   blazetest::mathtest::dmatdmatmult::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace dmatdmatmult
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,373 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/dmatreduce/total/ParallelTest.h
+//  \brief Header file for the dense matrix parallel total reduction test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZETEST_MATHTEST_DMATREDUCE_TOTAL_PARALLELTEST_H_
+#define _BLAZETEST_MATHTEST_DMATREDUCE_TOTAL_PARALLELTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/Submatrix.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace dmatreduce {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the parallel total reduction of dense matrices.
+//
+// This class represents a test suite for the block-wise parallel total reduction of row-major
+// and column-major dense matrices (sum, min, max, and norms). It performs a series of runtime
+// tests with operands that are large enough to be reduced in parallel. Each result is compared
+// to a reference value and to the result of the serial evaluation, which is required to be
+// bitwise identical.
+*/
+class ParallelTest
+{
+ private:
+   //**Type definitions****************************************************************************
+   using DMat  = blaze::DynamicMatrix<double,blaze::rowMajor>;     //!< Row-major matrix type.
+   using TDMat = blaze::DynamicMatrix<double,blaze::columnMajor>;  //!< Column-major matrix type.
+   using IMat  = blaze::DynamicMatrix<int,blaze::rowMajor>;        //!< Integral matrix type.
+   //**********************************************************************************************
+
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ParallelTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename MT > void testReduction();
+   template< typename MT > void testNorm     ();
+
+   template< typename T1, typename T2, typename T3 >
+   void checkResult( const T1& computedResult, const T2& serialResult,
+                     const T3& expectedResult, double tolerance = 0.0 );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT > void initialize( MT& mat );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time constants**********************************************************************
+   static constexpr size_t M = 701UL;  //!< Number of rows of the matrix operands.
+   static constexpr size_t N = 509UL;  //!< Number of columns of the matrix operands.
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the parallel total reduction operations of dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the parallel sum, min, max, and custom total reduction of dense matrices
+// of the given type. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT >  // Type of the dense matrix
+void ParallelTest::testReduction()
+{
+   MT A( M, N );
+   IMat K( M, N );
+
+   initialize( A );
+
+   for( size_t i=0UL; i<M; ++i ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         K(i,j) = int( ( i*7UL + j ) % 13UL ) - 6;
+      }
+   }
+
+   long double sumA( 0.0L ), sumSub( 0.0L );
+   double minA( A(0UL,0UL) ), maxA( A(0UL,0UL) );
+   int sumK( 0 );
+
+   for( size_t i=0UL; i<M; ++i ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         sumA += A(i,j);
+         sumK += K(i,j);
+         minA = std::min( minA, A(i,j) );
+         maxA = std::max( maxA, A(i,j) );
+         if( i >= 1UL && i < M-2UL && j >= 3UL && j < N-4UL ) sumSub += A(i,j);
+      }
+   }
+
+   {
+      test_ = "Sum of a matrix";
+      checkResult( sum( A ), sum( blaze::serial( A ) ), sumA, 1E-10 );
+   }
+
+   {
+      test_ = "Sum of an integral matrix";
+      checkResult( sum( K ), sum( blaze::serial( K ) ), sumK );
+   }
+
+   {
+      test_ = "Sum of an unaligned submatrix";
+      checkResult( sum( submatrix( A, 1UL, 3UL, M-3UL, N-7UL ) ),
+                   sum( blaze::serial( submatrix( A, 1UL, 3UL, M-3UL, N-7UL ) ) ), sumSub, 1E-10 );
+   }
+
+   {
+      test_ = "Sum of a scaled matrix";
+      checkResult( sum( A * 2.0 ), sum( blaze::serial( A * 2.0 ) ), 2.0L*sumA, 1E-10 );
+   }
+
+   {
+      test_ = "Minimum of a matrix";
+      checkResult( min( A ), min( blaze::serial( A ) ), minA );
+   }
+
+   {
+      test_ = "Maximum of a matrix";
+      checkResult( max( A ), max( blaze::serial( A ) ), maxA );
+   }
+
+   {
+      test_ = "Custom reduction of a matrix";
+      const auto op = []( double x, double y ){ return x + y; };
+      checkResult( reduce( A, op ), reduce( blaze::serial( A ), op ), sumA, 1E-10 );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the parallel norm computations of dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the parallel computation of several norms of dense matrices of the given
+// type. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT >  // Type of the dense matrix
+void ParallelTest::testNorm()
+{
+   MT A( M, N );
+
+   initialize( A );
+
+   long double sqrsum( 0.0L ), abssum( 0.0L );
+
+   for( size_t i=0UL; i<M; ++i ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         sqrsum += A(i,j)*A(i,j);
+         abssum += std::abs( A(i,j) );
+      }
+   }
+
+   {
+      test_ = "L2 norm of a matrix";
+      checkResult( norm( A ), norm( blaze::serial( A ) ), std::sqrt( sqrsum ), 1E-10 );
+   }
+
+   {
+      test_ = "Squared L2 norm of a matrix";
+      checkResult( sqrNorm( A ), sqrNorm( blaze::serial( A ) ), sqrsum, 1E-10 );
+   }
+
+   {
+      test_ = "L1 norm of a matrix";
+      checkResult( l1Norm( A ), l1Norm( blaze::serial( A ) ), abssum, 1E-10 );
+   }
+
+   {
+      test_ = "L2 norm of a matrix addition";
+      checkResult( norm( A + A ), norm( blaze::serial( A + A ) ), 2.0L*std::sqrt( sqrsum ), 1E-10 );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking and comparing the computed result.
+//
+// \param computedResult The computed result.
+// \param serialResult The result of the serial evaluation.
+// \param expectedResult The expected result.
+// \param tolerance The relative tolerance for the comparison with the expected result.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+//
+// This function is called after each test case to check and compare the computed result. In
+// case the computed result differs from the result of the serial evaluation in any way or
+// in case it differs from the expected result by more than the given relative tolerance, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename T1    // Type of the computed result
+        , typename T2    // Type of the serial result
+        , typename T3 >  // Type of the expected result
+void ParallelTest::checkResult( const T1& computedResult, const T2& serialResult,
+                                const T3& expectedResult, double tolerance )
+{
+   const long double error( std::abs( static_cast<long double>( computedResult - expectedResult ) ) );
+   const long double bound( tolerance * std::max<long double>( std::abs( expectedResult ), 1.0L ) );
+
+   if( computedResult != serialResult || error > bound ) {
+      std::ostringstream oss;
+      oss << std::setprecision( 20 )
+          << " Test : " << test_ << "\n"
+          << " Error: Incorrect result detected\n"
+          << " Details:\n"
+          << "   Computed result: " << computedResult << "\n"
+          << "   Serial result  : " << serialResult << "\n"
+          << "   Expected result: " << expectedResult << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Deterministic initialization of the given dense matrix.
+//
+// \param mat The matrix to be initialized.
+// \return void
+*/
+template< typename MT >  // Type of the dense matrix
+void ParallelTest::initialize( MT& mat )
+{
+   for( size_t i=0UL; i<mat.rows(); ++i ) {
+      for( size_t j=0UL; j<mat.columns(); ++j ) {
+         mat(i,j) = std::sin( i*0.3 + j*0.7 );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the parallel total reduction of dense matrices.
+//
+// \return void
+*/
+void runTest()
+{
+   ParallelTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the dense matrix parallel total reduction test.
+*/
+#define RUN_DMATREDUCE_TOTAL_PARALLEL_TEST \
+   blazetest::mathtest::dmatreduce::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace dmatreduce
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
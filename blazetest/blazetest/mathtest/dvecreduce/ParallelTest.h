@@ -0,0 +1,411 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/dvecreduce/ParallelTest.h
+//  \brief Header file for the dense vector parallel reduction test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZETEST_MATHTEST_DVECREDUCE_PARALLELTEST_H_
+#define _BLAZETEST_MATHTEST_DVECREDUCE_PARALLELTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Subvector.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace dvecreduce {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the parallel reduction of dense vectors.
+//
+// This class represents a test suite for the block-wise parallel total reduction of dense
+// vectors (sum, min, max, norms, and inner products). It performs a series of runtime tests
+// with operands that are large enough to be reduced in parallel. Each result is compared to
+// a reference value and to the result of the serial evaluation, which is required to be
+// bitwise identical.
+*/
+class ParallelTest
+{
+ private:
+   //**Type definitions****************************************************************************
+   using DVec = blaze::DynamicVector<double,blaze::columnVector>;  //!< Double precision vector type.
+   using FVec = blaze::DynamicVector<float,blaze::columnVector>;   //!< Single precision vector type.
+   using IVec = blaze::DynamicVector<int,blaze::columnVector>;     //!< Integral vector type.
+   //**********************************************************************************************
+
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ParallelTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testReduction();
+   void testNorm     ();
+   void testInner    ();
+
+   template< typename T1, typename T2, typename T3 >
+   void checkResult( const T1& computedResult, const T2& serialResult,
+                     const T3& expectedResult, double tolerance = 0.0 );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename VT > void initialize( VT& vec, double scale );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time constants**********************************************************************
+   static constexpr size_t N = 200003UL;  //!< Size of the vector operands.
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the parallel reduction operations of dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the parallel sum, min, max, and custom reduction of dense vectors. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+inline void ParallelTest::testReduction()
+{
+   DVec a( N );
+   FVec f( N );
+   IVec k( N );
+
+   initialize( a, 1.0 );
+   initialize( f, 1.0 );
+
+   for( size_t i=0UL; i<N; ++i ) {
+      k[i] = int( i % 11UL ) - 5;
+   }
+
+   long double sumA( 0.0L ), sumF( 0.0L ), sumSub( 0.0L );
+   double minA( a[0UL] ), maxA( a[0UL] );
+   int sumK( 0 );
+
+   for( size_t i=0UL; i<N; ++i ) {
+      sumA += a[i];
+      sumF += f[i];
+      sumK += k[i];
+      minA = std::min( minA, a[i] );
+      maxA = std::max( maxA, a[i] );
+      if( i >= 3UL && i < N-7UL ) sumSub += a[i];
+   }
+
+   {
+      test_ = "Sum of a double precision vector";
+      checkResult( sum( a ), sum( blaze::serial( a ) ), sumA, 1E-10 );
+   }
+
+   {
+      test_ = "Sum of a single precision vector";
+      checkResult( sum( f ), sum( blaze::serial( f ) ), sumF, 1E-3 );
+   }
+
+   {
+      test_ = "Sum of an integral vector";
+      checkResult( sum( k ), sum( blaze::serial( k ) ), sumK );
+   }
+
+   {
+      test_ = "Sum of an unaligned subvector";
+      checkResult( sum( subvector( a, 3UL, N-10UL ) ),
+                   sum( blaze::serial( subvector( a, 3UL, N-10UL ) ) ), sumSub, 1E-10 );
+   }
+
+   {
+      test_ = "Sum of a vector addition";
+      checkResult( sum( a + a ), sum( blaze::serial( a + a ) ), 2.0L*sumA, 1E-10 );
+   }
+
+   {
+      test_ = "Minimum of a vector";
+      checkResult( min( a ), min( blaze::serial( a ) ), minA );
+   }
+
+   {
+      test_ = "Maximum of a vector";
+      checkResult( max( a ), max( blaze::serial( a ) ), maxA );
+   }
+
+   {
+      test_ = "Custom reduction of a vector";
+      const auto op = []( double x, double y ){ return x + y; };
+      checkResult( reduce( a, op ), reduce( blaze::serial( a ), op ), sumA, 1E-10 );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the parallel norm computations of dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the parallel computation of several norms of dense vectors. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+inline void ParallelTest::testNorm()
+{
+   DVec a( N );
+
+   initialize( a, 1.0 );
+
+   long double sqrsum( 0.0L ), abssum( 0.0L ), maxabs( 0.0L );
+
+   for( size_t i=0UL; i<N; ++i ) {
+      sqrsum += a[i]*a[i];
+      abssum += std::abs( a[i] );
+      maxabs  = std::max<long double>( maxabs, std::abs( a[i] ) );
+   }
+
+   {
+      test_ = "L2 norm of a vector";
+      checkResult( norm( a ), norm( blaze::serial( a ) ), std::sqrt( sqrsum ), 1E-10 );
+   }
+
+   {
+      test_ = "Squared L2 norm of a vector";
+      checkResult( sqrNorm( a ), sqrNorm( blaze::serial( a ) ), sqrsum, 1E-10 );
+   }
+
+   {
+      test_ = "L1 norm of a vector";
+      checkResult( l1Norm( a ), l1Norm( blaze::serial( a ) ), abssum, 1E-10 );
+   }
+
+   {
+      test_ = "Maximum norm of a vector";
+      checkResult( maxNorm( a ), maxNorm( blaze::serial( a ) ), maxabs );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the parallel inner product of two dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the parallel computation of the inner product of two dense vectors. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+inline void ParallelTest::testInner()
+{
+   DVec a( N ), b( N );
+
+   initialize( a, 1.0 );
+   initialize( b, 0.3 );
+
+   long double inner( 0.0L ), inner2( 0.0L );
+
+   for( size_t i=0UL; i<N; ++i ) {
+      inner  += a[i]*b[i];
+      inner2 += ( a[i] + b[i] ) * b[i];
+   }
+
+   {
+      test_ = "Inner product (trans(a) * b)";
+      checkResult( trans( a ) * b, blaze::serial( trans( a ) ) * b, inner, 1E-10 );
+   }
+
+   {
+      test_ = "Inner product of an expression (dot(a+b,b))";
+      checkResult( dot( a + b, b ), dot( blaze::serial( a + b ), b ), inner2, 1E-10 );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking and comparing the computed result.
+//
+// \param computedResult The computed result.
+// \param serialResult The result of the serial evaluation.
+// \param expectedResult The expected result.
+// \param tolerance The relative tolerance for the comparison with the expected result.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+//
+// This function is called after each test case to check and compare the computed result. In
+// case the computed result differs from the result of the serial evaluation in any way or
+// in case it differs from the expected result by more than the given relative tolerance, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename T1    // Type of the computed result
+        , typename T2    // Type of the serial result
+        , typename T3 >  // Type of the expected result
+void ParallelTest::checkResult( const T1& computedResult, const T2& serialResult,
+                                const T3& expectedResult, double tolerance )
+{
+   const long double error( std::abs( static_cast<long double>( computedResult - expectedResult ) ) );
+   const long double bound( tolerance * std::max<long double>( std::abs( expectedResult ), 1.0L ) );
+
+   if( computedResult != serialResult || error > bound ) {
+      std::ostringstream oss;
+      oss << std::setprecision( 20 )
+          << " Test : " << test_ << "\n"
+          << " Error: Incorrect result detected\n"
+          << " Details:\n"
+          << "   Computed result: " << computedResult << "\n"
+          << "   Serial result  : " << serialResult << "\n"
+          << "   Expected result: " << expectedResult << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Deterministic initialization of the given dense vector.
+//
+// \param vec The vector to be initialized.
+// \param scale The scaling factor for the argument of the sine.
+// \return void
+*/
+template< typename VT >  // Type of the dense vector
+void ParallelTest::initialize( VT& vec, double scale )
+{
+   using ET = blaze::ElementType_t<VT>;
+
+   for( size_t i=0UL; i<vec.size(); ++i ) {
+      vec[i] = static_cast<ET>( std::sin( scale * ( i * 0.37 ) ) );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the parallel reduction of dense vectors.
+//
+// \return void
+*/
+void runTest()
+{
+   ParallelTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the dense vector parallel reduction test.
+*/
+#define RUN_DVECREDUCE_PARALLEL_TEST \
+   blazetest::mathtest::dvecreduce::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace dvecreduce
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
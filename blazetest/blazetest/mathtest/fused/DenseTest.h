@@ -0,0 +1,449 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/fused/DenseTest.h
+//  \brief Header file for the fused dense vector evaluation test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZETEST_MATHTEST_FUSED_DENSETEST_H_
+#define _BLAZETEST_MATHTEST_FUSED_DENSETEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/DenseVector.h>
+#include <blaze/math/functors/Max.h>
+#include <blaze/math/functors/Min.h>
+#include <blaze/math/SMP.h>
+#include <blaze/math/Subvector.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/IsEqual.h>
+#include <blazetest/system/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace fused {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all fused dense vector evaluation tests.
+//
+// This class represents a test suite for the fused evaluation of several dense vector statements
+// (see the fused() function). It performs a series of fused assignments and reductions and
+// compares the results to the results of the according separate statements.
+*/
+class DenseTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit DenseTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testSubvector();
+   void testReduction();
+   void testSizeMismatch();
+
+   template< typename VT >
+   void testUpdate( size_t N );
+
+   template< typename VT >
+   void testAssignment( size_t N );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename T1, typename T2 >
+   void checkResult( const T1& result, const T2& expected, const char* error ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the fused update of a conjugate gradient iteration.
+//
+// \param N The size of the vectors.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the fused evaluation of two scaled vector updates and the subsequent
+// computation of the squared norm of an updated vector. The results are compared to the
+// separate evaluation of the three statements. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename VT >  // Type of the dense vector
+void DenseTest::testUpdate( size_t N )
+{
+   using ET = blaze::ElementType_t<VT>;
+
+   test_ = "Fused conjugate gradient update";
+
+   VT x, r, p, q;
+   resize( x, N );
+   resize( r, N );
+   resize( p, N );
+   resize( q, N );
+   randomize( x );
+   randomize( r );
+   randomize( p );
+   randomize( q );
+
+   const ET alpha( 2 );
+
+   VT xref( x ), rref( r );
+   xref += alpha * p;
+   rref -= alpha * q;
+   const ET rrref( sum( rref * rref ) );
+
+   ET rr( 1 );
+
+   blaze::fused( blaze::deferred( x ) += alpha * p,
+                 blaze::deferred( r ) -= alpha * q,
+                 blaze::reduceTo( rr, r * r ) );
+
+   checkResult( x, xref, "Fused addition assignment failed" );
+   checkResult( r, rref, "Fused subtraction assignment failed" );
+   checkResult( rr, rrref, "Fused reduction failed" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of all fused (compound) assignment operations.
+//
+// \param N The size of the vectors.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the fused evaluation of an assignment, an addition assignment, a
+// subtraction assignment, a multiplication assignment and a division assignment. The later
+// statements use the targets of the earlier statements as operands. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename VT >  // Type of the dense vector
+void DenseTest::testAssignment( size_t N )
+{
+   using ET = blaze::ElementType_t<VT>;
+
+   test_ = "Fused (compound) assignments";
+
+   VT a, b, c, d;
+   resize( a, N );
+   resize( b, N );
+   resize( c, N );
+   resize( d, N );
+   randomize( a );
+   randomize( b );
+   randomize( c );
+   randomize( d );
+
+   for( size_t i=0UL; i<N; ++i ) {
+      d[i] = ET( 1 ) + ET( i % 5UL );
+   }
+
+   VT aref( a ), bref( b ), cref( c ), dref( d );
+   aref  = bref + cref;
+   bref += aref;
+   cref -= aref * bref;
+   dref *= bref;
+   aref /= dref;
+   const ET maxref( max( aref ) );
+
+   ET amax( 0 );
+
+   blaze::fused( blaze::deferred( a ) = b + c,
+                 blaze::deferred( b ) += a,
+                 blaze::deferred( c ) -= a * b,
+                 blaze::deferred( d ) *= b,
+                 blaze::deferred( a ) /= d,
+                 blaze::reduceTo( amax, a, blaze::Max() ) );
+
+   checkResult( a, aref, "Fused assignment failed" );
+   checkResult( b, bref, "Fused addition assignment failed" );
+   checkResult( c, cref, "Fused subtraction assignment failed" );
+   checkResult( d, dref, "Fused multiplication assignment failed" );
+
+   if( N > 0UL ) {
+      checkResult( amax, maxref, "Fused maximum reduction failed" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the fused assignment to subvectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests fused statements with targets that are views on a dense vector. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void DenseTest::testSubvector()
+{
+   test_ = "Fused assignment to subvectors";
+
+   blaze::DynamicVector<int> v( 300UL ), w( 100UL );
+   randomize( v, -10, 10 );
+   randomize( w, -10, 10 );
+
+   blaze::DynamicVector<int> ref( v );
+   subvector( ref, 0UL, 100UL ) += 3 * w;
+   subvector( ref, 200UL, 100UL ) = subvector( ref, 0UL, 100UL ) - w;
+   const int sref( sum( subvector( ref, 200UL, 100UL ) ) );
+
+   auto sv1 = subvector( v, 0UL, 100UL );
+   auto sv2 = subvector( v, 200UL, 100UL );
+   int s( 0 );
+
+   blaze::fused( blaze::deferred( sv1 ) += 3 * w,
+                 blaze::deferred( sv2 ) = sv1 - w,
+                 blaze::reduceTo( s, sv2 ) );
+
+   checkResult( v, ref, "Fused subvector assignment failed" );
+   checkResult( s, sref, "Fused subvector reduction failed" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of fused reductions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests fused reductions with different reduction operations as well as the
+// reduction of empty vectors. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void DenseTest::testReduction()
+{
+   test_ = "Fused reductions";
+
+   {
+      blaze::DynamicVector<int> a( 1000UL ), b( 1000UL );
+      randomize( a, -100, 100 );
+      randomize( b, -100, 100 );
+
+      int s1( 0 ), s2( 0 ), s3( 0 ), s4( 0 );
+
+      blaze::fused( blaze::reduceTo( s1, a * b ),
+                    blaze::reduceTo( s2, a - b, blaze::Min() ),
+                    blaze::reduceTo( s3, a, blaze::Max() ),
+                    blaze::reduceTo( s4, b, []( int x, int y ){ return x + y; } ) );
+
+      checkResult( s1, dot( a, b ), "Fused inner product failed" );
+      checkResult( s2, min( a - b ), "Fused minimum reduction failed" );
+      checkResult( s3, max( a ), "Fused maximum reduction failed" );
+      checkResult( s4, sum( b ), "Fused custom reduction failed" );
+   }
+
+   {
+      blaze::DynamicVector<double> a, b;
+      double s( 1.0 );
+
+      blaze::fused( blaze::deferred( a ) += b, blaze::reduceTo( s, a * b ) );
+
+      checkResult( s, 0.0, "Fused reduction of empty vectors failed" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of fused statements with operands of different size.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that fused statements with operands of different size fail with a
+// \a std::invalid_argument exception and that in this case none of the statements is evaluated.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void DenseTest::testSizeMismatch()
+{
+   test_ = "Fused evaluation with size mismatch";
+
+   try {
+      blaze::DynamicVector<double> a( 3UL ), b( 4UL );
+      blaze::fused( blaze::deferred( a ) += b );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Fused addition assignment of different size succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   blaze::DynamicVector<int> a{ 1, 2, 3 }, b{ 4, 5, 6 }, c{ 7, 8, 9, 10 };
+   int s( 0 );
+
+   try {
+      blaze::fused( blaze::deferred( a ) += b, blaze::reduceTo( s, c ) );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Fused evaluation of statements of different size succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   checkResult( a, blaze::DynamicVector<int>{ 1, 2, 3 }, "Failed fused evaluation modified target" );
+   checkResult( s, 0, "Failed fused evaluation modified reduction target" );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the result of a fused evaluation.
+//
+// \param result The result of the fused evaluation.
+// \param expected The result of the according separate statements.
+// \param error The error message in case the results differ.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename T1    // Type of the result
+        , typename T2 >  // Type of the expected result
+void DenseTest::checkResult( const T1& result, const T2& expected, const char* error ) const
+{
+   if( !isEqual( result, expected ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: " << error << "\n"
+          << " Details:\n"
+          << "   Type:\n"
+          << "     " << typeid( T1 ).name() << "\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the fused dense vector evaluation.
+//
+// \return void
+*/
+void runTest()
+{
+   DenseTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the fused dense vector evaluation test.
+*/
+#define RUN_FUSED_DENSE_TEST \
+   blazetest::mathtest::fused::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace fused
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,592 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/lapack/NativeTest.h
+//  \brief Header file for the native LAPACK kernel test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_LAPACK_NATIVETEST_H_
+#define _BLAZETEST_MATHTEST_LAPACK_NATIVETEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <utility>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/IdentityMatrix.h>
+#include <blaze/math/LAPACK.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace lapack {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the native LAPACK kernels.
+//
+// This class represents a test suite for the native LU, Cholesky, and QR decomposition kernels,
+// which are used in case the LAPACK mode is disabled (see the BLAZE_LAPACK_MODE switch) and for
+// small matrices with fixed maximum size. In contrast to the other LAPACK tests, this test does
+// not require a LAPACK library.
+*/
+class NativeTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit NativeTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename MT > void testLU( size_t m, size_t n );
+   template< typename MT > void testLLH( size_t n );
+   template< typename MT > void testQR( size_t m, size_t n );
+   template< typename MT > void testInversion( size_t n );
+   template< typename MT > void testDeterminant( size_t n );
+   template< typename MT > void testSingular( size_t n );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT > void error( const MT& result, const MT& expected, size_t m, size_t n );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the native LU decomposition.
+//
+// \param m The number of rows of the test matrix.
+// \param n The number of columns of the test matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the native LU decomposition with a randomly initialized matrix of the
+// given type. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT >
+void NativeTest::testLU( size_t m, size_t n )
+{
+   test_ = "Native LU decomposition";
+
+   using RT = blaze::DynamicMatrix< blaze::ElementType_t<MT>, blaze::StorageOrder_v<MT> >;
+
+   MT A, L, U, P;
+
+   resize( A, m, n );
+   randomize( A );
+
+   blaze::lu( A, L, U, P );
+
+   RT LU( L*U );
+
+   if( blaze::IsRowMajorMatrix_v<MT> ) {
+      LU = LU * P;
+   }
+   else {
+      LU = P * LU;
+   }
+
+   if( LU != A ) {
+      error( LU, RT( A ), m, n );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the native Cholesky decomposition.
+//
+// \param n The number of rows and columns of the test matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the native Cholesky decomposition with a randomly initialized positive
+// definite matrix of the given type. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename MT >
+void NativeTest::testLLH( size_t n )
+{
+   test_ = "Native LLH decomposition";
+
+   using RT = blaze::DynamicMatrix< blaze::ElementType_t<MT>, blaze::StorageOrder_v<MT> >;
+
+   MT B, A, L;
+
+   resize( B, n, n );
+   randomize( B );
+
+   A = B * ctrans( B );
+   for( size_t i=0UL; i<n; ++i ) {
+      A(i,i) += n;
+   }
+
+   blaze::llh( A, L );
+
+   const RT LLH( L * ctrans( L ) );
+
+   if( LLH != A ) {
+      error( LLH, RT( A ), n, n );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the native QR decomposition.
+//
+// \param m The number of rows of the test matrix.
+// \param n The number of columns of the test matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the native QR decomposition with a randomly initialized matrix of the
+// given type. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT >
+void NativeTest::testQR( size_t m, size_t n )
+{
+   test_ = "Native QR decomposition";
+
+   using RT = blaze::DynamicMatrix< blaze::ElementType_t<MT>, blaze::StorageOrder_v<MT> >;
+
+   MT A, Q, R;
+
+   resize( A, m, n );
+   randomize( A );
+
+   blaze::qr( A, Q, R );
+
+   const RT QR( Q * R );
+
+   if( QR != A ) {
+      error( QR, RT( A ), m, n );
+   }
+
+   const size_t k( Q.columns() );
+   const RT QHQ( ctrans( Q ) * Q );
+
+   if( QHQ != blaze::IdentityMatrix< blaze::ElementType_t<MT> >( k ) ) {
+      error( QHQ, RT( blaze::IdentityMatrix< blaze::ElementType_t<MT> >( k ) ), k, k );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the native matrix inversion.
+//
+// \param n The number of rows and columns of the test matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the LU-, Bunch-Kaufman-, and Cholesky-based matrix inversions as well as
+// the inversion of triangular matrices with randomly initialized matrices of the given type.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT >
+void NativeTest::testInversion( size_t n )
+{
+   using blaze::byLU;
+   using blaze::byLDLT;
+   using blaze::byLDLH;
+   using blaze::byLLH;
+   using blaze::asLower;
+   using blaze::asUniUpper;
+
+   using ET = blaze::ElementType_t<MT>;
+   using RT = blaze::DynamicMatrix< ET, blaze::StorageOrder_v<MT> >;
+
+   const blaze::IdentityMatrix<ET> I( n );
+
+   MT A, B;
+   resize( A, n, n );
+   resize( B, n, n );
+
+   {
+      test_ = "Native LU-based inversion";
+
+      randomize( A );
+      for( size_t i=0UL; i<n; ++i ) {
+         A(i,i) += n;
+      }
+
+      B = A;
+      blaze::invert<byLU>( B );
+
+      const RT AB( A * B );
+
+      if( AB != I ) {
+         error( AB, RT( I ), n, n );
+      }
+   }
+
+   {
+      test_ = "Native Bunch-Kaufman-based inversion";
+
+      randomize( B );
+      A = B + trans( B );
+      for( size_t i=0UL; i<n; ++i ) {
+         A(i,i) += 2*n;
+      }
+
+      B = A;
+      blaze::invert<byLDLT>( B );
+
+      const RT AB( A * B );
+
+      if( AB != I || B != trans( B ) ) {
+         error( AB, RT( I ), n, n );
+      }
+
+      B = A + ctrans( A );
+
+      A = B;
+      blaze::invert<byLDLH>( B );
+
+      const RT AB2( A * B );
+
+      if( AB2 != I || B != ctrans( B ) ) {
+         error( AB2, RT( I ), n, n );
+      }
+   }
+
+   {
+      test_ = "Native Cholesky-based inversion";
+
+      randomize( B );
+      A = B * ctrans( B );
+      for( size_t i=0UL; i<n; ++i ) {
+         A(i,i) += n;
+      }
+
+      B = A;
+      blaze::invert<byLLH>( B );
+
+      const RT AB( A * B );
+
+      if( AB != I ) {
+         error( AB, RT( I ), n, n );
+      }
+   }
+
+   {
+      test_ = "Native triangular inversion";
+
+      randomize( A );
+      for( size_t i=0UL; i<n; ++i ) {
+         A(i,i) += n;
+         for( size_t j=i+1UL; j<n; ++j ) {
+            A(i,j) = ET(0);
+         }
+      }
+
+      B = A;
+      blaze::invert<asLower>( B );
+
+      const RT AB( A * B );
+
+      if( AB != I ) {
+         error( AB, RT( I ), n, n );
+      }
+
+      A = trans( A );
+      for( size_t i=0UL; i<n; ++i ) {
+         A(i,i) = ET(1);
+      }
+
+      B = A;
+      blaze::invert<asUniUpper>( B );
+
+      const RT AB2( A * B );
+
+      if( AB2 != I ) {
+         error( AB2, RT( I ), n, n );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the determinant computation by means of the native LU decomposition.
+//
+// \param n The number of rows and columns of the test matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the determinant computation with a randomly initialized upper triangular
+// matrix of the given type, whose first two rows are swapped. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename MT >
+void NativeTest::testDeterminant( size_t n )
+{
+   test_ = "Native determinant computation";
+
+   using std::swap;
+
+   using ET = blaze::ElementType_t<MT>;
+
+   MT A;
+   resize( A, n, n );
+   randomize( A );
+
+   ET expected( -1 );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( size_t j=0UL; j<i; ++j ) {
+         A(i,j) = ET(0);
+      }
+      A(i,i) = ( i % 2UL ) ? ET(2) : ET(0.5);
+      expected *= A(i,i);
+   }
+
+   swap( A(0UL,0UL), A(1UL,0UL) );
+   for( size_t j=1UL; j<n; ++j ) {
+      swap( A(0UL,j), A(1UL,j) );
+   }
+
+   const ET result( blaze::det( A ) );
+
+   if( !blaze::equal( result, expected ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Determinant computation failed\n"
+          << " Details:\n"
+          << "   Matrix type:\n"
+          << "     " << typeid( MT ).name() << "\n"
+          << "   Result: " << result << "\n"
+          << "   Expected result: " << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the error handling of the native kernels for singular matrices.
+//
+// \param n The number of rows and columns of the test matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the native LU- and Cholesky-based inversions of singular matrices
+// and the native Cholesky decomposition of indefinite matrices report an error in the same way
+// as the according LAPACK functions. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename MT >
+void NativeTest::testSingular( size_t n )
+{
+   test_ = "Native singular matrix handling";
+
+   using ET = blaze::ElementType_t<MT>;
+
+   MT A, L;
+   resize( A, n, n );
+   randomize( A );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      A(i,n/2UL) = ET(0);
+   }
+
+   try {
+      blaze::invert( A );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Inversion of singular matrix succeeded\n"
+          << " Details:\n"
+          << "   Matrix type:\n"
+          << "     " << typeid( MT ).name() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& ex ) {
+      if( std::string( ex.what() ).find( "Inversion of singular matrix failed" ) == std::string::npos )
+         throw;
+   }
+
+   A = blaze::IdentityMatrix<ET>( n );
+   A(n-1UL,n-1UL) = ET(-1);
+
+   try {
+      blaze::llh( A, L );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Cholesky decomposition of indefinite matrix succeeded\n"
+          << " Details:\n"
+          << "   Matrix type:\n"
+          << "     " << typeid( MT ).name() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& ex ) {
+      if( std::string( ex.what() ).find( "Decomposition of non-positive-definite matrix failed" ) == std::string::npos )
+         throw;
+   }
+
+   if( blaze::isPositiveDefinite( A ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Positive definiteness check failed\n"
+          << " Details:\n"
+          << "   Matrix type:\n"
+          << "     " << typeid( MT ).name() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Reporting an error of the currently performed test.
+//
+// \param result The computed result.
+// \param expected The expected result.
+// \param m The number of rows of the test matrix.
+// \param n The number of columns of the test matrix.
+// \return void
+// \exception std::runtime_error The error description.
+*/
+template< typename MT >
+void NativeTest::error( const MT& result, const MT& expected, size_t m, size_t n )
+{
+   std::ostringstream oss;
+   oss << " Test: " << test_ << "\n"
+       << " Error: Native decomposition failed\n"
+       << " Details:\n"
+       << "   Matrix type:\n"
+       << "     " << typeid( MT ).name() << "\n"
+       << "   Size: " << m << "x" << n << "\n"
+       << "   Maximum deviation: " << max( abs( result - expected ) ) << "\n";
+   throw std::runtime_error( oss.str() );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the native LAPACK kernels.
+//
+// \return void
+*/
+void runTest()
+{
+   NativeTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the native LAPACK kernel test.
+*/
+#define RUN_LAPACK_NATIVE_TEST \
+   blazetest::mathtest::lapack::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace lapack
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,283 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/matrixserializer/MappedTest.h
+//  \brief Header file for the mappable MatrixSerializer format test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_MATRIXSERIALIZER_MAPPEDTEST_H_
+#define _BLAZETEST_MATHTEST_MATRIXSERIALIZER_MAPPEDTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/constraints/Matrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/typetraits/IsDenseMatrix.h>
+#include <blaze/util/serialization/Archive.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace matrixserializer {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the mappable MatrixSerializer format.
+//
+// This class represents a test suite for the mappable (version 2) format of the
+// blaze::MatrixSerializer class and for the blaze::MatrixMapping class. It performs a series
+// of (de-)serialization tests and zero-copy mapping tests with both dense and sparse matrices.
+*/
+class MappedTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit MappedTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testDeserialization();
+   void testMapping        ();
+   void testFailures       ();
+
+   template< typename MT >
+   void runDeserializationTests( const MT& src );
+
+   template< typename MT1, typename MT2 >
+   void runTest( const MT1& src, MT2& dst );
+
+   template< typename MT1, typename MT2 >
+   void compareMatrices( const MT1& src, const MT2& dst );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Execution of several mappable (de-)serialization tests with the given source matrix.
+//
+// \param src The source matrix to be tested.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function serializes the given matrix in the mappable format and deserializes it into
+// row-major and column-major instances of DynamicMatrix and CompressedMatrix. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT >  // Type of the matrix
+void MappedTest::runDeserializationTests( const MT& src )
+{
+   BLAZE_CONSTRAINT_MUST_BE_MATRIX_TYPE( MT );
+
+   using ET = blaze::ElementType_t<MT>;
+
+   {
+      blaze::DynamicMatrix<ET,blaze::rowMajor> dst;
+      runTest( src, dst );
+   }
+
+   {
+      blaze::DynamicMatrix<ET,blaze::columnMajor> dst;
+      runTest( src, dst );
+   }
+
+   {
+      blaze::CompressedMatrix<ET,blaze::rowMajor> dst;
+      runTest( src, dst );
+   }
+
+   {
+      blaze::CompressedMatrix<ET,blaze::columnMajor> dst;
+      runTest( src, dst );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the mappable (de-)serialization with the given source and destination matrix.
+//
+// \param src The source matrix to be serialized.
+// \param dst The destination matrix to be reconstituted.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename MT1    // Type of the source matrix
+        , typename MT2 >  // Type of the destination matrix
+void MappedTest::runTest( const MT1& src, MT2& dst )
+{
+   BLAZE_CONSTRAINT_MUST_BE_MATRIX_TYPE( MT1 );
+   BLAZE_CONSTRAINT_MUST_BE_MATRIX_TYPE( MT2 );
+
+   blaze::Archive<std::stringstream> archive;
+
+   serialize( archive, src, blaze::mappable );
+   serialize( archive, src, blaze::mappable );
+
+   if( !archive ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Serialization failed\n"
+          << " Details:\n"
+          << "   Source matrix type:\n"
+          << "     " << typeid( MT1 ).name() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   archive >> dst;
+   compareMatrices( src, dst );
+
+   archive >> dst;
+   compareMatrices( src, dst );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Comparison of the source and the reconstituted matrix.
+//
+// \param src The source matrix.
+// \param dst The reconstituted matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename MT1    // Type of the source matrix
+        , typename MT2 >  // Type of the destination matrix
+void MappedTest::compareMatrices( const MT1& src, const MT2& dst )
+{
+   BLAZE_CONSTRAINT_MUST_BE_MATRIX_TYPE( MT1 );
+   BLAZE_CONSTRAINT_MUST_BE_MATRIX_TYPE( MT2 );
+
+   using blaze::IsDenseMatrix;
+
+   if( src.rows() != dst.rows() || src.columns() != dst.columns() || src != dst ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Matrix comparison failed\n"
+          << " Details:\n"
+          << "   " << ( IsDenseMatrix<MT1>::value ? ( "Dense" ) : ( "Sparse" ) ) << " source matrix type:\n"
+          << "     " << typeid( MT1 ).name() << "\n"
+          << "   " << ( IsDenseMatrix<MT2>::value ? ( "Dense" ) : ( "Sparse" ) ) << " destination matrix type:\n"
+          << "     " << typeid( MT2 ).name() << "\n"
+          << "   Source:\n" << src << "\n"
+          << "   Destination:\n" << dst << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the mappable format of the MatrixSerializer class.
+//
+// \return void
+*/
+void runTest()
+{
+   MappedTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the mappable MatrixSerializer format test.
+*/
+#define RUN_MATRIXSERIALIZER_MAPPED_TEST \
+   blazetest::mathtest::matrixserializer::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace matrixserializer
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
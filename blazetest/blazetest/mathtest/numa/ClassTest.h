@@ -0,0 +1,279 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/numa/ClassTest.h
+//  \brief Header file for the NUMA placement and thread affinity test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_NUMA_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_NUMA_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/util/Numa.h>
+#include <blaze/util/ThreadAffinity.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace numa {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the NUMA placement and thread affinity functionality.
+//
+// This class represents a test suite for the NUMA-aware memory placement of dynamic vectors and
+// matrices and for the pinning of the threads of the SMP backends. It tests the parsing of CPU
+// lists, the detection of the NUMA topology, the ThreadAffinity class, and the correctness of
+// dynamic vectors and matrices created and resized with all available NUMA policies.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testCpuList();
+   void testTopology();
+   void testAffinity();
+   void testThreadAffinity();
+   void testPolicy();
+   void testVector();
+   void testMatrix();
+
+   template< bool SO >
+   void testMatrix();
+
+   template< typename Type >
+   void checkSize( const Type& container, size_t expectedSize ) const;
+
+   template< typename Type >
+   void checkValues( const Type& vector, const blaze::ElementType_t<Type>& value ) const;
+
+   template< typename Type >
+   void checkMatrixValues( const Type& matrix, const blaze::ElementType_t<Type>& value ) const;
+
+   template< typename Type >
+   void checkIntact( const Type& container ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the size of the given list.
+//
+// \param container The list to be checked.
+// \param expectedSize The expected size of the list.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename Type >  // Type of the list
+void ClassTest::checkSize( const Type& container, size_t expectedSize ) const
+{
+   if( container.size() != expectedSize ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid size detected\n"
+          << " Details:\n"
+          << "   Size         : " << container.size() << "\n"
+          << "   Expected size: " << expectedSize << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking that all elements of the given vector have the given value.
+//
+// \param vector The vector to be checked.
+// \param value The expected value of all vector elements.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename Type >  // Type of the vector
+void ClassTest::checkValues( const Type& vector, const blaze::ElementType_t<Type>& value ) const
+{
+   for( size_t i=0UL; i<vector.size(); ++i ) {
+      if( vector[i] != value ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid vector element detected\n"
+             << " Details:\n"
+             << "   Size          : " << vector.size() << "\n"
+             << "   Index         : " << i << "\n"
+             << "   Element       : " << vector[i] << "\n"
+             << "   Expected value: " << value << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking that all elements of the given matrix have the given value.
+//
+// \param matrix The matrix to be checked.
+// \param value The expected value of all matrix elements.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename Type >  // Type of the matrix
+void ClassTest::checkMatrixValues( const Type& matrix, const blaze::ElementType_t<Type>& value ) const
+{
+   for( size_t i=0UL; i<matrix.rows(); ++i ) {
+      for( size_t j=0UL; j<matrix.columns(); ++j ) {
+         if( matrix(i,j) != value ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid matrix element detected\n"
+                << " Details:\n"
+                << "   Size          : " << matrix.rows() << "x" << matrix.columns() << "\n"
+                << "   Index         : (" << i << "," << j << ")\n"
+                << "   Element       : " << matrix(i,j) << "\n"
+                << "   Expected value: " << value << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the invariants (including the zero padding) of the given vector or matrix.
+//
+// \param container The vector or matrix to be checked.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename Type >  // Type of the vector or matrix
+void ClassTest::checkIntact( const Type& container ) const
+{
+   if( !container.isIntact() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invariant violation detected\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the NUMA placement and thread affinity functionality.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the NUMA placement and thread affinity test.
+*/
+#define RUN_NUMA_CLASS_TEST \
+   blazetest::mathtest::numa::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace numa
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
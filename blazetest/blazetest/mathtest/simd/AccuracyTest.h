@@ -0,0 +1,863 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/simd/AccuracyTest.h
+//  \brief Header file for the SIMD accuracy test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SIMD_ACCURACYTEST_H_
+#define _BLAZETEST_MATHTEST_SIMD_ACCURACYTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/SIMD.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/typetraits/IsFloat.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace simd {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class template for the accuracy test of the native SIMD math kernels.
+//
+// This class template represents the accuracy test of the native SIMD math kernels for the
+// floating point data type \a T (see the BLAZE_USE_SIMD_MATH switch). The vectorized exp(),
+// exp2(), exp10(), log(), log2(), log10(), sin(), cos(), tan(), tanh(), and pow() functions
+// are evaluated for a large number of deterministically sampled arguments and the results are
+// compared to the extended precision functions of the standard library. The maximum error
+// (in units in the last place, ulp) has to stay within the documented error bound. Additionally
+// the handling of special values (zeros, infinities, NaNs, overflow, and underflow) is tested.
+// In case the native SIMD math kernels are not active, all tests are skipped.
+*/
+template< typename T >  // Data type of the SIMD test
+class AccuracyTest : private blaze::NonCopyable
+{
+ private:
+   //**Type definitions****************************************************************************
+   using SIMDType = typename blaze::SIMDTrait<T>::Type;  //!< SIMD type for the given numeric type.
+   using Limits   = std::numeric_limits<T>;               //!< Numeric limits of the given numeric type.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   static constexpr size_t SIMDSIZE = blaze::SIMDTrait<T>::size;  //!< Number of elements in a single SIMD vector.
+   static constexpr size_t N = 65536UL;                           //!< Number of samples per argument range.
+   //**********************************************************************************************
+
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit AccuracyTest();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testExp          ();
+   void testExp2         ();
+   void testExp10        ();
+   void testLog          ();
+   void testLog2         ();
+   void testLog10        ();
+   void testSin          ();
+   void testCos          ();
+   void testTan          ();
+   void testTanh         ();
+   void testPow          ();
+   void testSpecialValues();
+
+   template< typename OP, typename REF >
+   void checkRange( T min, T max, bool logscale, double bound, OP op, REF ref );
+
+   void checkPow( T xmin, T xmax, T ymin, T ymax, double bound );
+   void checkPowInfinity( T xmin, T xmax );
+
+   template< typename OP >
+   void checkValue( const std::string& expr, OP op, T expected );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static T      sample( T min, T max, bool logscale, size_t i );
+   static double ulps  ( T value, long double ref );
+   static double bound ( double fbound, double dbound );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the AccuracyTest class template.
+//
+// \exception std::runtime_error Accuracy error detected.
+*/
+template< typename T >  // Data type of the SIMD test
+AccuracyTest<T>::AccuracyTest()
+   : test_()  // Label of the currently performed test
+{
+#if BLAZE_SIMD_MATH_MODE
+   testExp          ();
+   testExp2         ();
+   testExp10        ();
+   testLog          ();
+   testLog2         ();
+   testLog10        ();
+   testSin          ();
+   testCos          ();
+   testTan          ();
+   testTanh         ();
+   testPow          ();
+   testSpecialValues();
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the accuracy of the exp() operation.
+//
+// \return void
+// \exception std::runtime_error Accuracy error detected.
+*/
+template< typename T >  // Data type of the SIMD test
+void AccuracyTest<T>::testExp()
+{
+   test_ = "exp() operation";
+
+   const auto op ( []( const SIMDType& a ) { return blaze::exp( a ); } );
+   const auto ref( []( long double x ) { return std::exp( x ); } );
+   const double ulp( bound( 1.5, 2.0 ) );
+
+   checkRange( T(-1), T(1), false, ulp, op, ref );
+   checkRange( T(-87), T(88), false, ulp, op, ref );
+   checkRange( T(-103), T(-87), false, ulp, op, ref );
+   checkRange( T(-745), T(709), false, ulp, op, ref );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Testing the accuracy of the exp2() operation.
+//
+// \return void
+// \exception std::runtime_error Accuracy error detected.
+*/
+template< typename T >  // Data type of the SIMD test
+void AccuracyTest<T>::testExp2()
+{
+   test_ = "exp2() operation";
+
+   const auto op ( []( const SIMDType& a ) { return blaze::exp2( a ); } );
+   const auto ref( []( long double x ) { return std::exp2( x ); } );
+   const double ulp( bound( 1.5, 2.0 ) );
+
+   checkRange( T(-1), T(1), false, ulp, op, ref );
+   checkRange( T(-126), T(127), false, ulp, op, ref );
+   checkRange( T(-149), T(-126), false, ulp, op, ref );
+   checkRange( T(-1074), T(1023), false, ulp, op, ref );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Testing the accuracy of the exp10() operation.
+//
+// \return void
+// \exception std::runtime_error Accuracy error detected.
+*/
+template< typename T >  // Data type of the SIMD test
+void AccuracyTest<T>::testExp10()
+{
+   test_ = "exp10() operation";
+
+   const auto op ( []( const SIMDType& a ) { return blaze::exp10( a ); } );
+   const auto ref( []( long double x ) { return std::pow( 10.0L, x ); } );
+   const double ulp( bound( 1.5, 2.0 ) );
+
+   checkRange( T(-1), T(1), false, ulp, op, ref );
+   checkRange( T(-37), T(38), false, ulp, op, ref );
+   checkRange( T(-44), T(-37), false, ulp, op, ref );
+   checkRange( T(-323), T(308), false, ulp, op, ref );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Testing the accuracy of the log() operation.
+//
+// \return void
+// \exception std::runtime_error Accuracy error detected.
+*/
+template< typename T >  // Data type of the SIMD test
+void AccuracyTest<T>::testLog()
+{
+   test_ = "log() operation";
+
+   const auto op ( []( const SIMDType& a ) { return blaze::log( a ); } );
+   const auto ref( []( long double x ) { return std::log( x ); } );
+   const double ulp( bound( 1.0, 1.0 ) );
+
+   checkRange( T(0.5), T(2), false, ulp, op, ref );
+   checkRange( Limits::min(), Limits::max(), true, ulp, op, ref );
+   checkRange( Limits::denorm_min(), Limits::min(), true, ulp, op, ref );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Testing the accuracy of the log2() operation.
+//
+// \return void
+// \exception std::runtime_error Accuracy error detected.
+*/
+template< typename T >  // Data type of the SIMD test
+void AccuracyTest<T>::testLog2()
+{
+   test_ = "log2() operation";
+
+   const auto op ( []( const SIMDType& a ) { return blaze::log2( a ); } );
+   const auto ref( []( long double x ) { return std::log2( x ); } );
+   const double ulp( bound( 2.0, 2.0 ) );
+
+   checkRange( T(0.5), T(2), false, ulp, op, ref );
+   checkRange( Limits::min(), Limits::max(), true, ulp, op, ref );
+   checkRange( Limits::denorm_min(), Limits::min(), true, ulp, op, ref );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Testing the accuracy of the log10() operation.
+//
+// \return void
+// \exception std::runtime_error Accuracy error detected.
+*/
+template< typename T >  // Data type of the SIMD test
+void AccuracyTest<T>::testLog10()
+{
+   test_ = "log10() operation";
+
+   const auto op ( []( const SIMDType& a ) { return blaze::log10( a ); } );
+   const auto ref( []( long double x ) { return std::log10( x ); } );
+   const double ulp( bound( 2.0, 2.0 ) );
+
+   checkRange( T(0.5), T(2), false, ulp, op, ref );
+   checkRange( Limits::min(), Limits::max(), true, ulp, op, ref );
+   checkRange( Limits::denorm_min(), Limits::min(), true, ulp, op, ref );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Testing the accuracy of the sin() operation.
+//
+// \return void
+// \exception std::runtime_error Accuracy error detected.
+*/
+template< typename T >  // Data type of the SIMD test
+void AccuracyTest<T>::testSin()
+{
+   test_ = "sin() operation";
+
+   const auto op ( []( const SIMDType& a ) { return blaze::sin( a ); } );
+   const auto ref( []( long double x ) { return std::sin( x ); } );
+   const double ulp( bound( 2.5, 2.5 ) );
+
+   checkRange( T(-4), T(4), false, ulp, op, ref );
+   checkRange( T(-1000), T(1000), false, ulp, op, ref );
+   checkRange( T(-65536), T(65536), false, ulp, op, ref );
+   checkRange( T(-1E7), T(1E7), false, ulp, op, ref );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Testing the accuracy of the cos() operation.
+//
+// \return void
+// \exception std::runtime_error Accuracy error detected.
+*/
+template< typename T >  // Data type of the SIMD test
+void AccuracyTest<T>::testCos()
+{
+   test_ = "cos() operation";
+
+   const auto op ( []( const SIMDType& a ) { return blaze::cos( a ); } );
+   const auto ref( []( long double x ) { return std::cos( x ); } );
+   const double ulp( bound( 2.5, 2.5 ) );
+
+   checkRange( T(-4), T(4), false, ulp, op, ref );
+   checkRange( T(-1000), T(1000), false, ulp, op, ref );
+   checkRange( T(-65536), T(65536), false, ulp, op, ref );
+   checkRange( T(-1E7), T(1E7), false, ulp, op, ref );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Testing the accuracy of the tan() operation.
+//
+// \return void
+// \exception std::runtime_error Accuracy error detected.
+*/
+template< typename T >  // Data type of the SIMD test
+void AccuracyTest<T>::testTan()
+{
+   test_ = "tan() operation";
+
+   const auto op ( []( const SIMDType& a ) { return blaze::tan( a ); } );
+   const auto ref( []( long double x ) { return std::tan( x ); } );
+   const double ulp( bound( 4.5, 4.5 ) );
+
+   checkRange( T(-4), T(4), false, ulp, op, ref );
+   checkRange( T(-1000), T(1000), false, ulp, op, ref );
+   checkRange( T(-65536), T(65536), false, ulp, op, ref );
+   checkRange( T(-1E7), T(1E7), false, ulp, op, ref );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Testing the accuracy of the tanh() operation.
+//
+// \return void
+// \exception std::runtime_error Accuracy error detected.
+*/
+template< typename T >  // Data type of the SIMD test
+void AccuracyTest<T>::testTanh()
+{
+   test_ = "tanh() operation";
+
+   const auto op ( []( const SIMDType& a ) { return blaze::tanh( a ); } );
+   const auto ref( []( long double x ) { return std::tanh( x ); } );
+   const double ulp( bound( 1.5, 1.5 ) );
+
+   checkRange( T(-1), T(1), false, ulp, op, ref );
+   checkRange( T(-20), T(20), false, ulp, op, ref );
+   checkRange( Limits::min(), T(1), true, ulp, op, ref );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Testing the accuracy of the pow() operation.
+//
+// \return void
+// \exception std::runtime_error Accuracy error detected.
+*/
+template< typename T >  // Data type of the SIMD test
+void AccuracyTest<T>::testPow()
+{
+   test_ = "pow() operation";
+
+   const double ulp( bound( 1.0, 2.0 ) );
+
+   checkPow( T(0.5), T(2), T(-10), T(10), ulp );
+   checkPow( T(1E-3), T(1E3), T(-12), T(12), ulp );
+   checkPow( T(0.9), T(1.1), T(-1000), T(1000), ulp );
+
+   checkPowInfinity( T(1E-3), T(1E3) );
+   checkPowInfinity( T(0.99), T(1.01) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Testing the handling of special values.
+//
+// \return void
+// \exception std::runtime_error Accuracy error detected.
+*/
+template< typename T >  // Data type of the SIMD test
+void AccuracyTest<T>::testSpecialValues()
+{
+   using blaze::set;
+
+   test_ = "Special values";
+
+   const T inf( Limits::infinity() );
+   const T nan( Limits::quiet_NaN() );
+
+   checkValue( "exp(0)"   , [&]() { return blaze::exp( set( T(0) ) ); }, T(1) );
+   checkValue( "exp(inf)" , [&]() { return blaze::exp( set( inf ) ); }, inf );
+   checkValue( "exp(-inf)", [&]() { return blaze::exp( set( -inf ) ); }, T(0) );
+   checkValue( "exp(nan)" , [&]() { return blaze::exp( set( nan ) ); }, nan );
+   checkValue( "exp(1E4)" , [&]() { return blaze::exp( set( T(1E4) ) ); }, inf );
+   checkValue( "exp(-1E4)", [&]() { return blaze::exp( set( T(-1E4) ) ); }, T(0) );
+
+   checkValue( "exp2(10)"  , [&]() { return blaze::exp2( set( T(10) ) ); }, T(1024) );
+   checkValue( "exp2(-inf)", [&]() { return blaze::exp2( set( -inf ) ); }, T(0) );
+   checkValue( "exp2(1E4)" , [&]() { return blaze::exp2( set( T(1E4) ) ); }, inf );
+
+   checkValue( "exp10(0)"   , [&]() { return blaze::exp10( set( T(0) ) ); }, T(1) );
+   checkValue( "exp10(nan)" , [&]() { return blaze::exp10( set( nan ) ); }, nan );
+   checkValue( "exp10(-1E4)", [&]() { return blaze::exp10( set( T(-1E4) ) ); }, T(0) );
+
+   checkValue( "log(1)"   , [&]() { return blaze::log( set( T(1) ) ); }, T(0) );
+   checkValue( "log(0)"   , [&]() { return blaze::log( set( T(0) ) ); }, -inf );
+   checkValue( "log(-0)"  , [&]() { return blaze::log( set( -T(0) ) ); }, -inf );
+   checkValue( "log(-1)"  , [&]() { return blaze::log( set( T(-1) ) ); }, nan );
+   checkValue( "log(inf)" , [&]() { return blaze::log( set( inf ) ); }, inf );
+   checkValue( "log(-inf)", [&]() { return blaze::log( set( -inf ) ); }, nan );
+   checkValue( "log(nan)" , [&]() { return blaze::log( set( nan ) ); }, nan );
+
+   checkValue( "log2(8)"  , [&]() { return blaze::log2( set( T(8) ) ); }, T(3) );
+   checkValue( "log2(0)"  , [&]() { return blaze::log2( set( T(0) ) ); }, -inf );
+   checkValue( "log2(inf)", [&]() { return blaze::log2( set( inf ) ); }, inf );
+
+   checkValue( "log10(1)"  , [&]() { return blaze::log10( set( T(1) ) ); }, T(0) );
+   checkValue( "log10(-1)" , [&]() { return blaze::log10( set( T(-1) ) ); }, nan );
+   checkValue( "log10(nan)", [&]() { return blaze::log10( set( nan ) ); }, nan );
+
+   checkValue( "sin(0)"  , [&]() { return blaze::sin( set( T(0) ) ); }, T(0) );
+   checkValue( "sin(inf)", [&]() { return blaze::sin( set( inf ) ); }, nan );
+   checkValue( "sin(nan)", [&]() { return blaze::sin( set( nan ) ); }, nan );
+   checkValue( "cos(0)"  , [&]() { return blaze::cos( set( T(0) ) ); }, T(1) );
+   checkValue( "cos(inf)", [&]() { return blaze::cos( set( inf ) ); }, nan );
+   checkValue( "tan(0)"  , [&]() { return blaze::tan( set( T(0) ) ); }, T(0) );
+   checkValue( "tan(nan)", [&]() { return blaze::tan( set( nan ) ); }, nan );
+
+   checkValue( "tanh(0)"   , [&]() { return blaze::tanh( set( T(0) ) ); }, T(0) );
+   checkValue( "tanh(inf)" , [&]() { return blaze::tanh( set( inf ) ); }, T(1) );
+   checkValue( "tanh(-inf)", [&]() { return blaze::tanh( set( -inf ) ); }, T(-1) );
+   checkValue( "tanh(nan)" , [&]() { return blaze::tanh( set( nan ) ); }, nan );
+
+   checkValue( "pow(2,10)"     , [&]() { return blaze::pow( set( T(2) ), set( T(10) ) ); }, T(1024) );
+   checkValue( "pow(-2,3)"     , [&]() { return blaze::pow( set( T(-2) ), set( T(3) ) ); }, T(-8) );
+   checkValue( "pow(-2,0.5)"   , [&]() { return blaze::pow( set( T(-2) ), set( T(0.5) ) ); }, nan );
+   checkValue( "pow(nan,0)"    , [&]() { return blaze::pow( set( nan ), set( T(0) ) ); }, T(1) );
+   checkValue( "pow(1,nan)"    , [&]() { return blaze::pow( set( T(1) ), set( nan ) ); }, T(1) );
+   checkValue( "pow(0,2)"      , [&]() { return blaze::pow( set( T(0) ), set( T(2) ) ); }, T(0) );
+   checkValue( "pow(0,-1)"     , [&]() { return blaze::pow( set( T(0) ), set( T(-1) ) ); }, inf );
+   checkValue( "pow(-inf,3)"   , [&]() { return blaze::pow( set( -inf ), set( T(3) ) ); }, -inf );
+   checkValue( "pow(-inf,0.5)" , [&]() { return blaze::pow( set( -inf ), set( T(0.5) ) ); }, inf );
+   checkValue( "pow(-1,inf)"   , [&]() { return blaze::pow( set( T(-1) ), set( inf ) ); }, T(1) );
+   checkValue( "pow(0.5,inf)"  , [&]() { return blaze::pow( set( T(0.5) ), set( inf ) ); }, T(0) );
+   checkValue( "pow(2,inf)"    , [&]() { return blaze::pow( set( T(2) ), set( inf ) ); }, inf );
+   checkValue( "pow(9.98,inf)" , [&]() { return blaze::pow( set( T(9.98) ), set( inf ) ); }, inf );
+   checkValue( "pow(8.78,-inf)", [&]() { return blaze::pow( set( T(8.78) ), set( -inf ) ); }, T(0) );
+   checkValue( "pow(0.5,-inf)" , [&]() { return blaze::pow( set( T(0.5) ), set( -inf ) ); }, inf );
+   checkValue( "pow(-3,inf)"   , [&]() { return blaze::pow( set( T(-3) ), set( inf ) ); }, inf );
+   checkValue( "pow(-0.5,-inf)", [&]() { return blaze::pow( set( T(-0.5) ), set( -inf ) ); }, inf );
+   checkValue( "pow(-1,-inf)"  , [&]() { return blaze::pow( set( T(-1) ), set( -inf ) ); }, T(1) );
+   checkValue( "pow(0,-inf)"   , [&]() { return blaze::pow( set( T(0) ), set( -inf ) ); }, inf );
+   checkValue( "pow(inf,inf)"  , [&]() { return blaze::pow( set( inf ), set( inf ) ); }, inf );
+   checkValue( "pow(inf,-inf)" , [&]() { return blaze::pow( set( inf ), set( -inf ) ); }, T(0) );
+   checkValue( "pow(nan,inf)"  , [&]() { return blaze::pow( set( nan ), set( inf ) ); }, nan );
+   checkValue( "pow(10,1E4)"   , [&]() { return blaze::pow( set( T(10) ), set( T(1E4) ) ); }, inf );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the accuracy of a unary operation within the given argument range.
+//
+// \param min The lower limit of the argument range.
+// \param max The upper limit of the argument range.
+// \param logscale \a true in case the arguments are sampled logarithmically, \a false if not.
+// \param bound The maximum permitted error (in ulp).
+// \param op The vectorized operation to be tested.
+// \param ref The extended precision reference operation.
+// \return void
+// \exception std::runtime_error Accuracy error detected.
+*/
+template< typename T >  // Data type of the SIMD test
+template< typename OP     // Type of the vectorized operation
+        , typename REF >  // Type of the reference operation
+void AccuracyTest<T>::checkRange( T min, T max, bool logscale, double bound, OP op, REF ref )
+{
+   using blaze::loadu;
+   using blaze::storeu;
+
+   T a[SIMDSIZE];
+   T b[SIMDSIZE];
+
+   for( size_t i=0UL; i<N; i+=SIMDSIZE )
+   {
+      for( size_t j=0UL; j<SIMDSIZE; ++j ) {
+         a[j] = sample( min, max, logscale, i+j );
+      }
+
+      storeu( b, op( loadu( a ) ) );
+
+      for( size_t j=0UL; j<SIMDSIZE; ++j )
+      {
+         const long double expected( ref( static_cast<long double>( a[j] ) ) );
+         const double error( ulps( b[j], expected ) );
+
+         if( !( error <= bound ) ) {
+            std::ostringstream oss;
+            oss.precision( 20 );
+            oss << " Test : " << test_ << "\n"
+                << " Error: Accuracy bound exceeded\n"
+                << " Details:\n"
+                << "   Argument range = [" << min << "," << max << "]\n"
+                << "   Argument       = " << a[j] << "\n"
+                << "   Result         = " << b[j] << "\n"
+                << "   Expected       = " << expected << "\n"
+                << "   Error          = " << error << " ulp (bound " << bound << " ulp)\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the accuracy of the pow() operation within the given argument ranges.
+//
+// \param xmin The lower limit of the base range.
+// \param xmax The upper limit of the base range.
+// \param ymin The lower limit of the exponent range.
+// \param ymax The upper limit of the exponent range.
+// \param bound The maximum permitted error (in ulp).
+// \return void
+// \exception std::runtime_error Accuracy error detected.
+*/
+template< typename T >  // Data type of the SIMD test
+void AccuracyTest<T>::checkPow( T xmin, T xmax, T ymin, T ymax, double bound )
+{
+   using blaze::loadu;
+   using blaze::storeu;
+
+   T x[SIMDSIZE];
+   T y[SIMDSIZE];
+   T z[SIMDSIZE];
+
+   for( size_t i=0UL; i<N; i+=SIMDSIZE )
+   {
+      for( size_t j=0UL; j<SIMDSIZE; ++j ) {
+         x[j] = sample( xmin, xmax, true, i+j );
+         y[j] = sample( ymin, ymax, false, ( (i+j)*7919UL ) % N );
+      }
+
+      storeu( z, blaze::pow( loadu( x ), loadu( y ) ) );
+
+      for( size_t j=0UL; j<SIMDSIZE; ++j )
+      {
+         const long double expected( std::pow( static_cast<long double>( x[j] )
+                                             , static_cast<long double>( y[j] ) ) );
+         const double error( ulps( z[j], expected ) );
+
+         if( !( error <= bound ) ) {
+            std::ostringstream oss;
+            oss.precision( 20 );
+            oss << " Test : " << test_ << "\n"
+                << " Error: Accuracy bound exceeded\n"
+                << " Details:\n"
+                << "   Base     = " << x[j] << "\n"
+                << "   Exponent = " << y[j] << "\n"
+                << "   Result   = " << z[j] << "\n"
+                << "   Expected = " << expected << "\n"
+                << "   Error    = " << error << " ulp (bound " << bound << " ulp)\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the pow() operation for infinite exponents within the given base range.
+//
+// \param xmin The lower limit of the (absolute) base range.
+// \param xmax The upper limit of the (absolute) base range.
+// \return void
+// \exception std::runtime_error Special value error detected.
+//
+// The bases are sampled logarithmically and are negated for every second sample. The exponents
+// alternate between positive and negative infinity. The results are expected to be exactly
+// equal to the results of the according scalar pow() function.
+*/
+template< typename T >  // Data type of the SIMD test
+void AccuracyTest<T>::checkPowInfinity( T xmin, T xmax )
+{
+   using blaze::loadu;
+   using blaze::storeu;
+
+   const T inf( Limits::infinity() );
+
+   T x[SIMDSIZE];
+   T y[SIMDSIZE];
+   T z[SIMDSIZE];
+
+   for( size_t i=0UL; i<N; i+=SIMDSIZE )
+   {
+      for( size_t j=0UL; j<SIMDSIZE; ++j ) {
+         x[j] = ( ( (i+j)/2UL ) % 2UL ? -1 : 1 ) * sample( xmin, xmax, true, i+j );
+         y[j] = ( (i+j) % 2UL ? -inf : inf );
+      }
+
+      storeu( z, blaze::pow( loadu( x ), loadu( y ) ) );
+
+      for( size_t j=0UL; j<SIMDSIZE; ++j )
+      {
+         const T expected( std::pow( x[j], y[j] ) );
+
+         if( z[j] != expected ) {
+            std::ostringstream oss;
+            oss.precision( 20 );
+            oss << " Test : " << test_ << "\n"
+                << " Error: Invalid result for infinite exponent\n"
+                << " Details:\n"
+                << "   Base     = " << x[j] << "\n"
+                << "   Exponent = " << y[j] << "\n"
+                << "   Result   = " << z[j] << "\n"
+                << "   Expected = " << expected << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of an operation for a special argument.
+//
+// \param expr The string representation of the tested expression.
+// \param op The vectorized operation to be tested.
+// \param expected The expected result.
+// \return void
+// \exception std::runtime_error Special value error detected.
+//
+// The result of the given operation is expected to be exactly equal to \a expected in all
+// elements of the resulting SIMD vector. In case \a expected is a NaN, all elements are
+// expected to be NaN.
+*/
+template< typename T >  // Data type of the SIMD test
+template< typename OP >  // Type of the vectorized operation
+void AccuracyTest<T>::checkValue( const std::string& expr, OP op, T expected )
+{
+   using blaze::storeu;
+
+   T result[SIMDSIZE];
+
+   storeu( result, op() );
+
+   for( size_t j=0UL; j<SIMDSIZE; ++j )
+   {
+      const bool valid( std::isnan( expected ) ? std::isnan( result[j] ) : result[j] == expected );
+
+      if( !valid ) {
+         std::ostringstream oss;
+         oss.precision( 20 );
+         oss << " Test : " << test_ << "\n"
+             << " Error: Invalid result of " << expr << " at index " << j << "\n"
+             << " Details:\n"
+             << "   Result   = " << result[j] << "\n"
+             << "   Expected = " << expected << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the \a i-th sample of the given argument range.
+//
+// \param min The lower limit of the argument range.
+// \param max The upper limit of the argument range.
+// \param logscale \a true in case the arguments are sampled logarithmically, \a false if not.
+// \param i The index of the sample \f$[0..N)\f$.
+// \return The \a i-th sample.
+*/
+template< typename T >  // Data type of the SIMD test
+T AccuracyTest<T>::sample( T min, T max, bool logscale, size_t i )
+{
+   const long double t( ( i + 0.5L ) / N );
+
+   if( logscale ) {
+      const long double lmin( std::log2( static_cast<long double>( min ) ) );
+      const long double lmax( std::log2( static_cast<long double>( max ) ) );
+      return static_cast<T>( std::exp2( lmin + t*( lmax - lmin ) ) );
+   }
+   else {
+      return static_cast<T>( min + t*( static_cast<long double>( max ) - min ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the error of the given value in units in the last place (ulp).
+//
+// \param value The computed value.
+// \param ref The extended precision reference value.
+// \return The error of the computed value in ulp.
+//
+// The error is measured relative to the spacing of the floating point numbers of type \a T
+// in the binade of the reference value. Subnormal reference values are measured in units of
+// the smallest subnormal value. In case of an overflow or a NaN, an error of zero is returned
+// if the computed value matches the reference value and infinity if it does not.
+*/
+template< typename T >  // Data type of the SIMD test
+double AccuracyTest<T>::ulps( T value, long double ref )
+{
+   const T rounded( static_cast<T>( ref ) );
+
+   if( std::isnan( ref ) || std::isinf( rounded ) ) {
+      return ( std::isnan( ref ) ? std::isnan( value ) : value == rounded )
+             ? 0.0 : std::numeric_limits<double>::infinity();
+   }
+
+   if( std::isinf( value ) || std::isnan( value ) ) {
+      return std::numeric_limits<double>::infinity();
+   }
+
+   const int exponent( ref == 0.0L
+                       ? Limits::min_exponent - 1
+                       : std::max( std::ilogb( ref ), Limits::min_exponent - 1 ) );
+
+   return static_cast<double>( std::fabs( value - ref ) /
+                               std::ldexp( 1.0L, exponent - Limits::digits + 1 ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the error bound for the given numeric type.
+//
+// \param fbound The error bound for single precision values.
+// \param dbound The error bound for double precision values.
+// \return The error bound for the numeric type \a T.
+*/
+template< typename T >  // Data type of the SIMD test
+double AccuracyTest<T>::bound( double fbound, double dbound )
+{
+   return blaze::IsFloat<T>::value ? fbound : dbound;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the accuracy of the native SIMD math kernels of a specific numeric data type.
+//
+// \return void
+*/
+template< typename T >  // Data type of the SIMD test
+void runAccuracyTest()
+{
+   AccuracyTest<T>();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of an SIMD accuracy test case.
+*/
+#define RUN_SIMD_ACCURACY_TEST( T ) \
+   blazetest::mathtest::simd::runAccuracyTest<T>()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace simd
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,195 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/smatsmatmult/ParallelTest.h
+//  \brief Header file for the parallel sparse matrix/sparse matrix multiplication test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SMATSMATMULT_PARALLELTEST_H_
+#define _BLAZETEST_MATHTEST_SMATSMATMULT_PARALLELTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smatsmatmult {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the parallel sparse matrix/sparse matrix multiplication test.
+//
+// This class represents a test suite for the parallel two-phase evaluation of the sparse
+// matrix/sparse matrix multiplication. It performs a series of runtime tests with matrices
+// that are large enough to be evaluated in parallel and that cover both the hash-based and
+// the dense accumulation of the rows of the result.
+*/
+class ParallelTest
+{
+ private:
+   //**Type definitions****************************************************************************
+   using SMat  = blaze::CompressedMatrix<int,blaze::rowMajor>;     //!< Row-major sparse matrix type.
+   using TSMat = blaze::CompressedMatrix<int,blaze::columnMajor>;  //!< Column-major sparse matrix type.
+   using RMat  = blaze::DynamicMatrix<int,blaze::rowMajor>;        //!< Reference matrix type.
+   //**********************************************************************************************
+
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ParallelTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testMultiplication();
+   void testCancellation  ();
+   void testMultiplication( size_t m, size_t k, size_t n, size_t nonzeros1, size_t nonzeros2 );
+
+   template< typename T1, typename T2 >
+   void checkResult( const T1& computedResult, const T2& expectedResult );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking and comparing the computed result.
+//
+// \param computedResult The computed result.
+// \param expectedResult The expected result.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+//
+// This function is called after each test case to check and compare the computed result.
+// In case the computed and the expected result differ in any way, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename T1    // Type of the computed result
+        , typename T2 >  // Type of the expected result
+void ParallelTest::checkResult( const T1& computedResult, const T2& expectedResult )
+{
+   if( computedResult != expectedResult ) {
+      std::ostringstream oss;
+      oss << " Test : " << test_ << "\n"
+          << " Error: Incorrect result detected\n"
+          << " Details:\n"
+          << "   Computed result:\n" << computedResult << "\n"
+          << "   Expected result:\n" << expectedResult << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the parallel sparse matrix/sparse matrix multiplication.
+//
+// \return void
+*/
+void runTest()
+{
+   ParallelTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the parallel sparse matrix/sparse matrix multiplication test.
+*/
+#define RUN_SMATSMATMULT_PARALLEL_TEST \
+   blazetest::mathtest::smatsmatmult::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace smatsmatmult
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,621 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/arena/ClassTest.cpp
+//  \brief Source file for the arena memory resource test
+//
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blazetest/mathtest/arena/ClassTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace arena {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the Arena memory resource test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testArena();
+   testVector();
+   testMatrix();
+   testCompressedMatrix();
+   testNesting();
+   testMultiplication();
+   testDeallocation();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the bump allocation of the Arena class.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the allocate(), owns(), reset(), and release() functions of the Arena
+// class. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testArena()
+{
+   test_ = "Arena bump allocation";
+
+   blaze::Arena arena( 1024UL );
+
+   if( arena.chunks() != 0UL || arena.capacity() != 0UL || arena.used() != 0UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Memory allocated on construction\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   blaze::byte_t* const first ( arena.allocate( 100UL, 64UL ) );
+   blaze::byte_t* const second( arena.allocate( 100UL, 64UL ) );
+
+   if( reinterpret_cast<size_t>( first ) % 64UL != 0UL ||
+       reinterpret_cast<size_t>( second ) % 64UL != 0UL || second < first + 100UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid allocation detected\n"
+          << " Details:\n"
+          << "   First allocation : " << static_cast<void*>( first ) << "\n"
+          << "   Second allocation: " << static_cast<void*>( second ) << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   checkOwned( arena, first, true );
+   checkOwned( arena, second + 99UL, true );
+   checkOwned( arena, &arena, false );
+
+   blaze::byte_t* const large( arena.allocate( 4096UL, 64UL ) );
+
+   checkOwned( arena, large, true );
+   checkOwned( arena, large + 4095UL, true );
+
+   if( arena.chunks() != 2UL || arena.capacity() < 1024UL + 4096UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of chunks detected\n"
+          << " Details:\n"
+          << "   Chunks         : " << arena.chunks() << "\n"
+          << "   Expected chunks: 2\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   const size_t capacity( arena.capacity() );
+
+   arena.reset();
+
+   if( arena.used() != 0UL || arena.capacity() != capacity ||
+       arena.allocate( 100UL, 64UL ) != first ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Resetting the arena failed\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   arena.release();
+
+   if( arena.chunks() != 0UL || arena.capacity() != 0UL || arena.used() != 0UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Releasing the arena failed\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   try {
+      blaze::Arena invalid( 0UL );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Construction with zero chunk size succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of dynamic vectors within arena sections.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the allocation of dynamic vectors and of expression temporaries within
+// arena sections. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testVector()
+{
+   test_ = "Dynamic vectors within arena sections";
+
+   blaze::Arena arena( 4096UL );
+
+   const blaze::DynamicVector<double> x( 100UL, 1.0 );
+   std::unique_ptr< blaze::DynamicVector<double> > z( new blaze::DynamicVector<double>( 50UL, 3.0 ) );
+
+   for( size_t i=0UL; i<3UL; ++i )
+   {
+      BLAZE_ARENA_SECTION( arena )
+      {
+         if( blaze::MemoryResourceSection::active() != &arena ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Arena section not active\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         blaze::DynamicVector<double> y( 100UL, 2.0 );
+
+         checkOwned( arena, y.data(), true );
+         checkOwned( arena, x.data(), false );
+
+         y.resize( 10000UL );
+         checkOwned( arena, y.data(), true );
+
+         for( size_t j=0UL; j<100UL; ++j ) {
+            if( y[j] != 2.0 ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Resizing the vector did not preserve the values\n"
+                   << " Details:\n"
+                   << "   Index: " << j << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+
+         y.resize( 100UL );
+
+         const blaze::DynamicVector<double> w( 2.0 * ( x + y ) );
+         checkOwned( arena, w.data(), true );
+
+         for( size_t j=0UL; j<w.size(); ++j ) {
+            if( w[j] != 6.0 ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Invalid result of the vector expression\n"
+                   << " Details:\n"
+                   << "   Index: " << j << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+
+         // Heap memory is deallocated normally within the arena section
+         z.reset();
+      }
+
+      if( blaze::MemoryResourceSection::active() != nullptr ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Arena section still active\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      if( arena.used() == 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: No memory drawn from the arena\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      const size_t chunks( arena.chunks() );
+
+      arena.reset();
+
+      if( i > 0UL && arena.chunks() != chunks ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Memory of the arena not reused\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   const blaze::DynamicVector<double> v( 100UL, 4.0 );
+   checkOwned( arena, v.data(), false );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of dynamic matrices within arena sections.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the allocation of row-major and column-major dynamic matrices and of
+// expression temporaries within arena sections. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMatrix()
+{
+   test_ = "Dynamic matrices within arena sections";
+
+   blaze::Arena arena;
+
+   const blaze::DynamicMatrix<double,blaze::rowMajor> A( 20UL, 30UL, 1.0 );
+
+   BLAZE_ARENA_SECTION( arena )
+   {
+      blaze::DynamicMatrix<double,blaze::columnMajor> B( 30UL, 10UL, 2.0 );
+      checkOwned( arena, B.data(), true );
+      checkOwned( arena, A.data(), false );
+
+      const blaze::DynamicVector<double> x( 10UL, 1.0 );
+      const blaze::DynamicVector<double> y( A * ( B * x ) + A * ( B * x ) );
+      const blaze::DynamicMatrix<double,blaze::rowMajor> C( trans( A * B ) );
+
+      checkOwned( arena, y.data(), true );
+      checkOwned( arena, C.data(), true );
+
+      for( size_t i=0UL; i<y.size(); ++i ) {
+         if( y[i] != 1200.0 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid result of the matrix/vector expression\n"
+                << " Details:\n"
+                << "   Index: " << i << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      for( size_t i=0UL; i<C.rows(); ++i ) {
+         for( size_t j=0UL; j<C.columns(); ++j ) {
+            if( C(i,j) != 60.0 ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Invalid result of the matrix expression\n"
+                   << " Details:\n"
+                   << "   Index: (" << i << "," << j << ")\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+
+      B.resize( 300UL, 300UL );
+      checkOwned( arena, B.data(), true );
+   }
+
+   arena.release();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of compressed matrices within arena sections.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the allocation of compressed matrices within arena sections. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testCompressedMatrix()
+{
+   test_ = "Compressed matrices within arena sections";
+
+   blaze::Arena arena;
+
+   BLAZE_ARENA_SECTION( arena )
+   {
+      blaze::CompressedMatrix<double,blaze::rowMajor> A( 100UL, 100UL );
+      A.reserve( 200UL );
+
+      for( size_t i=0UL; i<A.rows(); ++i ) {
+         A.append( i, i, 2.0 );
+         if( i+1UL < A.columns() )
+            A.append( i, i+1UL, 1.0 );
+         A.finalize( i );
+      }
+
+      checkOwned( arena, &*A.begin( 0UL ), true );
+
+      for( size_t i=1UL; i<A.rows(); ++i ) {
+         A.insert( i, 0UL, 1.0 );
+      }
+
+      checkOwned( arena, &*A.begin( 0UL ), true );
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> B( A * A );
+      checkOwned( arena, &*B.begin( 0UL ), true );
+
+      const blaze::DynamicVector<double> x( 100UL, 1.0 );
+      const blaze::DynamicVector<double> y( A * x );
+
+      for( size_t i=0UL; i<y.size(); ++i ) {
+         const double expected( i == 0UL ? 3.0 : ( i+1UL < A.columns() ? 4.0 : 3.0 ) );
+
+         if( y[i] != expected ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid result of the sparse matrix/dense vector multiplication\n"
+                << " Details:\n"
+                << "   Index         : " << i << "\n"
+                << "   Result        : " << y[i] << "\n"
+                << "   Expected value: " << expected << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   if( arena.used() == 0UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: No memory drawn from the arena\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of nested arena sections.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests nested arena sections and the suspension of an arena section via a
+// memory resource section for the default allocation. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testNesting()
+{
+   test_ = "Nested arena sections";
+
+   blaze::Arena outer;
+   blaze::Arena inner;
+
+   BLAZE_ARENA_SECTION( outer )
+   {
+      std::unique_ptr< blaze::DynamicVector<int> > x( new blaze::DynamicVector<int>( 100UL, 1 ) );
+      checkOwned( outer, x->data(), true );
+
+      BLAZE_ARENA_SECTION( inner )
+      {
+         const blaze::DynamicVector<int> y( 100UL, 2 );
+         checkOwned( inner, y.data(), true );
+         checkOwned( outer, y.data(), false );
+
+         {
+            const blaze::MemoryResourceSection heap( nullptr );
+
+            if( blaze::MemoryResourceSection::active() != nullptr ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Default allocation not restored\n";
+               throw std::runtime_error( oss.str() );
+            }
+
+            const blaze::DynamicVector<int> z( 100UL, 3 );
+            checkOwned( inner, z.data(), false );
+            checkOwned( outer, z.data(), false );
+
+            // Memory of the enclosing arenas is still recognized
+            x.reset();
+         }
+
+         if( blaze::MemoryResourceSection::active() != &inner ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Inner arena section not restored\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      if( blaze::MemoryResourceSection::active() != &outer ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Outer arena section not restored\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   if( blaze::MemoryResourceSection::active() != nullptr ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Arena section still active\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the dense matrix multiplication within arena sections.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the packing buffers of the dense matrix multiplication, which
+// outlive any arena section, are not drawn from the arena. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMultiplication()
+{
+   test_ = "Dense matrix multiplication within arena sections";
+
+   const size_t n( 300UL );
+
+   for( size_t i=0UL; i<2UL; ++i )
+   {
+      {
+         blaze::Arena arena;
+
+         BLAZE_ARENA_SECTION( arena )
+         {
+            const blaze::DynamicMatrix<double,blaze::rowMajor> A( n, n, 1.0 );
+            const blaze::DynamicMatrix<double,blaze::columnMajor> B( n, n, 2.0 );
+            const blaze::DynamicMatrix<double,blaze::rowMajor> C( A * B );
+
+            checkOwned( arena, C.data(), true );
+
+            for( size_t j=0UL; j<n; ++j ) {
+               for( size_t k=0UL; k<n; ++k ) {
+                  if( C(j,k) != 2.0*n ) {
+                     std::ostringstream oss;
+                     oss << " Test: " << test_ << "\n"
+                         << " Error: Invalid result of the matrix multiplication\n"
+                         << " Details:\n"
+                         << "   Index: (" << j << "," << k << ")\n";
+                     throw std::runtime_error( oss.str() );
+                  }
+               }
+            }
+         }
+      }
+
+      // The packing buffers remain valid after the destruction of the arena
+      const blaze::DynamicMatrix<double,blaze::rowMajor> A( n, n, 1.0 );
+      const blaze::DynamicMatrix<double,blaze::rowMajor> B( n, n, 3.0 );
+      const blaze::DynamicMatrix<double,blaze::rowMajor> C( A * B );
+
+      for( size_t j=0UL; j<n; ++j ) {
+         for( size_t k=0UL; k<n; ++k ) {
+            if( C(j,k) != 3.0*n ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Invalid result of the matrix multiplication\n"
+                   << " Details:\n"
+                   << "   Index: (" << j << "," << k << ")\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the deallocation of arena memory outside of arena sections.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that vectors and matrices whose memory has been drawn from an arena can
+// be resized and destroyed after the arena section has been left. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testDeallocation()
+{
+   test_ = "Deallocation of arena memory outside of arena sections";
+
+   blaze::Arena arena;
+
+   const blaze::DynamicMatrix<double,blaze::rowMajor> A( 100UL, 100UL, 2.0 );
+   const blaze::DynamicVector<double,blaze::columnVector> x( 100UL, 1.0 );
+
+   blaze::DynamicVector<double,blaze::columnVector> y;
+   std::unique_ptr< blaze::DynamicMatrix<double,blaze::rowMajor> > B;
+
+   BLAZE_ARENA_SECTION( arena )
+   {
+      y = A * x;
+      B.reset( new blaze::DynamicMatrix<double,blaze::rowMajor>( A * A ) );
+   }
+
+   checkOwned( arena, y.data(), true );
+   checkOwned( arena, B->data(), true );
+
+   y.resize( 5000UL );
+   checkOwned( arena, y.data(), false );
+
+   B.reset();
+   arena.release();
+}
+//*************************************************************************************************
+
+} // namespace arena
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running Arena memory resource test..." << std::endl;
+
+   try
+   {
+      RUN_ARENA_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during Arena memory resource test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
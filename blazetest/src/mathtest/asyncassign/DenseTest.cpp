@@ -0,0 +1,383 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/asyncassign/DenseTest.cpp
+//  \brief Source file for the asynchronous dense assignment test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/StaticVector.h>
+#include <blaze/math/SymmetricMatrix.h>
+#include <blaze/util/Complex.h>
+#include <blazetest/mathtest/asyncassign/DenseTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace asyncassign {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the DenseTest asynchronous assignment test.
+//
+// \exception std::runtime_error Asynchronous assignment error detected.
+*/
+DenseTest::DenseTest()
+{
+   using blaze::DynamicVector;
+   using blaze::DynamicMatrix;
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   using cplx = blaze::complex<double>;
+
+
+   //=====================================================================================
+   // Specific tests
+   //=====================================================================================
+
+   testHandle();
+   testAliasing();
+   testSizeMismatch();
+   testComputedOperands();
+
+
+   //=====================================================================================
+   // Random vector and matrix tests
+   //=====================================================================================
+
+   for( size_t N : { 0UL, 7UL, 64UL, 2000UL } )
+   {
+      testVector< DynamicVector<double>, DynamicMatrix<double,rowMajor> >( N );
+      testVector< DynamicVector<double>, DynamicMatrix<double,columnMajor> >( N );
+      testVector< DynamicVector<cplx>, DynamicMatrix<cplx,rowMajor> >( N );
+   }
+
+   for( size_t N : { 0UL, 7UL, 64UL, 300UL } )
+   {
+      testMatrix< DynamicMatrix<double,rowMajor>, DynamicMatrix<double,rowMajor> >( N, N+3UL );
+      testMatrix< DynamicMatrix<double,rowMajor>, DynamicMatrix<double,columnMajor> >( N+3UL, N );
+      testMatrix< DynamicMatrix<double,columnMajor>, DynamicMatrix<double,rowMajor> >( N, N );
+      testMatrix< DynamicMatrix<cplx,columnMajor>, DynamicMatrix<cplx,columnMajor> >( N, N+1UL );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the AsyncAssignment handle.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the default construction, the move operations and the wait() function of
+// the AsyncAssignment handle. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void DenseTest::testHandle()
+{
+   test_ = "AsyncAssignment handle";
+
+   {
+      blaze::AsyncAssignment h;
+
+      if( !h.ready() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Default constructed handle is not ready\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      h.wait();
+      h.wait();
+   }
+
+   {
+      blaze::DynamicVector<double> a( 5000UL ), b;
+      randomize( a );
+
+      blaze::AsyncAssignment h1( blaze::asyncAssign( b, a * 2.0 ) );
+      blaze::AsyncAssignment h2( std::move( h1 ) );
+      blaze::AsyncAssignment h3;
+      h3 = std::move( h2 );
+      h3.wait();
+
+      checkResult( b, blaze::DynamicVector<double>( a * 2.0 ), "Moved handle failed" );
+   }
+
+   {
+      blaze::StaticVector<int,3UL> a{ 1, 2, 3 }, b;
+
+      blaze::AsyncAssignment h( blaze::asyncAssign( b, a ) );
+
+      if( !h.ready() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Handle of a small assignment is not ready\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkResult( b, a, "Small assignment failed" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of asynchronous assignments with aliasing and restricted operands.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests asynchronous assignments where the target is part of the right-hand
+// side expression and where the target is a restricted matrix adaptor. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void DenseTest::testAliasing()
+{
+   test_ = "Asynchronous assignment with aliasing";
+
+   {
+      blaze::DynamicMatrix<double> A( 300UL, 300UL );
+      blaze::DynamicVector<double> x( 300UL );
+      randomize( A );
+      randomize( x );
+
+      const blaze::DynamicVector<double> ref( A * x );
+
+      blaze::asyncAssign( x, A * x ).wait();
+
+      checkResult( x, ref, "Aliased vector assignment failed" );
+   }
+
+   {
+      blaze::DynamicMatrix<double> A( 100UL, 100UL ), B( 100UL, 100UL );
+      randomize( A );
+      randomize( B );
+
+      const blaze::DynamicMatrix<double> ref( A + A * B );
+
+      blaze::asyncAddAssign( A, A * B ).wait();
+
+      checkResult( A, ref, "Aliased matrix addition assignment failed" );
+   }
+
+   test_ = "Asynchronous assignment to a restricted matrix";
+
+   {
+      blaze::DynamicMatrix<double> A( 200UL, 200UL );
+      randomize( A );
+
+      const blaze::DynamicMatrix<double> S( A + trans( A ) );
+      blaze::SymmetricMatrix< blaze::DynamicMatrix<double> > B;
+
+      blaze::asyncAssign( B, S ).wait();
+
+      checkResult( B, S, "Symmetric matrix assignment failed" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of asynchronous compound assignments with operands of different size.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that asynchronous compound assignments with operands of different size
+// fail with a \a std::invalid_argument exception. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void DenseTest::testSizeMismatch()
+{
+   test_ = "Asynchronous assignment with size mismatch";
+
+   try {
+      blaze::DynamicVector<double> a( 3UL ), b( 4UL );
+      blaze::asyncAddAssign( a, b );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Vector addition assignment of different size succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      blaze::DynamicMatrix<double> A( 3UL, 4UL ), B( 4UL, 3UL );
+      blaze::asyncSubAssign( A, B );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Matrix subtraction assignment of different size succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the asynchronous assignment of expressions with computed operands.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the asynchronous assignment of expressions that require the evaluation
+// of computed operands (as for instance \c B*x in \c A*(B*x)). These operands are evaluated
+// once by a blocking SMP assignment and the returned handle is therefore expected to be ready.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void DenseTest::testComputedOperands()
+{
+   using blaze::DynamicVector;
+   using blaze::DynamicMatrix;
+   using blaze::asyncAssign;
+   using blaze::asyncAddAssign;
+   using blaze::asyncSubAssign;
+
+   test_ = "Asynchronous assignment of expressions with computed operands";
+
+   const size_t N( 400UL );
+
+   DynamicMatrix<double> A( N, N ), B( N, N ), C( N, N );
+   DynamicVector<double> x( N ), b( N );
+   randomize( A );
+   randomize( B );
+   randomize( C );
+   randomize( x );
+   randomize( b );
+
+   {
+      const DynamicVector<double> ref1( A * ( B * x ) );
+      const DynamicVector<double> ref2( b + A * ( B * x ) );
+      const DynamicVector<double> ref3( b - ( A * B ) * x );
+
+      DynamicVector<double> y1, y2( b ), y3( b );
+
+      auto h1 = asyncAssign   ( y1, A * ( B * x ) );
+      auto h2 = asyncAddAssign( y2, A * ( B * x ) );
+      auto h3 = asyncSubAssign( y3, ( A * B ) * x );
+
+      if( !h1.ready() || !h2.ready() || !h3.ready() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment with computed operands is not completed\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkResult( y1, ref1, "Asynchronous assignment failed" );
+      checkResult( y2, ref2, "Asynchronous addition assignment failed" );
+      checkResult( y3, ref3, "Asynchronous subtraction assignment failed" );
+   }
+
+   {
+      const DynamicMatrix<double> ref1( A * ( B + C ) );
+      const DynamicMatrix<double> ref2( C + A * ( B * C ) );
+
+      DynamicMatrix<double> D1, D2( C );
+
+      auto h1 = asyncAssign   ( D1, A * ( B + C ) );
+      auto h2 = asyncAddAssign( D2, A * ( B * C ) );
+
+      if( !h1.ready() || !h2.ready() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment with computed operands is not completed\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkResult( D1, ref1, "Asynchronous assignment failed" );
+      checkResult( D2, ref2, "Asynchronous addition assignment failed" );
+   }
+}
+//*************************************************************************************************
+
+} // namespace asyncassign
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running asynchronous dense assignment test..." << std::endl;
+
+   try
+   {
+      RUN_ASYNCASSIGN_DENSE_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during asynchronous dense assignment test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
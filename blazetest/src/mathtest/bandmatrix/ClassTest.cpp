@@ -0,0 +1,736 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/bandmatrix/ClassTest.cpp
+//  \brief Source file for the BandMatrix class test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <complex>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <blaze/math/BandMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/LAPACK.h>
+#include <blaze/math/dense/LSE.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/bandmatrix/ClassTest.h>
+#include <blazetest/system/LAPACK.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace bandmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the BandMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testAssignment();
+   testMultiplication();
+   testSolve();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the BandMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the BandMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   //=====================================================================================
+   // Row-major default constructor
+   //=====================================================================================
+
+   {
+      test_ = "Row-major BandMatrix default constructor";
+
+      blaze::BandMatrix<int,blaze::rowMajor> mat;
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Row-major size constructor
+   //=====================================================================================
+
+   {
+      test_ = "Row-major BandMatrix size constructor";
+
+      blaze::BandMatrix<int,blaze::rowMajor> mat( 5UL, 4UL, 1UL, 2UL );
+
+      checkRows    ( mat, 5UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Row-major list initialization
+   //=====================================================================================
+
+   {
+      test_ = "Row-major BandMatrix initializer list constructor";
+
+      const blaze::BandMatrix<int,blaze::rowMajor> mat{ { 1, 2, 0, 0 }, { 3, 4, 5, 0 }, { 0, 6, 7, 8 } };
+      const blaze::DynamicMatrix<int,blaze::rowMajor> ref{ { 1, 2, 0, 0 }, { 3, 4, 5, 0 }, { 0, 6, 7, 8 } };
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 8UL );
+      checkEqual   ( mat, ref );
+
+      if( mat.lowerBandwidth() != 1UL || mat.upperBandwidth() != 1UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid bandwidth detected\n"
+             << " Details:\n"
+             << "   Lower bandwidth: " << mat.lowerBandwidth() << " (expected 1)\n"
+             << "   Upper bandwidth: " << mat.upperBandwidth() << " (expected 1)\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Row-major conversion and resizing
+   //=====================================================================================
+
+   {
+      test_ = "Row-major BandMatrix conversion constructor";
+
+      blaze::BandMatrix<double,blaze::rowMajor> tmp( 7UL, 9UL, 2UL, 3UL );
+      blaze::randomize( tmp );
+
+      blaze::DynamicMatrix<double,blaze::rowMajor> ref( tmp );
+      blaze::BandMatrix<double,blaze::rowMajor> mat( ref );
+
+      checkRows   ( mat, 7UL );
+      checkColumns( mat, 9UL );
+      checkEqual  ( mat, ref );
+
+      test_ = "Row-major BandMatrix resize";
+
+      mat.resize( 9UL, 6UL, 2UL, 3UL );
+      ref.resize( 9UL, 6UL );
+      for( size_t i=7UL; i<9UL; ++i ) {
+         for( size_t j=0UL; j<6UL; ++j ) {
+            ref(i,j) = 0.0;
+         }
+      }
+
+      checkRows   ( mat, 9UL );
+      checkColumns( mat, 6UL );
+      checkEqual  ( mat, ref );
+   }
+
+
+   //=====================================================================================
+   // Column-major default constructor
+   //=====================================================================================
+
+   {
+      test_ = "Column-major BandMatrix default constructor";
+
+      blaze::BandMatrix<int,blaze::columnMajor> mat;
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Column-major size constructor
+   //=====================================================================================
+
+   {
+      test_ = "Column-major BandMatrix size constructor";
+
+      blaze::BandMatrix<int,blaze::columnMajor> mat( 4UL, 5UL, 2UL, 0UL );
+
+      checkRows    ( mat, 4UL );
+      checkColumns ( mat, 5UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Column-major list initialization
+   //=====================================================================================
+
+   {
+      test_ = "Column-major BandMatrix initializer list constructor";
+
+      const blaze::BandMatrix<int,blaze::columnMajor> mat{ { 1, 0, 0 }, { 2, 3, 0 }, { 4, 5, 6 } };
+      const blaze::DynamicMatrix<int,blaze::columnMajor> ref{ { 1, 0, 0 }, { 2, 3, 0 }, { 4, 5, 6 } };
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 6UL );
+      checkEqual   ( mat, ref );
+
+      if( mat.lowerBandwidth() != 2UL || mat.upperBandwidth() != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid bandwidth detected\n"
+             << " Details:\n"
+             << "   Lower bandwidth: " << mat.lowerBandwidth() << " (expected 2)\n"
+             << "   Upper bandwidth: " << mat.upperBandwidth() << " (expected 0)\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major conversion and resizing
+   //=====================================================================================
+
+   {
+      test_ = "Column-major BandMatrix conversion constructor";
+
+      blaze::BandMatrix<double,blaze::columnMajor> tmp( 8UL, 6UL, 3UL, 1UL );
+      blaze::randomize( tmp );
+
+      blaze::DynamicMatrix<double,blaze::columnMajor> ref( tmp );
+      blaze::BandMatrix<double,blaze::columnMajor> mat( ref );
+
+      checkRows   ( mat, 8UL );
+      checkColumns( mat, 6UL );
+      checkEqual  ( mat, ref );
+
+      test_ = "Column-major BandMatrix resize";
+
+      mat.resize( 5UL, 5UL, 3UL, 1UL );
+      ref.resize( 5UL, 5UL );
+
+      checkRows   ( mat, 5UL );
+      checkColumns( mat, 5UL );
+      checkEqual  ( mat, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BandMatrix element access and assignment operations.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the element access, the assignment, the addition and
+// subtraction assignment, and the transpose operation of the BandMatrix class template. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   using blaze::BandMatrix;
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+
+   //=====================================================================================
+   // Row-major element access
+   //=====================================================================================
+
+   {
+      test_ = "Row-major BandMatrix element access";
+
+      BandMatrix<int,rowMajor> mat( 4UL, 4UL, 1UL, 1UL );
+      blaze::DynamicMatrix<int,rowMajor> ref( 4UL, 4UL, 0 );
+
+      mat(0,1) = 2;
+      mat(2,1) = 3;
+      mat(3,3) = 4;
+      ref(0,1) = 2;
+      ref(2,1) = 3;
+      ref(3,3) = 4;
+
+      checkNonZeros( mat, 3UL );
+      checkEqual   ( mat, ref );
+
+      test_ = "Row-major BandMatrix invalid element assignment";
+
+      try {
+         mat(0,3) = 1;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment to element outside of the band succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      checkEqual( mat, ref );
+   }
+
+
+   //=====================================================================================
+   // Row-major addition and subtraction assignment
+   //=====================================================================================
+
+   {
+      test_ = "Row-major BandMatrix addition assignment";
+
+      BandMatrix<int,rowMajor> mat{ { 1, 2, 0 }, { 0, 3, 4 }, { 0, 0, 5 } };
+      blaze::DynamicMatrix<int,rowMajor> ref{ { 1, 2, 0 }, { 0, 3, 4 }, { 0, 0, 5 } };
+
+      const BandMatrix<int,columnMajor> lower{ { 1, 0, 0 }, { 2, 1, 0 }, { 3, 2, 1 } };
+
+      mat += lower;
+      ref += lower;
+
+      checkEqual( mat, ref );
+
+      test_ = "Row-major BandMatrix subtraction assignment";
+
+      mat -= lower;
+      ref -= lower;
+
+      checkEqual( mat, ref );
+
+      test_ = "Row-major BandMatrix transpose";
+
+      transpose( mat );
+      transpose( ref );
+
+      checkEqual( mat, ref );
+   }
+
+
+   //=====================================================================================
+   // Column-major element access
+   //=====================================================================================
+
+   {
+      test_ = "Column-major BandMatrix element access";
+
+      BandMatrix<int,columnMajor> mat( 4UL, 3UL, 2UL, 0UL );
+      blaze::DynamicMatrix<int,columnMajor> ref( 4UL, 3UL, 0 );
+
+      mat(2,0) = 2;
+      mat(3,1) = 3;
+      ref(2,0) = 2;
+      ref(3,1) = 3;
+
+      checkNonZeros( mat, 2UL );
+      checkEqual   ( mat, ref );
+
+      test_ = "Column-major BandMatrix invalid element assignment";
+
+      try {
+         mat(1,2) = 1;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment to element outside of the band succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      checkEqual( mat, ref );
+   }
+
+
+   //=====================================================================================
+   // Column-major addition and subtraction assignment
+   //=====================================================================================
+
+   {
+      test_ = "Column-major BandMatrix addition assignment";
+
+      BandMatrix<double,columnMajor> mat( 9UL, 9UL, 1UL, 2UL );
+      BandMatrix<double,columnMajor> rhs( 9UL, 9UL, 3UL, 0UL );
+      blaze::randomize( mat );
+      blaze::randomize( rhs );
+
+      blaze::DynamicMatrix<double,columnMajor> ref( mat );
+
+      mat += rhs;
+      ref += rhs;
+
+      checkEqual( mat, ref );
+
+      test_ = "Column-major BandMatrix subtraction assignment";
+
+      mat -= rhs;
+      ref -= rhs;
+
+      checkEqual( mat, ref );
+
+      test_ = "Column-major BandMatrix transpose";
+
+      transpose( mat );
+      transpose( ref );
+
+      checkEqual( mat, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the multiplication, addition, and subtraction of band matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the dedicated matrix/vector, matrix/matrix, and band/band
+// kernels of the BandMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testMultiplication()
+{
+   using blaze::BandMatrix;
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   using cplx = std::complex<double>;
+
+   for( size_t n=1UL; n<40UL; n+=7UL )
+   {
+      testMultiplication< BandMatrix<double,rowMajor> >( n, n, 1UL, 1UL );
+      testMultiplication< BandMatrix<double,columnMajor> >( n, n, 1UL, 1UL );
+      testMultiplication< BandMatrix<double,rowMajor> >( n+3UL, n, 4UL, 0UL );
+      testMultiplication< BandMatrix<double,columnMajor> >( n, n+5UL, 2UL, 6UL );
+      testMultiplication< BandMatrix<cplx,rowMajor> >( n+2UL, n, 2UL, 3UL );
+      testMultiplication< BandMatrix<cplx,columnMajor> >( n, n+2UL, 3UL, 2UL );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the multiplication of a particular band matrix type.
+//
+// \param m The number of rows of the band matrix.
+// \param n The number of columns of the band matrix.
+// \param kl The number of subdiagonals of the band matrix.
+// \param ku The number of superdiagonals of the band matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the matrix/vector, matrix/matrix, and band/band operations of the
+// given band matrix type with the according operations on a dense reference matrix. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT >  // Type of the band matrix
+void ClassTest::testMultiplication( size_t m, size_t n, size_t kl, size_t ku )
+{
+   using ET = blaze::ElementType_t<MT>;
+
+   MT mat( m, n, kl, ku );
+   blaze::randomize( mat );
+
+   const blaze::DynamicMatrix<ET,blaze::rowMajor> ref( mat );
+
+   blaze::DynamicVector<ET,blaze::columnVector> x( n );
+   blaze::DynamicMatrix<ET,blaze::rowMajor> B( n, 11UL );
+   blaze::randomize( x );
+   blaze::randomize( B );
+
+   const blaze::DynamicMatrix<ET,blaze::columnMajor> TB( B );
+
+   blaze::BandMatrix<ET,blaze::columnMajor> band( n, m, 1UL, 2UL );
+   blaze::BandMatrix<ET,blaze::rowMajor> other( m, n, 2UL, 1UL );
+   blaze::randomize( band );
+   blaze::randomize( other );
+
+
+   //=====================================================================================
+   // Matrix/vector multiplication
+   //=====================================================================================
+
+   {
+      test_ = "BandMatrix/DynamicVector multiplication";
+
+      const blaze::DynamicVector<ET,blaze::columnVector> res( mat * x );
+      const blaze::DynamicVector<ET,blaze::columnVector> exp( ref * x );
+
+      for( size_t i=0UL; i<m; ++i ) {
+         if( !isEqual( res[i], exp[i] ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Multiplication failed\n"
+                << " Details:\n"
+                << "   Storage order: " << ( blaze::IsRowMajorMatrix_v<MT> ? "row-major" : "column-major" ) << "\n"
+                << "   Result:\n" << res << "\n"
+                << "   Expected result:\n" << exp << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Matrix/matrix multiplication
+   //=====================================================================================
+
+   {
+      test_ = "BandMatrix/row-major DynamicMatrix multiplication";
+
+      const blaze::DynamicMatrix<ET,blaze::rowMajor> res( mat * B );
+
+      checkEqual( res, ref * B );
+   }
+
+   {
+      test_ = "BandMatrix/column-major DynamicMatrix multiplication";
+
+      const blaze::DynamicMatrix<ET,blaze::columnMajor> res( mat * TB );
+
+      checkEqual( res, ref * B );
+   }
+
+   {
+      test_ = "BandMatrix/BandMatrix multiplication";
+
+      const blaze::DynamicMatrix<ET,blaze::rowMajor> res( mat * band );
+
+      checkEqual( res, ref * band );
+   }
+
+
+   //=====================================================================================
+   // Matrix addition and subtraction
+   //=====================================================================================
+
+   {
+      test_ = "BandMatrix/BandMatrix addition";
+
+      const blaze::DynamicMatrix<ET,blaze::rowMajor> res( mat + other );
+
+      checkEqual( res, ref + other );
+   }
+
+   {
+      test_ = "BandMatrix/BandMatrix subtraction";
+
+      const blaze::DynamicMatrix<ET,blaze::rowMajor> res( mat - other );
+
+      checkEqual( res, ref - other );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the solution of banded linear systems of equations.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the solve() functions and the gbsv() and pbsv() LAPACK
+// functions for band matrices. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void ClassTest::testSolve()
+{
+#if BLAZETEST_MATHTEST_LAPACK_MODE
+
+   using blaze::BandMatrix;
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   const size_t n( 20UL );
+
+
+   //=====================================================================================
+   // General band matrix
+   //=====================================================================================
+
+   {
+      test_ = "BandMatrix linear system solver";
+
+      BandMatrix<double,columnMajor> A( n, n, 2UL, 3UL );
+      blaze::randomize( A );
+      for( size_t i=0UL; i<n; ++i ) {
+         A(i,i) += 10.0;
+      }
+
+      blaze::DynamicVector<double,blaze::columnVector> b( n ), x;
+      blaze::DynamicMatrix<double,rowMajor> B( n, 5UL ), X;
+      blaze::randomize( b );
+      blaze::randomize( B );
+
+      solve( A, x, b );
+      solve( A, X, B );
+
+      checkEqual( blaze::DynamicMatrix<double,rowMajor>( A * X ), B );
+
+      const blaze::DynamicVector<double,blaze::columnVector> Ax( A * x );
+
+      for( size_t i=0UL; i<n; ++i ) {
+         if( !isEqual( Ax[i], b[i] ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Solving the LSE failed\n"
+                << " Details:\n"
+                << "   Result:\n" << Ax << "\n"
+                << "   Expected result:\n" << b << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Singular band matrix
+   //=====================================================================================
+
+   {
+      test_ = "BandMatrix singular linear system";
+
+      const BandMatrix<double,rowMajor> A( n, n, 1UL, 1UL );
+      blaze::DynamicVector<double,blaze::columnVector> b( n, 1.0 ), x;
+
+      try {
+         solve( A, x, b );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving a singular LSE succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << x << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::runtime_error& ) {}
+   }
+
+
+   //=====================================================================================
+   // Positive definite band matrix
+   //=====================================================================================
+
+   {
+      test_ = "BandMatrix positive definite linear system";
+
+      BandMatrix<double,rowMajor> A( n, n, 1UL, 1UL );
+      for( size_t i=0UL; i<n; ++i ) {
+         A(i,i) = 4.0;
+         if( i+1UL < n ) {
+            A(i,i+1UL) = A(i+1UL,i) = -1.0;
+         }
+      }
+
+      blaze::DynamicMatrix<double,columnMajor> B( n, 3UL );
+      blaze::randomize( B );
+
+      blaze::DynamicMatrix<double,columnMajor> X( B );
+      blaze::DynamicMatrix<double,columnMajor> Y( B );
+
+      pbsv( A, X, 'L' );
+      pbsv( A, Y, 'U' );
+
+      checkEqual( blaze::DynamicMatrix<double,columnMajor>( A * X ), B );
+      checkEqual( blaze::DynamicMatrix<double,columnMajor>( A * Y ), B );
+   }
+
+#endif
+}
+//*************************************************************************************************
+
+} // namespace bandmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running BandMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_BANDMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during BandMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,492 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/batch/ClassTest.cpp
+//  \brief Source file for the batched operations test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/HybridMatrix.h>
+#include <blaze/math/StaticMatrix.h>
+#include <blaze/math/StaticVector.h>
+#include <blaze/util/AlignedAllocator.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/IsEqual.h>
+#include <blazetest/mathtest/batch/ClassTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace batch {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the batched operations test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testMult();
+   testInvert();
+   testSolve();
+   testExceptions();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the batchMult() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the batched multiplication of small dense matrices via the batchMult()
+// function. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMult()
+{
+   //=====================================================================================
+   // Batched multiplication of 4x4 matrices
+   //=====================================================================================
+
+   {
+      test_ = "batchMult() with 4x4 matrices";
+
+      using MT = blaze::StaticMatrix<double,4UL,4UL>;
+
+      std::vector< MT, blaze::AlignedAllocator<MT> > A( 37UL ), B( 37UL ), C;
+
+      for( size_t i=0UL; i<A.size(); ++i ) {
+         randomize( A[i] );
+         randomize( B[i] );
+      }
+
+      blaze::batchMult( C, A, B );
+
+      if( C.size() != A.size() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid batch size\n"
+             << " Details:\n"
+             << "   Size : " << C.size() << " (expected " << A.size() << ")\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      for( size_t i=0UL; i<A.size(); ++i )
+      {
+         const MT R( A[i] * B[i] );
+
+         if( !isEqual( C[i], R ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Multiplication failed\n"
+                << " Details:\n"
+                << "   Index  : " << i << "\n"
+                << "   Result:\n" << C[i] << "\n"
+                << "   Expected result:\n" << R << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Batched multiplication of non-square matrices with different storage orders
+   //=====================================================================================
+
+   {
+      test_ = "batchMult() with non-square matrices";
+
+      using MT1 = blaze::HybridMatrix<float,3UL,5UL,blaze::rowMajor>;
+      using MT2 = blaze::StaticMatrix<float,5UL,2UL,blaze::columnMajor>;
+      using MT3 = blaze::DynamicMatrix<float,blaze::rowMajor>;
+
+      std::vector< MT1, blaze::AlignedAllocator<MT1> > A( 21UL, MT1( 3UL, 5UL ) );
+      std::vector< MT2, blaze::AlignedAllocator<MT2> > B( 21UL );
+      std::vector< MT3 > C( 3UL );
+
+      for( size_t i=0UL; i<A.size(); ++i ) {
+         randomize( A[i] );
+         randomize( B[i] );
+      }
+
+      blaze::batchMult( C, A, B );
+
+      for( size_t i=0UL; i<A.size(); ++i )
+      {
+         const MT3 R( A[i] * B[i] );
+
+         if( C[i].rows() != 3UL || C[i].columns() != 2UL || !isEqual( C[i], R ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Multiplication failed\n"
+                << " Details:\n"
+                << "   Index  : " << i << "\n"
+                << "   Result:\n" << C[i] << "\n"
+                << "   Expected result:\n" << R << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batchInvert() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the batched inversion of small dense matrices via the batchInvert()
+// function. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testInvert()
+{
+   testInvert<double,3UL>( 19UL );
+   testInvert<double,4UL>( 19UL );
+   testInvert<double,6UL>( 19UL );
+   testInvert<double,8UL>( 33UL );
+   testInvert<float,5UL>( 41UL );
+   testInvert<float,6UL>( 7UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batchInvert() function for a batch of \a N x \a N matrices.
+//
+// \param count The number of matrices in the batch.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the batched inversion of \a N x \a N matrices. The batch contains
+// matrices that can be inverted without pivoting as well as a permutation matrix, which
+// requires pivoting. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type  // Element type of the matrices
+        , size_t N >     // Number of rows and columns of the matrices
+void ClassTest::testInvert( size_t count )
+{
+   using MT = blaze::StaticMatrix<Type,N,N>;
+
+   std::ostringstream label;
+   label << "batchInvert() with " << N << "x" << N << " matrices";
+   test_ = label.str();
+
+   std::vector< MT, blaze::AlignedAllocator<MT> > A( count ), B;
+
+   for( size_t i=0UL; i<count; ++i ) {
+      randomize( A[i], Type(-1), Type(1) );
+      for( size_t j=0UL; j<N; ++j )
+         A[i](j,j) += Type(N);
+   }
+
+   reset( A[1UL] );
+   for( size_t j=0UL; j<N; ++j )
+      A[1UL](j,N-j-1UL) = Type(2);
+
+   B = A;
+
+   blaze::batchInvert( A );
+
+   for( size_t i=0UL; i<count; ++i )
+   {
+      const MT R( inv( B[i] ) );
+
+      if( blaze::maxNorm( A[i] - R ) > Type(1E-4) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Inversion failed\n"
+             << " Details:\n"
+             << "   Index  : " << i << "\n"
+             << "   Result:\n" << A[i] << "\n"
+             << "   Expected result:\n" << R << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batchSolve() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the batched solution of small linear systems of equations via the
+// batchSolve() function. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void ClassTest::testSolve()
+{
+   testSolve<double,3UL>( 11UL );
+   testSolve<double,5UL>( 11UL );
+   testSolve<double,8UL>( 35UL );
+   testSolve<float,6UL>( 23UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batchSolve() function for a batch of \a N x \a N systems.
+//
+// \param count The number of systems in the batch.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the batched solution of \a N x \a N linear systems with both a single
+// right-hand side vector and multiple right-hand side vectors. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+template< typename Type  // Element type of the matrices
+        , size_t N >     // Number of rows and columns of the matrices
+void ClassTest::testSolve( size_t count )
+{
+   using MT = blaze::StaticMatrix<Type,N,N>;
+   using RT = blaze::StaticMatrix<Type,N,3UL,blaze::columnMajor>;
+   using VT = blaze::StaticVector<Type,N>;
+
+   std::ostringstream label;
+   label << "batchSolve() with " << N << "x" << N << " systems";
+   test_ = label.str();
+
+   std::vector< MT, blaze::AlignedAllocator<MT> > A( count );
+   std::vector< RT, blaze::AlignedAllocator<RT> > B( count ), X;
+   std::vector< VT, blaze::AlignedAllocator<VT> > b( count ), x;
+
+   for( size_t i=0UL; i<count; ++i ) {
+      randomize( A[i], Type(-1), Type(1) );
+      randomize( B[i], Type(-1), Type(1) );
+      randomize( b[i], Type(-1), Type(1) );
+      for( size_t j=0UL; j<N; ++j )
+         A[i](j,j) += Type(N);
+   }
+
+   reset( A[0UL] );
+   for( size_t j=0UL; j<N; ++j )
+      A[0UL](j,N-j-1UL) = Type(3);
+
+   blaze::batchSolve( A, X, B );
+   blaze::batchSolve( A, x, b );
+
+   for( size_t i=0UL; i<count; ++i )
+   {
+      if( blaze::maxNorm( A[i] * X[i] - B[i] ) > Type(1E-4) ||
+          blaze::maxNorm( A[i] * x[i] - b[i] ) > Type(1E-4) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving the linear system failed\n"
+             << " Details:\n"
+             << "   Index  : " << i << "\n"
+             << "   System matrix:\n" << A[i] << "\n"
+             << "   Solution (multiple right-hand sides):\n" << X[i] << "\n"
+             << "   Solution (single right-hand side):\n" << x[i] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the error handling of the batched operations.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the batched operations reject batches of different size, matrices
+// of non-matching size, and singular matrices. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testExceptions()
+{
+   using MT = blaze::DynamicMatrix<double,blaze::rowMajor>;
+
+   //=====================================================================================
+   // Batches of different size
+   //=====================================================================================
+
+   {
+      test_ = "batchMult() with batches of different size";
+
+      std::vector<MT> A( 5UL, MT( 3UL, 3UL, 1.0 ) ), B( 4UL, MT( 3UL, 3UL, 1.0 ) ), C;
+
+      try {
+         blaze::batchMult( C, A, B );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication of batches of different size succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Matrices of non-matching size
+   //=====================================================================================
+
+   {
+      test_ = "batchMult() with matrices of non-matching size";
+
+      std::vector<MT> A( 5UL, MT( 3UL, 3UL, 1.0 ) ), B( 5UL, MT( 3UL, 3UL, 1.0 ) ), C;
+      B[3UL].resize( 4UL, 3UL );
+
+      try {
+         blaze::batchMult( C, A, B );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication of non-matching matrices succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Non-square matrices
+   //=====================================================================================
+
+   {
+      test_ = "batchInvert() with non-square matrices";
+
+      std::vector<MT> A( 5UL, MT( 3UL, 4UL, 1.0 ) );
+
+      try {
+         blaze::batchInvert( A );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Inversion of non-square matrices succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Singular matrices
+   //=====================================================================================
+
+   {
+      test_ = "batchInvert() with a singular matrix";
+
+      using ST = blaze::StaticMatrix<double,6UL,6UL>;
+
+      std::vector< ST, blaze::AlignedAllocator<ST> > A( 9UL, blaze::IdentityMatrix<double>( 6UL ) );
+      reset( A[4UL] );
+
+      bool failed( false );
+
+      try {
+         blaze::batchInvert( A );
+      }
+      catch( std::runtime_error& ) {
+         failed = true;
+      }
+
+      if( !failed ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Inversion of singular matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace batch
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running batched operations test..." << std::endl;
+
+   try
+   {
+      RUN_BATCH_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during batched operations test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,456 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/blockcompressedmatrix/ClassTest.cpp
+//  \brief Source file for the BlockCompressedMatrix class test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <complex>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <blaze/math/BlockCompressedMatrix.h>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/blockcompressedmatrix/ClassTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace blockcompressedmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the BlockCompressedMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testAccess();
+   testMultiplication();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the BlockCompressedMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the BlockCompressedMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   //=====================================================================================
+   // Default constructor
+   //=====================================================================================
+
+   {
+      test_ = "BlockCompressedMatrix default constructor";
+
+      blaze::BlockCompressedMatrix<int,2UL> mat;
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Conversion constructor
+   //=====================================================================================
+
+   {
+      test_ = "BlockCompressedMatrix conversion constructor (row-major CompressedMatrix)";
+
+      const blaze::CompressedMatrix<int,blaze::rowMajor> ref{ { 1, 0, 0, 0, 2, 0 },
+                                                              { 0, 0, 0, 0, 0, 3 },
+                                                              { 0, 0, 0, 0, 0, 0 },
+                                                              { 0, 0, 0, 0, 0, 0 },
+                                                              { 4, 0, 5, 0, 0, 0 },
+                                                              { 0, 0, 0, 6, 0, 0 } };
+
+      const blaze::BlockCompressedMatrix<int,2UL> mat( ref );
+
+      checkRows    ( mat,  6UL );
+      checkColumns ( mat,  6UL );
+      checkNonZeros( mat, 16UL );
+      checkEqual   ( mat, ref );
+
+      if( mat.blockRows() != 3UL || mat.blockColumns() != 3UL || mat.nonZeroBlocks() != 4UL ||
+          mat.nonZeroBlocks(0UL) != 2UL || mat.nonZeroBlocks(1UL) != 0UL || mat.nonZeroBlocks(2UL) != 2UL ||
+          mat.blockIndices(0UL)[0] != 0UL || mat.blockIndices(0UL)[1] != 2UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid block structure detected\n"
+             << " Details:\n"
+             << "   Block rows     : " << mat.blockRows() << " (expected 3)\n"
+             << "   Block columns  : " << mat.blockColumns() << " (expected 3)\n"
+             << "   Non-zero blocks: " << mat.nonZeroBlocks() << " (expected 4)\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "BlockCompressedMatrix conversion constructor (column-major CompressedMatrix)";
+
+      blaze::CompressedMatrix<double,blaze::columnMajor> ref( 12UL, 9UL );
+      blaze::randomize( ref, 30UL );
+
+      const blaze::BlockCompressedMatrix<double,3UL,uint32_t> mat( ref );
+
+      checkRows    ( mat, 12UL );
+      checkColumns ( mat,  9UL );
+      checkEqual   ( mat, ref );
+   }
+
+   {
+      test_ = "BlockCompressedMatrix conversion constructor (invalid matrix size)";
+
+      const blaze::CompressedMatrix<int,blaze::rowMajor> ref( 6UL, 7UL );
+
+      try {
+         const blaze::BlockCompressedMatrix<int,3UL> mat( ref );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction with invalid matrix size succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Conversion to CompressedMatrix
+   //=====================================================================================
+
+   {
+      test_ = "BlockCompressedMatrix conversion to CompressedMatrix";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> ref( 18UL, 12UL );
+      blaze::randomize( ref, 40UL );
+
+      const blaze::BlockCompressedMatrix<double,6UL> mat( ref );
+      const blaze::CompressedMatrix<double,blaze::rowMajor> res1( mat );
+      const blaze::CompressedMatrix<double,blaze::columnMajor> res2( mat );
+
+      checkEqual( res1, ref );
+      checkEqual( res2, ref );
+   }
+
+
+   //=====================================================================================
+   // Copy and move constructor
+   //=====================================================================================
+
+   {
+      test_ = "BlockCompressedMatrix copy constructor";
+
+      const blaze::CompressedMatrix<int,blaze::rowMajor> ref{ { 1, 0, 0, 2 }, { 0, 3, 0, 0 } };
+      const blaze::BlockCompressedMatrix<int,2UL> mat1( ref );
+      const blaze::BlockCompressedMatrix<int,2UL> mat2( mat1 );
+
+      checkRows    ( mat2, 2UL );
+      checkColumns ( mat2, 4UL );
+      checkNonZeros( mat2, 8UL );
+      checkEqual   ( mat2, ref );
+   }
+
+   {
+      test_ = "BlockCompressedMatrix move constructor";
+
+      const blaze::CompressedMatrix<int,blaze::rowMajor> ref{ { 1, 0, 0, 2 }, { 0, 3, 0, 0 } };
+      blaze::BlockCompressedMatrix<int,2UL> mat1( ref );
+      const blaze::BlockCompressedMatrix<int,2UL> mat2( std::move( mat1 ) );
+
+      checkRows    ( mat2, 2UL );
+      checkColumns ( mat2, 4UL );
+      checkNonZeros( mat2, 8UL );
+      checkEqual   ( mat2, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the element access and iteration functions of the BlockCompressedMatrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the element access functions, the lookup functions, and the
+// iterators of the BlockCompressedMatrix class template. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAccess()
+{
+   test_ = "BlockCompressedMatrix iterators";
+
+   blaze::CompressedMatrix<double,blaze::rowMajor> ref( 30UL, 21UL );
+   blaze::randomize( ref, 60UL );
+
+   const blaze::BlockCompressedMatrix<double,3UL,uint32_t> mat( ref );
+
+   checkEqual( mat, ref );
+
+   for( size_t i=0UL; i<ref.rows(); ++i )
+   {
+      if( size_t( mat.end(i) - mat.begin(i) ) != mat.nonZeros(i) ||
+          mat.nonZeros(i) != 3UL*mat.nonZeroBlocks(i/3UL) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of elements in row " << i << "\n"
+             << " Details:\n"
+             << "   Number of elements         : " << size_t( mat.end(i) - mat.begin(i) ) << "\n"
+             << "   Expected number of elements: " << mat.nonZeros(i) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      size_t last( 0UL );
+      for( auto it=mat.cbegin(i); it!=mat.cend(i); ++it )
+      {
+         if( ( it != mat.cbegin(i) && it->index() <= last ) ||
+             !isEqual( it->value(), ref(i,it->index()) ) ||
+             mat.find( i, it->index() ) != it ||
+             mat.lowerBound( i, it->index() ) != it ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid element in row " << i << "\n"
+                << " Details:\n"
+                << "   Index: " << it->index() << "\n"
+                << "   Value: " << it->value() << " (expected " << ref(i,it->index()) << ")\n";
+            throw std::runtime_error( oss.str() );
+         }
+         last = it->index();
+      }
+
+      for( auto element=ref.cbegin(i); element!=ref.cend(i); ++element )
+      {
+         if( mat.find( i, element->index() ) == mat.end(i) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Missing element in row " << i << "\n"
+                << " Details:\n"
+                << "   Index: " << element->index() << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   try {
+      const double value = mat.at( 0UL, 21UL );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Out-of-bounds access succeeded\n"
+          << " Details:\n"
+          << "   Value: " << value << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::out_of_range& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the multiplication of block compressed matrices with dense vectors and matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the block compressed matrix/dense vector and the block
+// compressed matrix/dense matrix multiplication for several element types and block sizes.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMultiplication()
+{
+   using blaze::BlockCompressedMatrix;
+
+   using cplx = std::complex<double>;
+
+   for( size_t n=0UL; n<60UL; n+=12UL )
+   {
+      testMultiplication< BlockCompressedMatrix<double,3UL> >( n+6UL, n+3UL, 2UL*n );
+      testMultiplication< BlockCompressedMatrix<double,6UL,uint32_t> >( n+12UL, n+6UL, 3UL*n );
+      testMultiplication< BlockCompressedMatrix<float,3UL,uint32_t> >( n+3UL, n+9UL, n );
+      testMultiplication< BlockCompressedMatrix<float,4UL> >( n+8UL, n+4UL, 2UL*n );
+      testMultiplication< BlockCompressedMatrix<cplx,2UL> >( n+4UL, n+2UL, n );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the multiplication of a particular block compressed matrix type.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param nonzeros The number of non-zero elements of the reference matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the matrix/vector and matrix/matrix multiplication of the given block
+// compressed matrix type with the according operations on a CompressedMatrix. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT >  // Type of the block compressed matrix
+void ClassTest::testMultiplication( size_t m, size_t n, size_t nonzeros )
+{
+   using ET = blaze::ElementType_t<MT>;
+
+   blaze::CompressedMatrix<ET,blaze::rowMajor> ref( m, n );
+   blaze::randomize( ref, blaze::min( nonzeros, m*n ) );
+
+   const MT mat( ref );
+
+   blaze::DynamicVector<ET,blaze::columnVector> x( n );
+   blaze::randomize( x );
+
+   blaze::DynamicMatrix<ET,blaze::rowMajor> B( n, 13UL );
+   blaze::randomize( B );
+
+   const blaze::DynamicMatrix<ET,blaze::columnMajor> TB( B );
+
+
+   //=====================================================================================
+   // Matrix/vector multiplication
+   //=====================================================================================
+
+   {
+      test_ = "BlockCompressedMatrix/DynamicVector multiplication";
+
+      const blaze::DynamicVector<ET,blaze::columnVector> res( mat * x );
+      const blaze::DynamicVector<ET,blaze::columnVector> exp( ref * x );
+
+      for( size_t i=0UL; i<m; ++i ) {
+         if( !isEqual( res[i], exp[i] ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Multiplication failed\n"
+                << " Details:\n"
+                << "   Block size: " << MT::blockSize << "\n"
+                << "   Result:\n" << res << "\n"
+                << "   Expected result:\n" << exp << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Matrix/matrix multiplication
+   //=====================================================================================
+
+   {
+      test_ = "BlockCompressedMatrix/row-major DynamicMatrix multiplication";
+
+      const blaze::DynamicMatrix<ET,blaze::rowMajor> res( mat * B );
+
+      checkEqual( res, ref * B );
+   }
+
+   {
+      test_ = "BlockCompressedMatrix/column-major DynamicMatrix multiplication";
+
+      const blaze::DynamicMatrix<ET,blaze::columnMajor> res( mat * TB );
+
+      checkEqual( res, ref * B );
+   }
+}
+//*************************************************************************************************
+
+} // namespace blockcompressedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running BlockCompressedMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_BLOCKCOMPRESSEDMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during BlockCompressedMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
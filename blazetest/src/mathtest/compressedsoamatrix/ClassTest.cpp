@@ -0,0 +1,526 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/compressedsoamatrix/ClassTest.cpp
+//  \brief Source file for the CompressedSoAMatrix class test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/CompressedSoAMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Row.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/IsEqual.h>
+#include <blazetest/mathtest/compressedsoamatrix/ClassTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace compressedsoamatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the CompressedSoAMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testFunctions();
+   testMultiplication();
+   testIndexRange();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the CompressedSoAMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the CompressedSoAMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   //=====================================================================================
+   // Row-major default constructor
+   //=====================================================================================
+
+   {
+      test_ = "Row-major CompressedSoAMatrix default constructor";
+
+      blaze::CompressedSoAMatrix<int,blaze::rowMajor> mat;
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Row-major size constructor
+   //=====================================================================================
+
+   {
+      test_ = "Row-major CompressedSoAMatrix size constructor";
+
+      blaze::CompressedSoAMatrix<int,blaze::rowMajor,uint16_t> mat( 3UL, 4UL, 5UL );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 0UL );
+
+      if( mat.capacity() < 5UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Capacity         : " << mat.capacity() << "\n"
+             << "   Expected capacity: 5 or more\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Row-major list initialization
+   //=====================================================================================
+
+   {
+      test_ = "Row-major CompressedSoAMatrix initializer list constructor";
+
+      blaze::CompressedSoAMatrix<int,blaze::rowMajor,uint32_t> mat{ { 1, 0, 3 }, { 0, 5, 0 } };
+
+      checkRows    ( mat, 2UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 3UL );
+
+      if( mat(0,0) != 1 || mat(0,1) != 0 || mat(0,2) != 3 ||
+          mat(1,0) != 0 || mat(1,1) != 5 || mat(1,2) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 3 )\n( 0 5 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major conversion constructor
+   //=====================================================================================
+
+   {
+      test_ = "Column-major CompressedSoAMatrix conversion constructor";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> ref( 7UL, 9UL );
+      blaze::randomize( ref, 20UL );
+
+      blaze::CompressedSoAMatrix<double,blaze::columnMajor,uint32_t> mat( ref );
+
+      checkRows    ( mat, 7UL );
+      checkColumns ( mat, 9UL );
+      checkNonZeros( mat, nonZeros( ref ) );
+
+      if( mat != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CompressedSoAMatrix member functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the insert(), erase(), find(), and resize() member functions
+// of the CompressedSoAMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testFunctions()
+{
+   //=====================================================================================
+   // Row-major insert(), find() and erase()
+   //=====================================================================================
+
+   {
+      test_ = "Row-major CompressedSoAMatrix::insert()/find()/erase()";
+
+      blaze::CompressedSoAMatrix<int,blaze::rowMajor,uint16_t> mat( 3UL, 5UL );
+
+      mat.insert( 1UL, 3UL, 4 );
+      mat.insert( 1UL, 0UL, 2 );
+      mat.insert( 2UL, 4UL, 7 );
+      mat.insert( 0UL, 1UL, 1 );
+
+      checkNonZeros( mat, 4UL );
+
+      auto pos( mat.find( 1UL, 3UL ) );
+
+      if( pos == mat.end( 1UL ) || pos->index() != 3UL || pos->value() != 4 ||
+          mat.begin( 1UL )->index() != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Inserting elements failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      mat.erase( 1UL, 0UL );
+      mat.erase( 2UL, mat.begin( 2UL ), mat.end( 2UL ), []( int value ){ return value > 5; } );
+
+      checkNonZeros( mat, 2UL );
+
+      if( mat(0,1) != 1 || mat(1,0) != 0 || mat(1,3) != 4 || mat(2,4) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Erasing elements failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major resize()
+   //=====================================================================================
+
+   {
+      test_ = "Column-major CompressedSoAMatrix::resize()";
+
+      blaze::CompressedSoAMatrix<int,blaze::columnMajor,uint32_t> mat{ { 1, 0 }, { 0, 2 }, { 3, 0 } };
+
+      mat.resize( 2UL, 3UL, true );
+
+      checkRows    ( mat, 2UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 2UL );
+
+      if( mat(0,0) != 1 || mat(1,1) != 2 || mat(0,2) != 0 || mat(1,2) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Resizing the matrix failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 0 )\n( 0 2 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CompressedSoAMatrix multiplications.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the matrix/vector and matrix/matrix multiplications with CompressedSoAMatrix
+// operands, including the gather-based inner product kernel, for several element and index
+// types. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMultiplication()
+{
+   testMultiplication<double,blaze::rowMajor   ,uint32_t>( 37UL, 121UL, 900UL );
+   testMultiplication<double,blaze::rowMajor   ,size_t  >( 37UL, 121UL, 900UL );
+   testMultiplication<double,blaze::columnMajor,uint32_t>( 37UL, 121UL, 900UL );
+   testMultiplication<float ,blaze::rowMajor   ,uint32_t>( 29UL,  95UL, 700UL );
+   testMultiplication<float ,blaze::rowMajor   ,size_t  >( 29UL,  95UL, 700UL );
+   testMultiplication<float ,blaze::columnMajor,uint16_t>( 29UL,  95UL, 700UL );
+   testMultiplication<int   ,blaze::rowMajor   ,uint16_t>( 17UL,  33UL, 100UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CompressedSoAMatrix multiplications for a specific configuration.
+//
+// \param m The number of rows of the sparse matrix.
+// \param n The number of columns of the sparse matrix.
+// \param nonzeros The number of non-zero elements of the sparse matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename Type  // Element type
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+void ClassTest::testMultiplication( size_t m, size_t n, size_t nonzeros )
+{
+   blaze::CompressedMatrix<Type,SO> ref( m, n );
+   blaze::randomize( ref, nonzeros );
+
+   const blaze::CompressedSoAMatrix<Type,SO,IT> mat( ref );
+
+   blaze::DynamicVector<Type,blaze::columnVector> x( n );
+   blaze::DynamicVector<Type,blaze::rowVector> y( m );
+   blaze::randomize( x );
+   blaze::randomize( y );
+
+   //=====================================================================================
+   // Matrix/vector multiplication
+   //=====================================================================================
+
+   {
+      test_ = "CompressedSoAMatrix/DynamicVector multiplication";
+
+      const blaze::DynamicVector<Type,blaze::columnVector> res( mat * x );
+      const blaze::DynamicVector<Type,blaze::columnVector> exp( ref * x );
+
+      for( size_t i=0UL; i<m; ++i ) {
+         if( !isEqual( res[i], exp[i] ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Multiplication failed\n"
+                << " Details:\n"
+                << "   Storage order: " << ( SO ? "column-major" : "row-major" ) << "\n"
+                << "   Index size   : " << sizeof(IT) << "\n"
+                << "   Result:\n" << res << "\n"
+                << "   Expected result:\n" << exp << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Vector/matrix multiplication
+   //=====================================================================================
+
+   {
+      test_ = "DynamicVector/CompressedSoAMatrix multiplication";
+
+      const blaze::DynamicVector<Type,blaze::rowVector> res( y * mat );
+      const blaze::DynamicVector<Type,blaze::rowVector> exp( y * ref );
+
+      for( size_t j=0UL; j<n; ++j ) {
+         if( !isEqual( res[j], exp[j] ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Multiplication failed\n"
+                << " Details:\n"
+                << "   Storage order: " << ( SO ? "column-major" : "row-major" ) << "\n"
+                << "   Index size   : " << sizeof(IT) << "\n"
+                << "   Result:\n" << res << "\n"
+                << "   Expected result:\n" << exp << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Row/vector inner product
+   //=====================================================================================
+
+   {
+      test_ = "CompressedSoAMatrix row/DynamicVector inner product";
+
+      for( size_t i=0UL; i<m; ++i ) {
+         const Type res( row( mat, i ) * x );
+         const Type exp( row( ref, i ) * x );
+
+         if( !isEqual( res, exp ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Inner product failed\n"
+                << " Details:\n"
+                << "   Row            : " << i << "\n"
+                << "   Result         : " << res << "\n"
+                << "   Expected result: " << exp << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Matrix/matrix multiplication
+   //=====================================================================================
+
+   {
+      test_ = "CompressedSoAMatrix/CompressedSoAMatrix multiplication";
+
+      const blaze::CompressedSoAMatrix<Type,SO,IT> res( mat * trans( mat ) );
+      const blaze::CompressedMatrix<Type,SO> exp( ref * trans( ref ) );
+
+      for( size_t i=0UL; i<m; ++i ) {
+         for( size_t j=0UL; j<m; ++j ) {
+            if( !isEqual( res(i,j), exp(i,j) ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Multiplication failed\n"
+                   << " Details:\n"
+                   << "   Storage order: " << ( SO ? "column-major" : "row-major" ) << "\n"
+                   << "   Index size   : " << sizeof(IT) << "\n"
+                   << "   Result:\n" << res << "\n"
+                   << "   Expected result:\n" << exp << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the index range checks of the CompressedSoAMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that a CompressedSoAMatrix refuses sizes that cannot be represented by
+// its index type. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIndexRange()
+{
+   //=====================================================================================
+   // Row-major index range
+   //=====================================================================================
+
+   {
+      test_ = "Row-major CompressedSoAMatrix index range";
+
+      blaze::CompressedSoAMatrix<int,blaze::rowMajor,uint8_t> mat( 300UL, 256UL );
+
+      try {
+         mat.resize( 3UL, 257UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Resizing beyond the range of the index type succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Column-major index range
+   //=====================================================================================
+
+   {
+      test_ = "Column-major CompressedSoAMatrix index range";
+
+      try {
+         blaze::CompressedSoAMatrix<int,blaze::columnMajor,uint8_t> mat( 257UL, 3UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction beyond the range of the index type succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+} // namespace compressedsoamatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running CompressedSoAMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_COMPRESSEDSOAMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during CompressedSoAMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -37,9 +37,11 @@
 // Includes
 //*************************************************************************************************
 
+#include <algorithm>
 #include <cmath>
 #include <cstdlib>
 #include <iostream>
+#include <limits>
 #include <blaze/math/dense/DenseMatrix.h>
 #include <blaze/math/DynamicMatrix.h>
 #include <blaze/math/DynamicVector.h>
@@ -7722,6 +7724,84 @@ void GeneralTest::testSoftmax()
    }
 
 
+   {
+      test_ = "Row-major softmax<rowwise>()";
+
+      blaze::DynamicMatrix<double,blaze::rowMajor> A( 123UL, 257UL );
+      for( size_t i=0UL; i<A.rows(); ++i ) {
+         for( size_t j=0UL; j<A.columns(); ++j ) {
+            A(i,j) = 1000.0 + 10.0*std::sin( 0.37*i + 1.1*j );
+         }
+      }
+
+      const auto B = blaze::softmax<blaze::rowwise>( A );
+
+      for( size_t i=0UL; i<A.rows(); ++i )
+      {
+         double max( A(i,0) );
+         for( size_t j=0UL; j<A.columns(); ++j ) {
+            max = std::max( max, A(i,j) );
+         }
+
+         double scalar( 0.0 );
+         for( size_t j=0UL; j<A.columns(); ++j ) {
+            scalar += std::exp( A(i,j) - max );
+         }
+
+         for( size_t j=0UL; j<A.columns(); ++j ) {
+            if( !std::isfinite( B(i,j) ) || !isEqual( B(i,j), std::exp( A(i,j) - max ) / scalar ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Softmax computation failed\n"
+                   << " Details:\n"
+                   << "   Index: (" << i << "," << j << ")\n"
+                   << "   Result: " << B(i,j) << "\n"
+                   << "   Expected result: " << ( std::exp( A(i,j) - max ) / scalar ) << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+
+   {
+      test_ = "Row-major softmax<columnwise>()";
+
+      blaze::DynamicMatrix<double,blaze::rowMajor> A( 123UL, 257UL );
+      for( size_t i=0UL; i<A.rows(); ++i ) {
+         for( size_t j=0UL; j<A.columns(); ++j ) {
+            A(i,j) = 1000.0 + 10.0*std::sin( 0.37*i + 1.1*j );
+         }
+      }
+
+      const auto B = blaze::softmax<blaze::columnwise>( A );
+
+      for( size_t j=0UL; j<A.columns(); ++j )
+      {
+         double max( A(0,j) );
+         for( size_t i=0UL; i<A.rows(); ++i ) {
+            max = std::max( max, A(i,j) );
+         }
+
+         double scalar( 0.0 );
+         for( size_t i=0UL; i<A.rows(); ++i ) {
+            scalar += std::exp( A(i,j) - max );
+         }
+
+         for( size_t i=0UL; i<A.rows(); ++i ) {
+            if( !std::isfinite( B(i,j) ) || !isEqual( B(i,j), std::exp( A(i,j) - max ) / scalar ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Softmax computation failed\n"
+                   << " Details:\n"
+                   << "   Index: (" << i << "," << j << ")\n"
+                   << "   Result: " << B(i,j) << "\n"
+                   << "   Expected result: " << ( std::exp( A(i,j) - max ) / scalar ) << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+
    //=====================================================================================
    // Column-major matrix tests
    //=====================================================================================
@@ -7748,6 +7828,196 @@ void GeneralTest::testSoftmax()
          throw std::runtime_error( oss.str() );
       }
    }
+
+   {
+      test_ = "Column-major softmax<rowwise>()";
+
+      blaze::DynamicMatrix<double,blaze::columnMajor> A( 123UL, 257UL );
+      for( size_t i=0UL; i<A.rows(); ++i ) {
+         for( size_t j=0UL; j<A.columns(); ++j ) {
+            A(i,j) = 1000.0 + 10.0*std::sin( 0.37*i + 1.1*j );
+         }
+      }
+
+      const auto B = blaze::softmax<blaze::rowwise>( A );
+
+      for( size_t i=0UL; i<A.rows(); ++i )
+      {
+         double max( A(i,0) );
+         for( size_t j=0UL; j<A.columns(); ++j ) {
+            max = std::max( max, A(i,j) );
+         }
+
+         double scalar( 0.0 );
+         for( size_t j=0UL; j<A.columns(); ++j ) {
+            scalar += std::exp( A(i,j) - max );
+         }
+
+         for( size_t j=0UL; j<A.columns(); ++j ) {
+            if( !std::isfinite( B(i,j) ) || !isEqual( B(i,j), std::exp( A(i,j) - max ) / scalar ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Softmax computation failed\n"
+                   << " Details:\n"
+                   << "   Index: (" << i << "," << j << ")\n"
+                   << "   Result: " << B(i,j) << "\n"
+                   << "   Expected result: " << ( std::exp( A(i,j) - max ) / scalar ) << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+
+   {
+      test_ = "Column-major softmax<columnwise>()";
+
+      blaze::DynamicMatrix<double,blaze::columnMajor> A( 123UL, 257UL );
+      for( size_t i=0UL; i<A.rows(); ++i ) {
+         for( size_t j=0UL; j<A.columns(); ++j ) {
+            A(i,j) = 1000.0 + 10.0*std::sin( 0.37*i + 1.1*j );
+         }
+      }
+
+      const auto B = blaze::softmax<blaze::columnwise>( A );
+
+      for( size_t j=0UL; j<A.columns(); ++j )
+      {
+         double max( A(0,j) );
+         for( size_t i=0UL; i<A.rows(); ++i ) {
+            max = std::max( max, A(i,j) );
+         }
+
+         double scalar( 0.0 );
+         for( size_t i=0UL; i<A.rows(); ++i ) {
+            scalar += std::exp( A(i,j) - max );
+         }
+
+         for( size_t i=0UL; i<A.rows(); ++i ) {
+            if( !std::isfinite( B(i,j) ) || !isEqual( B(i,j), std::exp( A(i,j) - max ) / scalar ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Softmax computation failed\n"
+                   << " Details:\n"
+                   << "   Index: (" << i << "," << j << ")\n"
+                   << "   Result: " << B(i,j) << "\n"
+                   << "   Expected result: " << ( std::exp( A(i,j) - max ) / scalar ) << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+
+   {
+      test_ = "Row-major softmax<rowwise>() (negative infinity)";
+
+      const double inf( std::numeric_limits<double>::infinity() );
+
+      blaze::DynamicMatrix<double,blaze::rowMajor> A( 67UL, 41UL );
+      for( size_t i=0UL; i<A.rows(); ++i ) {
+         for( size_t j=0UL; j<A.columns(); ++j ) {
+            A(i,j) = ( j < 9UL || ( i + j ) % 3UL == 0UL ) ? -inf : 10.0*std::sin( 0.37*i + 1.1*j );
+         }
+      }
+      A(0,0) = -inf; A(0,1) = -inf; A(0,2) = 1.0; A(0,3) = 2.0;
+      for( size_t j=4UL; j<A.columns(); ++j ) {
+         A(0,j) = -inf;
+      }
+
+      const auto B = blaze::softmax<blaze::rowwise>( A );
+
+      for( size_t i=0UL; i<A.rows(); ++i )
+      {
+         double max( -inf );
+         for( size_t j=0UL; j<A.columns(); ++j ) {
+            max = std::max( max, A(i,j) );
+         }
+
+         double scalar( 0.0 );
+         for( size_t j=0UL; j<A.columns(); ++j ) {
+            scalar += std::exp( A(i,j) - max );
+         }
+
+         for( size_t j=0UL; j<A.columns(); ++j ) {
+            if( !std::isfinite( B(i,j) ) || !isEqual( B(i,j), std::exp( A(i,j) - max ) / scalar ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Softmax computation failed\n"
+                   << " Details:\n"
+                   << "   Index: (" << i << "," << j << ")\n"
+                   << "   Result: " << B(i,j) << "\n"
+                   << "   Expected result: " << ( std::exp( A(i,j) - max ) / scalar ) << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+
+      if( B(0,0) != 0.0 || B(0,1) != 0.0 ||
+          !isEqual( B(0,2), 0.2689414213699951 ) || !isEqual( B(0,3), 0.7310585786300049 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Softmax computation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << row( B, 0UL ) << "\n"
+             << "   Expected result:\n( 0 0 0.268941 0.731059 0 ... )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major softmax<rowwise>() (negative infinity)";
+
+      const double inf( std::numeric_limits<double>::infinity() );
+
+      blaze::DynamicMatrix<double,blaze::columnMajor> A( 67UL, 41UL );
+      for( size_t i=0UL; i<A.rows(); ++i ) {
+         for( size_t j=0UL; j<A.columns(); ++j ) {
+            A(i,j) = ( j < 9UL || ( i + j ) % 3UL == 0UL ) ? -inf : 10.0*std::sin( 0.37*i + 1.1*j );
+         }
+      }
+      A(0,0) = -inf; A(0,1) = -inf; A(0,2) = 1.0; A(0,3) = 2.0;
+      for( size_t j=4UL; j<A.columns(); ++j ) {
+         A(0,j) = -inf;
+      }
+
+      const auto B = blaze::softmax<blaze::rowwise>( A );
+
+      for( size_t i=0UL; i<A.rows(); ++i )
+      {
+         double max( -inf );
+         for( size_t j=0UL; j<A.columns(); ++j ) {
+            max = std::max( max, A(i,j) );
+         }
+
+         double scalar( 0.0 );
+         for( size_t j=0UL; j<A.columns(); ++j ) {
+            scalar += std::exp( A(i,j) - max );
+         }
+
+         for( size_t j=0UL; j<A.columns(); ++j ) {
+            if( !std::isfinite( B(i,j) ) || !isEqual( B(i,j), std::exp( A(i,j) - max ) / scalar ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Softmax computation failed\n"
+                   << " Details:\n"
+                   << "   Index: (" << i << "," << j << ")\n"
+                   << "   Result: " << B(i,j) << "\n"
+                   << "   Expected result: " << ( std::exp( A(i,j) - max ) / scalar ) << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+
+      if( B(0,0) != 0.0 || B(0,1) != 0.0 ||
+          !isEqual( B(0,2), 0.2689414213699951 ) || !isEqual( B(0,3), 0.7310585786300049 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Softmax computation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << row( B, 0UL ) << "\n"
+             << "   Expected result:\n( 0 0 0.268941 0.731059 0 ... )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
 }
 //*************************************************************************************************
 
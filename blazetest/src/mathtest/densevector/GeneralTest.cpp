@@ -37,9 +37,11 @@
 // Includes
 //*************************************************************************************************
 
+#include <algorithm>
 #include <cmath>
 #include <cstdlib>
 #include <iostream>
+#include <limits>
 #include <blaze/math/dense/DenseVector.h>
 #include <blaze/math/DynamicVector.h>
 #include <blaze/math/StaticVector.h>
@@ -1568,25 +1570,128 @@ void GeneralTest::testStdDev()
 */
 void GeneralTest::testSoftmax()
 {
-   test_ = "softmax() function";
+   {
+      test_ = "softmax() function";
 
-   blaze::DynamicVector<double,blaze::rowVector> a( 4UL );
-   randomize( a, -5.0, 5.0 );
+      blaze::DynamicVector<double,blaze::rowVector> a( 4UL );
+      randomize( a, -5.0, 5.0 );
 
-   const auto b = softmax( a );
+      const auto b = softmax( a );
 
-   if( b[0] <= 0.0 || b[0] > 1.0 ||
-       b[1] <= 0.0 || b[1] > 1.0 ||
-       b[2] <= 0.0 || b[2] > 1.0 ||
-       b[3] <= 0.0 || b[3] > 1.0 ||
-       !isEqual( sum( b ), 1.0 ) ) {
-      std::ostringstream oss;
-      oss << " Test: " << test_ << "\n"
-          << " Error: Softmax computation failed\n"
-          << " Details:\n"
-          << "   Result: " << sum( b ) << "\n"
-          << "   Expected result: 1\n";
-      throw std::runtime_error( oss.str() );
+      if( b[0] <= 0.0 || b[0] > 1.0 ||
+          b[1] <= 0.0 || b[1] > 1.0 ||
+          b[2] <= 0.0 || b[2] > 1.0 ||
+          b[3] <= 0.0 || b[3] > 1.0 ||
+          !isEqual( sum( b ), 1.0 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Softmax computation failed\n"
+             << " Details:\n"
+             << "   Result: " << sum( b ) << "\n"
+             << "   Expected result: 1\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "softmax() function (large elements)";
+
+      blaze::DynamicVector<double,blaze::columnVector> a( 1037UL );
+      for( size_t i=0UL; i<a.size(); ++i ) {
+         a[i] = 1000.0 + 10.0*std::sin( 0.37*i );
+      }
+
+      const auto b = softmax( a );
+
+      double max( a[0] );
+      for( size_t i=1UL; i<a.size(); ++i ) {
+         max = std::max( max, a[i] );
+      }
+
+      double scalar( 0.0 );
+      for( size_t i=0UL; i<a.size(); ++i ) {
+         scalar += std::exp( a[i] - max );
+      }
+
+      for( size_t i=0UL; i<a.size(); ++i ) {
+         if( !std::isfinite( b[i] ) || !isEqual( b[i], std::exp( a[i] - max ) / scalar ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Softmax computation failed\n"
+                << " Details:\n"
+                << "   Index: " << i << "\n"
+                << "   Result: " << b[i] << "\n"
+                << "   Expected result: " << ( std::exp( a[i] - max ) / scalar ) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      if( !isEqual( sum( b ), 1.0 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Softmax computation failed\n"
+             << " Details:\n"
+             << "   Result: " << sum( b ) << "\n"
+             << "   Expected result: 1\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "softmax() function (negative infinity)";
+
+      const double inf( std::numeric_limits<double>::infinity() );
+
+      blaze::DynamicVector<double,blaze::rowVector> a{ -inf, -inf, 1.0, 2.0 };
+
+      const auto b = softmax( a );
+
+      if( b[0] != 0.0 || b[1] != 0.0 ||
+          !isEqual( b[2], 0.2689414213699951 ) || !isEqual( b[3], 0.7310585786300049 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Softmax computation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << b << "\n"
+             << "   Expected result:\n( 0 0 0.268941 0.731059 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "softmax() function (negative infinity, large vector)";
+
+      const double inf( std::numeric_limits<double>::infinity() );
+
+      blaze::DynamicVector<double,blaze::columnVector> a( 1037UL );
+      for( size_t i=0UL; i<a.size(); ++i ) {
+         a[i] = ( i < 77UL || i % 3UL == 0UL ) ? -inf : 10.0*std::sin( 0.37*i );
+      }
+
+      const auto b = softmax( a );
+
+      double max( -inf );
+      for( size_t i=0UL; i<a.size(); ++i ) {
+         max = std::max( max, a[i] );
+      }
+
+      double scalar( 0.0 );
+      for( size_t i=0UL; i<a.size(); ++i ) {
+         scalar += std::exp( a[i] - max );
+      }
+
+      for( size_t i=0UL; i<a.size(); ++i ) {
+         if( !std::isfinite( b[i] ) || !isEqual( b[i], std::exp( a[i] - max ) / scalar ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Softmax computation failed\n"
+                << " Details:\n"
+                << "   Index: " << i << "\n"
+                << "   Result: " << b[i] << "\n"
+                << "   Expected result: " << ( std::exp( a[i] - max ) / scalar ) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
    }
 }
 //*************************************************************************************************
@@ -0,0 +1,478 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/dispatch/ClassTest.cpp
+//  \brief Source file for the runtime dispatch test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#ifndef BLAZE_USE_RUNTIME_DISPATCH
+#  define BLAZE_USE_RUNTIME_DISPATCH 1
+#endif
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <blaze/math/Dispatch.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/dispatch/ClassTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace dispatch {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the runtime dispatch test.
+//
+// \exception std::runtime_error Operation error detected.
+//
+// In case the runtime dispatch mode is not active (see the BLAZE_RUNTIME_DISPATCH_MODE macro)
+// the kernels are selected at compile time and no tests are performed.
+*/
+ClassTest::ClassTest()
+{
+#if BLAZE_RUNTIME_DISPATCH_MODE
+   testInstructionSet();
+
+   const blaze::InstructionSet initial( blaze::getInstructionSet() );
+
+   const blaze::InstructionSet sets[] = { blaze::InstructionSet::sse2,
+                                          blaze::InstructionSet::avx2,
+                                          blaze::InstructionSet::avx512f };
+
+   for( blaze::InstructionSet is : sets )
+   {
+      if( !blaze::isSupported( is ) )
+         continue;
+
+      blaze::setInstructionSet( is );
+
+      std::ostringstream oss;
+      oss << is;
+      isa_ = oss.str();
+
+      testMultiplication<float>();
+      testMultiplication<double>();
+      testGemv<float>();
+      testGemv<double>();
+      testReduction<float>();
+      testReduction<double>();
+      testAssignment<float>();
+      testAssignment<double>();
+   }
+
+   blaze::setInstructionSet( initial );
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+#if BLAZE_RUNTIME_DISPATCH_MODE
+
+//*************************************************************************************************
+/*!\brief Test of the selection of the instruction set.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the getInstructionSet() and setInstructionSet() functions. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testInstructionSet()
+{
+   test_ = "Selection of the instruction set";
+
+   const blaze::InstructionSet detected( blaze::detectInstructionSet() );
+
+   if( !blaze::isSupported( blaze::InstructionSet::sse2 ) || !blaze::isSupported( detected ) ||
+       !blaze::isSupported( blaze::getInstructionSet() ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid instruction set detected\n"
+          << " Details:\n"
+          << "   Detected instruction set: " << detected << "\n"
+          << "   Selected instruction set: " << blaze::getInstructionSet() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   const blaze::InstructionSet initial( blaze::getInstructionSet() );
+
+   blaze::setInstructionSet( blaze::InstructionSet::sse2 );
+
+   if( blaze::getInstructionSet() != blaze::InstructionSet::sse2 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Selecting the SSE2 instruction set failed\n"
+          << " Details:\n"
+          << "   Selected instruction set: " << blaze::getInstructionSet() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   if( detected != blaze::InstructionSet::avx512f )
+   {
+      try {
+         blaze::setInstructionSet( blaze::InstructionSet::avx512f );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Selecting an unsupported instruction set succeeded\n"
+             << " Details:\n"
+             << "   Detected instruction set: " << detected << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   blaze::setInstructionSet( initial );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the dispatched dense matrix multiplication kernel.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the dense matrix multiplication with the currently selected instruction
+// set for several matrix sizes that are no multiples of the micro-tile sizes. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename T >  // Element type
+void ClassTest::testMultiplication()
+{
+   test_ = "Dispatched dense matrix multiplication";
+
+   const size_t sizes[] = { 1UL, 7UL, 33UL, 131UL, 301UL };
+
+   BLAZE_SERIAL_SECTION
+   {
+      for( size_t n : sizes )
+      {
+         blaze::DynamicMatrix<T,blaze::rowMajor> A( n, n+5UL ), B( n+5UL, n+2UL ), C, R( n, n+2UL, T(0) );
+         blaze::DynamicMatrix<T,blaze::columnMajor> TA( n, n+5UL ), D;
+         initialize( A );
+         initialize( B );
+         TA = A;
+
+         for( size_t i=0UL; i<A.rows(); ++i )
+            for( size_t k=0UL; k<A.columns(); ++k )
+               for( size_t j=0UL; j<B.columns(); ++j )
+                  R(i,j) += A(i,k) * B(k,j);
+
+         C = A * B;
+         checkMatrix( C, R );
+
+         D = TA * B;
+         checkMatrix( D, R );
+
+         C += A * B;
+         R *= T(2);
+         checkMatrix( C, R );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the dispatched dense matrix/dense vector multiplication kernels.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the assignment, addition assignment, and subtraction assignment of both
+// plain and scaled row-major and column-major dense matrix/dense vector multiplications with
+// the currently selected instruction set. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename T >  // Element type
+void ClassTest::testGemv()
+{
+   test_ = "Dispatched dense matrix/dense vector multiplication";
+
+   const size_t sizes[] = { 1UL, 5UL, 19UL, 64UL, 203UL };
+
+   BLAZE_SERIAL_SECTION
+   {
+      for( size_t m : sizes )
+      {
+         const size_t n( m + 3UL );
+
+         blaze::DynamicMatrix<T,blaze::rowMajor> A( m, n );
+         blaze::DynamicMatrix<T,blaze::columnMajor> TA( m, n );
+         blaze::DynamicVector<T,blaze::columnVector> x( n ), z( m ), y1( m ), y2( m ), ref( m, T(0) );
+         initialize( A );
+         initialize( x );
+         initialize( z );
+         TA = A;
+
+         for( size_t i=0UL; i<m; ++i )
+            for( size_t j=0UL; j<n; ++j )
+               ref[i] += A(i,j) * x[j];
+
+         y1 = A * x;
+         y2 = TA * x;
+         checkVector( y1, ref );
+         checkVector( y2, ref );
+
+         y1 = z;
+         y2 = z;
+         y1 += A * x;
+         y2 += TA * x;
+         checkVector( y1, z + ref );
+         checkVector( y2, z + ref );
+
+         y1 = z;
+         y2 = z;
+         y1 -= A * x;
+         y2 -= TA * x;
+         checkVector( y1, z - ref );
+         checkVector( y2, z - ref );
+
+         y1 = T(3) * ( A * x );
+         y2 = T(3) * ( TA * x );
+         checkVector( y1, ref * T(3) );
+         checkVector( y2, ref * T(3) );
+
+         y1 = z;
+         y2 = z;
+         y1 += T(2) * ( A * x );
+         y2 += T(2) * ( TA * x );
+         checkVector( y1, z + ref * T(2) );
+         checkVector( y2, z + ref * T(2) );
+
+         y1 = z;
+         y2 = z;
+         y1 -= T(2) * ( A * x );
+         y2 -= T(2) * ( TA * x );
+         checkVector( y1, z - ref * T(2) );
+         checkVector( y2, z - ref * T(2) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the dispatched reduction and inner product kernels.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the summation of dense vectors and subvectors as well as the inner
+// product of two dense vectors with the currently selected instruction set. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename T >  // Element type
+void ClassTest::testReduction()
+{
+   test_ = "Dispatched reduction and inner product";
+
+   const size_t sizes[] = { 1UL, 3UL, 17UL, 64UL, 1001UL };
+
+   BLAZE_SERIAL_SECTION
+   {
+      for( size_t n : sizes )
+      {
+         blaze::DynamicVector<T,blaze::rowVector> a( n ), b( n );
+         initialize( a );
+         initialize( b );
+
+         T sum( 0 ), subsum( 0 ), dot( 0 );
+         for( size_t i=0UL; i<n; ++i ) {
+            sum += a[i];
+            dot += a[i] * b[i];
+            if( i > 0UL ) subsum += a[i];
+         }
+
+         checkScalar( blaze::sum( a ), sum );
+         checkScalar( blaze::sum( blaze::subvector( a, 1UL, n-1UL ) ), subsum );
+         checkScalar( a * blaze::trans( b ), dot );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the dispatched dense vector assignment kernels.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the assignment, addition assignment, and subtraction assignment of dense
+// vectors with the currently selected instruction set. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename T >  // Element type
+void ClassTest::testAssignment()
+{
+   test_ = "Dispatched dense vector assignment";
+
+   const size_t sizes[] = { 1UL, 7UL, 31UL, 256UL, 4099UL };
+
+   BLAZE_SERIAL_SECTION
+   {
+      for( size_t n : sizes )
+      {
+         blaze::DynamicVector<T,blaze::columnVector> a( n ), b( n ), c, ref( n );
+         initialize( a );
+         initialize( b );
+
+         c = a;
+         checkVector( c, a );
+
+         for( size_t i=0UL; i<n; ++i )
+            ref[i] = a[i] + b[i];
+
+         c += b;
+         checkVector( c, ref );
+
+         c -= a;
+         checkVector( c, b );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization of the given dense matrix with small random integral values.
+//
+// \param m The dense matrix to be initialized.
+// \return void
+//
+// Small integral values are represented exactly by both single and double precision floating
+// point values. Therefore the results of the dispatched kernels don't depend on the order of the
+// summation and can be compared with the results of the reference loops.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void ClassTest::initialize( blaze::DenseMatrix<MT,SO>& m )
+{
+   using ET = blaze::ElementType_t<MT>;
+
+   for( size_t i=0UL; i<(~m).rows(); ++i )
+      for( size_t j=0UL; j<(~m).columns(); ++j )
+         (~m)(i,j) = ET( blaze::rand<int>( -3, 3 ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of the given dense vector with small random integral values.
+//
+// \param v The dense vector to be initialized.
+// \return void
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag of the dense vector
+void ClassTest::initialize( blaze::DenseVector<VT,TF>& v )
+{
+   using ET = blaze::ElementType_t<VT>;
+
+   for( size_t i=0UL; i<(~v).size(); ++i )
+      (~v)[i] = ET( blaze::rand<int>( -3, 3 ) );
+}
+//*************************************************************************************************
+
+#endif
+
+} // namespace dispatch
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running runtime dispatch test..." << std::endl;
+
+   try
+   {
+      RUN_DISPATCH_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during runtime dispatch test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
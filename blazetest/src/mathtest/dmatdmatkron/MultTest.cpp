@@ -0,0 +1,591 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/dmatdmatkron/MultTest.cpp
+//  \brief Source file for the Kronecker product multiplication test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <array>
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/expressions/KronDMatMultExpr.h>
+#include <blaze/math/expressions/KronDVecMultExpr.h>
+#include <blaze/math/Views.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/RemoveCVRef.h>
+#include <blazetest/mathtest/dmatdmatkron/MultTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace dmatdmatkron {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the Kronecker product multiplication test class.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+MultTest::MultTest()
+{
+   testExpressionType();
+   testVectorMult();
+   testMatrixMult();
+   testChain();
+   testElementAccess();
+   testViews();
+   testAliasing();
+   testSizeMismatch();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the type of the multiplication expressions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the multiplication of a Kronecker product with a dense vector or
+// dense matrix results in the according Kronecker multiplication expression instead of a
+// multiplication with the Kronecker product. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void MultTest::testExpressionType()
+{
+   using blaze::IsSame_v;
+   using blaze::KronDMatMultExpr;
+   using blaze::KronDVecMultExpr;
+   using blaze::RemoveCVRef_t;
+
+   test_ = "Expression type";
+
+   DMat A, B;
+   TSMat S;
+   DVec x;
+   TDMat C;
+
+   using KronAB  = RemoveCVRef_t< decltype( kron( A, B ) ) >;
+   using KronAS  = RemoveCVRef_t< decltype( kron( A, S ) ) >;
+   using KronSAB = RemoveCVRef_t< decltype( kron( S, kron( A, B ) ) ) >;
+
+   if( !IsSame_v< RemoveCVRef_t< decltype( kron( A, B ) * x ) >, KronDVecMultExpr<KronAB,DVec> > ||
+       !IsSame_v< RemoveCVRef_t< decltype( kron( A, S ) * x ) >, KronDVecMultExpr<KronAS,DVec> > ||
+       !IsSame_v< RemoveCVRef_t< decltype( kron( S, kron( A, B ) ) * x ) >, KronDVecMultExpr<KronSAB,DVec> > ||
+       !IsSame_v< RemoveCVRef_t< decltype( kron( A, B ) * C ) >, KronDMatMultExpr<KronAB,TDMat,blaze::rowMajor> > ||
+       !IsSame_v< RemoveCVRef_t< decltype( kron( A, S ) * C ) >, KronDMatMultExpr<KronAS,TDMat,blaze::columnMajor> > ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid expression type detected\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the multiplication of Kronecker products with dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the multiplication of Kronecker products of dense and sparse factors of
+// various sizes with dense vectors. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void MultTest::testVectorMult()
+{
+   DMat dA, dB;
+   TDMat tdA, tdB;
+   SMat sA, sB;
+   TSMat tsA, tsB;
+
+   const std::array< std::array<size_t,4UL>, 5UL > sizes{ { { 2UL, 3UL, 3UL, 2UL },
+                                                            { 1UL, 4UL, 3UL, 1UL },
+                                                            { 5UL, 2UL, 1UL, 6UL },
+                                                            { 7UL, 5UL, 4UL, 9UL },
+                                                            { 2UL, 0UL, 3UL, 2UL } } };
+
+   for( const auto& s : sizes )
+   {
+      initialize( dA , s[0], s[1], 1 );
+      initialize( tdA, s[0], s[1], 1 );
+      initialize( sA , s[0], s[1], 1 );
+      initialize( tsA, s[0], s[1], 1 );
+      initialize( dB , s[2], s[3], 2 );
+      initialize( tdB, s[2], s[3], 2 );
+      initialize( sB , s[2], s[3], 2 );
+      initialize( tsB, s[2], s[3], 2 );
+
+      test_ = "kron(DMat,DMat)*DVec";
+      testVector( dA, dB );
+
+      test_ = "kron(TDMat,DMat)*DVec";
+      testVector( tdA, dB );
+
+      test_ = "kron(DMat,TSMat)*DVec";
+      testVector( dA, tsB );
+
+      test_ = "kron(SMat,TDMat)*DVec";
+      testVector( sA, tdB );
+
+      test_ = "kron(SMat,SMat)*DVec";
+      testVector( sA, sB );
+
+      test_ = "kron(TSMat,SMat)*DVec";
+      testVector( tsA, sB );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the multiplication of Kronecker products with dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the multiplication of Kronecker products of dense and sparse factors of
+// various sizes with row-major and column-major dense matrices. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+void MultTest::testMatrixMult()
+{
+   DMat dA, dB, dC;
+   TDMat tdA, tdC;
+   SMat sB;
+   TSMat tsA, tsB;
+
+   const std::array< std::array<size_t,5UL>, 5UL > sizes{ { { 2UL, 3UL, 3UL, 2UL, 4UL },
+                                                            { 1UL, 4UL, 3UL, 1UL, 1UL },
+                                                            { 5UL, 2UL, 1UL, 6UL, 3UL },
+                                                            { 4UL, 5UL, 6UL, 3UL, 7UL },
+                                                            { 2UL, 0UL, 3UL, 2UL, 2UL } } };
+
+   for( const auto& s : sizes )
+   {
+      initialize( dA , s[0], s[1], 1 );
+      initialize( tdA, s[0], s[1], 1 );
+      initialize( tsA, s[0], s[1], 1 );
+      initialize( dB , s[2], s[3], 2 );
+      initialize( sB , s[2], s[3], 2 );
+      initialize( tsB, s[2], s[3], 2 );
+      initialize( dC , s[1]*s[3], s[4], 3 );
+      initialize( tdC, s[1]*s[3], s[4], 3 );
+
+      test_ = "kron(DMat,DMat)*DMat";
+      testMatrix( dA, dB, dC );
+
+      test_ = "kron(DMat,DMat)*TDMat";
+      testMatrix( dA, dB, tdC );
+
+      test_ = "kron(TDMat,SMat)*DMat";
+      testMatrix( tdA, sB, dC );
+
+      test_ = "kron(TSMat,DMat)*TDMat";
+      testMatrix( tsA, dB, tdC );
+
+      test_ = "kron(TSMat,TSMat)*DMat";
+      testMatrix( tsA, tsB, dC );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the multiplication of chains of Kronecker products.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the multiplication of Kronecker products of three and four factors with
+// dense vectors and dense matrices. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void MultTest::testChain()
+{
+   DMat A, D;
+   TSMat B;
+   TDMat C;
+
+   initialize( A, 2UL, 3UL, 1 );
+   initialize( B, 3UL, 2UL, 2 );
+   initialize( C, 2UL, 4UL, 3 );
+   initialize( D, 3UL, 1UL, 4 );
+
+   {
+      test_ = "kron(kron(A,B),C)";
+
+      testVector( kron( A, B ), C );
+
+      TDMat E;
+      initialize( E, 24UL, 3UL, 5 );
+      testMatrix( kron( A, B ), C, E );
+   }
+
+   {
+      test_ = "kron(A,kron(B,C))";
+
+      testVector( A, kron( B, C ) );
+
+      DMat E;
+      initialize( E, 24UL, 2UL, 6 );
+      testMatrix( A, kron( B, C ), E );
+   }
+
+   {
+      test_ = "kron(kron(A,B),kron(C,D))";
+
+      const DMat K( kron( kron( A, B ), kron( C, D ) ) );
+
+      DVec x;
+      initialize( x, K.columns(), 7 );
+
+      DVec res( kron( kron( A, B ), kron( C, D ) ) * x );
+      checkResult( res, K * x );
+
+      TDMat E;
+      initialize( E, K.columns(), 3UL, 8 );
+
+      DMat Res( kron( kron( A, B ), kron( C, D ) ) * E );
+      checkResult( Res, K * E );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the element access and the reduction of the multiplication expressions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the subscript operator, the function call operator, and the at()
+// functions of the multiplication expressions and their use in reduction operations. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void MultTest::testElementAccess()
+{
+   DMat A;
+   TSMat B;
+   TDMat C;
+   DVec x;
+
+   initialize( A, 2UL, 3UL, 1 );
+   initialize( B, 3UL, 2UL, 2 );
+   initialize( C, 6UL, 4UL, 3 );
+   initialize( x, 6UL, 4 );
+
+   const DMat K( kron( A, B ) );
+   const DVec y( K * x );
+   const DMat Y( K * C );
+
+   {
+      test_ = "Element access of kron(A,B)*x";
+
+      for( size_t i=0UL; i<y.size(); ++i ) {
+         checkResult( ( kron( A, B ) * x )[i], y[i] );
+         checkResult( ( kron( A, B ) * x ).at(i), y[i] );
+      }
+
+      try {
+         ( kron( A, B ) * x ).at( y.size() );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Out-of-bounds access not detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::out_of_range& ) {}
+   }
+
+   {
+      test_ = "Element access of kron(A,B)*C";
+
+      for( size_t i=0UL; i<Y.rows(); ++i ) {
+         for( size_t j=0UL; j<Y.columns(); ++j ) {
+            checkResult( ( kron( A, B ) * C )(i,j), Y(i,j) );
+            checkResult( ( kron( A, B ) * C ).at(i,j), Y(i,j) );
+         }
+      }
+   }
+
+   {
+      test_ = "Reduction of kron(A,B)*x";
+
+      checkResult( sum( kron( A, B ) * x ), sum( y ) );
+      checkResult( max( kron( A, B ) * x ), max( y ) );
+      checkResult( ( trans( x ) * ( kron( A, B ) * x ) ), ( trans( x ) * y ) );
+   }
+
+   {
+      test_ = "Reduction of kron(A,B)*C";
+
+      checkResult( sum( kron( A, B ) * C ), sum( Y ) );
+      checkResult( DVec( blaze::sum<blaze::rowwise>( kron( A, B ) * C ) ), DVec( blaze::sum<blaze::rowwise>( Y ) ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of views on the multiplication expressions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests views on the multiplication expressions and the combination of the
+// expressions with matrices of different storage order. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void MultTest::testViews()
+{
+   DMat A;
+   SMat B;
+   DMat C;
+   TDMat D;
+   DVec x;
+
+   initialize( A, 2UL, 3UL, 1 );
+   initialize( B, 3UL, 2UL, 2 );
+   initialize( C, 6UL, 4UL, 3 );
+   initialize( D, 6UL, 4UL, 4 );
+   initialize( x, 6UL, 5 );
+
+   const DMat K( kron( A, B ) );
+   const DVec y( K * x );
+   const DMat Y( K * C );
+
+   {
+      test_ = "Views on kron(A,B)*x";
+
+      checkResult( subvector( kron( A, B ) * x, 1UL, 4UL ), subvector( y, 1UL, 4UL ) );
+      checkResult( blaze::subvector<2UL,3UL>( kron( A, B ) * x ), blaze::subvector<2UL,3UL>( y ) );
+      checkResult( elements( kron( A, B ) * x, { 5UL, 0UL, 3UL } ), elements( y, { 5UL, 0UL, 3UL } ) );
+
+      try {
+         DVec res( subvector( kron( A, B ) * x, 4UL, 3UL ) );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid subvector specification not detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Views on kron(A,B)*C";
+
+      checkResult( submatrix( kron( A, B ) * C, 1UL, 1UL, 4UL, 2UL ), submatrix( Y, 1UL, 1UL, 4UL, 2UL ) );
+      checkResult( row( kron( A, B ) * C, 3UL ), row( Y, 3UL ) );
+      checkResult( rows( kron( A, B ) * C, { 4UL, 1UL } ), rows( Y, { 4UL, 1UL } ) );
+      checkResult( column( kron( A, B ) * C, 2UL ), column( Y, 2UL ) );
+      checkResult( columns( kron( A, B ) * C, { 3UL, 0UL } ), columns( Y, { 3UL, 0UL } ) );
+   }
+
+   {
+      test_ = "Mixed storage orders with kron(A,B)*C";
+
+      const TDMat ref( D - Y );
+
+      TDMat res1( D - kron( A, B ) * C );
+      checkResult( res1, ref );
+
+      DMat res2( D - kron( A, B ) * C );
+      checkResult( res2, ref );
+
+      TDMat res3( D );
+      res3 -= kron( A, B ) * C;
+      checkResult( res3, ref );
+
+      DMat res4( kron( A, B ) * D + C );
+      checkResult( res4, K * D + C );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the aliasing of the target with the right-hand side operand.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the multiplication of Kronecker products with a vector or matrix that is
+// also the target of the assignment. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void MultTest::testAliasing()
+{
+   DMat A;
+   SMat B;
+
+   initialize( A, 3UL, 3UL, 1 );
+   initialize( B, 2UL, 2UL, 2 );
+
+   const DMat K( kron( A, B ) );
+
+   {
+      test_ = "Aliasing with a dense vector";
+
+      DVec x;
+      initialize( x, 6UL, 3 );
+
+      const DVec ref( K * x );
+
+      x = kron( A, B ) * x;
+      checkResult( x, ref );
+   }
+
+   {
+      test_ = "Aliasing with a dense matrix";
+
+      DMat C;
+      initialize( C, 6UL, 6UL, 4 );
+
+      const DMat ref( K * C );
+
+      C = kron( A, B ) * C;
+      checkResult( C, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the detection of non-matching sizes.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the multiplication of a Kronecker product with a vector or matrix
+// of non-matching size results in a \a std::invalid_argument exception. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void MultTest::testSizeMismatch()
+{
+   DMat A, B;
+   initialize( A, 2UL, 3UL, 1 );
+   initialize( B, 3UL, 2UL, 2 );
+
+   {
+      test_ = "Size mismatch with a dense vector";
+
+      DVec x;
+      initialize( x, 5UL, 3 );
+
+      try {
+         DVec res( kron( A, B ) * x );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Non-matching sizes not detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Size mismatch with a dense matrix";
+
+      DMat C;
+      initialize( C, 5UL, 2UL, 4 );
+
+      try {
+         DMat res( kron( A, B ) * C );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Non-matching sizes not detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+} // namespace dmatdmatkron
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running Kronecker product multiplication test..." << std::endl;
+
+   try
+   {
+      RUN_DMATDMATKRON_MULT_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during Kronecker product multiplication test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
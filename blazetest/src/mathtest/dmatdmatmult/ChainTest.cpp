@@ -0,0 +1,490 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/dmatdmatmult/ChainTest.cpp
+//  \brief Source file for the dense matrix/dense matrix multiplication chain test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <array>
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/dmatdmatmult/ChainTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace dmatdmatmult {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the chain test class.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ChainTest::ChainTest()
+{
+   testSelection ();
+   testDenseChain();
+   testMixedChain();
+   testLongChain ();
+   testAliasing  ();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the selection of the evaluation order.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the compile time evaluation of the chain length and the runtime selection
+// of the rotation of a chain. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void ChainTest::testSelection()
+{
+   using blaze::MatMatMultChainFactor;
+   using blaze::MatMatMultChainLength_v;
+   using blaze::selectMatMatMultRotation;
+
+
+   //=====================================================================================
+   // Chain length
+   //=====================================================================================
+
+   {
+      test_ = "Chain length";
+
+      DMat A, B, C, D;
+      TSMat S;
+
+      if( MatMatMultChainLength_v< decltype( A*B ) > != 2UL ||
+          MatMatMultChainLength_v< decltype( A*B*C ) > != 3UL ||
+          MatMatMultChainLength_v< decltype( A*(B*C)*D ) > != 4UL ||
+          MatMatMultChainLength_v< decltype( S*A*(B*S) ) > != 4UL ||
+          MatMatMultChainLength_v< DMat > != 1UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid chain length detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Rotation of dense chains
+   //=====================================================================================
+
+   {
+      test_ = "Rotation of dense chains";
+
+      const auto dense = []( size_t m, size_t n ) {
+         MatMatMultChainFactor f;
+         f.rows     = m;
+         f.columns  = n;
+         f.nonZeros = double( m*n );
+         return f;
+      };
+
+      const std::array<MatMatMultChainFactor,3UL> cheapLeft { dense( 10UL, 100UL ), dense( 100UL, 5UL ), dense( 5UL, 50UL ) };
+      const std::array<MatMatMultChainFactor,3UL> cheapRight{ dense( 50UL, 5UL ), dense( 5UL, 100UL ), dense( 100UL, 10UL ) };
+
+      const std::array<size_t,3UL> one{ 1UL };
+      const std::array<size_t,3UL> two{ 2UL };
+
+      // (A*B)*C and A*(B*C) with (A*B)*C being the cheaper order
+      if( selectMatMatMultRotation( cheapLeft, 2UL, one, 1UL, two, 0UL ) != 0 ||
+          selectMatMatMultRotation( cheapLeft, 1UL, one, 0UL, two, 1UL ) != 1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid rotation for a left-associative chain detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      // (A*B)*C and A*(B*C) with A*(B*C) being the cheaper order
+      if( selectMatMatMultRotation( cheapRight, 2UL, one, 1UL, two, 0UL ) != -1 ||
+          selectMatMatMultRotation( cheapRight, 1UL, one, 0UL, two, 1UL ) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid rotation for a right-associative chain detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      // ((A*B)*C)*D with the optimal split after the first factor
+      const std::array<MatMatMultChainFactor,4UL> chain{ dense( 100UL, 100UL ), dense( 100UL, 100UL ),
+                                                         dense( 100UL, 100UL ), dense( 100UL, 1UL ) };
+      const std::array<size_t,4UL> left { 2UL, 1UL };
+      const std::array<size_t,4UL> right{};
+
+      if( selectMatMatMultRotation( chain, 3UL, left, 2UL, right, 0UL ) != -1 ||
+          selectMatMatMultRotation( chain, 1UL, right, 0UL, right, 0UL ) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid rotation for a chain of four factors detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Rotation of sparse chains
+   //=====================================================================================
+
+   {
+      test_ = "Rotation of sparse chains";
+
+      MatMatMultChainFactor S;
+      S.rows     = 1000UL;
+      S.columns  = 1000UL;
+      S.nonZeros = 2000.0;
+      S.sparse   = true;
+
+      MatMatMultChainFactor D;
+      D.rows     = 1000UL;
+      D.columns  = 50UL;
+      D.nonZeros = 50000.0;
+
+      MatMatMultChainFactor E;
+      E.rows     = 50UL;
+      E.columns  = 1000UL;
+      E.nonZeros = 50000.0;
+
+      const std::array<size_t,3UL> one{ 1UL };
+      const std::array<size_t,3UL> two{ 2UL };
+
+      // (S*D)*E is cheaper than S*(D*E) due to the sparsity of S
+      const std::array<MatMatMultChainFactor,3UL> chain1{ S, D, E };
+
+      if( selectMatMatMultRotation( chain1, 2UL, one, 1UL, two, 0UL ) != 0 ||
+          selectMatMatMultRotation( chain1, 1UL, one, 0UL, two, 1UL ) != 1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid rotation for a sparse left-hand side factor detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      // D*(E*S) is cheaper than (D*E)*S due to the sparsity of S
+      const std::array<MatMatMultChainFactor,3UL> chain2{ D, E, S };
+
+      if( selectMatMatMultRotation( chain2, 2UL, one, 1UL, two, 0UL ) != -1 ||
+          selectMatMatMultRotation( chain2, 1UL, one, 0UL, two, 1UL ) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid rotation for a sparse right-hand side factor detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of dense matrix multiplication chains.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests chains of three dense matrices of all storage order combinations, both
+// with sizes that favor the left-to-right and the right-to-left evaluation order. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ChainTest::testDenseChain()
+{
+   DMat  dA, dB, dC;
+   TDMat tdA, tdB, tdC;
+
+   for( size_t order=0UL; order<2UL; ++order )
+   {
+      // Order 0 favors A*(B*C), order 1 favors (A*B)*C
+      const size_t m( order ? 2UL : 9UL );
+      const size_t k( 6UL );
+      const size_t l( 8UL );
+      const size_t n( order ? 9UL : 2UL );
+
+      initialize( dA, m, k, 1 );
+      initialize( dB, k, l, 2 );
+      initialize( dC, l, n, 3 );
+      initialize( tdA, m, k, 1 );
+      initialize( tdB, k, l, 2 );
+      initialize( tdC, l, n, 3 );
+
+      test_ = "DMat*DMat*DMat";
+      testChain( dA, dB, dC );
+
+      test_ = "DMat*DMat*TDMat";
+      testChain( dA, dB, tdC );
+
+      test_ = "DMat*TDMat*DMat";
+      testChain( dA, tdB, dC );
+
+      test_ = "DMat*TDMat*TDMat";
+      testChain( dA, tdB, tdC );
+
+      test_ = "TDMat*DMat*DMat";
+      testChain( tdA, dB, dC );
+
+      test_ = "TDMat*DMat*TDMat";
+      testChain( tdA, dB, tdC );
+
+      test_ = "TDMat*TDMat*DMat";
+      testChain( tdA, tdB, dC );
+
+      test_ = "TDMat*TDMat*TDMat";
+      testChain( tdA, tdB, tdC );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of mixed dense and sparse matrix multiplication chains.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests chains of dense and sparse matrices, both with sizes that favor the
+// left-to-right and the right-to-left evaluation order. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ChainTest::testMixedChain()
+{
+   DMat  dA, dB, dC;
+   TDMat tdA, tdC;
+   SMat  sA, sB, sC;
+   TSMat tsB, tsC;
+
+   for( size_t order=0UL; order<2UL; ++order )
+   {
+      // Order 0 favors A*(B*C), order 1 favors (A*B)*C
+      const size_t m( order ? 2UL : 12UL );
+      const size_t k( 10UL );
+      const size_t l( 11UL );
+      const size_t n( order ? 12UL : 2UL );
+
+      initialize( dA , m, k, 1 );
+      initialize( tdA, m, k, 1 );
+      initialize( sA , m, k, 1 );
+      initialize( dB , k, l, 2 );
+      initialize( sB , k, l, 2 );
+      initialize( tsB, k, l, 2 );
+      initialize( dC , l, n, 3 );
+      initialize( tdC, l, n, 3 );
+      initialize( sC , l, n, 3 );
+      initialize( tsC, l, n, 3 );
+
+      test_ = "SMat*DMat*DMat";
+      testChain( sA, dB, dC );
+
+      test_ = "DMat*SMat*DMat";
+      testChain( dA, sB, dC );
+
+      test_ = "DMat*DMat*SMat";
+      testChain( dA, dB, sC );
+
+      test_ = "TDMat*TSMat*TDMat";
+      testChain( tdA, tsB, tdC );
+
+      test_ = "DMat*TSMat*TSMat";
+      testChain( dA, tsB, tsC );
+
+      test_ = "SMat*SMat*DMat";
+      testChain( sA, sB, dC );
+
+      test_ = "SMat*DMat*TSMat";
+      testChain( sA, dB, tsC );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of longer matrix multiplication chains.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests chains of four and five matrices, whose optimal evaluation order
+// requires several rotations. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void ChainTest::testLongChain()
+{
+   DMat  A, B, D;
+   TDMat C, E;
+
+   const size_t sizes[3][6] = { {  2UL, 9UL, 3UL, 8UL, 1UL, 7UL },
+                                { 10UL, 9UL, 8UL, 7UL, 1UL, 2UL },
+                                {  1UL, 8UL, 9UL, 2UL, 9UL, 1UL } };
+
+   for( const auto& s : sizes )
+   {
+      initialize( A, s[0], s[1], 1 );
+      initialize( B, s[1], s[2], 2 );
+      initialize( C, s[2], s[3], 3 );
+      initialize( D, s[3], s[4], 4 );
+      initialize( E, s[4], s[5], 5 );
+
+      const DMat AB  ( A * B );
+      const DMat ABC ( AB * C );
+      const DMat ABCD( ABC * D );
+      const DMat ref4( ABCD );
+      const DMat ref5( ABCD * E );
+
+      {
+         test_ = "Chain of four matrices";
+
+         DMat res( A * B * C * D );
+         checkResult( res, ref4 );
+
+         res = A * ( B * C ) * D;
+         checkResult( res, ref4 );
+
+         res = A * ( B * ( C * D ) );
+         checkResult( res, ref4 );
+
+         res += ( A * B ) * ( C * D );
+         checkResult( res, 2 * ref4 );
+      }
+
+      {
+         test_ = "Chain of five matrices";
+
+         TDMat res( A * B * C * D * E );
+         checkResult( res, ref5 );
+
+         res -= 2 * A * ( B * C ) * ( D * E );
+         checkResult( res, -ref5 );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of reordered matrix multiplication chains in the presence of aliasing.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the assignment of reordered chains to one of the factors of the chain.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ChainTest::testAliasing()
+{
+   DMat A, B, C;
+
+   {
+      test_ = "Assignment to the last factor of a chain";
+
+      initialize( A, 7UL, 7UL, 1 );
+      initialize( B, 7UL, 7UL, 2 );
+      initialize( C, 7UL, 2UL, 3 );
+
+      const DMat AB( A * B );
+      const DMat ref( AB * C );
+
+      C = A * B * C;
+      checkResult( C, ref );
+   }
+
+   {
+      test_ = "Addition assignment to the first factor of a chain";
+
+      initialize( A, 2UL, 7UL, 1 );
+      initialize( B, 7UL, 7UL, 2 );
+      initialize( C, 7UL, 7UL, 3 );
+
+      const DMat BC( B * C );
+      const DMat ref( A + A * BC );
+
+      A += A * B * C;
+      checkResult( A, ref );
+   }
+}
+//*************************************************************************************************
+
+} // namespace dmatdmatmult
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running chain test..." << std::endl;
+
+   try
+   {
+      RUN_DMATDMATMULT_CHAIN_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during chain test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,139 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/fused/DenseTest.cpp
+//  \brief Source file for the fused dense vector evaluation test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/HybridVector.h>
+#include <blazetest/mathtest/fused/DenseTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace fused {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the DenseTest fused evaluation test.
+//
+// \exception std::runtime_error Fused evaluation error detected.
+*/
+DenseTest::DenseTest()
+{
+   using blaze::DynamicVector;
+   using blaze::HybridVector;
+   using blaze::rowVector;
+
+
+   //=====================================================================================
+   // Specific tests
+   //=====================================================================================
+
+   testSubvector();
+   testReduction();
+   testSizeMismatch();
+
+
+   //=====================================================================================
+   // Random vector tests
+   //=====================================================================================
+
+   for( size_t N : { 0UL, 1UL, 7UL, 64UL, 65UL, 1000UL, 20000UL } )
+   {
+      testUpdate< DynamicVector<int> >( N );
+      testUpdate< DynamicVector<double> >( N );
+      testUpdate< DynamicVector<float,rowVector> >( N );
+
+      testAssignment< DynamicVector<int> >( N );
+      testAssignment< DynamicVector<double,rowVector> >( N );
+   }
+
+   for( size_t N : { 0UL, 5UL, 16UL, 33UL } )
+   {
+      testUpdate< HybridVector<double,33UL> >( N );
+      testAssignment< HybridVector<int,33UL,rowVector> >( N );
+   }
+}
+//*************************************************************************************************
+
+} // namespace fused
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running fused dense vector evaluation test..." << std::endl;
+
+   try
+   {
+      RUN_FUSED_DENSE_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during fused dense vector evaluation test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
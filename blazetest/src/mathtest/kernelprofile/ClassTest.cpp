@@ -0,0 +1,607 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/kernelprofile/ClassTest.cpp
+//  \brief Source file for the kernel profiling test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#define BLAZE_USE_KERNEL_PROFILING 1
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/SMP.h>
+#include <blaze/system/BLAS.h>
+#include <blazetest/mathtest/kernelprofile/ClassTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace kernelprofile {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the kernel profiling test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testRegistry();
+   testExport();
+   testDMatDMatMult();
+   testDMatDVecMult();
+   testTDVecDMatMult();
+   testSMPAssign();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the KernelRegistry class.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the recording of kernel calls, the accumulated statistics, the capacity
+// limit, and the runtime deactivation of the kernel registry. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testRegistry()
+{
+   test_ = "KernelRegistry";
+
+   blaze::KernelRegistry& registry( blaze::kernelRegistry() );
+   registry.clear();
+
+   {
+      BLAZE_KERNEL_PROFILE( "test.kernel", 2UL, 3UL, 4UL, 5UL, 120.0, 960.0 );
+   }
+   {
+      BLAZE_KERNEL_PROFILE( "test.kernel", 2UL, 3UL, 4UL, 5UL, 120.0, 960.0 );
+   }
+
+   checkRecords( 2UL );
+
+   const blaze::KernelRecord record( checkRecord( "test.kernel", 3UL, 4UL, 5UL, 120.0 ) );
+
+   if( record.threads != 2UL || record.bytes != 960.0 || record.time < 0.0 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid kernel record detected\n"
+          << " Details:\n"
+          << "   Threads: " << record.threads << " (expected 2)\n"
+          << "   Bytes  : " << record.bytes << " (expected 960)\n"
+          << "   Time   : " << record.time << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   {
+      const auto statistics( registry.statistics() );
+      const auto stats( statistics.find( "test.kernel" ) );
+
+      if( statistics.size() != 1UL || stats == statistics.end() ||
+          stats->second.calls != 2UL || stats->second.flops != 240.0 ||
+          stats->second.bytes != 1920.0 || stats->second.min > stats->second.max ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid kernel statistics detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   registry.setEnabled( false );
+   {
+      BLAZE_KERNEL_PROFILE( "test.kernel", 1UL, 1UL, 1UL, 1UL, 1.0, 1.0 );
+   }
+   registry.setEnabled( true );
+
+   checkRecords( 2UL );
+
+   registry.setCapacity( 1UL );
+   {
+      BLAZE_KERNEL_PROFILE( "test.other", 1UL, 1UL, 1UL, 1UL, 1.0, 1.0 );
+   }
+
+   checkRecords( 1UL );
+
+   if( registry.statistics().at( "test.kernel" ).calls != 2UL ||
+       registry.statistics().at( "test.other" ).calls != 1UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid kernel statistics after exceeding the capacity\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   registry.setCapacity( 100000UL );
+   registry.clear();
+
+   checkRecords( 0UL );
+
+   if( !registry.statistics().empty() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Clearing the kernel registry failed\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the JSON and Chrome trace export.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the writeJSON() and writeChromeTrace() functions of the KernelRegistry
+// class. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testExport()
+{
+   test_ = "JSON and Chrome trace export";
+
+   blaze::KernelRegistry& registry( blaze::kernelRegistry() );
+   registry.clear();
+
+   {
+      BLAZE_KERNEL_PROFILE( "test.\"quoted\"", 1UL, 7UL, 8UL, 9UL, 1008.0, 64.0 );
+   }
+
+   {
+      std::ostringstream oss;
+      registry.writeJSON( oss );
+
+      checkContains( oss.str(), "\"kernels\": {" );
+      checkContains( oss.str(), "\"test.\\\"quoted\\\"\": { \"calls\": 1" );
+      checkContains( oss.str(), "\"records\": [" );
+      checkContains( oss.str(), "\"m\": 7, \"n\": 8, \"k\": 9, \"flops\": 1008" );
+      checkContains( oss.str(), "\"dropped\": 0" );
+   }
+
+   {
+      std::ostringstream oss;
+      registry.writeChromeTrace( oss );
+
+      checkContains( oss.str(), "{\"traceEvents\":[" );
+      checkContains( oss.str(), "{\"name\":\"test.\\\"quoted\\\"\",\"cat\":\"blaze\",\"ph\":\"X\"" );
+      checkContains( oss.str(), "\"args\":{\"threads\":1,\"m\":7,\"n\":8,\"k\":9" );
+   }
+
+   registry.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the kernel records of the dense matrix/dense matrix multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the kernel records of the small and large (or BLAS) kernels of the dense
+// matrix/dense matrix multiplication for all combinations of storage orders. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testDMatDMatMult()
+{
+   test_ = "Dense matrix/dense matrix multiplication";
+
+   const bool blas( BLAZE_BLAS_MODE && BLAZE_USE_BLAS_MATRIX_MATRIX_MULTIPLICATION );
+
+   blaze::KernelRegistry& registry( blaze::kernelRegistry() );
+
+   BLAZE_SERIAL_SECTION
+   {
+      {
+         registry.clear();
+
+         const blaze::DynamicMatrix<double,blaze::rowMajor> A( 4UL, 3UL, 1.0 );
+         const blaze::DynamicMatrix<double,blaze::rowMajor> B( 3UL, 5UL, 2.0 );
+         blaze::DynamicMatrix<double,blaze::rowMajor> C( A * B );
+
+         checkRecord( "dmatdmatmult.assign.small", 4UL, 5UL, 3UL, 120.0 );
+
+         C += A * B;
+         checkRecord( "dmatdmatmult.addassign.small", 4UL, 5UL, 3UL, 120.0 );
+
+         C -= A * B;
+         checkRecord( "dmatdmatmult.subassign.small", 4UL, 5UL, 3UL, 120.0 );
+      }
+
+      {
+         registry.clear();
+
+         const blaze::DynamicMatrix<double,blaze::rowMajor> A( 100UL, 90UL, 1.0 );
+         const blaze::DynamicMatrix<double,blaze::rowMajor> B( 90UL, 110UL, 2.0 );
+         blaze::DynamicMatrix<double,blaze::rowMajor> C( A * B );
+
+         checkRecord( blas ? "dmatdmatmult.assign.blas" : "dmatdmatmult.assign.large",
+                      100UL, 110UL, 90UL, 2.0*100.0*110.0*90.0 );
+
+         C = 2.0 * A * B;
+         checkRecord( blas ? "dmatdmatmult.assign.blas" : "dmatdmatmult.assign.large",
+                      100UL, 110UL, 90UL, 2.0*100.0*110.0*90.0 );
+      }
+
+      {
+         registry.clear();
+
+         const blaze::DynamicMatrix<double,blaze::rowMajor> A( 4UL, 3UL, 1.0 );
+         const blaze::DynamicMatrix<double,blaze::rowMajor> B( 3UL, 5UL, 2.0 );
+         const blaze::DynamicMatrix<double,blaze::columnMajor> TA( 4UL, 3UL, 1.0 );
+         const blaze::DynamicMatrix<double,blaze::columnMajor> TB( 3UL, 5UL, 2.0 );
+         blaze::DynamicMatrix<double,blaze::rowMajor> C( TA * B );
+
+         checkRecord( "tdmatdmatmult.assign.small", 4UL, 5UL, 3UL, 120.0 );
+
+         C += A * TB;
+         checkRecord( "dmattdmatmult.addassign.small", 4UL, 5UL, 3UL, 120.0 );
+
+         C -= 2.0 * TA * TB;
+         checkRecord( "tdmattdmatmult.subassign.small", 4UL, 5UL, 3UL, 120.0 );
+      }
+   }
+
+   registry.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the kernel records of the dense matrix/dense vector multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the kernel records of the small kernels of the row-major and column-major
+// dense matrix/dense vector multiplication. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testDMatDVecMult()
+{
+   test_ = "Dense matrix/dense vector multiplication";
+
+   blaze::KernelRegistry& registry( blaze::kernelRegistry() );
+
+   BLAZE_SERIAL_SECTION
+   {
+      registry.clear();
+
+      const blaze::DynamicMatrix<double,blaze::rowMajor> A( 6UL, 7UL, 1.0 );
+      const blaze::DynamicVector<double,blaze::columnVector> x( 7UL, 2.0 );
+      blaze::DynamicVector<double,blaze::columnVector> y( A * x );
+
+      checkRecord( "dmatdvecmult.assign.small", 6UL, 7UL, 1UL, 84.0 );
+
+      y += A * x;
+      checkRecord( "dmatdvecmult.addassign.small", 6UL, 7UL, 1UL, 84.0 );
+
+      y -= 3.0 * A * x;
+      checkRecord( "dmatdvecmult.subassign.small", 6UL, 7UL, 1UL, 84.0 );
+
+      const blaze::DynamicMatrix<double,blaze::columnMajor> TA( 6UL, 7UL, 1.0 );
+
+      y = TA * x;
+      checkRecord( "tdmatdvecmult.assign.small", 6UL, 7UL, 1UL, 84.0 );
+
+      y += 2.0 * TA * x;
+      checkRecord( "tdmatdvecmult.addassign.small", 6UL, 7UL, 1UL, 84.0 );
+   }
+
+   registry.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the kernel records of the dense vector/dense matrix multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the kernel records of the small and large (or BLAS) kernels of the dense
+// vector/dense matrix multiplication. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testTDVecDMatMult()
+{
+   test_ = "Dense vector/dense matrix multiplication";
+
+   const bool blas( BLAZE_BLAS_MODE && BLAZE_USE_BLAS_MATRIX_VECTOR_MULTIPLICATION );
+
+   blaze::KernelRegistry& registry( blaze::kernelRegistry() );
+
+   BLAZE_SERIAL_SECTION
+   {
+      {
+         registry.clear();
+
+         const blaze::DynamicVector<double,blaze::rowVector> x( 5UL, 2.0 );
+         const blaze::DynamicMatrix<double,blaze::rowMajor> A( 5UL, 3UL, 1.0 );
+         const blaze::DynamicVector<double,blaze::rowVector> y( x * A );
+
+         checkRecord( "tdvecdmatmult.assign.small", 5UL, 3UL, 1UL, 30.0 );
+
+         const blaze::DynamicMatrix<double,blaze::columnMajor> TA( 5UL, 3UL, 1.0 );
+         blaze::DynamicVector<double,blaze::rowVector> z( x * TA );
+
+         checkRecord( "tdvectdmatmult.assign.small", 5UL, 3UL, 1UL, 30.0 );
+
+         z -= x * TA;
+         checkRecord( "tdvectdmatmult.subassign.small", 5UL, 3UL, 1UL, 30.0 );
+      }
+
+      {
+         registry.clear();
+
+         const blaze::DynamicVector<double,blaze::rowVector> x( 300UL, 2.0 );
+         const blaze::DynamicMatrix<double,blaze::rowMajor> A( 300UL, 250UL, 1.0 );
+         const blaze::DynamicVector<double,blaze::rowVector> y( x * A );
+
+         checkRecord( blas ? "tdvecdmatmult.assign.blas" : "tdvecdmatmult.assign.large",
+                      300UL, 250UL, 1UL, 2.0*300.0*250.0 );
+      }
+   }
+
+   registry.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the kernel records of the SMP assignments.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the kernel records of a parallel dense matrix/dense vector multiplication.
+// Both the SMP assignment and the kernels executed by the individual threads are recorded. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSMPAssign()
+{
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE || BLAZE_OPENMP_PARALLEL_MODE
+   test_ = "SMP assignment";
+
+   const size_t threads( blaze::getNumThreads() );
+   blaze::setNumThreads( 4UL );
+
+   blaze::KernelRegistry& registry( blaze::kernelRegistry() );
+   registry.clear();
+
+   const blaze::DynamicMatrix<double,blaze::rowMajor> A( 1000UL, 200UL, 1.0 );
+   const blaze::DynamicVector<double,blaze::columnVector> x( 200UL, 2.0 );
+   blaze::DynamicVector<double,blaze::columnVector> y( 1000UL );
+
+   y = A * x;
+
+   const blaze::KernelRecord record( checkRecord( "smp.dvec.assign", 1000UL, 1UL, 1UL, 0.0 ) );
+
+   if( record.threads != 4UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of threads detected\n"
+          << " Details:\n"
+          << "   Threads         : " << record.threads << "\n"
+          << "   Expected threads: 4\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   size_t rows( 0UL );
+
+   for( const blaze::KernelRecord& r : registry.records() ) {
+      if( std::string( r.kernel ) == "dmatdvecmult.assign.small" ) {
+         rows += r.m;
+      }
+   }
+
+   if( rows != 1000UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid kernel records of the threads detected\n"
+          << " Details:\n"
+          << "   Total number of rows: " << rows << "\n"
+          << "   Expected rows       : 1000\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   blaze::setNumThreads( threads );
+   registry.clear();
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the record of the given kernel.
+//
+// \param kernel The ID of the expected kernel.
+// \param m The expected first dimension.
+// \param n The expected second dimension.
+// \param k The expected third dimension.
+// \param flops The expected number of floating point operations.
+// \return The last record of the given kernel.
+// \exception std::runtime_error Error detected.
+*/
+blaze::KernelRecord
+   ClassTest::checkRecord( const std::string& kernel, size_t m, size_t n, size_t k, double flops ) const
+{
+   const std::vector<blaze::KernelRecord> records( blaze::kernelRegistry().records() );
+
+   for( auto r=records.rbegin(); r!=records.rend(); ++r )
+   {
+      if( kernel != r->kernel )
+         continue;
+
+      if( r->m != m || r->n != n || r->k != k || r->flops != flops ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid kernel record detected\n"
+             << " Details:\n"
+             << "   Kernel    : " << kernel << "\n"
+             << "   Dimensions: " << r->m << "x" << r->n << "x" << r->k << "\n"
+             << "   Flops     : " << r->flops << "\n"
+             << "   Expected dimensions: " << m << "x" << n << "x" << k << "\n"
+             << "   Expected flops     : " << flops << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      return *r;
+   }
+
+   std::ostringstream oss;
+   oss << " Test: " << test_ << "\n"
+       << " Error: Missing kernel record\n"
+       << " Details:\n"
+       << "   Expected kernel: " << kernel << "\n"
+       << "   Recorded kernels:\n";
+   for( const blaze::KernelRecord& r : records ) {
+      oss << "     " << r.kernel << "\n";
+   }
+   throw std::runtime_error( oss.str() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of stored kernel records.
+//
+// \param expectedRecords The expected number of kernel records.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::checkRecords( size_t expectedRecords ) const
+{
+   const size_t records( blaze::kernelRegistry().records().size() );
+
+   if( records != expectedRecords ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of kernel records detected\n"
+          << " Details:\n"
+          << "   Number of records         : " << records << "\n"
+          << "   Expected number of records: " << expectedRecords << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking that the given output contains the given string.
+//
+// \param output The output to be checked.
+// \param str The expected string.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::checkContains( const std::string& output, const std::string& str ) const
+{
+   if( output.find( str ) == std::string::npos ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Missing output detected\n"
+          << " Details:\n"
+          << "   Output         :\n" << output << "\n"
+          << "   Expected string: " << str << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace kernelprofile
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running kernel profiling test..." << std::endl;
+
+   try
+   {
+      RUN_KERNELPROFILE_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during kernel profiling test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
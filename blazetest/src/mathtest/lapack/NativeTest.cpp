@@ -0,0 +1,182 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/lapack/NativeTest.cpp
+//  \brief Source file for the native LAPACK kernel test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+// The native kernels are tested independent of the LAPACK mode of the test suite
+#define BLAZE_LAPACK_MODE 0
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/HybridMatrix.h>
+#include <blaze/math/StaticMatrix.h>
+#include <blaze/util/Complex.h>
+#include <blazetest/mathtest/lapack/NativeTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace lapack {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the NativeTest class test.
+//
+// \exception std::runtime_error Error detected.
+*/
+NativeTest::NativeTest()
+{
+   using blaze::complex;
+   using blaze::DynamicMatrix;
+   using blaze::HybridMatrix;
+   using blaze::StaticMatrix;
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+
+   //=====================================================================================
+   // Blocked kernels
+   //=====================================================================================
+
+   testLU< DynamicMatrix<double,rowMajor> >( 150UL, 150UL );
+   testLU< DynamicMatrix<double,columnMajor> >( 150UL, 150UL );
+   testLU< DynamicMatrix<double,rowMajor> >( 170UL, 97UL );
+   testLU< DynamicMatrix<double,columnMajor> >( 97UL, 170UL );
+   testLU< DynamicMatrix<complex<double>,rowMajor> >( 97UL, 130UL );
+   testLU< DynamicMatrix<complex<double>,columnMajor> >( 130UL, 97UL );
+
+   testLLH< DynamicMatrix<double,rowMajor> >( 150UL );
+   testLLH< DynamicMatrix<double,columnMajor> >( 150UL );
+   testLLH< DynamicMatrix<complex<double>,rowMajor> >( 130UL );
+   testLLH< DynamicMatrix<complex<double>,columnMajor> >( 130UL );
+
+   testQR< DynamicMatrix<double,rowMajor> >( 150UL, 150UL );
+   testQR< DynamicMatrix<double,columnMajor> >( 150UL, 150UL );
+   testQR< DynamicMatrix<double,rowMajor> >( 170UL, 97UL );
+   testQR< DynamicMatrix<double,columnMajor> >( 97UL, 170UL );
+   testQR< DynamicMatrix<complex<double>,rowMajor> >( 97UL, 130UL );
+   testQR< DynamicMatrix<complex<double>,columnMajor> >( 130UL, 97UL );
+
+   testInversion< DynamicMatrix<double,rowMajor> >( 150UL );
+   testInversion< DynamicMatrix<double,columnMajor> >( 150UL );
+   testInversion< DynamicMatrix<complex<double>,rowMajor> >( 130UL );
+   testInversion< DynamicMatrix<complex<double>,columnMajor> >( 130UL );
+
+   testDeterminant< DynamicMatrix<double,rowMajor> >( 150UL );
+   testDeterminant< DynamicMatrix<complex<double>,columnMajor> >( 130UL );
+
+   testSingular< DynamicMatrix<double,rowMajor> >( 100UL );
+   testSingular< DynamicMatrix<complex<double>,columnMajor> >( 100UL );
+
+
+   //=====================================================================================
+   // Unblocked kernels
+   //=====================================================================================
+
+   testLU< DynamicMatrix<double,columnMajor> >( 23UL, 17UL );
+   testLLH< DynamicMatrix<complex<double>,rowMajor> >( 23UL );
+   testQR< DynamicMatrix<double,rowMajor> >( 17UL, 23UL );
+   testInversion< DynamicMatrix<complex<double>,columnMajor> >( 23UL );
+
+
+   //=====================================================================================
+   // Fixed size kernels
+   //=====================================================================================
+
+   testLU< StaticMatrix<double,12UL,12UL,rowMajor> >( 12UL, 12UL );
+   testLU< HybridMatrix<complex<double>,16UL,16UL,columnMajor> >( 9UL, 14UL );
+   testLU< HybridMatrix<double,32UL,32UL,columnMajor> >( 27UL, 19UL );
+
+   testLLH< StaticMatrix<double,12UL,12UL,columnMajor> >( 12UL );
+   testLLH< HybridMatrix<complex<double>,32UL,32UL,rowMajor> >( 25UL );
+
+   testQR< StaticMatrix<double,14UL,14UL,rowMajor> >( 14UL, 14UL );
+   testQR< HybridMatrix<double,16UL,16UL,rowMajor> >( 14UL, 9UL );
+   testQR< HybridMatrix<complex<double>,32UL,32UL,columnMajor> >( 19UL, 27UL );
+
+   testInversion< StaticMatrix<double,12UL,12UL,rowMajor> >( 12UL );
+   testInversion< HybridMatrix<complex<double>,32UL,32UL,columnMajor> >( 25UL );
+
+   testDeterminant< StaticMatrix<double,12UL,12UL,columnMajor> >( 12UL );
+   testSingular< HybridMatrix<double,32UL,32UL,rowMajor> >( 20UL );
+}
+//*************************************************************************************************
+
+} // namespace lapack
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running native LAPACK kernel test..." << std::endl;
+
+   try
+   {
+      RUN_LAPACK_NATIVE_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during native LAPACK kernel test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
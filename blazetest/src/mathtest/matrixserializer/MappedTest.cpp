@@ -0,0 +1,389 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/matrixserializer/MappedTest.cpp
+//  \brief Source file for the mappable MatrixSerializer format test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <blaze/math/CustomCompressedMatrix.h>
+#include <blaze/math/CustomMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/serialization/MatrixMapping.h>
+#include <blaze/math/serialization/MatrixSerializer.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/matrixserializer/MappedTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace matrixserializer {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the mappable MatrixSerializer format test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+MappedTest::MappedTest()
+{
+   testDeserialization();
+   testMapping();
+   testFailures();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the deserialization of matrices in the mappable format.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs (de-)serialization tests with empty and randomly initialized dense
+// and sparse matrices in the mappable format. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void MappedTest::testDeserialization()
+{
+   test_ = "Mappable deserialization";
+
+   {
+      blaze::DynamicMatrix<int,blaze::rowMajor> src;
+      runDeserializationTests( src );
+   }
+
+   {
+      blaze::CompressedMatrix<int,blaze::columnMajor> src( 0UL, 5UL );
+      runDeserializationTests( src );
+   }
+
+   {
+      blaze::DynamicMatrix<int,blaze::rowMajor> src( 7UL, 13UL );
+      randomize( src );
+      runDeserializationTests( src );
+   }
+
+   {
+      blaze::DynamicMatrix<double,blaze::columnMajor> src( 13UL, 7UL );
+      randomize( src );
+      runDeserializationTests( src );
+   }
+
+   {
+      blaze::DynamicMatrix<blaze::complex<float>,blaze::rowMajor> src( 5UL, 3UL );
+      randomize( src );
+      runDeserializationTests( src );
+   }
+
+   {
+      blaze::CompressedMatrix<int,blaze::rowMajor> src( 7UL, 13UL );
+      randomize( src, 30UL );
+      runDeserializationTests( src );
+   }
+
+   {
+      blaze::CompressedMatrix<double,blaze::columnMajor> src( 13UL, 7UL );
+      randomize( src, 20UL );
+      runDeserializationTests( src );
+   }
+
+   {
+      blaze::CompressedMatrix<blaze::complex<float>,blaze::rowMajor> src( 9UL, 9UL );
+      randomize( src, 0UL );
+      runDeserializationTests( src );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the zero-copy access to matrices in the mappable format.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function writes several matrices in the mappable format into a single file and accesses
+// them via the MatrixMapping class. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void MappedTest::testMapping()
+{
+   test_ = "Matrix mapping";
+
+   const std::string file( "mappedtest.blaze" );
+
+   blaze::DynamicMatrix<double,blaze::rowMajor> A( 17UL, 11UL );
+   blaze::DynamicMatrix<float,blaze::columnMajor> B( 5UL, 3UL );
+   blaze::CompressedMatrix<double,blaze::rowMajor> C( 23UL, 19UL );
+   blaze::CompressedMatrix<int,blaze::columnMajor> D( 6UL, 8UL );
+
+   randomize( A );
+   randomize( B );
+   randomize( C, 40UL );
+   randomize( D, 10UL );
+
+   {
+      blaze::Archive<std::ofstream> archive( file, std::ofstream::binary | std::ofstream::trunc );
+      serialize( archive, A, blaze::mappable );
+      serialize( archive, C, blaze::mappable );
+      serialize( archive, B, blaze::mappable );
+      serialize( archive, D, blaze::mappable );
+   }
+
+   {
+      const blaze::MatrixMapping m1( file );
+      const blaze::MatrixMapping m2( file, m1.size() );
+      const blaze::MatrixMapping m3( file, m1.size() + m2.size() );
+      const blaze::MatrixMapping m4( file, m1.size() + m2.size() + m3.size() );
+
+      if( !m1.isDense() || !m1.isRowMajor() || m2.isDense() || !m2.isRowMajor() ||
+          !m3.isDense() || m3.isRowMajor() || m4.isDense() || m4.isRowMajor() ||
+          m1.size() % 64UL != 0UL || m2.size() % 64UL != 0UL || m2.nonZeros() != C.nonZeros() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid record meta information detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      const blaze::CustomMatrix<const double,blaze::aligned,blaze::unpadded,blaze::rowMajor> a
+         = m1.dense<double,blaze::rowMajor>();
+      const blaze::CustomCompressedMatrix<double,blaze::rowMajor> c
+         = m2.sparse<double,blaze::rowMajor>();
+      const blaze::CustomMatrix<const float,blaze::aligned,blaze::unpadded,blaze::columnMajor> b
+         = m3.dense<float,blaze::columnMajor>();
+      const blaze::CustomCompressedMatrix<int,blaze::columnMajor> d
+         = m4.sparse<int,blaze::columnMajor>();
+
+      compareMatrices( A, a );
+      compareMatrices( B, b );
+      compareMatrices( C, c );
+      compareMatrices( D, d );
+
+      blaze::DynamicVector<double> x( 11UL );
+      randomize( x );
+
+      const blaze::DynamicVector<double> y1( a * x );
+      const blaze::DynamicVector<double> y2( A * x );
+
+      if( y1 != y2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Dense matrix/vector multiplication with mapped matrix failed\n"
+             << " Details:\n"
+             << "   Result:\n" << y1 << "\n"
+             << "   Expected result:\n" << y2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      blaze::DynamicVector<double> z( 19UL );
+      randomize( z );
+
+      const blaze::DynamicVector<double> y3( c * z );
+      const blaze::DynamicVector<double> y4( C * z );
+
+      if( y3 != y4 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Sparse matrix/vector multiplication with mapped matrix failed\n"
+             << " Details:\n"
+             << "   Result:\n" << y3 << "\n"
+             << "   Expected result:\n" << y4 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> E( c + C );
+      const blaze::CompressedMatrix<double,blaze::rowMajor> F( 2.0 * C );
+
+      compareMatrices( E, F );
+   }
+
+   std::remove( file.c_str() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of failing mapping attempts.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs tests with failing mapping attempts. In case no error is detected,
+// i.e. in case the test is failing, a \a std::runtime_error exception is thrown.
+*/
+void MappedTest::testFailures()
+{
+   test_ = "Mapping failures";
+
+   const std::string file( "mappedtest.blaze" );
+
+   blaze::DynamicMatrix<double,blaze::rowMajor> A( 4UL, 5UL );
+   randomize( A );
+
+   {
+      blaze::Archive<std::ofstream> archive( file, std::ofstream::binary | std::ofstream::trunc );
+      serialize( archive, A, blaze::mappable );
+      archive << A;
+   }
+
+   const blaze::MatrixMapping mapping( file );
+
+   try {
+      mapping.dense<float,blaze::rowMajor>();
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Element type difference succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& )
+   {}
+
+   try {
+      mapping.dense<double,blaze::columnMajor>();
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Storage order difference succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& )
+   {}
+
+   try {
+      mapping.sparse<double,blaze::rowMajor>();
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Matrix type difference succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& )
+   {}
+
+   try {
+      blaze::MatrixMapping invalid( file, 8UL );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Unaligned record offset succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& )
+   {}
+
+   try {
+      blaze::MatrixMapping invalid( file, mapping.size() );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Mapping of a version 1 record succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& )
+   {}
+
+   try {
+      blaze::MatrixMapping invalid( "nonexistent.blaze" );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Mapping of a non-existing file succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& )
+   {}
+
+   std::remove( file.c_str() );
+}
+//*************************************************************************************************
+
+} // namespace matrixserializer
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running mappable MatrixSerializer format test..." << std::endl;
+
+   try
+   {
+      RUN_MATRIXSERIALIZER_MAPPED_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during mappable MatrixSerializer format test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,604 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/numa/ClassTest.cpp
+//  \brief Source file for the NUMA placement and thread affinity test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/SMP.h>
+#include <blazetest/mathtest/numa/ClassTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace numa {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the NUMA placement and thread affinity test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testCpuList();
+   testTopology();
+   testAffinity();
+   testThreadAffinity();
+   testPolicy();
+   testVector();
+   testMatrix();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the parsing of CPU lists.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the parseCpuList() function. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testCpuList()
+{
+   test_ = "Parsing of CPU lists";
+
+   {
+      const std::vector<size_t> cpus( blaze::parseCpuList( "0-3,8,10-11" ) );
+      const std::vector<size_t> ref{ 0UL, 1UL, 2UL, 3UL, 8UL, 10UL, 11UL };
+
+      checkSize( cpus, ref.size() );
+
+      if( cpus != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid CPU list detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      const std::vector<size_t> cpus( blaze::parseCpuList( "5\n" ) );
+
+      checkSize( cpus, 1UL );
+
+      if( cpus[0] != 5UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid CPU list detected\n"
+             << " Details:\n"
+             << "   Result         : " << cpus[0] << "\n"
+             << "   Expected result: 5\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   const char* const invalid[] = { "", "a", "3-1", "1,,2", "-1", "1-" };
+
+   for( const char* list : invalid )
+   {
+      try {
+         blaze::parseCpuList( list );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Parsing an invalid CPU list succeeded\n"
+             << " Details:\n"
+             << "   List: \"" << list << "\"\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the detection of the NUMA topology.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the numaTopology() and numaNodes() functions. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testTopology()
+{
+   test_ = "Detection of the NUMA topology";
+
+   const auto& nodes( blaze::numaTopology() );
+
+   checkSize( nodes, blaze::numaNodes() );
+
+   if( nodes.empty() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: No NUMA node detected\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   for( const auto& node : nodes ) {
+      if( node.empty() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: NUMA node without CPUs detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the ThreadAffinity class.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the construction of thread affinities and the resulting mapping of
+// threads to CPUs. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAffinity()
+{
+   size_t total( 0UL );
+   for( const auto& node : blaze::numaTopology() ) {
+      total += node.size();
+   }
+
+
+   //=====================================================================================
+   // Default affinity
+   //=====================================================================================
+
+   {
+      test_ = "Default thread affinity";
+
+      const blaze::ThreadAffinity affinity;
+
+      checkSize( affinity.cpus(), 0UL );
+
+      if( affinity.policy() != blaze::AffinityPolicy::none || affinity.apply( 0UL ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid default affinity detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Compact and scatter affinity
+   //=====================================================================================
+
+   {
+      test_ = "Compact and scatter thread affinity";
+
+      const blaze::ThreadAffinity compact( blaze::AffinityPolicy::compact );
+      const blaze::ThreadAffinity scatter( "scatter" );
+
+      checkSize( compact.cpus(), total );
+      checkSize( scatter.cpus(), total );
+
+      std::vector<size_t> cpus1( compact.cpus() );
+      std::vector<size_t> cpus2( scatter.cpus() );
+      std::sort( cpus1.begin(), cpus1.end() );
+      std::sort( cpus2.begin(), cpus2.end() );
+
+      if( compact.policy() != blaze::AffinityPolicy::compact ||
+          scatter.policy() != blaze::AffinityPolicy::scatter ||
+          cpus1 != cpus2 ||
+          compact.cpu( 0UL ) != blaze::numaTopology()[0][0] ||
+          scatter.cpu( 0UL ) != blaze::numaTopology()[0][0] ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid CPU mapping detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      if( blaze::numaNodes() > 1UL && scatter.cpu( 1UL ) != blaze::numaTopology()[1][0] ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid scatter mapping detected\n"
+             << " Details:\n"
+             << "   Result         : " << scatter.cpu( 1UL ) << "\n"
+             << "   Expected result: " << blaze::numaTopology()[1][0] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Explicit list of CPUs
+   //=====================================================================================
+
+   {
+      test_ = "Explicit thread affinity";
+
+      const blaze::ThreadAffinity affinity( "2,5-6" );
+
+      checkSize( affinity.cpus(), 3UL );
+
+      if( affinity.policy() != blaze::AffinityPolicy::list ||
+          affinity.cpu( 0UL ) != 2UL || affinity.cpu( 2UL ) != 6UL || affinity.cpu( 4UL ) != 5UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid CPU mapping detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Invalid affinities
+   //=====================================================================================
+
+   {
+      test_ = "Invalid thread affinity";
+
+      try {
+         const blaze::ThreadAffinity affinity( blaze::AffinityPolicy::list );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Creating a list affinity without CPUs succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      try {
+         const std::vector<size_t> cpus;
+         const blaze::ThreadAffinity affinity( cpus );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Creating an affinity with an empty list of CPUs succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      try {
+         const blaze::ThreadAffinity affinity( "spread" );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Creating an affinity from an invalid specification succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the setThreadAffinity() and getThreadAffinity() functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function pins the threads of the active SMP backend and performs a parallel assignment
+// with the pinned threads. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void ClassTest::testThreadAffinity()
+{
+   test_ = "Pinning of the SMP threads";
+
+   const blaze::ThreadAffinity initial( blaze::getThreadAffinity() );
+   const size_t cpu( blaze::numaTopology()[0][0] );
+
+   blaze::setThreadAffinity( blaze::ThreadAffinity( std::vector<size_t>{ cpu } ) );
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE || BLAZE_OPENMP_PARALLEL_MODE
+   if( blaze::getThreadAffinity().policy() != blaze::AffinityPolicy::list ||
+       blaze::getThreadAffinity().cpu( 0UL ) != cpu ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid thread affinity detected\n";
+      throw std::runtime_error( oss.str() );
+   }
+#endif
+
+   blaze::DynamicVector<int> a( 50000UL, 2 ), b( 50000UL, 3 ), c;
+   c = a + b;
+
+   checkSize( c, 50000UL );
+   checkValues( c, 5 );
+
+   blaze::setThreadAffinity( initial );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the getNumaPolicy() and setNumaPolicy() functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::testPolicy()
+{
+   test_ = "Selection of the NUMA policy";
+
+   const blaze::NumaPolicy initial( blaze::getNumaPolicy() );
+
+   const blaze::NumaPolicy policies[] = { blaze::NumaPolicy::none,
+                                          blaze::NumaPolicy::firstTouch,
+                                          blaze::NumaPolicy::interleave };
+
+   for( blaze::NumaPolicy policy : policies )
+   {
+      blaze::setNumaPolicy( policy );
+
+      if( blaze::getNumaPolicy() != policy ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid NUMA policy detected\n"
+             << " Details:\n"
+             << "   Result         : " << static_cast<int>( blaze::getNumaPolicy() ) << "\n"
+             << "   Expected result: " << static_cast<int>( policy ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   blaze::setNumaPolicy( initial );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the dynamic vector with all NUMA policies.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function creates and resizes dynamic vectors of various sizes (including sizes above
+// the SMP assignment threshold) with all NUMA policies and checks their elements and padding.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testVector()
+{
+   test_ = "DynamicVector with NUMA policies";
+
+   const blaze::NumaPolicy initial( blaze::getNumaPolicy() );
+   const size_t threads( blaze::getNumThreads() );
+
+   const blaze::NumaPolicy policies[] = { blaze::NumaPolicy::none,
+                                          blaze::NumaPolicy::firstTouch,
+                                          blaze::NumaPolicy::interleave };
+
+   const size_t sizes[] = { 7UL, 1000UL, 40003UL, 250001UL };
+
+   blaze::setNumThreads( 4UL );
+
+   for( blaze::NumaPolicy policy : policies )
+   {
+      blaze::setNumaPolicy( policy );
+
+      for( size_t n : sizes )
+      {
+         blaze::DynamicVector<double> a( n );
+         checkSize( a, n );
+         checkIntact( a );
+
+         blaze::DynamicVector<double> b( n, 2.0 );
+         checkSize( b, n );
+         checkValues( b, 2.0 );
+         checkIntact( b );
+
+         blaze::DynamicVector<float> c( n, 3.0F );
+         c.resize( 2UL*n+1UL, false );
+         checkSize( c, 2UL*n+1UL );
+         checkIntact( c );
+
+         c = 4.0F;
+         c.resize( 3UL*n, true );
+         checkSize( c, 3UL*n );
+         checkIntact( c );
+
+         for( size_t i=0UL; i<2UL*n+1UL; ++i ) {
+            if( c[i] != 4.0F ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Resizing the vector did not preserve the values\n"
+                   << " Details:\n"
+                   << "   Index: " << i << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+
+         c.reserve( 4UL*n );
+         checkSize( c, 3UL*n );
+         checkIntact( c );
+
+         const blaze::DynamicVector<double> d( b + b );
+         checkValues( d, 4.0 );
+      }
+   }
+
+   blaze::setNumThreads( threads );
+   blaze::setNumaPolicy( initial );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the dynamic matrix with all NUMA policies.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::testMatrix()
+{
+   testMatrix<blaze::rowMajor>();
+   testMatrix<blaze::columnMajor>();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the dynamic matrix with the given storage order and all NUMA policies.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function creates and resizes dynamic matrices of various sizes (including sizes above
+// the SMP assignment threshold) with all NUMA policies and checks their elements and padding.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< bool SO >  // Storage order
+void ClassTest::testMatrix()
+{
+   test_ = ( SO == blaze::rowMajor ? "Row-major DynamicMatrix with NUMA policies"
+                                   : "Column-major DynamicMatrix with NUMA policies" );
+
+   const blaze::NumaPolicy initial( blaze::getNumaPolicy() );
+   const size_t threads( blaze::getNumThreads() );
+
+   const blaze::NumaPolicy policies[] = { blaze::NumaPolicy::none,
+                                          blaze::NumaPolicy::firstTouch,
+                                          blaze::NumaPolicy::interleave };
+
+   const size_t sizes[] = { 5UL, 64UL, 221UL, 517UL };
+
+   blaze::setNumThreads( 4UL );
+
+   for( blaze::NumaPolicy policy : policies )
+   {
+      blaze::setNumaPolicy( policy );
+
+      for( size_t n : sizes )
+      {
+         blaze::DynamicMatrix<double,SO> A( n, n+3UL );
+         checkIntact( A );
+
+         blaze::DynamicMatrix<double,SO> B( n+1UL, n, 2.0 );
+         checkMatrixValues( B, 2.0 );
+         checkIntact( B );
+
+         blaze::DynamicMatrix<float,SO> C( n, n, 3.0F );
+         C.resize( 2UL*n+1UL, n+5UL, false );
+         checkIntact( C );
+
+         C = 4.0F;
+         C.resize( 2UL*n+3UL, n+7UL, true );
+         checkIntact( C );
+
+         for( size_t i=0UL; i<2UL*n+1UL; ++i ) {
+            for( size_t j=0UL; j<n+5UL; ++j ) {
+               if( C(i,j) != 4.0F ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Resizing the matrix did not preserve the values\n"
+                      << " Details:\n"
+                      << "   Index: (" << i << "," << j << ")\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+
+         C.reserve( 8UL*n*n );
+         checkIntact( C );
+
+         const blaze::DynamicMatrix<double,SO> D( B + B );
+         checkMatrixValues( D, 4.0 );
+      }
+   }
+
+   blaze::setNumThreads( threads );
+   blaze::setNumaPolicy( initial );
+}
+//*************************************************************************************************
+
+} // namespace numa
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running NUMA placement and thread affinity test..." << std::endl;
+
+   try
+   {
+      RUN_NUMA_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during NUMA placement and thread affinity test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,759 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/packedmatrix/ClassTest.cpp
+//  \brief Source file for the PackedMatrix class test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <complex>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/Band.h>
+#include <blaze/math/Column.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/HermitianMatrix.h>
+#include <blaze/math/LowerMatrix.h>
+#include <blaze/math/PackedMatrix.h>
+#include <blaze/math/Row.h>
+#include <blaze/math/Submatrix.h>
+#include <blaze/math/SymmetricMatrix.h>
+#include <blaze/math/UpperMatrix.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/packedmatrix/ClassTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace packedmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the PackedMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testAdaptors();
+   testViews();
+   testMultiplication();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the PackedMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the PackedMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   //=====================================================================================
+   // Row-major default constructor
+   //=====================================================================================
+
+   {
+      test_ = "Row-major PackedMatrix default constructor";
+
+      blaze::PackedMatrix<int,blaze::rowMajor> mat;
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Row-major size constructor
+   //=====================================================================================
+
+   {
+      test_ = "Row-major PackedMatrix size constructor";
+
+      blaze::PackedMatrix<int,blaze::rowMajor> mat( 4UL );
+
+      checkRows    ( mat, 4UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Row-major list initialization
+   //=====================================================================================
+
+   {
+      test_ = "Row-major PackedMatrix initializer list constructor";
+
+      const blaze::PackedMatrix<int,blaze::rowMajor> mat{ { 1, 2, 0 }, { 2, 3, 4 }, { 0, 4, 5 } };
+      const blaze::DynamicMatrix<int,blaze::rowMajor> ref{ { 1, 2, 0 }, { 2, 3, 4 }, { 0, 4, 5 } };
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 7UL );
+      checkEqual   ( mat, ref );
+   }
+
+
+   //=====================================================================================
+   // Row-major conversion and resizing
+   //=====================================================================================
+
+   {
+      test_ = "Row-major PackedMatrix conversion constructor";
+
+      blaze::DynamicMatrix<double,blaze::rowMajor> ref( 7UL, 7UL );
+      blaze::randomize( ref );
+      ref += trans( ref );
+
+      blaze::PackedMatrix<double,blaze::rowMajor> mat( ref );
+
+      checkRows  ( mat, 7UL );
+      checkEqual ( mat, ref );
+
+      test_ = "Row-major PackedMatrix resize";
+
+      mat.resize( 9UL );
+      ref.resize( 9UL, 9UL );
+      for( size_t i=0UL; i<9UL; ++i ) {
+         for( size_t j=( i<7UL ? 7UL : 0UL ); j<9UL; ++j ) {
+            ref(i,j) = ref(j,i) = 0.0;
+         }
+      }
+
+      checkRows  ( mat, 9UL );
+      checkEqual ( mat, ref );
+   }
+
+
+   //=====================================================================================
+   // Column-major default constructor
+   //=====================================================================================
+
+   {
+      test_ = "Column-major PackedMatrix default constructor";
+
+      blaze::PackedMatrix<int,blaze::columnMajor> mat;
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Column-major size constructor
+   //=====================================================================================
+
+   {
+      test_ = "Column-major PackedMatrix size constructor";
+
+      blaze::PackedMatrix<int,blaze::columnMajor> mat( 4UL );
+
+      checkRows    ( mat, 4UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Column-major list initialization
+   //=====================================================================================
+
+   {
+      test_ = "Column-major PackedMatrix initializer list constructor";
+
+      const blaze::PackedMatrix<int,blaze::columnMajor> mat{ { 1, 2, 0 }, { 2, 3, 4 }, { 0, 4, 5 } };
+      const blaze::DynamicMatrix<int,blaze::columnMajor> ref{ { 1, 2, 0 }, { 2, 3, 4 }, { 0, 4, 5 } };
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 7UL );
+      checkEqual   ( mat, ref );
+   }
+
+
+   //=====================================================================================
+   // Column-major conversion and resizing
+   //=====================================================================================
+
+   {
+      test_ = "Column-major PackedMatrix conversion constructor";
+
+      blaze::DynamicMatrix<double,blaze::columnMajor> ref( 7UL, 7UL );
+      blaze::randomize( ref );
+      ref += trans( ref );
+
+      blaze::PackedMatrix<double,blaze::columnMajor> mat( ref );
+
+      checkRows  ( mat, 7UL );
+      checkEqual ( mat, ref );
+
+      test_ = "Column-major PackedMatrix resize";
+
+      mat.resize( 5UL );
+      ref.resize( 5UL, 5UL );
+
+      checkRows  ( mat, 5UL );
+      checkEqual ( mat, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the packed specializations of the matrix adaptors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the element access and the assignment of the packed
+// SymmetricMatrix, HermitianMatrix, LowerMatrix, and UpperMatrix specializations. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAdaptors()
+{
+   using blaze::PackedMatrix;
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   using cplx = std::complex<double>;
+
+
+   //=====================================================================================
+   // Packed symmetric matrix
+   //=====================================================================================
+
+   {
+      test_ = "Packed SymmetricMatrix element access";
+
+      blaze::SymmetricMatrix< PackedMatrix<int,rowMajor> > sym{ { 1, 2, 0 }, { 2, 3, 4 }, { 0, 4, 5 } };
+      blaze::DynamicMatrix<int,rowMajor> ref{ { 1, 2, 0 }, { 2, 3, 4 }, { 0, 4, 5 } };
+
+      sym(0,2) = 6;
+      ref(0,2) = ref(2,0) = 6;
+
+      checkNonZeros( sym, 9UL );
+      checkEqual   ( sym, ref );
+
+      test_ = "Packed SymmetricMatrix row access";
+
+      row( sym, 1UL )[2UL] = 7;
+      ref(1,2) = ref(2,1) = 7;
+
+      checkEqual( sym, ref );
+
+      test_ = "Packed SymmetricMatrix invalid assignment";
+
+      try {
+         sym = blaze::DynamicMatrix<int,rowMajor>{ { 1, 2 }, { 3, 4 } };
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment of non-symmetric matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << sym << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Packed Hermitian matrix
+   //=====================================================================================
+
+   {
+      test_ = "Packed HermitianMatrix element access";
+
+      blaze::HermitianMatrix< PackedMatrix<cplx,columnMajor> > herm( 3UL );
+      blaze::DynamicMatrix<cplx,columnMajor> ref( 3UL, 3UL, cplx() );
+
+      herm(0,0) = cplx( 1.0, 0.0 );
+      herm(1,0) = cplx( 2.0, 1.0 );
+      herm(0,2) = cplx( 3.0, 4.0 );
+      ref(0,0) = cplx( 1.0, 0.0 );
+      ref(1,0) = cplx( 2.0,  1.0 ); ref(0,1) = cplx( 2.0, -1.0 );
+      ref(0,2) = cplx( 3.0,  4.0 ); ref(2,0) = cplx( 3.0, -4.0 );
+
+      checkNonZeros( herm, 5UL );
+      checkEqual   ( herm, ref );
+
+      test_ = "Packed HermitianMatrix invalid diagonal assignment";
+
+      try {
+         herm(1,1) = cplx( 1.0, 1.0 );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment of non-real diagonal element succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << herm << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Packed lower matrix
+   //=====================================================================================
+
+   {
+      test_ = "Packed LowerMatrix element access";
+
+      blaze::LowerMatrix< PackedMatrix<int,columnMajor> > lower{ { 1, 0, 0 }, { 2, 3, 0 }, { 4, 5, 6 } };
+      blaze::DynamicMatrix<int,columnMajor> ref{ { 1, 0, 0 }, { 2, 3, 0 }, { 4, 5, 6 } };
+
+      row( lower, 2UL )[1UL] = 7;
+      ref(2,1) = 7;
+
+      checkNonZeros( lower, 6UL );
+      checkEqual   ( lower, ref );
+
+      test_ = "Packed LowerMatrix invalid assignment";
+
+      try {
+         lower(0,1) = 1;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment to upper matrix element succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << lower << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      checkEqual( lower, ref );
+   }
+
+
+   //=====================================================================================
+   // Packed upper matrix
+   //=====================================================================================
+
+   {
+      test_ = "Packed UpperMatrix element access";
+
+      blaze::UpperMatrix< PackedMatrix<int,rowMajor> > upper{ { 1, 2, 4 }, { 0, 3, 5 }, { 0, 0, 6 } };
+      blaze::DynamicMatrix<int,rowMajor> ref{ { 1, 2, 4 }, { 0, 3, 5 }, { 0, 0, 6 } };
+
+      row( upper, 1UL )[2UL] = 7;
+      ref(1,2) = 7;
+
+      checkNonZeros( upper, 6UL );
+      checkEqual   ( upper, ref );
+
+      test_ = "Packed UpperMatrix addition assignment";
+
+      upper += ref;
+      ref   *= 2;
+
+      checkEqual( upper, ref );
+
+      test_ = "Packed UpperMatrix invalid assignment";
+
+      try {
+         upper(2,0) = 1;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment to lower matrix element succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << upper << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      checkEqual( upper, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of views on packed matrices and packed matrix adaptors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of submatrix, column, and band views on packed matrices and
+// packed matrix adaptors. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void ClassTest::testViews()
+{
+   using blaze::PackedMatrix;
+   using blaze::DynamicMatrix;
+   using blaze::DynamicVector;
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+
+   //=====================================================================================
+   // Packed matrix
+   //=====================================================================================
+
+   {
+      test_ = "PackedMatrix submatrix access";
+
+      PackedMatrix<double,rowMajor> mat{ { 1, 2, 4 }, { 2, 3, 5 }, { 4, 5, 6 } };
+      DynamicMatrix<double,rowMajor> ref{ { 1, 2, 4 }, { 2, 3, 5 }, { 4, 5, 6 } };
+
+      auto sm = submatrix( mat, 0UL, 1UL, 2UL, 2UL );
+
+      checkRows   ( sm, 2UL );
+      checkColumns( sm, 2UL );
+      checkEqual  ( sm, submatrix( ref, 0UL, 1UL, 2UL, 2UL ) );
+
+      sm(1,0) = 7.0;
+      ref(1,1) = 7.0;
+
+      checkEqual( mat, ref );
+
+      sm = DynamicMatrix<double,rowMajor>{ { 8, 9 }, { 9, 10 } };
+      ref(0,1) = ref(1,0) = 8.0;
+      ref(0,2) = ref(2,0) = ref(1,1) = 9.0;
+      ref(1,2) = ref(2,1) = 10.0;
+
+      checkEqual( mat, ref );
+
+      test_ = "PackedMatrix column access";
+
+      auto col = column( mat, 2UL );
+
+      if( col.size() != 3UL || col != column( ref, 2UL ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid column elements detected\n"
+             << " Details:\n"
+             << "   Result:\n" << col << "\n"
+             << "   Expected result:\n" << column( ref, 2UL ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      col[0] = 11.0;
+      ref(0,2) = ref(2,0) = 11.0;
+
+      checkEqual( mat, ref );
+
+      test_ = "PackedMatrix band access";
+
+      auto b = band( mat, -1L );
+
+      if( b.size() != 2UL || b != band( ref, -1L ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid band elements detected\n"
+             << " Details:\n"
+             << "   Result:\n" << b << "\n"
+             << "   Expected result:\n" << band( ref, -1L ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      b = DynamicVector<double>{ 12.0, 13.0 };
+      ref(1,0) = ref(0,1) = 12.0;
+      ref(2,1) = ref(1,2) = 13.0;
+
+      checkEqual( mat, ref );
+   }
+
+
+   //=====================================================================================
+   // Packed symmetric matrix
+   //=====================================================================================
+
+   {
+      test_ = "Packed SymmetricMatrix submatrix access";
+
+      blaze::SymmetricMatrix< PackedMatrix<double,columnMajor> > sym{ { 1, 2, 0 }, { 2, 3, 4 }, { 0, 4, 5 } };
+      DynamicMatrix<double,columnMajor> ref{ { 1, 2, 0 }, { 2, 3, 4 }, { 0, 4, 5 } };
+
+      auto sm = submatrix( sym, 1UL, 0UL, 2UL, 3UL );
+
+      checkRows   ( sm, 2UL );
+      checkColumns( sm, 3UL );
+      checkEqual  ( sm, submatrix( ref, 1UL, 0UL, 2UL, 3UL ) );
+
+      sm(1,0) = 6.0;
+      ref(2,0) = ref(0,2) = 6.0;
+
+      checkEqual( sym, ref );
+
+      test_ = "Packed SymmetricMatrix column access";
+
+      auto col = column( sym, 1UL );
+      col[2] = 7.0;
+      ref(2,1) = ref(1,2) = 7.0;
+
+      checkEqual( sym, ref );
+
+      test_ = "Packed SymmetricMatrix band access";
+
+      auto b = band( sym, 1L );
+
+      if( b.size() != 2UL || b != band( ref, 1L ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid band elements detected\n"
+             << " Details:\n"
+             << "   Result:\n" << b << "\n"
+             << "   Expected result:\n" << band( ref, 1L ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Packed lower matrix
+   //=====================================================================================
+
+   {
+      test_ = "Packed LowerMatrix submatrix access";
+
+      blaze::LowerMatrix< PackedMatrix<int,rowMajor> > lower{ { 1, 0, 0 }, { 2, 3, 0 }, { 4, 5, 6 } };
+      DynamicMatrix<int,rowMajor> ref{ { 1, 0, 0 }, { 2, 3, 0 }, { 4, 5, 6 } };
+
+      auto sm = submatrix( lower, 1UL, 1UL, 2UL, 2UL );
+      sm(1,0) = 7;
+      ref(2,1) = 7;
+
+      checkEqual( lower, ref );
+
+      test_ = "Packed LowerMatrix invalid submatrix assignment";
+
+      try {
+         sm(0,1) = 1;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment to upper matrix element succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << lower << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      checkEqual( lower, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the multiplication of the packed matrix adaptors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the dedicated matrix/vector and matrix/matrix multiplication
+// kernels of the packed matrix adaptors. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testMultiplication()
+{
+   using blaze::PackedMatrix;
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   using cplx = std::complex<double>;
+
+   for( size_t n=1UL; n<40UL; n+=7UL )
+   {
+      blaze::DynamicMatrix<double,rowMajor> A( n, n );
+      blaze::DynamicMatrix<cplx,rowMajor> C( n, n );
+      blaze::randomize( A );
+      blaze::randomize( C );
+
+      const blaze::DynamicMatrix<double,rowMajor> sym ( A + trans( A ) );
+      const blaze::DynamicMatrix<cplx,rowMajor>   herm( C + ctrans( C ) );
+
+      blaze::DynamicMatrix<double,rowMajor> lower( A ), upper( A );
+      for( size_t i=0UL; i<n; ++i ) {
+         for( size_t j=i+1UL; j<n; ++j ) {
+            lower(i,j) = upper(j,i) = 0.0;
+         }
+      }
+
+      testMultiplication< blaze::SymmetricMatrix< PackedMatrix<double,rowMajor> > >( sym );
+      testMultiplication< blaze::SymmetricMatrix< PackedMatrix<double,columnMajor> > >( sym );
+      testMultiplication< blaze::HermitianMatrix< PackedMatrix<cplx,rowMajor> > >( herm );
+      testMultiplication< blaze::HermitianMatrix< PackedMatrix<cplx,columnMajor> > >( herm );
+      testMultiplication< blaze::LowerMatrix< PackedMatrix<double,rowMajor> > >( lower );
+      testMultiplication< blaze::LowerMatrix< PackedMatrix<double,columnMajor> > >( lower );
+      testMultiplication< blaze::UpperMatrix< PackedMatrix<double,rowMajor> > >( upper );
+      testMultiplication< blaze::UpperMatrix< PackedMatrix<double,columnMajor> > >( upper );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the multiplication of a particular packed matrix adaptor.
+//
+// \param ref The dense reference matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the matrix/vector and matrix/matrix multiplications of the given packed
+// matrix adaptor type with the according multiplications of the dense reference matrix. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT    // Type of the packed matrix adaptor
+        , typename RT >  // Type of the dense reference matrix
+void ClassTest::testMultiplication( const RT& ref )
+{
+   using ET = blaze::ElementType_t<MT>;
+
+   const size_t n( ref.rows() );
+
+   const MT mat( ref );
+
+   blaze::DynamicVector<ET,blaze::columnVector> x( n );
+   blaze::DynamicMatrix<ET,blaze::rowMajor> B( n, 11UL );
+   blaze::randomize( x );
+   blaze::randomize( B );
+
+   const blaze::DynamicMatrix<ET,blaze::columnMajor> TB( B );
+
+
+   //=====================================================================================
+   // Matrix/vector multiplication
+   //=====================================================================================
+
+   {
+      test_ = "Packed matrix/DynamicVector multiplication";
+
+      const blaze::DynamicVector<ET,blaze::columnVector> res( mat * x );
+      const blaze::DynamicVector<ET,blaze::columnVector> exp( ref * x );
+
+      for( size_t i=0UL; i<n; ++i ) {
+         if( !isEqual( res[i], exp[i] ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Multiplication failed\n"
+                << " Details:\n"
+                << "   Storage order: " << ( blaze::IsRowMajorMatrix_v<MT> ? "row-major" : "column-major" ) << "\n"
+                << "   Result:\n" << res << "\n"
+                << "   Expected result:\n" << exp << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Matrix/matrix multiplication
+   //=====================================================================================
+
+   {
+      test_ = "Packed matrix/row-major DynamicMatrix multiplication";
+
+      const blaze::DynamicMatrix<ET,blaze::rowMajor> res( mat * B );
+
+      checkEqual( res, ref * B );
+   }
+
+   {
+      test_ = "Packed matrix/column-major DynamicMatrix multiplication";
+
+      const blaze::DynamicMatrix<ET,blaze::columnMajor> res( mat * TB );
+
+      checkEqual( res, ref * B );
+   }
+}
+//*************************************************************************************************
+
+} // namespace packedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running PackedMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_PACKEDMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during PackedMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
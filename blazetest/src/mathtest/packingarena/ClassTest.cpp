@@ -0,0 +1,342 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/packingarena/ClassTest.cpp
+//  \brief Source file for the PackingArena class test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/dense/PackingArena.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blazetest/mathtest/IsEqual.h>
+#include <blazetest/mathtest/packingarena/ClassTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace packingarena {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the PackingArena class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testAcquire();
+   testReserve();
+   testRelease();
+   testMultiplication();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the acquisition of packing buffers.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the acquire() function of the PackingArena class. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAcquire()
+{
+   test_ = "PackingArena::acquire()";
+
+   blaze::PackingArena& arena( blaze::PackingArena::instance() );
+   arena.release();
+   arena.resetStatistics();
+
+   {
+      blaze::DynamicMatrix<double,blaze::rowMajor>& buf( arena.acquire<double,blaze::rowMajor>( 7UL, 5UL ) );
+      buf = 2.0;
+   }
+
+   {
+      blaze::DynamicMatrix<double,blaze::rowMajor>& buf( arena.acquire<double,blaze::rowMajor>( 5UL, 3UL ) );
+      const blaze::PackingArenaStatistics stats( arena.statistics() );
+
+      bool padding( true );
+      for( size_t i=0UL; i<buf.rows(); ++i )
+         for( size_t j=buf.columns(); j<buf.spacing(); ++j )
+            if( buf.data()[i*buf.spacing()+j] != 0.0 ) padding = false;
+
+      if( buf.rows() != 5UL || buf.columns() != 3UL || !padding ||
+          stats.acquisitions != 2UL || stats.allocations != 1UL || stats.bytes == 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid packing buffer\n"
+             << " Details:\n"
+             << "   Rows         : " << buf.rows() << " (expected 5)\n"
+             << "   Columns      : " << buf.columns() << " (expected 3)\n"
+             << "   Zero padding : " << padding << "\n"
+             << "   Acquisitions : " << stats.acquisitions << " (expected 2)\n"
+             << "   Allocations  : " << stats.allocations << " (expected 1)\n"
+             << "   Bytes        : " << stats.bytes << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      arena.acquire<double,blaze::rowMajor>( 100UL, 100UL );
+      arena.acquire<double,blaze::rowMajor>( 101UL, 100UL );
+      arena.acquire<double,blaze::columnMajor>( 8UL, 8UL );
+      const blaze::PackingArenaStatistics stats( arena.statistics() );
+
+      if( stats.allocations != 3UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of allocations\n"
+             << " Details:\n"
+             << "   Allocations : " << stats.allocations << " (expected 3)\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   arena.release();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the reservePackingArena() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the reservation of the packing buffers via the reservePackingArena()
+// function. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testReserve()
+{
+   test_ = "reservePackingArena() function";
+
+   blaze::releasePackingArena();
+   blaze::reservePackingArena<double>( 150UL );
+   blaze::resetPackingArenaStatistics();
+
+   blaze::DynamicMatrix<double,blaze::rowMajor> A( 150UL, 150UL ), B( 150UL, 150UL ), C;
+   blaze::DynamicMatrix<double,blaze::columnMajor> D;
+   randomize( A );
+   randomize( B );
+
+   BLAZE_SERIAL_SECTION {
+      C = A * B;
+      D = A * B;
+   }
+
+   const blaze::PackingArenaStatistics stats( blaze::getPackingArenaStatistics() );
+
+   if( stats.allocations != 0UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Multiplication allocated despite reserved packing arena\n"
+          << " Details:\n"
+          << "   Acquisitions : " << stats.acquisitions << "\n"
+          << "   Allocations  : " << stats.allocations << " (expected 0)\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   blaze::releasePackingArena();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the releasePackingArena() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the release of the packing buffers via the releasePackingArena()
+// function. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testRelease()
+{
+   test_ = "releasePackingArena() function";
+
+   blaze::reservePackingArena<float>( 64UL );
+   blaze::reservePackingArena<double>( 64UL );
+
+   if( blaze::getPackingArenaStatistics().bytes == 0UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Reserving the packing arena failed\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   blaze::releasePackingArena();
+
+   if( blaze::getPackingArenaStatistics().bytes != 0UL ||
+       blaze::PackingArena::instance().acquire<double,blaze::rowMajor>( 0UL, 0UL ).capacity() != 0UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Releasing the packing arena failed\n"
+          << " Details:\n"
+          << "   Bytes : " << blaze::getPackingArenaStatistics().bytes << " (expected 0)\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of repeated dense matrix multiplications.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that repeated dense matrix multiplications of varying size compute the
+// correct result and don't perform any heap allocations for packing buffers once the arena has
+// reached the size of the largest multiplication. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMultiplication()
+{
+   test_ = "Repeated dense matrix multiplications";
+
+   blaze::releasePackingArena();
+
+   const size_t sizes[] = { 131UL, 67UL, 211UL, 33UL, 173UL };
+
+   BLAZE_SERIAL_SECTION
+   {
+      for( size_t run=0UL; run<2UL; ++run )
+      {
+         if( run == 1UL )
+            blaze::resetPackingArenaStatistics();
+
+         for( size_t n : sizes )
+         {
+            blaze::DynamicMatrix<double,blaze::rowMajor> A( n, n+3UL ), B( n+3UL, n-1UL ), C, R( n, n-1UL, 0.0 );
+            blaze::DynamicMatrix<double,blaze::columnMajor> TA( n, n+3UL ), D;
+            randomize( A );
+            randomize( B );
+            TA = A;
+
+            C = A * B;
+            D = TA * B;
+
+            for( size_t i=0UL; i<A.rows(); ++i )
+               for( size_t k=0UL; k<A.columns(); ++k )
+                  for( size_t j=0UL; j<B.columns(); ++j )
+                     R(i,j) += A(i,k) * B(k,j);
+
+            if( !isEqual( C, R ) || !isEqual( D, R ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Multiplication failed\n"
+                   << " Details:\n"
+                   << "   Size: " << n << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+
+   const blaze::PackingArenaStatistics stats( blaze::getPackingArenaStatistics() );
+
+   if( stats.allocations != 0UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Steady state multiplications allocated packing buffers\n"
+          << " Details:\n"
+          << "   Acquisitions : " << stats.acquisitions << "\n"
+          << "   Allocations  : " << stats.allocations << " (expected 0)\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   blaze::releasePackingArena();
+}
+//*************************************************************************************************
+
+} // namespace packingarena
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running PackingArena class test..." << std::endl;
+
+   try
+   {
+      RUN_PACKINGARENA_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during PackingArena class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
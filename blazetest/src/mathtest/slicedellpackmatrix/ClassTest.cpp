@@ -0,0 +1,470 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/slicedellpackmatrix/ClassTest.cpp
+//  \brief Source file for the SlicedEllpackMatrix class test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <complex>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/SlicedEllpackMatrix.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/slicedellpackmatrix/ClassTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace slicedellpackmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the SlicedEllpackMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testAccess();
+   testAssignment();
+   testMultiplication();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the SlicedEllpackMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the SlicedEllpackMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   //=====================================================================================
+   // Default constructor
+   //=====================================================================================
+
+   {
+      test_ = "SlicedEllpackMatrix default constructor";
+
+      blaze::SlicedEllpackMatrix<int> mat;
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Conversion constructor
+   //=====================================================================================
+
+   {
+      test_ = "SlicedEllpackMatrix conversion constructor (row-major CompressedMatrix)";
+
+      const blaze::CompressedMatrix<int,blaze::rowMajor> ref{ { 1, 0, 2, 0, 0 },
+                                                              { 0, 0, 0, 0, 0 },
+                                                              { 3, 4, 5, 6, 7 },
+                                                              { 0, 0, 0, 8, 0 },
+                                                              { 0, 9, 0, 0, 0 } };
+
+      for( size_t C=1UL; C<7UL; ++C ) {
+         for( size_t sigma=1UL; sigma<7UL; ++sigma )
+         {
+            const blaze::SlicedEllpackMatrix<int> mat( ref, C, sigma );
+
+            checkRows    ( mat, 5UL );
+            checkColumns ( mat, 5UL );
+            checkNonZeros( mat, 9UL );
+            checkEqual   ( mat, ref );
+
+            if( mat.sliceHeight() != C || mat.sortingScope() != sigma ||
+                mat.slices() != ( 5UL + C - 1UL ) / C ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Invalid slice layout detected\n"
+                   << " Details:\n"
+                   << "   Slice height : " << mat.sliceHeight() << " (expected " << C << ")\n"
+                   << "   Sorting scope: " << mat.sortingScope() << " (expected " << sigma << ")\n"
+                   << "   Slices       : " << mat.slices() << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+
+   {
+      test_ = "SlicedEllpackMatrix conversion constructor (column-major CompressedMatrix)";
+
+      blaze::CompressedMatrix<double,blaze::columnMajor> ref( 13UL, 9UL );
+      blaze::randomize( ref, 40UL );
+
+      const blaze::SlicedEllpackMatrix<double,uint32_t> mat( ref, 4UL, 8UL );
+
+      checkRows    ( mat, 13UL );
+      checkColumns ( mat,  9UL );
+      checkNonZeros( mat, 40UL );
+      checkEqual   ( mat, ref );
+   }
+
+   {
+      test_ = "SlicedEllpackMatrix conversion constructor (invalid slice height)";
+
+      const blaze::CompressedMatrix<int,blaze::rowMajor> ref( 3UL, 3UL );
+
+      try {
+         const blaze::SlicedEllpackMatrix<int> mat( ref, 0UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction with invalid slice height succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Copy and move constructor
+   //=====================================================================================
+
+   {
+      test_ = "SlicedEllpackMatrix copy constructor";
+
+      const blaze::CompressedMatrix<int,blaze::rowMajor> ref{ { 1, 0, 2 }, { 0, 3, 0 } };
+      const blaze::SlicedEllpackMatrix<int> mat1( ref, 2UL, 2UL );
+      const blaze::SlicedEllpackMatrix<int> mat2( mat1 );
+
+      checkRows    ( mat2, 2UL );
+      checkColumns ( mat2, 3UL );
+      checkNonZeros( mat2, 3UL );
+      checkEqual   ( mat2, ref );
+   }
+
+   {
+      test_ = "SlicedEllpackMatrix move constructor";
+
+      const blaze::CompressedMatrix<int,blaze::rowMajor> ref{ { 1, 0, 2 }, { 0, 3, 0 } };
+      blaze::SlicedEllpackMatrix<int> mat1( ref, 2UL, 2UL );
+      const blaze::SlicedEllpackMatrix<int> mat2( std::move( mat1 ) );
+
+      checkRows    ( mat2, 2UL );
+      checkColumns ( mat2, 3UL );
+      checkNonZeros( mat2, 3UL );
+      checkEqual   ( mat2, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the element access and iteration functions of the SlicedEllpackMatrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the element access functions and the iterators of the
+// SlicedEllpackMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testAccess()
+{
+   test_ = "SlicedEllpackMatrix iterators";
+
+   blaze::CompressedMatrix<double,blaze::rowMajor> ref( 37UL, 23UL );
+   blaze::randomize( ref, 150UL );
+   ref.reserve( 2UL, 23UL );
+   for( size_t j=0UL; j<23UL; ++j ) {
+      ref(2UL,j) = 1.0;
+   }
+
+   const blaze::SlicedEllpackMatrix<double,uint32_t> mat( ref, 8UL, 16UL );
+
+   checkNonZeros( mat, ref.nonZeros() );
+   checkEqual   ( mat, ref );
+
+   for( size_t i=0UL; i<ref.rows(); ++i )
+   {
+      if( mat.nonZeros(i) != ref.nonZeros(i) ||
+          size_t( mat.end(i) - mat.begin(i) ) != ref.nonZeros(i) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of non-zero elements in row " << i << "\n"
+             << " Details:\n"
+             << "   Number of non-zeros         : " << mat.nonZeros(i) << "\n"
+             << "   Expected number of non-zeros: " << ref.nonZeros(i) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      auto it( mat.cbegin(i) );
+      for( auto element=ref.cbegin(i); element!=ref.cend(i); ++element, ++it )
+      {
+         if( it->index() != element->index() || !isEqual( it->value(), element->value() ) ||
+             mat.find( i, element->index() ) != it ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid element in row " << i << "\n"
+                << " Details:\n"
+                << "   Index: " << it->index() << " (expected " << element->index() << ")\n"
+                << "   Value: " << it->value() << " (expected " << element->value() << ")\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   try {
+      const double value = mat.at( 37UL, 0UL );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Out-of-bounds access succeeded\n"
+          << " Details:\n"
+          << "   Value: " << value << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::out_of_range& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SlicedEllpackMatrix assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all assignment operators of the SlicedEllpackMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   {
+      test_ = "SlicedEllpackMatrix copy assignment";
+
+      const blaze::CompressedMatrix<int,blaze::rowMajor> ref{ { 1, 0, 2 }, { 0, 3, 0 }, { 4, 0, 0 } };
+      const blaze::SlicedEllpackMatrix<int> mat1( ref, 2UL, 3UL );
+      blaze::SlicedEllpackMatrix<int> mat2;
+      mat2 = mat1;
+
+      checkRows    ( mat2, 3UL );
+      checkColumns ( mat2, 3UL );
+      checkNonZeros( mat2, 4UL );
+      checkEqual   ( mat2, ref );
+   }
+
+   {
+      test_ = "SlicedEllpackMatrix CompressedMatrix assignment";
+
+      const blaze::CompressedMatrix<int,blaze::rowMajor> ref{ { 0, 0 }, { 5, 6 }, { 0, 7 } };
+      blaze::SlicedEllpackMatrix<int> mat( ref, 3UL, 1UL );
+      mat = blaze::CompressedMatrix<int,blaze::rowMajor>{ { 1, 2, 3 } };
+
+      checkRows    ( mat, 1UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 3UL );
+
+      if( mat.sliceHeight() != 3UL || mat(0UL,2UL) != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Slice height: " << mat.sliceHeight() << " (expected 3)\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the multiplication of sliced ELLPACK matrices with dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the sliced ELLPACK matrix/dense vector multiplication for
+// several element types, index types, slice heights and sorting scopes. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMultiplication()
+{
+   using blaze::SlicedEllpackMatrix;
+
+   using cplx = std::complex<double>;
+
+   for( size_t n=1UL; n<80UL; n+=13UL )
+   {
+      testMultiplication< SlicedEllpackMatrix<double> >( n, n, 3UL*n, 8UL, 1UL );
+      testMultiplication< SlicedEllpackMatrix<double,uint32_t> >( n+5UL, n, 2UL*n, 4UL, 16UL );
+      testMultiplication< SlicedEllpackMatrix<float> >( n, n+3UL, 4UL*n, 16UL, 32UL );
+      testMultiplication< SlicedEllpackMatrix<float,uint32_t> >( n+9UL, n+1UL, n, 32UL, 64UL );
+      testMultiplication< SlicedEllpackMatrix<double,uint32_t> >( n+7UL, n, n/2UL, 5UL, 3UL );
+      testMultiplication< SlicedEllpackMatrix<cplx> >( n+2UL, n, 2UL*n, 4UL, 8UL );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the multiplication of a particular sliced ELLPACK matrix type.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param nonzeros The number of non-zero elements of the matrix.
+// \param C The slice height of the matrix.
+// \param sigma The sorting scope of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the matrix/vector multiplication of the given sliced ELLPACK matrix
+// type with the according operation on a CompressedMatrix. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename MT >  // Type of the sliced ELLPACK matrix
+void ClassTest::testMultiplication( size_t m, size_t n, size_t nonzeros, size_t C, size_t sigma )
+{
+   using ET = blaze::ElementType_t<MT>;
+
+   blaze::CompressedMatrix<ET,blaze::rowMajor> ref( m, n );
+   blaze::randomize( ref, blaze::min( nonzeros, m*n ) );
+
+   const MT mat( ref, C, sigma );
+
+   blaze::DynamicVector<ET,blaze::columnVector> x( n );
+   blaze::randomize( x );
+
+   test_ = "SlicedEllpackMatrix/DynamicVector multiplication";
+
+   const blaze::DynamicVector<ET,blaze::columnVector> res( mat * x );
+   const blaze::DynamicVector<ET,blaze::columnVector> exp( ref * x );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      if( !isEqual( res[i], exp[i] ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Slice height : " << C << "\n"
+             << "   Sorting scope: " << sigma << "\n"
+             << "   Result:\n" << res << "\n"
+             << "   Expected result:\n" << exp << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   test_ = "SlicedEllpackMatrix/DynamicVector multiplication (non-contiguous vector)";
+
+   const blaze::DynamicVector<ET,blaze::columnVector> res2( mat * ( x + x ) );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      if( !isEqual( res2[i], ET(2)*exp[i] ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Slice height : " << C << "\n"
+             << "   Sorting scope: " << sigma << "\n"
+             << "   Result:\n" << res2 << "\n"
+             << "   Expected result:\n" << ( ET(2)*exp ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace slicedellpackmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running SlicedEllpackMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_SLICEDELLPACKMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during SlicedEllpackMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,252 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/smatsmatmult/ParallelTest.cpp
+//  \brief Source file for the parallel sparse matrix/sparse matrix multiplication test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/smatsmatmult/ParallelTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smatsmatmult {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the parallel test class.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ParallelTest::ParallelTest()
+{
+   testMultiplication();
+   testCancellation();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the parallel sparse matrix/sparse matrix multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the parallel sparse matrix/sparse matrix multiplication for matrices of
+// different sizes and densities. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ParallelTest::testMultiplication()
+{
+   // Very sparse matrices (hash-based accumulation)
+   testMultiplication( 400UL, 500UL, 700UL,  800UL, 1000UL );
+   testMultiplication( 250UL, 900UL, 1200UL, 300UL,  400UL );
+
+   // Dense rows of the result (dense accumulation)
+   testMultiplication( 150UL,  90UL, 160UL, 3000UL, 4000UL );
+
+   // Mixed densities and empty rows
+   testMultiplication( 300UL, 200UL, 250UL,  150UL, 5000UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the parallel multiplication of two randomly initialized sparse matrices.
+//
+// \param m The number of rows of the left-hand side matrix.
+// \param k The number of columns of the left-hand side matrix.
+// \param n The number of columns of the right-hand side matrix.
+// \param nonzeros1 The number of non-zero elements of the left-hand side matrix.
+// \param nonzeros2 The number of non-zero elements of the right-hand side matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ParallelTest::testMultiplication( size_t m, size_t k, size_t n, size_t nonzeros1, size_t nonzeros2 )
+{
+   SMat A( m, k );
+   SMat B( k, n );
+
+   blaze::randomize( A, nonzeros1, -5, 5 );
+   blaze::randomize( B, nonzeros2, -5, 5 );
+
+   const RMat ref( RMat( A ) * RMat( B ) );
+
+   {
+      std::ostringstream oss;
+      oss << "Row-major " << m << "x" << n << " SMatSMatMult";
+      test_ = oss.str();
+
+      SMat C;
+      C = A * B;
+
+      checkResult( C, ref );
+      checkResult( C, blaze::serial( A * B ) );
+   }
+
+   {
+      std::ostringstream oss;
+      oss << "Row-major " << m << "x" << n << " SMatSMatMult construction";
+      test_ = oss.str();
+
+      const SMat C( A * B );
+
+      checkResult( C, ref );
+   }
+
+   {
+      std::ostringstream oss;
+      oss << "Column-major " << m << "x" << n << " SMatSMatMult";
+      test_ = oss.str();
+
+      TSMat C;
+      C = A * B;
+
+      checkResult( C, ref );
+   }
+
+   {
+      std::ostringstream oss;
+      oss << "Row-major " << m << "x" << n << " SMatSMatMult with evaluated operand";
+      test_ = oss.str();
+
+      SMat C;
+      C = ( A + A ) * B;
+
+      checkResult( C, 2 * ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the parallel sparse matrix/sparse matrix multiplication with cancellation.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the parallel sparse matrix/sparse matrix multiplication in case some
+// elements of the result cancel out. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ParallelTest::testCancellation()
+{
+   test_ = "Row-major SMatSMatMult with cancellation";
+
+   SMat A( 200UL, 2UL );
+   SMat B( 2UL, 200UL );
+
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      A(i,0UL) = 1;
+      A(i,1UL) = 1;
+   }
+
+   for( size_t j=0UL; j<B.columns(); ++j ) {
+      B(0UL,j) = 1;
+      B(1UL,j) = ( j % 2UL == 0UL ) ? -1 : 1;
+   }
+
+   SMat C;
+   C = A * B;
+
+   checkResult( C, RMat( RMat( A ) * RMat( B ) ) );
+
+   if( C.nonZeros() != 100UL*200UL ) {
+      std::ostringstream oss;
+      oss << " Test : " << test_ << "\n"
+          << " Error: Invalid number of non-zero elements\n"
+          << " Details:\n"
+          << "   Number of non-zeros         : " << C.nonZeros() << "\n"
+          << "   Expected number of non-zeros: " << 100UL*200UL << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace smatsmatmult
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running parallel test..." << std::endl;
+
+   try
+   {
+      RUN_SMATSMATMULT_PARALLEL_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during parallel test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
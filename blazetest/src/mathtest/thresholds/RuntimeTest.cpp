@@ -0,0 +1,458 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/thresholds/RuntimeTest.cpp
+//  \brief Source file for the runtime threshold test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Configuration
+//*************************************************************************************************
+
+#undef BLAZE_USE_RUNTIME_THRESHOLDS
+#define BLAZE_USE_RUNTIME_THRESHOLDS 1
+
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <blaze/math/Calibration.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/system/Thresholds.h>
+#include <blazetest/mathtest/IsEqual.h>
+#include <blazetest/mathtest/thresholds/RuntimeTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace thresholds {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the RuntimeTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+RuntimeTest::RuntimeTest()
+{
+   testDefaults();
+   testSetThreshold();
+   testFile();
+   testOperations();
+   testCalibration();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the default values of the runtime thresholds.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that all runtime thresholds evaluate to their compile time defaults in
+// case they have not been set explicitly. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void RuntimeTest::testDefaults()
+{
+   test_ = "Runtime threshold defaults";
+
+   blaze::resetThresholds();
+
+   if( blaze::SMP_DVECASSIGN_THRESHOLD.value() != blaze::SMP_DVECASSIGN_THRESHOLD.defaultValue() ||
+       blaze::DMATDMATMULT_THRESHOLD.value()   != blaze::DMATDMATMULT_THRESHOLD.defaultValue() ||
+       blaze::SMP_SMATREDUCE_THRESHOLD.value() != blaze::SMP_SMATREDUCE_THRESHOLD.defaultValue() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid threshold default\n"
+          << " Details:\n"
+          << "   SMP_DVECASSIGN_THRESHOLD = " << blaze::SMP_DVECASSIGN_THRESHOLD.value() << "\n"
+          << "   DMATDMATMULT_THRESHOLD   = " << blaze::DMATDMATMULT_THRESHOLD.value() << "\n"
+          << "   SMP_SMATREDUCE_THRESHOLD = " << blaze::SMP_SMATREDUCE_THRESHOLD.value() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   if( std::string( blaze::thresholdName( blaze::DMATDVECMULT_THRESHOLD.id() ) ) != "DMATDVECMULT_THRESHOLD" ||
+       std::string( blaze::thresholdName( blaze::SMP_SMATREDUCE_THRESHOLD.id() ) ) != "SMP_SMATREDUCE_THRESHOLD" ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid threshold name\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the setThreshold() and resetThreshold() functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the setting and resetting of individual runtime thresholds. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void RuntimeTest::testSetThreshold()
+{
+   test_ = "setThreshold() function";
+
+   blaze::resetThresholds();
+   blaze::setThreshold( blaze::SMP_DVECASSIGN_THRESHOLD, 123UL );
+
+   if( blaze::SMP_DVECASSIGN_THRESHOLD != 123UL ||
+       blaze::SMP_DVECDVECADD_THRESHOLD != blaze::SMP_DVECDVECADD_THRESHOLD.defaultValue() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Setting a threshold failed\n"
+          << " Details:\n"
+          << "   SMP_DVECASSIGN_THRESHOLD  = " << blaze::SMP_DVECASSIGN_THRESHOLD.value() << "\n"
+          << "   SMP_DVECDVECADD_THRESHOLD = " << blaze::SMP_DVECDVECADD_THRESHOLD.value() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   test_ = "resetThreshold() function";
+
+   blaze::resetThreshold( blaze::SMP_DVECASSIGN_THRESHOLD );
+
+   if( blaze::SMP_DVECASSIGN_THRESHOLD != blaze::SMP_DVECASSIGN_THRESHOLD.defaultValue() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Resetting a threshold failed\n"
+          << " Details:\n"
+          << "   SMP_DVECASSIGN_THRESHOLD = " << blaze::SMP_DVECASSIGN_THRESHOLD.value() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   test_ = "setThreshold() function with invalid value";
+
+   try {
+      blaze::setThreshold( blaze::SMP_DVECASSIGN_THRESHOLD, ~blaze::size_t(0) );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Setting an invalid threshold value succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the loadThresholds() and saveThresholds() functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the writing and reading of threshold files. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+void RuntimeTest::testFile()
+{
+   const std::string file( "thresholds.cfg" );
+
+   {
+      test_ = "Threshold file round trip";
+
+      blaze::resetThresholds();
+      blaze::setThreshold( blaze::SMP_DMATDVECMULT_THRESHOLD, 777UL );
+      blaze::setThreshold( blaze::TDMATTDMATMULT_THRESHOLD, 4242UL );
+      blaze::saveThresholds( file );
+
+      blaze::resetThresholds();
+      blaze::loadThresholds( file );
+
+      if( blaze::SMP_DMATDVECMULT_THRESHOLD != 777UL ||
+          blaze::TDMATTDMATMULT_THRESHOLD != 4242UL ||
+          blaze::SMP_DVECASSIGN_THRESHOLD != blaze::SMP_DVECASSIGN_THRESHOLD.defaultValue() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Loading the threshold file failed\n"
+             << " Details:\n"
+             << "   SMP_DMATDVECMULT_THRESHOLD = " << blaze::SMP_DMATDVECMULT_THRESHOLD.value() << "\n"
+             << "   TDMATTDMATMULT_THRESHOLD   = " << blaze::TDMATTDMATMULT_THRESHOLD.value() << "\n"
+             << "   SMP_DVECASSIGN_THRESHOLD   = " << blaze::SMP_DVECASSIGN_THRESHOLD.value() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Threshold file with comments";
+
+      {
+         std::ofstream out( file.c_str() );
+         out << "# Comment\n\nSMP_DVECASSIGN_THRESHOLD 99\n";
+      }
+
+      blaze::resetThresholds();
+      blaze::loadThresholds( file );
+
+      if( blaze::SMP_DVECASSIGN_THRESHOLD != 99UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Loading the threshold file failed\n"
+             << " Details:\n"
+             << "   SMP_DVECASSIGN_THRESHOLD = " << blaze::SMP_DVECASSIGN_THRESHOLD.value() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Malformed threshold file";
+
+      {
+         std::ofstream out( file.c_str() );
+         out << "SMP_DVECASSIGN_THRESHOLD many\n";
+      }
+
+      try {
+         blaze::loadThresholds( file );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Loading a malformed threshold file succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      const char* files[] = { "SMP_DMATASSIGN_THRESHOLD 5\nUNKNOWN_THRESHOLD 1\n",
+                              "SMP_DMATASSIGN_THRESHOLD 5\nSMP_DVECASSIGN_THRESHOLD 18446744073709551615\n",
+                              "SMP_DMATASSIGN_THRESHOLD 5\nSMP_DVECASSIGN_THRESHOLD -5\n",
+                              "SMP_DMATASSIGN_THRESHOLD 5\nSMP_DVECASSIGN_THRESHOLD 12abc\n",
+                              "SMP_DMATASSIGN_THRESHOLD 5\nSMP_DVECASSIGN_THRESHOLD 12 13\n" };
+
+      for( const char* content : files )
+      {
+         test_ = "Invalid threshold file";
+
+         {
+            std::ofstream out( file.c_str() );
+            out << content;
+         }
+
+         blaze::resetThresholds();
+         blaze::setThreshold( blaze::SMP_DVECASSIGN_THRESHOLD, 42UL );
+
+         try {
+            blaze::loadThresholds( file );
+
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Loading an invalid threshold file succeeded\n"
+                << " Details:\n"
+                << "   File content:\n" << content << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+         catch( std::invalid_argument& ) {}
+
+         if( blaze::SMP_DVECASSIGN_THRESHOLD != 42UL ||
+             blaze::SMP_DMATASSIGN_THRESHOLD != blaze::SMP_DMATASSIGN_THRESHOLD.defaultValue() ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Loading an invalid threshold file modified the thresholds\n"
+                << " Details:\n"
+                << "   File content:\n" << content << "\n"
+                << "   SMP_DVECASSIGN_THRESHOLD = " << blaze::SMP_DVECASSIGN_THRESHOLD.value() << "\n"
+                << "   SMP_DMATASSIGN_THRESHOLD = " << blaze::SMP_DMATASSIGN_THRESHOLD.value() << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   std::remove( file.c_str() );
+   blaze::resetThresholds();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of operations with modified runtime thresholds.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the result of dense operations does not depend on the values of
+// the runtime thresholds. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void RuntimeTest::testOperations()
+{
+   test_ = "Operations with runtime thresholds";
+
+   blaze::DynamicMatrix<double,blaze::rowMajor> A( 67UL, 67UL ), B( 67UL, 67UL );
+   blaze::DynamicVector<double,blaze::columnVector> x( 67UL );
+   randomize( A );
+   randomize( B );
+   randomize( x );
+
+   blaze::resetThresholds();
+
+   const blaze::DynamicMatrix<double,blaze::rowMajor> C1( A * B );
+   const blaze::DynamicVector<double,blaze::columnVector> y1( A * x + x );
+
+   blaze::setThreshold( blaze::DMATDMATMULT_THRESHOLD, 1UL );
+   blaze::setThreshold( blaze::DMATDVECMULT_THRESHOLD, 1UL );
+   blaze::setThreshold( blaze::SMP_DMATDMATMULT_THRESHOLD, 0UL );
+   blaze::setThreshold( blaze::SMP_DMATDVECMULT_THRESHOLD, 0UL );
+   blaze::setThreshold( blaze::SMP_DVECDVECADD_THRESHOLD, 0UL );
+
+   const blaze::DynamicMatrix<double,blaze::rowMajor> C2( A * B );
+   const blaze::DynamicVector<double,blaze::columnVector> y2( A * x + x );
+
+   blaze::resetThresholds();
+
+   if( !isEqual( C1, C2 ) || !isEqual( y1, y2 ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Operation result depends on the thresholds\n"
+          << " Details:\n"
+          << "   Result with default thresholds:\n" << y1 << "\n"
+          << "   Result with modified thresholds:\n" << y2 << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the calibrateThresholds() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the calibration of the thresholds and the creation of the according
+// threshold file. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void RuntimeTest::testCalibration()
+{
+   test_ = "calibrateThresholds() function";
+
+   const std::string file( "calibration.cfg" );
+   std::remove( file.c_str() );
+
+   blaze::resetThresholds();
+   blaze::calibrateThresholds<float>( file );
+
+   const blaze::size_t dmatdmatmult( blaze::DMATDMATMULT_THRESHOLD );
+   const blaze::size_t dvecassign  ( blaze::SMP_DVECASSIGN_THRESHOLD );
+
+   if( !std::ifstream( file.c_str() ).good() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Threshold file has not been written\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   blaze::resetThresholds();
+   blaze::calibrateThresholds<float>( file );
+
+   if( blaze::DMATDMATMULT_THRESHOLD != dmatdmatmult || blaze::SMP_DVECASSIGN_THRESHOLD != dvecassign ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Reloading the calibrated thresholds failed\n"
+          << " Details:\n"
+          << "   DMATDMATMULT_THRESHOLD   = " << blaze::DMATDMATMULT_THRESHOLD.value()
+          << " (expected " << dmatdmatmult << ")\n"
+          << "   SMP_DVECASSIGN_THRESHOLD = " << blaze::SMP_DVECASSIGN_THRESHOLD.value()
+          << " (expected " << dvecassign << ")\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   std::remove( file.c_str() );
+   blaze::resetThresholds();
+}
+//*************************************************************************************************
+
+} // namespace thresholds
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running runtime threshold test..." << std::endl;
+
+   try
+   {
+      RUN_THRESHOLDS_RUNTIME_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during runtime threshold test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
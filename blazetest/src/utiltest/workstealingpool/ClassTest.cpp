@@ -0,0 +1,366 @@
+//=================================================================================================
+/*!
+//  \file src/utiltest/workstealingpool/ClassTest.cpp
+//  \brief Source file for the WorkStealingPool class test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include <blaze/util/threadpool/WorkStealingDeque.h>
+#include <blaze/util/WorkStealingPool.h>
+#include <blazetest/utiltest/workstealingpool/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace workstealingpool {
+
+//=================================================================================================
+//
+//  TYPE DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Type of the tested work-stealing thread pool.
+*/
+using Pool = blaze::WorkStealingPool< std::thread
+                                    , std::mutex
+                                    , std::unique_lock<std::mutex>
+                                    , std::condition_variable >;
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the WorkStealingPool class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testDeque();
+   testConcurrentSteal();
+   testSchedule();
+   testResize();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the single-threaded functionality of the WorkStealingDeque class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the LIFO order of the owner operations, the FIFO order of the steal
+// operation and the growth of the deque. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testDeque()
+{
+   test_ = "WorkStealingDeque push/pop/steal";
+
+   std::vector<int> values( tasks );
+   blaze::threadpool::WorkStealingDeque<int*> deque( 4UL );
+
+   for( size_t i=0UL; i<tasks; ++i ) {
+      deque.push( &values[i] );
+   }
+
+   if( deque.size() != tasks || deque.capacity() < tasks ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid size/capacity detected\n"
+          << " Details:\n"
+          << "   Size             : " << deque.size() << "\n"
+          << "   Capacity         : " << deque.capacity() << "\n"
+          << "   Expected min size: " << tasks << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   if( deque.steal() != &values[0] || deque.pop() != &values[tasks-1UL] ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid element order detected\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   size_t count( 2UL );
+   while( deque.pop() != nullptr ) {
+      ++count;
+   }
+
+   if( count != tasks || !deque.isEmpty() || deque.steal() != nullptr ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of removed elements\n"
+          << " Details:\n"
+          << "   Result         : " << count << "\n"
+          << "   Expected result: " << tasks << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of concurrent steal operations on a WorkStealingDeque.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that in case of concurrent pop() and steal() operations every element
+// is removed exactly once. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void ClassTest::testConcurrentSteal()
+{
+   test_ = "WorkStealingDeque concurrent steal";
+
+   std::vector<int> values( tasks, 0 );
+   std::vector< std::atomic<int> > hits( tasks );
+   for( auto& hit : hits ) hit.store( 0 );
+
+   blaze::threadpool::WorkStealingDeque<int*> deque;
+   std::atomic<bool> done( false );
+
+   const auto record = [&]( int* ptr ) {
+      hits[ static_cast<size_t>( ptr - values.data() ) ].fetch_add( 1 );
+   };
+
+   std::vector<std::thread> thieves;
+   for( size_t t=0UL; t<threads; ++t ) {
+      thieves.emplace_back( [&]() {
+         while( !done.load() || !deque.isEmpty() ) {
+            if( int* ptr = deque.steal() ) record( ptr );
+         }
+      } );
+   }
+
+   for( size_t i=0UL; i<tasks; ++i ) {
+      deque.push( &values[i] );
+      if( i % 3UL == 0UL ) {
+         if( int* ptr = deque.pop() ) record( ptr );
+      }
+   }
+
+   while( int* ptr = deque.pop() ) {
+      record( ptr );
+   }
+
+   done.store( true );
+
+   for( auto& thief : thieves ) {
+      thief.join();
+   }
+
+   for( size_t i=0UL; i<tasks; ++i ) {
+      if( hits[i].load() != 1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Element " << i << " has been removed " << hits[i].load() << " times\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the task scheduling of the WorkStealingPool class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function schedules a large number of short tasks and verifies that all tasks have been
+// executed after the wait() function returns. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSchedule()
+{
+   test_ = "WorkStealingPool schedule/wait";
+
+   Pool pool( threads );
+
+   if( pool.size() != threads ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid pool size detected\n"
+          << " Details:\n"
+          << "   Size         : " << pool.size() << "\n"
+          << "   Expected size: " << threads << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   std::atomic<size_t> sum( 0UL );
+
+   for( size_t round=0UL; round<10UL; ++round )
+   {
+      sum.store( 0UL );
+
+      for( size_t i=0UL; i<tasks; ++i ) {
+         pool.schedule( [&sum]( size_t value ){ sum.fetch_add( value ); }, i );
+      }
+
+      pool.wait();
+
+      if( sum.load() != tasks*(tasks-1UL)/2UL || pool.pending() != 0UL || !pool.isEmpty() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Not all tasks have been executed\n"
+             << " Details:\n"
+             << "   Result         : " << sum.load() << "\n"
+             << "   Expected result: " << tasks*(tasks-1UL)/2UL << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the resize functionality of the WorkStealingPool class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the resize() function, including the resize to a single thread, in which
+// case all tasks are executed by the thread calling wait(). In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testResize()
+{
+   test_ = "WorkStealingPool resize";
+
+   Pool pool( 2UL );
+
+   for( size_t n : { 1UL, threads, 3UL } )
+   {
+      pool.resize( n );
+
+      std::atomic<size_t> count( 0UL );
+
+      for( size_t i=0UL; i<tasks; ++i ) {
+         pool.schedule( [&count](){ ++count; } );
+      }
+
+      pool.wait();
+
+      if( pool.size() != n || count.load() != tasks ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Resize operation failed\n"
+             << " Details:\n"
+             << "   Size                    : " << pool.size() << "\n"
+             << "   Expected size           : " << n << "\n"
+             << "   Executed tasks          : " << count.load() << "\n"
+             << "   Expected executed tasks : " << tasks << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   try {
+      pool.resize( 0UL );
+   }
+   catch( std::invalid_argument& ) {
+      return;
+   }
+
+   std::ostringstream oss;
+   oss << " Test: " << test_ << "\n"
+       << " Error: Resizing to zero threads succeeded\n";
+   throw std::runtime_error( oss.str() );
+}
+//*************************************************************************************************
+
+} // namespace workstealingpool
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running WorkStealingPool class test..." << std::endl;
+
+   try
+   {
+      RUN_WORKSTEALINGPOOL_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during WorkStealingPool class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
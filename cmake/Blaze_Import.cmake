@@ -68,7 +68,7 @@ function(Blaze_Import)
          BLAS_MM                 # ON/OFF
          BLAS_INCLUDE            # <cblas.h>/<mkl_blas.h> or another blas header
          LAPACK                  # ON/OFF
-         THREADING               # HPX/C++11/Boost/OpenMP/off
+         THREADING               # HPX/C++11/WorkStealing/Boost/OpenMP/off
          CACHE_SIZE              # auto or an unsinged long (UL) value
          VECTORIZATION           # ON/OFF
          TRANSPOSE_FLAG          # columnVector/rowVector
@@ -148,6 +148,11 @@ function(Blaze_Import)
          THRESHOLD_SMP_TSMATTSMATMULT
          THRESHOLD_SMP_DMATREDUCE
          THRESHOLD_SMP_SMATREDUCE
+         THRESHOLD_SMP_DMATBATCH
+         THRESHOLD_SMP_SMATASSIGN
+         THRESHOLD_SMP_DVECREDUCE
+         THRESHOLD_SMP_DVECDVECINNER
+         THRESHOLD_SMP_DMATTOTALREDUCE
       )
       set(multiValueArgs )
 
@@ -231,6 +236,11 @@ function(Blaze_Import)
          target_compile_definitions(Blaze INTERFACE BLAZE_USE_CPP_THREADS)
          target_link_libraries(Blaze INTERFACE ${CMAKE_THREAD_LIBS_INIT})
          msg("Configured C++11 for multithreading.")
+      elseif(Blaze_Import_THREADING  STREQUAL "WorkStealing")
+         find_package(Threads REQUIRED)
+         target_compile_definitions(Blaze INTERFACE BLAZE_USE_WORK_STEALING_THREADS)
+         target_link_libraries(Blaze INTERFACE ${CMAKE_THREAD_LIBS_INIT})
+         msg("Configured C++11 work-stealing for multithreading.")
       elseif(Blaze_Import_THREADING  STREQUAL "BOOST")
          find_package(Boost REQUIRED COMPONENTS thread)
          target_compile_definitions(blaze INTERFACE BLAZE_USE_BOOST_THREADS)
@@ -963,6 +973,41 @@ function(Blaze_Import)
          msg_db("Using default configuration for SMP sparse matrix reduction Threshold.")
       endif()
 
+      if(Blaze_Import_THRESHOLD_SMP_DMATBATCH)
+         target_compile_definitions( Blaze INTERFACE BLAZE_SMP_DMATBATCH_THRESHOLD=${Blaze_Import_THRESHOLD_SMP_DMATBATCH} )
+         msg_db("Configuring SMP batched dense matrix operation Threshold : ${Blaze_Import_THRESHOLD_SMP_DMATBATCH}")
+      else()
+         msg_db("Using default configuration for SMP batched dense matrix operation Threshold.")
+      endif()
+
+      if(Blaze_Import_THRESHOLD_SMP_SMATASSIGN)
+         target_compile_definitions( Blaze INTERFACE BLAZE_SMP_SMATASSIGN_THRESHOLD=${Blaze_Import_THRESHOLD_SMP_SMATASSIGN} )
+         msg_db("Configuring SMP sparse matrix assignment Threshold : ${Blaze_Import_THRESHOLD_SMP_SMATASSIGN}")
+      else()
+         msg_db("Using default configuration for SMP sparse matrix assignment Threshold.")
+      endif()
+
+      if(Blaze_Import_THRESHOLD_SMP_DVECREDUCE)
+         target_compile_definitions( Blaze INTERFACE BLAZE_SMP_DVECREDUCE_THRESHOLD=${Blaze_Import_THRESHOLD_SMP_DVECREDUCE} )
+         msg_db("Configuring SMP dense vector reduction Threshold : ${Blaze_Import_THRESHOLD_SMP_DVECREDUCE}")
+      else()
+         msg_db("Using default configuration for SMP dense vector reduction Threshold.")
+      endif()
+
+      if(Blaze_Import_THRESHOLD_SMP_DVECDVECINNER)
+         target_compile_definitions( Blaze INTERFACE BLAZE_SMP_DVECDVECINNER_THRESHOLD=${Blaze_Import_THRESHOLD_SMP_DVECDVECINNER} )
+         msg_db("Configuring SMP dense vector/dense vector inner product Threshold : ${Blaze_Import_THRESHOLD_SMP_DVECDVECINNER}")
+      else()
+         msg_db("Using default configuration for SMP dense vector/dense vector inner product Threshold.")
+      endif()
+
+      if(Blaze_Import_THRESHOLD_SMP_DMATTOTALREDUCE)
+         target_compile_definitions( Blaze INTERFACE BLAZE_SMP_DMATTOTALREDUCE_THRESHOLD=${Blaze_Import_THRESHOLD_SMP_DMATTOTALREDUCE} )
+         msg_db("Configuring SMP dense matrix total reduction Threshold : ${Blaze_Import_THRESHOLD_SMP_DMATTOTALREDUCE}")
+      else()
+         msg_db("Using default configuration for SMP dense matrix total reduction Threshold.")
+      endif()
+
    #==================================================================================================
    #   MPI
    #==================================================================================================